@@ -1,6 +1,10 @@
 #include "glcore.hpp"
 
 #include<cstring>
+#include<algorithm>
+#include<iterator>
+#include<mutex>
+#include<vector>
 
 #ifndef GLAPI
 #  if defined(__MINGW32__) || defined(__CYGWIN__) || (_MSC_VER >= 800) || defined(_STDCALL_SUPPORTED) || defined(__BORLANDC__)
@@ -22,6 +26,28 @@ namespace GL
 		throw NullFuncPtrException("OpenGL function pointer is null.\n");
 	}
 
+	// 跳板函数没有上下文参数，只能通过当前线程的当前懒加载上下文知道调用来自哪个驱动。`GetProcAddress` 回答的是当前线程的当前上下文，
+	// 所以只替换与它驱动相同的上下文里仍然指向这个跳板函数的指针，其它上下文留在跳板函数上，等它们在自己的线程上第一次调用时再替换。
+	// 别的线程同时读到的要么是跳板函数，要么是同一个驱动的真正地址，两者都能正确调用
+	static std::mutex LazyContextsLock;
+	static std::vector<Version46*> LazyContexts;
+
+	// 当前线程的当前上下文，跳板函数通过它转发调用
+	static thread_local Version46* LazyContext = nullptr;
+
+	static Version46& ResolveLazy(void (*Resolve)(Version46& c), bool (*IsPending)(const Version46& c))
+	{
+		auto lock = std::scoped_lock(LazyContextsLock);
+
+		// 当前上下文可能已经在别的线程上销毁了
+		if (!LazyContext || std::find(LazyContexts.begin(), LazyContexts.end(), LazyContext) == LazyContexts.end())
+		{
+			throw NullFuncPtrException("A lazily loaded OpenGL function was called on a thread without a live lazily loaded context, call `MakeLazyCurrent()` after making the context current.\n");
+		}
+		for (auto c : LazyContexts) if (IsPending(*c) && c->HasSameDriver(*LazyContext)) Resolve(*c);
+		return *LazyContext;
+	}
+
 	GLAPI void APIENTRY glCullFace (GLenum mode);
 	GLAPI void APIENTRY glFrontFace (GLenum mode);
 	GLAPI void APIENTRY glHint (GLenum target, GLenum mode);
@@ -119,56 +145,151 @@ namespace GL
 	static GLboolean APIENTRY Null_glIsEnabled (GLenum cap){ NullFuncPtr(); return 0; }
 	static void APIENTRY Null_glDepthRange (GLdouble n, GLdouble f){ NullFuncPtr(); }
 	static void APIENTRY Null_glViewport (GLint x, GLint y, GLsizei width, GLsizei height){ NullFuncPtr(); }
-	Version10::Version10(Func_GetProcAddress GetProcAddress):
+	static void Resolve_glCullFace(Version46& c){ c.CullFace = c.GetProc<decltype(c.CullFace)>("glCullFace", Null_glCullFace); }
+	static void Resolve_glFrontFace(Version46& c){ c.FrontFace = c.GetProc<decltype(c.FrontFace)>("glFrontFace", Null_glFrontFace); }
+	static void Resolve_glHint(Version46& c){ c.Hint = c.GetProc<decltype(c.Hint)>("glHint", Null_glHint); }
+	static void Resolve_glLineWidth(Version46& c){ c.LineWidth = c.GetProc<decltype(c.LineWidth)>("glLineWidth", Null_glLineWidth); }
+	static void Resolve_glPointSize(Version46& c){ c.PointSize = c.GetProc<decltype(c.PointSize)>("glPointSize", Null_glPointSize); }
+	static void Resolve_glPolygonMode(Version46& c){ c.PolygonMode = c.GetProc<decltype(c.PolygonMode)>("glPolygonMode", Null_glPolygonMode); }
+	static void Resolve_glScissor(Version46& c){ c.Scissor = c.GetProc<decltype(c.Scissor)>("glScissor", Null_glScissor); }
+	static void Resolve_glTexParameterf(Version46& c){ c.TexParameterf = c.GetProc<decltype(c.TexParameterf)>("glTexParameterf", Null_glTexParameterf); }
+	static void Resolve_glTexParameterfv(Version46& c){ c.TexParameterfv = c.GetProc<decltype(c.TexParameterfv)>("glTexParameterfv", Null_glTexParameterfv); }
+	static void Resolve_glTexParameteri(Version46& c){ c.TexParameteri = c.GetProc<decltype(c.TexParameteri)>("glTexParameteri", Null_glTexParameteri); }
+	static void Resolve_glTexParameteriv(Version46& c){ c.TexParameteriv = c.GetProc<decltype(c.TexParameteriv)>("glTexParameteriv", Null_glTexParameteriv); }
+	static void Resolve_glTexImage1D(Version46& c){ c.TexImage1D = c.GetProc<decltype(c.TexImage1D)>("glTexImage1D", Null_glTexImage1D); }
+	static void Resolve_glTexImage2D(Version46& c){ c.TexImage2D = c.GetProc<decltype(c.TexImage2D)>("glTexImage2D", Null_glTexImage2D); }
+	static void Resolve_glDrawBuffer(Version46& c){ c.DrawBuffer = c.GetProc<decltype(c.DrawBuffer)>("glDrawBuffer", Null_glDrawBuffer); }
+	static void Resolve_glClear(Version46& c){ c.Clear = c.GetProc<decltype(c.Clear)>("glClear", Null_glClear); }
+	static void Resolve_glClearColor(Version46& c){ c.ClearColor = c.GetProc<decltype(c.ClearColor)>("glClearColor", Null_glClearColor); }
+	static void Resolve_glClearStencil(Version46& c){ c.ClearStencil = c.GetProc<decltype(c.ClearStencil)>("glClearStencil", Null_glClearStencil); }
+	static void Resolve_glClearDepth(Version46& c){ c.ClearDepth = c.GetProc<decltype(c.ClearDepth)>("glClearDepth", Null_glClearDepth); }
+	static void Resolve_glStencilMask(Version46& c){ c.StencilMask = c.GetProc<decltype(c.StencilMask)>("glStencilMask", Null_glStencilMask); }
+	static void Resolve_glColorMask(Version46& c){ c.ColorMask = c.GetProc<decltype(c.ColorMask)>("glColorMask", Null_glColorMask); }
+	static void Resolve_glDepthMask(Version46& c){ c.DepthMask = c.GetProc<decltype(c.DepthMask)>("glDepthMask", Null_glDepthMask); }
+	static void Resolve_glDisable(Version46& c){ c.Disable = c.GetProc<decltype(c.Disable)>("glDisable", Null_glDisable); }
+	static void Resolve_glEnable(Version46& c){ c.Enable = c.GetProc<decltype(c.Enable)>("glEnable", Null_glEnable); }
+	static void Resolve_glFinish(Version46& c){ c.Finish = c.GetProc<decltype(c.Finish)>("glFinish", Null_glFinish); }
+	static void Resolve_glFlush(Version46& c){ c.Flush = c.GetProc<decltype(c.Flush)>("glFlush", Null_glFlush); }
+	static void Resolve_glBlendFunc(Version46& c){ c.BlendFunc = c.GetProc<decltype(c.BlendFunc)>("glBlendFunc", Null_glBlendFunc); }
+	static void Resolve_glLogicOp(Version46& c){ c.LogicOp = c.GetProc<decltype(c.LogicOp)>("glLogicOp", Null_glLogicOp); }
+	static void Resolve_glStencilFunc(Version46& c){ c.StencilFunc = c.GetProc<decltype(c.StencilFunc)>("glStencilFunc", Null_glStencilFunc); }
+	static void Resolve_glStencilOp(Version46& c){ c.StencilOp = c.GetProc<decltype(c.StencilOp)>("glStencilOp", Null_glStencilOp); }
+	static void Resolve_glDepthFunc(Version46& c){ c.DepthFunc = c.GetProc<decltype(c.DepthFunc)>("glDepthFunc", Null_glDepthFunc); }
+	static void Resolve_glPixelStoref(Version46& c){ c.PixelStoref = c.GetProc<decltype(c.PixelStoref)>("glPixelStoref", Null_glPixelStoref); }
+	static void Resolve_glPixelStorei(Version46& c){ c.PixelStorei = c.GetProc<decltype(c.PixelStorei)>("glPixelStorei", Null_glPixelStorei); }
+	static void Resolve_glReadBuffer(Version46& c){ c.ReadBuffer = c.GetProc<decltype(c.ReadBuffer)>("glReadBuffer", Null_glReadBuffer); }
+	static void Resolve_glReadPixels(Version46& c){ c.ReadPixels = c.GetProc<decltype(c.ReadPixels)>("glReadPixels", Null_glReadPixels); }
+	static void Resolve_glGetBooleanv(Version46& c){ c.GetBooleanv = c.GetProc<decltype(c.GetBooleanv)>("glGetBooleanv", Null_glGetBooleanv); }
+	static void Resolve_glGetDoublev(Version46& c){ c.GetDoublev = c.GetProc<decltype(c.GetDoublev)>("glGetDoublev", Null_glGetDoublev); }
+	static void Resolve_glGetError(Version46& c){ c.GetError = c.GetProc<decltype(c.GetError)>("glGetError", Null_glGetError); }
+	static void Resolve_glGetFloatv(Version46& c){ c.GetFloatv = c.GetProc<decltype(c.GetFloatv)>("glGetFloatv", Null_glGetFloatv); }
+	static void Resolve_glGetIntegerv(Version46& c){ c.GetIntegerv = c.GetProc<decltype(c.GetIntegerv)>("glGetIntegerv", Null_glGetIntegerv); }
+	static void Resolve_glGetTexImage(Version46& c){ c.GetTexImage = c.GetProc<decltype(c.GetTexImage)>("glGetTexImage", Null_glGetTexImage); }
+	static void Resolve_glGetTexParameterfv(Version46& c){ c.GetTexParameterfv = c.GetProc<decltype(c.GetTexParameterfv)>("glGetTexParameterfv", Null_glGetTexParameterfv); }
+	static void Resolve_glGetTexParameteriv(Version46& c){ c.GetTexParameteriv = c.GetProc<decltype(c.GetTexParameteriv)>("glGetTexParameteriv", Null_glGetTexParameteriv); }
+	static void Resolve_glGetTexLevelParameterfv(Version46& c){ c.GetTexLevelParameterfv = c.GetProc<decltype(c.GetTexLevelParameterfv)>("glGetTexLevelParameterfv", Null_glGetTexLevelParameterfv); }
+	static void Resolve_glGetTexLevelParameteriv(Version46& c){ c.GetTexLevelParameteriv = c.GetProc<decltype(c.GetTexLevelParameteriv)>("glGetTexLevelParameteriv", Null_glGetTexLevelParameteriv); }
+	static void Resolve_glIsEnabled(Version46& c){ c.IsEnabled = c.GetProc<decltype(c.IsEnabled)>("glIsEnabled", Null_glIsEnabled); }
+	static void Resolve_glDepthRange(Version46& c){ c.DepthRange = c.GetProc<decltype(c.DepthRange)>("glDepthRange", Null_glDepthRange); }
+	static void Resolve_glViewport(Version46& c){ c.Viewport = c.GetProc<decltype(c.Viewport)>("glViewport", Null_glViewport); }
+	static void APIENTRY Lazy_glCullFace (GLenum mode){ auto& c = ResolveLazy(Resolve_glCullFace, [](const Version46& c){ return c.CullFace == Lazy_glCullFace; }); return c.CullFace(mode); }
+	static void APIENTRY Lazy_glFrontFace (GLenum mode){ auto& c = ResolveLazy(Resolve_glFrontFace, [](const Version46& c){ return c.FrontFace == Lazy_glFrontFace; }); return c.FrontFace(mode); }
+	static void APIENTRY Lazy_glHint (GLenum target, GLenum mode){ auto& c = ResolveLazy(Resolve_glHint, [](const Version46& c){ return c.Hint == Lazy_glHint; }); return c.Hint(target, mode); }
+	static void APIENTRY Lazy_glLineWidth (GLfloat width){ auto& c = ResolveLazy(Resolve_glLineWidth, [](const Version46& c){ return c.LineWidth == Lazy_glLineWidth; }); return c.LineWidth(width); }
+	static void APIENTRY Lazy_glPointSize (GLfloat size){ auto& c = ResolveLazy(Resolve_glPointSize, [](const Version46& c){ return c.PointSize == Lazy_glPointSize; }); return c.PointSize(size); }
+	static void APIENTRY Lazy_glPolygonMode (GLenum face, GLenum mode){ auto& c = ResolveLazy(Resolve_glPolygonMode, [](const Version46& c){ return c.PolygonMode == Lazy_glPolygonMode; }); return c.PolygonMode(face, mode); }
+	static void APIENTRY Lazy_glScissor (GLint x, GLint y, GLsizei width, GLsizei height){ auto& c = ResolveLazy(Resolve_glScissor, [](const Version46& c){ return c.Scissor == Lazy_glScissor; }); return c.Scissor(x, y, width, height); }
+	static void APIENTRY Lazy_glTexParameterf (GLenum target, GLenum pname, GLfloat param){ auto& c = ResolveLazy(Resolve_glTexParameterf, [](const Version46& c){ return c.TexParameterf == Lazy_glTexParameterf; }); return c.TexParameterf(target, pname, param); }
+	static void APIENTRY Lazy_glTexParameterfv (GLenum target, GLenum pname, const GLfloat* params){ auto& c = ResolveLazy(Resolve_glTexParameterfv, [](const Version46& c){ return c.TexParameterfv == Lazy_glTexParameterfv; }); return c.TexParameterfv(target, pname, params); }
+	static void APIENTRY Lazy_glTexParameteri (GLenum target, GLenum pname, GLint param){ auto& c = ResolveLazy(Resolve_glTexParameteri, [](const Version46& c){ return c.TexParameteri == Lazy_glTexParameteri; }); return c.TexParameteri(target, pname, param); }
+	static void APIENTRY Lazy_glTexParameteriv (GLenum target, GLenum pname, const GLint* params){ auto& c = ResolveLazy(Resolve_glTexParameteriv, [](const Version46& c){ return c.TexParameteriv == Lazy_glTexParameteriv; }); return c.TexParameteriv(target, pname, params); }
+	static void APIENTRY Lazy_glTexImage1D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void* pixels){ auto& c = ResolveLazy(Resolve_glTexImage1D, [](const Version46& c){ return c.TexImage1D == Lazy_glTexImage1D; }); return c.TexImage1D(target, level, internalformat, width, border, format, type, pixels); }
+	static void APIENTRY Lazy_glTexImage2D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels){ auto& c = ResolveLazy(Resolve_glTexImage2D, [](const Version46& c){ return c.TexImage2D == Lazy_glTexImage2D; }); return c.TexImage2D(target, level, internalformat, width, height, border, format, type, pixels); }
+	static void APIENTRY Lazy_glDrawBuffer (GLenum buf){ auto& c = ResolveLazy(Resolve_glDrawBuffer, [](const Version46& c){ return c.DrawBuffer == Lazy_glDrawBuffer; }); return c.DrawBuffer(buf); }
+	static void APIENTRY Lazy_glClear (GLbitfield mask){ auto& c = ResolveLazy(Resolve_glClear, [](const Version46& c){ return c.Clear == Lazy_glClear; }); return c.Clear(mask); }
+	static void APIENTRY Lazy_glClearColor (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha){ auto& c = ResolveLazy(Resolve_glClearColor, [](const Version46& c){ return c.ClearColor == Lazy_glClearColor; }); return c.ClearColor(red, green, blue, alpha); }
+	static void APIENTRY Lazy_glClearStencil (GLint s){ auto& c = ResolveLazy(Resolve_glClearStencil, [](const Version46& c){ return c.ClearStencil == Lazy_glClearStencil; }); return c.ClearStencil(s); }
+	static void APIENTRY Lazy_glClearDepth (GLdouble depth){ auto& c = ResolveLazy(Resolve_glClearDepth, [](const Version46& c){ return c.ClearDepth == Lazy_glClearDepth; }); return c.ClearDepth(depth); }
+	static void APIENTRY Lazy_glStencilMask (GLuint mask){ auto& c = ResolveLazy(Resolve_glStencilMask, [](const Version46& c){ return c.StencilMask == Lazy_glStencilMask; }); return c.StencilMask(mask); }
+	static void APIENTRY Lazy_glColorMask (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha){ auto& c = ResolveLazy(Resolve_glColorMask, [](const Version46& c){ return c.ColorMask == Lazy_glColorMask; }); return c.ColorMask(red, green, blue, alpha); }
+	static void APIENTRY Lazy_glDepthMask (GLboolean flag){ auto& c = ResolveLazy(Resolve_glDepthMask, [](const Version46& c){ return c.DepthMask == Lazy_glDepthMask; }); return c.DepthMask(flag); }
+	static void APIENTRY Lazy_glDisable (GLenum cap){ auto& c = ResolveLazy(Resolve_glDisable, [](const Version46& c){ return c.Disable == Lazy_glDisable; }); return c.Disable(cap); }
+	static void APIENTRY Lazy_glEnable (GLenum cap){ auto& c = ResolveLazy(Resolve_glEnable, [](const Version46& c){ return c.Enable == Lazy_glEnable; }); return c.Enable(cap); }
+	static void APIENTRY Lazy_glFinish (void){ auto& c = ResolveLazy(Resolve_glFinish, [](const Version46& c){ return c.Finish == Lazy_glFinish; }); return c.Finish(); }
+	static void APIENTRY Lazy_glFlush (void){ auto& c = ResolveLazy(Resolve_glFlush, [](const Version46& c){ return c.Flush == Lazy_glFlush; }); return c.Flush(); }
+	static void APIENTRY Lazy_glBlendFunc (GLenum sfactor, GLenum dfactor){ auto& c = ResolveLazy(Resolve_glBlendFunc, [](const Version46& c){ return c.BlendFunc == Lazy_glBlendFunc; }); return c.BlendFunc(sfactor, dfactor); }
+	static void APIENTRY Lazy_glLogicOp (GLenum opcode){ auto& c = ResolveLazy(Resolve_glLogicOp, [](const Version46& c){ return c.LogicOp == Lazy_glLogicOp; }); return c.LogicOp(opcode); }
+	static void APIENTRY Lazy_glStencilFunc (GLenum func, GLint ref, GLuint mask){ auto& c = ResolveLazy(Resolve_glStencilFunc, [](const Version46& c){ return c.StencilFunc == Lazy_glStencilFunc; }); return c.StencilFunc(func, ref, mask); }
+	static void APIENTRY Lazy_glStencilOp (GLenum fail, GLenum zfail, GLenum zpass){ auto& c = ResolveLazy(Resolve_glStencilOp, [](const Version46& c){ return c.StencilOp == Lazy_glStencilOp; }); return c.StencilOp(fail, zfail, zpass); }
+	static void APIENTRY Lazy_glDepthFunc (GLenum func){ auto& c = ResolveLazy(Resolve_glDepthFunc, [](const Version46& c){ return c.DepthFunc == Lazy_glDepthFunc; }); return c.DepthFunc(func); }
+	static void APIENTRY Lazy_glPixelStoref (GLenum pname, GLfloat param){ auto& c = ResolveLazy(Resolve_glPixelStoref, [](const Version46& c){ return c.PixelStoref == Lazy_glPixelStoref; }); return c.PixelStoref(pname, param); }
+	static void APIENTRY Lazy_glPixelStorei (GLenum pname, GLint param){ auto& c = ResolveLazy(Resolve_glPixelStorei, [](const Version46& c){ return c.PixelStorei == Lazy_glPixelStorei; }); return c.PixelStorei(pname, param); }
+	static void APIENTRY Lazy_glReadBuffer (GLenum src){ auto& c = ResolveLazy(Resolve_glReadBuffer, [](const Version46& c){ return c.ReadBuffer == Lazy_glReadBuffer; }); return c.ReadBuffer(src); }
+	static void APIENTRY Lazy_glReadPixels (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void* pixels){ auto& c = ResolveLazy(Resolve_glReadPixels, [](const Version46& c){ return c.ReadPixels == Lazy_glReadPixels; }); return c.ReadPixels(x, y, width, height, format, type, pixels); }
+	static void APIENTRY Lazy_glGetBooleanv (GLenum pname, GLboolean* data){ auto& c = ResolveLazy(Resolve_glGetBooleanv, [](const Version46& c){ return c.GetBooleanv == Lazy_glGetBooleanv; }); return c.GetBooleanv(pname, data); }
+	static void APIENTRY Lazy_glGetDoublev (GLenum pname, GLdouble* data){ auto& c = ResolveLazy(Resolve_glGetDoublev, [](const Version46& c){ return c.GetDoublev == Lazy_glGetDoublev; }); return c.GetDoublev(pname, data); }
+	static GLenum APIENTRY Lazy_glGetError (void){ auto& c = ResolveLazy(Resolve_glGetError, [](const Version46& c){ return c.GetError == Lazy_glGetError; }); return c.GetError(); }
+	static void APIENTRY Lazy_glGetFloatv (GLenum pname, GLfloat* data){ auto& c = ResolveLazy(Resolve_glGetFloatv, [](const Version46& c){ return c.GetFloatv == Lazy_glGetFloatv; }); return c.GetFloatv(pname, data); }
+	static void APIENTRY Lazy_glGetIntegerv (GLenum pname, GLint* data){ auto& c = ResolveLazy(Resolve_glGetIntegerv, [](const Version46& c){ return c.GetIntegerv == Lazy_glGetIntegerv; }); return c.GetIntegerv(pname, data); }
+	static void APIENTRY Lazy_glGetTexImage (GLenum target, GLint level, GLenum format, GLenum type, void* pixels){ auto& c = ResolveLazy(Resolve_glGetTexImage, [](const Version46& c){ return c.GetTexImage == Lazy_glGetTexImage; }); return c.GetTexImage(target, level, format, type, pixels); }
+	static void APIENTRY Lazy_glGetTexParameterfv (GLenum target, GLenum pname, GLfloat* params){ auto& c = ResolveLazy(Resolve_glGetTexParameterfv, [](const Version46& c){ return c.GetTexParameterfv == Lazy_glGetTexParameterfv; }); return c.GetTexParameterfv(target, pname, params); }
+	static void APIENTRY Lazy_glGetTexParameteriv (GLenum target, GLenum pname, GLint* params){ auto& c = ResolveLazy(Resolve_glGetTexParameteriv, [](const Version46& c){ return c.GetTexParameteriv == Lazy_glGetTexParameteriv; }); return c.GetTexParameteriv(target, pname, params); }
+	static void APIENTRY Lazy_glGetTexLevelParameterfv (GLenum target, GLint level, GLenum pname, GLfloat* params){ auto& c = ResolveLazy(Resolve_glGetTexLevelParameterfv, [](const Version46& c){ return c.GetTexLevelParameterfv == Lazy_glGetTexLevelParameterfv; }); return c.GetTexLevelParameterfv(target, level, pname, params); }
+	static void APIENTRY Lazy_glGetTexLevelParameteriv (GLenum target, GLint level, GLenum pname, GLint* params){ auto& c = ResolveLazy(Resolve_glGetTexLevelParameteriv, [](const Version46& c){ return c.GetTexLevelParameteriv == Lazy_glGetTexLevelParameteriv; }); return c.GetTexLevelParameteriv(target, level, pname, params); }
+	static GLboolean APIENTRY Lazy_glIsEnabled (GLenum cap){ auto& c = ResolveLazy(Resolve_glIsEnabled, [](const Version46& c){ return c.IsEnabled == Lazy_glIsEnabled; }); return c.IsEnabled(cap); }
+	static void APIENTRY Lazy_glDepthRange (GLdouble n, GLdouble f){ auto& c = ResolveLazy(Resolve_glDepthRange, [](const Version46& c){ return c.DepthRange == Lazy_glDepthRange; }); return c.DepthRange(n, f); }
+	static void APIENTRY Lazy_glViewport (GLint x, GLint y, GLsizei width, GLsizei height){ auto& c = ResolveLazy(Resolve_glViewport, [](const Version46& c){ return c.Viewport == Lazy_glViewport; }); return c.Viewport(x, y, width, height); }
+	Version10::Version10(Func_GetProcAddress GetProcAddress, LoadMode Mode):
 		GetProcAddress(GetProcAddress),
-		CullFace(GetProc<PFNGLCULLFACEPROC>("glCullFace", Null_glCullFace)),
-		FrontFace(GetProc<PFNGLFRONTFACEPROC>("glFrontFace", Null_glFrontFace)),
-		Hint(GetProc<PFNGLHINTPROC>("glHint", Null_glHint)),
-		LineWidth(GetProc<PFNGLLINEWIDTHPROC>("glLineWidth", Null_glLineWidth)),
-		PointSize(GetProc<PFNGLPOINTSIZEPROC>("glPointSize", Null_glPointSize)),
-		PolygonMode(GetProc<PFNGLPOLYGONMODEPROC>("glPolygonMode", Null_glPolygonMode)),
-		Scissor(GetProc<PFNGLSCISSORPROC>("glScissor", Null_glScissor)),
-		TexParameterf(GetProc<PFNGLTEXPARAMETERFPROC>("glTexParameterf", Null_glTexParameterf)),
-		TexParameterfv(GetProc<PFNGLTEXPARAMETERFVPROC>("glTexParameterfv", Null_glTexParameterfv)),
-		TexParameteri(GetProc<PFNGLTEXPARAMETERIPROC>("glTexParameteri", Null_glTexParameteri)),
-		TexParameteriv(GetProc<PFNGLTEXPARAMETERIVPROC>("glTexParameteriv", Null_glTexParameteriv)),
-		TexImage1D(GetProc<PFNGLTEXIMAGE1DPROC>("glTexImage1D", Null_glTexImage1D)),
-		TexImage2D(GetProc<PFNGLTEXIMAGE2DPROC>("glTexImage2D", Null_glTexImage2D)),
-		DrawBuffer(GetProc<PFNGLDRAWBUFFERPROC>("glDrawBuffer", Null_glDrawBuffer)),
-		Clear(GetProc<PFNGLCLEARPROC>("glClear", Null_glClear)),
-		ClearColor(GetProc<PFNGLCLEARCOLORPROC>("glClearColor", Null_glClearColor)),
-		ClearStencil(GetProc<PFNGLCLEARSTENCILPROC>("glClearStencil", Null_glClearStencil)),
-		ClearDepth(GetProc<PFNGLCLEARDEPTHPROC>("glClearDepth", Null_glClearDepth)),
-		StencilMask(GetProc<PFNGLSTENCILMASKPROC>("glStencilMask", Null_glStencilMask)),
-		ColorMask(GetProc<PFNGLCOLORMASKPROC>("glColorMask", Null_glColorMask)),
-		DepthMask(GetProc<PFNGLDEPTHMASKPROC>("glDepthMask", Null_glDepthMask)),
-		Disable(GetProc<PFNGLDISABLEPROC>("glDisable", Null_glDisable)),
-		Enable(GetProc<PFNGLENABLEPROC>("glEnable", Null_glEnable)),
-		Finish(GetProc<PFNGLFINISHPROC>("glFinish", Null_glFinish)),
-		Flush(GetProc<PFNGLFLUSHPROC>("glFlush", Null_glFlush)),
-		BlendFunc(GetProc<PFNGLBLENDFUNCPROC>("glBlendFunc", Null_glBlendFunc)),
-		LogicOp(GetProc<PFNGLLOGICOPPROC>("glLogicOp", Null_glLogicOp)),
-		StencilFunc(GetProc<PFNGLSTENCILFUNCPROC>("glStencilFunc", Null_glStencilFunc)),
-		StencilOp(GetProc<PFNGLSTENCILOPPROC>("glStencilOp", Null_glStencilOp)),
-		DepthFunc(GetProc<PFNGLDEPTHFUNCPROC>("glDepthFunc", Null_glDepthFunc)),
-		PixelStoref(GetProc<PFNGLPIXELSTOREFPROC>("glPixelStoref", Null_glPixelStoref)),
-		PixelStorei(GetProc<PFNGLPIXELSTOREIPROC>("glPixelStorei", Null_glPixelStorei)),
-		ReadBuffer(GetProc<PFNGLREADBUFFERPROC>("glReadBuffer", Null_glReadBuffer)),
-		ReadPixels(GetProc<PFNGLREADPIXELSPROC>("glReadPixels", Null_glReadPixels)),
-		GetBooleanv(GetProc<PFNGLGETBOOLEANVPROC>("glGetBooleanv", Null_glGetBooleanv)),
-		GetDoublev(GetProc<PFNGLGETDOUBLEVPROC>("glGetDoublev", Null_glGetDoublev)),
-		GetError(GetProc<PFNGLGETERRORPROC>("glGetError", Null_glGetError)),
-		GetFloatv(GetProc<PFNGLGETFLOATVPROC>("glGetFloatv", Null_glGetFloatv)),
-		GetIntegerv(GetProc<PFNGLGETINTEGERVPROC>("glGetIntegerv", Null_glGetIntegerv)),
+		Mode(Mode),
+		CullFace(GetProc<PFNGLCULLFACEPROC>("glCullFace", Null_glCullFace, Lazy_glCullFace)),
+		FrontFace(GetProc<PFNGLFRONTFACEPROC>("glFrontFace", Null_glFrontFace, Lazy_glFrontFace)),
+		Hint(GetProc<PFNGLHINTPROC>("glHint", Null_glHint, Lazy_glHint)),
+		LineWidth(GetProc<PFNGLLINEWIDTHPROC>("glLineWidth", Null_glLineWidth, Lazy_glLineWidth)),
+		PointSize(GetProc<PFNGLPOINTSIZEPROC>("glPointSize", Null_glPointSize, Lazy_glPointSize)),
+		PolygonMode(GetProc<PFNGLPOLYGONMODEPROC>("glPolygonMode", Null_glPolygonMode, Lazy_glPolygonMode)),
+		Scissor(GetProc<PFNGLSCISSORPROC>("glScissor", Null_glScissor, Lazy_glScissor)),
+		TexParameterf(GetProc<PFNGLTEXPARAMETERFPROC>("glTexParameterf", Null_glTexParameterf, Lazy_glTexParameterf)),
+		TexParameterfv(GetProc<PFNGLTEXPARAMETERFVPROC>("glTexParameterfv", Null_glTexParameterfv, Lazy_glTexParameterfv)),
+		TexParameteri(GetProc<PFNGLTEXPARAMETERIPROC>("glTexParameteri", Null_glTexParameteri, Lazy_glTexParameteri)),
+		TexParameteriv(GetProc<PFNGLTEXPARAMETERIVPROC>("glTexParameteriv", Null_glTexParameteriv, Lazy_glTexParameteriv)),
+		TexImage1D(GetProc<PFNGLTEXIMAGE1DPROC>("glTexImage1D", Null_glTexImage1D, Lazy_glTexImage1D)),
+		TexImage2D(GetProc<PFNGLTEXIMAGE2DPROC>("glTexImage2D", Null_glTexImage2D, Lazy_glTexImage2D)),
+		DrawBuffer(GetProc<PFNGLDRAWBUFFERPROC>("glDrawBuffer", Null_glDrawBuffer, Lazy_glDrawBuffer)),
+		Clear(GetProc<PFNGLCLEARPROC>("glClear", Null_glClear, Lazy_glClear)),
+		ClearColor(GetProc<PFNGLCLEARCOLORPROC>("glClearColor", Null_glClearColor, Lazy_glClearColor)),
+		ClearStencil(GetProc<PFNGLCLEARSTENCILPROC>("glClearStencil", Null_glClearStencil, Lazy_glClearStencil)),
+		ClearDepth(GetProc<PFNGLCLEARDEPTHPROC>("glClearDepth", Null_glClearDepth, Lazy_glClearDepth)),
+		StencilMask(GetProc<PFNGLSTENCILMASKPROC>("glStencilMask", Null_glStencilMask, Lazy_glStencilMask)),
+		ColorMask(GetProc<PFNGLCOLORMASKPROC>("glColorMask", Null_glColorMask, Lazy_glColorMask)),
+		DepthMask(GetProc<PFNGLDEPTHMASKPROC>("glDepthMask", Null_glDepthMask, Lazy_glDepthMask)),
+		Disable(GetProc<PFNGLDISABLEPROC>("glDisable", Null_glDisable, Lazy_glDisable)),
+		Enable(GetProc<PFNGLENABLEPROC>("glEnable", Null_glEnable, Lazy_glEnable)),
+		Finish(GetProc<PFNGLFINISHPROC>("glFinish", Null_glFinish, Lazy_glFinish)),
+		Flush(GetProc<PFNGLFLUSHPROC>("glFlush", Null_glFlush, Lazy_glFlush)),
+		BlendFunc(GetProc<PFNGLBLENDFUNCPROC>("glBlendFunc", Null_glBlendFunc, Lazy_glBlendFunc)),
+		LogicOp(GetProc<PFNGLLOGICOPPROC>("glLogicOp", Null_glLogicOp, Lazy_glLogicOp)),
+		StencilFunc(GetProc<PFNGLSTENCILFUNCPROC>("glStencilFunc", Null_glStencilFunc, Lazy_glStencilFunc)),
+		StencilOp(GetProc<PFNGLSTENCILOPPROC>("glStencilOp", Null_glStencilOp, Lazy_glStencilOp)),
+		DepthFunc(GetProc<PFNGLDEPTHFUNCPROC>("glDepthFunc", Null_glDepthFunc, Lazy_glDepthFunc)),
+		PixelStoref(GetProc<PFNGLPIXELSTOREFPROC>("glPixelStoref", Null_glPixelStoref, Lazy_glPixelStoref)),
+		PixelStorei(GetProc<PFNGLPIXELSTOREIPROC>("glPixelStorei", Null_glPixelStorei, Lazy_glPixelStorei)),
+		ReadBuffer(GetProc<PFNGLREADBUFFERPROC>("glReadBuffer", Null_glReadBuffer, Lazy_glReadBuffer)),
+		ReadPixels(GetProc<PFNGLREADPIXELSPROC>("glReadPixels", Null_glReadPixels, Lazy_glReadPixels)),
+		GetBooleanv(GetProc<PFNGLGETBOOLEANVPROC>("glGetBooleanv", Null_glGetBooleanv, Lazy_glGetBooleanv)),
+		GetDoublev(GetProc<PFNGLGETDOUBLEVPROC>("glGetDoublev", Null_glGetDoublev, Lazy_glGetDoublev)),
+		GetError(GetProc<PFNGLGETERRORPROC>("glGetError", Null_glGetError, Lazy_glGetError)),
+		GetFloatv(GetProc<PFNGLGETFLOATVPROC>("glGetFloatv", Null_glGetFloatv, Lazy_glGetFloatv)),
+		GetIntegerv(GetProc<PFNGLGETINTEGERVPROC>("glGetIntegerv", Null_glGetIntegerv, Lazy_glGetIntegerv)),
 		GetString(GetProc<PFNGLGETSTRINGPROC>("glGetString", Null_glGetString)),
-		GetTexImage(GetProc<PFNGLGETTEXIMAGEPROC>("glGetTexImage", Null_glGetTexImage)),
-		GetTexParameterfv(GetProc<PFNGLGETTEXPARAMETERFVPROC>("glGetTexParameterfv", Null_glGetTexParameterfv)),
-		GetTexParameteriv(GetProc<PFNGLGETTEXPARAMETERIVPROC>("glGetTexParameteriv", Null_glGetTexParameteriv)),
-		GetTexLevelParameterfv(GetProc<PFNGLGETTEXLEVELPARAMETERFVPROC>("glGetTexLevelParameterfv", Null_glGetTexLevelParameterfv)),
-		GetTexLevelParameteriv(GetProc<PFNGLGETTEXLEVELPARAMETERIVPROC>("glGetTexLevelParameteriv", Null_glGetTexLevelParameteriv)),
-		IsEnabled(GetProc<PFNGLISENABLEDPROC>("glIsEnabled", Null_glIsEnabled)),
-		DepthRange(GetProc<PFNGLDEPTHRANGEPROC>("glDepthRange", Null_glDepthRange)),
-		Viewport(GetProc<PFNGLVIEWPORTPROC>("glViewport", Null_glViewport)),
+		GetTexImage(GetProc<PFNGLGETTEXIMAGEPROC>("glGetTexImage", Null_glGetTexImage, Lazy_glGetTexImage)),
+		GetTexParameterfv(GetProc<PFNGLGETTEXPARAMETERFVPROC>("glGetTexParameterfv", Null_glGetTexParameterfv, Lazy_glGetTexParameterfv)),
+		GetTexParameteriv(GetProc<PFNGLGETTEXPARAMETERIVPROC>("glGetTexParameteriv", Null_glGetTexParameteriv, Lazy_glGetTexParameteriv)),
+		GetTexLevelParameterfv(GetProc<PFNGLGETTEXLEVELPARAMETERFVPROC>("glGetTexLevelParameterfv", Null_glGetTexLevelParameterfv, Lazy_glGetTexLevelParameterfv)),
+		GetTexLevelParameteriv(GetProc<PFNGLGETTEXLEVELPARAMETERIVPROC>("glGetTexLevelParameteriv", Null_glGetTexLevelParameteriv, Lazy_glGetTexLevelParameteriv)),
+		IsEnabled(GetProc<PFNGLISENABLEDPROC>("glIsEnabled", Null_glIsEnabled, Lazy_glIsEnabled)),
+		DepthRange(GetProc<PFNGLDEPTHRANGEPROC>("glDepthRange", Null_glDepthRange, Lazy_glDepthRange)),
+		Viewport(GetProc<PFNGLVIEWPORTPROC>("glViewport", Null_glViewport, Lazy_glViewport)),
 		Ver_Major(0),
 		Ver_Minor(0),
 		Ver_Release(0)
@@ -198,6 +319,11 @@ namespace GL
 		}
 	}
 
+	Version10::Version10(Func_GetProcAddress GetProcAddress):
+		Version10(GetProcAddress, LoadMode::Eager)
+	{
+	}
+
 
 	static void APIENTRY Null_glDrawArrays (GLenum mode, GLint first, GLsizei count){ NullFuncPtr(); }
 	static void APIENTRY Null_glDrawElements (GLenum mode, GLsizei count, GLenum type, const void* indices){ NullFuncPtr(); }
@@ -213,41 +339,87 @@ namespace GL
 	static void APIENTRY Null_glDeleteTextures (GLsizei n, const GLuint* textures){ NullFuncPtr(); }
 	static void APIENTRY Null_glGenTextures (GLsizei n, GLuint* textures){ NullFuncPtr(); }
 	static GLboolean APIENTRY Null_glIsTexture (GLuint texture){ NullFuncPtr(); return 0; }
-	Version11::Version11(Func_GetProcAddress GetProcAddress):
-		Version10(GetProcAddress),
-		DrawArrays(GetProc<PFNGLDRAWARRAYSPROC>("glDrawArrays", Null_glDrawArrays)),
-		DrawElements(GetProc<PFNGLDRAWELEMENTSPROC>("glDrawElements", Null_glDrawElements)),
-		GetPointerv(GetProc<PFNGLGETPOINTERVPROC>("glGetPointerv", Null_glGetPointerv)),
-		PolygonOffset(GetProc<PFNGLPOLYGONOFFSETPROC>("glPolygonOffset", Null_glPolygonOffset)),
-		CopyTexImage1D(GetProc<PFNGLCOPYTEXIMAGE1DPROC>("glCopyTexImage1D", Null_glCopyTexImage1D)),
-		CopyTexImage2D(GetProc<PFNGLCOPYTEXIMAGE2DPROC>("glCopyTexImage2D", Null_glCopyTexImage2D)),
-		CopyTexSubImage1D(GetProc<PFNGLCOPYTEXSUBIMAGE1DPROC>("glCopyTexSubImage1D", Null_glCopyTexSubImage1D)),
-		CopyTexSubImage2D(GetProc<PFNGLCOPYTEXSUBIMAGE2DPROC>("glCopyTexSubImage2D", Null_glCopyTexSubImage2D)),
-		TexSubImage1D(GetProc<PFNGLTEXSUBIMAGE1DPROC>("glTexSubImage1D", Null_glTexSubImage1D)),
-		TexSubImage2D(GetProc<PFNGLTEXSUBIMAGE2DPROC>("glTexSubImage2D", Null_glTexSubImage2D)),
-		BindTexture(GetProc<PFNGLBINDTEXTUREPROC>("glBindTexture", Null_glBindTexture)),
-		DeleteTextures(GetProc<PFNGLDELETETEXTURESPROC>("glDeleteTextures", Null_glDeleteTextures)),
-		GenTextures(GetProc<PFNGLGENTEXTURESPROC>("glGenTextures", Null_glGenTextures)),
-		IsTexture(GetProc<PFNGLISTEXTUREPROC>("glIsTexture", Null_glIsTexture))
+	static void Resolve_glDrawArrays(Version46& c){ c.DrawArrays = c.GetProc<decltype(c.DrawArrays)>("glDrawArrays", Null_glDrawArrays); }
+	static void Resolve_glDrawElements(Version46& c){ c.DrawElements = c.GetProc<decltype(c.DrawElements)>("glDrawElements", Null_glDrawElements); }
+	static void Resolve_glGetPointerv(Version46& c){ c.GetPointerv = c.GetProc<decltype(c.GetPointerv)>("glGetPointerv", Null_glGetPointerv); }
+	static void Resolve_glPolygonOffset(Version46& c){ c.PolygonOffset = c.GetProc<decltype(c.PolygonOffset)>("glPolygonOffset", Null_glPolygonOffset); }
+	static void Resolve_glCopyTexImage1D(Version46& c){ c.CopyTexImage1D = c.GetProc<decltype(c.CopyTexImage1D)>("glCopyTexImage1D", Null_glCopyTexImage1D); }
+	static void Resolve_glCopyTexImage2D(Version46& c){ c.CopyTexImage2D = c.GetProc<decltype(c.CopyTexImage2D)>("glCopyTexImage2D", Null_glCopyTexImage2D); }
+	static void Resolve_glCopyTexSubImage1D(Version46& c){ c.CopyTexSubImage1D = c.GetProc<decltype(c.CopyTexSubImage1D)>("glCopyTexSubImage1D", Null_glCopyTexSubImage1D); }
+	static void Resolve_glCopyTexSubImage2D(Version46& c){ c.CopyTexSubImage2D = c.GetProc<decltype(c.CopyTexSubImage2D)>("glCopyTexSubImage2D", Null_glCopyTexSubImage2D); }
+	static void Resolve_glTexSubImage1D(Version46& c){ c.TexSubImage1D = c.GetProc<decltype(c.TexSubImage1D)>("glTexSubImage1D", Null_glTexSubImage1D); }
+	static void Resolve_glTexSubImage2D(Version46& c){ c.TexSubImage2D = c.GetProc<decltype(c.TexSubImage2D)>("glTexSubImage2D", Null_glTexSubImage2D); }
+	static void Resolve_glBindTexture(Version46& c){ c.BindTexture = c.GetProc<decltype(c.BindTexture)>("glBindTexture", Null_glBindTexture); }
+	static void Resolve_glDeleteTextures(Version46& c){ c.DeleteTextures = c.GetProc<decltype(c.DeleteTextures)>("glDeleteTextures", Null_glDeleteTextures); }
+	static void Resolve_glGenTextures(Version46& c){ c.GenTextures = c.GetProc<decltype(c.GenTextures)>("glGenTextures", Null_glGenTextures); }
+	static void Resolve_glIsTexture(Version46& c){ c.IsTexture = c.GetProc<decltype(c.IsTexture)>("glIsTexture", Null_glIsTexture); }
+	static void APIENTRY Lazy_glDrawArrays (GLenum mode, GLint first, GLsizei count){ auto& c = ResolveLazy(Resolve_glDrawArrays, [](const Version46& c){ return c.DrawArrays == Lazy_glDrawArrays; }); return c.DrawArrays(mode, first, count); }
+	static void APIENTRY Lazy_glDrawElements (GLenum mode, GLsizei count, GLenum type, const void* indices){ auto& c = ResolveLazy(Resolve_glDrawElements, [](const Version46& c){ return c.DrawElements == Lazy_glDrawElements; }); return c.DrawElements(mode, count, type, indices); }
+	static void APIENTRY Lazy_glGetPointerv (GLenum pname, void** params){ auto& c = ResolveLazy(Resolve_glGetPointerv, [](const Version46& c){ return c.GetPointerv == Lazy_glGetPointerv; }); return c.GetPointerv(pname, params); }
+	static void APIENTRY Lazy_glPolygonOffset (GLfloat factor, GLfloat units){ auto& c = ResolveLazy(Resolve_glPolygonOffset, [](const Version46& c){ return c.PolygonOffset == Lazy_glPolygonOffset; }); return c.PolygonOffset(factor, units); }
+	static void APIENTRY Lazy_glCopyTexImage1D (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border){ auto& c = ResolveLazy(Resolve_glCopyTexImage1D, [](const Version46& c){ return c.CopyTexImage1D == Lazy_glCopyTexImage1D; }); return c.CopyTexImage1D(target, level, internalformat, x, y, width, border); }
+	static void APIENTRY Lazy_glCopyTexImage2D (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border){ auto& c = ResolveLazy(Resolve_glCopyTexImage2D, [](const Version46& c){ return c.CopyTexImage2D == Lazy_glCopyTexImage2D; }); return c.CopyTexImage2D(target, level, internalformat, x, y, width, height, border); }
+	static void APIENTRY Lazy_glCopyTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width){ auto& c = ResolveLazy(Resolve_glCopyTexSubImage1D, [](const Version46& c){ return c.CopyTexSubImage1D == Lazy_glCopyTexSubImage1D; }); return c.CopyTexSubImage1D(target, level, xoffset, x, y, width); }
+	static void APIENTRY Lazy_glCopyTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height){ auto& c = ResolveLazy(Resolve_glCopyTexSubImage2D, [](const Version46& c){ return c.CopyTexSubImage2D == Lazy_glCopyTexSubImage2D; }); return c.CopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height); }
+	static void APIENTRY Lazy_glTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void* pixels){ auto& c = ResolveLazy(Resolve_glTexSubImage1D, [](const Version46& c){ return c.TexSubImage1D == Lazy_glTexSubImage1D; }); return c.TexSubImage1D(target, level, xoffset, width, format, type, pixels); }
+	static void APIENTRY Lazy_glTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels){ auto& c = ResolveLazy(Resolve_glTexSubImage2D, [](const Version46& c){ return c.TexSubImage2D == Lazy_glTexSubImage2D; }); return c.TexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels); }
+	static void APIENTRY Lazy_glBindTexture (GLenum target, GLuint texture){ auto& c = ResolveLazy(Resolve_glBindTexture, [](const Version46& c){ return c.BindTexture == Lazy_glBindTexture; }); return c.BindTexture(target, texture); }
+	static void APIENTRY Lazy_glDeleteTextures (GLsizei n, const GLuint* textures){ auto& c = ResolveLazy(Resolve_glDeleteTextures, [](const Version46& c){ return c.DeleteTextures == Lazy_glDeleteTextures; }); return c.DeleteTextures(n, textures); }
+	static void APIENTRY Lazy_glGenTextures (GLsizei n, GLuint* textures){ auto& c = ResolveLazy(Resolve_glGenTextures, [](const Version46& c){ return c.GenTextures == Lazy_glGenTextures; }); return c.GenTextures(n, textures); }
+	static GLboolean APIENTRY Lazy_glIsTexture (GLuint texture){ auto& c = ResolveLazy(Resolve_glIsTexture, [](const Version46& c){ return c.IsTexture == Lazy_glIsTexture; }); return c.IsTexture(texture); }
+	Version11::Version11(Func_GetProcAddress GetProcAddress, LoadMode Mode):
+		Version10(GetProcAddress, Mode),
+		DrawArrays(GetProc<PFNGLDRAWARRAYSPROC>("glDrawArrays", Null_glDrawArrays, Lazy_glDrawArrays)),
+		DrawElements(GetProc<PFNGLDRAWELEMENTSPROC>("glDrawElements", Null_glDrawElements, Lazy_glDrawElements)),
+		GetPointerv(GetProc<PFNGLGETPOINTERVPROC>("glGetPointerv", Null_glGetPointerv, Lazy_glGetPointerv)),
+		PolygonOffset(GetProc<PFNGLPOLYGONOFFSETPROC>("glPolygonOffset", Null_glPolygonOffset, Lazy_glPolygonOffset)),
+		CopyTexImage1D(GetProc<PFNGLCOPYTEXIMAGE1DPROC>("glCopyTexImage1D", Null_glCopyTexImage1D, Lazy_glCopyTexImage1D)),
+		CopyTexImage2D(GetProc<PFNGLCOPYTEXIMAGE2DPROC>("glCopyTexImage2D", Null_glCopyTexImage2D, Lazy_glCopyTexImage2D)),
+		CopyTexSubImage1D(GetProc<PFNGLCOPYTEXSUBIMAGE1DPROC>("glCopyTexSubImage1D", Null_glCopyTexSubImage1D, Lazy_glCopyTexSubImage1D)),
+		CopyTexSubImage2D(GetProc<PFNGLCOPYTEXSUBIMAGE2DPROC>("glCopyTexSubImage2D", Null_glCopyTexSubImage2D, Lazy_glCopyTexSubImage2D)),
+		TexSubImage1D(GetProc<PFNGLTEXSUBIMAGE1DPROC>("glTexSubImage1D", Null_glTexSubImage1D, Lazy_glTexSubImage1D)),
+		TexSubImage2D(GetProc<PFNGLTEXSUBIMAGE2DPROC>("glTexSubImage2D", Null_glTexSubImage2D, Lazy_glTexSubImage2D)),
+		BindTexture(GetProc<PFNGLBINDTEXTUREPROC>("glBindTexture", Null_glBindTexture, Lazy_glBindTexture)),
+		DeleteTextures(GetProc<PFNGLDELETETEXTURESPROC>("glDeleteTextures", Null_glDeleteTextures, Lazy_glDeleteTextures)),
+		GenTextures(GetProc<PFNGLGENTEXTURESPROC>("glGenTextures", Null_glGenTextures, Lazy_glGenTextures)),
+		IsTexture(GetProc<PFNGLISTEXTUREPROC>("glIsTexture", Null_glIsTexture, Lazy_glIsTexture))
 	{
 		Available = Ver_Major > 1 || (Ver_Major == 1 && (Ver_Minor > 1 || (Ver_Minor == 1 && Ver_Release >= 0)));
 	}
 
+	Version11::Version11(Func_GetProcAddress GetProcAddress):
+		Version11(GetProcAddress, LoadMode::Eager)
+	{
+	}
+
 
 	static void APIENTRY Null_glDrawRangeElements (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void* indices){ NullFuncPtr(); }
 	static void APIENTRY Null_glTexImage3D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void* pixels){ NullFuncPtr(); }
 	static void APIENTRY Null_glTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void* pixels){ NullFuncPtr(); }
 	static void APIENTRY Null_glCopyTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height){ NullFuncPtr(); }
-	Version12::Version12(Func_GetProcAddress GetProcAddress):
-		Version11(GetProcAddress),
-		DrawRangeElements(GetProc<PFNGLDRAWRANGEELEMENTSPROC>("glDrawRangeElements", Null_glDrawRangeElements)),
-		TexImage3D(GetProc<PFNGLTEXIMAGE3DPROC>("glTexImage3D", Null_glTexImage3D)),
-		TexSubImage3D(GetProc<PFNGLTEXSUBIMAGE3DPROC>("glTexSubImage3D", Null_glTexSubImage3D)),
-		CopyTexSubImage3D(GetProc<PFNGLCOPYTEXSUBIMAGE3DPROC>("glCopyTexSubImage3D", Null_glCopyTexSubImage3D))
+	static void Resolve_glDrawRangeElements(Version46& c){ c.DrawRangeElements = c.GetProc<decltype(c.DrawRangeElements)>("glDrawRangeElements", Null_glDrawRangeElements); }
+	static void Resolve_glTexImage3D(Version46& c){ c.TexImage3D = c.GetProc<decltype(c.TexImage3D)>("glTexImage3D", Null_glTexImage3D); }
+	static void Resolve_glTexSubImage3D(Version46& c){ c.TexSubImage3D = c.GetProc<decltype(c.TexSubImage3D)>("glTexSubImage3D", Null_glTexSubImage3D); }
+	static void Resolve_glCopyTexSubImage3D(Version46& c){ c.CopyTexSubImage3D = c.GetProc<decltype(c.CopyTexSubImage3D)>("glCopyTexSubImage3D", Null_glCopyTexSubImage3D); }
+	static void APIENTRY Lazy_glDrawRangeElements (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void* indices){ auto& c = ResolveLazy(Resolve_glDrawRangeElements, [](const Version46& c){ return c.DrawRangeElements == Lazy_glDrawRangeElements; }); return c.DrawRangeElements(mode, start, end, count, type, indices); }
+	static void APIENTRY Lazy_glTexImage3D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void* pixels){ auto& c = ResolveLazy(Resolve_glTexImage3D, [](const Version46& c){ return c.TexImage3D == Lazy_glTexImage3D; }); return c.TexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels); }
+	static void APIENTRY Lazy_glTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void* pixels){ auto& c = ResolveLazy(Resolve_glTexSubImage3D, [](const Version46& c){ return c.TexSubImage3D == Lazy_glTexSubImage3D; }); return c.TexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels); }
+	static void APIENTRY Lazy_glCopyTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height){ auto& c = ResolveLazy(Resolve_glCopyTexSubImage3D, [](const Version46& c){ return c.CopyTexSubImage3D == Lazy_glCopyTexSubImage3D; }); return c.CopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height); }
+	Version12::Version12(Func_GetProcAddress GetProcAddress, LoadMode Mode):
+		Version11(GetProcAddress, Mode),
+		DrawRangeElements(GetProc<PFNGLDRAWRANGEELEMENTSPROC>("glDrawRangeElements", Null_glDrawRangeElements, Lazy_glDrawRangeElements)),
+		TexImage3D(GetProc<PFNGLTEXIMAGE3DPROC>("glTexImage3D", Null_glTexImage3D, Lazy_glTexImage3D)),
+		TexSubImage3D(GetProc<PFNGLTEXSUBIMAGE3DPROC>("glTexSubImage3D", Null_glTexSubImage3D, Lazy_glTexSubImage3D)),
+		CopyTexSubImage3D(GetProc<PFNGLCOPYTEXSUBIMAGE3DPROC>("glCopyTexSubImage3D", Null_glCopyTexSubImage3D, Lazy_glCopyTexSubImage3D))
 	{
 		Available = Ver_Major > 1 || (Ver_Major == 1 && (Ver_Minor > 2 || (Ver_Minor == 2 && Ver_Release >= 0)));
 	}
 
+	Version12::Version12(Func_GetProcAddress GetProcAddress):
+		Version12(GetProcAddress, LoadMode::Eager)
+	{
+	}
+
 
 	static void APIENTRY Null_glActiveTexture (GLenum texture){ NullFuncPtr(); }
 	static void APIENTRY Null_glSampleCoverage (GLfloat value, GLboolean invert){ NullFuncPtr(); }
@@ -295,58 +467,155 @@ namespace GL
 	static void APIENTRY Null_glLoadTransposeMatrixd (const GLdouble* m){ NullFuncPtr(); }
 	static void APIENTRY Null_glMultTransposeMatrixf (const GLfloat* m){ NullFuncPtr(); }
 	static void APIENTRY Null_glMultTransposeMatrixd (const GLdouble* m){ NullFuncPtr(); }
-	Version13::Version13(Func_GetProcAddress GetProcAddress):
-		Version12(GetProcAddress),
-		ActiveTexture(GetProc<PFNGLACTIVETEXTUREPROC>("glActiveTexture", Null_glActiveTexture)),
-		SampleCoverage(GetProc<PFNGLSAMPLECOVERAGEPROC>("glSampleCoverage", Null_glSampleCoverage)),
-		CompressedTexImage3D(GetProc<PFNGLCOMPRESSEDTEXIMAGE3DPROC>("glCompressedTexImage3D", Null_glCompressedTexImage3D)),
-		CompressedTexImage2D(GetProc<PFNGLCOMPRESSEDTEXIMAGE2DPROC>("glCompressedTexImage2D", Null_glCompressedTexImage2D)),
-		CompressedTexImage1D(GetProc<PFNGLCOMPRESSEDTEXIMAGE1DPROC>("glCompressedTexImage1D", Null_glCompressedTexImage1D)),
-		CompressedTexSubImage3D(GetProc<PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC>("glCompressedTexSubImage3D", Null_glCompressedTexSubImage3D)),
-		CompressedTexSubImage2D(GetProc<PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC>("glCompressedTexSubImage2D", Null_glCompressedTexSubImage2D)),
-		CompressedTexSubImage1D(GetProc<PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC>("glCompressedTexSubImage1D", Null_glCompressedTexSubImage1D)),
-		GetCompressedTexImage(GetProc<PFNGLGETCOMPRESSEDTEXIMAGEPROC>("glGetCompressedTexImage", Null_glGetCompressedTexImage)),
-		ClientActiveTexture(GetProc<PFNGLCLIENTACTIVETEXTUREPROC>("glClientActiveTexture", Null_glClientActiveTexture)),
-		MultiTexCoord1d(GetProc<PFNGLMULTITEXCOORD1DPROC>("glMultiTexCoord1d", Null_glMultiTexCoord1d)),
-		MultiTexCoord1dv(GetProc<PFNGLMULTITEXCOORD1DVPROC>("glMultiTexCoord1dv", Null_glMultiTexCoord1dv)),
-		MultiTexCoord1f(GetProc<PFNGLMULTITEXCOORD1FPROC>("glMultiTexCoord1f", Null_glMultiTexCoord1f)),
-		MultiTexCoord1fv(GetProc<PFNGLMULTITEXCOORD1FVPROC>("glMultiTexCoord1fv", Null_glMultiTexCoord1fv)),
-		MultiTexCoord1i(GetProc<PFNGLMULTITEXCOORD1IPROC>("glMultiTexCoord1i", Null_glMultiTexCoord1i)),
-		MultiTexCoord1iv(GetProc<PFNGLMULTITEXCOORD1IVPROC>("glMultiTexCoord1iv", Null_glMultiTexCoord1iv)),
-		MultiTexCoord1s(GetProc<PFNGLMULTITEXCOORD1SPROC>("glMultiTexCoord1s", Null_glMultiTexCoord1s)),
-		MultiTexCoord1sv(GetProc<PFNGLMULTITEXCOORD1SVPROC>("glMultiTexCoord1sv", Null_glMultiTexCoord1sv)),
-		MultiTexCoord2d(GetProc<PFNGLMULTITEXCOORD2DPROC>("glMultiTexCoord2d", Null_glMultiTexCoord2d)),
-		MultiTexCoord2dv(GetProc<PFNGLMULTITEXCOORD2DVPROC>("glMultiTexCoord2dv", Null_glMultiTexCoord2dv)),
-		MultiTexCoord2f(GetProc<PFNGLMULTITEXCOORD2FPROC>("glMultiTexCoord2f", Null_glMultiTexCoord2f)),
-		MultiTexCoord2fv(GetProc<PFNGLMULTITEXCOORD2FVPROC>("glMultiTexCoord2fv", Null_glMultiTexCoord2fv)),
-		MultiTexCoord2i(GetProc<PFNGLMULTITEXCOORD2IPROC>("glMultiTexCoord2i", Null_glMultiTexCoord2i)),
-		MultiTexCoord2iv(GetProc<PFNGLMULTITEXCOORD2IVPROC>("glMultiTexCoord2iv", Null_glMultiTexCoord2iv)),
-		MultiTexCoord2s(GetProc<PFNGLMULTITEXCOORD2SPROC>("glMultiTexCoord2s", Null_glMultiTexCoord2s)),
-		MultiTexCoord2sv(GetProc<PFNGLMULTITEXCOORD2SVPROC>("glMultiTexCoord2sv", Null_glMultiTexCoord2sv)),
-		MultiTexCoord3d(GetProc<PFNGLMULTITEXCOORD3DPROC>("glMultiTexCoord3d", Null_glMultiTexCoord3d)),
-		MultiTexCoord3dv(GetProc<PFNGLMULTITEXCOORD3DVPROC>("glMultiTexCoord3dv", Null_glMultiTexCoord3dv)),
-		MultiTexCoord3f(GetProc<PFNGLMULTITEXCOORD3FPROC>("glMultiTexCoord3f", Null_glMultiTexCoord3f)),
-		MultiTexCoord3fv(GetProc<PFNGLMULTITEXCOORD3FVPROC>("glMultiTexCoord3fv", Null_glMultiTexCoord3fv)),
-		MultiTexCoord3i(GetProc<PFNGLMULTITEXCOORD3IPROC>("glMultiTexCoord3i", Null_glMultiTexCoord3i)),
-		MultiTexCoord3iv(GetProc<PFNGLMULTITEXCOORD3IVPROC>("glMultiTexCoord3iv", Null_glMultiTexCoord3iv)),
-		MultiTexCoord3s(GetProc<PFNGLMULTITEXCOORD3SPROC>("glMultiTexCoord3s", Null_glMultiTexCoord3s)),
-		MultiTexCoord3sv(GetProc<PFNGLMULTITEXCOORD3SVPROC>("glMultiTexCoord3sv", Null_glMultiTexCoord3sv)),
-		MultiTexCoord4d(GetProc<PFNGLMULTITEXCOORD4DPROC>("glMultiTexCoord4d", Null_glMultiTexCoord4d)),
-		MultiTexCoord4dv(GetProc<PFNGLMULTITEXCOORD4DVPROC>("glMultiTexCoord4dv", Null_glMultiTexCoord4dv)),
-		MultiTexCoord4f(GetProc<PFNGLMULTITEXCOORD4FPROC>("glMultiTexCoord4f", Null_glMultiTexCoord4f)),
-		MultiTexCoord4fv(GetProc<PFNGLMULTITEXCOORD4FVPROC>("glMultiTexCoord4fv", Null_glMultiTexCoord4fv)),
-		MultiTexCoord4i(GetProc<PFNGLMULTITEXCOORD4IPROC>("glMultiTexCoord4i", Null_glMultiTexCoord4i)),
-		MultiTexCoord4iv(GetProc<PFNGLMULTITEXCOORD4IVPROC>("glMultiTexCoord4iv", Null_glMultiTexCoord4iv)),
-		MultiTexCoord4s(GetProc<PFNGLMULTITEXCOORD4SPROC>("glMultiTexCoord4s", Null_glMultiTexCoord4s)),
-		MultiTexCoord4sv(GetProc<PFNGLMULTITEXCOORD4SVPROC>("glMultiTexCoord4sv", Null_glMultiTexCoord4sv)),
-		LoadTransposeMatrixf(GetProc<PFNGLLOADTRANSPOSEMATRIXFPROC>("glLoadTransposeMatrixf", Null_glLoadTransposeMatrixf)),
-		LoadTransposeMatrixd(GetProc<PFNGLLOADTRANSPOSEMATRIXDPROC>("glLoadTransposeMatrixd", Null_glLoadTransposeMatrixd)),
-		MultTransposeMatrixf(GetProc<PFNGLMULTTRANSPOSEMATRIXFPROC>("glMultTransposeMatrixf", Null_glMultTransposeMatrixf)),
-		MultTransposeMatrixd(GetProc<PFNGLMULTTRANSPOSEMATRIXDPROC>("glMultTransposeMatrixd", Null_glMultTransposeMatrixd))
+	static void Resolve_glActiveTexture(Version46& c){ c.ActiveTexture = c.GetProc<decltype(c.ActiveTexture)>("glActiveTexture", Null_glActiveTexture); }
+	static void Resolve_glSampleCoverage(Version46& c){ c.SampleCoverage = c.GetProc<decltype(c.SampleCoverage)>("glSampleCoverage", Null_glSampleCoverage); }
+	static void Resolve_glCompressedTexImage3D(Version46& c){ c.CompressedTexImage3D = c.GetProc<decltype(c.CompressedTexImage3D)>("glCompressedTexImage3D", Null_glCompressedTexImage3D); }
+	static void Resolve_glCompressedTexImage2D(Version46& c){ c.CompressedTexImage2D = c.GetProc<decltype(c.CompressedTexImage2D)>("glCompressedTexImage2D", Null_glCompressedTexImage2D); }
+	static void Resolve_glCompressedTexImage1D(Version46& c){ c.CompressedTexImage1D = c.GetProc<decltype(c.CompressedTexImage1D)>("glCompressedTexImage1D", Null_glCompressedTexImage1D); }
+	static void Resolve_glCompressedTexSubImage3D(Version46& c){ c.CompressedTexSubImage3D = c.GetProc<decltype(c.CompressedTexSubImage3D)>("glCompressedTexSubImage3D", Null_glCompressedTexSubImage3D); }
+	static void Resolve_glCompressedTexSubImage2D(Version46& c){ c.CompressedTexSubImage2D = c.GetProc<decltype(c.CompressedTexSubImage2D)>("glCompressedTexSubImage2D", Null_glCompressedTexSubImage2D); }
+	static void Resolve_glCompressedTexSubImage1D(Version46& c){ c.CompressedTexSubImage1D = c.GetProc<decltype(c.CompressedTexSubImage1D)>("glCompressedTexSubImage1D", Null_glCompressedTexSubImage1D); }
+	static void Resolve_glGetCompressedTexImage(Version46& c){ c.GetCompressedTexImage = c.GetProc<decltype(c.GetCompressedTexImage)>("glGetCompressedTexImage", Null_glGetCompressedTexImage); }
+	static void Resolve_glClientActiveTexture(Version46& c){ c.ClientActiveTexture = c.GetProc<decltype(c.ClientActiveTexture)>("glClientActiveTexture", Null_glClientActiveTexture); }
+	static void Resolve_glMultiTexCoord1d(Version46& c){ c.MultiTexCoord1d = c.GetProc<decltype(c.MultiTexCoord1d)>("glMultiTexCoord1d", Null_glMultiTexCoord1d); }
+	static void Resolve_glMultiTexCoord1dv(Version46& c){ c.MultiTexCoord1dv = c.GetProc<decltype(c.MultiTexCoord1dv)>("glMultiTexCoord1dv", Null_glMultiTexCoord1dv); }
+	static void Resolve_glMultiTexCoord1f(Version46& c){ c.MultiTexCoord1f = c.GetProc<decltype(c.MultiTexCoord1f)>("glMultiTexCoord1f", Null_glMultiTexCoord1f); }
+	static void Resolve_glMultiTexCoord1fv(Version46& c){ c.MultiTexCoord1fv = c.GetProc<decltype(c.MultiTexCoord1fv)>("glMultiTexCoord1fv", Null_glMultiTexCoord1fv); }
+	static void Resolve_glMultiTexCoord1i(Version46& c){ c.MultiTexCoord1i = c.GetProc<decltype(c.MultiTexCoord1i)>("glMultiTexCoord1i", Null_glMultiTexCoord1i); }
+	static void Resolve_glMultiTexCoord1iv(Version46& c){ c.MultiTexCoord1iv = c.GetProc<decltype(c.MultiTexCoord1iv)>("glMultiTexCoord1iv", Null_glMultiTexCoord1iv); }
+	static void Resolve_glMultiTexCoord1s(Version46& c){ c.MultiTexCoord1s = c.GetProc<decltype(c.MultiTexCoord1s)>("glMultiTexCoord1s", Null_glMultiTexCoord1s); }
+	static void Resolve_glMultiTexCoord1sv(Version46& c){ c.MultiTexCoord1sv = c.GetProc<decltype(c.MultiTexCoord1sv)>("glMultiTexCoord1sv", Null_glMultiTexCoord1sv); }
+	static void Resolve_glMultiTexCoord2d(Version46& c){ c.MultiTexCoord2d = c.GetProc<decltype(c.MultiTexCoord2d)>("glMultiTexCoord2d", Null_glMultiTexCoord2d); }
+	static void Resolve_glMultiTexCoord2dv(Version46& c){ c.MultiTexCoord2dv = c.GetProc<decltype(c.MultiTexCoord2dv)>("glMultiTexCoord2dv", Null_glMultiTexCoord2dv); }
+	static void Resolve_glMultiTexCoord2f(Version46& c){ c.MultiTexCoord2f = c.GetProc<decltype(c.MultiTexCoord2f)>("glMultiTexCoord2f", Null_glMultiTexCoord2f); }
+	static void Resolve_glMultiTexCoord2fv(Version46& c){ c.MultiTexCoord2fv = c.GetProc<decltype(c.MultiTexCoord2fv)>("glMultiTexCoord2fv", Null_glMultiTexCoord2fv); }
+	static void Resolve_glMultiTexCoord2i(Version46& c){ c.MultiTexCoord2i = c.GetProc<decltype(c.MultiTexCoord2i)>("glMultiTexCoord2i", Null_glMultiTexCoord2i); }
+	static void Resolve_glMultiTexCoord2iv(Version46& c){ c.MultiTexCoord2iv = c.GetProc<decltype(c.MultiTexCoord2iv)>("glMultiTexCoord2iv", Null_glMultiTexCoord2iv); }
+	static void Resolve_glMultiTexCoord2s(Version46& c){ c.MultiTexCoord2s = c.GetProc<decltype(c.MultiTexCoord2s)>("glMultiTexCoord2s", Null_glMultiTexCoord2s); }
+	static void Resolve_glMultiTexCoord2sv(Version46& c){ c.MultiTexCoord2sv = c.GetProc<decltype(c.MultiTexCoord2sv)>("glMultiTexCoord2sv", Null_glMultiTexCoord2sv); }
+	static void Resolve_glMultiTexCoord3d(Version46& c){ c.MultiTexCoord3d = c.GetProc<decltype(c.MultiTexCoord3d)>("glMultiTexCoord3d", Null_glMultiTexCoord3d); }
+	static void Resolve_glMultiTexCoord3dv(Version46& c){ c.MultiTexCoord3dv = c.GetProc<decltype(c.MultiTexCoord3dv)>("glMultiTexCoord3dv", Null_glMultiTexCoord3dv); }
+	static void Resolve_glMultiTexCoord3f(Version46& c){ c.MultiTexCoord3f = c.GetProc<decltype(c.MultiTexCoord3f)>("glMultiTexCoord3f", Null_glMultiTexCoord3f); }
+	static void Resolve_glMultiTexCoord3fv(Version46& c){ c.MultiTexCoord3fv = c.GetProc<decltype(c.MultiTexCoord3fv)>("glMultiTexCoord3fv", Null_glMultiTexCoord3fv); }
+	static void Resolve_glMultiTexCoord3i(Version46& c){ c.MultiTexCoord3i = c.GetProc<decltype(c.MultiTexCoord3i)>("glMultiTexCoord3i", Null_glMultiTexCoord3i); }
+	static void Resolve_glMultiTexCoord3iv(Version46& c){ c.MultiTexCoord3iv = c.GetProc<decltype(c.MultiTexCoord3iv)>("glMultiTexCoord3iv", Null_glMultiTexCoord3iv); }
+	static void Resolve_glMultiTexCoord3s(Version46& c){ c.MultiTexCoord3s = c.GetProc<decltype(c.MultiTexCoord3s)>("glMultiTexCoord3s", Null_glMultiTexCoord3s); }
+	static void Resolve_glMultiTexCoord3sv(Version46& c){ c.MultiTexCoord3sv = c.GetProc<decltype(c.MultiTexCoord3sv)>("glMultiTexCoord3sv", Null_glMultiTexCoord3sv); }
+	static void Resolve_glMultiTexCoord4d(Version46& c){ c.MultiTexCoord4d = c.GetProc<decltype(c.MultiTexCoord4d)>("glMultiTexCoord4d", Null_glMultiTexCoord4d); }
+	static void Resolve_glMultiTexCoord4dv(Version46& c){ c.MultiTexCoord4dv = c.GetProc<decltype(c.MultiTexCoord4dv)>("glMultiTexCoord4dv", Null_glMultiTexCoord4dv); }
+	static void Resolve_glMultiTexCoord4f(Version46& c){ c.MultiTexCoord4f = c.GetProc<decltype(c.MultiTexCoord4f)>("glMultiTexCoord4f", Null_glMultiTexCoord4f); }
+	static void Resolve_glMultiTexCoord4fv(Version46& c){ c.MultiTexCoord4fv = c.GetProc<decltype(c.MultiTexCoord4fv)>("glMultiTexCoord4fv", Null_glMultiTexCoord4fv); }
+	static void Resolve_glMultiTexCoord4i(Version46& c){ c.MultiTexCoord4i = c.GetProc<decltype(c.MultiTexCoord4i)>("glMultiTexCoord4i", Null_glMultiTexCoord4i); }
+	static void Resolve_glMultiTexCoord4iv(Version46& c){ c.MultiTexCoord4iv = c.GetProc<decltype(c.MultiTexCoord4iv)>("glMultiTexCoord4iv", Null_glMultiTexCoord4iv); }
+	static void Resolve_glMultiTexCoord4s(Version46& c){ c.MultiTexCoord4s = c.GetProc<decltype(c.MultiTexCoord4s)>("glMultiTexCoord4s", Null_glMultiTexCoord4s); }
+	static void Resolve_glMultiTexCoord4sv(Version46& c){ c.MultiTexCoord4sv = c.GetProc<decltype(c.MultiTexCoord4sv)>("glMultiTexCoord4sv", Null_glMultiTexCoord4sv); }
+	static void Resolve_glLoadTransposeMatrixf(Version46& c){ c.LoadTransposeMatrixf = c.GetProc<decltype(c.LoadTransposeMatrixf)>("glLoadTransposeMatrixf", Null_glLoadTransposeMatrixf); }
+	static void Resolve_glLoadTransposeMatrixd(Version46& c){ c.LoadTransposeMatrixd = c.GetProc<decltype(c.LoadTransposeMatrixd)>("glLoadTransposeMatrixd", Null_glLoadTransposeMatrixd); }
+	static void Resolve_glMultTransposeMatrixf(Version46& c){ c.MultTransposeMatrixf = c.GetProc<decltype(c.MultTransposeMatrixf)>("glMultTransposeMatrixf", Null_glMultTransposeMatrixf); }
+	static void Resolve_glMultTransposeMatrixd(Version46& c){ c.MultTransposeMatrixd = c.GetProc<decltype(c.MultTransposeMatrixd)>("glMultTransposeMatrixd", Null_glMultTransposeMatrixd); }
+	static void APIENTRY Lazy_glActiveTexture (GLenum texture){ auto& c = ResolveLazy(Resolve_glActiveTexture, [](const Version46& c){ return c.ActiveTexture == Lazy_glActiveTexture; }); return c.ActiveTexture(texture); }
+	static void APIENTRY Lazy_glSampleCoverage (GLfloat value, GLboolean invert){ auto& c = ResolveLazy(Resolve_glSampleCoverage, [](const Version46& c){ return c.SampleCoverage == Lazy_glSampleCoverage; }); return c.SampleCoverage(value, invert); }
+	static void APIENTRY Lazy_glCompressedTexImage3D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void* data){ auto& c = ResolveLazy(Resolve_glCompressedTexImage3D, [](const Version46& c){ return c.CompressedTexImage3D == Lazy_glCompressedTexImage3D; }); return c.CompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data); }
+	static void APIENTRY Lazy_glCompressedTexImage2D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void* data){ auto& c = ResolveLazy(Resolve_glCompressedTexImage2D, [](const Version46& c){ return c.CompressedTexImage2D == Lazy_glCompressedTexImage2D; }); return c.CompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data); }
+	static void APIENTRY Lazy_glCompressedTexImage1D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void* data){ auto& c = ResolveLazy(Resolve_glCompressedTexImage1D, [](const Version46& c){ return c.CompressedTexImage1D == Lazy_glCompressedTexImage1D; }); return c.CompressedTexImage1D(target, level, internalformat, width, border, imageSize, data); }
+	static void APIENTRY Lazy_glCompressedTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void* data){ auto& c = ResolveLazy(Resolve_glCompressedTexSubImage3D, [](const Version46& c){ return c.CompressedTexSubImage3D == Lazy_glCompressedTexSubImage3D; }); return c.CompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data); }
+	static void APIENTRY Lazy_glCompressedTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void* data){ auto& c = ResolveLazy(Resolve_glCompressedTexSubImage2D, [](const Version46& c){ return c.CompressedTexSubImage2D == Lazy_glCompressedTexSubImage2D; }); return c.CompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data); }
+	static void APIENTRY Lazy_glCompressedTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void* data){ auto& c = ResolveLazy(Resolve_glCompressedTexSubImage1D, [](const Version46& c){ return c.CompressedTexSubImage1D == Lazy_glCompressedTexSubImage1D; }); return c.CompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data); }
+	static void APIENTRY Lazy_glGetCompressedTexImage (GLenum target, GLint level, void* img){ auto& c = ResolveLazy(Resolve_glGetCompressedTexImage, [](const Version46& c){ return c.GetCompressedTexImage == Lazy_glGetCompressedTexImage; }); return c.GetCompressedTexImage(target, level, img); }
+	static void APIENTRY Lazy_glClientActiveTexture (GLenum texture){ auto& c = ResolveLazy(Resolve_glClientActiveTexture, [](const Version46& c){ return c.ClientActiveTexture == Lazy_glClientActiveTexture; }); return c.ClientActiveTexture(texture); }
+	static void APIENTRY Lazy_glMultiTexCoord1d (GLenum target, GLdouble s){ auto& c = ResolveLazy(Resolve_glMultiTexCoord1d, [](const Version46& c){ return c.MultiTexCoord1d == Lazy_glMultiTexCoord1d; }); return c.MultiTexCoord1d(target, s); }
+	static void APIENTRY Lazy_glMultiTexCoord1dv (GLenum target, const GLdouble* v){ auto& c = ResolveLazy(Resolve_glMultiTexCoord1dv, [](const Version46& c){ return c.MultiTexCoord1dv == Lazy_glMultiTexCoord1dv; }); return c.MultiTexCoord1dv(target, v); }
+	static void APIENTRY Lazy_glMultiTexCoord1f (GLenum target, GLfloat s){ auto& c = ResolveLazy(Resolve_glMultiTexCoord1f, [](const Version46& c){ return c.MultiTexCoord1f == Lazy_glMultiTexCoord1f; }); return c.MultiTexCoord1f(target, s); }
+	static void APIENTRY Lazy_glMultiTexCoord1fv (GLenum target, const GLfloat* v){ auto& c = ResolveLazy(Resolve_glMultiTexCoord1fv, [](const Version46& c){ return c.MultiTexCoord1fv == Lazy_glMultiTexCoord1fv; }); return c.MultiTexCoord1fv(target, v); }
+	static void APIENTRY Lazy_glMultiTexCoord1i (GLenum target, GLint s){ auto& c = ResolveLazy(Resolve_glMultiTexCoord1i, [](const Version46& c){ return c.MultiTexCoord1i == Lazy_glMultiTexCoord1i; }); return c.MultiTexCoord1i(target, s); }
+	static void APIENTRY Lazy_glMultiTexCoord1iv (GLenum target, const GLint* v){ auto& c = ResolveLazy(Resolve_glMultiTexCoord1iv, [](const Version46& c){ return c.MultiTexCoord1iv == Lazy_glMultiTexCoord1iv; }); return c.MultiTexCoord1iv(target, v); }
+	static void APIENTRY Lazy_glMultiTexCoord1s (GLenum target, GLshort s){ auto& c = ResolveLazy(Resolve_glMultiTexCoord1s, [](const Version46& c){ return c.MultiTexCoord1s == Lazy_glMultiTexCoord1s; }); return c.MultiTexCoord1s(target, s); }
+	static void APIENTRY Lazy_glMultiTexCoord1sv (GLenum target, const GLshort* v){ auto& c = ResolveLazy(Resolve_glMultiTexCoord1sv, [](const Version46& c){ return c.MultiTexCoord1sv == Lazy_glMultiTexCoord1sv; }); return c.MultiTexCoord1sv(target, v); }
+	static void APIENTRY Lazy_glMultiTexCoord2d (GLenum target, GLdouble s, GLdouble t){ auto& c = ResolveLazy(Resolve_glMultiTexCoord2d, [](const Version46& c){ return c.MultiTexCoord2d == Lazy_glMultiTexCoord2d; }); return c.MultiTexCoord2d(target, s, t); }
+	static void APIENTRY Lazy_glMultiTexCoord2dv (GLenum target, const GLdouble* v){ auto& c = ResolveLazy(Resolve_glMultiTexCoord2dv, [](const Version46& c){ return c.MultiTexCoord2dv == Lazy_glMultiTexCoord2dv; }); return c.MultiTexCoord2dv(target, v); }
+	static void APIENTRY Lazy_glMultiTexCoord2f (GLenum target, GLfloat s, GLfloat t){ auto& c = ResolveLazy(Resolve_glMultiTexCoord2f, [](const Version46& c){ return c.MultiTexCoord2f == Lazy_glMultiTexCoord2f; }); return c.MultiTexCoord2f(target, s, t); }
+	static void APIENTRY Lazy_glMultiTexCoord2fv (GLenum target, const GLfloat* v){ auto& c = ResolveLazy(Resolve_glMultiTexCoord2fv, [](const Version46& c){ return c.MultiTexCoord2fv == Lazy_glMultiTexCoord2fv; }); return c.MultiTexCoord2fv(target, v); }
+	static void APIENTRY Lazy_glMultiTexCoord2i (GLenum target, GLint s, GLint t){ auto& c = ResolveLazy(Resolve_glMultiTexCoord2i, [](const Version46& c){ return c.MultiTexCoord2i == Lazy_glMultiTexCoord2i; }); return c.MultiTexCoord2i(target, s, t); }
+	static void APIENTRY Lazy_glMultiTexCoord2iv (GLenum target, const GLint* v){ auto& c = ResolveLazy(Resolve_glMultiTexCoord2iv, [](const Version46& c){ return c.MultiTexCoord2iv == Lazy_glMultiTexCoord2iv; }); return c.MultiTexCoord2iv(target, v); }
+	static void APIENTRY Lazy_glMultiTexCoord2s (GLenum target, GLshort s, GLshort t){ auto& c = ResolveLazy(Resolve_glMultiTexCoord2s, [](const Version46& c){ return c.MultiTexCoord2s == Lazy_glMultiTexCoord2s; }); return c.MultiTexCoord2s(target, s, t); }
+	static void APIENTRY Lazy_glMultiTexCoord2sv (GLenum target, const GLshort* v){ auto& c = ResolveLazy(Resolve_glMultiTexCoord2sv, [](const Version46& c){ return c.MultiTexCoord2sv == Lazy_glMultiTexCoord2sv; }); return c.MultiTexCoord2sv(target, v); }
+	static void APIENTRY Lazy_glMultiTexCoord3d (GLenum target, GLdouble s, GLdouble t, GLdouble r){ auto& c = ResolveLazy(Resolve_glMultiTexCoord3d, [](const Version46& c){ return c.MultiTexCoord3d == Lazy_glMultiTexCoord3d; }); return c.MultiTexCoord3d(target, s, t, r); }
+	static void APIENTRY Lazy_glMultiTexCoord3dv (GLenum target, const GLdouble* v){ auto& c = ResolveLazy(Resolve_glMultiTexCoord3dv, [](const Version46& c){ return c.MultiTexCoord3dv == Lazy_glMultiTexCoord3dv; }); return c.MultiTexCoord3dv(target, v); }
+	static void APIENTRY Lazy_glMultiTexCoord3f (GLenum target, GLfloat s, GLfloat t, GLfloat r){ auto& c = ResolveLazy(Resolve_glMultiTexCoord3f, [](const Version46& c){ return c.MultiTexCoord3f == Lazy_glMultiTexCoord3f; }); return c.MultiTexCoord3f(target, s, t, r); }
+	static void APIENTRY Lazy_glMultiTexCoord3fv (GLenum target, const GLfloat* v){ auto& c = ResolveLazy(Resolve_glMultiTexCoord3fv, [](const Version46& c){ return c.MultiTexCoord3fv == Lazy_glMultiTexCoord3fv; }); return c.MultiTexCoord3fv(target, v); }
+	static void APIENTRY Lazy_glMultiTexCoord3i (GLenum target, GLint s, GLint t, GLint r){ auto& c = ResolveLazy(Resolve_glMultiTexCoord3i, [](const Version46& c){ return c.MultiTexCoord3i == Lazy_glMultiTexCoord3i; }); return c.MultiTexCoord3i(target, s, t, r); }
+	static void APIENTRY Lazy_glMultiTexCoord3iv (GLenum target, const GLint* v){ auto& c = ResolveLazy(Resolve_glMultiTexCoord3iv, [](const Version46& c){ return c.MultiTexCoord3iv == Lazy_glMultiTexCoord3iv; }); return c.MultiTexCoord3iv(target, v); }
+	static void APIENTRY Lazy_glMultiTexCoord3s (GLenum target, GLshort s, GLshort t, GLshort r){ auto& c = ResolveLazy(Resolve_glMultiTexCoord3s, [](const Version46& c){ return c.MultiTexCoord3s == Lazy_glMultiTexCoord3s; }); return c.MultiTexCoord3s(target, s, t, r); }
+	static void APIENTRY Lazy_glMultiTexCoord3sv (GLenum target, const GLshort* v){ auto& c = ResolveLazy(Resolve_glMultiTexCoord3sv, [](const Version46& c){ return c.MultiTexCoord3sv == Lazy_glMultiTexCoord3sv; }); return c.MultiTexCoord3sv(target, v); }
+	static void APIENTRY Lazy_glMultiTexCoord4d (GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q){ auto& c = ResolveLazy(Resolve_glMultiTexCoord4d, [](const Version46& c){ return c.MultiTexCoord4d == Lazy_glMultiTexCoord4d; }); return c.MultiTexCoord4d(target, s, t, r, q); }
+	static void APIENTRY Lazy_glMultiTexCoord4dv (GLenum target, const GLdouble* v){ auto& c = ResolveLazy(Resolve_glMultiTexCoord4dv, [](const Version46& c){ return c.MultiTexCoord4dv == Lazy_glMultiTexCoord4dv; }); return c.MultiTexCoord4dv(target, v); }
+	static void APIENTRY Lazy_glMultiTexCoord4f (GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q){ auto& c = ResolveLazy(Resolve_glMultiTexCoord4f, [](const Version46& c){ return c.MultiTexCoord4f == Lazy_glMultiTexCoord4f; }); return c.MultiTexCoord4f(target, s, t, r, q); }
+	static void APIENTRY Lazy_glMultiTexCoord4fv (GLenum target, const GLfloat* v){ auto& c = ResolveLazy(Resolve_glMultiTexCoord4fv, [](const Version46& c){ return c.MultiTexCoord4fv == Lazy_glMultiTexCoord4fv; }); return c.MultiTexCoord4fv(target, v); }
+	static void APIENTRY Lazy_glMultiTexCoord4i (GLenum target, GLint s, GLint t, GLint r, GLint q){ auto& c = ResolveLazy(Resolve_glMultiTexCoord4i, [](const Version46& c){ return c.MultiTexCoord4i == Lazy_glMultiTexCoord4i; }); return c.MultiTexCoord4i(target, s, t, r, q); }
+	static void APIENTRY Lazy_glMultiTexCoord4iv (GLenum target, const GLint* v){ auto& c = ResolveLazy(Resolve_glMultiTexCoord4iv, [](const Version46& c){ return c.MultiTexCoord4iv == Lazy_glMultiTexCoord4iv; }); return c.MultiTexCoord4iv(target, v); }
+	static void APIENTRY Lazy_glMultiTexCoord4s (GLenum target, GLshort s, GLshort t, GLshort r, GLshort q){ auto& c = ResolveLazy(Resolve_glMultiTexCoord4s, [](const Version46& c){ return c.MultiTexCoord4s == Lazy_glMultiTexCoord4s; }); return c.MultiTexCoord4s(target, s, t, r, q); }
+	static void APIENTRY Lazy_glMultiTexCoord4sv (GLenum target, const GLshort* v){ auto& c = ResolveLazy(Resolve_glMultiTexCoord4sv, [](const Version46& c){ return c.MultiTexCoord4sv == Lazy_glMultiTexCoord4sv; }); return c.MultiTexCoord4sv(target, v); }
+	static void APIENTRY Lazy_glLoadTransposeMatrixf (const GLfloat* m){ auto& c = ResolveLazy(Resolve_glLoadTransposeMatrixf, [](const Version46& c){ return c.LoadTransposeMatrixf == Lazy_glLoadTransposeMatrixf; }); return c.LoadTransposeMatrixf(m); }
+	static void APIENTRY Lazy_glLoadTransposeMatrixd (const GLdouble* m){ auto& c = ResolveLazy(Resolve_glLoadTransposeMatrixd, [](const Version46& c){ return c.LoadTransposeMatrixd == Lazy_glLoadTransposeMatrixd; }); return c.LoadTransposeMatrixd(m); }
+	static void APIENTRY Lazy_glMultTransposeMatrixf (const GLfloat* m){ auto& c = ResolveLazy(Resolve_glMultTransposeMatrixf, [](const Version46& c){ return c.MultTransposeMatrixf == Lazy_glMultTransposeMatrixf; }); return c.MultTransposeMatrixf(m); }
+	static void APIENTRY Lazy_glMultTransposeMatrixd (const GLdouble* m){ auto& c = ResolveLazy(Resolve_glMultTransposeMatrixd, [](const Version46& c){ return c.MultTransposeMatrixd == Lazy_glMultTransposeMatrixd; }); return c.MultTransposeMatrixd(m); }
+	Version13::Version13(Func_GetProcAddress GetProcAddress, LoadMode Mode):
+		Version12(GetProcAddress, Mode),
+		ActiveTexture(GetProc<PFNGLACTIVETEXTUREPROC>("glActiveTexture", Null_glActiveTexture, Lazy_glActiveTexture)),
+		SampleCoverage(GetProc<PFNGLSAMPLECOVERAGEPROC>("glSampleCoverage", Null_glSampleCoverage, Lazy_glSampleCoverage)),
+		CompressedTexImage3D(GetProc<PFNGLCOMPRESSEDTEXIMAGE3DPROC>("glCompressedTexImage3D", Null_glCompressedTexImage3D, Lazy_glCompressedTexImage3D)),
+		CompressedTexImage2D(GetProc<PFNGLCOMPRESSEDTEXIMAGE2DPROC>("glCompressedTexImage2D", Null_glCompressedTexImage2D, Lazy_glCompressedTexImage2D)),
+		CompressedTexImage1D(GetProc<PFNGLCOMPRESSEDTEXIMAGE1DPROC>("glCompressedTexImage1D", Null_glCompressedTexImage1D, Lazy_glCompressedTexImage1D)),
+		CompressedTexSubImage3D(GetProc<PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC>("glCompressedTexSubImage3D", Null_glCompressedTexSubImage3D, Lazy_glCompressedTexSubImage3D)),
+		CompressedTexSubImage2D(GetProc<PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC>("glCompressedTexSubImage2D", Null_glCompressedTexSubImage2D, Lazy_glCompressedTexSubImage2D)),
+		CompressedTexSubImage1D(GetProc<PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC>("glCompressedTexSubImage1D", Null_glCompressedTexSubImage1D, Lazy_glCompressedTexSubImage1D)),
+		GetCompressedTexImage(GetProc<PFNGLGETCOMPRESSEDTEXIMAGEPROC>("glGetCompressedTexImage", Null_glGetCompressedTexImage, Lazy_glGetCompressedTexImage)),
+		ClientActiveTexture(GetProc<PFNGLCLIENTACTIVETEXTUREPROC>("glClientActiveTexture", Null_glClientActiveTexture, Lazy_glClientActiveTexture)),
+		MultiTexCoord1d(GetProc<PFNGLMULTITEXCOORD1DPROC>("glMultiTexCoord1d", Null_glMultiTexCoord1d, Lazy_glMultiTexCoord1d)),
+		MultiTexCoord1dv(GetProc<PFNGLMULTITEXCOORD1DVPROC>("glMultiTexCoord1dv", Null_glMultiTexCoord1dv, Lazy_glMultiTexCoord1dv)),
+		MultiTexCoord1f(GetProc<PFNGLMULTITEXCOORD1FPROC>("glMultiTexCoord1f", Null_glMultiTexCoord1f, Lazy_glMultiTexCoord1f)),
+		MultiTexCoord1fv(GetProc<PFNGLMULTITEXCOORD1FVPROC>("glMultiTexCoord1fv", Null_glMultiTexCoord1fv, Lazy_glMultiTexCoord1fv)),
+		MultiTexCoord1i(GetProc<PFNGLMULTITEXCOORD1IPROC>("glMultiTexCoord1i", Null_glMultiTexCoord1i, Lazy_glMultiTexCoord1i)),
+		MultiTexCoord1iv(GetProc<PFNGLMULTITEXCOORD1IVPROC>("glMultiTexCoord1iv", Null_glMultiTexCoord1iv, Lazy_glMultiTexCoord1iv)),
+		MultiTexCoord1s(GetProc<PFNGLMULTITEXCOORD1SPROC>("glMultiTexCoord1s", Null_glMultiTexCoord1s, Lazy_glMultiTexCoord1s)),
+		MultiTexCoord1sv(GetProc<PFNGLMULTITEXCOORD1SVPROC>("glMultiTexCoord1sv", Null_glMultiTexCoord1sv, Lazy_glMultiTexCoord1sv)),
+		MultiTexCoord2d(GetProc<PFNGLMULTITEXCOORD2DPROC>("glMultiTexCoord2d", Null_glMultiTexCoord2d, Lazy_glMultiTexCoord2d)),
+		MultiTexCoord2dv(GetProc<PFNGLMULTITEXCOORD2DVPROC>("glMultiTexCoord2dv", Null_glMultiTexCoord2dv, Lazy_glMultiTexCoord2dv)),
+		MultiTexCoord2f(GetProc<PFNGLMULTITEXCOORD2FPROC>("glMultiTexCoord2f", Null_glMultiTexCoord2f, Lazy_glMultiTexCoord2f)),
+		MultiTexCoord2fv(GetProc<PFNGLMULTITEXCOORD2FVPROC>("glMultiTexCoord2fv", Null_glMultiTexCoord2fv, Lazy_glMultiTexCoord2fv)),
+		MultiTexCoord2i(GetProc<PFNGLMULTITEXCOORD2IPROC>("glMultiTexCoord2i", Null_glMultiTexCoord2i, Lazy_glMultiTexCoord2i)),
+		MultiTexCoord2iv(GetProc<PFNGLMULTITEXCOORD2IVPROC>("glMultiTexCoord2iv", Null_glMultiTexCoord2iv, Lazy_glMultiTexCoord2iv)),
+		MultiTexCoord2s(GetProc<PFNGLMULTITEXCOORD2SPROC>("glMultiTexCoord2s", Null_glMultiTexCoord2s, Lazy_glMultiTexCoord2s)),
+		MultiTexCoord2sv(GetProc<PFNGLMULTITEXCOORD2SVPROC>("glMultiTexCoord2sv", Null_glMultiTexCoord2sv, Lazy_glMultiTexCoord2sv)),
+		MultiTexCoord3d(GetProc<PFNGLMULTITEXCOORD3DPROC>("glMultiTexCoord3d", Null_glMultiTexCoord3d, Lazy_glMultiTexCoord3d)),
+		MultiTexCoord3dv(GetProc<PFNGLMULTITEXCOORD3DVPROC>("glMultiTexCoord3dv", Null_glMultiTexCoord3dv, Lazy_glMultiTexCoord3dv)),
+		MultiTexCoord3f(GetProc<PFNGLMULTITEXCOORD3FPROC>("glMultiTexCoord3f", Null_glMultiTexCoord3f, Lazy_glMultiTexCoord3f)),
+		MultiTexCoord3fv(GetProc<PFNGLMULTITEXCOORD3FVPROC>("glMultiTexCoord3fv", Null_glMultiTexCoord3fv, Lazy_glMultiTexCoord3fv)),
+		MultiTexCoord3i(GetProc<PFNGLMULTITEXCOORD3IPROC>("glMultiTexCoord3i", Null_glMultiTexCoord3i, Lazy_glMultiTexCoord3i)),
+		MultiTexCoord3iv(GetProc<PFNGLMULTITEXCOORD3IVPROC>("glMultiTexCoord3iv", Null_glMultiTexCoord3iv, Lazy_glMultiTexCoord3iv)),
+		MultiTexCoord3s(GetProc<PFNGLMULTITEXCOORD3SPROC>("glMultiTexCoord3s", Null_glMultiTexCoord3s, Lazy_glMultiTexCoord3s)),
+		MultiTexCoord3sv(GetProc<PFNGLMULTITEXCOORD3SVPROC>("glMultiTexCoord3sv", Null_glMultiTexCoord3sv, Lazy_glMultiTexCoord3sv)),
+		MultiTexCoord4d(GetProc<PFNGLMULTITEXCOORD4DPROC>("glMultiTexCoord4d", Null_glMultiTexCoord4d, Lazy_glMultiTexCoord4d)),
+		MultiTexCoord4dv(GetProc<PFNGLMULTITEXCOORD4DVPROC>("glMultiTexCoord4dv", Null_glMultiTexCoord4dv, Lazy_glMultiTexCoord4dv)),
+		MultiTexCoord4f(GetProc<PFNGLMULTITEXCOORD4FPROC>("glMultiTexCoord4f", Null_glMultiTexCoord4f, Lazy_glMultiTexCoord4f)),
+		MultiTexCoord4fv(GetProc<PFNGLMULTITEXCOORD4FVPROC>("glMultiTexCoord4fv", Null_glMultiTexCoord4fv, Lazy_glMultiTexCoord4fv)),
+		MultiTexCoord4i(GetProc<PFNGLMULTITEXCOORD4IPROC>("glMultiTexCoord4i", Null_glMultiTexCoord4i, Lazy_glMultiTexCoord4i)),
+		MultiTexCoord4iv(GetProc<PFNGLMULTITEXCOORD4IVPROC>("glMultiTexCoord4iv", Null_glMultiTexCoord4iv, Lazy_glMultiTexCoord4iv)),
+		MultiTexCoord4s(GetProc<PFNGLMULTITEXCOORD4SPROC>("glMultiTexCoord4s", Null_glMultiTexCoord4s, Lazy_glMultiTexCoord4s)),
+		MultiTexCoord4sv(GetProc<PFNGLMULTITEXCOORD4SVPROC>("glMultiTexCoord4sv", Null_glMultiTexCoord4sv, Lazy_glMultiTexCoord4sv)),
+		LoadTransposeMatrixf(GetProc<PFNGLLOADTRANSPOSEMATRIXFPROC>("glLoadTransposeMatrixf", Null_glLoadTransposeMatrixf, Lazy_glLoadTransposeMatrixf)),
+		LoadTransposeMatrixd(GetProc<PFNGLLOADTRANSPOSEMATRIXDPROC>("glLoadTransposeMatrixd", Null_glLoadTransposeMatrixd, Lazy_glLoadTransposeMatrixd)),
+		MultTransposeMatrixf(GetProc<PFNGLMULTTRANSPOSEMATRIXFPROC>("glMultTransposeMatrixf", Null_glMultTransposeMatrixf, Lazy_glMultTransposeMatrixf)),
+		MultTransposeMatrixd(GetProc<PFNGLMULTTRANSPOSEMATRIXDPROC>("glMultTransposeMatrixd", Null_glMultTransposeMatrixd, Lazy_glMultTransposeMatrixd))
 	{
 		Available = Ver_Major > 1 || (Ver_Major == 1 && (Ver_Minor > 3 || (Ver_Minor == 3 && Ver_Release >= 0)));
 	}
 
+	Version13::Version13(Func_GetProcAddress GetProcAddress):
+		Version13(GetProcAddress, LoadMode::Eager)
+	{
+	}
+
 
 	static void APIENTRY Null_glBlendFuncSeparate (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha){ NullFuncPtr(); }
 	static void APIENTRY Null_glMultiDrawArrays (GLenum mode, const GLint* first, const GLsizei* count, GLsizei drawcount){ NullFuncPtr(); }
@@ -395,59 +664,158 @@ namespace GL
 	static void APIENTRY Null_glWindowPos3sv (const GLshort* v){ NullFuncPtr(); }
 	static void APIENTRY Null_glBlendColor (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha){ NullFuncPtr(); }
 	static void APIENTRY Null_glBlendEquation (GLenum mode){ NullFuncPtr(); }
-	Version14::Version14(Func_GetProcAddress GetProcAddress):
-		Version13(GetProcAddress),
-		BlendFuncSeparate(GetProc<PFNGLBLENDFUNCSEPARATEPROC>("glBlendFuncSeparate", Null_glBlendFuncSeparate)),
-		MultiDrawArrays(GetProc<PFNGLMULTIDRAWARRAYSPROC>("glMultiDrawArrays", Null_glMultiDrawArrays)),
-		MultiDrawElements(GetProc<PFNGLMULTIDRAWELEMENTSPROC>("glMultiDrawElements", Null_glMultiDrawElements)),
-		PointParameterf(GetProc<PFNGLPOINTPARAMETERFPROC>("glPointParameterf", Null_glPointParameterf)),
-		PointParameterfv(GetProc<PFNGLPOINTPARAMETERFVPROC>("glPointParameterfv", Null_glPointParameterfv)),
-		PointParameteri(GetProc<PFNGLPOINTPARAMETERIPROC>("glPointParameteri", Null_glPointParameteri)),
-		PointParameteriv(GetProc<PFNGLPOINTPARAMETERIVPROC>("glPointParameteriv", Null_glPointParameteriv)),
-		FogCoordf(GetProc<PFNGLFOGCOORDFPROC>("glFogCoordf", Null_glFogCoordf)),
-		FogCoordfv(GetProc<PFNGLFOGCOORDFVPROC>("glFogCoordfv", Null_glFogCoordfv)),
-		FogCoordd(GetProc<PFNGLFOGCOORDDPROC>("glFogCoordd", Null_glFogCoordd)),
-		FogCoorddv(GetProc<PFNGLFOGCOORDDVPROC>("glFogCoorddv", Null_glFogCoorddv)),
-		FogCoordPointer(GetProc<PFNGLFOGCOORDPOINTERPROC>("glFogCoordPointer", Null_glFogCoordPointer)),
-		SecondaryColor3b(GetProc<PFNGLSECONDARYCOLOR3BPROC>("glSecondaryColor3b", Null_glSecondaryColor3b)),
-		SecondaryColor3bv(GetProc<PFNGLSECONDARYCOLOR3BVPROC>("glSecondaryColor3bv", Null_glSecondaryColor3bv)),
-		SecondaryColor3d(GetProc<PFNGLSECONDARYCOLOR3DPROC>("glSecondaryColor3d", Null_glSecondaryColor3d)),
-		SecondaryColor3dv(GetProc<PFNGLSECONDARYCOLOR3DVPROC>("glSecondaryColor3dv", Null_glSecondaryColor3dv)),
-		SecondaryColor3f(GetProc<PFNGLSECONDARYCOLOR3FPROC>("glSecondaryColor3f", Null_glSecondaryColor3f)),
-		SecondaryColor3fv(GetProc<PFNGLSECONDARYCOLOR3FVPROC>("glSecondaryColor3fv", Null_glSecondaryColor3fv)),
-		SecondaryColor3i(GetProc<PFNGLSECONDARYCOLOR3IPROC>("glSecondaryColor3i", Null_glSecondaryColor3i)),
-		SecondaryColor3iv(GetProc<PFNGLSECONDARYCOLOR3IVPROC>("glSecondaryColor3iv", Null_glSecondaryColor3iv)),
-		SecondaryColor3s(GetProc<PFNGLSECONDARYCOLOR3SPROC>("glSecondaryColor3s", Null_glSecondaryColor3s)),
-		SecondaryColor3sv(GetProc<PFNGLSECONDARYCOLOR3SVPROC>("glSecondaryColor3sv", Null_glSecondaryColor3sv)),
-		SecondaryColor3ub(GetProc<PFNGLSECONDARYCOLOR3UBPROC>("glSecondaryColor3ub", Null_glSecondaryColor3ub)),
-		SecondaryColor3ubv(GetProc<PFNGLSECONDARYCOLOR3UBVPROC>("glSecondaryColor3ubv", Null_glSecondaryColor3ubv)),
-		SecondaryColor3ui(GetProc<PFNGLSECONDARYCOLOR3UIPROC>("glSecondaryColor3ui", Null_glSecondaryColor3ui)),
-		SecondaryColor3uiv(GetProc<PFNGLSECONDARYCOLOR3UIVPROC>("glSecondaryColor3uiv", Null_glSecondaryColor3uiv)),
-		SecondaryColor3us(GetProc<PFNGLSECONDARYCOLOR3USPROC>("glSecondaryColor3us", Null_glSecondaryColor3us)),
-		SecondaryColor3usv(GetProc<PFNGLSECONDARYCOLOR3USVPROC>("glSecondaryColor3usv", Null_glSecondaryColor3usv)),
-		SecondaryColorPointer(GetProc<PFNGLSECONDARYCOLORPOINTERPROC>("glSecondaryColorPointer", Null_glSecondaryColorPointer)),
-		WindowPos2d(GetProc<PFNGLWINDOWPOS2DPROC>("glWindowPos2d", Null_glWindowPos2d)),
-		WindowPos2dv(GetProc<PFNGLWINDOWPOS2DVPROC>("glWindowPos2dv", Null_glWindowPos2dv)),
-		WindowPos2f(GetProc<PFNGLWINDOWPOS2FPROC>("glWindowPos2f", Null_glWindowPos2f)),
-		WindowPos2fv(GetProc<PFNGLWINDOWPOS2FVPROC>("glWindowPos2fv", Null_glWindowPos2fv)),
-		WindowPos2i(GetProc<PFNGLWINDOWPOS2IPROC>("glWindowPos2i", Null_glWindowPos2i)),
-		WindowPos2iv(GetProc<PFNGLWINDOWPOS2IVPROC>("glWindowPos2iv", Null_glWindowPos2iv)),
-		WindowPos2s(GetProc<PFNGLWINDOWPOS2SPROC>("glWindowPos2s", Null_glWindowPos2s)),
-		WindowPos2sv(GetProc<PFNGLWINDOWPOS2SVPROC>("glWindowPos2sv", Null_glWindowPos2sv)),
-		WindowPos3d(GetProc<PFNGLWINDOWPOS3DPROC>("glWindowPos3d", Null_glWindowPos3d)),
-		WindowPos3dv(GetProc<PFNGLWINDOWPOS3DVPROC>("glWindowPos3dv", Null_glWindowPos3dv)),
-		WindowPos3f(GetProc<PFNGLWINDOWPOS3FPROC>("glWindowPos3f", Null_glWindowPos3f)),
-		WindowPos3fv(GetProc<PFNGLWINDOWPOS3FVPROC>("glWindowPos3fv", Null_glWindowPos3fv)),
-		WindowPos3i(GetProc<PFNGLWINDOWPOS3IPROC>("glWindowPos3i", Null_glWindowPos3i)),
-		WindowPos3iv(GetProc<PFNGLWINDOWPOS3IVPROC>("glWindowPos3iv", Null_glWindowPos3iv)),
-		WindowPos3s(GetProc<PFNGLWINDOWPOS3SPROC>("glWindowPos3s", Null_glWindowPos3s)),
-		WindowPos3sv(GetProc<PFNGLWINDOWPOS3SVPROC>("glWindowPos3sv", Null_glWindowPos3sv)),
-		BlendColor(GetProc<PFNGLBLENDCOLORPROC>("glBlendColor", Null_glBlendColor)),
-		BlendEquation(GetProc<PFNGLBLENDEQUATIONPROC>("glBlendEquation", Null_glBlendEquation))
+	static void Resolve_glBlendFuncSeparate(Version46& c){ c.BlendFuncSeparate = c.GetProc<decltype(c.BlendFuncSeparate)>("glBlendFuncSeparate", Null_glBlendFuncSeparate); }
+	static void Resolve_glMultiDrawArrays(Version46& c){ c.MultiDrawArrays = c.GetProc<decltype(c.MultiDrawArrays)>("glMultiDrawArrays", Null_glMultiDrawArrays); }
+	static void Resolve_glMultiDrawElements(Version46& c){ c.MultiDrawElements = c.GetProc<decltype(c.MultiDrawElements)>("glMultiDrawElements", Null_glMultiDrawElements); }
+	static void Resolve_glPointParameterf(Version46& c){ c.PointParameterf = c.GetProc<decltype(c.PointParameterf)>("glPointParameterf", Null_glPointParameterf); }
+	static void Resolve_glPointParameterfv(Version46& c){ c.PointParameterfv = c.GetProc<decltype(c.PointParameterfv)>("glPointParameterfv", Null_glPointParameterfv); }
+	static void Resolve_glPointParameteri(Version46& c){ c.PointParameteri = c.GetProc<decltype(c.PointParameteri)>("glPointParameteri", Null_glPointParameteri); }
+	static void Resolve_glPointParameteriv(Version46& c){ c.PointParameteriv = c.GetProc<decltype(c.PointParameteriv)>("glPointParameteriv", Null_glPointParameteriv); }
+	static void Resolve_glFogCoordf(Version46& c){ c.FogCoordf = c.GetProc<decltype(c.FogCoordf)>("glFogCoordf", Null_glFogCoordf); }
+	static void Resolve_glFogCoordfv(Version46& c){ c.FogCoordfv = c.GetProc<decltype(c.FogCoordfv)>("glFogCoordfv", Null_glFogCoordfv); }
+	static void Resolve_glFogCoordd(Version46& c){ c.FogCoordd = c.GetProc<decltype(c.FogCoordd)>("glFogCoordd", Null_glFogCoordd); }
+	static void Resolve_glFogCoorddv(Version46& c){ c.FogCoorddv = c.GetProc<decltype(c.FogCoorddv)>("glFogCoorddv", Null_glFogCoorddv); }
+	static void Resolve_glFogCoordPointer(Version46& c){ c.FogCoordPointer = c.GetProc<decltype(c.FogCoordPointer)>("glFogCoordPointer", Null_glFogCoordPointer); }
+	static void Resolve_glSecondaryColor3b(Version46& c){ c.SecondaryColor3b = c.GetProc<decltype(c.SecondaryColor3b)>("glSecondaryColor3b", Null_glSecondaryColor3b); }
+	static void Resolve_glSecondaryColor3bv(Version46& c){ c.SecondaryColor3bv = c.GetProc<decltype(c.SecondaryColor3bv)>("glSecondaryColor3bv", Null_glSecondaryColor3bv); }
+	static void Resolve_glSecondaryColor3d(Version46& c){ c.SecondaryColor3d = c.GetProc<decltype(c.SecondaryColor3d)>("glSecondaryColor3d", Null_glSecondaryColor3d); }
+	static void Resolve_glSecondaryColor3dv(Version46& c){ c.SecondaryColor3dv = c.GetProc<decltype(c.SecondaryColor3dv)>("glSecondaryColor3dv", Null_glSecondaryColor3dv); }
+	static void Resolve_glSecondaryColor3f(Version46& c){ c.SecondaryColor3f = c.GetProc<decltype(c.SecondaryColor3f)>("glSecondaryColor3f", Null_glSecondaryColor3f); }
+	static void Resolve_glSecondaryColor3fv(Version46& c){ c.SecondaryColor3fv = c.GetProc<decltype(c.SecondaryColor3fv)>("glSecondaryColor3fv", Null_glSecondaryColor3fv); }
+	static void Resolve_glSecondaryColor3i(Version46& c){ c.SecondaryColor3i = c.GetProc<decltype(c.SecondaryColor3i)>("glSecondaryColor3i", Null_glSecondaryColor3i); }
+	static void Resolve_glSecondaryColor3iv(Version46& c){ c.SecondaryColor3iv = c.GetProc<decltype(c.SecondaryColor3iv)>("glSecondaryColor3iv", Null_glSecondaryColor3iv); }
+	static void Resolve_glSecondaryColor3s(Version46& c){ c.SecondaryColor3s = c.GetProc<decltype(c.SecondaryColor3s)>("glSecondaryColor3s", Null_glSecondaryColor3s); }
+	static void Resolve_glSecondaryColor3sv(Version46& c){ c.SecondaryColor3sv = c.GetProc<decltype(c.SecondaryColor3sv)>("glSecondaryColor3sv", Null_glSecondaryColor3sv); }
+	static void Resolve_glSecondaryColor3ub(Version46& c){ c.SecondaryColor3ub = c.GetProc<decltype(c.SecondaryColor3ub)>("glSecondaryColor3ub", Null_glSecondaryColor3ub); }
+	static void Resolve_glSecondaryColor3ubv(Version46& c){ c.SecondaryColor3ubv = c.GetProc<decltype(c.SecondaryColor3ubv)>("glSecondaryColor3ubv", Null_glSecondaryColor3ubv); }
+	static void Resolve_glSecondaryColor3ui(Version46& c){ c.SecondaryColor3ui = c.GetProc<decltype(c.SecondaryColor3ui)>("glSecondaryColor3ui", Null_glSecondaryColor3ui); }
+	static void Resolve_glSecondaryColor3uiv(Version46& c){ c.SecondaryColor3uiv = c.GetProc<decltype(c.SecondaryColor3uiv)>("glSecondaryColor3uiv", Null_glSecondaryColor3uiv); }
+	static void Resolve_glSecondaryColor3us(Version46& c){ c.SecondaryColor3us = c.GetProc<decltype(c.SecondaryColor3us)>("glSecondaryColor3us", Null_glSecondaryColor3us); }
+	static void Resolve_glSecondaryColor3usv(Version46& c){ c.SecondaryColor3usv = c.GetProc<decltype(c.SecondaryColor3usv)>("glSecondaryColor3usv", Null_glSecondaryColor3usv); }
+	static void Resolve_glSecondaryColorPointer(Version46& c){ c.SecondaryColorPointer = c.GetProc<decltype(c.SecondaryColorPointer)>("glSecondaryColorPointer", Null_glSecondaryColorPointer); }
+	static void Resolve_glWindowPos2d(Version46& c){ c.WindowPos2d = c.GetProc<decltype(c.WindowPos2d)>("glWindowPos2d", Null_glWindowPos2d); }
+	static void Resolve_glWindowPos2dv(Version46& c){ c.WindowPos2dv = c.GetProc<decltype(c.WindowPos2dv)>("glWindowPos2dv", Null_glWindowPos2dv); }
+	static void Resolve_glWindowPos2f(Version46& c){ c.WindowPos2f = c.GetProc<decltype(c.WindowPos2f)>("glWindowPos2f", Null_glWindowPos2f); }
+	static void Resolve_glWindowPos2fv(Version46& c){ c.WindowPos2fv = c.GetProc<decltype(c.WindowPos2fv)>("glWindowPos2fv", Null_glWindowPos2fv); }
+	static void Resolve_glWindowPos2i(Version46& c){ c.WindowPos2i = c.GetProc<decltype(c.WindowPos2i)>("glWindowPos2i", Null_glWindowPos2i); }
+	static void Resolve_glWindowPos2iv(Version46& c){ c.WindowPos2iv = c.GetProc<decltype(c.WindowPos2iv)>("glWindowPos2iv", Null_glWindowPos2iv); }
+	static void Resolve_glWindowPos2s(Version46& c){ c.WindowPos2s = c.GetProc<decltype(c.WindowPos2s)>("glWindowPos2s", Null_glWindowPos2s); }
+	static void Resolve_glWindowPos2sv(Version46& c){ c.WindowPos2sv = c.GetProc<decltype(c.WindowPos2sv)>("glWindowPos2sv", Null_glWindowPos2sv); }
+	static void Resolve_glWindowPos3d(Version46& c){ c.WindowPos3d = c.GetProc<decltype(c.WindowPos3d)>("glWindowPos3d", Null_glWindowPos3d); }
+	static void Resolve_glWindowPos3dv(Version46& c){ c.WindowPos3dv = c.GetProc<decltype(c.WindowPos3dv)>("glWindowPos3dv", Null_glWindowPos3dv); }
+	static void Resolve_glWindowPos3f(Version46& c){ c.WindowPos3f = c.GetProc<decltype(c.WindowPos3f)>("glWindowPos3f", Null_glWindowPos3f); }
+	static void Resolve_glWindowPos3fv(Version46& c){ c.WindowPos3fv = c.GetProc<decltype(c.WindowPos3fv)>("glWindowPos3fv", Null_glWindowPos3fv); }
+	static void Resolve_glWindowPos3i(Version46& c){ c.WindowPos3i = c.GetProc<decltype(c.WindowPos3i)>("glWindowPos3i", Null_glWindowPos3i); }
+	static void Resolve_glWindowPos3iv(Version46& c){ c.WindowPos3iv = c.GetProc<decltype(c.WindowPos3iv)>("glWindowPos3iv", Null_glWindowPos3iv); }
+	static void Resolve_glWindowPos3s(Version46& c){ c.WindowPos3s = c.GetProc<decltype(c.WindowPos3s)>("glWindowPos3s", Null_glWindowPos3s); }
+	static void Resolve_glWindowPos3sv(Version46& c){ c.WindowPos3sv = c.GetProc<decltype(c.WindowPos3sv)>("glWindowPos3sv", Null_glWindowPos3sv); }
+	static void Resolve_glBlendColor(Version46& c){ c.BlendColor = c.GetProc<decltype(c.BlendColor)>("glBlendColor", Null_glBlendColor); }
+	static void Resolve_glBlendEquation(Version46& c){ c.BlendEquation = c.GetProc<decltype(c.BlendEquation)>("glBlendEquation", Null_glBlendEquation); }
+	static void APIENTRY Lazy_glBlendFuncSeparate (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha){ auto& c = ResolveLazy(Resolve_glBlendFuncSeparate, [](const Version46& c){ return c.BlendFuncSeparate == Lazy_glBlendFuncSeparate; }); return c.BlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha); }
+	static void APIENTRY Lazy_glMultiDrawArrays (GLenum mode, const GLint* first, const GLsizei* count, GLsizei drawcount){ auto& c = ResolveLazy(Resolve_glMultiDrawArrays, [](const Version46& c){ return c.MultiDrawArrays == Lazy_glMultiDrawArrays; }); return c.MultiDrawArrays(mode, first, count, drawcount); }
+	static void APIENTRY Lazy_glMultiDrawElements (GLenum mode, const GLsizei* count, GLenum type, const void* const* indices, GLsizei drawcount){ auto& c = ResolveLazy(Resolve_glMultiDrawElements, [](const Version46& c){ return c.MultiDrawElements == Lazy_glMultiDrawElements; }); return c.MultiDrawElements(mode, count, type, indices, drawcount); }
+	static void APIENTRY Lazy_glPointParameterf (GLenum pname, GLfloat param){ auto& c = ResolveLazy(Resolve_glPointParameterf, [](const Version46& c){ return c.PointParameterf == Lazy_glPointParameterf; }); return c.PointParameterf(pname, param); }
+	static void APIENTRY Lazy_glPointParameterfv (GLenum pname, const GLfloat* params){ auto& c = ResolveLazy(Resolve_glPointParameterfv, [](const Version46& c){ return c.PointParameterfv == Lazy_glPointParameterfv; }); return c.PointParameterfv(pname, params); }
+	static void APIENTRY Lazy_glPointParameteri (GLenum pname, GLint param){ auto& c = ResolveLazy(Resolve_glPointParameteri, [](const Version46& c){ return c.PointParameteri == Lazy_glPointParameteri; }); return c.PointParameteri(pname, param); }
+	static void APIENTRY Lazy_glPointParameteriv (GLenum pname, const GLint* params){ auto& c = ResolveLazy(Resolve_glPointParameteriv, [](const Version46& c){ return c.PointParameteriv == Lazy_glPointParameteriv; }); return c.PointParameteriv(pname, params); }
+	static void APIENTRY Lazy_glFogCoordf (GLfloat coord){ auto& c = ResolveLazy(Resolve_glFogCoordf, [](const Version46& c){ return c.FogCoordf == Lazy_glFogCoordf; }); return c.FogCoordf(coord); }
+	static void APIENTRY Lazy_glFogCoordfv (const GLfloat* coord){ auto& c = ResolveLazy(Resolve_glFogCoordfv, [](const Version46& c){ return c.FogCoordfv == Lazy_glFogCoordfv; }); return c.FogCoordfv(coord); }
+	static void APIENTRY Lazy_glFogCoordd (GLdouble coord){ auto& c = ResolveLazy(Resolve_glFogCoordd, [](const Version46& c){ return c.FogCoordd == Lazy_glFogCoordd; }); return c.FogCoordd(coord); }
+	static void APIENTRY Lazy_glFogCoorddv (const GLdouble* coord){ auto& c = ResolveLazy(Resolve_glFogCoorddv, [](const Version46& c){ return c.FogCoorddv == Lazy_glFogCoorddv; }); return c.FogCoorddv(coord); }
+	static void APIENTRY Lazy_glFogCoordPointer (GLenum type, GLsizei stride, const void* pointer){ auto& c = ResolveLazy(Resolve_glFogCoordPointer, [](const Version46& c){ return c.FogCoordPointer == Lazy_glFogCoordPointer; }); return c.FogCoordPointer(type, stride, pointer); }
+	static void APIENTRY Lazy_glSecondaryColor3b (GLbyte red, GLbyte green, GLbyte blue){ auto& c = ResolveLazy(Resolve_glSecondaryColor3b, [](const Version46& c){ return c.SecondaryColor3b == Lazy_glSecondaryColor3b; }); return c.SecondaryColor3b(red, green, blue); }
+	static void APIENTRY Lazy_glSecondaryColor3bv (const GLbyte* v){ auto& c = ResolveLazy(Resolve_glSecondaryColor3bv, [](const Version46& c){ return c.SecondaryColor3bv == Lazy_glSecondaryColor3bv; }); return c.SecondaryColor3bv(v); }
+	static void APIENTRY Lazy_glSecondaryColor3d (GLdouble red, GLdouble green, GLdouble blue){ auto& c = ResolveLazy(Resolve_glSecondaryColor3d, [](const Version46& c){ return c.SecondaryColor3d == Lazy_glSecondaryColor3d; }); return c.SecondaryColor3d(red, green, blue); }
+	static void APIENTRY Lazy_glSecondaryColor3dv (const GLdouble* v){ auto& c = ResolveLazy(Resolve_glSecondaryColor3dv, [](const Version46& c){ return c.SecondaryColor3dv == Lazy_glSecondaryColor3dv; }); return c.SecondaryColor3dv(v); }
+	static void APIENTRY Lazy_glSecondaryColor3f (GLfloat red, GLfloat green, GLfloat blue){ auto& c = ResolveLazy(Resolve_glSecondaryColor3f, [](const Version46& c){ return c.SecondaryColor3f == Lazy_glSecondaryColor3f; }); return c.SecondaryColor3f(red, green, blue); }
+	static void APIENTRY Lazy_glSecondaryColor3fv (const GLfloat* v){ auto& c = ResolveLazy(Resolve_glSecondaryColor3fv, [](const Version46& c){ return c.SecondaryColor3fv == Lazy_glSecondaryColor3fv; }); return c.SecondaryColor3fv(v); }
+	static void APIENTRY Lazy_glSecondaryColor3i (GLint red, GLint green, GLint blue){ auto& c = ResolveLazy(Resolve_glSecondaryColor3i, [](const Version46& c){ return c.SecondaryColor3i == Lazy_glSecondaryColor3i; }); return c.SecondaryColor3i(red, green, blue); }
+	static void APIENTRY Lazy_glSecondaryColor3iv (const GLint* v){ auto& c = ResolveLazy(Resolve_glSecondaryColor3iv, [](const Version46& c){ return c.SecondaryColor3iv == Lazy_glSecondaryColor3iv; }); return c.SecondaryColor3iv(v); }
+	static void APIENTRY Lazy_glSecondaryColor3s (GLshort red, GLshort green, GLshort blue){ auto& c = ResolveLazy(Resolve_glSecondaryColor3s, [](const Version46& c){ return c.SecondaryColor3s == Lazy_glSecondaryColor3s; }); return c.SecondaryColor3s(red, green, blue); }
+	static void APIENTRY Lazy_glSecondaryColor3sv (const GLshort* v){ auto& c = ResolveLazy(Resolve_glSecondaryColor3sv, [](const Version46& c){ return c.SecondaryColor3sv == Lazy_glSecondaryColor3sv; }); return c.SecondaryColor3sv(v); }
+	static void APIENTRY Lazy_glSecondaryColor3ub (GLubyte red, GLubyte green, GLubyte blue){ auto& c = ResolveLazy(Resolve_glSecondaryColor3ub, [](const Version46& c){ return c.SecondaryColor3ub == Lazy_glSecondaryColor3ub; }); return c.SecondaryColor3ub(red, green, blue); }
+	static void APIENTRY Lazy_glSecondaryColor3ubv (const GLubyte* v){ auto& c = ResolveLazy(Resolve_glSecondaryColor3ubv, [](const Version46& c){ return c.SecondaryColor3ubv == Lazy_glSecondaryColor3ubv; }); return c.SecondaryColor3ubv(v); }
+	static void APIENTRY Lazy_glSecondaryColor3ui (GLuint red, GLuint green, GLuint blue){ auto& c = ResolveLazy(Resolve_glSecondaryColor3ui, [](const Version46& c){ return c.SecondaryColor3ui == Lazy_glSecondaryColor3ui; }); return c.SecondaryColor3ui(red, green, blue); }
+	static void APIENTRY Lazy_glSecondaryColor3uiv (const GLuint* v){ auto& c = ResolveLazy(Resolve_glSecondaryColor3uiv, [](const Version46& c){ return c.SecondaryColor3uiv == Lazy_glSecondaryColor3uiv; }); return c.SecondaryColor3uiv(v); }
+	static void APIENTRY Lazy_glSecondaryColor3us (GLushort red, GLushort green, GLushort blue){ auto& c = ResolveLazy(Resolve_glSecondaryColor3us, [](const Version46& c){ return c.SecondaryColor3us == Lazy_glSecondaryColor3us; }); return c.SecondaryColor3us(red, green, blue); }
+	static void APIENTRY Lazy_glSecondaryColor3usv (const GLushort* v){ auto& c = ResolveLazy(Resolve_glSecondaryColor3usv, [](const Version46& c){ return c.SecondaryColor3usv == Lazy_glSecondaryColor3usv; }); return c.SecondaryColor3usv(v); }
+	static void APIENTRY Lazy_glSecondaryColorPointer (GLint size, GLenum type, GLsizei stride, const void* pointer){ auto& c = ResolveLazy(Resolve_glSecondaryColorPointer, [](const Version46& c){ return c.SecondaryColorPointer == Lazy_glSecondaryColorPointer; }); return c.SecondaryColorPointer(size, type, stride, pointer); }
+	static void APIENTRY Lazy_glWindowPos2d (GLdouble x, GLdouble y){ auto& c = ResolveLazy(Resolve_glWindowPos2d, [](const Version46& c){ return c.WindowPos2d == Lazy_glWindowPos2d; }); return c.WindowPos2d(x, y); }
+	static void APIENTRY Lazy_glWindowPos2dv (const GLdouble* v){ auto& c = ResolveLazy(Resolve_glWindowPos2dv, [](const Version46& c){ return c.WindowPos2dv == Lazy_glWindowPos2dv; }); return c.WindowPos2dv(v); }
+	static void APIENTRY Lazy_glWindowPos2f (GLfloat x, GLfloat y){ auto& c = ResolveLazy(Resolve_glWindowPos2f, [](const Version46& c){ return c.WindowPos2f == Lazy_glWindowPos2f; }); return c.WindowPos2f(x, y); }
+	static void APIENTRY Lazy_glWindowPos2fv (const GLfloat* v){ auto& c = ResolveLazy(Resolve_glWindowPos2fv, [](const Version46& c){ return c.WindowPos2fv == Lazy_glWindowPos2fv; }); return c.WindowPos2fv(v); }
+	static void APIENTRY Lazy_glWindowPos2i (GLint x, GLint y){ auto& c = ResolveLazy(Resolve_glWindowPos2i, [](const Version46& c){ return c.WindowPos2i == Lazy_glWindowPos2i; }); return c.WindowPos2i(x, y); }
+	static void APIENTRY Lazy_glWindowPos2iv (const GLint* v){ auto& c = ResolveLazy(Resolve_glWindowPos2iv, [](const Version46& c){ return c.WindowPos2iv == Lazy_glWindowPos2iv; }); return c.WindowPos2iv(v); }
+	static void APIENTRY Lazy_glWindowPos2s (GLshort x, GLshort y){ auto& c = ResolveLazy(Resolve_glWindowPos2s, [](const Version46& c){ return c.WindowPos2s == Lazy_glWindowPos2s; }); return c.WindowPos2s(x, y); }
+	static void APIENTRY Lazy_glWindowPos2sv (const GLshort* v){ auto& c = ResolveLazy(Resolve_glWindowPos2sv, [](const Version46& c){ return c.WindowPos2sv == Lazy_glWindowPos2sv; }); return c.WindowPos2sv(v); }
+	static void APIENTRY Lazy_glWindowPos3d (GLdouble x, GLdouble y, GLdouble z){ auto& c = ResolveLazy(Resolve_glWindowPos3d, [](const Version46& c){ return c.WindowPos3d == Lazy_glWindowPos3d; }); return c.WindowPos3d(x, y, z); }
+	static void APIENTRY Lazy_glWindowPos3dv (const GLdouble* v){ auto& c = ResolveLazy(Resolve_glWindowPos3dv, [](const Version46& c){ return c.WindowPos3dv == Lazy_glWindowPos3dv; }); return c.WindowPos3dv(v); }
+	static void APIENTRY Lazy_glWindowPos3f (GLfloat x, GLfloat y, GLfloat z){ auto& c = ResolveLazy(Resolve_glWindowPos3f, [](const Version46& c){ return c.WindowPos3f == Lazy_glWindowPos3f; }); return c.WindowPos3f(x, y, z); }
+	static void APIENTRY Lazy_glWindowPos3fv (const GLfloat* v){ auto& c = ResolveLazy(Resolve_glWindowPos3fv, [](const Version46& c){ return c.WindowPos3fv == Lazy_glWindowPos3fv; }); return c.WindowPos3fv(v); }
+	static void APIENTRY Lazy_glWindowPos3i (GLint x, GLint y, GLint z){ auto& c = ResolveLazy(Resolve_glWindowPos3i, [](const Version46& c){ return c.WindowPos3i == Lazy_glWindowPos3i; }); return c.WindowPos3i(x, y, z); }
+	static void APIENTRY Lazy_glWindowPos3iv (const GLint* v){ auto& c = ResolveLazy(Resolve_glWindowPos3iv, [](const Version46& c){ return c.WindowPos3iv == Lazy_glWindowPos3iv; }); return c.WindowPos3iv(v); }
+	static void APIENTRY Lazy_glWindowPos3s (GLshort x, GLshort y, GLshort z){ auto& c = ResolveLazy(Resolve_glWindowPos3s, [](const Version46& c){ return c.WindowPos3s == Lazy_glWindowPos3s; }); return c.WindowPos3s(x, y, z); }
+	static void APIENTRY Lazy_glWindowPos3sv (const GLshort* v){ auto& c = ResolveLazy(Resolve_glWindowPos3sv, [](const Version46& c){ return c.WindowPos3sv == Lazy_glWindowPos3sv; }); return c.WindowPos3sv(v); }
+	static void APIENTRY Lazy_glBlendColor (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha){ auto& c = ResolveLazy(Resolve_glBlendColor, [](const Version46& c){ return c.BlendColor == Lazy_glBlendColor; }); return c.BlendColor(red, green, blue, alpha); }
+	static void APIENTRY Lazy_glBlendEquation (GLenum mode){ auto& c = ResolveLazy(Resolve_glBlendEquation, [](const Version46& c){ return c.BlendEquation == Lazy_glBlendEquation; }); return c.BlendEquation(mode); }
+	Version14::Version14(Func_GetProcAddress GetProcAddress, LoadMode Mode):
+		Version13(GetProcAddress, Mode),
+		BlendFuncSeparate(GetProc<PFNGLBLENDFUNCSEPARATEPROC>("glBlendFuncSeparate", Null_glBlendFuncSeparate, Lazy_glBlendFuncSeparate)),
+		MultiDrawArrays(GetProc<PFNGLMULTIDRAWARRAYSPROC>("glMultiDrawArrays", Null_glMultiDrawArrays, Lazy_glMultiDrawArrays)),
+		MultiDrawElements(GetProc<PFNGLMULTIDRAWELEMENTSPROC>("glMultiDrawElements", Null_glMultiDrawElements, Lazy_glMultiDrawElements)),
+		PointParameterf(GetProc<PFNGLPOINTPARAMETERFPROC>("glPointParameterf", Null_glPointParameterf, Lazy_glPointParameterf)),
+		PointParameterfv(GetProc<PFNGLPOINTPARAMETERFVPROC>("glPointParameterfv", Null_glPointParameterfv, Lazy_glPointParameterfv)),
+		PointParameteri(GetProc<PFNGLPOINTPARAMETERIPROC>("glPointParameteri", Null_glPointParameteri, Lazy_glPointParameteri)),
+		PointParameteriv(GetProc<PFNGLPOINTPARAMETERIVPROC>("glPointParameteriv", Null_glPointParameteriv, Lazy_glPointParameteriv)),
+		FogCoordf(GetProc<PFNGLFOGCOORDFPROC>("glFogCoordf", Null_glFogCoordf, Lazy_glFogCoordf)),
+		FogCoordfv(GetProc<PFNGLFOGCOORDFVPROC>("glFogCoordfv", Null_glFogCoordfv, Lazy_glFogCoordfv)),
+		FogCoordd(GetProc<PFNGLFOGCOORDDPROC>("glFogCoordd", Null_glFogCoordd, Lazy_glFogCoordd)),
+		FogCoorddv(GetProc<PFNGLFOGCOORDDVPROC>("glFogCoorddv", Null_glFogCoorddv, Lazy_glFogCoorddv)),
+		FogCoordPointer(GetProc<PFNGLFOGCOORDPOINTERPROC>("glFogCoordPointer", Null_glFogCoordPointer, Lazy_glFogCoordPointer)),
+		SecondaryColor3b(GetProc<PFNGLSECONDARYCOLOR3BPROC>("glSecondaryColor3b", Null_glSecondaryColor3b, Lazy_glSecondaryColor3b)),
+		SecondaryColor3bv(GetProc<PFNGLSECONDARYCOLOR3BVPROC>("glSecondaryColor3bv", Null_glSecondaryColor3bv, Lazy_glSecondaryColor3bv)),
+		SecondaryColor3d(GetProc<PFNGLSECONDARYCOLOR3DPROC>("glSecondaryColor3d", Null_glSecondaryColor3d, Lazy_glSecondaryColor3d)),
+		SecondaryColor3dv(GetProc<PFNGLSECONDARYCOLOR3DVPROC>("glSecondaryColor3dv", Null_glSecondaryColor3dv, Lazy_glSecondaryColor3dv)),
+		SecondaryColor3f(GetProc<PFNGLSECONDARYCOLOR3FPROC>("glSecondaryColor3f", Null_glSecondaryColor3f, Lazy_glSecondaryColor3f)),
+		SecondaryColor3fv(GetProc<PFNGLSECONDARYCOLOR3FVPROC>("glSecondaryColor3fv", Null_glSecondaryColor3fv, Lazy_glSecondaryColor3fv)),
+		SecondaryColor3i(GetProc<PFNGLSECONDARYCOLOR3IPROC>("glSecondaryColor3i", Null_glSecondaryColor3i, Lazy_glSecondaryColor3i)),
+		SecondaryColor3iv(GetProc<PFNGLSECONDARYCOLOR3IVPROC>("glSecondaryColor3iv", Null_glSecondaryColor3iv, Lazy_glSecondaryColor3iv)),
+		SecondaryColor3s(GetProc<PFNGLSECONDARYCOLOR3SPROC>("glSecondaryColor3s", Null_glSecondaryColor3s, Lazy_glSecondaryColor3s)),
+		SecondaryColor3sv(GetProc<PFNGLSECONDARYCOLOR3SVPROC>("glSecondaryColor3sv", Null_glSecondaryColor3sv, Lazy_glSecondaryColor3sv)),
+		SecondaryColor3ub(GetProc<PFNGLSECONDARYCOLOR3UBPROC>("glSecondaryColor3ub", Null_glSecondaryColor3ub, Lazy_glSecondaryColor3ub)),
+		SecondaryColor3ubv(GetProc<PFNGLSECONDARYCOLOR3UBVPROC>("glSecondaryColor3ubv", Null_glSecondaryColor3ubv, Lazy_glSecondaryColor3ubv)),
+		SecondaryColor3ui(GetProc<PFNGLSECONDARYCOLOR3UIPROC>("glSecondaryColor3ui", Null_glSecondaryColor3ui, Lazy_glSecondaryColor3ui)),
+		SecondaryColor3uiv(GetProc<PFNGLSECONDARYCOLOR3UIVPROC>("glSecondaryColor3uiv", Null_glSecondaryColor3uiv, Lazy_glSecondaryColor3uiv)),
+		SecondaryColor3us(GetProc<PFNGLSECONDARYCOLOR3USPROC>("glSecondaryColor3us", Null_glSecondaryColor3us, Lazy_glSecondaryColor3us)),
+		SecondaryColor3usv(GetProc<PFNGLSECONDARYCOLOR3USVPROC>("glSecondaryColor3usv", Null_glSecondaryColor3usv, Lazy_glSecondaryColor3usv)),
+		SecondaryColorPointer(GetProc<PFNGLSECONDARYCOLORPOINTERPROC>("glSecondaryColorPointer", Null_glSecondaryColorPointer, Lazy_glSecondaryColorPointer)),
+		WindowPos2d(GetProc<PFNGLWINDOWPOS2DPROC>("glWindowPos2d", Null_glWindowPos2d, Lazy_glWindowPos2d)),
+		WindowPos2dv(GetProc<PFNGLWINDOWPOS2DVPROC>("glWindowPos2dv", Null_glWindowPos2dv, Lazy_glWindowPos2dv)),
+		WindowPos2f(GetProc<PFNGLWINDOWPOS2FPROC>("glWindowPos2f", Null_glWindowPos2f, Lazy_glWindowPos2f)),
+		WindowPos2fv(GetProc<PFNGLWINDOWPOS2FVPROC>("glWindowPos2fv", Null_glWindowPos2fv, Lazy_glWindowPos2fv)),
+		WindowPos2i(GetProc<PFNGLWINDOWPOS2IPROC>("glWindowPos2i", Null_glWindowPos2i, Lazy_glWindowPos2i)),
+		WindowPos2iv(GetProc<PFNGLWINDOWPOS2IVPROC>("glWindowPos2iv", Null_glWindowPos2iv, Lazy_glWindowPos2iv)),
+		WindowPos2s(GetProc<PFNGLWINDOWPOS2SPROC>("glWindowPos2s", Null_glWindowPos2s, Lazy_glWindowPos2s)),
+		WindowPos2sv(GetProc<PFNGLWINDOWPOS2SVPROC>("glWindowPos2sv", Null_glWindowPos2sv, Lazy_glWindowPos2sv)),
+		WindowPos3d(GetProc<PFNGLWINDOWPOS3DPROC>("glWindowPos3d", Null_glWindowPos3d, Lazy_glWindowPos3d)),
+		WindowPos3dv(GetProc<PFNGLWINDOWPOS3DVPROC>("glWindowPos3dv", Null_glWindowPos3dv, Lazy_glWindowPos3dv)),
+		WindowPos3f(GetProc<PFNGLWINDOWPOS3FPROC>("glWindowPos3f", Null_glWindowPos3f, Lazy_glWindowPos3f)),
+		WindowPos3fv(GetProc<PFNGLWINDOWPOS3FVPROC>("glWindowPos3fv", Null_glWindowPos3fv, Lazy_glWindowPos3fv)),
+		WindowPos3i(GetProc<PFNGLWINDOWPOS3IPROC>("glWindowPos3i", Null_glWindowPos3i, Lazy_glWindowPos3i)),
+		WindowPos3iv(GetProc<PFNGLWINDOWPOS3IVPROC>("glWindowPos3iv", Null_glWindowPos3iv, Lazy_glWindowPos3iv)),
+		WindowPos3s(GetProc<PFNGLWINDOWPOS3SPROC>("glWindowPos3s", Null_glWindowPos3s, Lazy_glWindowPos3s)),
+		WindowPos3sv(GetProc<PFNGLWINDOWPOS3SVPROC>("glWindowPos3sv", Null_glWindowPos3sv, Lazy_glWindowPos3sv)),
+		BlendColor(GetProc<PFNGLBLENDCOLORPROC>("glBlendColor", Null_glBlendColor, Lazy_glBlendColor)),
+		BlendEquation(GetProc<PFNGLBLENDEQUATIONPROC>("glBlendEquation", Null_glBlendEquation, Lazy_glBlendEquation))
 	{
 		Available = Ver_Major > 1 || (Ver_Major == 1 && (Ver_Minor > 4 || (Ver_Minor == 4 && Ver_Release >= 0)));
 	}
 
+	Version14::Version14(Func_GetProcAddress GetProcAddress):
+		Version14(GetProcAddress, LoadMode::Eager)
+	{
+	}
+
 
 	static void APIENTRY Null_glGenQueries (GLsizei n, GLuint* ids){ NullFuncPtr(); }
 	static void APIENTRY Null_glDeleteQueries (GLsizei n, const GLuint* ids){ NullFuncPtr(); }
@@ -468,31 +836,74 @@ namespace GL
 	static GLboolean APIENTRY Null_glUnmapBuffer (GLenum target){ NullFuncPtr(); return 0; }
 	static void APIENTRY Null_glGetBufferParameteriv (GLenum target, GLenum pname, GLint* params){ NullFuncPtr(); }
 	static void APIENTRY Null_glGetBufferPointerv (GLenum target, GLenum pname, void** params){ NullFuncPtr(); }
-	Version15::Version15(Func_GetProcAddress GetProcAddress):
-		Version14(GetProcAddress),
-		GenQueries(GetProc<PFNGLGENQUERIESPROC>("glGenQueries", Null_glGenQueries)),
-		DeleteQueries(GetProc<PFNGLDELETEQUERIESPROC>("glDeleteQueries", Null_glDeleteQueries)),
-		IsQuery(GetProc<PFNGLISQUERYPROC>("glIsQuery", Null_glIsQuery)),
-		BeginQuery(GetProc<PFNGLBEGINQUERYPROC>("glBeginQuery", Null_glBeginQuery)),
-		EndQuery(GetProc<PFNGLENDQUERYPROC>("glEndQuery", Null_glEndQuery)),
-		GetQueryiv(GetProc<PFNGLGETQUERYIVPROC>("glGetQueryiv", Null_glGetQueryiv)),
-		GetQueryObjectiv(GetProc<PFNGLGETQUERYOBJECTIVPROC>("glGetQueryObjectiv", Null_glGetQueryObjectiv)),
-		GetQueryObjectuiv(GetProc<PFNGLGETQUERYOBJECTUIVPROC>("glGetQueryObjectuiv", Null_glGetQueryObjectuiv)),
-		BindBuffer(GetProc<PFNGLBINDBUFFERPROC>("glBindBuffer", Null_glBindBuffer)),
-		DeleteBuffers(GetProc<PFNGLDELETEBUFFERSPROC>("glDeleteBuffers", Null_glDeleteBuffers)),
-		GenBuffers(GetProc<PFNGLGENBUFFERSPROC>("glGenBuffers", Null_glGenBuffers)),
-		IsBuffer(GetProc<PFNGLISBUFFERPROC>("glIsBuffer", Null_glIsBuffer)),
-		BufferData(GetProc<PFNGLBUFFERDATAPROC>("glBufferData", Null_glBufferData)),
-		BufferSubData(GetProc<PFNGLBUFFERSUBDATAPROC>("glBufferSubData", Null_glBufferSubData)),
-		GetBufferSubData(GetProc<PFNGLGETBUFFERSUBDATAPROC>("glGetBufferSubData", Null_glGetBufferSubData)),
-		MapBuffer(GetProc<PFNGLMAPBUFFERPROC>("glMapBuffer", Null_glMapBuffer)),
-		UnmapBuffer(GetProc<PFNGLUNMAPBUFFERPROC>("glUnmapBuffer", Null_glUnmapBuffer)),
-		GetBufferParameteriv(GetProc<PFNGLGETBUFFERPARAMETERIVPROC>("glGetBufferParameteriv", Null_glGetBufferParameteriv)),
-		GetBufferPointerv(GetProc<PFNGLGETBUFFERPOINTERVPROC>("glGetBufferPointerv", Null_glGetBufferPointerv))
+	static void Resolve_glGenQueries(Version46& c){ c.GenQueries = c.GetProc<decltype(c.GenQueries)>("glGenQueries", Null_glGenQueries); }
+	static void Resolve_glDeleteQueries(Version46& c){ c.DeleteQueries = c.GetProc<decltype(c.DeleteQueries)>("glDeleteQueries", Null_glDeleteQueries); }
+	static void Resolve_glIsQuery(Version46& c){ c.IsQuery = c.GetProc<decltype(c.IsQuery)>("glIsQuery", Null_glIsQuery); }
+	static void Resolve_glBeginQuery(Version46& c){ c.BeginQuery = c.GetProc<decltype(c.BeginQuery)>("glBeginQuery", Null_glBeginQuery); }
+	static void Resolve_glEndQuery(Version46& c){ c.EndQuery = c.GetProc<decltype(c.EndQuery)>("glEndQuery", Null_glEndQuery); }
+	static void Resolve_glGetQueryiv(Version46& c){ c.GetQueryiv = c.GetProc<decltype(c.GetQueryiv)>("glGetQueryiv", Null_glGetQueryiv); }
+	static void Resolve_glGetQueryObjectiv(Version46& c){ c.GetQueryObjectiv = c.GetProc<decltype(c.GetQueryObjectiv)>("glGetQueryObjectiv", Null_glGetQueryObjectiv); }
+	static void Resolve_glGetQueryObjectuiv(Version46& c){ c.GetQueryObjectuiv = c.GetProc<decltype(c.GetQueryObjectuiv)>("glGetQueryObjectuiv", Null_glGetQueryObjectuiv); }
+	static void Resolve_glBindBuffer(Version46& c){ c.BindBuffer = c.GetProc<decltype(c.BindBuffer)>("glBindBuffer", Null_glBindBuffer); }
+	static void Resolve_glDeleteBuffers(Version46& c){ c.DeleteBuffers = c.GetProc<decltype(c.DeleteBuffers)>("glDeleteBuffers", Null_glDeleteBuffers); }
+	static void Resolve_glGenBuffers(Version46& c){ c.GenBuffers = c.GetProc<decltype(c.GenBuffers)>("glGenBuffers", Null_glGenBuffers); }
+	static void Resolve_glIsBuffer(Version46& c){ c.IsBuffer = c.GetProc<decltype(c.IsBuffer)>("glIsBuffer", Null_glIsBuffer); }
+	static void Resolve_glBufferData(Version46& c){ c.BufferData = c.GetProc<decltype(c.BufferData)>("glBufferData", Null_glBufferData); }
+	static void Resolve_glBufferSubData(Version46& c){ c.BufferSubData = c.GetProc<decltype(c.BufferSubData)>("glBufferSubData", Null_glBufferSubData); }
+	static void Resolve_glGetBufferSubData(Version46& c){ c.GetBufferSubData = c.GetProc<decltype(c.GetBufferSubData)>("glGetBufferSubData", Null_glGetBufferSubData); }
+	static void Resolve_glMapBuffer(Version46& c){ c.MapBuffer = c.GetProc<decltype(c.MapBuffer)>("glMapBuffer", Null_glMapBuffer); }
+	static void Resolve_glUnmapBuffer(Version46& c){ c.UnmapBuffer = c.GetProc<decltype(c.UnmapBuffer)>("glUnmapBuffer", Null_glUnmapBuffer); }
+	static void Resolve_glGetBufferParameteriv(Version46& c){ c.GetBufferParameteriv = c.GetProc<decltype(c.GetBufferParameteriv)>("glGetBufferParameteriv", Null_glGetBufferParameteriv); }
+	static void Resolve_glGetBufferPointerv(Version46& c){ c.GetBufferPointerv = c.GetProc<decltype(c.GetBufferPointerv)>("glGetBufferPointerv", Null_glGetBufferPointerv); }
+	static void APIENTRY Lazy_glGenQueries (GLsizei n, GLuint* ids){ auto& c = ResolveLazy(Resolve_glGenQueries, [](const Version46& c){ return c.GenQueries == Lazy_glGenQueries; }); return c.GenQueries(n, ids); }
+	static void APIENTRY Lazy_glDeleteQueries (GLsizei n, const GLuint* ids){ auto& c = ResolveLazy(Resolve_glDeleteQueries, [](const Version46& c){ return c.DeleteQueries == Lazy_glDeleteQueries; }); return c.DeleteQueries(n, ids); }
+	static GLboolean APIENTRY Lazy_glIsQuery (GLuint id){ auto& c = ResolveLazy(Resolve_glIsQuery, [](const Version46& c){ return c.IsQuery == Lazy_glIsQuery; }); return c.IsQuery(id); }
+	static void APIENTRY Lazy_glBeginQuery (GLenum target, GLuint id){ auto& c = ResolveLazy(Resolve_glBeginQuery, [](const Version46& c){ return c.BeginQuery == Lazy_glBeginQuery; }); return c.BeginQuery(target, id); }
+	static void APIENTRY Lazy_glEndQuery (GLenum target){ auto& c = ResolveLazy(Resolve_glEndQuery, [](const Version46& c){ return c.EndQuery == Lazy_glEndQuery; }); return c.EndQuery(target); }
+	static void APIENTRY Lazy_glGetQueryiv (GLenum target, GLenum pname, GLint* params){ auto& c = ResolveLazy(Resolve_glGetQueryiv, [](const Version46& c){ return c.GetQueryiv == Lazy_glGetQueryiv; }); return c.GetQueryiv(target, pname, params); }
+	static void APIENTRY Lazy_glGetQueryObjectiv (GLuint id, GLenum pname, GLint* params){ auto& c = ResolveLazy(Resolve_glGetQueryObjectiv, [](const Version46& c){ return c.GetQueryObjectiv == Lazy_glGetQueryObjectiv; }); return c.GetQueryObjectiv(id, pname, params); }
+	static void APIENTRY Lazy_glGetQueryObjectuiv (GLuint id, GLenum pname, GLuint* params){ auto& c = ResolveLazy(Resolve_glGetQueryObjectuiv, [](const Version46& c){ return c.GetQueryObjectuiv == Lazy_glGetQueryObjectuiv; }); return c.GetQueryObjectuiv(id, pname, params); }
+	static void APIENTRY Lazy_glBindBuffer (GLenum target, GLuint buffer){ auto& c = ResolveLazy(Resolve_glBindBuffer, [](const Version46& c){ return c.BindBuffer == Lazy_glBindBuffer; }); return c.BindBuffer(target, buffer); }
+	static void APIENTRY Lazy_glDeleteBuffers (GLsizei n, const GLuint* buffers){ auto& c = ResolveLazy(Resolve_glDeleteBuffers, [](const Version46& c){ return c.DeleteBuffers == Lazy_glDeleteBuffers; }); return c.DeleteBuffers(n, buffers); }
+	static void APIENTRY Lazy_glGenBuffers (GLsizei n, GLuint* buffers){ auto& c = ResolveLazy(Resolve_glGenBuffers, [](const Version46& c){ return c.GenBuffers == Lazy_glGenBuffers; }); return c.GenBuffers(n, buffers); }
+	static GLboolean APIENTRY Lazy_glIsBuffer (GLuint buffer){ auto& c = ResolveLazy(Resolve_glIsBuffer, [](const Version46& c){ return c.IsBuffer == Lazy_glIsBuffer; }); return c.IsBuffer(buffer); }
+	static void APIENTRY Lazy_glBufferData (GLenum target, GLsizeiptr size, const void* data, GLenum usage){ auto& c = ResolveLazy(Resolve_glBufferData, [](const Version46& c){ return c.BufferData == Lazy_glBufferData; }); return c.BufferData(target, size, data, usage); }
+	static void APIENTRY Lazy_glBufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, const void* data){ auto& c = ResolveLazy(Resolve_glBufferSubData, [](const Version46& c){ return c.BufferSubData == Lazy_glBufferSubData; }); return c.BufferSubData(target, offset, size, data); }
+	static void APIENTRY Lazy_glGetBufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, void* data){ auto& c = ResolveLazy(Resolve_glGetBufferSubData, [](const Version46& c){ return c.GetBufferSubData == Lazy_glGetBufferSubData; }); return c.GetBufferSubData(target, offset, size, data); }
+	static void* APIENTRY Lazy_glMapBuffer (GLenum target, GLenum access){ auto& c = ResolveLazy(Resolve_glMapBuffer, [](const Version46& c){ return c.MapBuffer == Lazy_glMapBuffer; }); return c.MapBuffer(target, access); }
+	static GLboolean APIENTRY Lazy_glUnmapBuffer (GLenum target){ auto& c = ResolveLazy(Resolve_glUnmapBuffer, [](const Version46& c){ return c.UnmapBuffer == Lazy_glUnmapBuffer; }); return c.UnmapBuffer(target); }
+	static void APIENTRY Lazy_glGetBufferParameteriv (GLenum target, GLenum pname, GLint* params){ auto& c = ResolveLazy(Resolve_glGetBufferParameteriv, [](const Version46& c){ return c.GetBufferParameteriv == Lazy_glGetBufferParameteriv; }); return c.GetBufferParameteriv(target, pname, params); }
+	static void APIENTRY Lazy_glGetBufferPointerv (GLenum target, GLenum pname, void** params){ auto& c = ResolveLazy(Resolve_glGetBufferPointerv, [](const Version46& c){ return c.GetBufferPointerv == Lazy_glGetBufferPointerv; }); return c.GetBufferPointerv(target, pname, params); }
+	Version15::Version15(Func_GetProcAddress GetProcAddress, LoadMode Mode):
+		Version14(GetProcAddress, Mode),
+		GenQueries(GetProc<PFNGLGENQUERIESPROC>("glGenQueries", Null_glGenQueries, Lazy_glGenQueries)),
+		DeleteQueries(GetProc<PFNGLDELETEQUERIESPROC>("glDeleteQueries", Null_glDeleteQueries, Lazy_glDeleteQueries)),
+		IsQuery(GetProc<PFNGLISQUERYPROC>("glIsQuery", Null_glIsQuery, Lazy_glIsQuery)),
+		BeginQuery(GetProc<PFNGLBEGINQUERYPROC>("glBeginQuery", Null_glBeginQuery, Lazy_glBeginQuery)),
+		EndQuery(GetProc<PFNGLENDQUERYPROC>("glEndQuery", Null_glEndQuery, Lazy_glEndQuery)),
+		GetQueryiv(GetProc<PFNGLGETQUERYIVPROC>("glGetQueryiv", Null_glGetQueryiv, Lazy_glGetQueryiv)),
+		GetQueryObjectiv(GetProc<PFNGLGETQUERYOBJECTIVPROC>("glGetQueryObjectiv", Null_glGetQueryObjectiv, Lazy_glGetQueryObjectiv)),
+		GetQueryObjectuiv(GetProc<PFNGLGETQUERYOBJECTUIVPROC>("glGetQueryObjectuiv", Null_glGetQueryObjectuiv, Lazy_glGetQueryObjectuiv)),
+		BindBuffer(GetProc<PFNGLBINDBUFFERPROC>("glBindBuffer", Null_glBindBuffer, Lazy_glBindBuffer)),
+		DeleteBuffers(GetProc<PFNGLDELETEBUFFERSPROC>("glDeleteBuffers", Null_glDeleteBuffers, Lazy_glDeleteBuffers)),
+		GenBuffers(GetProc<PFNGLGENBUFFERSPROC>("glGenBuffers", Null_glGenBuffers, Lazy_glGenBuffers)),
+		IsBuffer(GetProc<PFNGLISBUFFERPROC>("glIsBuffer", Null_glIsBuffer, Lazy_glIsBuffer)),
+		BufferData(GetProc<PFNGLBUFFERDATAPROC>("glBufferData", Null_glBufferData, Lazy_glBufferData)),
+		BufferSubData(GetProc<PFNGLBUFFERSUBDATAPROC>("glBufferSubData", Null_glBufferSubData, Lazy_glBufferSubData)),
+		GetBufferSubData(GetProc<PFNGLGETBUFFERSUBDATAPROC>("glGetBufferSubData", Null_glGetBufferSubData, Lazy_glGetBufferSubData)),
+		MapBuffer(GetProc<PFNGLMAPBUFFERPROC>("glMapBuffer", Null_glMapBuffer, Lazy_glMapBuffer)),
+		UnmapBuffer(GetProc<PFNGLUNMAPBUFFERPROC>("glUnmapBuffer", Null_glUnmapBuffer, Lazy_glUnmapBuffer)),
+		GetBufferParameteriv(GetProc<PFNGLGETBUFFERPARAMETERIVPROC>("glGetBufferParameteriv", Null_glGetBufferParameteriv, Lazy_glGetBufferParameteriv)),
+		GetBufferPointerv(GetProc<PFNGLGETBUFFERPOINTERVPROC>("glGetBufferPointerv", Null_glGetBufferPointerv, Lazy_glGetBufferPointerv))
 	{
 		Available = Ver_Major > 1 || (Ver_Major == 1 && (Ver_Minor > 5 || (Ver_Minor == 5 && Ver_Release >= 0)));
 	}
 
+	Version15::Version15(Func_GetProcAddress GetProcAddress):
+		Version15(GetProcAddress, LoadMode::Eager)
+	{
+	}
+
 
 	static void APIENTRY Null_glBlendEquationSeparate (GLenum modeRGB, GLenum modeAlpha){ NullFuncPtr(); }
 	static void APIENTRY Null_glDrawBuffers (GLsizei n, const GLenum* bufs){ NullFuncPtr(); }
@@ -587,105 +998,296 @@ namespace GL
 	static void APIENTRY Null_glVertexAttrib4uiv (GLuint index, const GLuint* v){ NullFuncPtr(); }
 	static void APIENTRY Null_glVertexAttrib4usv (GLuint index, const GLushort* v){ NullFuncPtr(); }
 	static void APIENTRY Null_glVertexAttribPointer (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer){ NullFuncPtr(); }
-	Version20::Version20(Func_GetProcAddress GetProcAddress):
-		Version15(GetProcAddress),
-		BlendEquationSeparate(GetProc<PFNGLBLENDEQUATIONSEPARATEPROC>("glBlendEquationSeparate", Null_glBlendEquationSeparate)),
-		DrawBuffers(GetProc<PFNGLDRAWBUFFERSPROC>("glDrawBuffers", Null_glDrawBuffers)),
-		StencilOpSeparate(GetProc<PFNGLSTENCILOPSEPARATEPROC>("glStencilOpSeparate", Null_glStencilOpSeparate)),
-		StencilFuncSeparate(GetProc<PFNGLSTENCILFUNCSEPARATEPROC>("glStencilFuncSeparate", Null_glStencilFuncSeparate)),
-		StencilMaskSeparate(GetProc<PFNGLSTENCILMASKSEPARATEPROC>("glStencilMaskSeparate", Null_glStencilMaskSeparate)),
-		AttachShader(GetProc<PFNGLATTACHSHADERPROC>("glAttachShader", Null_glAttachShader)),
-		BindAttribLocation(GetProc<PFNGLBINDATTRIBLOCATIONPROC>("glBindAttribLocation", Null_glBindAttribLocation)),
-		CompileShader(GetProc<PFNGLCOMPILESHADERPROC>("glCompileShader", Null_glCompileShader)),
-		CreateProgram(GetProc<PFNGLCREATEPROGRAMPROC>("glCreateProgram", Null_glCreateProgram)),
-		CreateShader(GetProc<PFNGLCREATESHADERPROC>("glCreateShader", Null_glCreateShader)),
-		DeleteProgram(GetProc<PFNGLDELETEPROGRAMPROC>("glDeleteProgram", Null_glDeleteProgram)),
-		DeleteShader(GetProc<PFNGLDELETESHADERPROC>("glDeleteShader", Null_glDeleteShader)),
-		DetachShader(GetProc<PFNGLDETACHSHADERPROC>("glDetachShader", Null_glDetachShader)),
-		DisableVertexAttribArray(GetProc<PFNGLDISABLEVERTEXATTRIBARRAYPROC>("glDisableVertexAttribArray", Null_glDisableVertexAttribArray)),
-		EnableVertexAttribArray(GetProc<PFNGLENABLEVERTEXATTRIBARRAYPROC>("glEnableVertexAttribArray", Null_glEnableVertexAttribArray)),
-		GetActiveAttrib(GetProc<PFNGLGETACTIVEATTRIBPROC>("glGetActiveAttrib", Null_glGetActiveAttrib)),
-		GetActiveUniform(GetProc<PFNGLGETACTIVEUNIFORMPROC>("glGetActiveUniform", Null_glGetActiveUniform)),
-		GetAttachedShaders(GetProc<PFNGLGETATTACHEDSHADERSPROC>("glGetAttachedShaders", Null_glGetAttachedShaders)),
-		GetAttribLocation(GetProc<PFNGLGETATTRIBLOCATIONPROC>("glGetAttribLocation", Null_glGetAttribLocation)),
-		GetProgramiv(GetProc<PFNGLGETPROGRAMIVPROC>("glGetProgramiv", Null_glGetProgramiv)),
-		GetProgramInfoLog(GetProc<PFNGLGETPROGRAMINFOLOGPROC>("glGetProgramInfoLog", Null_glGetProgramInfoLog)),
-		GetShaderiv(GetProc<PFNGLGETSHADERIVPROC>("glGetShaderiv", Null_glGetShaderiv)),
-		GetShaderInfoLog(GetProc<PFNGLGETSHADERINFOLOGPROC>("glGetShaderInfoLog", Null_glGetShaderInfoLog)),
-		GetShaderSource(GetProc<PFNGLGETSHADERSOURCEPROC>("glGetShaderSource", Null_glGetShaderSource)),
-		GetUniformLocation(GetProc<PFNGLGETUNIFORMLOCATIONPROC>("glGetUniformLocation", Null_glGetUniformLocation)),
-		GetUniformfv(GetProc<PFNGLGETUNIFORMFVPROC>("glGetUniformfv", Null_glGetUniformfv)),
-		GetUniformiv(GetProc<PFNGLGETUNIFORMIVPROC>("glGetUniformiv", Null_glGetUniformiv)),
-		GetVertexAttribdv(GetProc<PFNGLGETVERTEXATTRIBDVPROC>("glGetVertexAttribdv", Null_glGetVertexAttribdv)),
-		GetVertexAttribfv(GetProc<PFNGLGETVERTEXATTRIBFVPROC>("glGetVertexAttribfv", Null_glGetVertexAttribfv)),
-		GetVertexAttribiv(GetProc<PFNGLGETVERTEXATTRIBIVPROC>("glGetVertexAttribiv", Null_glGetVertexAttribiv)),
-		GetVertexAttribPointerv(GetProc<PFNGLGETVERTEXATTRIBPOINTERVPROC>("glGetVertexAttribPointerv", Null_glGetVertexAttribPointerv)),
-		IsProgram(GetProc<PFNGLISPROGRAMPROC>("glIsProgram", Null_glIsProgram)),
-		IsShader(GetProc<PFNGLISSHADERPROC>("glIsShader", Null_glIsShader)),
-		LinkProgram(GetProc<PFNGLLINKPROGRAMPROC>("glLinkProgram", Null_glLinkProgram)),
-		ShaderSource(GetProc<PFNGLSHADERSOURCEPROC>("glShaderSource", Null_glShaderSource)),
-		UseProgram(GetProc<PFNGLUSEPROGRAMPROC>("glUseProgram", Null_glUseProgram)),
-		Uniform1f(GetProc<PFNGLUNIFORM1FPROC>("glUniform1f", Null_glUniform1f)),
-		Uniform2f(GetProc<PFNGLUNIFORM2FPROC>("glUniform2f", Null_glUniform2f)),
-		Uniform3f(GetProc<PFNGLUNIFORM3FPROC>("glUniform3f", Null_glUniform3f)),
-		Uniform4f(GetProc<PFNGLUNIFORM4FPROC>("glUniform4f", Null_glUniform4f)),
-		Uniform1i(GetProc<PFNGLUNIFORM1IPROC>("glUniform1i", Null_glUniform1i)),
-		Uniform2i(GetProc<PFNGLUNIFORM2IPROC>("glUniform2i", Null_glUniform2i)),
-		Uniform3i(GetProc<PFNGLUNIFORM3IPROC>("glUniform3i", Null_glUniform3i)),
-		Uniform4i(GetProc<PFNGLUNIFORM4IPROC>("glUniform4i", Null_glUniform4i)),
-		Uniform1fv(GetProc<PFNGLUNIFORM1FVPROC>("glUniform1fv", Null_glUniform1fv)),
-		Uniform2fv(GetProc<PFNGLUNIFORM2FVPROC>("glUniform2fv", Null_glUniform2fv)),
-		Uniform3fv(GetProc<PFNGLUNIFORM3FVPROC>("glUniform3fv", Null_glUniform3fv)),
-		Uniform4fv(GetProc<PFNGLUNIFORM4FVPROC>("glUniform4fv", Null_glUniform4fv)),
-		Uniform1iv(GetProc<PFNGLUNIFORM1IVPROC>("glUniform1iv", Null_glUniform1iv)),
-		Uniform2iv(GetProc<PFNGLUNIFORM2IVPROC>("glUniform2iv", Null_glUniform2iv)),
-		Uniform3iv(GetProc<PFNGLUNIFORM3IVPROC>("glUniform3iv", Null_glUniform3iv)),
-		Uniform4iv(GetProc<PFNGLUNIFORM4IVPROC>("glUniform4iv", Null_glUniform4iv)),
-		UniformMatrix2fv(GetProc<PFNGLUNIFORMMATRIX2FVPROC>("glUniformMatrix2fv", Null_glUniformMatrix2fv)),
-		UniformMatrix3fv(GetProc<PFNGLUNIFORMMATRIX3FVPROC>("glUniformMatrix3fv", Null_glUniformMatrix3fv)),
-		UniformMatrix4fv(GetProc<PFNGLUNIFORMMATRIX4FVPROC>("glUniformMatrix4fv", Null_glUniformMatrix4fv)),
-		ValidateProgram(GetProc<PFNGLVALIDATEPROGRAMPROC>("glValidateProgram", Null_glValidateProgram)),
-		VertexAttrib1d(GetProc<PFNGLVERTEXATTRIB1DPROC>("glVertexAttrib1d", Null_glVertexAttrib1d)),
-		VertexAttrib1dv(GetProc<PFNGLVERTEXATTRIB1DVPROC>("glVertexAttrib1dv", Null_glVertexAttrib1dv)),
-		VertexAttrib1f(GetProc<PFNGLVERTEXATTRIB1FPROC>("glVertexAttrib1f", Null_glVertexAttrib1f)),
-		VertexAttrib1fv(GetProc<PFNGLVERTEXATTRIB1FVPROC>("glVertexAttrib1fv", Null_glVertexAttrib1fv)),
-		VertexAttrib1s(GetProc<PFNGLVERTEXATTRIB1SPROC>("glVertexAttrib1s", Null_glVertexAttrib1s)),
-		VertexAttrib1sv(GetProc<PFNGLVERTEXATTRIB1SVPROC>("glVertexAttrib1sv", Null_glVertexAttrib1sv)),
-		VertexAttrib2d(GetProc<PFNGLVERTEXATTRIB2DPROC>("glVertexAttrib2d", Null_glVertexAttrib2d)),
-		VertexAttrib2dv(GetProc<PFNGLVERTEXATTRIB2DVPROC>("glVertexAttrib2dv", Null_glVertexAttrib2dv)),
-		VertexAttrib2f(GetProc<PFNGLVERTEXATTRIB2FPROC>("glVertexAttrib2f", Null_glVertexAttrib2f)),
-		VertexAttrib2fv(GetProc<PFNGLVERTEXATTRIB2FVPROC>("glVertexAttrib2fv", Null_glVertexAttrib2fv)),
-		VertexAttrib2s(GetProc<PFNGLVERTEXATTRIB2SPROC>("glVertexAttrib2s", Null_glVertexAttrib2s)),
-		VertexAttrib2sv(GetProc<PFNGLVERTEXATTRIB2SVPROC>("glVertexAttrib2sv", Null_glVertexAttrib2sv)),
-		VertexAttrib3d(GetProc<PFNGLVERTEXATTRIB3DPROC>("glVertexAttrib3d", Null_glVertexAttrib3d)),
-		VertexAttrib3dv(GetProc<PFNGLVERTEXATTRIB3DVPROC>("glVertexAttrib3dv", Null_glVertexAttrib3dv)),
-		VertexAttrib3f(GetProc<PFNGLVERTEXATTRIB3FPROC>("glVertexAttrib3f", Null_glVertexAttrib3f)),
-		VertexAttrib3fv(GetProc<PFNGLVERTEXATTRIB3FVPROC>("glVertexAttrib3fv", Null_glVertexAttrib3fv)),
-		VertexAttrib3s(GetProc<PFNGLVERTEXATTRIB3SPROC>("glVertexAttrib3s", Null_glVertexAttrib3s)),
-		VertexAttrib3sv(GetProc<PFNGLVERTEXATTRIB3SVPROC>("glVertexAttrib3sv", Null_glVertexAttrib3sv)),
-		VertexAttrib4Nbv(GetProc<PFNGLVERTEXATTRIB4NBVPROC>("glVertexAttrib4Nbv", Null_glVertexAttrib4Nbv)),
-		VertexAttrib4Niv(GetProc<PFNGLVERTEXATTRIB4NIVPROC>("glVertexAttrib4Niv", Null_glVertexAttrib4Niv)),
-		VertexAttrib4Nsv(GetProc<PFNGLVERTEXATTRIB4NSVPROC>("glVertexAttrib4Nsv", Null_glVertexAttrib4Nsv)),
-		VertexAttrib4Nub(GetProc<PFNGLVERTEXATTRIB4NUBPROC>("glVertexAttrib4Nub", Null_glVertexAttrib4Nub)),
-		VertexAttrib4Nubv(GetProc<PFNGLVERTEXATTRIB4NUBVPROC>("glVertexAttrib4Nubv", Null_glVertexAttrib4Nubv)),
-		VertexAttrib4Nuiv(GetProc<PFNGLVERTEXATTRIB4NUIVPROC>("glVertexAttrib4Nuiv", Null_glVertexAttrib4Nuiv)),
-		VertexAttrib4Nusv(GetProc<PFNGLVERTEXATTRIB4NUSVPROC>("glVertexAttrib4Nusv", Null_glVertexAttrib4Nusv)),
-		VertexAttrib4bv(GetProc<PFNGLVERTEXATTRIB4BVPROC>("glVertexAttrib4bv", Null_glVertexAttrib4bv)),
-		VertexAttrib4d(GetProc<PFNGLVERTEXATTRIB4DPROC>("glVertexAttrib4d", Null_glVertexAttrib4d)),
-		VertexAttrib4dv(GetProc<PFNGLVERTEXATTRIB4DVPROC>("glVertexAttrib4dv", Null_glVertexAttrib4dv)),
-		VertexAttrib4f(GetProc<PFNGLVERTEXATTRIB4FPROC>("glVertexAttrib4f", Null_glVertexAttrib4f)),
-		VertexAttrib4fv(GetProc<PFNGLVERTEXATTRIB4FVPROC>("glVertexAttrib4fv", Null_glVertexAttrib4fv)),
-		VertexAttrib4iv(GetProc<PFNGLVERTEXATTRIB4IVPROC>("glVertexAttrib4iv", Null_glVertexAttrib4iv)),
-		VertexAttrib4s(GetProc<PFNGLVERTEXATTRIB4SPROC>("glVertexAttrib4s", Null_glVertexAttrib4s)),
-		VertexAttrib4sv(GetProc<PFNGLVERTEXATTRIB4SVPROC>("glVertexAttrib4sv", Null_glVertexAttrib4sv)),
-		VertexAttrib4ubv(GetProc<PFNGLVERTEXATTRIB4UBVPROC>("glVertexAttrib4ubv", Null_glVertexAttrib4ubv)),
-		VertexAttrib4uiv(GetProc<PFNGLVERTEXATTRIB4UIVPROC>("glVertexAttrib4uiv", Null_glVertexAttrib4uiv)),
-		VertexAttrib4usv(GetProc<PFNGLVERTEXATTRIB4USVPROC>("glVertexAttrib4usv", Null_glVertexAttrib4usv)),
-		VertexAttribPointer(GetProc<PFNGLVERTEXATTRIBPOINTERPROC>("glVertexAttribPointer", Null_glVertexAttribPointer))
+	static void Resolve_glBlendEquationSeparate(Version46& c){ c.BlendEquationSeparate = c.GetProc<decltype(c.BlendEquationSeparate)>("glBlendEquationSeparate", Null_glBlendEquationSeparate); }
+	static void Resolve_glDrawBuffers(Version46& c){ c.DrawBuffers = c.GetProc<decltype(c.DrawBuffers)>("glDrawBuffers", Null_glDrawBuffers); }
+	static void Resolve_glStencilOpSeparate(Version46& c){ c.StencilOpSeparate = c.GetProc<decltype(c.StencilOpSeparate)>("glStencilOpSeparate", Null_glStencilOpSeparate); }
+	static void Resolve_glStencilFuncSeparate(Version46& c){ c.StencilFuncSeparate = c.GetProc<decltype(c.StencilFuncSeparate)>("glStencilFuncSeparate", Null_glStencilFuncSeparate); }
+	static void Resolve_glStencilMaskSeparate(Version46& c){ c.StencilMaskSeparate = c.GetProc<decltype(c.StencilMaskSeparate)>("glStencilMaskSeparate", Null_glStencilMaskSeparate); }
+	static void Resolve_glAttachShader(Version46& c){ c.AttachShader = c.GetProc<decltype(c.AttachShader)>("glAttachShader", Null_glAttachShader); }
+	static void Resolve_glBindAttribLocation(Version46& c){ c.BindAttribLocation = c.GetProc<decltype(c.BindAttribLocation)>("glBindAttribLocation", Null_glBindAttribLocation); }
+	static void Resolve_glCompileShader(Version46& c){ c.CompileShader = c.GetProc<decltype(c.CompileShader)>("glCompileShader", Null_glCompileShader); }
+	static void Resolve_glCreateProgram(Version46& c){ c.CreateProgram = c.GetProc<decltype(c.CreateProgram)>("glCreateProgram", Null_glCreateProgram); }
+	static void Resolve_glCreateShader(Version46& c){ c.CreateShader = c.GetProc<decltype(c.CreateShader)>("glCreateShader", Null_glCreateShader); }
+	static void Resolve_glDeleteProgram(Version46& c){ c.DeleteProgram = c.GetProc<decltype(c.DeleteProgram)>("glDeleteProgram", Null_glDeleteProgram); }
+	static void Resolve_glDeleteShader(Version46& c){ c.DeleteShader = c.GetProc<decltype(c.DeleteShader)>("glDeleteShader", Null_glDeleteShader); }
+	static void Resolve_glDetachShader(Version46& c){ c.DetachShader = c.GetProc<decltype(c.DetachShader)>("glDetachShader", Null_glDetachShader); }
+	static void Resolve_glDisableVertexAttribArray(Version46& c){ c.DisableVertexAttribArray = c.GetProc<decltype(c.DisableVertexAttribArray)>("glDisableVertexAttribArray", Null_glDisableVertexAttribArray); }
+	static void Resolve_glEnableVertexAttribArray(Version46& c){ c.EnableVertexAttribArray = c.GetProc<decltype(c.EnableVertexAttribArray)>("glEnableVertexAttribArray", Null_glEnableVertexAttribArray); }
+	static void Resolve_glGetActiveAttrib(Version46& c){ c.GetActiveAttrib = c.GetProc<decltype(c.GetActiveAttrib)>("glGetActiveAttrib", Null_glGetActiveAttrib); }
+	static void Resolve_glGetActiveUniform(Version46& c){ c.GetActiveUniform = c.GetProc<decltype(c.GetActiveUniform)>("glGetActiveUniform", Null_glGetActiveUniform); }
+	static void Resolve_glGetAttachedShaders(Version46& c){ c.GetAttachedShaders = c.GetProc<decltype(c.GetAttachedShaders)>("glGetAttachedShaders", Null_glGetAttachedShaders); }
+	static void Resolve_glGetAttribLocation(Version46& c){ c.GetAttribLocation = c.GetProc<decltype(c.GetAttribLocation)>("glGetAttribLocation", Null_glGetAttribLocation); }
+	static void Resolve_glGetProgramiv(Version46& c){ c.GetProgramiv = c.GetProc<decltype(c.GetProgramiv)>("glGetProgramiv", Null_glGetProgramiv); }
+	static void Resolve_glGetProgramInfoLog(Version46& c){ c.GetProgramInfoLog = c.GetProc<decltype(c.GetProgramInfoLog)>("glGetProgramInfoLog", Null_glGetProgramInfoLog); }
+	static void Resolve_glGetShaderiv(Version46& c){ c.GetShaderiv = c.GetProc<decltype(c.GetShaderiv)>("glGetShaderiv", Null_glGetShaderiv); }
+	static void Resolve_glGetShaderInfoLog(Version46& c){ c.GetShaderInfoLog = c.GetProc<decltype(c.GetShaderInfoLog)>("glGetShaderInfoLog", Null_glGetShaderInfoLog); }
+	static void Resolve_glGetShaderSource(Version46& c){ c.GetShaderSource = c.GetProc<decltype(c.GetShaderSource)>("glGetShaderSource", Null_glGetShaderSource); }
+	static void Resolve_glGetUniformLocation(Version46& c){ c.GetUniformLocation = c.GetProc<decltype(c.GetUniformLocation)>("glGetUniformLocation", Null_glGetUniformLocation); }
+	static void Resolve_glGetUniformfv(Version46& c){ c.GetUniformfv = c.GetProc<decltype(c.GetUniformfv)>("glGetUniformfv", Null_glGetUniformfv); }
+	static void Resolve_glGetUniformiv(Version46& c){ c.GetUniformiv = c.GetProc<decltype(c.GetUniformiv)>("glGetUniformiv", Null_glGetUniformiv); }
+	static void Resolve_glGetVertexAttribdv(Version46& c){ c.GetVertexAttribdv = c.GetProc<decltype(c.GetVertexAttribdv)>("glGetVertexAttribdv", Null_glGetVertexAttribdv); }
+	static void Resolve_glGetVertexAttribfv(Version46& c){ c.GetVertexAttribfv = c.GetProc<decltype(c.GetVertexAttribfv)>("glGetVertexAttribfv", Null_glGetVertexAttribfv); }
+	static void Resolve_glGetVertexAttribiv(Version46& c){ c.GetVertexAttribiv = c.GetProc<decltype(c.GetVertexAttribiv)>("glGetVertexAttribiv", Null_glGetVertexAttribiv); }
+	static void Resolve_glGetVertexAttribPointerv(Version46& c){ c.GetVertexAttribPointerv = c.GetProc<decltype(c.GetVertexAttribPointerv)>("glGetVertexAttribPointerv", Null_glGetVertexAttribPointerv); }
+	static void Resolve_glIsProgram(Version46& c){ c.IsProgram = c.GetProc<decltype(c.IsProgram)>("glIsProgram", Null_glIsProgram); }
+	static void Resolve_glIsShader(Version46& c){ c.IsShader = c.GetProc<decltype(c.IsShader)>("glIsShader", Null_glIsShader); }
+	static void Resolve_glLinkProgram(Version46& c){ c.LinkProgram = c.GetProc<decltype(c.LinkProgram)>("glLinkProgram", Null_glLinkProgram); }
+	static void Resolve_glShaderSource(Version46& c){ c.ShaderSource = c.GetProc<decltype(c.ShaderSource)>("glShaderSource", Null_glShaderSource); }
+	static void Resolve_glUseProgram(Version46& c){ c.UseProgram = c.GetProc<decltype(c.UseProgram)>("glUseProgram", Null_glUseProgram); }
+	static void Resolve_glUniform1f(Version46& c){ c.Uniform1f = c.GetProc<decltype(c.Uniform1f)>("glUniform1f", Null_glUniform1f); }
+	static void Resolve_glUniform2f(Version46& c){ c.Uniform2f = c.GetProc<decltype(c.Uniform2f)>("glUniform2f", Null_glUniform2f); }
+	static void Resolve_glUniform3f(Version46& c){ c.Uniform3f = c.GetProc<decltype(c.Uniform3f)>("glUniform3f", Null_glUniform3f); }
+	static void Resolve_glUniform4f(Version46& c){ c.Uniform4f = c.GetProc<decltype(c.Uniform4f)>("glUniform4f", Null_glUniform4f); }
+	static void Resolve_glUniform1i(Version46& c){ c.Uniform1i = c.GetProc<decltype(c.Uniform1i)>("glUniform1i", Null_glUniform1i); }
+	static void Resolve_glUniform2i(Version46& c){ c.Uniform2i = c.GetProc<decltype(c.Uniform2i)>("glUniform2i", Null_glUniform2i); }
+	static void Resolve_glUniform3i(Version46& c){ c.Uniform3i = c.GetProc<decltype(c.Uniform3i)>("glUniform3i", Null_glUniform3i); }
+	static void Resolve_glUniform4i(Version46& c){ c.Uniform4i = c.GetProc<decltype(c.Uniform4i)>("glUniform4i", Null_glUniform4i); }
+	static void Resolve_glUniform1fv(Version46& c){ c.Uniform1fv = c.GetProc<decltype(c.Uniform1fv)>("glUniform1fv", Null_glUniform1fv); }
+	static void Resolve_glUniform2fv(Version46& c){ c.Uniform2fv = c.GetProc<decltype(c.Uniform2fv)>("glUniform2fv", Null_glUniform2fv); }
+	static void Resolve_glUniform3fv(Version46& c){ c.Uniform3fv = c.GetProc<decltype(c.Uniform3fv)>("glUniform3fv", Null_glUniform3fv); }
+	static void Resolve_glUniform4fv(Version46& c){ c.Uniform4fv = c.GetProc<decltype(c.Uniform4fv)>("glUniform4fv", Null_glUniform4fv); }
+	static void Resolve_glUniform1iv(Version46& c){ c.Uniform1iv = c.GetProc<decltype(c.Uniform1iv)>("glUniform1iv", Null_glUniform1iv); }
+	static void Resolve_glUniform2iv(Version46& c){ c.Uniform2iv = c.GetProc<decltype(c.Uniform2iv)>("glUniform2iv", Null_glUniform2iv); }
+	static void Resolve_glUniform3iv(Version46& c){ c.Uniform3iv = c.GetProc<decltype(c.Uniform3iv)>("glUniform3iv", Null_glUniform3iv); }
+	static void Resolve_glUniform4iv(Version46& c){ c.Uniform4iv = c.GetProc<decltype(c.Uniform4iv)>("glUniform4iv", Null_glUniform4iv); }
+	static void Resolve_glUniformMatrix2fv(Version46& c){ c.UniformMatrix2fv = c.GetProc<decltype(c.UniformMatrix2fv)>("glUniformMatrix2fv", Null_glUniformMatrix2fv); }
+	static void Resolve_glUniformMatrix3fv(Version46& c){ c.UniformMatrix3fv = c.GetProc<decltype(c.UniformMatrix3fv)>("glUniformMatrix3fv", Null_glUniformMatrix3fv); }
+	static void Resolve_glUniformMatrix4fv(Version46& c){ c.UniformMatrix4fv = c.GetProc<decltype(c.UniformMatrix4fv)>("glUniformMatrix4fv", Null_glUniformMatrix4fv); }
+	static void Resolve_glValidateProgram(Version46& c){ c.ValidateProgram = c.GetProc<decltype(c.ValidateProgram)>("glValidateProgram", Null_glValidateProgram); }
+	static void Resolve_glVertexAttrib1d(Version46& c){ c.VertexAttrib1d = c.GetProc<decltype(c.VertexAttrib1d)>("glVertexAttrib1d", Null_glVertexAttrib1d); }
+	static void Resolve_glVertexAttrib1dv(Version46& c){ c.VertexAttrib1dv = c.GetProc<decltype(c.VertexAttrib1dv)>("glVertexAttrib1dv", Null_glVertexAttrib1dv); }
+	static void Resolve_glVertexAttrib1f(Version46& c){ c.VertexAttrib1f = c.GetProc<decltype(c.VertexAttrib1f)>("glVertexAttrib1f", Null_glVertexAttrib1f); }
+	static void Resolve_glVertexAttrib1fv(Version46& c){ c.VertexAttrib1fv = c.GetProc<decltype(c.VertexAttrib1fv)>("glVertexAttrib1fv", Null_glVertexAttrib1fv); }
+	static void Resolve_glVertexAttrib1s(Version46& c){ c.VertexAttrib1s = c.GetProc<decltype(c.VertexAttrib1s)>("glVertexAttrib1s", Null_glVertexAttrib1s); }
+	static void Resolve_glVertexAttrib1sv(Version46& c){ c.VertexAttrib1sv = c.GetProc<decltype(c.VertexAttrib1sv)>("glVertexAttrib1sv", Null_glVertexAttrib1sv); }
+	static void Resolve_glVertexAttrib2d(Version46& c){ c.VertexAttrib2d = c.GetProc<decltype(c.VertexAttrib2d)>("glVertexAttrib2d", Null_glVertexAttrib2d); }
+	static void Resolve_glVertexAttrib2dv(Version46& c){ c.VertexAttrib2dv = c.GetProc<decltype(c.VertexAttrib2dv)>("glVertexAttrib2dv", Null_glVertexAttrib2dv); }
+	static void Resolve_glVertexAttrib2f(Version46& c){ c.VertexAttrib2f = c.GetProc<decltype(c.VertexAttrib2f)>("glVertexAttrib2f", Null_glVertexAttrib2f); }
+	static void Resolve_glVertexAttrib2fv(Version46& c){ c.VertexAttrib2fv = c.GetProc<decltype(c.VertexAttrib2fv)>("glVertexAttrib2fv", Null_glVertexAttrib2fv); }
+	static void Resolve_glVertexAttrib2s(Version46& c){ c.VertexAttrib2s = c.GetProc<decltype(c.VertexAttrib2s)>("glVertexAttrib2s", Null_glVertexAttrib2s); }
+	static void Resolve_glVertexAttrib2sv(Version46& c){ c.VertexAttrib2sv = c.GetProc<decltype(c.VertexAttrib2sv)>("glVertexAttrib2sv", Null_glVertexAttrib2sv); }
+	static void Resolve_glVertexAttrib3d(Version46& c){ c.VertexAttrib3d = c.GetProc<decltype(c.VertexAttrib3d)>("glVertexAttrib3d", Null_glVertexAttrib3d); }
+	static void Resolve_glVertexAttrib3dv(Version46& c){ c.VertexAttrib3dv = c.GetProc<decltype(c.VertexAttrib3dv)>("glVertexAttrib3dv", Null_glVertexAttrib3dv); }
+	static void Resolve_glVertexAttrib3f(Version46& c){ c.VertexAttrib3f = c.GetProc<decltype(c.VertexAttrib3f)>("glVertexAttrib3f", Null_glVertexAttrib3f); }
+	static void Resolve_glVertexAttrib3fv(Version46& c){ c.VertexAttrib3fv = c.GetProc<decltype(c.VertexAttrib3fv)>("glVertexAttrib3fv", Null_glVertexAttrib3fv); }
+	static void Resolve_glVertexAttrib3s(Version46& c){ c.VertexAttrib3s = c.GetProc<decltype(c.VertexAttrib3s)>("glVertexAttrib3s", Null_glVertexAttrib3s); }
+	static void Resolve_glVertexAttrib3sv(Version46& c){ c.VertexAttrib3sv = c.GetProc<decltype(c.VertexAttrib3sv)>("glVertexAttrib3sv", Null_glVertexAttrib3sv); }
+	static void Resolve_glVertexAttrib4Nbv(Version46& c){ c.VertexAttrib4Nbv = c.GetProc<decltype(c.VertexAttrib4Nbv)>("glVertexAttrib4Nbv", Null_glVertexAttrib4Nbv); }
+	static void Resolve_glVertexAttrib4Niv(Version46& c){ c.VertexAttrib4Niv = c.GetProc<decltype(c.VertexAttrib4Niv)>("glVertexAttrib4Niv", Null_glVertexAttrib4Niv); }
+	static void Resolve_glVertexAttrib4Nsv(Version46& c){ c.VertexAttrib4Nsv = c.GetProc<decltype(c.VertexAttrib4Nsv)>("glVertexAttrib4Nsv", Null_glVertexAttrib4Nsv); }
+	static void Resolve_glVertexAttrib4Nub(Version46& c){ c.VertexAttrib4Nub = c.GetProc<decltype(c.VertexAttrib4Nub)>("glVertexAttrib4Nub", Null_glVertexAttrib4Nub); }
+	static void Resolve_glVertexAttrib4Nubv(Version46& c){ c.VertexAttrib4Nubv = c.GetProc<decltype(c.VertexAttrib4Nubv)>("glVertexAttrib4Nubv", Null_glVertexAttrib4Nubv); }
+	static void Resolve_glVertexAttrib4Nuiv(Version46& c){ c.VertexAttrib4Nuiv = c.GetProc<decltype(c.VertexAttrib4Nuiv)>("glVertexAttrib4Nuiv", Null_glVertexAttrib4Nuiv); }
+	static void Resolve_glVertexAttrib4Nusv(Version46& c){ c.VertexAttrib4Nusv = c.GetProc<decltype(c.VertexAttrib4Nusv)>("glVertexAttrib4Nusv", Null_glVertexAttrib4Nusv); }
+	static void Resolve_glVertexAttrib4bv(Version46& c){ c.VertexAttrib4bv = c.GetProc<decltype(c.VertexAttrib4bv)>("glVertexAttrib4bv", Null_glVertexAttrib4bv); }
+	static void Resolve_glVertexAttrib4d(Version46& c){ c.VertexAttrib4d = c.GetProc<decltype(c.VertexAttrib4d)>("glVertexAttrib4d", Null_glVertexAttrib4d); }
+	static void Resolve_glVertexAttrib4dv(Version46& c){ c.VertexAttrib4dv = c.GetProc<decltype(c.VertexAttrib4dv)>("glVertexAttrib4dv", Null_glVertexAttrib4dv); }
+	static void Resolve_glVertexAttrib4f(Version46& c){ c.VertexAttrib4f = c.GetProc<decltype(c.VertexAttrib4f)>("glVertexAttrib4f", Null_glVertexAttrib4f); }
+	static void Resolve_glVertexAttrib4fv(Version46& c){ c.VertexAttrib4fv = c.GetProc<decltype(c.VertexAttrib4fv)>("glVertexAttrib4fv", Null_glVertexAttrib4fv); }
+	static void Resolve_glVertexAttrib4iv(Version46& c){ c.VertexAttrib4iv = c.GetProc<decltype(c.VertexAttrib4iv)>("glVertexAttrib4iv", Null_glVertexAttrib4iv); }
+	static void Resolve_glVertexAttrib4s(Version46& c){ c.VertexAttrib4s = c.GetProc<decltype(c.VertexAttrib4s)>("glVertexAttrib4s", Null_glVertexAttrib4s); }
+	static void Resolve_glVertexAttrib4sv(Version46& c){ c.VertexAttrib4sv = c.GetProc<decltype(c.VertexAttrib4sv)>("glVertexAttrib4sv", Null_glVertexAttrib4sv); }
+	static void Resolve_glVertexAttrib4ubv(Version46& c){ c.VertexAttrib4ubv = c.GetProc<decltype(c.VertexAttrib4ubv)>("glVertexAttrib4ubv", Null_glVertexAttrib4ubv); }
+	static void Resolve_glVertexAttrib4uiv(Version46& c){ c.VertexAttrib4uiv = c.GetProc<decltype(c.VertexAttrib4uiv)>("glVertexAttrib4uiv", Null_glVertexAttrib4uiv); }
+	static void Resolve_glVertexAttrib4usv(Version46& c){ c.VertexAttrib4usv = c.GetProc<decltype(c.VertexAttrib4usv)>("glVertexAttrib4usv", Null_glVertexAttrib4usv); }
+	static void Resolve_glVertexAttribPointer(Version46& c){ c.VertexAttribPointer = c.GetProc<decltype(c.VertexAttribPointer)>("glVertexAttribPointer", Null_glVertexAttribPointer); }
+	static void APIENTRY Lazy_glBlendEquationSeparate (GLenum modeRGB, GLenum modeAlpha){ auto& c = ResolveLazy(Resolve_glBlendEquationSeparate, [](const Version46& c){ return c.BlendEquationSeparate == Lazy_glBlendEquationSeparate; }); return c.BlendEquationSeparate(modeRGB, modeAlpha); }
+	static void APIENTRY Lazy_glDrawBuffers (GLsizei n, const GLenum* bufs){ auto& c = ResolveLazy(Resolve_glDrawBuffers, [](const Version46& c){ return c.DrawBuffers == Lazy_glDrawBuffers; }); return c.DrawBuffers(n, bufs); }
+	static void APIENTRY Lazy_glStencilOpSeparate (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass){ auto& c = ResolveLazy(Resolve_glStencilOpSeparate, [](const Version46& c){ return c.StencilOpSeparate == Lazy_glStencilOpSeparate; }); return c.StencilOpSeparate(face, sfail, dpfail, dppass); }
+	static void APIENTRY Lazy_glStencilFuncSeparate (GLenum face, GLenum func, GLint ref, GLuint mask){ auto& c = ResolveLazy(Resolve_glStencilFuncSeparate, [](const Version46& c){ return c.StencilFuncSeparate == Lazy_glStencilFuncSeparate; }); return c.StencilFuncSeparate(face, func, ref, mask); }
+	static void APIENTRY Lazy_glStencilMaskSeparate (GLenum face, GLuint mask){ auto& c = ResolveLazy(Resolve_glStencilMaskSeparate, [](const Version46& c){ return c.StencilMaskSeparate == Lazy_glStencilMaskSeparate; }); return c.StencilMaskSeparate(face, mask); }
+	static void APIENTRY Lazy_glAttachShader (GLuint program, GLuint shader){ auto& c = ResolveLazy(Resolve_glAttachShader, [](const Version46& c){ return c.AttachShader == Lazy_glAttachShader; }); return c.AttachShader(program, shader); }
+	static void APIENTRY Lazy_glBindAttribLocation (GLuint program, GLuint index, const GLchar* name){ auto& c = ResolveLazy(Resolve_glBindAttribLocation, [](const Version46& c){ return c.BindAttribLocation == Lazy_glBindAttribLocation; }); return c.BindAttribLocation(program, index, name); }
+	static void APIENTRY Lazy_glCompileShader (GLuint shader){ auto& c = ResolveLazy(Resolve_glCompileShader, [](const Version46& c){ return c.CompileShader == Lazy_glCompileShader; }); return c.CompileShader(shader); }
+	static GLuint APIENTRY Lazy_glCreateProgram (void){ auto& c = ResolveLazy(Resolve_glCreateProgram, [](const Version46& c){ return c.CreateProgram == Lazy_glCreateProgram; }); return c.CreateProgram(); }
+	static GLuint APIENTRY Lazy_glCreateShader (GLenum type){ auto& c = ResolveLazy(Resolve_glCreateShader, [](const Version46& c){ return c.CreateShader == Lazy_glCreateShader; }); return c.CreateShader(type); }
+	static void APIENTRY Lazy_glDeleteProgram (GLuint program){ auto& c = ResolveLazy(Resolve_glDeleteProgram, [](const Version46& c){ return c.DeleteProgram == Lazy_glDeleteProgram; }); return c.DeleteProgram(program); }
+	static void APIENTRY Lazy_glDeleteShader (GLuint shader){ auto& c = ResolveLazy(Resolve_glDeleteShader, [](const Version46& c){ return c.DeleteShader == Lazy_glDeleteShader; }); return c.DeleteShader(shader); }
+	static void APIENTRY Lazy_glDetachShader (GLuint program, GLuint shader){ auto& c = ResolveLazy(Resolve_glDetachShader, [](const Version46& c){ return c.DetachShader == Lazy_glDetachShader; }); return c.DetachShader(program, shader); }
+	static void APIENTRY Lazy_glDisableVertexAttribArray (GLuint index){ auto& c = ResolveLazy(Resolve_glDisableVertexAttribArray, [](const Version46& c){ return c.DisableVertexAttribArray == Lazy_glDisableVertexAttribArray; }); return c.DisableVertexAttribArray(index); }
+	static void APIENTRY Lazy_glEnableVertexAttribArray (GLuint index){ auto& c = ResolveLazy(Resolve_glEnableVertexAttribArray, [](const Version46& c){ return c.EnableVertexAttribArray == Lazy_glEnableVertexAttribArray; }); return c.EnableVertexAttribArray(index); }
+	static void APIENTRY Lazy_glGetActiveAttrib (GLuint program, GLuint index, GLsizei bufSize, GLsizei* length, GLint* size, GLenum* type, GLchar* name){ auto& c = ResolveLazy(Resolve_glGetActiveAttrib, [](const Version46& c){ return c.GetActiveAttrib == Lazy_glGetActiveAttrib; }); return c.GetActiveAttrib(program, index, bufSize, length, size, type, name); }
+	static void APIENTRY Lazy_glGetActiveUniform (GLuint program, GLuint index, GLsizei bufSize, GLsizei* length, GLint* size, GLenum* type, GLchar* name){ auto& c = ResolveLazy(Resolve_glGetActiveUniform, [](const Version46& c){ return c.GetActiveUniform == Lazy_glGetActiveUniform; }); return c.GetActiveUniform(program, index, bufSize, length, size, type, name); }
+	static void APIENTRY Lazy_glGetAttachedShaders (GLuint program, GLsizei maxCount, GLsizei* count, GLuint* shaders){ auto& c = ResolveLazy(Resolve_glGetAttachedShaders, [](const Version46& c){ return c.GetAttachedShaders == Lazy_glGetAttachedShaders; }); return c.GetAttachedShaders(program, maxCount, count, shaders); }
+	static GLint APIENTRY Lazy_glGetAttribLocation (GLuint program, const GLchar* name){ auto& c = ResolveLazy(Resolve_glGetAttribLocation, [](const Version46& c){ return c.GetAttribLocation == Lazy_glGetAttribLocation; }); return c.GetAttribLocation(program, name); }
+	static void APIENTRY Lazy_glGetProgramiv (GLuint program, GLenum pname, GLint* params){ auto& c = ResolveLazy(Resolve_glGetProgramiv, [](const Version46& c){ return c.GetProgramiv == Lazy_glGetProgramiv; }); return c.GetProgramiv(program, pname, params); }
+	static void APIENTRY Lazy_glGetProgramInfoLog (GLuint program, GLsizei bufSize, GLsizei* length, GLchar* infoLog){ auto& c = ResolveLazy(Resolve_glGetProgramInfoLog, [](const Version46& c){ return c.GetProgramInfoLog == Lazy_glGetProgramInfoLog; }); return c.GetProgramInfoLog(program, bufSize, length, infoLog); }
+	static void APIENTRY Lazy_glGetShaderiv (GLuint shader, GLenum pname, GLint* params){ auto& c = ResolveLazy(Resolve_glGetShaderiv, [](const Version46& c){ return c.GetShaderiv == Lazy_glGetShaderiv; }); return c.GetShaderiv(shader, pname, params); }
+	static void APIENTRY Lazy_glGetShaderInfoLog (GLuint shader, GLsizei bufSize, GLsizei* length, GLchar* infoLog){ auto& c = ResolveLazy(Resolve_glGetShaderInfoLog, [](const Version46& c){ return c.GetShaderInfoLog == Lazy_glGetShaderInfoLog; }); return c.GetShaderInfoLog(shader, bufSize, length, infoLog); }
+	static void APIENTRY Lazy_glGetShaderSource (GLuint shader, GLsizei bufSize, GLsizei* length, GLchar* source){ auto& c = ResolveLazy(Resolve_glGetShaderSource, [](const Version46& c){ return c.GetShaderSource == Lazy_glGetShaderSource; }); return c.GetShaderSource(shader, bufSize, length, source); }
+	static GLint APIENTRY Lazy_glGetUniformLocation (GLuint program, const GLchar* name){ auto& c = ResolveLazy(Resolve_glGetUniformLocation, [](const Version46& c){ return c.GetUniformLocation == Lazy_glGetUniformLocation; }); return c.GetUniformLocation(program, name); }
+	static void APIENTRY Lazy_glGetUniformfv (GLuint program, GLint location, GLfloat* params){ auto& c = ResolveLazy(Resolve_glGetUniformfv, [](const Version46& c){ return c.GetUniformfv == Lazy_glGetUniformfv; }); return c.GetUniformfv(program, location, params); }
+	static void APIENTRY Lazy_glGetUniformiv (GLuint program, GLint location, GLint* params){ auto& c = ResolveLazy(Resolve_glGetUniformiv, [](const Version46& c){ return c.GetUniformiv == Lazy_glGetUniformiv; }); return c.GetUniformiv(program, location, params); }
+	static void APIENTRY Lazy_glGetVertexAttribdv (GLuint index, GLenum pname, GLdouble* params){ auto& c = ResolveLazy(Resolve_glGetVertexAttribdv, [](const Version46& c){ return c.GetVertexAttribdv == Lazy_glGetVertexAttribdv; }); return c.GetVertexAttribdv(index, pname, params); }
+	static void APIENTRY Lazy_glGetVertexAttribfv (GLuint index, GLenum pname, GLfloat* params){ auto& c = ResolveLazy(Resolve_glGetVertexAttribfv, [](const Version46& c){ return c.GetVertexAttribfv == Lazy_glGetVertexAttribfv; }); return c.GetVertexAttribfv(index, pname, params); }
+	static void APIENTRY Lazy_glGetVertexAttribiv (GLuint index, GLenum pname, GLint* params){ auto& c = ResolveLazy(Resolve_glGetVertexAttribiv, [](const Version46& c){ return c.GetVertexAttribiv == Lazy_glGetVertexAttribiv; }); return c.GetVertexAttribiv(index, pname, params); }
+	static void APIENTRY Lazy_glGetVertexAttribPointerv (GLuint index, GLenum pname, void** pointer){ auto& c = ResolveLazy(Resolve_glGetVertexAttribPointerv, [](const Version46& c){ return c.GetVertexAttribPointerv == Lazy_glGetVertexAttribPointerv; }); return c.GetVertexAttribPointerv(index, pname, pointer); }
+	static GLboolean APIENTRY Lazy_glIsProgram (GLuint program){ auto& c = ResolveLazy(Resolve_glIsProgram, [](const Version46& c){ return c.IsProgram == Lazy_glIsProgram; }); return c.IsProgram(program); }
+	static GLboolean APIENTRY Lazy_glIsShader (GLuint shader){ auto& c = ResolveLazy(Resolve_glIsShader, [](const Version46& c){ return c.IsShader == Lazy_glIsShader; }); return c.IsShader(shader); }
+	static void APIENTRY Lazy_glLinkProgram (GLuint program){ auto& c = ResolveLazy(Resolve_glLinkProgram, [](const Version46& c){ return c.LinkProgram == Lazy_glLinkProgram; }); return c.LinkProgram(program); }
+	static void APIENTRY Lazy_glShaderSource (GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length){ auto& c = ResolveLazy(Resolve_glShaderSource, [](const Version46& c){ return c.ShaderSource == Lazy_glShaderSource; }); return c.ShaderSource(shader, count, string, length); }
+	static void APIENTRY Lazy_glUseProgram (GLuint program){ auto& c = ResolveLazy(Resolve_glUseProgram, [](const Version46& c){ return c.UseProgram == Lazy_glUseProgram; }); return c.UseProgram(program); }
+	static void APIENTRY Lazy_glUniform1f (GLint location, GLfloat v0){ auto& c = ResolveLazy(Resolve_glUniform1f, [](const Version46& c){ return c.Uniform1f == Lazy_glUniform1f; }); return c.Uniform1f(location, v0); }
+	static void APIENTRY Lazy_glUniform2f (GLint location, GLfloat v0, GLfloat v1){ auto& c = ResolveLazy(Resolve_glUniform2f, [](const Version46& c){ return c.Uniform2f == Lazy_glUniform2f; }); return c.Uniform2f(location, v0, v1); }
+	static void APIENTRY Lazy_glUniform3f (GLint location, GLfloat v0, GLfloat v1, GLfloat v2){ auto& c = ResolveLazy(Resolve_glUniform3f, [](const Version46& c){ return c.Uniform3f == Lazy_glUniform3f; }); return c.Uniform3f(location, v0, v1, v2); }
+	static void APIENTRY Lazy_glUniform4f (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3){ auto& c = ResolveLazy(Resolve_glUniform4f, [](const Version46& c){ return c.Uniform4f == Lazy_glUniform4f; }); return c.Uniform4f(location, v0, v1, v2, v3); }
+	static void APIENTRY Lazy_glUniform1i (GLint location, GLint v0){ auto& c = ResolveLazy(Resolve_glUniform1i, [](const Version46& c){ return c.Uniform1i == Lazy_glUniform1i; }); return c.Uniform1i(location, v0); }
+	static void APIENTRY Lazy_glUniform2i (GLint location, GLint v0, GLint v1){ auto& c = ResolveLazy(Resolve_glUniform2i, [](const Version46& c){ return c.Uniform2i == Lazy_glUniform2i; }); return c.Uniform2i(location, v0, v1); }
+	static void APIENTRY Lazy_glUniform3i (GLint location, GLint v0, GLint v1, GLint v2){ auto& c = ResolveLazy(Resolve_glUniform3i, [](const Version46& c){ return c.Uniform3i == Lazy_glUniform3i; }); return c.Uniform3i(location, v0, v1, v2); }
+	static void APIENTRY Lazy_glUniform4i (GLint location, GLint v0, GLint v1, GLint v2, GLint v3){ auto& c = ResolveLazy(Resolve_glUniform4i, [](const Version46& c){ return c.Uniform4i == Lazy_glUniform4i; }); return c.Uniform4i(location, v0, v1, v2, v3); }
+	static void APIENTRY Lazy_glUniform1fv (GLint location, GLsizei count, const GLfloat* value){ auto& c = ResolveLazy(Resolve_glUniform1fv, [](const Version46& c){ return c.Uniform1fv == Lazy_glUniform1fv; }); return c.Uniform1fv(location, count, value); }
+	static void APIENTRY Lazy_glUniform2fv (GLint location, GLsizei count, const GLfloat* value){ auto& c = ResolveLazy(Resolve_glUniform2fv, [](const Version46& c){ return c.Uniform2fv == Lazy_glUniform2fv; }); return c.Uniform2fv(location, count, value); }
+	static void APIENTRY Lazy_glUniform3fv (GLint location, GLsizei count, const GLfloat* value){ auto& c = ResolveLazy(Resolve_glUniform3fv, [](const Version46& c){ return c.Uniform3fv == Lazy_glUniform3fv; }); return c.Uniform3fv(location, count, value); }
+	static void APIENTRY Lazy_glUniform4fv (GLint location, GLsizei count, const GLfloat* value){ auto& c = ResolveLazy(Resolve_glUniform4fv, [](const Version46& c){ return c.Uniform4fv == Lazy_glUniform4fv; }); return c.Uniform4fv(location, count, value); }
+	static void APIENTRY Lazy_glUniform1iv (GLint location, GLsizei count, const GLint* value){ auto& c = ResolveLazy(Resolve_glUniform1iv, [](const Version46& c){ return c.Uniform1iv == Lazy_glUniform1iv; }); return c.Uniform1iv(location, count, value); }
+	static void APIENTRY Lazy_glUniform2iv (GLint location, GLsizei count, const GLint* value){ auto& c = ResolveLazy(Resolve_glUniform2iv, [](const Version46& c){ return c.Uniform2iv == Lazy_glUniform2iv; }); return c.Uniform2iv(location, count, value); }
+	static void APIENTRY Lazy_glUniform3iv (GLint location, GLsizei count, const GLint* value){ auto& c = ResolveLazy(Resolve_glUniform3iv, [](const Version46& c){ return c.Uniform3iv == Lazy_glUniform3iv; }); return c.Uniform3iv(location, count, value); }
+	static void APIENTRY Lazy_glUniform4iv (GLint location, GLsizei count, const GLint* value){ auto& c = ResolveLazy(Resolve_glUniform4iv, [](const Version46& c){ return c.Uniform4iv == Lazy_glUniform4iv; }); return c.Uniform4iv(location, count, value); }
+	static void APIENTRY Lazy_glUniformMatrix2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value){ auto& c = ResolveLazy(Resolve_glUniformMatrix2fv, [](const Version46& c){ return c.UniformMatrix2fv == Lazy_glUniformMatrix2fv; }); return c.UniformMatrix2fv(location, count, transpose, value); }
+	static void APIENTRY Lazy_glUniformMatrix3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value){ auto& c = ResolveLazy(Resolve_glUniformMatrix3fv, [](const Version46& c){ return c.UniformMatrix3fv == Lazy_glUniformMatrix3fv; }); return c.UniformMatrix3fv(location, count, transpose, value); }
+	static void APIENTRY Lazy_glUniformMatrix4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value){ auto& c = ResolveLazy(Resolve_glUniformMatrix4fv, [](const Version46& c){ return c.UniformMatrix4fv == Lazy_glUniformMatrix4fv; }); return c.UniformMatrix4fv(location, count, transpose, value); }
+	static void APIENTRY Lazy_glValidateProgram (GLuint program){ auto& c = ResolveLazy(Resolve_glValidateProgram, [](const Version46& c){ return c.ValidateProgram == Lazy_glValidateProgram; }); return c.ValidateProgram(program); }
+	static void APIENTRY Lazy_glVertexAttrib1d (GLuint index, GLdouble x){ auto& c = ResolveLazy(Resolve_glVertexAttrib1d, [](const Version46& c){ return c.VertexAttrib1d == Lazy_glVertexAttrib1d; }); return c.VertexAttrib1d(index, x); }
+	static void APIENTRY Lazy_glVertexAttrib1dv (GLuint index, const GLdouble* v){ auto& c = ResolveLazy(Resolve_glVertexAttrib1dv, [](const Version46& c){ return c.VertexAttrib1dv == Lazy_glVertexAttrib1dv; }); return c.VertexAttrib1dv(index, v); }
+	static void APIENTRY Lazy_glVertexAttrib1f (GLuint index, GLfloat x){ auto& c = ResolveLazy(Resolve_glVertexAttrib1f, [](const Version46& c){ return c.VertexAttrib1f == Lazy_glVertexAttrib1f; }); return c.VertexAttrib1f(index, x); }
+	static void APIENTRY Lazy_glVertexAttrib1fv (GLuint index, const GLfloat* v){ auto& c = ResolveLazy(Resolve_glVertexAttrib1fv, [](const Version46& c){ return c.VertexAttrib1fv == Lazy_glVertexAttrib1fv; }); return c.VertexAttrib1fv(index, v); }
+	static void APIENTRY Lazy_glVertexAttrib1s (GLuint index, GLshort x){ auto& c = ResolveLazy(Resolve_glVertexAttrib1s, [](const Version46& c){ return c.VertexAttrib1s == Lazy_glVertexAttrib1s; }); return c.VertexAttrib1s(index, x); }
+	static void APIENTRY Lazy_glVertexAttrib1sv (GLuint index, const GLshort* v){ auto& c = ResolveLazy(Resolve_glVertexAttrib1sv, [](const Version46& c){ return c.VertexAttrib1sv == Lazy_glVertexAttrib1sv; }); return c.VertexAttrib1sv(index, v); }
+	static void APIENTRY Lazy_glVertexAttrib2d (GLuint index, GLdouble x, GLdouble y){ auto& c = ResolveLazy(Resolve_glVertexAttrib2d, [](const Version46& c){ return c.VertexAttrib2d == Lazy_glVertexAttrib2d; }); return c.VertexAttrib2d(index, x, y); }
+	static void APIENTRY Lazy_glVertexAttrib2dv (GLuint index, const GLdouble* v){ auto& c = ResolveLazy(Resolve_glVertexAttrib2dv, [](const Version46& c){ return c.VertexAttrib2dv == Lazy_glVertexAttrib2dv; }); return c.VertexAttrib2dv(index, v); }
+	static void APIENTRY Lazy_glVertexAttrib2f (GLuint index, GLfloat x, GLfloat y){ auto& c = ResolveLazy(Resolve_glVertexAttrib2f, [](const Version46& c){ return c.VertexAttrib2f == Lazy_glVertexAttrib2f; }); return c.VertexAttrib2f(index, x, y); }
+	static void APIENTRY Lazy_glVertexAttrib2fv (GLuint index, const GLfloat* v){ auto& c = ResolveLazy(Resolve_glVertexAttrib2fv, [](const Version46& c){ return c.VertexAttrib2fv == Lazy_glVertexAttrib2fv; }); return c.VertexAttrib2fv(index, v); }
+	static void APIENTRY Lazy_glVertexAttrib2s (GLuint index, GLshort x, GLshort y){ auto& c = ResolveLazy(Resolve_glVertexAttrib2s, [](const Version46& c){ return c.VertexAttrib2s == Lazy_glVertexAttrib2s; }); return c.VertexAttrib2s(index, x, y); }
+	static void APIENTRY Lazy_glVertexAttrib2sv (GLuint index, const GLshort* v){ auto& c = ResolveLazy(Resolve_glVertexAttrib2sv, [](const Version46& c){ return c.VertexAttrib2sv == Lazy_glVertexAttrib2sv; }); return c.VertexAttrib2sv(index, v); }
+	static void APIENTRY Lazy_glVertexAttrib3d (GLuint index, GLdouble x, GLdouble y, GLdouble z){ auto& c = ResolveLazy(Resolve_glVertexAttrib3d, [](const Version46& c){ return c.VertexAttrib3d == Lazy_glVertexAttrib3d; }); return c.VertexAttrib3d(index, x, y, z); }
+	static void APIENTRY Lazy_glVertexAttrib3dv (GLuint index, const GLdouble* v){ auto& c = ResolveLazy(Resolve_glVertexAttrib3dv, [](const Version46& c){ return c.VertexAttrib3dv == Lazy_glVertexAttrib3dv; }); return c.VertexAttrib3dv(index, v); }
+	static void APIENTRY Lazy_glVertexAttrib3f (GLuint index, GLfloat x, GLfloat y, GLfloat z){ auto& c = ResolveLazy(Resolve_glVertexAttrib3f, [](const Version46& c){ return c.VertexAttrib3f == Lazy_glVertexAttrib3f; }); return c.VertexAttrib3f(index, x, y, z); }
+	static void APIENTRY Lazy_glVertexAttrib3fv (GLuint index, const GLfloat* v){ auto& c = ResolveLazy(Resolve_glVertexAttrib3fv, [](const Version46& c){ return c.VertexAttrib3fv == Lazy_glVertexAttrib3fv; }); return c.VertexAttrib3fv(index, v); }
+	static void APIENTRY Lazy_glVertexAttrib3s (GLuint index, GLshort x, GLshort y, GLshort z){ auto& c = ResolveLazy(Resolve_glVertexAttrib3s, [](const Version46& c){ return c.VertexAttrib3s == Lazy_glVertexAttrib3s; }); return c.VertexAttrib3s(index, x, y, z); }
+	static void APIENTRY Lazy_glVertexAttrib3sv (GLuint index, const GLshort* v){ auto& c = ResolveLazy(Resolve_glVertexAttrib3sv, [](const Version46& c){ return c.VertexAttrib3sv == Lazy_glVertexAttrib3sv; }); return c.VertexAttrib3sv(index, v); }
+	static void APIENTRY Lazy_glVertexAttrib4Nbv (GLuint index, const GLbyte* v){ auto& c = ResolveLazy(Resolve_glVertexAttrib4Nbv, [](const Version46& c){ return c.VertexAttrib4Nbv == Lazy_glVertexAttrib4Nbv; }); return c.VertexAttrib4Nbv(index, v); }
+	static void APIENTRY Lazy_glVertexAttrib4Niv (GLuint index, const GLint* v){ auto& c = ResolveLazy(Resolve_glVertexAttrib4Niv, [](const Version46& c){ return c.VertexAttrib4Niv == Lazy_glVertexAttrib4Niv; }); return c.VertexAttrib4Niv(index, v); }
+	static void APIENTRY Lazy_glVertexAttrib4Nsv (GLuint index, const GLshort* v){ auto& c = ResolveLazy(Resolve_glVertexAttrib4Nsv, [](const Version46& c){ return c.VertexAttrib4Nsv == Lazy_glVertexAttrib4Nsv; }); return c.VertexAttrib4Nsv(index, v); }
+	static void APIENTRY Lazy_glVertexAttrib4Nub (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w){ auto& c = ResolveLazy(Resolve_glVertexAttrib4Nub, [](const Version46& c){ return c.VertexAttrib4Nub == Lazy_glVertexAttrib4Nub; }); return c.VertexAttrib4Nub(index, x, y, z, w); }
+	static void APIENTRY Lazy_glVertexAttrib4Nubv (GLuint index, const GLubyte* v){ auto& c = ResolveLazy(Resolve_glVertexAttrib4Nubv, [](const Version46& c){ return c.VertexAttrib4Nubv == Lazy_glVertexAttrib4Nubv; }); return c.VertexAttrib4Nubv(index, v); }
+	static void APIENTRY Lazy_glVertexAttrib4Nuiv (GLuint index, const GLuint* v){ auto& c = ResolveLazy(Resolve_glVertexAttrib4Nuiv, [](const Version46& c){ return c.VertexAttrib4Nuiv == Lazy_glVertexAttrib4Nuiv; }); return c.VertexAttrib4Nuiv(index, v); }
+	static void APIENTRY Lazy_glVertexAttrib4Nusv (GLuint index, const GLushort* v){ auto& c = ResolveLazy(Resolve_glVertexAttrib4Nusv, [](const Version46& c){ return c.VertexAttrib4Nusv == Lazy_glVertexAttrib4Nusv; }); return c.VertexAttrib4Nusv(index, v); }
+	static void APIENTRY Lazy_glVertexAttrib4bv (GLuint index, const GLbyte* v){ auto& c = ResolveLazy(Resolve_glVertexAttrib4bv, [](const Version46& c){ return c.VertexAttrib4bv == Lazy_glVertexAttrib4bv; }); return c.VertexAttrib4bv(index, v); }
+	static void APIENTRY Lazy_glVertexAttrib4d (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w){ auto& c = ResolveLazy(Resolve_glVertexAttrib4d, [](const Version46& c){ return c.VertexAttrib4d == Lazy_glVertexAttrib4d; }); return c.VertexAttrib4d(index, x, y, z, w); }
+	static void APIENTRY Lazy_glVertexAttrib4dv (GLuint index, const GLdouble* v){ auto& c = ResolveLazy(Resolve_glVertexAttrib4dv, [](const Version46& c){ return c.VertexAttrib4dv == Lazy_glVertexAttrib4dv; }); return c.VertexAttrib4dv(index, v); }
+	static void APIENTRY Lazy_glVertexAttrib4f (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w){ auto& c = ResolveLazy(Resolve_glVertexAttrib4f, [](const Version46& c){ return c.VertexAttrib4f == Lazy_glVertexAttrib4f; }); return c.VertexAttrib4f(index, x, y, z, w); }
+	static void APIENTRY Lazy_glVertexAttrib4fv (GLuint index, const GLfloat* v){ auto& c = ResolveLazy(Resolve_glVertexAttrib4fv, [](const Version46& c){ return c.VertexAttrib4fv == Lazy_glVertexAttrib4fv; }); return c.VertexAttrib4fv(index, v); }
+	static void APIENTRY Lazy_glVertexAttrib4iv (GLuint index, const GLint* v){ auto& c = ResolveLazy(Resolve_glVertexAttrib4iv, [](const Version46& c){ return c.VertexAttrib4iv == Lazy_glVertexAttrib4iv; }); return c.VertexAttrib4iv(index, v); }
+	static void APIENTRY Lazy_glVertexAttrib4s (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w){ auto& c = ResolveLazy(Resolve_glVertexAttrib4s, [](const Version46& c){ return c.VertexAttrib4s == Lazy_glVertexAttrib4s; }); return c.VertexAttrib4s(index, x, y, z, w); }
+	static void APIENTRY Lazy_glVertexAttrib4sv (GLuint index, const GLshort* v){ auto& c = ResolveLazy(Resolve_glVertexAttrib4sv, [](const Version46& c){ return c.VertexAttrib4sv == Lazy_glVertexAttrib4sv; }); return c.VertexAttrib4sv(index, v); }
+	static void APIENTRY Lazy_glVertexAttrib4ubv (GLuint index, const GLubyte* v){ auto& c = ResolveLazy(Resolve_glVertexAttrib4ubv, [](const Version46& c){ return c.VertexAttrib4ubv == Lazy_glVertexAttrib4ubv; }); return c.VertexAttrib4ubv(index, v); }
+	static void APIENTRY Lazy_glVertexAttrib4uiv (GLuint index, const GLuint* v){ auto& c = ResolveLazy(Resolve_glVertexAttrib4uiv, [](const Version46& c){ return c.VertexAttrib4uiv == Lazy_glVertexAttrib4uiv; }); return c.VertexAttrib4uiv(index, v); }
+	static void APIENTRY Lazy_glVertexAttrib4usv (GLuint index, const GLushort* v){ auto& c = ResolveLazy(Resolve_glVertexAttrib4usv, [](const Version46& c){ return c.VertexAttrib4usv == Lazy_glVertexAttrib4usv; }); return c.VertexAttrib4usv(index, v); }
+	static void APIENTRY Lazy_glVertexAttribPointer (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer){ auto& c = ResolveLazy(Resolve_glVertexAttribPointer, [](const Version46& c){ return c.VertexAttribPointer == Lazy_glVertexAttribPointer; }); return c.VertexAttribPointer(index, size, type, normalized, stride, pointer); }
+	Version20::Version20(Func_GetProcAddress GetProcAddress, LoadMode Mode):
+		Version15(GetProcAddress, Mode),
+		BlendEquationSeparate(GetProc<PFNGLBLENDEQUATIONSEPARATEPROC>("glBlendEquationSeparate", Null_glBlendEquationSeparate, Lazy_glBlendEquationSeparate)),
+		DrawBuffers(GetProc<PFNGLDRAWBUFFERSPROC>("glDrawBuffers", Null_glDrawBuffers, Lazy_glDrawBuffers)),
+		StencilOpSeparate(GetProc<PFNGLSTENCILOPSEPARATEPROC>("glStencilOpSeparate", Null_glStencilOpSeparate, Lazy_glStencilOpSeparate)),
+		StencilFuncSeparate(GetProc<PFNGLSTENCILFUNCSEPARATEPROC>("glStencilFuncSeparate", Null_glStencilFuncSeparate, Lazy_glStencilFuncSeparate)),
+		StencilMaskSeparate(GetProc<PFNGLSTENCILMASKSEPARATEPROC>("glStencilMaskSeparate", Null_glStencilMaskSeparate, Lazy_glStencilMaskSeparate)),
+		AttachShader(GetProc<PFNGLATTACHSHADERPROC>("glAttachShader", Null_glAttachShader, Lazy_glAttachShader)),
+		BindAttribLocation(GetProc<PFNGLBINDATTRIBLOCATIONPROC>("glBindAttribLocation", Null_glBindAttribLocation, Lazy_glBindAttribLocation)),
+		CompileShader(GetProc<PFNGLCOMPILESHADERPROC>("glCompileShader", Null_glCompileShader, Lazy_glCompileShader)),
+		CreateProgram(GetProc<PFNGLCREATEPROGRAMPROC>("glCreateProgram", Null_glCreateProgram, Lazy_glCreateProgram)),
+		CreateShader(GetProc<PFNGLCREATESHADERPROC>("glCreateShader", Null_glCreateShader, Lazy_glCreateShader)),
+		DeleteProgram(GetProc<PFNGLDELETEPROGRAMPROC>("glDeleteProgram", Null_glDeleteProgram, Lazy_glDeleteProgram)),
+		DeleteShader(GetProc<PFNGLDELETESHADERPROC>("glDeleteShader", Null_glDeleteShader, Lazy_glDeleteShader)),
+		DetachShader(GetProc<PFNGLDETACHSHADERPROC>("glDetachShader", Null_glDetachShader, Lazy_glDetachShader)),
+		DisableVertexAttribArray(GetProc<PFNGLDISABLEVERTEXATTRIBARRAYPROC>("glDisableVertexAttribArray", Null_glDisableVertexAttribArray, Lazy_glDisableVertexAttribArray)),
+		EnableVertexAttribArray(GetProc<PFNGLENABLEVERTEXATTRIBARRAYPROC>("glEnableVertexAttribArray", Null_glEnableVertexAttribArray, Lazy_glEnableVertexAttribArray)),
+		GetActiveAttrib(GetProc<PFNGLGETACTIVEATTRIBPROC>("glGetActiveAttrib", Null_glGetActiveAttrib, Lazy_glGetActiveAttrib)),
+		GetActiveUniform(GetProc<PFNGLGETACTIVEUNIFORMPROC>("glGetActiveUniform", Null_glGetActiveUniform, Lazy_glGetActiveUniform)),
+		GetAttachedShaders(GetProc<PFNGLGETATTACHEDSHADERSPROC>("glGetAttachedShaders", Null_glGetAttachedShaders, Lazy_glGetAttachedShaders)),
+		GetAttribLocation(GetProc<PFNGLGETATTRIBLOCATIONPROC>("glGetAttribLocation", Null_glGetAttribLocation, Lazy_glGetAttribLocation)),
+		GetProgramiv(GetProc<PFNGLGETPROGRAMIVPROC>("glGetProgramiv", Null_glGetProgramiv, Lazy_glGetProgramiv)),
+		GetProgramInfoLog(GetProc<PFNGLGETPROGRAMINFOLOGPROC>("glGetProgramInfoLog", Null_glGetProgramInfoLog, Lazy_glGetProgramInfoLog)),
+		GetShaderiv(GetProc<PFNGLGETSHADERIVPROC>("glGetShaderiv", Null_glGetShaderiv, Lazy_glGetShaderiv)),
+		GetShaderInfoLog(GetProc<PFNGLGETSHADERINFOLOGPROC>("glGetShaderInfoLog", Null_glGetShaderInfoLog, Lazy_glGetShaderInfoLog)),
+		GetShaderSource(GetProc<PFNGLGETSHADERSOURCEPROC>("glGetShaderSource", Null_glGetShaderSource, Lazy_glGetShaderSource)),
+		GetUniformLocation(GetProc<PFNGLGETUNIFORMLOCATIONPROC>("glGetUniformLocation", Null_glGetUniformLocation, Lazy_glGetUniformLocation)),
+		GetUniformfv(GetProc<PFNGLGETUNIFORMFVPROC>("glGetUniformfv", Null_glGetUniformfv, Lazy_glGetUniformfv)),
+		GetUniformiv(GetProc<PFNGLGETUNIFORMIVPROC>("glGetUniformiv", Null_glGetUniformiv, Lazy_glGetUniformiv)),
+		GetVertexAttribdv(GetProc<PFNGLGETVERTEXATTRIBDVPROC>("glGetVertexAttribdv", Null_glGetVertexAttribdv, Lazy_glGetVertexAttribdv)),
+		GetVertexAttribfv(GetProc<PFNGLGETVERTEXATTRIBFVPROC>("glGetVertexAttribfv", Null_glGetVertexAttribfv, Lazy_glGetVertexAttribfv)),
+		GetVertexAttribiv(GetProc<PFNGLGETVERTEXATTRIBIVPROC>("glGetVertexAttribiv", Null_glGetVertexAttribiv, Lazy_glGetVertexAttribiv)),
+		GetVertexAttribPointerv(GetProc<PFNGLGETVERTEXATTRIBPOINTERVPROC>("glGetVertexAttribPointerv", Null_glGetVertexAttribPointerv, Lazy_glGetVertexAttribPointerv)),
+		IsProgram(GetProc<PFNGLISPROGRAMPROC>("glIsProgram", Null_glIsProgram, Lazy_glIsProgram)),
+		IsShader(GetProc<PFNGLISSHADERPROC>("glIsShader", Null_glIsShader, Lazy_glIsShader)),
+		LinkProgram(GetProc<PFNGLLINKPROGRAMPROC>("glLinkProgram", Null_glLinkProgram, Lazy_glLinkProgram)),
+		ShaderSource(GetProc<PFNGLSHADERSOURCEPROC>("glShaderSource", Null_glShaderSource, Lazy_glShaderSource)),
+		UseProgram(GetProc<PFNGLUSEPROGRAMPROC>("glUseProgram", Null_glUseProgram, Lazy_glUseProgram)),
+		Uniform1f(GetProc<PFNGLUNIFORM1FPROC>("glUniform1f", Null_glUniform1f, Lazy_glUniform1f)),
+		Uniform2f(GetProc<PFNGLUNIFORM2FPROC>("glUniform2f", Null_glUniform2f, Lazy_glUniform2f)),
+		Uniform3f(GetProc<PFNGLUNIFORM3FPROC>("glUniform3f", Null_glUniform3f, Lazy_glUniform3f)),
+		Uniform4f(GetProc<PFNGLUNIFORM4FPROC>("glUniform4f", Null_glUniform4f, Lazy_glUniform4f)),
+		Uniform1i(GetProc<PFNGLUNIFORM1IPROC>("glUniform1i", Null_glUniform1i, Lazy_glUniform1i)),
+		Uniform2i(GetProc<PFNGLUNIFORM2IPROC>("glUniform2i", Null_glUniform2i, Lazy_glUniform2i)),
+		Uniform3i(GetProc<PFNGLUNIFORM3IPROC>("glUniform3i", Null_glUniform3i, Lazy_glUniform3i)),
+		Uniform4i(GetProc<PFNGLUNIFORM4IPROC>("glUniform4i", Null_glUniform4i, Lazy_glUniform4i)),
+		Uniform1fv(GetProc<PFNGLUNIFORM1FVPROC>("glUniform1fv", Null_glUniform1fv, Lazy_glUniform1fv)),
+		Uniform2fv(GetProc<PFNGLUNIFORM2FVPROC>("glUniform2fv", Null_glUniform2fv, Lazy_glUniform2fv)),
+		Uniform3fv(GetProc<PFNGLUNIFORM3FVPROC>("glUniform3fv", Null_glUniform3fv, Lazy_glUniform3fv)),
+		Uniform4fv(GetProc<PFNGLUNIFORM4FVPROC>("glUniform4fv", Null_glUniform4fv, Lazy_glUniform4fv)),
+		Uniform1iv(GetProc<PFNGLUNIFORM1IVPROC>("glUniform1iv", Null_glUniform1iv, Lazy_glUniform1iv)),
+		Uniform2iv(GetProc<PFNGLUNIFORM2IVPROC>("glUniform2iv", Null_glUniform2iv, Lazy_glUniform2iv)),
+		Uniform3iv(GetProc<PFNGLUNIFORM3IVPROC>("glUniform3iv", Null_glUniform3iv, Lazy_glUniform3iv)),
+		Uniform4iv(GetProc<PFNGLUNIFORM4IVPROC>("glUniform4iv", Null_glUniform4iv, Lazy_glUniform4iv)),
+		UniformMatrix2fv(GetProc<PFNGLUNIFORMMATRIX2FVPROC>("glUniformMatrix2fv", Null_glUniformMatrix2fv, Lazy_glUniformMatrix2fv)),
+		UniformMatrix3fv(GetProc<PFNGLUNIFORMMATRIX3FVPROC>("glUniformMatrix3fv", Null_glUniformMatrix3fv, Lazy_glUniformMatrix3fv)),
+		UniformMatrix4fv(GetProc<PFNGLUNIFORMMATRIX4FVPROC>("glUniformMatrix4fv", Null_glUniformMatrix4fv, Lazy_glUniformMatrix4fv)),
+		ValidateProgram(GetProc<PFNGLVALIDATEPROGRAMPROC>("glValidateProgram", Null_glValidateProgram, Lazy_glValidateProgram)),
+		VertexAttrib1d(GetProc<PFNGLVERTEXATTRIB1DPROC>("glVertexAttrib1d", Null_glVertexAttrib1d, Lazy_glVertexAttrib1d)),
+		VertexAttrib1dv(GetProc<PFNGLVERTEXATTRIB1DVPROC>("glVertexAttrib1dv", Null_glVertexAttrib1dv, Lazy_glVertexAttrib1dv)),
+		VertexAttrib1f(GetProc<PFNGLVERTEXATTRIB1FPROC>("glVertexAttrib1f", Null_glVertexAttrib1f, Lazy_glVertexAttrib1f)),
+		VertexAttrib1fv(GetProc<PFNGLVERTEXATTRIB1FVPROC>("glVertexAttrib1fv", Null_glVertexAttrib1fv, Lazy_glVertexAttrib1fv)),
+		VertexAttrib1s(GetProc<PFNGLVERTEXATTRIB1SPROC>("glVertexAttrib1s", Null_glVertexAttrib1s, Lazy_glVertexAttrib1s)),
+		VertexAttrib1sv(GetProc<PFNGLVERTEXATTRIB1SVPROC>("glVertexAttrib1sv", Null_glVertexAttrib1sv, Lazy_glVertexAttrib1sv)),
+		VertexAttrib2d(GetProc<PFNGLVERTEXATTRIB2DPROC>("glVertexAttrib2d", Null_glVertexAttrib2d, Lazy_glVertexAttrib2d)),
+		VertexAttrib2dv(GetProc<PFNGLVERTEXATTRIB2DVPROC>("glVertexAttrib2dv", Null_glVertexAttrib2dv, Lazy_glVertexAttrib2dv)),
+		VertexAttrib2f(GetProc<PFNGLVERTEXATTRIB2FPROC>("glVertexAttrib2f", Null_glVertexAttrib2f, Lazy_glVertexAttrib2f)),
+		VertexAttrib2fv(GetProc<PFNGLVERTEXATTRIB2FVPROC>("glVertexAttrib2fv", Null_glVertexAttrib2fv, Lazy_glVertexAttrib2fv)),
+		VertexAttrib2s(GetProc<PFNGLVERTEXATTRIB2SPROC>("glVertexAttrib2s", Null_glVertexAttrib2s, Lazy_glVertexAttrib2s)),
+		VertexAttrib2sv(GetProc<PFNGLVERTEXATTRIB2SVPROC>("glVertexAttrib2sv", Null_glVertexAttrib2sv, Lazy_glVertexAttrib2sv)),
+		VertexAttrib3d(GetProc<PFNGLVERTEXATTRIB3DPROC>("glVertexAttrib3d", Null_glVertexAttrib3d, Lazy_glVertexAttrib3d)),
+		VertexAttrib3dv(GetProc<PFNGLVERTEXATTRIB3DVPROC>("glVertexAttrib3dv", Null_glVertexAttrib3dv, Lazy_glVertexAttrib3dv)),
+		VertexAttrib3f(GetProc<PFNGLVERTEXATTRIB3FPROC>("glVertexAttrib3f", Null_glVertexAttrib3f, Lazy_glVertexAttrib3f)),
+		VertexAttrib3fv(GetProc<PFNGLVERTEXATTRIB3FVPROC>("glVertexAttrib3fv", Null_glVertexAttrib3fv, Lazy_glVertexAttrib3fv)),
+		VertexAttrib3s(GetProc<PFNGLVERTEXATTRIB3SPROC>("glVertexAttrib3s", Null_glVertexAttrib3s, Lazy_glVertexAttrib3s)),
+		VertexAttrib3sv(GetProc<PFNGLVERTEXATTRIB3SVPROC>("glVertexAttrib3sv", Null_glVertexAttrib3sv, Lazy_glVertexAttrib3sv)),
+		VertexAttrib4Nbv(GetProc<PFNGLVERTEXATTRIB4NBVPROC>("glVertexAttrib4Nbv", Null_glVertexAttrib4Nbv, Lazy_glVertexAttrib4Nbv)),
+		VertexAttrib4Niv(GetProc<PFNGLVERTEXATTRIB4NIVPROC>("glVertexAttrib4Niv", Null_glVertexAttrib4Niv, Lazy_glVertexAttrib4Niv)),
+		VertexAttrib4Nsv(GetProc<PFNGLVERTEXATTRIB4NSVPROC>("glVertexAttrib4Nsv", Null_glVertexAttrib4Nsv, Lazy_glVertexAttrib4Nsv)),
+		VertexAttrib4Nub(GetProc<PFNGLVERTEXATTRIB4NUBPROC>("glVertexAttrib4Nub", Null_glVertexAttrib4Nub, Lazy_glVertexAttrib4Nub)),
+		VertexAttrib4Nubv(GetProc<PFNGLVERTEXATTRIB4NUBVPROC>("glVertexAttrib4Nubv", Null_glVertexAttrib4Nubv, Lazy_glVertexAttrib4Nubv)),
+		VertexAttrib4Nuiv(GetProc<PFNGLVERTEXATTRIB4NUIVPROC>("glVertexAttrib4Nuiv", Null_glVertexAttrib4Nuiv, Lazy_glVertexAttrib4Nuiv)),
+		VertexAttrib4Nusv(GetProc<PFNGLVERTEXATTRIB4NUSVPROC>("glVertexAttrib4Nusv", Null_glVertexAttrib4Nusv, Lazy_glVertexAttrib4Nusv)),
+		VertexAttrib4bv(GetProc<PFNGLVERTEXATTRIB4BVPROC>("glVertexAttrib4bv", Null_glVertexAttrib4bv, Lazy_glVertexAttrib4bv)),
+		VertexAttrib4d(GetProc<PFNGLVERTEXATTRIB4DPROC>("glVertexAttrib4d", Null_glVertexAttrib4d, Lazy_glVertexAttrib4d)),
+		VertexAttrib4dv(GetProc<PFNGLVERTEXATTRIB4DVPROC>("glVertexAttrib4dv", Null_glVertexAttrib4dv, Lazy_glVertexAttrib4dv)),
+		VertexAttrib4f(GetProc<PFNGLVERTEXATTRIB4FPROC>("glVertexAttrib4f", Null_glVertexAttrib4f, Lazy_glVertexAttrib4f)),
+		VertexAttrib4fv(GetProc<PFNGLVERTEXATTRIB4FVPROC>("glVertexAttrib4fv", Null_glVertexAttrib4fv, Lazy_glVertexAttrib4fv)),
+		VertexAttrib4iv(GetProc<PFNGLVERTEXATTRIB4IVPROC>("glVertexAttrib4iv", Null_glVertexAttrib4iv, Lazy_glVertexAttrib4iv)),
+		VertexAttrib4s(GetProc<PFNGLVERTEXATTRIB4SPROC>("glVertexAttrib4s", Null_glVertexAttrib4s, Lazy_glVertexAttrib4s)),
+		VertexAttrib4sv(GetProc<PFNGLVERTEXATTRIB4SVPROC>("glVertexAttrib4sv", Null_glVertexAttrib4sv, Lazy_glVertexAttrib4sv)),
+		VertexAttrib4ubv(GetProc<PFNGLVERTEXATTRIB4UBVPROC>("glVertexAttrib4ubv", Null_glVertexAttrib4ubv, Lazy_glVertexAttrib4ubv)),
+		VertexAttrib4uiv(GetProc<PFNGLVERTEXATTRIB4UIVPROC>("glVertexAttrib4uiv", Null_glVertexAttrib4uiv, Lazy_glVertexAttrib4uiv)),
+		VertexAttrib4usv(GetProc<PFNGLVERTEXATTRIB4USVPROC>("glVertexAttrib4usv", Null_glVertexAttrib4usv, Lazy_glVertexAttrib4usv)),
+		VertexAttribPointer(GetProc<PFNGLVERTEXATTRIBPOINTERPROC>("glVertexAttribPointer", Null_glVertexAttribPointer, Lazy_glVertexAttribPointer))
 	{
 		Available = Ver_Major > 2 || (Ver_Major == 2 && (Ver_Minor > 0 || (Ver_Minor == 0 && Ver_Release >= 0)));
 	}
 
+	Version20::Version20(Func_GetProcAddress GetProcAddress):
+		Version20(GetProcAddress, LoadMode::Eager)
+	{
+	}
+
 
 	static void APIENTRY Null_glUniformMatrix2x3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value){ NullFuncPtr(); }
 	static void APIENTRY Null_glUniformMatrix3x2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value){ NullFuncPtr(); }
@@ -693,18 +1295,35 @@ namespace GL
 	static void APIENTRY Null_glUniformMatrix4x2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value){ NullFuncPtr(); }
 	static void APIENTRY Null_glUniformMatrix3x4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value){ NullFuncPtr(); }
 	static void APIENTRY Null_glUniformMatrix4x3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value){ NullFuncPtr(); }
-	Version21::Version21(Func_GetProcAddress GetProcAddress):
-		Version20(GetProcAddress),
-		UniformMatrix2x3fv(GetProc<PFNGLUNIFORMMATRIX2X3FVPROC>("glUniformMatrix2x3fv", Null_glUniformMatrix2x3fv)),
-		UniformMatrix3x2fv(GetProc<PFNGLUNIFORMMATRIX3X2FVPROC>("glUniformMatrix3x2fv", Null_glUniformMatrix3x2fv)),
-		UniformMatrix2x4fv(GetProc<PFNGLUNIFORMMATRIX2X4FVPROC>("glUniformMatrix2x4fv", Null_glUniformMatrix2x4fv)),
-		UniformMatrix4x2fv(GetProc<PFNGLUNIFORMMATRIX4X2FVPROC>("glUniformMatrix4x2fv", Null_glUniformMatrix4x2fv)),
-		UniformMatrix3x4fv(GetProc<PFNGLUNIFORMMATRIX3X4FVPROC>("glUniformMatrix3x4fv", Null_glUniformMatrix3x4fv)),
-		UniformMatrix4x3fv(GetProc<PFNGLUNIFORMMATRIX4X3FVPROC>("glUniformMatrix4x3fv", Null_glUniformMatrix4x3fv))
+	static void Resolve_glUniformMatrix2x3fv(Version46& c){ c.UniformMatrix2x3fv = c.GetProc<decltype(c.UniformMatrix2x3fv)>("glUniformMatrix2x3fv", Null_glUniformMatrix2x3fv); }
+	static void Resolve_glUniformMatrix3x2fv(Version46& c){ c.UniformMatrix3x2fv = c.GetProc<decltype(c.UniformMatrix3x2fv)>("glUniformMatrix3x2fv", Null_glUniformMatrix3x2fv); }
+	static void Resolve_glUniformMatrix2x4fv(Version46& c){ c.UniformMatrix2x4fv = c.GetProc<decltype(c.UniformMatrix2x4fv)>("glUniformMatrix2x4fv", Null_glUniformMatrix2x4fv); }
+	static void Resolve_glUniformMatrix4x2fv(Version46& c){ c.UniformMatrix4x2fv = c.GetProc<decltype(c.UniformMatrix4x2fv)>("glUniformMatrix4x2fv", Null_glUniformMatrix4x2fv); }
+	static void Resolve_glUniformMatrix3x4fv(Version46& c){ c.UniformMatrix3x4fv = c.GetProc<decltype(c.UniformMatrix3x4fv)>("glUniformMatrix3x4fv", Null_glUniformMatrix3x4fv); }
+	static void Resolve_glUniformMatrix4x3fv(Version46& c){ c.UniformMatrix4x3fv = c.GetProc<decltype(c.UniformMatrix4x3fv)>("glUniformMatrix4x3fv", Null_glUniformMatrix4x3fv); }
+	static void APIENTRY Lazy_glUniformMatrix2x3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value){ auto& c = ResolveLazy(Resolve_glUniformMatrix2x3fv, [](const Version46& c){ return c.UniformMatrix2x3fv == Lazy_glUniformMatrix2x3fv; }); return c.UniformMatrix2x3fv(location, count, transpose, value); }
+	static void APIENTRY Lazy_glUniformMatrix3x2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value){ auto& c = ResolveLazy(Resolve_glUniformMatrix3x2fv, [](const Version46& c){ return c.UniformMatrix3x2fv == Lazy_glUniformMatrix3x2fv; }); return c.UniformMatrix3x2fv(location, count, transpose, value); }
+	static void APIENTRY Lazy_glUniformMatrix2x4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value){ auto& c = ResolveLazy(Resolve_glUniformMatrix2x4fv, [](const Version46& c){ return c.UniformMatrix2x4fv == Lazy_glUniformMatrix2x4fv; }); return c.UniformMatrix2x4fv(location, count, transpose, value); }
+	static void APIENTRY Lazy_glUniformMatrix4x2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value){ auto& c = ResolveLazy(Resolve_glUniformMatrix4x2fv, [](const Version46& c){ return c.UniformMatrix4x2fv == Lazy_glUniformMatrix4x2fv; }); return c.UniformMatrix4x2fv(location, count, transpose, value); }
+	static void APIENTRY Lazy_glUniformMatrix3x4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value){ auto& c = ResolveLazy(Resolve_glUniformMatrix3x4fv, [](const Version46& c){ return c.UniformMatrix3x4fv == Lazy_glUniformMatrix3x4fv; }); return c.UniformMatrix3x4fv(location, count, transpose, value); }
+	static void APIENTRY Lazy_glUniformMatrix4x3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value){ auto& c = ResolveLazy(Resolve_glUniformMatrix4x3fv, [](const Version46& c){ return c.UniformMatrix4x3fv == Lazy_glUniformMatrix4x3fv; }); return c.UniformMatrix4x3fv(location, count, transpose, value); }
+	Version21::Version21(Func_GetProcAddress GetProcAddress, LoadMode Mode):
+		Version20(GetProcAddress, Mode),
+		UniformMatrix2x3fv(GetProc<PFNGLUNIFORMMATRIX2X3FVPROC>("glUniformMatrix2x3fv", Null_glUniformMatrix2x3fv, Lazy_glUniformMatrix2x3fv)),
+		UniformMatrix3x2fv(GetProc<PFNGLUNIFORMMATRIX3X2FVPROC>("glUniformMatrix3x2fv", Null_glUniformMatrix3x2fv, Lazy_glUniformMatrix3x2fv)),
+		UniformMatrix2x4fv(GetProc<PFNGLUNIFORMMATRIX2X4FVPROC>("glUniformMatrix2x4fv", Null_glUniformMatrix2x4fv, Lazy_glUniformMatrix2x4fv)),
+		UniformMatrix4x2fv(GetProc<PFNGLUNIFORMMATRIX4X2FVPROC>("glUniformMatrix4x2fv", Null_glUniformMatrix4x2fv, Lazy_glUniformMatrix4x2fv)),
+		UniformMatrix3x4fv(GetProc<PFNGLUNIFORMMATRIX3X4FVPROC>("glUniformMatrix3x4fv", Null_glUniformMatrix3x4fv, Lazy_glUniformMatrix3x4fv)),
+		UniformMatrix4x3fv(GetProc<PFNGLUNIFORMMATRIX4X3FVPROC>("glUniformMatrix4x3fv", Null_glUniformMatrix4x3fv, Lazy_glUniformMatrix4x3fv))
 	{
 		Available = Ver_Major > 2 || (Ver_Major == 2 && (Ver_Minor > 1 || (Ver_Minor == 1 && Ver_Release >= 0)));
 	}
 
+	Version21::Version21(Func_GetProcAddress GetProcAddress):
+		Version21(GetProcAddress, LoadMode::Eager)
+	{
+	}
+
 
 	static void APIENTRY Null_glColorMaski (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a){ NullFuncPtr(); }
 	static void APIENTRY Null_glGetBooleani_v (GLenum target, GLuint index, GLboolean* data){ NullFuncPtr(); }
@@ -790,96 +1409,269 @@ namespace GL
 	static void APIENTRY Null_glDeleteVertexArrays (GLsizei n, const GLuint* arrays){ NullFuncPtr(); }
 	static void APIENTRY Null_glGenVertexArrays (GLsizei n, GLuint* arrays){ NullFuncPtr(); }
 	static GLboolean APIENTRY Null_glIsVertexArray (GLuint array){ NullFuncPtr(); return 0; }
-	Version30::Version30(Func_GetProcAddress GetProcAddress):
-		Version21(GetProcAddress),
-		ColorMaski(GetProc<PFNGLCOLORMASKIPROC>("glColorMaski", Null_glColorMaski)),
-		GetBooleani_v(GetProc<PFNGLGETBOOLEANI_VPROC>("glGetBooleani_v", Null_glGetBooleani_v)),
-		GetIntegeri_v(GetProc<PFNGLGETINTEGERI_VPROC>("glGetIntegeri_v", Null_glGetIntegeri_v)),
-		Enablei(GetProc<PFNGLENABLEIPROC>("glEnablei", Null_glEnablei)),
-		Disablei(GetProc<PFNGLDISABLEIPROC>("glDisablei", Null_glDisablei)),
-		IsEnabledi(GetProc<PFNGLISENABLEDIPROC>("glIsEnabledi", Null_glIsEnabledi)),
-		BeginTransformFeedback(GetProc<PFNGLBEGINTRANSFORMFEEDBACKPROC>("glBeginTransformFeedback", Null_glBeginTransformFeedback)),
-		EndTransformFeedback(GetProc<PFNGLENDTRANSFORMFEEDBACKPROC>("glEndTransformFeedback", Null_glEndTransformFeedback)),
-		BindBufferRange(GetProc<PFNGLBINDBUFFERRANGEPROC>("glBindBufferRange", Null_glBindBufferRange)),
-		BindBufferBase(GetProc<PFNGLBINDBUFFERBASEPROC>("glBindBufferBase", Null_glBindBufferBase)),
-		TransformFeedbackVaryings(GetProc<PFNGLTRANSFORMFEEDBACKVARYINGSPROC>("glTransformFeedbackVaryings", Null_glTransformFeedbackVaryings)),
-		GetTransformFeedbackVarying(GetProc<PFNGLGETTRANSFORMFEEDBACKVARYINGPROC>("glGetTransformFeedbackVarying", Null_glGetTransformFeedbackVarying)),
-		ClampColor(GetProc<PFNGLCLAMPCOLORPROC>("glClampColor", Null_glClampColor)),
-		BeginConditionalRender(GetProc<PFNGLBEGINCONDITIONALRENDERPROC>("glBeginConditionalRender", Null_glBeginConditionalRender)),
-		EndConditionalRender(GetProc<PFNGLENDCONDITIONALRENDERPROC>("glEndConditionalRender", Null_glEndConditionalRender)),
-		VertexAttribIPointer(GetProc<PFNGLVERTEXATTRIBIPOINTERPROC>("glVertexAttribIPointer", Null_glVertexAttribIPointer)),
-		GetVertexAttribIiv(GetProc<PFNGLGETVERTEXATTRIBIIVPROC>("glGetVertexAttribIiv", Null_glGetVertexAttribIiv)),
-		GetVertexAttribIuiv(GetProc<PFNGLGETVERTEXATTRIBIUIVPROC>("glGetVertexAttribIuiv", Null_glGetVertexAttribIuiv)),
-		VertexAttribI1i(GetProc<PFNGLVERTEXATTRIBI1IPROC>("glVertexAttribI1i", Null_glVertexAttribI1i)),
-		VertexAttribI2i(GetProc<PFNGLVERTEXATTRIBI2IPROC>("glVertexAttribI2i", Null_glVertexAttribI2i)),
-		VertexAttribI3i(GetProc<PFNGLVERTEXATTRIBI3IPROC>("glVertexAttribI3i", Null_glVertexAttribI3i)),
-		VertexAttribI4i(GetProc<PFNGLVERTEXATTRIBI4IPROC>("glVertexAttribI4i", Null_glVertexAttribI4i)),
-		VertexAttribI1ui(GetProc<PFNGLVERTEXATTRIBI1UIPROC>("glVertexAttribI1ui", Null_glVertexAttribI1ui)),
-		VertexAttribI2ui(GetProc<PFNGLVERTEXATTRIBI2UIPROC>("glVertexAttribI2ui", Null_glVertexAttribI2ui)),
-		VertexAttribI3ui(GetProc<PFNGLVERTEXATTRIBI3UIPROC>("glVertexAttribI3ui", Null_glVertexAttribI3ui)),
-		VertexAttribI4ui(GetProc<PFNGLVERTEXATTRIBI4UIPROC>("glVertexAttribI4ui", Null_glVertexAttribI4ui)),
-		VertexAttribI1iv(GetProc<PFNGLVERTEXATTRIBI1IVPROC>("glVertexAttribI1iv", Null_glVertexAttribI1iv)),
-		VertexAttribI2iv(GetProc<PFNGLVERTEXATTRIBI2IVPROC>("glVertexAttribI2iv", Null_glVertexAttribI2iv)),
-		VertexAttribI3iv(GetProc<PFNGLVERTEXATTRIBI3IVPROC>("glVertexAttribI3iv", Null_glVertexAttribI3iv)),
-		VertexAttribI4iv(GetProc<PFNGLVERTEXATTRIBI4IVPROC>("glVertexAttribI4iv", Null_glVertexAttribI4iv)),
-		VertexAttribI1uiv(GetProc<PFNGLVERTEXATTRIBI1UIVPROC>("glVertexAttribI1uiv", Null_glVertexAttribI1uiv)),
-		VertexAttribI2uiv(GetProc<PFNGLVERTEXATTRIBI2UIVPROC>("glVertexAttribI2uiv", Null_glVertexAttribI2uiv)),
-		VertexAttribI3uiv(GetProc<PFNGLVERTEXATTRIBI3UIVPROC>("glVertexAttribI3uiv", Null_glVertexAttribI3uiv)),
-		VertexAttribI4uiv(GetProc<PFNGLVERTEXATTRIBI4UIVPROC>("glVertexAttribI4uiv", Null_glVertexAttribI4uiv)),
-		VertexAttribI4bv(GetProc<PFNGLVERTEXATTRIBI4BVPROC>("glVertexAttribI4bv", Null_glVertexAttribI4bv)),
-		VertexAttribI4sv(GetProc<PFNGLVERTEXATTRIBI4SVPROC>("glVertexAttribI4sv", Null_glVertexAttribI4sv)),
-		VertexAttribI4ubv(GetProc<PFNGLVERTEXATTRIBI4UBVPROC>("glVertexAttribI4ubv", Null_glVertexAttribI4ubv)),
-		VertexAttribI4usv(GetProc<PFNGLVERTEXATTRIBI4USVPROC>("glVertexAttribI4usv", Null_glVertexAttribI4usv)),
-		GetUniformuiv(GetProc<PFNGLGETUNIFORMUIVPROC>("glGetUniformuiv", Null_glGetUniformuiv)),
-		BindFragDataLocation(GetProc<PFNGLBINDFRAGDATALOCATIONPROC>("glBindFragDataLocation", Null_glBindFragDataLocation)),
-		GetFragDataLocation(GetProc<PFNGLGETFRAGDATALOCATIONPROC>("glGetFragDataLocation", Null_glGetFragDataLocation)),
-		Uniform1ui(GetProc<PFNGLUNIFORM1UIPROC>("glUniform1ui", Null_glUniform1ui)),
-		Uniform2ui(GetProc<PFNGLUNIFORM2UIPROC>("glUniform2ui", Null_glUniform2ui)),
-		Uniform3ui(GetProc<PFNGLUNIFORM3UIPROC>("glUniform3ui", Null_glUniform3ui)),
-		Uniform4ui(GetProc<PFNGLUNIFORM4UIPROC>("glUniform4ui", Null_glUniform4ui)),
-		Uniform1uiv(GetProc<PFNGLUNIFORM1UIVPROC>("glUniform1uiv", Null_glUniform1uiv)),
-		Uniform2uiv(GetProc<PFNGLUNIFORM2UIVPROC>("glUniform2uiv", Null_glUniform2uiv)),
-		Uniform3uiv(GetProc<PFNGLUNIFORM3UIVPROC>("glUniform3uiv", Null_glUniform3uiv)),
-		Uniform4uiv(GetProc<PFNGLUNIFORM4UIVPROC>("glUniform4uiv", Null_glUniform4uiv)),
-		TexParameterIiv(GetProc<PFNGLTEXPARAMETERIIVPROC>("glTexParameterIiv", Null_glTexParameterIiv)),
-		TexParameterIuiv(GetProc<PFNGLTEXPARAMETERIUIVPROC>("glTexParameterIuiv", Null_glTexParameterIuiv)),
-		GetTexParameterIiv(GetProc<PFNGLGETTEXPARAMETERIIVPROC>("glGetTexParameterIiv", Null_glGetTexParameterIiv)),
-		GetTexParameterIuiv(GetProc<PFNGLGETTEXPARAMETERIUIVPROC>("glGetTexParameterIuiv", Null_glGetTexParameterIuiv)),
-		ClearBufferiv(GetProc<PFNGLCLEARBUFFERIVPROC>("glClearBufferiv", Null_glClearBufferiv)),
-		ClearBufferuiv(GetProc<PFNGLCLEARBUFFERUIVPROC>("glClearBufferuiv", Null_glClearBufferuiv)),
-		ClearBufferfv(GetProc<PFNGLCLEARBUFFERFVPROC>("glClearBufferfv", Null_glClearBufferfv)),
-		ClearBufferfi(GetProc<PFNGLCLEARBUFFERFIPROC>("glClearBufferfi", Null_glClearBufferfi)),
-		GetStringi(GetProc<PFNGLGETSTRINGIPROC>("glGetStringi", Null_glGetStringi)),
-		IsRenderbuffer(GetProc<PFNGLISRENDERBUFFERPROC>("glIsRenderbuffer", Null_glIsRenderbuffer)),
-		BindRenderbuffer(GetProc<PFNGLBINDRENDERBUFFERPROC>("glBindRenderbuffer", Null_glBindRenderbuffer)),
-		DeleteRenderbuffers(GetProc<PFNGLDELETERENDERBUFFERSPROC>("glDeleteRenderbuffers", Null_glDeleteRenderbuffers)),
-		GenRenderbuffers(GetProc<PFNGLGENRENDERBUFFERSPROC>("glGenRenderbuffers", Null_glGenRenderbuffers)),
-		RenderbufferStorage(GetProc<PFNGLRENDERBUFFERSTORAGEPROC>("glRenderbufferStorage", Null_glRenderbufferStorage)),
-		GetRenderbufferParameteriv(GetProc<PFNGLGETRENDERBUFFERPARAMETERIVPROC>("glGetRenderbufferParameteriv", Null_glGetRenderbufferParameteriv)),
-		IsFramebuffer(GetProc<PFNGLISFRAMEBUFFERPROC>("glIsFramebuffer", Null_glIsFramebuffer)),
-		BindFramebuffer(GetProc<PFNGLBINDFRAMEBUFFERPROC>("glBindFramebuffer", Null_glBindFramebuffer)),
-		DeleteFramebuffers(GetProc<PFNGLDELETEFRAMEBUFFERSPROC>("glDeleteFramebuffers", Null_glDeleteFramebuffers)),
-		GenFramebuffers(GetProc<PFNGLGENFRAMEBUFFERSPROC>("glGenFramebuffers", Null_glGenFramebuffers)),
-		CheckFramebufferStatus(GetProc<PFNGLCHECKFRAMEBUFFERSTATUSPROC>("glCheckFramebufferStatus", Null_glCheckFramebufferStatus)),
-		FramebufferTexture1D(GetProc<PFNGLFRAMEBUFFERTEXTURE1DPROC>("glFramebufferTexture1D", Null_glFramebufferTexture1D)),
-		FramebufferTexture2D(GetProc<PFNGLFRAMEBUFFERTEXTURE2DPROC>("glFramebufferTexture2D", Null_glFramebufferTexture2D)),
-		FramebufferTexture3D(GetProc<PFNGLFRAMEBUFFERTEXTURE3DPROC>("glFramebufferTexture3D", Null_glFramebufferTexture3D)),
-		FramebufferRenderbuffer(GetProc<PFNGLFRAMEBUFFERRENDERBUFFERPROC>("glFramebufferRenderbuffer", Null_glFramebufferRenderbuffer)),
-		GetFramebufferAttachmentParameteriv(GetProc<PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC>("glGetFramebufferAttachmentParameteriv", Null_glGetFramebufferAttachmentParameteriv)),
-		GenerateMipmap(GetProc<PFNGLGENERATEMIPMAPPROC>("glGenerateMipmap", Null_glGenerateMipmap)),
-		BlitFramebuffer(GetProc<PFNGLBLITFRAMEBUFFERPROC>("glBlitFramebuffer", Null_glBlitFramebuffer)),
-		RenderbufferStorageMultisample(GetProc<PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC>("glRenderbufferStorageMultisample", Null_glRenderbufferStorageMultisample)),
-		FramebufferTextureLayer(GetProc<PFNGLFRAMEBUFFERTEXTURELAYERPROC>("glFramebufferTextureLayer", Null_glFramebufferTextureLayer)),
-		MapBufferRange(GetProc<PFNGLMAPBUFFERRANGEPROC>("glMapBufferRange", Null_glMapBufferRange)),
-		FlushMappedBufferRange(GetProc<PFNGLFLUSHMAPPEDBUFFERRANGEPROC>("glFlushMappedBufferRange", Null_glFlushMappedBufferRange)),
-		BindVertexArray(GetProc<PFNGLBINDVERTEXARRAYPROC>("glBindVertexArray", Null_glBindVertexArray)),
-		DeleteVertexArrays(GetProc<PFNGLDELETEVERTEXARRAYSPROC>("glDeleteVertexArrays", Null_glDeleteVertexArrays)),
-		GenVertexArrays(GetProc<PFNGLGENVERTEXARRAYSPROC>("glGenVertexArrays", Null_glGenVertexArrays)),
-		IsVertexArray(GetProc<PFNGLISVERTEXARRAYPROC>("glIsVertexArray", Null_glIsVertexArray))
+	static void Resolve_glColorMaski(Version46& c){ c.ColorMaski = c.GetProc<decltype(c.ColorMaski)>("glColorMaski", Null_glColorMaski); }
+	static void Resolve_glGetBooleani_v(Version46& c){ c.GetBooleani_v = c.GetProc<decltype(c.GetBooleani_v)>("glGetBooleani_v", Null_glGetBooleani_v); }
+	static void Resolve_glGetIntegeri_v(Version46& c){ c.GetIntegeri_v = c.GetProc<decltype(c.GetIntegeri_v)>("glGetIntegeri_v", Null_glGetIntegeri_v); }
+	static void Resolve_glEnablei(Version46& c){ c.Enablei = c.GetProc<decltype(c.Enablei)>("glEnablei", Null_glEnablei); }
+	static void Resolve_glDisablei(Version46& c){ c.Disablei = c.GetProc<decltype(c.Disablei)>("glDisablei", Null_glDisablei); }
+	static void Resolve_glIsEnabledi(Version46& c){ c.IsEnabledi = c.GetProc<decltype(c.IsEnabledi)>("glIsEnabledi", Null_glIsEnabledi); }
+	static void Resolve_glBeginTransformFeedback(Version46& c){ c.BeginTransformFeedback = c.GetProc<decltype(c.BeginTransformFeedback)>("glBeginTransformFeedback", Null_glBeginTransformFeedback); }
+	static void Resolve_glEndTransformFeedback(Version46& c){ c.EndTransformFeedback = c.GetProc<decltype(c.EndTransformFeedback)>("glEndTransformFeedback", Null_glEndTransformFeedback); }
+	static void Resolve_glBindBufferRange(Version46& c){ c.BindBufferRange = c.GetProc<decltype(c.BindBufferRange)>("glBindBufferRange", Null_glBindBufferRange); }
+	static void Resolve_glBindBufferBase(Version46& c){ c.BindBufferBase = c.GetProc<decltype(c.BindBufferBase)>("glBindBufferBase", Null_glBindBufferBase); }
+	static void Resolve_glTransformFeedbackVaryings(Version46& c){ c.TransformFeedbackVaryings = c.GetProc<decltype(c.TransformFeedbackVaryings)>("glTransformFeedbackVaryings", Null_glTransformFeedbackVaryings); }
+	static void Resolve_glGetTransformFeedbackVarying(Version46& c){ c.GetTransformFeedbackVarying = c.GetProc<decltype(c.GetTransformFeedbackVarying)>("glGetTransformFeedbackVarying", Null_glGetTransformFeedbackVarying); }
+	static void Resolve_glClampColor(Version46& c){ c.ClampColor = c.GetProc<decltype(c.ClampColor)>("glClampColor", Null_glClampColor); }
+	static void Resolve_glBeginConditionalRender(Version46& c){ c.BeginConditionalRender = c.GetProc<decltype(c.BeginConditionalRender)>("glBeginConditionalRender", Null_glBeginConditionalRender); }
+	static void Resolve_glEndConditionalRender(Version46& c){ c.EndConditionalRender = c.GetProc<decltype(c.EndConditionalRender)>("glEndConditionalRender", Null_glEndConditionalRender); }
+	static void Resolve_glVertexAttribIPointer(Version46& c){ c.VertexAttribIPointer = c.GetProc<decltype(c.VertexAttribIPointer)>("glVertexAttribIPointer", Null_glVertexAttribIPointer); }
+	static void Resolve_glGetVertexAttribIiv(Version46& c){ c.GetVertexAttribIiv = c.GetProc<decltype(c.GetVertexAttribIiv)>("glGetVertexAttribIiv", Null_glGetVertexAttribIiv); }
+	static void Resolve_glGetVertexAttribIuiv(Version46& c){ c.GetVertexAttribIuiv = c.GetProc<decltype(c.GetVertexAttribIuiv)>("glGetVertexAttribIuiv", Null_glGetVertexAttribIuiv); }
+	static void Resolve_glVertexAttribI1i(Version46& c){ c.VertexAttribI1i = c.GetProc<decltype(c.VertexAttribI1i)>("glVertexAttribI1i", Null_glVertexAttribI1i); }
+	static void Resolve_glVertexAttribI2i(Version46& c){ c.VertexAttribI2i = c.GetProc<decltype(c.VertexAttribI2i)>("glVertexAttribI2i", Null_glVertexAttribI2i); }
+	static void Resolve_glVertexAttribI3i(Version46& c){ c.VertexAttribI3i = c.GetProc<decltype(c.VertexAttribI3i)>("glVertexAttribI3i", Null_glVertexAttribI3i); }
+	static void Resolve_glVertexAttribI4i(Version46& c){ c.VertexAttribI4i = c.GetProc<decltype(c.VertexAttribI4i)>("glVertexAttribI4i", Null_glVertexAttribI4i); }
+	static void Resolve_glVertexAttribI1ui(Version46& c){ c.VertexAttribI1ui = c.GetProc<decltype(c.VertexAttribI1ui)>("glVertexAttribI1ui", Null_glVertexAttribI1ui); }
+	static void Resolve_glVertexAttribI2ui(Version46& c){ c.VertexAttribI2ui = c.GetProc<decltype(c.VertexAttribI2ui)>("glVertexAttribI2ui", Null_glVertexAttribI2ui); }
+	static void Resolve_glVertexAttribI3ui(Version46& c){ c.VertexAttribI3ui = c.GetProc<decltype(c.VertexAttribI3ui)>("glVertexAttribI3ui", Null_glVertexAttribI3ui); }
+	static void Resolve_glVertexAttribI4ui(Version46& c){ c.VertexAttribI4ui = c.GetProc<decltype(c.VertexAttribI4ui)>("glVertexAttribI4ui", Null_glVertexAttribI4ui); }
+	static void Resolve_glVertexAttribI1iv(Version46& c){ c.VertexAttribI1iv = c.GetProc<decltype(c.VertexAttribI1iv)>("glVertexAttribI1iv", Null_glVertexAttribI1iv); }
+	static void Resolve_glVertexAttribI2iv(Version46& c){ c.VertexAttribI2iv = c.GetProc<decltype(c.VertexAttribI2iv)>("glVertexAttribI2iv", Null_glVertexAttribI2iv); }
+	static void Resolve_glVertexAttribI3iv(Version46& c){ c.VertexAttribI3iv = c.GetProc<decltype(c.VertexAttribI3iv)>("glVertexAttribI3iv", Null_glVertexAttribI3iv); }
+	static void Resolve_glVertexAttribI4iv(Version46& c){ c.VertexAttribI4iv = c.GetProc<decltype(c.VertexAttribI4iv)>("glVertexAttribI4iv", Null_glVertexAttribI4iv); }
+	static void Resolve_glVertexAttribI1uiv(Version46& c){ c.VertexAttribI1uiv = c.GetProc<decltype(c.VertexAttribI1uiv)>("glVertexAttribI1uiv", Null_glVertexAttribI1uiv); }
+	static void Resolve_glVertexAttribI2uiv(Version46& c){ c.VertexAttribI2uiv = c.GetProc<decltype(c.VertexAttribI2uiv)>("glVertexAttribI2uiv", Null_glVertexAttribI2uiv); }
+	static void Resolve_glVertexAttribI3uiv(Version46& c){ c.VertexAttribI3uiv = c.GetProc<decltype(c.VertexAttribI3uiv)>("glVertexAttribI3uiv", Null_glVertexAttribI3uiv); }
+	static void Resolve_glVertexAttribI4uiv(Version46& c){ c.VertexAttribI4uiv = c.GetProc<decltype(c.VertexAttribI4uiv)>("glVertexAttribI4uiv", Null_glVertexAttribI4uiv); }
+	static void Resolve_glVertexAttribI4bv(Version46& c){ c.VertexAttribI4bv = c.GetProc<decltype(c.VertexAttribI4bv)>("glVertexAttribI4bv", Null_glVertexAttribI4bv); }
+	static void Resolve_glVertexAttribI4sv(Version46& c){ c.VertexAttribI4sv = c.GetProc<decltype(c.VertexAttribI4sv)>("glVertexAttribI4sv", Null_glVertexAttribI4sv); }
+	static void Resolve_glVertexAttribI4ubv(Version46& c){ c.VertexAttribI4ubv = c.GetProc<decltype(c.VertexAttribI4ubv)>("glVertexAttribI4ubv", Null_glVertexAttribI4ubv); }
+	static void Resolve_glVertexAttribI4usv(Version46& c){ c.VertexAttribI4usv = c.GetProc<decltype(c.VertexAttribI4usv)>("glVertexAttribI4usv", Null_glVertexAttribI4usv); }
+	static void Resolve_glGetUniformuiv(Version46& c){ c.GetUniformuiv = c.GetProc<decltype(c.GetUniformuiv)>("glGetUniformuiv", Null_glGetUniformuiv); }
+	static void Resolve_glBindFragDataLocation(Version46& c){ c.BindFragDataLocation = c.GetProc<decltype(c.BindFragDataLocation)>("glBindFragDataLocation", Null_glBindFragDataLocation); }
+	static void Resolve_glGetFragDataLocation(Version46& c){ c.GetFragDataLocation = c.GetProc<decltype(c.GetFragDataLocation)>("glGetFragDataLocation", Null_glGetFragDataLocation); }
+	static void Resolve_glUniform1ui(Version46& c){ c.Uniform1ui = c.GetProc<decltype(c.Uniform1ui)>("glUniform1ui", Null_glUniform1ui); }
+	static void Resolve_glUniform2ui(Version46& c){ c.Uniform2ui = c.GetProc<decltype(c.Uniform2ui)>("glUniform2ui", Null_glUniform2ui); }
+	static void Resolve_glUniform3ui(Version46& c){ c.Uniform3ui = c.GetProc<decltype(c.Uniform3ui)>("glUniform3ui", Null_glUniform3ui); }
+	static void Resolve_glUniform4ui(Version46& c){ c.Uniform4ui = c.GetProc<decltype(c.Uniform4ui)>("glUniform4ui", Null_glUniform4ui); }
+	static void Resolve_glUniform1uiv(Version46& c){ c.Uniform1uiv = c.GetProc<decltype(c.Uniform1uiv)>("glUniform1uiv", Null_glUniform1uiv); }
+	static void Resolve_glUniform2uiv(Version46& c){ c.Uniform2uiv = c.GetProc<decltype(c.Uniform2uiv)>("glUniform2uiv", Null_glUniform2uiv); }
+	static void Resolve_glUniform3uiv(Version46& c){ c.Uniform3uiv = c.GetProc<decltype(c.Uniform3uiv)>("glUniform3uiv", Null_glUniform3uiv); }
+	static void Resolve_glUniform4uiv(Version46& c){ c.Uniform4uiv = c.GetProc<decltype(c.Uniform4uiv)>("glUniform4uiv", Null_glUniform4uiv); }
+	static void Resolve_glTexParameterIiv(Version46& c){ c.TexParameterIiv = c.GetProc<decltype(c.TexParameterIiv)>("glTexParameterIiv", Null_glTexParameterIiv); }
+	static void Resolve_glTexParameterIuiv(Version46& c){ c.TexParameterIuiv = c.GetProc<decltype(c.TexParameterIuiv)>("glTexParameterIuiv", Null_glTexParameterIuiv); }
+	static void Resolve_glGetTexParameterIiv(Version46& c){ c.GetTexParameterIiv = c.GetProc<decltype(c.GetTexParameterIiv)>("glGetTexParameterIiv", Null_glGetTexParameterIiv); }
+	static void Resolve_glGetTexParameterIuiv(Version46& c){ c.GetTexParameterIuiv = c.GetProc<decltype(c.GetTexParameterIuiv)>("glGetTexParameterIuiv", Null_glGetTexParameterIuiv); }
+	static void Resolve_glClearBufferiv(Version46& c){ c.ClearBufferiv = c.GetProc<decltype(c.ClearBufferiv)>("glClearBufferiv", Null_glClearBufferiv); }
+	static void Resolve_glClearBufferuiv(Version46& c){ c.ClearBufferuiv = c.GetProc<decltype(c.ClearBufferuiv)>("glClearBufferuiv", Null_glClearBufferuiv); }
+	static void Resolve_glClearBufferfv(Version46& c){ c.ClearBufferfv = c.GetProc<decltype(c.ClearBufferfv)>("glClearBufferfv", Null_glClearBufferfv); }
+	static void Resolve_glClearBufferfi(Version46& c){ c.ClearBufferfi = c.GetProc<decltype(c.ClearBufferfi)>("glClearBufferfi", Null_glClearBufferfi); }
+	static void Resolve_glGetStringi(Version46& c){ c.GetStringi = c.GetProc<decltype(c.GetStringi)>("glGetStringi", Null_glGetStringi); }
+	static void Resolve_glIsRenderbuffer(Version46& c){ c.IsRenderbuffer = c.GetProc<decltype(c.IsRenderbuffer)>("glIsRenderbuffer", Null_glIsRenderbuffer); }
+	static void Resolve_glBindRenderbuffer(Version46& c){ c.BindRenderbuffer = c.GetProc<decltype(c.BindRenderbuffer)>("glBindRenderbuffer", Null_glBindRenderbuffer); }
+	static void Resolve_glDeleteRenderbuffers(Version46& c){ c.DeleteRenderbuffers = c.GetProc<decltype(c.DeleteRenderbuffers)>("glDeleteRenderbuffers", Null_glDeleteRenderbuffers); }
+	static void Resolve_glGenRenderbuffers(Version46& c){ c.GenRenderbuffers = c.GetProc<decltype(c.GenRenderbuffers)>("glGenRenderbuffers", Null_glGenRenderbuffers); }
+	static void Resolve_glRenderbufferStorage(Version46& c){ c.RenderbufferStorage = c.GetProc<decltype(c.RenderbufferStorage)>("glRenderbufferStorage", Null_glRenderbufferStorage); }
+	static void Resolve_glGetRenderbufferParameteriv(Version46& c){ c.GetRenderbufferParameteriv = c.GetProc<decltype(c.GetRenderbufferParameteriv)>("glGetRenderbufferParameteriv", Null_glGetRenderbufferParameteriv); }
+	static void Resolve_glIsFramebuffer(Version46& c){ c.IsFramebuffer = c.GetProc<decltype(c.IsFramebuffer)>("glIsFramebuffer", Null_glIsFramebuffer); }
+	static void Resolve_glBindFramebuffer(Version46& c){ c.BindFramebuffer = c.GetProc<decltype(c.BindFramebuffer)>("glBindFramebuffer", Null_glBindFramebuffer); }
+	static void Resolve_glDeleteFramebuffers(Version46& c){ c.DeleteFramebuffers = c.GetProc<decltype(c.DeleteFramebuffers)>("glDeleteFramebuffers", Null_glDeleteFramebuffers); }
+	static void Resolve_glGenFramebuffers(Version46& c){ c.GenFramebuffers = c.GetProc<decltype(c.GenFramebuffers)>("glGenFramebuffers", Null_glGenFramebuffers); }
+	static void Resolve_glCheckFramebufferStatus(Version46& c){ c.CheckFramebufferStatus = c.GetProc<decltype(c.CheckFramebufferStatus)>("glCheckFramebufferStatus", Null_glCheckFramebufferStatus); }
+	static void Resolve_glFramebufferTexture1D(Version46& c){ c.FramebufferTexture1D = c.GetProc<decltype(c.FramebufferTexture1D)>("glFramebufferTexture1D", Null_glFramebufferTexture1D); }
+	static void Resolve_glFramebufferTexture2D(Version46& c){ c.FramebufferTexture2D = c.GetProc<decltype(c.FramebufferTexture2D)>("glFramebufferTexture2D", Null_glFramebufferTexture2D); }
+	static void Resolve_glFramebufferTexture3D(Version46& c){ c.FramebufferTexture3D = c.GetProc<decltype(c.FramebufferTexture3D)>("glFramebufferTexture3D", Null_glFramebufferTexture3D); }
+	static void Resolve_glFramebufferRenderbuffer(Version46& c){ c.FramebufferRenderbuffer = c.GetProc<decltype(c.FramebufferRenderbuffer)>("glFramebufferRenderbuffer", Null_glFramebufferRenderbuffer); }
+	static void Resolve_glGetFramebufferAttachmentParameteriv(Version46& c){ c.GetFramebufferAttachmentParameteriv = c.GetProc<decltype(c.GetFramebufferAttachmentParameteriv)>("glGetFramebufferAttachmentParameteriv", Null_glGetFramebufferAttachmentParameteriv); }
+	static void Resolve_glGenerateMipmap(Version46& c){ c.GenerateMipmap = c.GetProc<decltype(c.GenerateMipmap)>("glGenerateMipmap", Null_glGenerateMipmap); }
+	static void Resolve_glBlitFramebuffer(Version46& c){ c.BlitFramebuffer = c.GetProc<decltype(c.BlitFramebuffer)>("glBlitFramebuffer", Null_glBlitFramebuffer); }
+	static void Resolve_glRenderbufferStorageMultisample(Version46& c){ c.RenderbufferStorageMultisample = c.GetProc<decltype(c.RenderbufferStorageMultisample)>("glRenderbufferStorageMultisample", Null_glRenderbufferStorageMultisample); }
+	static void Resolve_glFramebufferTextureLayer(Version46& c){ c.FramebufferTextureLayer = c.GetProc<decltype(c.FramebufferTextureLayer)>("glFramebufferTextureLayer", Null_glFramebufferTextureLayer); }
+	static void Resolve_glMapBufferRange(Version46& c){ c.MapBufferRange = c.GetProc<decltype(c.MapBufferRange)>("glMapBufferRange", Null_glMapBufferRange); }
+	static void Resolve_glFlushMappedBufferRange(Version46& c){ c.FlushMappedBufferRange = c.GetProc<decltype(c.FlushMappedBufferRange)>("glFlushMappedBufferRange", Null_glFlushMappedBufferRange); }
+	static void Resolve_glBindVertexArray(Version46& c){ c.BindVertexArray = c.GetProc<decltype(c.BindVertexArray)>("glBindVertexArray", Null_glBindVertexArray); }
+	static void Resolve_glDeleteVertexArrays(Version46& c){ c.DeleteVertexArrays = c.GetProc<decltype(c.DeleteVertexArrays)>("glDeleteVertexArrays", Null_glDeleteVertexArrays); }
+	static void Resolve_glGenVertexArrays(Version46& c){ c.GenVertexArrays = c.GetProc<decltype(c.GenVertexArrays)>("glGenVertexArrays", Null_glGenVertexArrays); }
+	static void Resolve_glIsVertexArray(Version46& c){ c.IsVertexArray = c.GetProc<decltype(c.IsVertexArray)>("glIsVertexArray", Null_glIsVertexArray); }
+	static void APIENTRY Lazy_glColorMaski (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a){ auto& c = ResolveLazy(Resolve_glColorMaski, [](const Version46& c){ return c.ColorMaski == Lazy_glColorMaski; }); return c.ColorMaski(index, r, g, b, a); }
+	static void APIENTRY Lazy_glGetBooleani_v (GLenum target, GLuint index, GLboolean* data){ auto& c = ResolveLazy(Resolve_glGetBooleani_v, [](const Version46& c){ return c.GetBooleani_v == Lazy_glGetBooleani_v; }); return c.GetBooleani_v(target, index, data); }
+	static void APIENTRY Lazy_glGetIntegeri_v (GLenum target, GLuint index, GLint* data){ auto& c = ResolveLazy(Resolve_glGetIntegeri_v, [](const Version46& c){ return c.GetIntegeri_v == Lazy_glGetIntegeri_v; }); return c.GetIntegeri_v(target, index, data); }
+	static void APIENTRY Lazy_glEnablei (GLenum target, GLuint index){ auto& c = ResolveLazy(Resolve_glEnablei, [](const Version46& c){ return c.Enablei == Lazy_glEnablei; }); return c.Enablei(target, index); }
+	static void APIENTRY Lazy_glDisablei (GLenum target, GLuint index){ auto& c = ResolveLazy(Resolve_glDisablei, [](const Version46& c){ return c.Disablei == Lazy_glDisablei; }); return c.Disablei(target, index); }
+	static GLboolean APIENTRY Lazy_glIsEnabledi (GLenum target, GLuint index){ auto& c = ResolveLazy(Resolve_glIsEnabledi, [](const Version46& c){ return c.IsEnabledi == Lazy_glIsEnabledi; }); return c.IsEnabledi(target, index); }
+	static void APIENTRY Lazy_glBeginTransformFeedback (GLenum primitiveMode){ auto& c = ResolveLazy(Resolve_glBeginTransformFeedback, [](const Version46& c){ return c.BeginTransformFeedback == Lazy_glBeginTransformFeedback; }); return c.BeginTransformFeedback(primitiveMode); }
+	static void APIENTRY Lazy_glEndTransformFeedback (void){ auto& c = ResolveLazy(Resolve_glEndTransformFeedback, [](const Version46& c){ return c.EndTransformFeedback == Lazy_glEndTransformFeedback; }); return c.EndTransformFeedback(); }
+	static void APIENTRY Lazy_glBindBufferRange (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size){ auto& c = ResolveLazy(Resolve_glBindBufferRange, [](const Version46& c){ return c.BindBufferRange == Lazy_glBindBufferRange; }); return c.BindBufferRange(target, index, buffer, offset, size); }
+	static void APIENTRY Lazy_glBindBufferBase (GLenum target, GLuint index, GLuint buffer){ auto& c = ResolveLazy(Resolve_glBindBufferBase, [](const Version46& c){ return c.BindBufferBase == Lazy_glBindBufferBase; }); return c.BindBufferBase(target, index, buffer); }
+	static void APIENTRY Lazy_glTransformFeedbackVaryings (GLuint program, GLsizei count, const GLchar* const* varyings, GLenum bufferMode){ auto& c = ResolveLazy(Resolve_glTransformFeedbackVaryings, [](const Version46& c){ return c.TransformFeedbackVaryings == Lazy_glTransformFeedbackVaryings; }); return c.TransformFeedbackVaryings(program, count, varyings, bufferMode); }
+	static void APIENTRY Lazy_glGetTransformFeedbackVarying (GLuint program, GLuint index, GLsizei bufSize, GLsizei* length, GLsizei* size, GLenum* type, GLchar* name){ auto& c = ResolveLazy(Resolve_glGetTransformFeedbackVarying, [](const Version46& c){ return c.GetTransformFeedbackVarying == Lazy_glGetTransformFeedbackVarying; }); return c.GetTransformFeedbackVarying(program, index, bufSize, length, size, type, name); }
+	static void APIENTRY Lazy_glClampColor (GLenum target, GLenum clamp){ auto& c = ResolveLazy(Resolve_glClampColor, [](const Version46& c){ return c.ClampColor == Lazy_glClampColor; }); return c.ClampColor(target, clamp); }
+	static void APIENTRY Lazy_glBeginConditionalRender (GLuint id, GLenum mode){ auto& c = ResolveLazy(Resolve_glBeginConditionalRender, [](const Version46& c){ return c.BeginConditionalRender == Lazy_glBeginConditionalRender; }); return c.BeginConditionalRender(id, mode); }
+	static void APIENTRY Lazy_glEndConditionalRender (void){ auto& c = ResolveLazy(Resolve_glEndConditionalRender, [](const Version46& c){ return c.EndConditionalRender == Lazy_glEndConditionalRender; }); return c.EndConditionalRender(); }
+	static void APIENTRY Lazy_glVertexAttribIPointer (GLuint index, GLint size, GLenum type, GLsizei stride, const void* pointer){ auto& c = ResolveLazy(Resolve_glVertexAttribIPointer, [](const Version46& c){ return c.VertexAttribIPointer == Lazy_glVertexAttribIPointer; }); return c.VertexAttribIPointer(index, size, type, stride, pointer); }
+	static void APIENTRY Lazy_glGetVertexAttribIiv (GLuint index, GLenum pname, GLint* params){ auto& c = ResolveLazy(Resolve_glGetVertexAttribIiv, [](const Version46& c){ return c.GetVertexAttribIiv == Lazy_glGetVertexAttribIiv; }); return c.GetVertexAttribIiv(index, pname, params); }
+	static void APIENTRY Lazy_glGetVertexAttribIuiv (GLuint index, GLenum pname, GLuint* params){ auto& c = ResolveLazy(Resolve_glGetVertexAttribIuiv, [](const Version46& c){ return c.GetVertexAttribIuiv == Lazy_glGetVertexAttribIuiv; }); return c.GetVertexAttribIuiv(index, pname, params); }
+	static void APIENTRY Lazy_glVertexAttribI1i (GLuint index, GLint x){ auto& c = ResolveLazy(Resolve_glVertexAttribI1i, [](const Version46& c){ return c.VertexAttribI1i == Lazy_glVertexAttribI1i; }); return c.VertexAttribI1i(index, x); }
+	static void APIENTRY Lazy_glVertexAttribI2i (GLuint index, GLint x, GLint y){ auto& c = ResolveLazy(Resolve_glVertexAttribI2i, [](const Version46& c){ return c.VertexAttribI2i == Lazy_glVertexAttribI2i; }); return c.VertexAttribI2i(index, x, y); }
+	static void APIENTRY Lazy_glVertexAttribI3i (GLuint index, GLint x, GLint y, GLint z){ auto& c = ResolveLazy(Resolve_glVertexAttribI3i, [](const Version46& c){ return c.VertexAttribI3i == Lazy_glVertexAttribI3i; }); return c.VertexAttribI3i(index, x, y, z); }
+	static void APIENTRY Lazy_glVertexAttribI4i (GLuint index, GLint x, GLint y, GLint z, GLint w){ auto& c = ResolveLazy(Resolve_glVertexAttribI4i, [](const Version46& c){ return c.VertexAttribI4i == Lazy_glVertexAttribI4i; }); return c.VertexAttribI4i(index, x, y, z, w); }
+	static void APIENTRY Lazy_glVertexAttribI1ui (GLuint index, GLuint x){ auto& c = ResolveLazy(Resolve_glVertexAttribI1ui, [](const Version46& c){ return c.VertexAttribI1ui == Lazy_glVertexAttribI1ui; }); return c.VertexAttribI1ui(index, x); }
+	static void APIENTRY Lazy_glVertexAttribI2ui (GLuint index, GLuint x, GLuint y){ auto& c = ResolveLazy(Resolve_glVertexAttribI2ui, [](const Version46& c){ return c.VertexAttribI2ui == Lazy_glVertexAttribI2ui; }); return c.VertexAttribI2ui(index, x, y); }
+	static void APIENTRY Lazy_glVertexAttribI3ui (GLuint index, GLuint x, GLuint y, GLuint z){ auto& c = ResolveLazy(Resolve_glVertexAttribI3ui, [](const Version46& c){ return c.VertexAttribI3ui == Lazy_glVertexAttribI3ui; }); return c.VertexAttribI3ui(index, x, y, z); }
+	static void APIENTRY Lazy_glVertexAttribI4ui (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w){ auto& c = ResolveLazy(Resolve_glVertexAttribI4ui, [](const Version46& c){ return c.VertexAttribI4ui == Lazy_glVertexAttribI4ui; }); return c.VertexAttribI4ui(index, x, y, z, w); }
+	static void APIENTRY Lazy_glVertexAttribI1iv (GLuint index, const GLint* v){ auto& c = ResolveLazy(Resolve_glVertexAttribI1iv, [](const Version46& c){ return c.VertexAttribI1iv == Lazy_glVertexAttribI1iv; }); return c.VertexAttribI1iv(index, v); }
+	static void APIENTRY Lazy_glVertexAttribI2iv (GLuint index, const GLint* v){ auto& c = ResolveLazy(Resolve_glVertexAttribI2iv, [](const Version46& c){ return c.VertexAttribI2iv == Lazy_glVertexAttribI2iv; }); return c.VertexAttribI2iv(index, v); }
+	static void APIENTRY Lazy_glVertexAttribI3iv (GLuint index, const GLint* v){ auto& c = ResolveLazy(Resolve_glVertexAttribI3iv, [](const Version46& c){ return c.VertexAttribI3iv == Lazy_glVertexAttribI3iv; }); return c.VertexAttribI3iv(index, v); }
+	static void APIENTRY Lazy_glVertexAttribI4iv (GLuint index, const GLint* v){ auto& c = ResolveLazy(Resolve_glVertexAttribI4iv, [](const Version46& c){ return c.VertexAttribI4iv == Lazy_glVertexAttribI4iv; }); return c.VertexAttribI4iv(index, v); }
+	static void APIENTRY Lazy_glVertexAttribI1uiv (GLuint index, const GLuint* v){ auto& c = ResolveLazy(Resolve_glVertexAttribI1uiv, [](const Version46& c){ return c.VertexAttribI1uiv == Lazy_glVertexAttribI1uiv; }); return c.VertexAttribI1uiv(index, v); }
+	static void APIENTRY Lazy_glVertexAttribI2uiv (GLuint index, const GLuint* v){ auto& c = ResolveLazy(Resolve_glVertexAttribI2uiv, [](const Version46& c){ return c.VertexAttribI2uiv == Lazy_glVertexAttribI2uiv; }); return c.VertexAttribI2uiv(index, v); }
+	static void APIENTRY Lazy_glVertexAttribI3uiv (GLuint index, const GLuint* v){ auto& c = ResolveLazy(Resolve_glVertexAttribI3uiv, [](const Version46& c){ return c.VertexAttribI3uiv == Lazy_glVertexAttribI3uiv; }); return c.VertexAttribI3uiv(index, v); }
+	static void APIENTRY Lazy_glVertexAttribI4uiv (GLuint index, const GLuint* v){ auto& c = ResolveLazy(Resolve_glVertexAttribI4uiv, [](const Version46& c){ return c.VertexAttribI4uiv == Lazy_glVertexAttribI4uiv; }); return c.VertexAttribI4uiv(index, v); }
+	static void APIENTRY Lazy_glVertexAttribI4bv (GLuint index, const GLbyte* v){ auto& c = ResolveLazy(Resolve_glVertexAttribI4bv, [](const Version46& c){ return c.VertexAttribI4bv == Lazy_glVertexAttribI4bv; }); return c.VertexAttribI4bv(index, v); }
+	static void APIENTRY Lazy_glVertexAttribI4sv (GLuint index, const GLshort* v){ auto& c = ResolveLazy(Resolve_glVertexAttribI4sv, [](const Version46& c){ return c.VertexAttribI4sv == Lazy_glVertexAttribI4sv; }); return c.VertexAttribI4sv(index, v); }
+	static void APIENTRY Lazy_glVertexAttribI4ubv (GLuint index, const GLubyte* v){ auto& c = ResolveLazy(Resolve_glVertexAttribI4ubv, [](const Version46& c){ return c.VertexAttribI4ubv == Lazy_glVertexAttribI4ubv; }); return c.VertexAttribI4ubv(index, v); }
+	static void APIENTRY Lazy_glVertexAttribI4usv (GLuint index, const GLushort* v){ auto& c = ResolveLazy(Resolve_glVertexAttribI4usv, [](const Version46& c){ return c.VertexAttribI4usv == Lazy_glVertexAttribI4usv; }); return c.VertexAttribI4usv(index, v); }
+	static void APIENTRY Lazy_glGetUniformuiv (GLuint program, GLint location, GLuint* params){ auto& c = ResolveLazy(Resolve_glGetUniformuiv, [](const Version46& c){ return c.GetUniformuiv == Lazy_glGetUniformuiv; }); return c.GetUniformuiv(program, location, params); }
+	static void APIENTRY Lazy_glBindFragDataLocation (GLuint program, GLuint color, const GLchar* name){ auto& c = ResolveLazy(Resolve_glBindFragDataLocation, [](const Version46& c){ return c.BindFragDataLocation == Lazy_glBindFragDataLocation; }); return c.BindFragDataLocation(program, color, name); }
+	static GLint APIENTRY Lazy_glGetFragDataLocation (GLuint program, const GLchar* name){ auto& c = ResolveLazy(Resolve_glGetFragDataLocation, [](const Version46& c){ return c.GetFragDataLocation == Lazy_glGetFragDataLocation; }); return c.GetFragDataLocation(program, name); }
+	static void APIENTRY Lazy_glUniform1ui (GLint location, GLuint v0){ auto& c = ResolveLazy(Resolve_glUniform1ui, [](const Version46& c){ return c.Uniform1ui == Lazy_glUniform1ui; }); return c.Uniform1ui(location, v0); }
+	static void APIENTRY Lazy_glUniform2ui (GLint location, GLuint v0, GLuint v1){ auto& c = ResolveLazy(Resolve_glUniform2ui, [](const Version46& c){ return c.Uniform2ui == Lazy_glUniform2ui; }); return c.Uniform2ui(location, v0, v1); }
+	static void APIENTRY Lazy_glUniform3ui (GLint location, GLuint v0, GLuint v1, GLuint v2){ auto& c = ResolveLazy(Resolve_glUniform3ui, [](const Version46& c){ return c.Uniform3ui == Lazy_glUniform3ui; }); return c.Uniform3ui(location, v0, v1, v2); }
+	static void APIENTRY Lazy_glUniform4ui (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3){ auto& c = ResolveLazy(Resolve_glUniform4ui, [](const Version46& c){ return c.Uniform4ui == Lazy_glUniform4ui; }); return c.Uniform4ui(location, v0, v1, v2, v3); }
+	static void APIENTRY Lazy_glUniform1uiv (GLint location, GLsizei count, const GLuint* value){ auto& c = ResolveLazy(Resolve_glUniform1uiv, [](const Version46& c){ return c.Uniform1uiv == Lazy_glUniform1uiv; }); return c.Uniform1uiv(location, count, value); }
+	static void APIENTRY Lazy_glUniform2uiv (GLint location, GLsizei count, const GLuint* value){ auto& c = ResolveLazy(Resolve_glUniform2uiv, [](const Version46& c){ return c.Uniform2uiv == Lazy_glUniform2uiv; }); return c.Uniform2uiv(location, count, value); }
+	static void APIENTRY Lazy_glUniform3uiv (GLint location, GLsizei count, const GLuint* value){ auto& c = ResolveLazy(Resolve_glUniform3uiv, [](const Version46& c){ return c.Uniform3uiv == Lazy_glUniform3uiv; }); return c.Uniform3uiv(location, count, value); }
+	static void APIENTRY Lazy_glUniform4uiv (GLint location, GLsizei count, const GLuint* value){ auto& c = ResolveLazy(Resolve_glUniform4uiv, [](const Version46& c){ return c.Uniform4uiv == Lazy_glUniform4uiv; }); return c.Uniform4uiv(location, count, value); }
+	static void APIENTRY Lazy_glTexParameterIiv (GLenum target, GLenum pname, const GLint* params){ auto& c = ResolveLazy(Resolve_glTexParameterIiv, [](const Version46& c){ return c.TexParameterIiv == Lazy_glTexParameterIiv; }); return c.TexParameterIiv(target, pname, params); }
+	static void APIENTRY Lazy_glTexParameterIuiv (GLenum target, GLenum pname, const GLuint* params){ auto& c = ResolveLazy(Resolve_glTexParameterIuiv, [](const Version46& c){ return c.TexParameterIuiv == Lazy_glTexParameterIuiv; }); return c.TexParameterIuiv(target, pname, params); }
+	static void APIENTRY Lazy_glGetTexParameterIiv (GLenum target, GLenum pname, GLint* params){ auto& c = ResolveLazy(Resolve_glGetTexParameterIiv, [](const Version46& c){ return c.GetTexParameterIiv == Lazy_glGetTexParameterIiv; }); return c.GetTexParameterIiv(target, pname, params); }
+	static void APIENTRY Lazy_glGetTexParameterIuiv (GLenum target, GLenum pname, GLuint* params){ auto& c = ResolveLazy(Resolve_glGetTexParameterIuiv, [](const Version46& c){ return c.GetTexParameterIuiv == Lazy_glGetTexParameterIuiv; }); return c.GetTexParameterIuiv(target, pname, params); }
+	static void APIENTRY Lazy_glClearBufferiv (GLenum buffer, GLint drawbuffer, const GLint* value){ auto& c = ResolveLazy(Resolve_glClearBufferiv, [](const Version46& c){ return c.ClearBufferiv == Lazy_glClearBufferiv; }); return c.ClearBufferiv(buffer, drawbuffer, value); }
+	static void APIENTRY Lazy_glClearBufferuiv (GLenum buffer, GLint drawbuffer, const GLuint* value){ auto& c = ResolveLazy(Resolve_glClearBufferuiv, [](const Version46& c){ return c.ClearBufferuiv == Lazy_glClearBufferuiv; }); return c.ClearBufferuiv(buffer, drawbuffer, value); }
+	static void APIENTRY Lazy_glClearBufferfv (GLenum buffer, GLint drawbuffer, const GLfloat* value){ auto& c = ResolveLazy(Resolve_glClearBufferfv, [](const Version46& c){ return c.ClearBufferfv == Lazy_glClearBufferfv; }); return c.ClearBufferfv(buffer, drawbuffer, value); }
+	static void APIENTRY Lazy_glClearBufferfi (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil){ auto& c = ResolveLazy(Resolve_glClearBufferfi, [](const Version46& c){ return c.ClearBufferfi == Lazy_glClearBufferfi; }); return c.ClearBufferfi(buffer, drawbuffer, depth, stencil); }
+	static const GLubyte* APIENTRY Lazy_glGetStringi (GLenum name, GLuint index){ auto& c = ResolveLazy(Resolve_glGetStringi, [](const Version46& c){ return c.GetStringi == Lazy_glGetStringi; }); return c.GetStringi(name, index); }
+	static GLboolean APIENTRY Lazy_glIsRenderbuffer (GLuint renderbuffer){ auto& c = ResolveLazy(Resolve_glIsRenderbuffer, [](const Version46& c){ return c.IsRenderbuffer == Lazy_glIsRenderbuffer; }); return c.IsRenderbuffer(renderbuffer); }
+	static void APIENTRY Lazy_glBindRenderbuffer (GLenum target, GLuint renderbuffer){ auto& c = ResolveLazy(Resolve_glBindRenderbuffer, [](const Version46& c){ return c.BindRenderbuffer == Lazy_glBindRenderbuffer; }); return c.BindRenderbuffer(target, renderbuffer); }
+	static void APIENTRY Lazy_glDeleteRenderbuffers (GLsizei n, const GLuint* renderbuffers){ auto& c = ResolveLazy(Resolve_glDeleteRenderbuffers, [](const Version46& c){ return c.DeleteRenderbuffers == Lazy_glDeleteRenderbuffers; }); return c.DeleteRenderbuffers(n, renderbuffers); }
+	static void APIENTRY Lazy_glGenRenderbuffers (GLsizei n, GLuint* renderbuffers){ auto& c = ResolveLazy(Resolve_glGenRenderbuffers, [](const Version46& c){ return c.GenRenderbuffers == Lazy_glGenRenderbuffers; }); return c.GenRenderbuffers(n, renderbuffers); }
+	static void APIENTRY Lazy_glRenderbufferStorage (GLenum target, GLenum internalformat, GLsizei width, GLsizei height){ auto& c = ResolveLazy(Resolve_glRenderbufferStorage, [](const Version46& c){ return c.RenderbufferStorage == Lazy_glRenderbufferStorage; }); return c.RenderbufferStorage(target, internalformat, width, height); }
+	static void APIENTRY Lazy_glGetRenderbufferParameteriv (GLenum target, GLenum pname, GLint* params){ auto& c = ResolveLazy(Resolve_glGetRenderbufferParameteriv, [](const Version46& c){ return c.GetRenderbufferParameteriv == Lazy_glGetRenderbufferParameteriv; }); return c.GetRenderbufferParameteriv(target, pname, params); }
+	static GLboolean APIENTRY Lazy_glIsFramebuffer (GLuint framebuffer){ auto& c = ResolveLazy(Resolve_glIsFramebuffer, [](const Version46& c){ return c.IsFramebuffer == Lazy_glIsFramebuffer; }); return c.IsFramebuffer(framebuffer); }
+	static void APIENTRY Lazy_glBindFramebuffer (GLenum target, GLuint framebuffer){ auto& c = ResolveLazy(Resolve_glBindFramebuffer, [](const Version46& c){ return c.BindFramebuffer == Lazy_glBindFramebuffer; }); return c.BindFramebuffer(target, framebuffer); }
+	static void APIENTRY Lazy_glDeleteFramebuffers (GLsizei n, const GLuint* framebuffers){ auto& c = ResolveLazy(Resolve_glDeleteFramebuffers, [](const Version46& c){ return c.DeleteFramebuffers == Lazy_glDeleteFramebuffers; }); return c.DeleteFramebuffers(n, framebuffers); }
+	static void APIENTRY Lazy_glGenFramebuffers (GLsizei n, GLuint* framebuffers){ auto& c = ResolveLazy(Resolve_glGenFramebuffers, [](const Version46& c){ return c.GenFramebuffers == Lazy_glGenFramebuffers; }); return c.GenFramebuffers(n, framebuffers); }
+	static GLenum APIENTRY Lazy_glCheckFramebufferStatus (GLenum target){ auto& c = ResolveLazy(Resolve_glCheckFramebufferStatus, [](const Version46& c){ return c.CheckFramebufferStatus == Lazy_glCheckFramebufferStatus; }); return c.CheckFramebufferStatus(target); }
+	static void APIENTRY Lazy_glFramebufferTexture1D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level){ auto& c = ResolveLazy(Resolve_glFramebufferTexture1D, [](const Version46& c){ return c.FramebufferTexture1D == Lazy_glFramebufferTexture1D; }); return c.FramebufferTexture1D(target, attachment, textarget, texture, level); }
+	static void APIENTRY Lazy_glFramebufferTexture2D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level){ auto& c = ResolveLazy(Resolve_glFramebufferTexture2D, [](const Version46& c){ return c.FramebufferTexture2D == Lazy_glFramebufferTexture2D; }); return c.FramebufferTexture2D(target, attachment, textarget, texture, level); }
+	static void APIENTRY Lazy_glFramebufferTexture3D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset){ auto& c = ResolveLazy(Resolve_glFramebufferTexture3D, [](const Version46& c){ return c.FramebufferTexture3D == Lazy_glFramebufferTexture3D; }); return c.FramebufferTexture3D(target, attachment, textarget, texture, level, zoffset); }
+	static void APIENTRY Lazy_glFramebufferRenderbuffer (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer){ auto& c = ResolveLazy(Resolve_glFramebufferRenderbuffer, [](const Version46& c){ return c.FramebufferRenderbuffer == Lazy_glFramebufferRenderbuffer; }); return c.FramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer); }
+	static void APIENTRY Lazy_glGetFramebufferAttachmentParameteriv (GLenum target, GLenum attachment, GLenum pname, GLint* params){ auto& c = ResolveLazy(Resolve_glGetFramebufferAttachmentParameteriv, [](const Version46& c){ return c.GetFramebufferAttachmentParameteriv == Lazy_glGetFramebufferAttachmentParameteriv; }); return c.GetFramebufferAttachmentParameteriv(target, attachment, pname, params); }
+	static void APIENTRY Lazy_glGenerateMipmap (GLenum target){ auto& c = ResolveLazy(Resolve_glGenerateMipmap, [](const Version46& c){ return c.GenerateMipmap == Lazy_glGenerateMipmap; }); return c.GenerateMipmap(target); }
+	static void APIENTRY Lazy_glBlitFramebuffer (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter){ auto& c = ResolveLazy(Resolve_glBlitFramebuffer, [](const Version46& c){ return c.BlitFramebuffer == Lazy_glBlitFramebuffer; }); return c.BlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter); }
+	static void APIENTRY Lazy_glRenderbufferStorageMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height){ auto& c = ResolveLazy(Resolve_glRenderbufferStorageMultisample, [](const Version46& c){ return c.RenderbufferStorageMultisample == Lazy_glRenderbufferStorageMultisample; }); return c.RenderbufferStorageMultisample(target, samples, internalformat, width, height); }
+	static void APIENTRY Lazy_glFramebufferTextureLayer (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer){ auto& c = ResolveLazy(Resolve_glFramebufferTextureLayer, [](const Version46& c){ return c.FramebufferTextureLayer == Lazy_glFramebufferTextureLayer; }); return c.FramebufferTextureLayer(target, attachment, texture, level, layer); }
+	static void* APIENTRY Lazy_glMapBufferRange (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access){ auto& c = ResolveLazy(Resolve_glMapBufferRange, [](const Version46& c){ return c.MapBufferRange == Lazy_glMapBufferRange; }); return c.MapBufferRange(target, offset, length, access); }
+	static void APIENTRY Lazy_glFlushMappedBufferRange (GLenum target, GLintptr offset, GLsizeiptr length){ auto& c = ResolveLazy(Resolve_glFlushMappedBufferRange, [](const Version46& c){ return c.FlushMappedBufferRange == Lazy_glFlushMappedBufferRange; }); return c.FlushMappedBufferRange(target, offset, length); }
+	static void APIENTRY Lazy_glBindVertexArray (GLuint array){ auto& c = ResolveLazy(Resolve_glBindVertexArray, [](const Version46& c){ return c.BindVertexArray == Lazy_glBindVertexArray; }); return c.BindVertexArray(array); }
+	static void APIENTRY Lazy_glDeleteVertexArrays (GLsizei n, const GLuint* arrays){ auto& c = ResolveLazy(Resolve_glDeleteVertexArrays, [](const Version46& c){ return c.DeleteVertexArrays == Lazy_glDeleteVertexArrays; }); return c.DeleteVertexArrays(n, arrays); }
+	static void APIENTRY Lazy_glGenVertexArrays (GLsizei n, GLuint* arrays){ auto& c = ResolveLazy(Resolve_glGenVertexArrays, [](const Version46& c){ return c.GenVertexArrays == Lazy_glGenVertexArrays; }); return c.GenVertexArrays(n, arrays); }
+	static GLboolean APIENTRY Lazy_glIsVertexArray (GLuint array){ auto& c = ResolveLazy(Resolve_glIsVertexArray, [](const Version46& c){ return c.IsVertexArray == Lazy_glIsVertexArray; }); return c.IsVertexArray(array); }
+	Version30::Version30(Func_GetProcAddress GetProcAddress, LoadMode Mode):
+		Version21(GetProcAddress, Mode),
+		ColorMaski(GetProc<PFNGLCOLORMASKIPROC>("glColorMaski", Null_glColorMaski, Lazy_glColorMaski)),
+		GetBooleani_v(GetProc<PFNGLGETBOOLEANI_VPROC>("glGetBooleani_v", Null_glGetBooleani_v, Lazy_glGetBooleani_v)),
+		GetIntegeri_v(GetProc<PFNGLGETINTEGERI_VPROC>("glGetIntegeri_v", Null_glGetIntegeri_v, Lazy_glGetIntegeri_v)),
+		Enablei(GetProc<PFNGLENABLEIPROC>("glEnablei", Null_glEnablei, Lazy_glEnablei)),
+		Disablei(GetProc<PFNGLDISABLEIPROC>("glDisablei", Null_glDisablei, Lazy_glDisablei)),
+		IsEnabledi(GetProc<PFNGLISENABLEDIPROC>("glIsEnabledi", Null_glIsEnabledi, Lazy_glIsEnabledi)),
+		BeginTransformFeedback(GetProc<PFNGLBEGINTRANSFORMFEEDBACKPROC>("glBeginTransformFeedback", Null_glBeginTransformFeedback, Lazy_glBeginTransformFeedback)),
+		EndTransformFeedback(GetProc<PFNGLENDTRANSFORMFEEDBACKPROC>("glEndTransformFeedback", Null_glEndTransformFeedback, Lazy_glEndTransformFeedback)),
+		BindBufferRange(GetProc<PFNGLBINDBUFFERRANGEPROC>("glBindBufferRange", Null_glBindBufferRange, Lazy_glBindBufferRange)),
+		BindBufferBase(GetProc<PFNGLBINDBUFFERBASEPROC>("glBindBufferBase", Null_glBindBufferBase, Lazy_glBindBufferBase)),
+		TransformFeedbackVaryings(GetProc<PFNGLTRANSFORMFEEDBACKVARYINGSPROC>("glTransformFeedbackVaryings", Null_glTransformFeedbackVaryings, Lazy_glTransformFeedbackVaryings)),
+		GetTransformFeedbackVarying(GetProc<PFNGLGETTRANSFORMFEEDBACKVARYINGPROC>("glGetTransformFeedbackVarying", Null_glGetTransformFeedbackVarying, Lazy_glGetTransformFeedbackVarying)),
+		ClampColor(GetProc<PFNGLCLAMPCOLORPROC>("glClampColor", Null_glClampColor, Lazy_glClampColor)),
+		BeginConditionalRender(GetProc<PFNGLBEGINCONDITIONALRENDERPROC>("glBeginConditionalRender", Null_glBeginConditionalRender, Lazy_glBeginConditionalRender)),
+		EndConditionalRender(GetProc<PFNGLENDCONDITIONALRENDERPROC>("glEndConditionalRender", Null_glEndConditionalRender, Lazy_glEndConditionalRender)),
+		VertexAttribIPointer(GetProc<PFNGLVERTEXATTRIBIPOINTERPROC>("glVertexAttribIPointer", Null_glVertexAttribIPointer, Lazy_glVertexAttribIPointer)),
+		GetVertexAttribIiv(GetProc<PFNGLGETVERTEXATTRIBIIVPROC>("glGetVertexAttribIiv", Null_glGetVertexAttribIiv, Lazy_glGetVertexAttribIiv)),
+		GetVertexAttribIuiv(GetProc<PFNGLGETVERTEXATTRIBIUIVPROC>("glGetVertexAttribIuiv", Null_glGetVertexAttribIuiv, Lazy_glGetVertexAttribIuiv)),
+		VertexAttribI1i(GetProc<PFNGLVERTEXATTRIBI1IPROC>("glVertexAttribI1i", Null_glVertexAttribI1i, Lazy_glVertexAttribI1i)),
+		VertexAttribI2i(GetProc<PFNGLVERTEXATTRIBI2IPROC>("glVertexAttribI2i", Null_glVertexAttribI2i, Lazy_glVertexAttribI2i)),
+		VertexAttribI3i(GetProc<PFNGLVERTEXATTRIBI3IPROC>("glVertexAttribI3i", Null_glVertexAttribI3i, Lazy_glVertexAttribI3i)),
+		VertexAttribI4i(GetProc<PFNGLVERTEXATTRIBI4IPROC>("glVertexAttribI4i", Null_glVertexAttribI4i, Lazy_glVertexAttribI4i)),
+		VertexAttribI1ui(GetProc<PFNGLVERTEXATTRIBI1UIPROC>("glVertexAttribI1ui", Null_glVertexAttribI1ui, Lazy_glVertexAttribI1ui)),
+		VertexAttribI2ui(GetProc<PFNGLVERTEXATTRIBI2UIPROC>("glVertexAttribI2ui", Null_glVertexAttribI2ui, Lazy_glVertexAttribI2ui)),
+		VertexAttribI3ui(GetProc<PFNGLVERTEXATTRIBI3UIPROC>("glVertexAttribI3ui", Null_glVertexAttribI3ui, Lazy_glVertexAttribI3ui)),
+		VertexAttribI4ui(GetProc<PFNGLVERTEXATTRIBI4UIPROC>("glVertexAttribI4ui", Null_glVertexAttribI4ui, Lazy_glVertexAttribI4ui)),
+		VertexAttribI1iv(GetProc<PFNGLVERTEXATTRIBI1IVPROC>("glVertexAttribI1iv", Null_glVertexAttribI1iv, Lazy_glVertexAttribI1iv)),
+		VertexAttribI2iv(GetProc<PFNGLVERTEXATTRIBI2IVPROC>("glVertexAttribI2iv", Null_glVertexAttribI2iv, Lazy_glVertexAttribI2iv)),
+		VertexAttribI3iv(GetProc<PFNGLVERTEXATTRIBI3IVPROC>("glVertexAttribI3iv", Null_glVertexAttribI3iv, Lazy_glVertexAttribI3iv)),
+		VertexAttribI4iv(GetProc<PFNGLVERTEXATTRIBI4IVPROC>("glVertexAttribI4iv", Null_glVertexAttribI4iv, Lazy_glVertexAttribI4iv)),
+		VertexAttribI1uiv(GetProc<PFNGLVERTEXATTRIBI1UIVPROC>("glVertexAttribI1uiv", Null_glVertexAttribI1uiv, Lazy_glVertexAttribI1uiv)),
+		VertexAttribI2uiv(GetProc<PFNGLVERTEXATTRIBI2UIVPROC>("glVertexAttribI2uiv", Null_glVertexAttribI2uiv, Lazy_glVertexAttribI2uiv)),
+		VertexAttribI3uiv(GetProc<PFNGLVERTEXATTRIBI3UIVPROC>("glVertexAttribI3uiv", Null_glVertexAttribI3uiv, Lazy_glVertexAttribI3uiv)),
+		VertexAttribI4uiv(GetProc<PFNGLVERTEXATTRIBI4UIVPROC>("glVertexAttribI4uiv", Null_glVertexAttribI4uiv, Lazy_glVertexAttribI4uiv)),
+		VertexAttribI4bv(GetProc<PFNGLVERTEXATTRIBI4BVPROC>("glVertexAttribI4bv", Null_glVertexAttribI4bv, Lazy_glVertexAttribI4bv)),
+		VertexAttribI4sv(GetProc<PFNGLVERTEXATTRIBI4SVPROC>("glVertexAttribI4sv", Null_glVertexAttribI4sv, Lazy_glVertexAttribI4sv)),
+		VertexAttribI4ubv(GetProc<PFNGLVERTEXATTRIBI4UBVPROC>("glVertexAttribI4ubv", Null_glVertexAttribI4ubv, Lazy_glVertexAttribI4ubv)),
+		VertexAttribI4usv(GetProc<PFNGLVERTEXATTRIBI4USVPROC>("glVertexAttribI4usv", Null_glVertexAttribI4usv, Lazy_glVertexAttribI4usv)),
+		GetUniformuiv(GetProc<PFNGLGETUNIFORMUIVPROC>("glGetUniformuiv", Null_glGetUniformuiv, Lazy_glGetUniformuiv)),
+		BindFragDataLocation(GetProc<PFNGLBINDFRAGDATALOCATIONPROC>("glBindFragDataLocation", Null_glBindFragDataLocation, Lazy_glBindFragDataLocation)),
+		GetFragDataLocation(GetProc<PFNGLGETFRAGDATALOCATIONPROC>("glGetFragDataLocation", Null_glGetFragDataLocation, Lazy_glGetFragDataLocation)),
+		Uniform1ui(GetProc<PFNGLUNIFORM1UIPROC>("glUniform1ui", Null_glUniform1ui, Lazy_glUniform1ui)),
+		Uniform2ui(GetProc<PFNGLUNIFORM2UIPROC>("glUniform2ui", Null_glUniform2ui, Lazy_glUniform2ui)),
+		Uniform3ui(GetProc<PFNGLUNIFORM3UIPROC>("glUniform3ui", Null_glUniform3ui, Lazy_glUniform3ui)),
+		Uniform4ui(GetProc<PFNGLUNIFORM4UIPROC>("glUniform4ui", Null_glUniform4ui, Lazy_glUniform4ui)),
+		Uniform1uiv(GetProc<PFNGLUNIFORM1UIVPROC>("glUniform1uiv", Null_glUniform1uiv, Lazy_glUniform1uiv)),
+		Uniform2uiv(GetProc<PFNGLUNIFORM2UIVPROC>("glUniform2uiv", Null_glUniform2uiv, Lazy_glUniform2uiv)),
+		Uniform3uiv(GetProc<PFNGLUNIFORM3UIVPROC>("glUniform3uiv", Null_glUniform3uiv, Lazy_glUniform3uiv)),
+		Uniform4uiv(GetProc<PFNGLUNIFORM4UIVPROC>("glUniform4uiv", Null_glUniform4uiv, Lazy_glUniform4uiv)),
+		TexParameterIiv(GetProc<PFNGLTEXPARAMETERIIVPROC>("glTexParameterIiv", Null_glTexParameterIiv, Lazy_glTexParameterIiv)),
+		TexParameterIuiv(GetProc<PFNGLTEXPARAMETERIUIVPROC>("glTexParameterIuiv", Null_glTexParameterIuiv, Lazy_glTexParameterIuiv)),
+		GetTexParameterIiv(GetProc<PFNGLGETTEXPARAMETERIIVPROC>("glGetTexParameterIiv", Null_glGetTexParameterIiv, Lazy_glGetTexParameterIiv)),
+		GetTexParameterIuiv(GetProc<PFNGLGETTEXPARAMETERIUIVPROC>("glGetTexParameterIuiv", Null_glGetTexParameterIuiv, Lazy_glGetTexParameterIuiv)),
+		ClearBufferiv(GetProc<PFNGLCLEARBUFFERIVPROC>("glClearBufferiv", Null_glClearBufferiv, Lazy_glClearBufferiv)),
+		ClearBufferuiv(GetProc<PFNGLCLEARBUFFERUIVPROC>("glClearBufferuiv", Null_glClearBufferuiv, Lazy_glClearBufferuiv)),
+		ClearBufferfv(GetProc<PFNGLCLEARBUFFERFVPROC>("glClearBufferfv", Null_glClearBufferfv, Lazy_glClearBufferfv)),
+		ClearBufferfi(GetProc<PFNGLCLEARBUFFERFIPROC>("glClearBufferfi", Null_glClearBufferfi, Lazy_glClearBufferfi)),
+		GetStringi(GetProc<PFNGLGETSTRINGIPROC>("glGetStringi", Null_glGetStringi, Lazy_glGetStringi)),
+		IsRenderbuffer(GetProc<PFNGLISRENDERBUFFERPROC>("glIsRenderbuffer", Null_glIsRenderbuffer, Lazy_glIsRenderbuffer)),
+		BindRenderbuffer(GetProc<PFNGLBINDRENDERBUFFERPROC>("glBindRenderbuffer", Null_glBindRenderbuffer, Lazy_glBindRenderbuffer)),
+		DeleteRenderbuffers(GetProc<PFNGLDELETERENDERBUFFERSPROC>("glDeleteRenderbuffers", Null_glDeleteRenderbuffers, Lazy_glDeleteRenderbuffers)),
+		GenRenderbuffers(GetProc<PFNGLGENRENDERBUFFERSPROC>("glGenRenderbuffers", Null_glGenRenderbuffers, Lazy_glGenRenderbuffers)),
+		RenderbufferStorage(GetProc<PFNGLRENDERBUFFERSTORAGEPROC>("glRenderbufferStorage", Null_glRenderbufferStorage, Lazy_glRenderbufferStorage)),
+		GetRenderbufferParameteriv(GetProc<PFNGLGETRENDERBUFFERPARAMETERIVPROC>("glGetRenderbufferParameteriv", Null_glGetRenderbufferParameteriv, Lazy_glGetRenderbufferParameteriv)),
+		IsFramebuffer(GetProc<PFNGLISFRAMEBUFFERPROC>("glIsFramebuffer", Null_glIsFramebuffer, Lazy_glIsFramebuffer)),
+		BindFramebuffer(GetProc<PFNGLBINDFRAMEBUFFERPROC>("glBindFramebuffer", Null_glBindFramebuffer, Lazy_glBindFramebuffer)),
+		DeleteFramebuffers(GetProc<PFNGLDELETEFRAMEBUFFERSPROC>("glDeleteFramebuffers", Null_glDeleteFramebuffers, Lazy_glDeleteFramebuffers)),
+		GenFramebuffers(GetProc<PFNGLGENFRAMEBUFFERSPROC>("glGenFramebuffers", Null_glGenFramebuffers, Lazy_glGenFramebuffers)),
+		CheckFramebufferStatus(GetProc<PFNGLCHECKFRAMEBUFFERSTATUSPROC>("glCheckFramebufferStatus", Null_glCheckFramebufferStatus, Lazy_glCheckFramebufferStatus)),
+		FramebufferTexture1D(GetProc<PFNGLFRAMEBUFFERTEXTURE1DPROC>("glFramebufferTexture1D", Null_glFramebufferTexture1D, Lazy_glFramebufferTexture1D)),
+		FramebufferTexture2D(GetProc<PFNGLFRAMEBUFFERTEXTURE2DPROC>("glFramebufferTexture2D", Null_glFramebufferTexture2D, Lazy_glFramebufferTexture2D)),
+		FramebufferTexture3D(GetProc<PFNGLFRAMEBUFFERTEXTURE3DPROC>("glFramebufferTexture3D", Null_glFramebufferTexture3D, Lazy_glFramebufferTexture3D)),
+		FramebufferRenderbuffer(GetProc<PFNGLFRAMEBUFFERRENDERBUFFERPROC>("glFramebufferRenderbuffer", Null_glFramebufferRenderbuffer, Lazy_glFramebufferRenderbuffer)),
+		GetFramebufferAttachmentParameteriv(GetProc<PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC>("glGetFramebufferAttachmentParameteriv", Null_glGetFramebufferAttachmentParameteriv, Lazy_glGetFramebufferAttachmentParameteriv)),
+		GenerateMipmap(GetProc<PFNGLGENERATEMIPMAPPROC>("glGenerateMipmap", Null_glGenerateMipmap, Lazy_glGenerateMipmap)),
+		BlitFramebuffer(GetProc<PFNGLBLITFRAMEBUFFERPROC>("glBlitFramebuffer", Null_glBlitFramebuffer, Lazy_glBlitFramebuffer)),
+		RenderbufferStorageMultisample(GetProc<PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC>("glRenderbufferStorageMultisample", Null_glRenderbufferStorageMultisample, Lazy_glRenderbufferStorageMultisample)),
+		FramebufferTextureLayer(GetProc<PFNGLFRAMEBUFFERTEXTURELAYERPROC>("glFramebufferTextureLayer", Null_glFramebufferTextureLayer, Lazy_glFramebufferTextureLayer)),
+		MapBufferRange(GetProc<PFNGLMAPBUFFERRANGEPROC>("glMapBufferRange", Null_glMapBufferRange, Lazy_glMapBufferRange)),
+		FlushMappedBufferRange(GetProc<PFNGLFLUSHMAPPEDBUFFERRANGEPROC>("glFlushMappedBufferRange", Null_glFlushMappedBufferRange, Lazy_glFlushMappedBufferRange)),
+		BindVertexArray(GetProc<PFNGLBINDVERTEXARRAYPROC>("glBindVertexArray", Null_glBindVertexArray, Lazy_glBindVertexArray)),
+		DeleteVertexArrays(GetProc<PFNGLDELETEVERTEXARRAYSPROC>("glDeleteVertexArrays", Null_glDeleteVertexArrays, Lazy_glDeleteVertexArrays)),
+		GenVertexArrays(GetProc<PFNGLGENVERTEXARRAYSPROC>("glGenVertexArrays", Null_glGenVertexArrays, Lazy_glGenVertexArrays)),
+		IsVertexArray(GetProc<PFNGLISVERTEXARRAYPROC>("glIsVertexArray", Null_glIsVertexArray, Lazy_glIsVertexArray))
 	{
 		Available = Ver_Major > 3 || (Ver_Major == 3 && (Ver_Minor > 0 || (Ver_Minor == 0 && Ver_Release >= 0)));
 	}
 
+	Version30::Version30(Func_GetProcAddress GetProcAddress):
+		Version30(GetProcAddress, LoadMode::Eager)
+	{
+	}
+
 
 	static void APIENTRY Null_glDrawArraysInstanced (GLenum mode, GLint first, GLsizei count, GLsizei instancecount){ NullFuncPtr(); }
 	static void APIENTRY Null_glDrawElementsInstanced (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount){ NullFuncPtr(); }
@@ -893,24 +1685,53 @@ namespace GL
 	static void APIENTRY Null_glGetActiveUniformBlockiv (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint* params){ NullFuncPtr(); }
 	static void APIENTRY Null_glGetActiveUniformBlockName (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei* length, GLchar* uniformBlockName){ NullFuncPtr(); }
 	static void APIENTRY Null_glUniformBlockBinding (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding){ NullFuncPtr(); }
-	Version31::Version31(Func_GetProcAddress GetProcAddress):
-		Version30(GetProcAddress),
-		DrawArraysInstanced(GetProc<PFNGLDRAWARRAYSINSTANCEDPROC>("glDrawArraysInstanced", Null_glDrawArraysInstanced)),
-		DrawElementsInstanced(GetProc<PFNGLDRAWELEMENTSINSTANCEDPROC>("glDrawElementsInstanced", Null_glDrawElementsInstanced)),
-		TexBuffer(GetProc<PFNGLTEXBUFFERPROC>("glTexBuffer", Null_glTexBuffer)),
-		PrimitiveRestartIndex(GetProc<PFNGLPRIMITIVERESTARTINDEXPROC>("glPrimitiveRestartIndex", Null_glPrimitiveRestartIndex)),
-		CopyBufferSubData(GetProc<PFNGLCOPYBUFFERSUBDATAPROC>("glCopyBufferSubData", Null_glCopyBufferSubData)),
-		GetUniformIndices(GetProc<PFNGLGETUNIFORMINDICESPROC>("glGetUniformIndices", Null_glGetUniformIndices)),
-		GetActiveUniformsiv(GetProc<PFNGLGETACTIVEUNIFORMSIVPROC>("glGetActiveUniformsiv", Null_glGetActiveUniformsiv)),
-		GetActiveUniformName(GetProc<PFNGLGETACTIVEUNIFORMNAMEPROC>("glGetActiveUniformName", Null_glGetActiveUniformName)),
-		GetUniformBlockIndex(GetProc<PFNGLGETUNIFORMBLOCKINDEXPROC>("glGetUniformBlockIndex", Null_glGetUniformBlockIndex)),
-		GetActiveUniformBlockiv(GetProc<PFNGLGETACTIVEUNIFORMBLOCKIVPROC>("glGetActiveUniformBlockiv", Null_glGetActiveUniformBlockiv)),
-		GetActiveUniformBlockName(GetProc<PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC>("glGetActiveUniformBlockName", Null_glGetActiveUniformBlockName)),
-		UniformBlockBinding(GetProc<PFNGLUNIFORMBLOCKBINDINGPROC>("glUniformBlockBinding", Null_glUniformBlockBinding))
+	static void Resolve_glDrawArraysInstanced(Version46& c){ c.DrawArraysInstanced = c.GetProc<decltype(c.DrawArraysInstanced)>("glDrawArraysInstanced", Null_glDrawArraysInstanced); }
+	static void Resolve_glDrawElementsInstanced(Version46& c){ c.DrawElementsInstanced = c.GetProc<decltype(c.DrawElementsInstanced)>("glDrawElementsInstanced", Null_glDrawElementsInstanced); }
+	static void Resolve_glTexBuffer(Version46& c){ c.TexBuffer = c.GetProc<decltype(c.TexBuffer)>("glTexBuffer", Null_glTexBuffer); }
+	static void Resolve_glPrimitiveRestartIndex(Version46& c){ c.PrimitiveRestartIndex = c.GetProc<decltype(c.PrimitiveRestartIndex)>("glPrimitiveRestartIndex", Null_glPrimitiveRestartIndex); }
+	static void Resolve_glCopyBufferSubData(Version46& c){ c.CopyBufferSubData = c.GetProc<decltype(c.CopyBufferSubData)>("glCopyBufferSubData", Null_glCopyBufferSubData); }
+	static void Resolve_glGetUniformIndices(Version46& c){ c.GetUniformIndices = c.GetProc<decltype(c.GetUniformIndices)>("glGetUniformIndices", Null_glGetUniformIndices); }
+	static void Resolve_glGetActiveUniformsiv(Version46& c){ c.GetActiveUniformsiv = c.GetProc<decltype(c.GetActiveUniformsiv)>("glGetActiveUniformsiv", Null_glGetActiveUniformsiv); }
+	static void Resolve_glGetActiveUniformName(Version46& c){ c.GetActiveUniformName = c.GetProc<decltype(c.GetActiveUniformName)>("glGetActiveUniformName", Null_glGetActiveUniformName); }
+	static void Resolve_glGetUniformBlockIndex(Version46& c){ c.GetUniformBlockIndex = c.GetProc<decltype(c.GetUniformBlockIndex)>("glGetUniformBlockIndex", Null_glGetUniformBlockIndex); }
+	static void Resolve_glGetActiveUniformBlockiv(Version46& c){ c.GetActiveUniformBlockiv = c.GetProc<decltype(c.GetActiveUniformBlockiv)>("glGetActiveUniformBlockiv", Null_glGetActiveUniformBlockiv); }
+	static void Resolve_glGetActiveUniformBlockName(Version46& c){ c.GetActiveUniformBlockName = c.GetProc<decltype(c.GetActiveUniformBlockName)>("glGetActiveUniformBlockName", Null_glGetActiveUniformBlockName); }
+	static void Resolve_glUniformBlockBinding(Version46& c){ c.UniformBlockBinding = c.GetProc<decltype(c.UniformBlockBinding)>("glUniformBlockBinding", Null_glUniformBlockBinding); }
+	static void APIENTRY Lazy_glDrawArraysInstanced (GLenum mode, GLint first, GLsizei count, GLsizei instancecount){ auto& c = ResolveLazy(Resolve_glDrawArraysInstanced, [](const Version46& c){ return c.DrawArraysInstanced == Lazy_glDrawArraysInstanced; }); return c.DrawArraysInstanced(mode, first, count, instancecount); }
+	static void APIENTRY Lazy_glDrawElementsInstanced (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount){ auto& c = ResolveLazy(Resolve_glDrawElementsInstanced, [](const Version46& c){ return c.DrawElementsInstanced == Lazy_glDrawElementsInstanced; }); return c.DrawElementsInstanced(mode, count, type, indices, instancecount); }
+	static void APIENTRY Lazy_glTexBuffer (GLenum target, GLenum internalformat, GLuint buffer){ auto& c = ResolveLazy(Resolve_glTexBuffer, [](const Version46& c){ return c.TexBuffer == Lazy_glTexBuffer; }); return c.TexBuffer(target, internalformat, buffer); }
+	static void APIENTRY Lazy_glPrimitiveRestartIndex (GLuint index){ auto& c = ResolveLazy(Resolve_glPrimitiveRestartIndex, [](const Version46& c){ return c.PrimitiveRestartIndex == Lazy_glPrimitiveRestartIndex; }); return c.PrimitiveRestartIndex(index); }
+	static void APIENTRY Lazy_glCopyBufferSubData (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size){ auto& c = ResolveLazy(Resolve_glCopyBufferSubData, [](const Version46& c){ return c.CopyBufferSubData == Lazy_glCopyBufferSubData; }); return c.CopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size); }
+	static void APIENTRY Lazy_glGetUniformIndices (GLuint program, GLsizei uniformCount, const GLchar* const* uniformNames, GLuint* uniformIndices){ auto& c = ResolveLazy(Resolve_glGetUniformIndices, [](const Version46& c){ return c.GetUniformIndices == Lazy_glGetUniformIndices; }); return c.GetUniformIndices(program, uniformCount, uniformNames, uniformIndices); }
+	static void APIENTRY Lazy_glGetActiveUniformsiv (GLuint program, GLsizei uniformCount, const GLuint* uniformIndices, GLenum pname, GLint* params){ auto& c = ResolveLazy(Resolve_glGetActiveUniformsiv, [](const Version46& c){ return c.GetActiveUniformsiv == Lazy_glGetActiveUniformsiv; }); return c.GetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params); }
+	static void APIENTRY Lazy_glGetActiveUniformName (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei* length, GLchar* uniformName){ auto& c = ResolveLazy(Resolve_glGetActiveUniformName, [](const Version46& c){ return c.GetActiveUniformName == Lazy_glGetActiveUniformName; }); return c.GetActiveUniformName(program, uniformIndex, bufSize, length, uniformName); }
+	static GLuint APIENTRY Lazy_glGetUniformBlockIndex (GLuint program, const GLchar* uniformBlockName){ auto& c = ResolveLazy(Resolve_glGetUniformBlockIndex, [](const Version46& c){ return c.GetUniformBlockIndex == Lazy_glGetUniformBlockIndex; }); return c.GetUniformBlockIndex(program, uniformBlockName); }
+	static void APIENTRY Lazy_glGetActiveUniformBlockiv (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint* params){ auto& c = ResolveLazy(Resolve_glGetActiveUniformBlockiv, [](const Version46& c){ return c.GetActiveUniformBlockiv == Lazy_glGetActiveUniformBlockiv; }); return c.GetActiveUniformBlockiv(program, uniformBlockIndex, pname, params); }
+	static void APIENTRY Lazy_glGetActiveUniformBlockName (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei* length, GLchar* uniformBlockName){ auto& c = ResolveLazy(Resolve_glGetActiveUniformBlockName, [](const Version46& c){ return c.GetActiveUniformBlockName == Lazy_glGetActiveUniformBlockName; }); return c.GetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName); }
+	static void APIENTRY Lazy_glUniformBlockBinding (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding){ auto& c = ResolveLazy(Resolve_glUniformBlockBinding, [](const Version46& c){ return c.UniformBlockBinding == Lazy_glUniformBlockBinding; }); return c.UniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding); }
+	Version31::Version31(Func_GetProcAddress GetProcAddress, LoadMode Mode):
+		Version30(GetProcAddress, Mode),
+		DrawArraysInstanced(GetProc<PFNGLDRAWARRAYSINSTANCEDPROC>("glDrawArraysInstanced", Null_glDrawArraysInstanced, Lazy_glDrawArraysInstanced)),
+		DrawElementsInstanced(GetProc<PFNGLDRAWELEMENTSINSTANCEDPROC>("glDrawElementsInstanced", Null_glDrawElementsInstanced, Lazy_glDrawElementsInstanced)),
+		TexBuffer(GetProc<PFNGLTEXBUFFERPROC>("glTexBuffer", Null_glTexBuffer, Lazy_glTexBuffer)),
+		PrimitiveRestartIndex(GetProc<PFNGLPRIMITIVERESTARTINDEXPROC>("glPrimitiveRestartIndex", Null_glPrimitiveRestartIndex, Lazy_glPrimitiveRestartIndex)),
+		CopyBufferSubData(GetProc<PFNGLCOPYBUFFERSUBDATAPROC>("glCopyBufferSubData", Null_glCopyBufferSubData, Lazy_glCopyBufferSubData)),
+		GetUniformIndices(GetProc<PFNGLGETUNIFORMINDICESPROC>("glGetUniformIndices", Null_glGetUniformIndices, Lazy_glGetUniformIndices)),
+		GetActiveUniformsiv(GetProc<PFNGLGETACTIVEUNIFORMSIVPROC>("glGetActiveUniformsiv", Null_glGetActiveUniformsiv, Lazy_glGetActiveUniformsiv)),
+		GetActiveUniformName(GetProc<PFNGLGETACTIVEUNIFORMNAMEPROC>("glGetActiveUniformName", Null_glGetActiveUniformName, Lazy_glGetActiveUniformName)),
+		GetUniformBlockIndex(GetProc<PFNGLGETUNIFORMBLOCKINDEXPROC>("glGetUniformBlockIndex", Null_glGetUniformBlockIndex, Lazy_glGetUniformBlockIndex)),
+		GetActiveUniformBlockiv(GetProc<PFNGLGETACTIVEUNIFORMBLOCKIVPROC>("glGetActiveUniformBlockiv", Null_glGetActiveUniformBlockiv, Lazy_glGetActiveUniformBlockiv)),
+		GetActiveUniformBlockName(GetProc<PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC>("glGetActiveUniformBlockName", Null_glGetActiveUniformBlockName, Lazy_glGetActiveUniformBlockName)),
+		UniformBlockBinding(GetProc<PFNGLUNIFORMBLOCKBINDINGPROC>("glUniformBlockBinding", Null_glUniformBlockBinding, Lazy_glUniformBlockBinding))
 	{
 		Available = Ver_Major > 3 || (Ver_Major == 3 && (Ver_Minor > 1 || (Ver_Minor == 1 && Ver_Release >= 0)));
 	}
 
+	Version31::Version31(Func_GetProcAddress GetProcAddress):
+		Version31(GetProcAddress, LoadMode::Eager)
+	{
+	}
+
 
 	static void APIENTRY Null_glDrawElementsBaseVertex (GLenum mode, GLsizei count, GLenum type, const void* indices, GLint basevertex){ NullFuncPtr(); }
 	static void APIENTRY Null_glDrawRangeElementsBaseVertex (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void* indices, GLint basevertex){ NullFuncPtr(); }
@@ -931,31 +1752,74 @@ namespace GL
 	static void APIENTRY Null_glTexImage3DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations){ NullFuncPtr(); }
 	static void APIENTRY Null_glGetMultisamplefv (GLenum pname, GLuint index, GLfloat* val){ NullFuncPtr(); }
 	static void APIENTRY Null_glSampleMaski (GLuint maskNumber, GLbitfield mask){ NullFuncPtr(); }
-	Version32::Version32(Func_GetProcAddress GetProcAddress):
-		Version31(GetProcAddress),
-		DrawElementsBaseVertex(GetProc<PFNGLDRAWELEMENTSBASEVERTEXPROC>("glDrawElementsBaseVertex", Null_glDrawElementsBaseVertex)),
-		DrawRangeElementsBaseVertex(GetProc<PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC>("glDrawRangeElementsBaseVertex", Null_glDrawRangeElementsBaseVertex)),
-		DrawElementsInstancedBaseVertex(GetProc<PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC>("glDrawElementsInstancedBaseVertex", Null_glDrawElementsInstancedBaseVertex)),
-		MultiDrawElementsBaseVertex(GetProc<PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC>("glMultiDrawElementsBaseVertex", Null_glMultiDrawElementsBaseVertex)),
-		ProvokingVertex(GetProc<PFNGLPROVOKINGVERTEXPROC>("glProvokingVertex", Null_glProvokingVertex)),
-		FenceSync(GetProc<PFNGLFENCESYNCPROC>("glFenceSync", Null_glFenceSync)),
-		IsSync(GetProc<PFNGLISSYNCPROC>("glIsSync", Null_glIsSync)),
-		DeleteSync(GetProc<PFNGLDELETESYNCPROC>("glDeleteSync", Null_glDeleteSync)),
-		ClientWaitSync(GetProc<PFNGLCLIENTWAITSYNCPROC>("glClientWaitSync", Null_glClientWaitSync)),
-		WaitSync(GetProc<PFNGLWAITSYNCPROC>("glWaitSync", Null_glWaitSync)),
-		GetInteger64v(GetProc<PFNGLGETINTEGER64VPROC>("glGetInteger64v", Null_glGetInteger64v)),
-		GetSynciv(GetProc<PFNGLGETSYNCIVPROC>("glGetSynciv", Null_glGetSynciv)),
-		GetInteger64i_v(GetProc<PFNGLGETINTEGER64I_VPROC>("glGetInteger64i_v", Null_glGetInteger64i_v)),
-		GetBufferParameteri64v(GetProc<PFNGLGETBUFFERPARAMETERI64VPROC>("glGetBufferParameteri64v", Null_glGetBufferParameteri64v)),
-		FramebufferTexture(GetProc<PFNGLFRAMEBUFFERTEXTUREPROC>("glFramebufferTexture", Null_glFramebufferTexture)),
-		TexImage2DMultisample(GetProc<PFNGLTEXIMAGE2DMULTISAMPLEPROC>("glTexImage2DMultisample", Null_glTexImage2DMultisample)),
-		TexImage3DMultisample(GetProc<PFNGLTEXIMAGE3DMULTISAMPLEPROC>("glTexImage3DMultisample", Null_glTexImage3DMultisample)),
-		GetMultisamplefv(GetProc<PFNGLGETMULTISAMPLEFVPROC>("glGetMultisamplefv", Null_glGetMultisamplefv)),
-		SampleMaski(GetProc<PFNGLSAMPLEMASKIPROC>("glSampleMaski", Null_glSampleMaski))
+	static void Resolve_glDrawElementsBaseVertex(Version46& c){ c.DrawElementsBaseVertex = c.GetProc<decltype(c.DrawElementsBaseVertex)>("glDrawElementsBaseVertex", Null_glDrawElementsBaseVertex); }
+	static void Resolve_glDrawRangeElementsBaseVertex(Version46& c){ c.DrawRangeElementsBaseVertex = c.GetProc<decltype(c.DrawRangeElementsBaseVertex)>("glDrawRangeElementsBaseVertex", Null_glDrawRangeElementsBaseVertex); }
+	static void Resolve_glDrawElementsInstancedBaseVertex(Version46& c){ c.DrawElementsInstancedBaseVertex = c.GetProc<decltype(c.DrawElementsInstancedBaseVertex)>("glDrawElementsInstancedBaseVertex", Null_glDrawElementsInstancedBaseVertex); }
+	static void Resolve_glMultiDrawElementsBaseVertex(Version46& c){ c.MultiDrawElementsBaseVertex = c.GetProc<decltype(c.MultiDrawElementsBaseVertex)>("glMultiDrawElementsBaseVertex", Null_glMultiDrawElementsBaseVertex); }
+	static void Resolve_glProvokingVertex(Version46& c){ c.ProvokingVertex = c.GetProc<decltype(c.ProvokingVertex)>("glProvokingVertex", Null_glProvokingVertex); }
+	static void Resolve_glFenceSync(Version46& c){ c.FenceSync = c.GetProc<decltype(c.FenceSync)>("glFenceSync", Null_glFenceSync); }
+	static void Resolve_glIsSync(Version46& c){ c.IsSync = c.GetProc<decltype(c.IsSync)>("glIsSync", Null_glIsSync); }
+	static void Resolve_glDeleteSync(Version46& c){ c.DeleteSync = c.GetProc<decltype(c.DeleteSync)>("glDeleteSync", Null_glDeleteSync); }
+	static void Resolve_glClientWaitSync(Version46& c){ c.ClientWaitSync = c.GetProc<decltype(c.ClientWaitSync)>("glClientWaitSync", Null_glClientWaitSync); }
+	static void Resolve_glWaitSync(Version46& c){ c.WaitSync = c.GetProc<decltype(c.WaitSync)>("glWaitSync", Null_glWaitSync); }
+	static void Resolve_glGetInteger64v(Version46& c){ c.GetInteger64v = c.GetProc<decltype(c.GetInteger64v)>("glGetInteger64v", Null_glGetInteger64v); }
+	static void Resolve_glGetSynciv(Version46& c){ c.GetSynciv = c.GetProc<decltype(c.GetSynciv)>("glGetSynciv", Null_glGetSynciv); }
+	static void Resolve_glGetInteger64i_v(Version46& c){ c.GetInteger64i_v = c.GetProc<decltype(c.GetInteger64i_v)>("glGetInteger64i_v", Null_glGetInteger64i_v); }
+	static void Resolve_glGetBufferParameteri64v(Version46& c){ c.GetBufferParameteri64v = c.GetProc<decltype(c.GetBufferParameteri64v)>("glGetBufferParameteri64v", Null_glGetBufferParameteri64v); }
+	static void Resolve_glFramebufferTexture(Version46& c){ c.FramebufferTexture = c.GetProc<decltype(c.FramebufferTexture)>("glFramebufferTexture", Null_glFramebufferTexture); }
+	static void Resolve_glTexImage2DMultisample(Version46& c){ c.TexImage2DMultisample = c.GetProc<decltype(c.TexImage2DMultisample)>("glTexImage2DMultisample", Null_glTexImage2DMultisample); }
+	static void Resolve_glTexImage3DMultisample(Version46& c){ c.TexImage3DMultisample = c.GetProc<decltype(c.TexImage3DMultisample)>("glTexImage3DMultisample", Null_glTexImage3DMultisample); }
+	static void Resolve_glGetMultisamplefv(Version46& c){ c.GetMultisamplefv = c.GetProc<decltype(c.GetMultisamplefv)>("glGetMultisamplefv", Null_glGetMultisamplefv); }
+	static void Resolve_glSampleMaski(Version46& c){ c.SampleMaski = c.GetProc<decltype(c.SampleMaski)>("glSampleMaski", Null_glSampleMaski); }
+	static void APIENTRY Lazy_glDrawElementsBaseVertex (GLenum mode, GLsizei count, GLenum type, const void* indices, GLint basevertex){ auto& c = ResolveLazy(Resolve_glDrawElementsBaseVertex, [](const Version46& c){ return c.DrawElementsBaseVertex == Lazy_glDrawElementsBaseVertex; }); return c.DrawElementsBaseVertex(mode, count, type, indices, basevertex); }
+	static void APIENTRY Lazy_glDrawRangeElementsBaseVertex (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void* indices, GLint basevertex){ auto& c = ResolveLazy(Resolve_glDrawRangeElementsBaseVertex, [](const Version46& c){ return c.DrawRangeElementsBaseVertex == Lazy_glDrawRangeElementsBaseVertex; }); return c.DrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex); }
+	static void APIENTRY Lazy_glDrawElementsInstancedBaseVertex (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount, GLint basevertex){ auto& c = ResolveLazy(Resolve_glDrawElementsInstancedBaseVertex, [](const Version46& c){ return c.DrawElementsInstancedBaseVertex == Lazy_glDrawElementsInstancedBaseVertex; }); return c.DrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex); }
+	static void APIENTRY Lazy_glMultiDrawElementsBaseVertex (GLenum mode, const GLsizei* count, GLenum type, const void* const* indices, GLsizei drawcount, const GLint* basevertex){ auto& c = ResolveLazy(Resolve_glMultiDrawElementsBaseVertex, [](const Version46& c){ return c.MultiDrawElementsBaseVertex == Lazy_glMultiDrawElementsBaseVertex; }); return c.MultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex); }
+	static void APIENTRY Lazy_glProvokingVertex (GLenum mode){ auto& c = ResolveLazy(Resolve_glProvokingVertex, [](const Version46& c){ return c.ProvokingVertex == Lazy_glProvokingVertex; }); return c.ProvokingVertex(mode); }
+	static GLsync APIENTRY Lazy_glFenceSync (GLenum condition, GLbitfield flags){ auto& c = ResolveLazy(Resolve_glFenceSync, [](const Version46& c){ return c.FenceSync == Lazy_glFenceSync; }); return c.FenceSync(condition, flags); }
+	static GLboolean APIENTRY Lazy_glIsSync (GLsync sync){ auto& c = ResolveLazy(Resolve_glIsSync, [](const Version46& c){ return c.IsSync == Lazy_glIsSync; }); return c.IsSync(sync); }
+	static void APIENTRY Lazy_glDeleteSync (GLsync sync){ auto& c = ResolveLazy(Resolve_glDeleteSync, [](const Version46& c){ return c.DeleteSync == Lazy_glDeleteSync; }); return c.DeleteSync(sync); }
+	static GLenum APIENTRY Lazy_glClientWaitSync (GLsync sync, GLbitfield flags, GLuint64 timeout){ auto& c = ResolveLazy(Resolve_glClientWaitSync, [](const Version46& c){ return c.ClientWaitSync == Lazy_glClientWaitSync; }); return c.ClientWaitSync(sync, flags, timeout); }
+	static void APIENTRY Lazy_glWaitSync (GLsync sync, GLbitfield flags, GLuint64 timeout){ auto& c = ResolveLazy(Resolve_glWaitSync, [](const Version46& c){ return c.WaitSync == Lazy_glWaitSync; }); return c.WaitSync(sync, flags, timeout); }
+	static void APIENTRY Lazy_glGetInteger64v (GLenum pname, GLint64* data){ auto& c = ResolveLazy(Resolve_glGetInteger64v, [](const Version46& c){ return c.GetInteger64v == Lazy_glGetInteger64v; }); return c.GetInteger64v(pname, data); }
+	static void APIENTRY Lazy_glGetSynciv (GLsync sync, GLenum pname, GLsizei count, GLsizei* length, GLint* values){ auto& c = ResolveLazy(Resolve_glGetSynciv, [](const Version46& c){ return c.GetSynciv == Lazy_glGetSynciv; }); return c.GetSynciv(sync, pname, count, length, values); }
+	static void APIENTRY Lazy_glGetInteger64i_v (GLenum target, GLuint index, GLint64* data){ auto& c = ResolveLazy(Resolve_glGetInteger64i_v, [](const Version46& c){ return c.GetInteger64i_v == Lazy_glGetInteger64i_v; }); return c.GetInteger64i_v(target, index, data); }
+	static void APIENTRY Lazy_glGetBufferParameteri64v (GLenum target, GLenum pname, GLint64* params){ auto& c = ResolveLazy(Resolve_glGetBufferParameteri64v, [](const Version46& c){ return c.GetBufferParameteri64v == Lazy_glGetBufferParameteri64v; }); return c.GetBufferParameteri64v(target, pname, params); }
+	static void APIENTRY Lazy_glFramebufferTexture (GLenum target, GLenum attachment, GLuint texture, GLint level){ auto& c = ResolveLazy(Resolve_glFramebufferTexture, [](const Version46& c){ return c.FramebufferTexture == Lazy_glFramebufferTexture; }); return c.FramebufferTexture(target, attachment, texture, level); }
+	static void APIENTRY Lazy_glTexImage2DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations){ auto& c = ResolveLazy(Resolve_glTexImage2DMultisample, [](const Version46& c){ return c.TexImage2DMultisample == Lazy_glTexImage2DMultisample; }); return c.TexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations); }
+	static void APIENTRY Lazy_glTexImage3DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations){ auto& c = ResolveLazy(Resolve_glTexImage3DMultisample, [](const Version46& c){ return c.TexImage3DMultisample == Lazy_glTexImage3DMultisample; }); return c.TexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations); }
+	static void APIENTRY Lazy_glGetMultisamplefv (GLenum pname, GLuint index, GLfloat* val){ auto& c = ResolveLazy(Resolve_glGetMultisamplefv, [](const Version46& c){ return c.GetMultisamplefv == Lazy_glGetMultisamplefv; }); return c.GetMultisamplefv(pname, index, val); }
+	static void APIENTRY Lazy_glSampleMaski (GLuint maskNumber, GLbitfield mask){ auto& c = ResolveLazy(Resolve_glSampleMaski, [](const Version46& c){ return c.SampleMaski == Lazy_glSampleMaski; }); return c.SampleMaski(maskNumber, mask); }
+	Version32::Version32(Func_GetProcAddress GetProcAddress, LoadMode Mode):
+		Version31(GetProcAddress, Mode),
+		DrawElementsBaseVertex(GetProc<PFNGLDRAWELEMENTSBASEVERTEXPROC>("glDrawElementsBaseVertex", Null_glDrawElementsBaseVertex, Lazy_glDrawElementsBaseVertex)),
+		DrawRangeElementsBaseVertex(GetProc<PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC>("glDrawRangeElementsBaseVertex", Null_glDrawRangeElementsBaseVertex, Lazy_glDrawRangeElementsBaseVertex)),
+		DrawElementsInstancedBaseVertex(GetProc<PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC>("glDrawElementsInstancedBaseVertex", Null_glDrawElementsInstancedBaseVertex, Lazy_glDrawElementsInstancedBaseVertex)),
+		MultiDrawElementsBaseVertex(GetProc<PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC>("glMultiDrawElementsBaseVertex", Null_glMultiDrawElementsBaseVertex, Lazy_glMultiDrawElementsBaseVertex)),
+		ProvokingVertex(GetProc<PFNGLPROVOKINGVERTEXPROC>("glProvokingVertex", Null_glProvokingVertex, Lazy_glProvokingVertex)),
+		FenceSync(GetProc<PFNGLFENCESYNCPROC>("glFenceSync", Null_glFenceSync, Lazy_glFenceSync)),
+		IsSync(GetProc<PFNGLISSYNCPROC>("glIsSync", Null_glIsSync, Lazy_glIsSync)),
+		DeleteSync(GetProc<PFNGLDELETESYNCPROC>("glDeleteSync", Null_glDeleteSync, Lazy_glDeleteSync)),
+		ClientWaitSync(GetProc<PFNGLCLIENTWAITSYNCPROC>("glClientWaitSync", Null_glClientWaitSync, Lazy_glClientWaitSync)),
+		WaitSync(GetProc<PFNGLWAITSYNCPROC>("glWaitSync", Null_glWaitSync, Lazy_glWaitSync)),
+		GetInteger64v(GetProc<PFNGLGETINTEGER64VPROC>("glGetInteger64v", Null_glGetInteger64v, Lazy_glGetInteger64v)),
+		GetSynciv(GetProc<PFNGLGETSYNCIVPROC>("glGetSynciv", Null_glGetSynciv, Lazy_glGetSynciv)),
+		GetInteger64i_v(GetProc<PFNGLGETINTEGER64I_VPROC>("glGetInteger64i_v", Null_glGetInteger64i_v, Lazy_glGetInteger64i_v)),
+		GetBufferParameteri64v(GetProc<PFNGLGETBUFFERPARAMETERI64VPROC>("glGetBufferParameteri64v", Null_glGetBufferParameteri64v, Lazy_glGetBufferParameteri64v)),
+		FramebufferTexture(GetProc<PFNGLFRAMEBUFFERTEXTUREPROC>("glFramebufferTexture", Null_glFramebufferTexture, Lazy_glFramebufferTexture)),
+		TexImage2DMultisample(GetProc<PFNGLTEXIMAGE2DMULTISAMPLEPROC>("glTexImage2DMultisample", Null_glTexImage2DMultisample, Lazy_glTexImage2DMultisample)),
+		TexImage3DMultisample(GetProc<PFNGLTEXIMAGE3DMULTISAMPLEPROC>("glTexImage3DMultisample", Null_glTexImage3DMultisample, Lazy_glTexImage3DMultisample)),
+		GetMultisamplefv(GetProc<PFNGLGETMULTISAMPLEFVPROC>("glGetMultisamplefv", Null_glGetMultisamplefv, Lazy_glGetMultisamplefv)),
+		SampleMaski(GetProc<PFNGLSAMPLEMASKIPROC>("glSampleMaski", Null_glSampleMaski, Lazy_glSampleMaski))
 	{
 		Available = Ver_Major > 3 || (Ver_Major == 3 && (Ver_Minor > 2 || (Ver_Minor == 2 && Ver_Release >= 0)));
 	}
 
+	Version32::Version32(Func_GetProcAddress GetProcAddress):
+		Version32(GetProcAddress, LoadMode::Eager)
+	{
+	}
+
 
 	static void APIENTRY Null_glBindFragDataLocationIndexed (GLuint program, GLuint colorNumber, GLuint index, const GLchar* name){ NullFuncPtr(); }
 	static GLint APIENTRY Null_glGetFragDataIndex (GLuint program, const GLchar* name){ NullFuncPtr(); return 0; }
@@ -1015,70 +1879,191 @@ namespace GL
 	static void APIENTRY Null_glColorP4uiv (GLenum type, const GLuint* color){ NullFuncPtr(); }
 	static void APIENTRY Null_glSecondaryColorP3ui (GLenum type, GLuint color){ NullFuncPtr(); }
 	static void APIENTRY Null_glSecondaryColorP3uiv (GLenum type, const GLuint* color){ NullFuncPtr(); }
-	Version33::Version33(Func_GetProcAddress GetProcAddress):
-		Version32(GetProcAddress),
-		BindFragDataLocationIndexed(GetProc<PFNGLBINDFRAGDATALOCATIONINDEXEDPROC>("glBindFragDataLocationIndexed", Null_glBindFragDataLocationIndexed)),
-		GetFragDataIndex(GetProc<PFNGLGETFRAGDATAINDEXPROC>("glGetFragDataIndex", Null_glGetFragDataIndex)),
-		GenSamplers(GetProc<PFNGLGENSAMPLERSPROC>("glGenSamplers", Null_glGenSamplers)),
-		DeleteSamplers(GetProc<PFNGLDELETESAMPLERSPROC>("glDeleteSamplers", Null_glDeleteSamplers)),
-		IsSampler(GetProc<PFNGLISSAMPLERPROC>("glIsSampler", Null_glIsSampler)),
-		BindSampler(GetProc<PFNGLBINDSAMPLERPROC>("glBindSampler", Null_glBindSampler)),
-		SamplerParameteri(GetProc<PFNGLSAMPLERPARAMETERIPROC>("glSamplerParameteri", Null_glSamplerParameteri)),
-		SamplerParameteriv(GetProc<PFNGLSAMPLERPARAMETERIVPROC>("glSamplerParameteriv", Null_glSamplerParameteriv)),
-		SamplerParameterf(GetProc<PFNGLSAMPLERPARAMETERFPROC>("glSamplerParameterf", Null_glSamplerParameterf)),
-		SamplerParameterfv(GetProc<PFNGLSAMPLERPARAMETERFVPROC>("glSamplerParameterfv", Null_glSamplerParameterfv)),
-		SamplerParameterIiv(GetProc<PFNGLSAMPLERPARAMETERIIVPROC>("glSamplerParameterIiv", Null_glSamplerParameterIiv)),
-		SamplerParameterIuiv(GetProc<PFNGLSAMPLERPARAMETERIUIVPROC>("glSamplerParameterIuiv", Null_glSamplerParameterIuiv)),
-		GetSamplerParameteriv(GetProc<PFNGLGETSAMPLERPARAMETERIVPROC>("glGetSamplerParameteriv", Null_glGetSamplerParameteriv)),
-		GetSamplerParameterIiv(GetProc<PFNGLGETSAMPLERPARAMETERIIVPROC>("glGetSamplerParameterIiv", Null_glGetSamplerParameterIiv)),
-		GetSamplerParameterfv(GetProc<PFNGLGETSAMPLERPARAMETERFVPROC>("glGetSamplerParameterfv", Null_glGetSamplerParameterfv)),
-		GetSamplerParameterIuiv(GetProc<PFNGLGETSAMPLERPARAMETERIUIVPROC>("glGetSamplerParameterIuiv", Null_glGetSamplerParameterIuiv)),
-		QueryCounter(GetProc<PFNGLQUERYCOUNTERPROC>("glQueryCounter", Null_glQueryCounter)),
-		GetQueryObjecti64v(GetProc<PFNGLGETQUERYOBJECTI64VPROC>("glGetQueryObjecti64v", Null_glGetQueryObjecti64v)),
-		GetQueryObjectui64v(GetProc<PFNGLGETQUERYOBJECTUI64VPROC>("glGetQueryObjectui64v", Null_glGetQueryObjectui64v)),
-		VertexAttribDivisor(GetProc<PFNGLVERTEXATTRIBDIVISORPROC>("glVertexAttribDivisor", Null_glVertexAttribDivisor)),
-		VertexAttribP1ui(GetProc<PFNGLVERTEXATTRIBP1UIPROC>("glVertexAttribP1ui", Null_glVertexAttribP1ui)),
-		VertexAttribP1uiv(GetProc<PFNGLVERTEXATTRIBP1UIVPROC>("glVertexAttribP1uiv", Null_glVertexAttribP1uiv)),
-		VertexAttribP2ui(GetProc<PFNGLVERTEXATTRIBP2UIPROC>("glVertexAttribP2ui", Null_glVertexAttribP2ui)),
-		VertexAttribP2uiv(GetProc<PFNGLVERTEXATTRIBP2UIVPROC>("glVertexAttribP2uiv", Null_glVertexAttribP2uiv)),
-		VertexAttribP3ui(GetProc<PFNGLVERTEXATTRIBP3UIPROC>("glVertexAttribP3ui", Null_glVertexAttribP3ui)),
-		VertexAttribP3uiv(GetProc<PFNGLVERTEXATTRIBP3UIVPROC>("glVertexAttribP3uiv", Null_glVertexAttribP3uiv)),
-		VertexAttribP4ui(GetProc<PFNGLVERTEXATTRIBP4UIPROC>("glVertexAttribP4ui", Null_glVertexAttribP4ui)),
-		VertexAttribP4uiv(GetProc<PFNGLVERTEXATTRIBP4UIVPROC>("glVertexAttribP4uiv", Null_glVertexAttribP4uiv)),
-		VertexP2ui(GetProc<PFNGLVERTEXP2UIPROC>("glVertexP2ui", Null_glVertexP2ui)),
-		VertexP2uiv(GetProc<PFNGLVERTEXP2UIVPROC>("glVertexP2uiv", Null_glVertexP2uiv)),
-		VertexP3ui(GetProc<PFNGLVERTEXP3UIPROC>("glVertexP3ui", Null_glVertexP3ui)),
-		VertexP3uiv(GetProc<PFNGLVERTEXP3UIVPROC>("glVertexP3uiv", Null_glVertexP3uiv)),
-		VertexP4ui(GetProc<PFNGLVERTEXP4UIPROC>("glVertexP4ui", Null_glVertexP4ui)),
-		VertexP4uiv(GetProc<PFNGLVERTEXP4UIVPROC>("glVertexP4uiv", Null_glVertexP4uiv)),
-		TexCoordP1ui(GetProc<PFNGLTEXCOORDP1UIPROC>("glTexCoordP1ui", Null_glTexCoordP1ui)),
-		TexCoordP1uiv(GetProc<PFNGLTEXCOORDP1UIVPROC>("glTexCoordP1uiv", Null_glTexCoordP1uiv)),
-		TexCoordP2ui(GetProc<PFNGLTEXCOORDP2UIPROC>("glTexCoordP2ui", Null_glTexCoordP2ui)),
-		TexCoordP2uiv(GetProc<PFNGLTEXCOORDP2UIVPROC>("glTexCoordP2uiv", Null_glTexCoordP2uiv)),
-		TexCoordP3ui(GetProc<PFNGLTEXCOORDP3UIPROC>("glTexCoordP3ui", Null_glTexCoordP3ui)),
-		TexCoordP3uiv(GetProc<PFNGLTEXCOORDP3UIVPROC>("glTexCoordP3uiv", Null_glTexCoordP3uiv)),
-		TexCoordP4ui(GetProc<PFNGLTEXCOORDP4UIPROC>("glTexCoordP4ui", Null_glTexCoordP4ui)),
-		TexCoordP4uiv(GetProc<PFNGLTEXCOORDP4UIVPROC>("glTexCoordP4uiv", Null_glTexCoordP4uiv)),
-		MultiTexCoordP1ui(GetProc<PFNGLMULTITEXCOORDP1UIPROC>("glMultiTexCoordP1ui", Null_glMultiTexCoordP1ui)),
-		MultiTexCoordP1uiv(GetProc<PFNGLMULTITEXCOORDP1UIVPROC>("glMultiTexCoordP1uiv", Null_glMultiTexCoordP1uiv)),
-		MultiTexCoordP2ui(GetProc<PFNGLMULTITEXCOORDP2UIPROC>("glMultiTexCoordP2ui", Null_glMultiTexCoordP2ui)),
-		MultiTexCoordP2uiv(GetProc<PFNGLMULTITEXCOORDP2UIVPROC>("glMultiTexCoordP2uiv", Null_glMultiTexCoordP2uiv)),
-		MultiTexCoordP3ui(GetProc<PFNGLMULTITEXCOORDP3UIPROC>("glMultiTexCoordP3ui", Null_glMultiTexCoordP3ui)),
-		MultiTexCoordP3uiv(GetProc<PFNGLMULTITEXCOORDP3UIVPROC>("glMultiTexCoordP3uiv", Null_glMultiTexCoordP3uiv)),
-		MultiTexCoordP4ui(GetProc<PFNGLMULTITEXCOORDP4UIPROC>("glMultiTexCoordP4ui", Null_glMultiTexCoordP4ui)),
-		MultiTexCoordP4uiv(GetProc<PFNGLMULTITEXCOORDP4UIVPROC>("glMultiTexCoordP4uiv", Null_glMultiTexCoordP4uiv)),
-		NormalP3ui(GetProc<PFNGLNORMALP3UIPROC>("glNormalP3ui", Null_glNormalP3ui)),
-		NormalP3uiv(GetProc<PFNGLNORMALP3UIVPROC>("glNormalP3uiv", Null_glNormalP3uiv)),
-		ColorP3ui(GetProc<PFNGLCOLORP3UIPROC>("glColorP3ui", Null_glColorP3ui)),
-		ColorP3uiv(GetProc<PFNGLCOLORP3UIVPROC>("glColorP3uiv", Null_glColorP3uiv)),
-		ColorP4ui(GetProc<PFNGLCOLORP4UIPROC>("glColorP4ui", Null_glColorP4ui)),
-		ColorP4uiv(GetProc<PFNGLCOLORP4UIVPROC>("glColorP4uiv", Null_glColorP4uiv)),
-		SecondaryColorP3ui(GetProc<PFNGLSECONDARYCOLORP3UIPROC>("glSecondaryColorP3ui", Null_glSecondaryColorP3ui)),
-		SecondaryColorP3uiv(GetProc<PFNGLSECONDARYCOLORP3UIVPROC>("glSecondaryColorP3uiv", Null_glSecondaryColorP3uiv))
+	static void Resolve_glBindFragDataLocationIndexed(Version46& c){ c.BindFragDataLocationIndexed = c.GetProc<decltype(c.BindFragDataLocationIndexed)>("glBindFragDataLocationIndexed", Null_glBindFragDataLocationIndexed); }
+	static void Resolve_glGetFragDataIndex(Version46& c){ c.GetFragDataIndex = c.GetProc<decltype(c.GetFragDataIndex)>("glGetFragDataIndex", Null_glGetFragDataIndex); }
+	static void Resolve_glGenSamplers(Version46& c){ c.GenSamplers = c.GetProc<decltype(c.GenSamplers)>("glGenSamplers", Null_glGenSamplers); }
+	static void Resolve_glDeleteSamplers(Version46& c){ c.DeleteSamplers = c.GetProc<decltype(c.DeleteSamplers)>("glDeleteSamplers", Null_glDeleteSamplers); }
+	static void Resolve_glIsSampler(Version46& c){ c.IsSampler = c.GetProc<decltype(c.IsSampler)>("glIsSampler", Null_glIsSampler); }
+	static void Resolve_glBindSampler(Version46& c){ c.BindSampler = c.GetProc<decltype(c.BindSampler)>("glBindSampler", Null_glBindSampler); }
+	static void Resolve_glSamplerParameteri(Version46& c){ c.SamplerParameteri = c.GetProc<decltype(c.SamplerParameteri)>("glSamplerParameteri", Null_glSamplerParameteri); }
+	static void Resolve_glSamplerParameteriv(Version46& c){ c.SamplerParameteriv = c.GetProc<decltype(c.SamplerParameteriv)>("glSamplerParameteriv", Null_glSamplerParameteriv); }
+	static void Resolve_glSamplerParameterf(Version46& c){ c.SamplerParameterf = c.GetProc<decltype(c.SamplerParameterf)>("glSamplerParameterf", Null_glSamplerParameterf); }
+	static void Resolve_glSamplerParameterfv(Version46& c){ c.SamplerParameterfv = c.GetProc<decltype(c.SamplerParameterfv)>("glSamplerParameterfv", Null_glSamplerParameterfv); }
+	static void Resolve_glSamplerParameterIiv(Version46& c){ c.SamplerParameterIiv = c.GetProc<decltype(c.SamplerParameterIiv)>("glSamplerParameterIiv", Null_glSamplerParameterIiv); }
+	static void Resolve_glSamplerParameterIuiv(Version46& c){ c.SamplerParameterIuiv = c.GetProc<decltype(c.SamplerParameterIuiv)>("glSamplerParameterIuiv", Null_glSamplerParameterIuiv); }
+	static void Resolve_glGetSamplerParameteriv(Version46& c){ c.GetSamplerParameteriv = c.GetProc<decltype(c.GetSamplerParameteriv)>("glGetSamplerParameteriv", Null_glGetSamplerParameteriv); }
+	static void Resolve_glGetSamplerParameterIiv(Version46& c){ c.GetSamplerParameterIiv = c.GetProc<decltype(c.GetSamplerParameterIiv)>("glGetSamplerParameterIiv", Null_glGetSamplerParameterIiv); }
+	static void Resolve_glGetSamplerParameterfv(Version46& c){ c.GetSamplerParameterfv = c.GetProc<decltype(c.GetSamplerParameterfv)>("glGetSamplerParameterfv", Null_glGetSamplerParameterfv); }
+	static void Resolve_glGetSamplerParameterIuiv(Version46& c){ c.GetSamplerParameterIuiv = c.GetProc<decltype(c.GetSamplerParameterIuiv)>("glGetSamplerParameterIuiv", Null_glGetSamplerParameterIuiv); }
+	static void Resolve_glQueryCounter(Version46& c){ c.QueryCounter = c.GetProc<decltype(c.QueryCounter)>("glQueryCounter", Null_glQueryCounter); }
+	static void Resolve_glGetQueryObjecti64v(Version46& c){ c.GetQueryObjecti64v = c.GetProc<decltype(c.GetQueryObjecti64v)>("glGetQueryObjecti64v", Null_glGetQueryObjecti64v); }
+	static void Resolve_glGetQueryObjectui64v(Version46& c){ c.GetQueryObjectui64v = c.GetProc<decltype(c.GetQueryObjectui64v)>("glGetQueryObjectui64v", Null_glGetQueryObjectui64v); }
+	static void Resolve_glVertexAttribDivisor(Version46& c){ c.VertexAttribDivisor = c.GetProc<decltype(c.VertexAttribDivisor)>("glVertexAttribDivisor", Null_glVertexAttribDivisor); }
+	static void Resolve_glVertexAttribP1ui(Version46& c){ c.VertexAttribP1ui = c.GetProc<decltype(c.VertexAttribP1ui)>("glVertexAttribP1ui", Null_glVertexAttribP1ui); }
+	static void Resolve_glVertexAttribP1uiv(Version46& c){ c.VertexAttribP1uiv = c.GetProc<decltype(c.VertexAttribP1uiv)>("glVertexAttribP1uiv", Null_glVertexAttribP1uiv); }
+	static void Resolve_glVertexAttribP2ui(Version46& c){ c.VertexAttribP2ui = c.GetProc<decltype(c.VertexAttribP2ui)>("glVertexAttribP2ui", Null_glVertexAttribP2ui); }
+	static void Resolve_glVertexAttribP2uiv(Version46& c){ c.VertexAttribP2uiv = c.GetProc<decltype(c.VertexAttribP2uiv)>("glVertexAttribP2uiv", Null_glVertexAttribP2uiv); }
+	static void Resolve_glVertexAttribP3ui(Version46& c){ c.VertexAttribP3ui = c.GetProc<decltype(c.VertexAttribP3ui)>("glVertexAttribP3ui", Null_glVertexAttribP3ui); }
+	static void Resolve_glVertexAttribP3uiv(Version46& c){ c.VertexAttribP3uiv = c.GetProc<decltype(c.VertexAttribP3uiv)>("glVertexAttribP3uiv", Null_glVertexAttribP3uiv); }
+	static void Resolve_glVertexAttribP4ui(Version46& c){ c.VertexAttribP4ui = c.GetProc<decltype(c.VertexAttribP4ui)>("glVertexAttribP4ui", Null_glVertexAttribP4ui); }
+	static void Resolve_glVertexAttribP4uiv(Version46& c){ c.VertexAttribP4uiv = c.GetProc<decltype(c.VertexAttribP4uiv)>("glVertexAttribP4uiv", Null_glVertexAttribP4uiv); }
+	static void Resolve_glVertexP2ui(Version46& c){ c.VertexP2ui = c.GetProc<decltype(c.VertexP2ui)>("glVertexP2ui", Null_glVertexP2ui); }
+	static void Resolve_glVertexP2uiv(Version46& c){ c.VertexP2uiv = c.GetProc<decltype(c.VertexP2uiv)>("glVertexP2uiv", Null_glVertexP2uiv); }
+	static void Resolve_glVertexP3ui(Version46& c){ c.VertexP3ui = c.GetProc<decltype(c.VertexP3ui)>("glVertexP3ui", Null_glVertexP3ui); }
+	static void Resolve_glVertexP3uiv(Version46& c){ c.VertexP3uiv = c.GetProc<decltype(c.VertexP3uiv)>("glVertexP3uiv", Null_glVertexP3uiv); }
+	static void Resolve_glVertexP4ui(Version46& c){ c.VertexP4ui = c.GetProc<decltype(c.VertexP4ui)>("glVertexP4ui", Null_glVertexP4ui); }
+	static void Resolve_glVertexP4uiv(Version46& c){ c.VertexP4uiv = c.GetProc<decltype(c.VertexP4uiv)>("glVertexP4uiv", Null_glVertexP4uiv); }
+	static void Resolve_glTexCoordP1ui(Version46& c){ c.TexCoordP1ui = c.GetProc<decltype(c.TexCoordP1ui)>("glTexCoordP1ui", Null_glTexCoordP1ui); }
+	static void Resolve_glTexCoordP1uiv(Version46& c){ c.TexCoordP1uiv = c.GetProc<decltype(c.TexCoordP1uiv)>("glTexCoordP1uiv", Null_glTexCoordP1uiv); }
+	static void Resolve_glTexCoordP2ui(Version46& c){ c.TexCoordP2ui = c.GetProc<decltype(c.TexCoordP2ui)>("glTexCoordP2ui", Null_glTexCoordP2ui); }
+	static void Resolve_glTexCoordP2uiv(Version46& c){ c.TexCoordP2uiv = c.GetProc<decltype(c.TexCoordP2uiv)>("glTexCoordP2uiv", Null_glTexCoordP2uiv); }
+	static void Resolve_glTexCoordP3ui(Version46& c){ c.TexCoordP3ui = c.GetProc<decltype(c.TexCoordP3ui)>("glTexCoordP3ui", Null_glTexCoordP3ui); }
+	static void Resolve_glTexCoordP3uiv(Version46& c){ c.TexCoordP3uiv = c.GetProc<decltype(c.TexCoordP3uiv)>("glTexCoordP3uiv", Null_glTexCoordP3uiv); }
+	static void Resolve_glTexCoordP4ui(Version46& c){ c.TexCoordP4ui = c.GetProc<decltype(c.TexCoordP4ui)>("glTexCoordP4ui", Null_glTexCoordP4ui); }
+	static void Resolve_glTexCoordP4uiv(Version46& c){ c.TexCoordP4uiv = c.GetProc<decltype(c.TexCoordP4uiv)>("glTexCoordP4uiv", Null_glTexCoordP4uiv); }
+	static void Resolve_glMultiTexCoordP1ui(Version46& c){ c.MultiTexCoordP1ui = c.GetProc<decltype(c.MultiTexCoordP1ui)>("glMultiTexCoordP1ui", Null_glMultiTexCoordP1ui); }
+	static void Resolve_glMultiTexCoordP1uiv(Version46& c){ c.MultiTexCoordP1uiv = c.GetProc<decltype(c.MultiTexCoordP1uiv)>("glMultiTexCoordP1uiv", Null_glMultiTexCoordP1uiv); }
+	static void Resolve_glMultiTexCoordP2ui(Version46& c){ c.MultiTexCoordP2ui = c.GetProc<decltype(c.MultiTexCoordP2ui)>("glMultiTexCoordP2ui", Null_glMultiTexCoordP2ui); }
+	static void Resolve_glMultiTexCoordP2uiv(Version46& c){ c.MultiTexCoordP2uiv = c.GetProc<decltype(c.MultiTexCoordP2uiv)>("glMultiTexCoordP2uiv", Null_glMultiTexCoordP2uiv); }
+	static void Resolve_glMultiTexCoordP3ui(Version46& c){ c.MultiTexCoordP3ui = c.GetProc<decltype(c.MultiTexCoordP3ui)>("glMultiTexCoordP3ui", Null_glMultiTexCoordP3ui); }
+	static void Resolve_glMultiTexCoordP3uiv(Version46& c){ c.MultiTexCoordP3uiv = c.GetProc<decltype(c.MultiTexCoordP3uiv)>("glMultiTexCoordP3uiv", Null_glMultiTexCoordP3uiv); }
+	static void Resolve_glMultiTexCoordP4ui(Version46& c){ c.MultiTexCoordP4ui = c.GetProc<decltype(c.MultiTexCoordP4ui)>("glMultiTexCoordP4ui", Null_glMultiTexCoordP4ui); }
+	static void Resolve_glMultiTexCoordP4uiv(Version46& c){ c.MultiTexCoordP4uiv = c.GetProc<decltype(c.MultiTexCoordP4uiv)>("glMultiTexCoordP4uiv", Null_glMultiTexCoordP4uiv); }
+	static void Resolve_glNormalP3ui(Version46& c){ c.NormalP3ui = c.GetProc<decltype(c.NormalP3ui)>("glNormalP3ui", Null_glNormalP3ui); }
+	static void Resolve_glNormalP3uiv(Version46& c){ c.NormalP3uiv = c.GetProc<decltype(c.NormalP3uiv)>("glNormalP3uiv", Null_glNormalP3uiv); }
+	static void Resolve_glColorP3ui(Version46& c){ c.ColorP3ui = c.GetProc<decltype(c.ColorP3ui)>("glColorP3ui", Null_glColorP3ui); }
+	static void Resolve_glColorP3uiv(Version46& c){ c.ColorP3uiv = c.GetProc<decltype(c.ColorP3uiv)>("glColorP3uiv", Null_glColorP3uiv); }
+	static void Resolve_glColorP4ui(Version46& c){ c.ColorP4ui = c.GetProc<decltype(c.ColorP4ui)>("glColorP4ui", Null_glColorP4ui); }
+	static void Resolve_glColorP4uiv(Version46& c){ c.ColorP4uiv = c.GetProc<decltype(c.ColorP4uiv)>("glColorP4uiv", Null_glColorP4uiv); }
+	static void Resolve_glSecondaryColorP3ui(Version46& c){ c.SecondaryColorP3ui = c.GetProc<decltype(c.SecondaryColorP3ui)>("glSecondaryColorP3ui", Null_glSecondaryColorP3ui); }
+	static void Resolve_glSecondaryColorP3uiv(Version46& c){ c.SecondaryColorP3uiv = c.GetProc<decltype(c.SecondaryColorP3uiv)>("glSecondaryColorP3uiv", Null_glSecondaryColorP3uiv); }
+	static void APIENTRY Lazy_glBindFragDataLocationIndexed (GLuint program, GLuint colorNumber, GLuint index, const GLchar* name){ auto& c = ResolveLazy(Resolve_glBindFragDataLocationIndexed, [](const Version46& c){ return c.BindFragDataLocationIndexed == Lazy_glBindFragDataLocationIndexed; }); return c.BindFragDataLocationIndexed(program, colorNumber, index, name); }
+	static GLint APIENTRY Lazy_glGetFragDataIndex (GLuint program, const GLchar* name){ auto& c = ResolveLazy(Resolve_glGetFragDataIndex, [](const Version46& c){ return c.GetFragDataIndex == Lazy_glGetFragDataIndex; }); return c.GetFragDataIndex(program, name); }
+	static void APIENTRY Lazy_glGenSamplers (GLsizei count, GLuint* samplers){ auto& c = ResolveLazy(Resolve_glGenSamplers, [](const Version46& c){ return c.GenSamplers == Lazy_glGenSamplers; }); return c.GenSamplers(count, samplers); }
+	static void APIENTRY Lazy_glDeleteSamplers (GLsizei count, const GLuint* samplers){ auto& c = ResolveLazy(Resolve_glDeleteSamplers, [](const Version46& c){ return c.DeleteSamplers == Lazy_glDeleteSamplers; }); return c.DeleteSamplers(count, samplers); }
+	static GLboolean APIENTRY Lazy_glIsSampler (GLuint sampler){ auto& c = ResolveLazy(Resolve_glIsSampler, [](const Version46& c){ return c.IsSampler == Lazy_glIsSampler; }); return c.IsSampler(sampler); }
+	static void APIENTRY Lazy_glBindSampler (GLuint unit, GLuint sampler){ auto& c = ResolveLazy(Resolve_glBindSampler, [](const Version46& c){ return c.BindSampler == Lazy_glBindSampler; }); return c.BindSampler(unit, sampler); }
+	static void APIENTRY Lazy_glSamplerParameteri (GLuint sampler, GLenum pname, GLint param){ auto& c = ResolveLazy(Resolve_glSamplerParameteri, [](const Version46& c){ return c.SamplerParameteri == Lazy_glSamplerParameteri; }); return c.SamplerParameteri(sampler, pname, param); }
+	static void APIENTRY Lazy_glSamplerParameteriv (GLuint sampler, GLenum pname, const GLint* param){ auto& c = ResolveLazy(Resolve_glSamplerParameteriv, [](const Version46& c){ return c.SamplerParameteriv == Lazy_glSamplerParameteriv; }); return c.SamplerParameteriv(sampler, pname, param); }
+	static void APIENTRY Lazy_glSamplerParameterf (GLuint sampler, GLenum pname, GLfloat param){ auto& c = ResolveLazy(Resolve_glSamplerParameterf, [](const Version46& c){ return c.SamplerParameterf == Lazy_glSamplerParameterf; }); return c.SamplerParameterf(sampler, pname, param); }
+	static void APIENTRY Lazy_glSamplerParameterfv (GLuint sampler, GLenum pname, const GLfloat* param){ auto& c = ResolveLazy(Resolve_glSamplerParameterfv, [](const Version46& c){ return c.SamplerParameterfv == Lazy_glSamplerParameterfv; }); return c.SamplerParameterfv(sampler, pname, param); }
+	static void APIENTRY Lazy_glSamplerParameterIiv (GLuint sampler, GLenum pname, const GLint* param){ auto& c = ResolveLazy(Resolve_glSamplerParameterIiv, [](const Version46& c){ return c.SamplerParameterIiv == Lazy_glSamplerParameterIiv; }); return c.SamplerParameterIiv(sampler, pname, param); }
+	static void APIENTRY Lazy_glSamplerParameterIuiv (GLuint sampler, GLenum pname, const GLuint* param){ auto& c = ResolveLazy(Resolve_glSamplerParameterIuiv, [](const Version46& c){ return c.SamplerParameterIuiv == Lazy_glSamplerParameterIuiv; }); return c.SamplerParameterIuiv(sampler, pname, param); }
+	static void APIENTRY Lazy_glGetSamplerParameteriv (GLuint sampler, GLenum pname, GLint* params){ auto& c = ResolveLazy(Resolve_glGetSamplerParameteriv, [](const Version46& c){ return c.GetSamplerParameteriv == Lazy_glGetSamplerParameteriv; }); return c.GetSamplerParameteriv(sampler, pname, params); }
+	static void APIENTRY Lazy_glGetSamplerParameterIiv (GLuint sampler, GLenum pname, GLint* params){ auto& c = ResolveLazy(Resolve_glGetSamplerParameterIiv, [](const Version46& c){ return c.GetSamplerParameterIiv == Lazy_glGetSamplerParameterIiv; }); return c.GetSamplerParameterIiv(sampler, pname, params); }
+	static void APIENTRY Lazy_glGetSamplerParameterfv (GLuint sampler, GLenum pname, GLfloat* params){ auto& c = ResolveLazy(Resolve_glGetSamplerParameterfv, [](const Version46& c){ return c.GetSamplerParameterfv == Lazy_glGetSamplerParameterfv; }); return c.GetSamplerParameterfv(sampler, pname, params); }
+	static void APIENTRY Lazy_glGetSamplerParameterIuiv (GLuint sampler, GLenum pname, GLuint* params){ auto& c = ResolveLazy(Resolve_glGetSamplerParameterIuiv, [](const Version46& c){ return c.GetSamplerParameterIuiv == Lazy_glGetSamplerParameterIuiv; }); return c.GetSamplerParameterIuiv(sampler, pname, params); }
+	static void APIENTRY Lazy_glQueryCounter (GLuint id, GLenum target){ auto& c = ResolveLazy(Resolve_glQueryCounter, [](const Version46& c){ return c.QueryCounter == Lazy_glQueryCounter; }); return c.QueryCounter(id, target); }
+	static void APIENTRY Lazy_glGetQueryObjecti64v (GLuint id, GLenum pname, GLint64* params){ auto& c = ResolveLazy(Resolve_glGetQueryObjecti64v, [](const Version46& c){ return c.GetQueryObjecti64v == Lazy_glGetQueryObjecti64v; }); return c.GetQueryObjecti64v(id, pname, params); }
+	static void APIENTRY Lazy_glGetQueryObjectui64v (GLuint id, GLenum pname, GLuint64* params){ auto& c = ResolveLazy(Resolve_glGetQueryObjectui64v, [](const Version46& c){ return c.GetQueryObjectui64v == Lazy_glGetQueryObjectui64v; }); return c.GetQueryObjectui64v(id, pname, params); }
+	static void APIENTRY Lazy_glVertexAttribDivisor (GLuint index, GLuint divisor){ auto& c = ResolveLazy(Resolve_glVertexAttribDivisor, [](const Version46& c){ return c.VertexAttribDivisor == Lazy_glVertexAttribDivisor; }); return c.VertexAttribDivisor(index, divisor); }
+	static void APIENTRY Lazy_glVertexAttribP1ui (GLuint index, GLenum type, GLboolean normalized, GLuint value){ auto& c = ResolveLazy(Resolve_glVertexAttribP1ui, [](const Version46& c){ return c.VertexAttribP1ui == Lazy_glVertexAttribP1ui; }); return c.VertexAttribP1ui(index, type, normalized, value); }
+	static void APIENTRY Lazy_glVertexAttribP1uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint* value){ auto& c = ResolveLazy(Resolve_glVertexAttribP1uiv, [](const Version46& c){ return c.VertexAttribP1uiv == Lazy_glVertexAttribP1uiv; }); return c.VertexAttribP1uiv(index, type, normalized, value); }
+	static void APIENTRY Lazy_glVertexAttribP2ui (GLuint index, GLenum type, GLboolean normalized, GLuint value){ auto& c = ResolveLazy(Resolve_glVertexAttribP2ui, [](const Version46& c){ return c.VertexAttribP2ui == Lazy_glVertexAttribP2ui; }); return c.VertexAttribP2ui(index, type, normalized, value); }
+	static void APIENTRY Lazy_glVertexAttribP2uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint* value){ auto& c = ResolveLazy(Resolve_glVertexAttribP2uiv, [](const Version46& c){ return c.VertexAttribP2uiv == Lazy_glVertexAttribP2uiv; }); return c.VertexAttribP2uiv(index, type, normalized, value); }
+	static void APIENTRY Lazy_glVertexAttribP3ui (GLuint index, GLenum type, GLboolean normalized, GLuint value){ auto& c = ResolveLazy(Resolve_glVertexAttribP3ui, [](const Version46& c){ return c.VertexAttribP3ui == Lazy_glVertexAttribP3ui; }); return c.VertexAttribP3ui(index, type, normalized, value); }
+	static void APIENTRY Lazy_glVertexAttribP3uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint* value){ auto& c = ResolveLazy(Resolve_glVertexAttribP3uiv, [](const Version46& c){ return c.VertexAttribP3uiv == Lazy_glVertexAttribP3uiv; }); return c.VertexAttribP3uiv(index, type, normalized, value); }
+	static void APIENTRY Lazy_glVertexAttribP4ui (GLuint index, GLenum type, GLboolean normalized, GLuint value){ auto& c = ResolveLazy(Resolve_glVertexAttribP4ui, [](const Version46& c){ return c.VertexAttribP4ui == Lazy_glVertexAttribP4ui; }); return c.VertexAttribP4ui(index, type, normalized, value); }
+	static void APIENTRY Lazy_glVertexAttribP4uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint* value){ auto& c = ResolveLazy(Resolve_glVertexAttribP4uiv, [](const Version46& c){ return c.VertexAttribP4uiv == Lazy_glVertexAttribP4uiv; }); return c.VertexAttribP4uiv(index, type, normalized, value); }
+	static void APIENTRY Lazy_glVertexP2ui (GLenum type, GLuint value){ auto& c = ResolveLazy(Resolve_glVertexP2ui, [](const Version46& c){ return c.VertexP2ui == Lazy_glVertexP2ui; }); return c.VertexP2ui(type, value); }
+	static void APIENTRY Lazy_glVertexP2uiv (GLenum type, const GLuint* value){ auto& c = ResolveLazy(Resolve_glVertexP2uiv, [](const Version46& c){ return c.VertexP2uiv == Lazy_glVertexP2uiv; }); return c.VertexP2uiv(type, value); }
+	static void APIENTRY Lazy_glVertexP3ui (GLenum type, GLuint value){ auto& c = ResolveLazy(Resolve_glVertexP3ui, [](const Version46& c){ return c.VertexP3ui == Lazy_glVertexP3ui; }); return c.VertexP3ui(type, value); }
+	static void APIENTRY Lazy_glVertexP3uiv (GLenum type, const GLuint* value){ auto& c = ResolveLazy(Resolve_glVertexP3uiv, [](const Version46& c){ return c.VertexP3uiv == Lazy_glVertexP3uiv; }); return c.VertexP3uiv(type, value); }
+	static void APIENTRY Lazy_glVertexP4ui (GLenum type, GLuint value){ auto& c = ResolveLazy(Resolve_glVertexP4ui, [](const Version46& c){ return c.VertexP4ui == Lazy_glVertexP4ui; }); return c.VertexP4ui(type, value); }
+	static void APIENTRY Lazy_glVertexP4uiv (GLenum type, const GLuint* value){ auto& c = ResolveLazy(Resolve_glVertexP4uiv, [](const Version46& c){ return c.VertexP4uiv == Lazy_glVertexP4uiv; }); return c.VertexP4uiv(type, value); }
+	static void APIENTRY Lazy_glTexCoordP1ui (GLenum type, GLuint coords){ auto& c = ResolveLazy(Resolve_glTexCoordP1ui, [](const Version46& c){ return c.TexCoordP1ui == Lazy_glTexCoordP1ui; }); return c.TexCoordP1ui(type, coords); }
+	static void APIENTRY Lazy_glTexCoordP1uiv (GLenum type, const GLuint* coords){ auto& c = ResolveLazy(Resolve_glTexCoordP1uiv, [](const Version46& c){ return c.TexCoordP1uiv == Lazy_glTexCoordP1uiv; }); return c.TexCoordP1uiv(type, coords); }
+	static void APIENTRY Lazy_glTexCoordP2ui (GLenum type, GLuint coords){ auto& c = ResolveLazy(Resolve_glTexCoordP2ui, [](const Version46& c){ return c.TexCoordP2ui == Lazy_glTexCoordP2ui; }); return c.TexCoordP2ui(type, coords); }
+	static void APIENTRY Lazy_glTexCoordP2uiv (GLenum type, const GLuint* coords){ auto& c = ResolveLazy(Resolve_glTexCoordP2uiv, [](const Version46& c){ return c.TexCoordP2uiv == Lazy_glTexCoordP2uiv; }); return c.TexCoordP2uiv(type, coords); }
+	static void APIENTRY Lazy_glTexCoordP3ui (GLenum type, GLuint coords){ auto& c = ResolveLazy(Resolve_glTexCoordP3ui, [](const Version46& c){ return c.TexCoordP3ui == Lazy_glTexCoordP3ui; }); return c.TexCoordP3ui(type, coords); }
+	static void APIENTRY Lazy_glTexCoordP3uiv (GLenum type, const GLuint* coords){ auto& c = ResolveLazy(Resolve_glTexCoordP3uiv, [](const Version46& c){ return c.TexCoordP3uiv == Lazy_glTexCoordP3uiv; }); return c.TexCoordP3uiv(type, coords); }
+	static void APIENTRY Lazy_glTexCoordP4ui (GLenum type, GLuint coords){ auto& c = ResolveLazy(Resolve_glTexCoordP4ui, [](const Version46& c){ return c.TexCoordP4ui == Lazy_glTexCoordP4ui; }); return c.TexCoordP4ui(type, coords); }
+	static void APIENTRY Lazy_glTexCoordP4uiv (GLenum type, const GLuint* coords){ auto& c = ResolveLazy(Resolve_glTexCoordP4uiv, [](const Version46& c){ return c.TexCoordP4uiv == Lazy_glTexCoordP4uiv; }); return c.TexCoordP4uiv(type, coords); }
+	static void APIENTRY Lazy_glMultiTexCoordP1ui (GLenum texture, GLenum type, GLuint coords){ auto& c = ResolveLazy(Resolve_glMultiTexCoordP1ui, [](const Version46& c){ return c.MultiTexCoordP1ui == Lazy_glMultiTexCoordP1ui; }); return c.MultiTexCoordP1ui(texture, type, coords); }
+	static void APIENTRY Lazy_glMultiTexCoordP1uiv (GLenum texture, GLenum type, const GLuint* coords){ auto& c = ResolveLazy(Resolve_glMultiTexCoordP1uiv, [](const Version46& c){ return c.MultiTexCoordP1uiv == Lazy_glMultiTexCoordP1uiv; }); return c.MultiTexCoordP1uiv(texture, type, coords); }
+	static void APIENTRY Lazy_glMultiTexCoordP2ui (GLenum texture, GLenum type, GLuint coords){ auto& c = ResolveLazy(Resolve_glMultiTexCoordP2ui, [](const Version46& c){ return c.MultiTexCoordP2ui == Lazy_glMultiTexCoordP2ui; }); return c.MultiTexCoordP2ui(texture, type, coords); }
+	static void APIENTRY Lazy_glMultiTexCoordP2uiv (GLenum texture, GLenum type, const GLuint* coords){ auto& c = ResolveLazy(Resolve_glMultiTexCoordP2uiv, [](const Version46& c){ return c.MultiTexCoordP2uiv == Lazy_glMultiTexCoordP2uiv; }); return c.MultiTexCoordP2uiv(texture, type, coords); }
+	static void APIENTRY Lazy_glMultiTexCoordP3ui (GLenum texture, GLenum type, GLuint coords){ auto& c = ResolveLazy(Resolve_glMultiTexCoordP3ui, [](const Version46& c){ return c.MultiTexCoordP3ui == Lazy_glMultiTexCoordP3ui; }); return c.MultiTexCoordP3ui(texture, type, coords); }
+	static void APIENTRY Lazy_glMultiTexCoordP3uiv (GLenum texture, GLenum type, const GLuint* coords){ auto& c = ResolveLazy(Resolve_glMultiTexCoordP3uiv, [](const Version46& c){ return c.MultiTexCoordP3uiv == Lazy_glMultiTexCoordP3uiv; }); return c.MultiTexCoordP3uiv(texture, type, coords); }
+	static void APIENTRY Lazy_glMultiTexCoordP4ui (GLenum texture, GLenum type, GLuint coords){ auto& c = ResolveLazy(Resolve_glMultiTexCoordP4ui, [](const Version46& c){ return c.MultiTexCoordP4ui == Lazy_glMultiTexCoordP4ui; }); return c.MultiTexCoordP4ui(texture, type, coords); }
+	static void APIENTRY Lazy_glMultiTexCoordP4uiv (GLenum texture, GLenum type, const GLuint* coords){ auto& c = ResolveLazy(Resolve_glMultiTexCoordP4uiv, [](const Version46& c){ return c.MultiTexCoordP4uiv == Lazy_glMultiTexCoordP4uiv; }); return c.MultiTexCoordP4uiv(texture, type, coords); }
+	static void APIENTRY Lazy_glNormalP3ui (GLenum type, GLuint coords){ auto& c = ResolveLazy(Resolve_glNormalP3ui, [](const Version46& c){ return c.NormalP3ui == Lazy_glNormalP3ui; }); return c.NormalP3ui(type, coords); }
+	static void APIENTRY Lazy_glNormalP3uiv (GLenum type, const GLuint* coords){ auto& c = ResolveLazy(Resolve_glNormalP3uiv, [](const Version46& c){ return c.NormalP3uiv == Lazy_glNormalP3uiv; }); return c.NormalP3uiv(type, coords); }
+	static void APIENTRY Lazy_glColorP3ui (GLenum type, GLuint color){ auto& c = ResolveLazy(Resolve_glColorP3ui, [](const Version46& c){ return c.ColorP3ui == Lazy_glColorP3ui; }); return c.ColorP3ui(type, color); }
+	static void APIENTRY Lazy_glColorP3uiv (GLenum type, const GLuint* color){ auto& c = ResolveLazy(Resolve_glColorP3uiv, [](const Version46& c){ return c.ColorP3uiv == Lazy_glColorP3uiv; }); return c.ColorP3uiv(type, color); }
+	static void APIENTRY Lazy_glColorP4ui (GLenum type, GLuint color){ auto& c = ResolveLazy(Resolve_glColorP4ui, [](const Version46& c){ return c.ColorP4ui == Lazy_glColorP4ui; }); return c.ColorP4ui(type, color); }
+	static void APIENTRY Lazy_glColorP4uiv (GLenum type, const GLuint* color){ auto& c = ResolveLazy(Resolve_glColorP4uiv, [](const Version46& c){ return c.ColorP4uiv == Lazy_glColorP4uiv; }); return c.ColorP4uiv(type, color); }
+	static void APIENTRY Lazy_glSecondaryColorP3ui (GLenum type, GLuint color){ auto& c = ResolveLazy(Resolve_glSecondaryColorP3ui, [](const Version46& c){ return c.SecondaryColorP3ui == Lazy_glSecondaryColorP3ui; }); return c.SecondaryColorP3ui(type, color); }
+	static void APIENTRY Lazy_glSecondaryColorP3uiv (GLenum type, const GLuint* color){ auto& c = ResolveLazy(Resolve_glSecondaryColorP3uiv, [](const Version46& c){ return c.SecondaryColorP3uiv == Lazy_glSecondaryColorP3uiv; }); return c.SecondaryColorP3uiv(type, color); }
+	Version33::Version33(Func_GetProcAddress GetProcAddress, LoadMode Mode):
+		Version32(GetProcAddress, Mode),
+		BindFragDataLocationIndexed(GetProc<PFNGLBINDFRAGDATALOCATIONINDEXEDPROC>("glBindFragDataLocationIndexed", Null_glBindFragDataLocationIndexed, Lazy_glBindFragDataLocationIndexed)),
+		GetFragDataIndex(GetProc<PFNGLGETFRAGDATAINDEXPROC>("glGetFragDataIndex", Null_glGetFragDataIndex, Lazy_glGetFragDataIndex)),
+		GenSamplers(GetProc<PFNGLGENSAMPLERSPROC>("glGenSamplers", Null_glGenSamplers, Lazy_glGenSamplers)),
+		DeleteSamplers(GetProc<PFNGLDELETESAMPLERSPROC>("glDeleteSamplers", Null_glDeleteSamplers, Lazy_glDeleteSamplers)),
+		IsSampler(GetProc<PFNGLISSAMPLERPROC>("glIsSampler", Null_glIsSampler, Lazy_glIsSampler)),
+		BindSampler(GetProc<PFNGLBINDSAMPLERPROC>("glBindSampler", Null_glBindSampler, Lazy_glBindSampler)),
+		SamplerParameteri(GetProc<PFNGLSAMPLERPARAMETERIPROC>("glSamplerParameteri", Null_glSamplerParameteri, Lazy_glSamplerParameteri)),
+		SamplerParameteriv(GetProc<PFNGLSAMPLERPARAMETERIVPROC>("glSamplerParameteriv", Null_glSamplerParameteriv, Lazy_glSamplerParameteriv)),
+		SamplerParameterf(GetProc<PFNGLSAMPLERPARAMETERFPROC>("glSamplerParameterf", Null_glSamplerParameterf, Lazy_glSamplerParameterf)),
+		SamplerParameterfv(GetProc<PFNGLSAMPLERPARAMETERFVPROC>("glSamplerParameterfv", Null_glSamplerParameterfv, Lazy_glSamplerParameterfv)),
+		SamplerParameterIiv(GetProc<PFNGLSAMPLERPARAMETERIIVPROC>("glSamplerParameterIiv", Null_glSamplerParameterIiv, Lazy_glSamplerParameterIiv)),
+		SamplerParameterIuiv(GetProc<PFNGLSAMPLERPARAMETERIUIVPROC>("glSamplerParameterIuiv", Null_glSamplerParameterIuiv, Lazy_glSamplerParameterIuiv)),
+		GetSamplerParameteriv(GetProc<PFNGLGETSAMPLERPARAMETERIVPROC>("glGetSamplerParameteriv", Null_glGetSamplerParameteriv, Lazy_glGetSamplerParameteriv)),
+		GetSamplerParameterIiv(GetProc<PFNGLGETSAMPLERPARAMETERIIVPROC>("glGetSamplerParameterIiv", Null_glGetSamplerParameterIiv, Lazy_glGetSamplerParameterIiv)),
+		GetSamplerParameterfv(GetProc<PFNGLGETSAMPLERPARAMETERFVPROC>("glGetSamplerParameterfv", Null_glGetSamplerParameterfv, Lazy_glGetSamplerParameterfv)),
+		GetSamplerParameterIuiv(GetProc<PFNGLGETSAMPLERPARAMETERIUIVPROC>("glGetSamplerParameterIuiv", Null_glGetSamplerParameterIuiv, Lazy_glGetSamplerParameterIuiv)),
+		QueryCounter(GetProc<PFNGLQUERYCOUNTERPROC>("glQueryCounter", Null_glQueryCounter, Lazy_glQueryCounter)),
+		GetQueryObjecti64v(GetProc<PFNGLGETQUERYOBJECTI64VPROC>("glGetQueryObjecti64v", Null_glGetQueryObjecti64v, Lazy_glGetQueryObjecti64v)),
+		GetQueryObjectui64v(GetProc<PFNGLGETQUERYOBJECTUI64VPROC>("glGetQueryObjectui64v", Null_glGetQueryObjectui64v, Lazy_glGetQueryObjectui64v)),
+		VertexAttribDivisor(GetProc<PFNGLVERTEXATTRIBDIVISORPROC>("glVertexAttribDivisor", Null_glVertexAttribDivisor, Lazy_glVertexAttribDivisor)),
+		VertexAttribP1ui(GetProc<PFNGLVERTEXATTRIBP1UIPROC>("glVertexAttribP1ui", Null_glVertexAttribP1ui, Lazy_glVertexAttribP1ui)),
+		VertexAttribP1uiv(GetProc<PFNGLVERTEXATTRIBP1UIVPROC>("glVertexAttribP1uiv", Null_glVertexAttribP1uiv, Lazy_glVertexAttribP1uiv)),
+		VertexAttribP2ui(GetProc<PFNGLVERTEXATTRIBP2UIPROC>("glVertexAttribP2ui", Null_glVertexAttribP2ui, Lazy_glVertexAttribP2ui)),
+		VertexAttribP2uiv(GetProc<PFNGLVERTEXATTRIBP2UIVPROC>("glVertexAttribP2uiv", Null_glVertexAttribP2uiv, Lazy_glVertexAttribP2uiv)),
+		VertexAttribP3ui(GetProc<PFNGLVERTEXATTRIBP3UIPROC>("glVertexAttribP3ui", Null_glVertexAttribP3ui, Lazy_glVertexAttribP3ui)),
+		VertexAttribP3uiv(GetProc<PFNGLVERTEXATTRIBP3UIVPROC>("glVertexAttribP3uiv", Null_glVertexAttribP3uiv, Lazy_glVertexAttribP3uiv)),
+		VertexAttribP4ui(GetProc<PFNGLVERTEXATTRIBP4UIPROC>("glVertexAttribP4ui", Null_glVertexAttribP4ui, Lazy_glVertexAttribP4ui)),
+		VertexAttribP4uiv(GetProc<PFNGLVERTEXATTRIBP4UIVPROC>("glVertexAttribP4uiv", Null_glVertexAttribP4uiv, Lazy_glVertexAttribP4uiv)),
+		VertexP2ui(GetProc<PFNGLVERTEXP2UIPROC>("glVertexP2ui", Null_glVertexP2ui, Lazy_glVertexP2ui)),
+		VertexP2uiv(GetProc<PFNGLVERTEXP2UIVPROC>("glVertexP2uiv", Null_glVertexP2uiv, Lazy_glVertexP2uiv)),
+		VertexP3ui(GetProc<PFNGLVERTEXP3UIPROC>("glVertexP3ui", Null_glVertexP3ui, Lazy_glVertexP3ui)),
+		VertexP3uiv(GetProc<PFNGLVERTEXP3UIVPROC>("glVertexP3uiv", Null_glVertexP3uiv, Lazy_glVertexP3uiv)),
+		VertexP4ui(GetProc<PFNGLVERTEXP4UIPROC>("glVertexP4ui", Null_glVertexP4ui, Lazy_glVertexP4ui)),
+		VertexP4uiv(GetProc<PFNGLVERTEXP4UIVPROC>("glVertexP4uiv", Null_glVertexP4uiv, Lazy_glVertexP4uiv)),
+		TexCoordP1ui(GetProc<PFNGLTEXCOORDP1UIPROC>("glTexCoordP1ui", Null_glTexCoordP1ui, Lazy_glTexCoordP1ui)),
+		TexCoordP1uiv(GetProc<PFNGLTEXCOORDP1UIVPROC>("glTexCoordP1uiv", Null_glTexCoordP1uiv, Lazy_glTexCoordP1uiv)),
+		TexCoordP2ui(GetProc<PFNGLTEXCOORDP2UIPROC>("glTexCoordP2ui", Null_glTexCoordP2ui, Lazy_glTexCoordP2ui)),
+		TexCoordP2uiv(GetProc<PFNGLTEXCOORDP2UIVPROC>("glTexCoordP2uiv", Null_glTexCoordP2uiv, Lazy_glTexCoordP2uiv)),
+		TexCoordP3ui(GetProc<PFNGLTEXCOORDP3UIPROC>("glTexCoordP3ui", Null_glTexCoordP3ui, Lazy_glTexCoordP3ui)),
+		TexCoordP3uiv(GetProc<PFNGLTEXCOORDP3UIVPROC>("glTexCoordP3uiv", Null_glTexCoordP3uiv, Lazy_glTexCoordP3uiv)),
+		TexCoordP4ui(GetProc<PFNGLTEXCOORDP4UIPROC>("glTexCoordP4ui", Null_glTexCoordP4ui, Lazy_glTexCoordP4ui)),
+		TexCoordP4uiv(GetProc<PFNGLTEXCOORDP4UIVPROC>("glTexCoordP4uiv", Null_glTexCoordP4uiv, Lazy_glTexCoordP4uiv)),
+		MultiTexCoordP1ui(GetProc<PFNGLMULTITEXCOORDP1UIPROC>("glMultiTexCoordP1ui", Null_glMultiTexCoordP1ui, Lazy_glMultiTexCoordP1ui)),
+		MultiTexCoordP1uiv(GetProc<PFNGLMULTITEXCOORDP1UIVPROC>("glMultiTexCoordP1uiv", Null_glMultiTexCoordP1uiv, Lazy_glMultiTexCoordP1uiv)),
+		MultiTexCoordP2ui(GetProc<PFNGLMULTITEXCOORDP2UIPROC>("glMultiTexCoordP2ui", Null_glMultiTexCoordP2ui, Lazy_glMultiTexCoordP2ui)),
+		MultiTexCoordP2uiv(GetProc<PFNGLMULTITEXCOORDP2UIVPROC>("glMultiTexCoordP2uiv", Null_glMultiTexCoordP2uiv, Lazy_glMultiTexCoordP2uiv)),
+		MultiTexCoordP3ui(GetProc<PFNGLMULTITEXCOORDP3UIPROC>("glMultiTexCoordP3ui", Null_glMultiTexCoordP3ui, Lazy_glMultiTexCoordP3ui)),
+		MultiTexCoordP3uiv(GetProc<PFNGLMULTITEXCOORDP3UIVPROC>("glMultiTexCoordP3uiv", Null_glMultiTexCoordP3uiv, Lazy_glMultiTexCoordP3uiv)),
+		MultiTexCoordP4ui(GetProc<PFNGLMULTITEXCOORDP4UIPROC>("glMultiTexCoordP4ui", Null_glMultiTexCoordP4ui, Lazy_glMultiTexCoordP4ui)),
+		MultiTexCoordP4uiv(GetProc<PFNGLMULTITEXCOORDP4UIVPROC>("glMultiTexCoordP4uiv", Null_glMultiTexCoordP4uiv, Lazy_glMultiTexCoordP4uiv)),
+		NormalP3ui(GetProc<PFNGLNORMALP3UIPROC>("glNormalP3ui", Null_glNormalP3ui, Lazy_glNormalP3ui)),
+		NormalP3uiv(GetProc<PFNGLNORMALP3UIVPROC>("glNormalP3uiv", Null_glNormalP3uiv, Lazy_glNormalP3uiv)),
+		ColorP3ui(GetProc<PFNGLCOLORP3UIPROC>("glColorP3ui", Null_glColorP3ui, Lazy_glColorP3ui)),
+		ColorP3uiv(GetProc<PFNGLCOLORP3UIVPROC>("glColorP3uiv", Null_glColorP3uiv, Lazy_glColorP3uiv)),
+		ColorP4ui(GetProc<PFNGLCOLORP4UIPROC>("glColorP4ui", Null_glColorP4ui, Lazy_glColorP4ui)),
+		ColorP4uiv(GetProc<PFNGLCOLORP4UIVPROC>("glColorP4uiv", Null_glColorP4uiv, Lazy_glColorP4uiv)),
+		SecondaryColorP3ui(GetProc<PFNGLSECONDARYCOLORP3UIPROC>("glSecondaryColorP3ui", Null_glSecondaryColorP3ui, Lazy_glSecondaryColorP3ui)),
+		SecondaryColorP3uiv(GetProc<PFNGLSECONDARYCOLORP3UIVPROC>("glSecondaryColorP3uiv", Null_glSecondaryColorP3uiv, Lazy_glSecondaryColorP3uiv))
 	{
 		Available = Ver_Major > 3 || (Ver_Major == 3 && (Ver_Minor > 3 || (Ver_Minor == 3 && Ver_Release >= 0)));
 	}
 
+	Version33::Version33(Func_GetProcAddress GetProcAddress):
+		Version33(GetProcAddress, LoadMode::Eager)
+	{
+	}
+
 
 	static void APIENTRY Null_glMinSampleShading (GLfloat value){ NullFuncPtr(); }
 	static void APIENTRY Null_glBlendEquationi (GLuint buf, GLenum mode){ NullFuncPtr(); }
@@ -1126,58 +2111,155 @@ namespace GL
 	static void APIENTRY Null_glBeginQueryIndexed (GLenum target, GLuint index, GLuint id){ NullFuncPtr(); }
 	static void APIENTRY Null_glEndQueryIndexed (GLenum target, GLuint index){ NullFuncPtr(); }
 	static void APIENTRY Null_glGetQueryIndexediv (GLenum target, GLuint index, GLenum pname, GLint* params){ NullFuncPtr(); }
-	Version40::Version40(Func_GetProcAddress GetProcAddress):
-		Version33(GetProcAddress),
-		MinSampleShading(GetProc<PFNGLMINSAMPLESHADINGPROC>("glMinSampleShading", Null_glMinSampleShading)),
-		BlendEquationi(GetProc<PFNGLBLENDEQUATIONIPROC>("glBlendEquationi", Null_glBlendEquationi)),
-		BlendEquationSeparatei(GetProc<PFNGLBLENDEQUATIONSEPARATEIPROC>("glBlendEquationSeparatei", Null_glBlendEquationSeparatei)),
-		BlendFunci(GetProc<PFNGLBLENDFUNCIPROC>("glBlendFunci", Null_glBlendFunci)),
-		BlendFuncSeparatei(GetProc<PFNGLBLENDFUNCSEPARATEIPROC>("glBlendFuncSeparatei", Null_glBlendFuncSeparatei)),
-		DrawArraysIndirect(GetProc<PFNGLDRAWARRAYSINDIRECTPROC>("glDrawArraysIndirect", Null_glDrawArraysIndirect)),
-		DrawElementsIndirect(GetProc<PFNGLDRAWELEMENTSINDIRECTPROC>("glDrawElementsIndirect", Null_glDrawElementsIndirect)),
-		Uniform1d(GetProc<PFNGLUNIFORM1DPROC>("glUniform1d", Null_glUniform1d)),
-		Uniform2d(GetProc<PFNGLUNIFORM2DPROC>("glUniform2d", Null_glUniform2d)),
-		Uniform3d(GetProc<PFNGLUNIFORM3DPROC>("glUniform3d", Null_glUniform3d)),
-		Uniform4d(GetProc<PFNGLUNIFORM4DPROC>("glUniform4d", Null_glUniform4d)),
-		Uniform1dv(GetProc<PFNGLUNIFORM1DVPROC>("glUniform1dv", Null_glUniform1dv)),
-		Uniform2dv(GetProc<PFNGLUNIFORM2DVPROC>("glUniform2dv", Null_glUniform2dv)),
-		Uniform3dv(GetProc<PFNGLUNIFORM3DVPROC>("glUniform3dv", Null_glUniform3dv)),
-		Uniform4dv(GetProc<PFNGLUNIFORM4DVPROC>("glUniform4dv", Null_glUniform4dv)),
-		UniformMatrix2dv(GetProc<PFNGLUNIFORMMATRIX2DVPROC>("glUniformMatrix2dv", Null_glUniformMatrix2dv)),
-		UniformMatrix3dv(GetProc<PFNGLUNIFORMMATRIX3DVPROC>("glUniformMatrix3dv", Null_glUniformMatrix3dv)),
-		UniformMatrix4dv(GetProc<PFNGLUNIFORMMATRIX4DVPROC>("glUniformMatrix4dv", Null_glUniformMatrix4dv)),
-		UniformMatrix2x3dv(GetProc<PFNGLUNIFORMMATRIX2X3DVPROC>("glUniformMatrix2x3dv", Null_glUniformMatrix2x3dv)),
-		UniformMatrix2x4dv(GetProc<PFNGLUNIFORMMATRIX2X4DVPROC>("glUniformMatrix2x4dv", Null_glUniformMatrix2x4dv)),
-		UniformMatrix3x2dv(GetProc<PFNGLUNIFORMMATRIX3X2DVPROC>("glUniformMatrix3x2dv", Null_glUniformMatrix3x2dv)),
-		UniformMatrix3x4dv(GetProc<PFNGLUNIFORMMATRIX3X4DVPROC>("glUniformMatrix3x4dv", Null_glUniformMatrix3x4dv)),
-		UniformMatrix4x2dv(GetProc<PFNGLUNIFORMMATRIX4X2DVPROC>("glUniformMatrix4x2dv", Null_glUniformMatrix4x2dv)),
-		UniformMatrix4x3dv(GetProc<PFNGLUNIFORMMATRIX4X3DVPROC>("glUniformMatrix4x3dv", Null_glUniformMatrix4x3dv)),
-		GetUniformdv(GetProc<PFNGLGETUNIFORMDVPROC>("glGetUniformdv", Null_glGetUniformdv)),
-		GetSubroutineUniformLocation(GetProc<PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC>("glGetSubroutineUniformLocation", Null_glGetSubroutineUniformLocation)),
-		GetSubroutineIndex(GetProc<PFNGLGETSUBROUTINEINDEXPROC>("glGetSubroutineIndex", Null_glGetSubroutineIndex)),
-		GetActiveSubroutineUniformiv(GetProc<PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC>("glGetActiveSubroutineUniformiv", Null_glGetActiveSubroutineUniformiv)),
-		GetActiveSubroutineUniformName(GetProc<PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC>("glGetActiveSubroutineUniformName", Null_glGetActiveSubroutineUniformName)),
-		GetActiveSubroutineName(GetProc<PFNGLGETACTIVESUBROUTINENAMEPROC>("glGetActiveSubroutineName", Null_glGetActiveSubroutineName)),
-		UniformSubroutinesuiv(GetProc<PFNGLUNIFORMSUBROUTINESUIVPROC>("glUniformSubroutinesuiv", Null_glUniformSubroutinesuiv)),
-		GetUniformSubroutineuiv(GetProc<PFNGLGETUNIFORMSUBROUTINEUIVPROC>("glGetUniformSubroutineuiv", Null_glGetUniformSubroutineuiv)),
-		GetProgramStageiv(GetProc<PFNGLGETPROGRAMSTAGEIVPROC>("glGetProgramStageiv", Null_glGetProgramStageiv)),
-		PatchParameteri(GetProc<PFNGLPATCHPARAMETERIPROC>("glPatchParameteri", Null_glPatchParameteri)),
-		PatchParameterfv(GetProc<PFNGLPATCHPARAMETERFVPROC>("glPatchParameterfv", Null_glPatchParameterfv)),
-		BindTransformFeedback(GetProc<PFNGLBINDTRANSFORMFEEDBACKPROC>("glBindTransformFeedback", Null_glBindTransformFeedback)),
-		DeleteTransformFeedbacks(GetProc<PFNGLDELETETRANSFORMFEEDBACKSPROC>("glDeleteTransformFeedbacks", Null_glDeleteTransformFeedbacks)),
-		GenTransformFeedbacks(GetProc<PFNGLGENTRANSFORMFEEDBACKSPROC>("glGenTransformFeedbacks", Null_glGenTransformFeedbacks)),
-		IsTransformFeedback(GetProc<PFNGLISTRANSFORMFEEDBACKPROC>("glIsTransformFeedback", Null_glIsTransformFeedback)),
-		PauseTransformFeedback(GetProc<PFNGLPAUSETRANSFORMFEEDBACKPROC>("glPauseTransformFeedback", Null_glPauseTransformFeedback)),
-		ResumeTransformFeedback(GetProc<PFNGLRESUMETRANSFORMFEEDBACKPROC>("glResumeTransformFeedback", Null_glResumeTransformFeedback)),
-		DrawTransformFeedback(GetProc<PFNGLDRAWTRANSFORMFEEDBACKPROC>("glDrawTransformFeedback", Null_glDrawTransformFeedback)),
-		DrawTransformFeedbackStream(GetProc<PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC>("glDrawTransformFeedbackStream", Null_glDrawTransformFeedbackStream)),
-		BeginQueryIndexed(GetProc<PFNGLBEGINQUERYINDEXEDPROC>("glBeginQueryIndexed", Null_glBeginQueryIndexed)),
-		EndQueryIndexed(GetProc<PFNGLENDQUERYINDEXEDPROC>("glEndQueryIndexed", Null_glEndQueryIndexed)),
-		GetQueryIndexediv(GetProc<PFNGLGETQUERYINDEXEDIVPROC>("glGetQueryIndexediv", Null_glGetQueryIndexediv))
+	static void Resolve_glMinSampleShading(Version46& c){ c.MinSampleShading = c.GetProc<decltype(c.MinSampleShading)>("glMinSampleShading", Null_glMinSampleShading); }
+	static void Resolve_glBlendEquationi(Version46& c){ c.BlendEquationi = c.GetProc<decltype(c.BlendEquationi)>("glBlendEquationi", Null_glBlendEquationi); }
+	static void Resolve_glBlendEquationSeparatei(Version46& c){ c.BlendEquationSeparatei = c.GetProc<decltype(c.BlendEquationSeparatei)>("glBlendEquationSeparatei", Null_glBlendEquationSeparatei); }
+	static void Resolve_glBlendFunci(Version46& c){ c.BlendFunci = c.GetProc<decltype(c.BlendFunci)>("glBlendFunci", Null_glBlendFunci); }
+	static void Resolve_glBlendFuncSeparatei(Version46& c){ c.BlendFuncSeparatei = c.GetProc<decltype(c.BlendFuncSeparatei)>("glBlendFuncSeparatei", Null_glBlendFuncSeparatei); }
+	static void Resolve_glDrawArraysIndirect(Version46& c){ c.DrawArraysIndirect = c.GetProc<decltype(c.DrawArraysIndirect)>("glDrawArraysIndirect", Null_glDrawArraysIndirect); }
+	static void Resolve_glDrawElementsIndirect(Version46& c){ c.DrawElementsIndirect = c.GetProc<decltype(c.DrawElementsIndirect)>("glDrawElementsIndirect", Null_glDrawElementsIndirect); }
+	static void Resolve_glUniform1d(Version46& c){ c.Uniform1d = c.GetProc<decltype(c.Uniform1d)>("glUniform1d", Null_glUniform1d); }
+	static void Resolve_glUniform2d(Version46& c){ c.Uniform2d = c.GetProc<decltype(c.Uniform2d)>("glUniform2d", Null_glUniform2d); }
+	static void Resolve_glUniform3d(Version46& c){ c.Uniform3d = c.GetProc<decltype(c.Uniform3d)>("glUniform3d", Null_glUniform3d); }
+	static void Resolve_glUniform4d(Version46& c){ c.Uniform4d = c.GetProc<decltype(c.Uniform4d)>("glUniform4d", Null_glUniform4d); }
+	static void Resolve_glUniform1dv(Version46& c){ c.Uniform1dv = c.GetProc<decltype(c.Uniform1dv)>("glUniform1dv", Null_glUniform1dv); }
+	static void Resolve_glUniform2dv(Version46& c){ c.Uniform2dv = c.GetProc<decltype(c.Uniform2dv)>("glUniform2dv", Null_glUniform2dv); }
+	static void Resolve_glUniform3dv(Version46& c){ c.Uniform3dv = c.GetProc<decltype(c.Uniform3dv)>("glUniform3dv", Null_glUniform3dv); }
+	static void Resolve_glUniform4dv(Version46& c){ c.Uniform4dv = c.GetProc<decltype(c.Uniform4dv)>("glUniform4dv", Null_glUniform4dv); }
+	static void Resolve_glUniformMatrix2dv(Version46& c){ c.UniformMatrix2dv = c.GetProc<decltype(c.UniformMatrix2dv)>("glUniformMatrix2dv", Null_glUniformMatrix2dv); }
+	static void Resolve_glUniformMatrix3dv(Version46& c){ c.UniformMatrix3dv = c.GetProc<decltype(c.UniformMatrix3dv)>("glUniformMatrix3dv", Null_glUniformMatrix3dv); }
+	static void Resolve_glUniformMatrix4dv(Version46& c){ c.UniformMatrix4dv = c.GetProc<decltype(c.UniformMatrix4dv)>("glUniformMatrix4dv", Null_glUniformMatrix4dv); }
+	static void Resolve_glUniformMatrix2x3dv(Version46& c){ c.UniformMatrix2x3dv = c.GetProc<decltype(c.UniformMatrix2x3dv)>("glUniformMatrix2x3dv", Null_glUniformMatrix2x3dv); }
+	static void Resolve_glUniformMatrix2x4dv(Version46& c){ c.UniformMatrix2x4dv = c.GetProc<decltype(c.UniformMatrix2x4dv)>("glUniformMatrix2x4dv", Null_glUniformMatrix2x4dv); }
+	static void Resolve_glUniformMatrix3x2dv(Version46& c){ c.UniformMatrix3x2dv = c.GetProc<decltype(c.UniformMatrix3x2dv)>("glUniformMatrix3x2dv", Null_glUniformMatrix3x2dv); }
+	static void Resolve_glUniformMatrix3x4dv(Version46& c){ c.UniformMatrix3x4dv = c.GetProc<decltype(c.UniformMatrix3x4dv)>("glUniformMatrix3x4dv", Null_glUniformMatrix3x4dv); }
+	static void Resolve_glUniformMatrix4x2dv(Version46& c){ c.UniformMatrix4x2dv = c.GetProc<decltype(c.UniformMatrix4x2dv)>("glUniformMatrix4x2dv", Null_glUniformMatrix4x2dv); }
+	static void Resolve_glUniformMatrix4x3dv(Version46& c){ c.UniformMatrix4x3dv = c.GetProc<decltype(c.UniformMatrix4x3dv)>("glUniformMatrix4x3dv", Null_glUniformMatrix4x3dv); }
+	static void Resolve_glGetUniformdv(Version46& c){ c.GetUniformdv = c.GetProc<decltype(c.GetUniformdv)>("glGetUniformdv", Null_glGetUniformdv); }
+	static void Resolve_glGetSubroutineUniformLocation(Version46& c){ c.GetSubroutineUniformLocation = c.GetProc<decltype(c.GetSubroutineUniformLocation)>("glGetSubroutineUniformLocation", Null_glGetSubroutineUniformLocation); }
+	static void Resolve_glGetSubroutineIndex(Version46& c){ c.GetSubroutineIndex = c.GetProc<decltype(c.GetSubroutineIndex)>("glGetSubroutineIndex", Null_glGetSubroutineIndex); }
+	static void Resolve_glGetActiveSubroutineUniformiv(Version46& c){ c.GetActiveSubroutineUniformiv = c.GetProc<decltype(c.GetActiveSubroutineUniformiv)>("glGetActiveSubroutineUniformiv", Null_glGetActiveSubroutineUniformiv); }
+	static void Resolve_glGetActiveSubroutineUniformName(Version46& c){ c.GetActiveSubroutineUniformName = c.GetProc<decltype(c.GetActiveSubroutineUniformName)>("glGetActiveSubroutineUniformName", Null_glGetActiveSubroutineUniformName); }
+	static void Resolve_glGetActiveSubroutineName(Version46& c){ c.GetActiveSubroutineName = c.GetProc<decltype(c.GetActiveSubroutineName)>("glGetActiveSubroutineName", Null_glGetActiveSubroutineName); }
+	static void Resolve_glUniformSubroutinesuiv(Version46& c){ c.UniformSubroutinesuiv = c.GetProc<decltype(c.UniformSubroutinesuiv)>("glUniformSubroutinesuiv", Null_glUniformSubroutinesuiv); }
+	static void Resolve_glGetUniformSubroutineuiv(Version46& c){ c.GetUniformSubroutineuiv = c.GetProc<decltype(c.GetUniformSubroutineuiv)>("glGetUniformSubroutineuiv", Null_glGetUniformSubroutineuiv); }
+	static void Resolve_glGetProgramStageiv(Version46& c){ c.GetProgramStageiv = c.GetProc<decltype(c.GetProgramStageiv)>("glGetProgramStageiv", Null_glGetProgramStageiv); }
+	static void Resolve_glPatchParameteri(Version46& c){ c.PatchParameteri = c.GetProc<decltype(c.PatchParameteri)>("glPatchParameteri", Null_glPatchParameteri); }
+	static void Resolve_glPatchParameterfv(Version46& c){ c.PatchParameterfv = c.GetProc<decltype(c.PatchParameterfv)>("glPatchParameterfv", Null_glPatchParameterfv); }
+	static void Resolve_glBindTransformFeedback(Version46& c){ c.BindTransformFeedback = c.GetProc<decltype(c.BindTransformFeedback)>("glBindTransformFeedback", Null_glBindTransformFeedback); }
+	static void Resolve_glDeleteTransformFeedbacks(Version46& c){ c.DeleteTransformFeedbacks = c.GetProc<decltype(c.DeleteTransformFeedbacks)>("glDeleteTransformFeedbacks", Null_glDeleteTransformFeedbacks); }
+	static void Resolve_glGenTransformFeedbacks(Version46& c){ c.GenTransformFeedbacks = c.GetProc<decltype(c.GenTransformFeedbacks)>("glGenTransformFeedbacks", Null_glGenTransformFeedbacks); }
+	static void Resolve_glIsTransformFeedback(Version46& c){ c.IsTransformFeedback = c.GetProc<decltype(c.IsTransformFeedback)>("glIsTransformFeedback", Null_glIsTransformFeedback); }
+	static void Resolve_glPauseTransformFeedback(Version46& c){ c.PauseTransformFeedback = c.GetProc<decltype(c.PauseTransformFeedback)>("glPauseTransformFeedback", Null_glPauseTransformFeedback); }
+	static void Resolve_glResumeTransformFeedback(Version46& c){ c.ResumeTransformFeedback = c.GetProc<decltype(c.ResumeTransformFeedback)>("glResumeTransformFeedback", Null_glResumeTransformFeedback); }
+	static void Resolve_glDrawTransformFeedback(Version46& c){ c.DrawTransformFeedback = c.GetProc<decltype(c.DrawTransformFeedback)>("glDrawTransformFeedback", Null_glDrawTransformFeedback); }
+	static void Resolve_glDrawTransformFeedbackStream(Version46& c){ c.DrawTransformFeedbackStream = c.GetProc<decltype(c.DrawTransformFeedbackStream)>("glDrawTransformFeedbackStream", Null_glDrawTransformFeedbackStream); }
+	static void Resolve_glBeginQueryIndexed(Version46& c){ c.BeginQueryIndexed = c.GetProc<decltype(c.BeginQueryIndexed)>("glBeginQueryIndexed", Null_glBeginQueryIndexed); }
+	static void Resolve_glEndQueryIndexed(Version46& c){ c.EndQueryIndexed = c.GetProc<decltype(c.EndQueryIndexed)>("glEndQueryIndexed", Null_glEndQueryIndexed); }
+	static void Resolve_glGetQueryIndexediv(Version46& c){ c.GetQueryIndexediv = c.GetProc<decltype(c.GetQueryIndexediv)>("glGetQueryIndexediv", Null_glGetQueryIndexediv); }
+	static void APIENTRY Lazy_glMinSampleShading (GLfloat value){ auto& c = ResolveLazy(Resolve_glMinSampleShading, [](const Version46& c){ return c.MinSampleShading == Lazy_glMinSampleShading; }); return c.MinSampleShading(value); }
+	static void APIENTRY Lazy_glBlendEquationi (GLuint buf, GLenum mode){ auto& c = ResolveLazy(Resolve_glBlendEquationi, [](const Version46& c){ return c.BlendEquationi == Lazy_glBlendEquationi; }); return c.BlendEquationi(buf, mode); }
+	static void APIENTRY Lazy_glBlendEquationSeparatei (GLuint buf, GLenum modeRGB, GLenum modeAlpha){ auto& c = ResolveLazy(Resolve_glBlendEquationSeparatei, [](const Version46& c){ return c.BlendEquationSeparatei == Lazy_glBlendEquationSeparatei; }); return c.BlendEquationSeparatei(buf, modeRGB, modeAlpha); }
+	static void APIENTRY Lazy_glBlendFunci (GLuint buf, GLenum src, GLenum dst){ auto& c = ResolveLazy(Resolve_glBlendFunci, [](const Version46& c){ return c.BlendFunci == Lazy_glBlendFunci; }); return c.BlendFunci(buf, src, dst); }
+	static void APIENTRY Lazy_glBlendFuncSeparatei (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha){ auto& c = ResolveLazy(Resolve_glBlendFuncSeparatei, [](const Version46& c){ return c.BlendFuncSeparatei == Lazy_glBlendFuncSeparatei; }); return c.BlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha); }
+	static void APIENTRY Lazy_glDrawArraysIndirect (GLenum mode, const void* indirect){ auto& c = ResolveLazy(Resolve_glDrawArraysIndirect, [](const Version46& c){ return c.DrawArraysIndirect == Lazy_glDrawArraysIndirect; }); return c.DrawArraysIndirect(mode, indirect); }
+	static void APIENTRY Lazy_glDrawElementsIndirect (GLenum mode, GLenum type, const void* indirect){ auto& c = ResolveLazy(Resolve_glDrawElementsIndirect, [](const Version46& c){ return c.DrawElementsIndirect == Lazy_glDrawElementsIndirect; }); return c.DrawElementsIndirect(mode, type, indirect); }
+	static void APIENTRY Lazy_glUniform1d (GLint location, GLdouble x){ auto& c = ResolveLazy(Resolve_glUniform1d, [](const Version46& c){ return c.Uniform1d == Lazy_glUniform1d; }); return c.Uniform1d(location, x); }
+	static void APIENTRY Lazy_glUniform2d (GLint location, GLdouble x, GLdouble y){ auto& c = ResolveLazy(Resolve_glUniform2d, [](const Version46& c){ return c.Uniform2d == Lazy_glUniform2d; }); return c.Uniform2d(location, x, y); }
+	static void APIENTRY Lazy_glUniform3d (GLint location, GLdouble x, GLdouble y, GLdouble z){ auto& c = ResolveLazy(Resolve_glUniform3d, [](const Version46& c){ return c.Uniform3d == Lazy_glUniform3d; }); return c.Uniform3d(location, x, y, z); }
+	static void APIENTRY Lazy_glUniform4d (GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w){ auto& c = ResolveLazy(Resolve_glUniform4d, [](const Version46& c){ return c.Uniform4d == Lazy_glUniform4d; }); return c.Uniform4d(location, x, y, z, w); }
+	static void APIENTRY Lazy_glUniform1dv (GLint location, GLsizei count, const GLdouble* value){ auto& c = ResolveLazy(Resolve_glUniform1dv, [](const Version46& c){ return c.Uniform1dv == Lazy_glUniform1dv; }); return c.Uniform1dv(location, count, value); }
+	static void APIENTRY Lazy_glUniform2dv (GLint location, GLsizei count, const GLdouble* value){ auto& c = ResolveLazy(Resolve_glUniform2dv, [](const Version46& c){ return c.Uniform2dv == Lazy_glUniform2dv; }); return c.Uniform2dv(location, count, value); }
+	static void APIENTRY Lazy_glUniform3dv (GLint location, GLsizei count, const GLdouble* value){ auto& c = ResolveLazy(Resolve_glUniform3dv, [](const Version46& c){ return c.Uniform3dv == Lazy_glUniform3dv; }); return c.Uniform3dv(location, count, value); }
+	static void APIENTRY Lazy_glUniform4dv (GLint location, GLsizei count, const GLdouble* value){ auto& c = ResolveLazy(Resolve_glUniform4dv, [](const Version46& c){ return c.Uniform4dv == Lazy_glUniform4dv; }); return c.Uniform4dv(location, count, value); }
+	static void APIENTRY Lazy_glUniformMatrix2dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value){ auto& c = ResolveLazy(Resolve_glUniformMatrix2dv, [](const Version46& c){ return c.UniformMatrix2dv == Lazy_glUniformMatrix2dv; }); return c.UniformMatrix2dv(location, count, transpose, value); }
+	static void APIENTRY Lazy_glUniformMatrix3dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value){ auto& c = ResolveLazy(Resolve_glUniformMatrix3dv, [](const Version46& c){ return c.UniformMatrix3dv == Lazy_glUniformMatrix3dv; }); return c.UniformMatrix3dv(location, count, transpose, value); }
+	static void APIENTRY Lazy_glUniformMatrix4dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value){ auto& c = ResolveLazy(Resolve_glUniformMatrix4dv, [](const Version46& c){ return c.UniformMatrix4dv == Lazy_glUniformMatrix4dv; }); return c.UniformMatrix4dv(location, count, transpose, value); }
+	static void APIENTRY Lazy_glUniformMatrix2x3dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value){ auto& c = ResolveLazy(Resolve_glUniformMatrix2x3dv, [](const Version46& c){ return c.UniformMatrix2x3dv == Lazy_glUniformMatrix2x3dv; }); return c.UniformMatrix2x3dv(location, count, transpose, value); }
+	static void APIENTRY Lazy_glUniformMatrix2x4dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value){ auto& c = ResolveLazy(Resolve_glUniformMatrix2x4dv, [](const Version46& c){ return c.UniformMatrix2x4dv == Lazy_glUniformMatrix2x4dv; }); return c.UniformMatrix2x4dv(location, count, transpose, value); }
+	static void APIENTRY Lazy_glUniformMatrix3x2dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value){ auto& c = ResolveLazy(Resolve_glUniformMatrix3x2dv, [](const Version46& c){ return c.UniformMatrix3x2dv == Lazy_glUniformMatrix3x2dv; }); return c.UniformMatrix3x2dv(location, count, transpose, value); }
+	static void APIENTRY Lazy_glUniformMatrix3x4dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value){ auto& c = ResolveLazy(Resolve_glUniformMatrix3x4dv, [](const Version46& c){ return c.UniformMatrix3x4dv == Lazy_glUniformMatrix3x4dv; }); return c.UniformMatrix3x4dv(location, count, transpose, value); }
+	static void APIENTRY Lazy_glUniformMatrix4x2dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value){ auto& c = ResolveLazy(Resolve_glUniformMatrix4x2dv, [](const Version46& c){ return c.UniformMatrix4x2dv == Lazy_glUniformMatrix4x2dv; }); return c.UniformMatrix4x2dv(location, count, transpose, value); }
+	static void APIENTRY Lazy_glUniformMatrix4x3dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value){ auto& c = ResolveLazy(Resolve_glUniformMatrix4x3dv, [](const Version46& c){ return c.UniformMatrix4x3dv == Lazy_glUniformMatrix4x3dv; }); return c.UniformMatrix4x3dv(location, count, transpose, value); }
+	static void APIENTRY Lazy_glGetUniformdv (GLuint program, GLint location, GLdouble* params){ auto& c = ResolveLazy(Resolve_glGetUniformdv, [](const Version46& c){ return c.GetUniformdv == Lazy_glGetUniformdv; }); return c.GetUniformdv(program, location, params); }
+	static GLint APIENTRY Lazy_glGetSubroutineUniformLocation (GLuint program, GLenum shadertype, const GLchar* name){ auto& c = ResolveLazy(Resolve_glGetSubroutineUniformLocation, [](const Version46& c){ return c.GetSubroutineUniformLocation == Lazy_glGetSubroutineUniformLocation; }); return c.GetSubroutineUniformLocation(program, shadertype, name); }
+	static GLuint APIENTRY Lazy_glGetSubroutineIndex (GLuint program, GLenum shadertype, const GLchar* name){ auto& c = ResolveLazy(Resolve_glGetSubroutineIndex, [](const Version46& c){ return c.GetSubroutineIndex == Lazy_glGetSubroutineIndex; }); return c.GetSubroutineIndex(program, shadertype, name); }
+	static void APIENTRY Lazy_glGetActiveSubroutineUniformiv (GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint* values){ auto& c = ResolveLazy(Resolve_glGetActiveSubroutineUniformiv, [](const Version46& c){ return c.GetActiveSubroutineUniformiv == Lazy_glGetActiveSubroutineUniformiv; }); return c.GetActiveSubroutineUniformiv(program, shadertype, index, pname, values); }
+	static void APIENTRY Lazy_glGetActiveSubroutineUniformName (GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei* length, GLchar* name){ auto& c = ResolveLazy(Resolve_glGetActiveSubroutineUniformName, [](const Version46& c){ return c.GetActiveSubroutineUniformName == Lazy_glGetActiveSubroutineUniformName; }); return c.GetActiveSubroutineUniformName(program, shadertype, index, bufSize, length, name); }
+	static void APIENTRY Lazy_glGetActiveSubroutineName (GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei* length, GLchar* name){ auto& c = ResolveLazy(Resolve_glGetActiveSubroutineName, [](const Version46& c){ return c.GetActiveSubroutineName == Lazy_glGetActiveSubroutineName; }); return c.GetActiveSubroutineName(program, shadertype, index, bufSize, length, name); }
+	static void APIENTRY Lazy_glUniformSubroutinesuiv (GLenum shadertype, GLsizei count, const GLuint* indices){ auto& c = ResolveLazy(Resolve_glUniformSubroutinesuiv, [](const Version46& c){ return c.UniformSubroutinesuiv == Lazy_glUniformSubroutinesuiv; }); return c.UniformSubroutinesuiv(shadertype, count, indices); }
+	static void APIENTRY Lazy_glGetUniformSubroutineuiv (GLenum shadertype, GLint location, GLuint* params){ auto& c = ResolveLazy(Resolve_glGetUniformSubroutineuiv, [](const Version46& c){ return c.GetUniformSubroutineuiv == Lazy_glGetUniformSubroutineuiv; }); return c.GetUniformSubroutineuiv(shadertype, location, params); }
+	static void APIENTRY Lazy_glGetProgramStageiv (GLuint program, GLenum shadertype, GLenum pname, GLint* values){ auto& c = ResolveLazy(Resolve_glGetProgramStageiv, [](const Version46& c){ return c.GetProgramStageiv == Lazy_glGetProgramStageiv; }); return c.GetProgramStageiv(program, shadertype, pname, values); }
+	static void APIENTRY Lazy_glPatchParameteri (GLenum pname, GLint value){ auto& c = ResolveLazy(Resolve_glPatchParameteri, [](const Version46& c){ return c.PatchParameteri == Lazy_glPatchParameteri; }); return c.PatchParameteri(pname, value); }
+	static void APIENTRY Lazy_glPatchParameterfv (GLenum pname, const GLfloat* values){ auto& c = ResolveLazy(Resolve_glPatchParameterfv, [](const Version46& c){ return c.PatchParameterfv == Lazy_glPatchParameterfv; }); return c.PatchParameterfv(pname, values); }
+	static void APIENTRY Lazy_glBindTransformFeedback (GLenum target, GLuint id){ auto& c = ResolveLazy(Resolve_glBindTransformFeedback, [](const Version46& c){ return c.BindTransformFeedback == Lazy_glBindTransformFeedback; }); return c.BindTransformFeedback(target, id); }
+	static void APIENTRY Lazy_glDeleteTransformFeedbacks (GLsizei n, const GLuint* ids){ auto& c = ResolveLazy(Resolve_glDeleteTransformFeedbacks, [](const Version46& c){ return c.DeleteTransformFeedbacks == Lazy_glDeleteTransformFeedbacks; }); return c.DeleteTransformFeedbacks(n, ids); }
+	static void APIENTRY Lazy_glGenTransformFeedbacks (GLsizei n, GLuint* ids){ auto& c = ResolveLazy(Resolve_glGenTransformFeedbacks, [](const Version46& c){ return c.GenTransformFeedbacks == Lazy_glGenTransformFeedbacks; }); return c.GenTransformFeedbacks(n, ids); }
+	static GLboolean APIENTRY Lazy_glIsTransformFeedback (GLuint id){ auto& c = ResolveLazy(Resolve_glIsTransformFeedback, [](const Version46& c){ return c.IsTransformFeedback == Lazy_glIsTransformFeedback; }); return c.IsTransformFeedback(id); }
+	static void APIENTRY Lazy_glPauseTransformFeedback (void){ auto& c = ResolveLazy(Resolve_glPauseTransformFeedback, [](const Version46& c){ return c.PauseTransformFeedback == Lazy_glPauseTransformFeedback; }); return c.PauseTransformFeedback(); }
+	static void APIENTRY Lazy_glResumeTransformFeedback (void){ auto& c = ResolveLazy(Resolve_glResumeTransformFeedback, [](const Version46& c){ return c.ResumeTransformFeedback == Lazy_glResumeTransformFeedback; }); return c.ResumeTransformFeedback(); }
+	static void APIENTRY Lazy_glDrawTransformFeedback (GLenum mode, GLuint id){ auto& c = ResolveLazy(Resolve_glDrawTransformFeedback, [](const Version46& c){ return c.DrawTransformFeedback == Lazy_glDrawTransformFeedback; }); return c.DrawTransformFeedback(mode, id); }
+	static void APIENTRY Lazy_glDrawTransformFeedbackStream (GLenum mode, GLuint id, GLuint stream){ auto& c = ResolveLazy(Resolve_glDrawTransformFeedbackStream, [](const Version46& c){ return c.DrawTransformFeedbackStream == Lazy_glDrawTransformFeedbackStream; }); return c.DrawTransformFeedbackStream(mode, id, stream); }
+	static void APIENTRY Lazy_glBeginQueryIndexed (GLenum target, GLuint index, GLuint id){ auto& c = ResolveLazy(Resolve_glBeginQueryIndexed, [](const Version46& c){ return c.BeginQueryIndexed == Lazy_glBeginQueryIndexed; }); return c.BeginQueryIndexed(target, index, id); }
+	static void APIENTRY Lazy_glEndQueryIndexed (GLenum target, GLuint index){ auto& c = ResolveLazy(Resolve_glEndQueryIndexed, [](const Version46& c){ return c.EndQueryIndexed == Lazy_glEndQueryIndexed; }); return c.EndQueryIndexed(target, index); }
+	static void APIENTRY Lazy_glGetQueryIndexediv (GLenum target, GLuint index, GLenum pname, GLint* params){ auto& c = ResolveLazy(Resolve_glGetQueryIndexediv, [](const Version46& c){ return c.GetQueryIndexediv == Lazy_glGetQueryIndexediv; }); return c.GetQueryIndexediv(target, index, pname, params); }
+	Version40::Version40(Func_GetProcAddress GetProcAddress, LoadMode Mode):
+		Version33(GetProcAddress, Mode),
+		MinSampleShading(GetProc<PFNGLMINSAMPLESHADINGPROC>("glMinSampleShading", Null_glMinSampleShading, Lazy_glMinSampleShading)),
+		BlendEquationi(GetProc<PFNGLBLENDEQUATIONIPROC>("glBlendEquationi", Null_glBlendEquationi, Lazy_glBlendEquationi)),
+		BlendEquationSeparatei(GetProc<PFNGLBLENDEQUATIONSEPARATEIPROC>("glBlendEquationSeparatei", Null_glBlendEquationSeparatei, Lazy_glBlendEquationSeparatei)),
+		BlendFunci(GetProc<PFNGLBLENDFUNCIPROC>("glBlendFunci", Null_glBlendFunci, Lazy_glBlendFunci)),
+		BlendFuncSeparatei(GetProc<PFNGLBLENDFUNCSEPARATEIPROC>("glBlendFuncSeparatei", Null_glBlendFuncSeparatei, Lazy_glBlendFuncSeparatei)),
+		DrawArraysIndirect(GetProc<PFNGLDRAWARRAYSINDIRECTPROC>("glDrawArraysIndirect", Null_glDrawArraysIndirect, Lazy_glDrawArraysIndirect)),
+		DrawElementsIndirect(GetProc<PFNGLDRAWELEMENTSINDIRECTPROC>("glDrawElementsIndirect", Null_glDrawElementsIndirect, Lazy_glDrawElementsIndirect)),
+		Uniform1d(GetProc<PFNGLUNIFORM1DPROC>("glUniform1d", Null_glUniform1d, Lazy_glUniform1d)),
+		Uniform2d(GetProc<PFNGLUNIFORM2DPROC>("glUniform2d", Null_glUniform2d, Lazy_glUniform2d)),
+		Uniform3d(GetProc<PFNGLUNIFORM3DPROC>("glUniform3d", Null_glUniform3d, Lazy_glUniform3d)),
+		Uniform4d(GetProc<PFNGLUNIFORM4DPROC>("glUniform4d", Null_glUniform4d, Lazy_glUniform4d)),
+		Uniform1dv(GetProc<PFNGLUNIFORM1DVPROC>("glUniform1dv", Null_glUniform1dv, Lazy_glUniform1dv)),
+		Uniform2dv(GetProc<PFNGLUNIFORM2DVPROC>("glUniform2dv", Null_glUniform2dv, Lazy_glUniform2dv)),
+		Uniform3dv(GetProc<PFNGLUNIFORM3DVPROC>("glUniform3dv", Null_glUniform3dv, Lazy_glUniform3dv)),
+		Uniform4dv(GetProc<PFNGLUNIFORM4DVPROC>("glUniform4dv", Null_glUniform4dv, Lazy_glUniform4dv)),
+		UniformMatrix2dv(GetProc<PFNGLUNIFORMMATRIX2DVPROC>("glUniformMatrix2dv", Null_glUniformMatrix2dv, Lazy_glUniformMatrix2dv)),
+		UniformMatrix3dv(GetProc<PFNGLUNIFORMMATRIX3DVPROC>("glUniformMatrix3dv", Null_glUniformMatrix3dv, Lazy_glUniformMatrix3dv)),
+		UniformMatrix4dv(GetProc<PFNGLUNIFORMMATRIX4DVPROC>("glUniformMatrix4dv", Null_glUniformMatrix4dv, Lazy_glUniformMatrix4dv)),
+		UniformMatrix2x3dv(GetProc<PFNGLUNIFORMMATRIX2X3DVPROC>("glUniformMatrix2x3dv", Null_glUniformMatrix2x3dv, Lazy_glUniformMatrix2x3dv)),
+		UniformMatrix2x4dv(GetProc<PFNGLUNIFORMMATRIX2X4DVPROC>("glUniformMatrix2x4dv", Null_glUniformMatrix2x4dv, Lazy_glUniformMatrix2x4dv)),
+		UniformMatrix3x2dv(GetProc<PFNGLUNIFORMMATRIX3X2DVPROC>("glUniformMatrix3x2dv", Null_glUniformMatrix3x2dv, Lazy_glUniformMatrix3x2dv)),
+		UniformMatrix3x4dv(GetProc<PFNGLUNIFORMMATRIX3X4DVPROC>("glUniformMatrix3x4dv", Null_glUniformMatrix3x4dv, Lazy_glUniformMatrix3x4dv)),
+		UniformMatrix4x2dv(GetProc<PFNGLUNIFORMMATRIX4X2DVPROC>("glUniformMatrix4x2dv", Null_glUniformMatrix4x2dv, Lazy_glUniformMatrix4x2dv)),
+		UniformMatrix4x3dv(GetProc<PFNGLUNIFORMMATRIX4X3DVPROC>("glUniformMatrix4x3dv", Null_glUniformMatrix4x3dv, Lazy_glUniformMatrix4x3dv)),
+		GetUniformdv(GetProc<PFNGLGETUNIFORMDVPROC>("glGetUniformdv", Null_glGetUniformdv, Lazy_glGetUniformdv)),
+		GetSubroutineUniformLocation(GetProc<PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC>("glGetSubroutineUniformLocation", Null_glGetSubroutineUniformLocation, Lazy_glGetSubroutineUniformLocation)),
+		GetSubroutineIndex(GetProc<PFNGLGETSUBROUTINEINDEXPROC>("glGetSubroutineIndex", Null_glGetSubroutineIndex, Lazy_glGetSubroutineIndex)),
+		GetActiveSubroutineUniformiv(GetProc<PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC>("glGetActiveSubroutineUniformiv", Null_glGetActiveSubroutineUniformiv, Lazy_glGetActiveSubroutineUniformiv)),
+		GetActiveSubroutineUniformName(GetProc<PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC>("glGetActiveSubroutineUniformName", Null_glGetActiveSubroutineUniformName, Lazy_glGetActiveSubroutineUniformName)),
+		GetActiveSubroutineName(GetProc<PFNGLGETACTIVESUBROUTINENAMEPROC>("glGetActiveSubroutineName", Null_glGetActiveSubroutineName, Lazy_glGetActiveSubroutineName)),
+		UniformSubroutinesuiv(GetProc<PFNGLUNIFORMSUBROUTINESUIVPROC>("glUniformSubroutinesuiv", Null_glUniformSubroutinesuiv, Lazy_glUniformSubroutinesuiv)),
+		GetUniformSubroutineuiv(GetProc<PFNGLGETUNIFORMSUBROUTINEUIVPROC>("glGetUniformSubroutineuiv", Null_glGetUniformSubroutineuiv, Lazy_glGetUniformSubroutineuiv)),
+		GetProgramStageiv(GetProc<PFNGLGETPROGRAMSTAGEIVPROC>("glGetProgramStageiv", Null_glGetProgramStageiv, Lazy_glGetProgramStageiv)),
+		PatchParameteri(GetProc<PFNGLPATCHPARAMETERIPROC>("glPatchParameteri", Null_glPatchParameteri, Lazy_glPatchParameteri)),
+		PatchParameterfv(GetProc<PFNGLPATCHPARAMETERFVPROC>("glPatchParameterfv", Null_glPatchParameterfv, Lazy_glPatchParameterfv)),
+		BindTransformFeedback(GetProc<PFNGLBINDTRANSFORMFEEDBACKPROC>("glBindTransformFeedback", Null_glBindTransformFeedback, Lazy_glBindTransformFeedback)),
+		DeleteTransformFeedbacks(GetProc<PFNGLDELETETRANSFORMFEEDBACKSPROC>("glDeleteTransformFeedbacks", Null_glDeleteTransformFeedbacks, Lazy_glDeleteTransformFeedbacks)),
+		GenTransformFeedbacks(GetProc<PFNGLGENTRANSFORMFEEDBACKSPROC>("glGenTransformFeedbacks", Null_glGenTransformFeedbacks, Lazy_glGenTransformFeedbacks)),
+		IsTransformFeedback(GetProc<PFNGLISTRANSFORMFEEDBACKPROC>("glIsTransformFeedback", Null_glIsTransformFeedback, Lazy_glIsTransformFeedback)),
+		PauseTransformFeedback(GetProc<PFNGLPAUSETRANSFORMFEEDBACKPROC>("glPauseTransformFeedback", Null_glPauseTransformFeedback, Lazy_glPauseTransformFeedback)),
+		ResumeTransformFeedback(GetProc<PFNGLRESUMETRANSFORMFEEDBACKPROC>("glResumeTransformFeedback", Null_glResumeTransformFeedback, Lazy_glResumeTransformFeedback)),
+		DrawTransformFeedback(GetProc<PFNGLDRAWTRANSFORMFEEDBACKPROC>("glDrawTransformFeedback", Null_glDrawTransformFeedback, Lazy_glDrawTransformFeedback)),
+		DrawTransformFeedbackStream(GetProc<PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC>("glDrawTransformFeedbackStream", Null_glDrawTransformFeedbackStream, Lazy_glDrawTransformFeedbackStream)),
+		BeginQueryIndexed(GetProc<PFNGLBEGINQUERYINDEXEDPROC>("glBeginQueryIndexed", Null_glBeginQueryIndexed, Lazy_glBeginQueryIndexed)),
+		EndQueryIndexed(GetProc<PFNGLENDQUERYINDEXEDPROC>("glEndQueryIndexed", Null_glEndQueryIndexed, Lazy_glEndQueryIndexed)),
+		GetQueryIndexediv(GetProc<PFNGLGETQUERYINDEXEDIVPROC>("glGetQueryIndexediv", Null_glGetQueryIndexediv, Lazy_glGetQueryIndexediv))
 	{
 		Available = Ver_Major > 4 || (Ver_Major == 4 && (Ver_Minor > 0 || (Ver_Minor == 0 && Ver_Release >= 0)));
 	}
 
+	Version40::Version40(Func_GetProcAddress GetProcAddress):
+		Version40(GetProcAddress, LoadMode::Eager)
+	{
+	}
+
 
 	static void APIENTRY Null_glReleaseShaderCompiler (void){ NullFuncPtr(); }
 	static void APIENTRY Null_glShaderBinary (GLsizei count, const GLuint* shaders, GLenum binaryFormat, const void* binary, GLsizei length){ NullFuncPtr(); }
@@ -1267,100 +2349,281 @@ namespace GL
 	static void APIENTRY Null_glDepthRangeIndexed (GLuint index, GLdouble n, GLdouble f){ NullFuncPtr(); }
 	static void APIENTRY Null_glGetFloati_v (GLenum target, GLuint index, GLfloat* data){ NullFuncPtr(); }
 	static void APIENTRY Null_glGetDoublei_v (GLenum target, GLuint index, GLdouble* data){ NullFuncPtr(); }
-	Version41::Version41(Func_GetProcAddress GetProcAddress):
-		Version40(GetProcAddress),
-		ReleaseShaderCompiler(GetProc<PFNGLRELEASESHADERCOMPILERPROC>("glReleaseShaderCompiler", Null_glReleaseShaderCompiler)),
-		ShaderBinary(GetProc<PFNGLSHADERBINARYPROC>("glShaderBinary", Null_glShaderBinary)),
-		GetShaderPrecisionFormat(GetProc<PFNGLGETSHADERPRECISIONFORMATPROC>("glGetShaderPrecisionFormat", Null_glGetShaderPrecisionFormat)),
-		DepthRangef(GetProc<PFNGLDEPTHRANGEFPROC>("glDepthRangef", Null_glDepthRangef)),
-		ClearDepthf(GetProc<PFNGLCLEARDEPTHFPROC>("glClearDepthf", Null_glClearDepthf)),
-		GetProgramBinary(GetProc<PFNGLGETPROGRAMBINARYPROC>("glGetProgramBinary", Null_glGetProgramBinary)),
-		ProgramBinary(GetProc<PFNGLPROGRAMBINARYPROC>("glProgramBinary", Null_glProgramBinary)),
-		ProgramParameteri(GetProc<PFNGLPROGRAMPARAMETERIPROC>("glProgramParameteri", Null_glProgramParameteri)),
-		UseProgramStages(GetProc<PFNGLUSEPROGRAMSTAGESPROC>("glUseProgramStages", Null_glUseProgramStages)),
-		ActiveShaderProgram(GetProc<PFNGLACTIVESHADERPROGRAMPROC>("glActiveShaderProgram", Null_glActiveShaderProgram)),
-		CreateShaderProgramv(GetProc<PFNGLCREATESHADERPROGRAMVPROC>("glCreateShaderProgramv", Null_glCreateShaderProgramv)),
-		BindProgramPipeline(GetProc<PFNGLBINDPROGRAMPIPELINEPROC>("glBindProgramPipeline", Null_glBindProgramPipeline)),
-		DeleteProgramPipelines(GetProc<PFNGLDELETEPROGRAMPIPELINESPROC>("glDeleteProgramPipelines", Null_glDeleteProgramPipelines)),
-		GenProgramPipelines(GetProc<PFNGLGENPROGRAMPIPELINESPROC>("glGenProgramPipelines", Null_glGenProgramPipelines)),
-		IsProgramPipeline(GetProc<PFNGLISPROGRAMPIPELINEPROC>("glIsProgramPipeline", Null_glIsProgramPipeline)),
-		GetProgramPipelineiv(GetProc<PFNGLGETPROGRAMPIPELINEIVPROC>("glGetProgramPipelineiv", Null_glGetProgramPipelineiv)),
-		ProgramUniform1i(GetProc<PFNGLPROGRAMUNIFORM1IPROC>("glProgramUniform1i", Null_glProgramUniform1i)),
-		ProgramUniform1iv(GetProc<PFNGLPROGRAMUNIFORM1IVPROC>("glProgramUniform1iv", Null_glProgramUniform1iv)),
-		ProgramUniform1f(GetProc<PFNGLPROGRAMUNIFORM1FPROC>("glProgramUniform1f", Null_glProgramUniform1f)),
-		ProgramUniform1fv(GetProc<PFNGLPROGRAMUNIFORM1FVPROC>("glProgramUniform1fv", Null_glProgramUniform1fv)),
-		ProgramUniform1d(GetProc<PFNGLPROGRAMUNIFORM1DPROC>("glProgramUniform1d", Null_glProgramUniform1d)),
-		ProgramUniform1dv(GetProc<PFNGLPROGRAMUNIFORM1DVPROC>("glProgramUniform1dv", Null_glProgramUniform1dv)),
-		ProgramUniform1ui(GetProc<PFNGLPROGRAMUNIFORM1UIPROC>("glProgramUniform1ui", Null_glProgramUniform1ui)),
-		ProgramUniform1uiv(GetProc<PFNGLPROGRAMUNIFORM1UIVPROC>("glProgramUniform1uiv", Null_glProgramUniform1uiv)),
-		ProgramUniform2i(GetProc<PFNGLPROGRAMUNIFORM2IPROC>("glProgramUniform2i", Null_glProgramUniform2i)),
-		ProgramUniform2iv(GetProc<PFNGLPROGRAMUNIFORM2IVPROC>("glProgramUniform2iv", Null_glProgramUniform2iv)),
-		ProgramUniform2f(GetProc<PFNGLPROGRAMUNIFORM2FPROC>("glProgramUniform2f", Null_glProgramUniform2f)),
-		ProgramUniform2fv(GetProc<PFNGLPROGRAMUNIFORM2FVPROC>("glProgramUniform2fv", Null_glProgramUniform2fv)),
-		ProgramUniform2d(GetProc<PFNGLPROGRAMUNIFORM2DPROC>("glProgramUniform2d", Null_glProgramUniform2d)),
-		ProgramUniform2dv(GetProc<PFNGLPROGRAMUNIFORM2DVPROC>("glProgramUniform2dv", Null_glProgramUniform2dv)),
-		ProgramUniform2ui(GetProc<PFNGLPROGRAMUNIFORM2UIPROC>("glProgramUniform2ui", Null_glProgramUniform2ui)),
-		ProgramUniform2uiv(GetProc<PFNGLPROGRAMUNIFORM2UIVPROC>("glProgramUniform2uiv", Null_glProgramUniform2uiv)),
-		ProgramUniform3i(GetProc<PFNGLPROGRAMUNIFORM3IPROC>("glProgramUniform3i", Null_glProgramUniform3i)),
-		ProgramUniform3iv(GetProc<PFNGLPROGRAMUNIFORM3IVPROC>("glProgramUniform3iv", Null_glProgramUniform3iv)),
-		ProgramUniform3f(GetProc<PFNGLPROGRAMUNIFORM3FPROC>("glProgramUniform3f", Null_glProgramUniform3f)),
-		ProgramUniform3fv(GetProc<PFNGLPROGRAMUNIFORM3FVPROC>("glProgramUniform3fv", Null_glProgramUniform3fv)),
-		ProgramUniform3d(GetProc<PFNGLPROGRAMUNIFORM3DPROC>("glProgramUniform3d", Null_glProgramUniform3d)),
-		ProgramUniform3dv(GetProc<PFNGLPROGRAMUNIFORM3DVPROC>("glProgramUniform3dv", Null_glProgramUniform3dv)),
-		ProgramUniform3ui(GetProc<PFNGLPROGRAMUNIFORM3UIPROC>("glProgramUniform3ui", Null_glProgramUniform3ui)),
-		ProgramUniform3uiv(GetProc<PFNGLPROGRAMUNIFORM3UIVPROC>("glProgramUniform3uiv", Null_glProgramUniform3uiv)),
-		ProgramUniform4i(GetProc<PFNGLPROGRAMUNIFORM4IPROC>("glProgramUniform4i", Null_glProgramUniform4i)),
-		ProgramUniform4iv(GetProc<PFNGLPROGRAMUNIFORM4IVPROC>("glProgramUniform4iv", Null_glProgramUniform4iv)),
-		ProgramUniform4f(GetProc<PFNGLPROGRAMUNIFORM4FPROC>("glProgramUniform4f", Null_glProgramUniform4f)),
-		ProgramUniform4fv(GetProc<PFNGLPROGRAMUNIFORM4FVPROC>("glProgramUniform4fv", Null_glProgramUniform4fv)),
-		ProgramUniform4d(GetProc<PFNGLPROGRAMUNIFORM4DPROC>("glProgramUniform4d", Null_glProgramUniform4d)),
-		ProgramUniform4dv(GetProc<PFNGLPROGRAMUNIFORM4DVPROC>("glProgramUniform4dv", Null_glProgramUniform4dv)),
-		ProgramUniform4ui(GetProc<PFNGLPROGRAMUNIFORM4UIPROC>("glProgramUniform4ui", Null_glProgramUniform4ui)),
-		ProgramUniform4uiv(GetProc<PFNGLPROGRAMUNIFORM4UIVPROC>("glProgramUniform4uiv", Null_glProgramUniform4uiv)),
-		ProgramUniformMatrix2fv(GetProc<PFNGLPROGRAMUNIFORMMATRIX2FVPROC>("glProgramUniformMatrix2fv", Null_glProgramUniformMatrix2fv)),
-		ProgramUniformMatrix3fv(GetProc<PFNGLPROGRAMUNIFORMMATRIX3FVPROC>("glProgramUniformMatrix3fv", Null_glProgramUniformMatrix3fv)),
-		ProgramUniformMatrix4fv(GetProc<PFNGLPROGRAMUNIFORMMATRIX4FVPROC>("glProgramUniformMatrix4fv", Null_glProgramUniformMatrix4fv)),
-		ProgramUniformMatrix2dv(GetProc<PFNGLPROGRAMUNIFORMMATRIX2DVPROC>("glProgramUniformMatrix2dv", Null_glProgramUniformMatrix2dv)),
-		ProgramUniformMatrix3dv(GetProc<PFNGLPROGRAMUNIFORMMATRIX3DVPROC>("glProgramUniformMatrix3dv", Null_glProgramUniformMatrix3dv)),
-		ProgramUniformMatrix4dv(GetProc<PFNGLPROGRAMUNIFORMMATRIX4DVPROC>("glProgramUniformMatrix4dv", Null_glProgramUniformMatrix4dv)),
-		ProgramUniformMatrix2x3fv(GetProc<PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC>("glProgramUniformMatrix2x3fv", Null_glProgramUniformMatrix2x3fv)),
-		ProgramUniformMatrix3x2fv(GetProc<PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC>("glProgramUniformMatrix3x2fv", Null_glProgramUniformMatrix3x2fv)),
-		ProgramUniformMatrix2x4fv(GetProc<PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC>("glProgramUniformMatrix2x4fv", Null_glProgramUniformMatrix2x4fv)),
-		ProgramUniformMatrix4x2fv(GetProc<PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC>("glProgramUniformMatrix4x2fv", Null_glProgramUniformMatrix4x2fv)),
-		ProgramUniformMatrix3x4fv(GetProc<PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC>("glProgramUniformMatrix3x4fv", Null_glProgramUniformMatrix3x4fv)),
-		ProgramUniformMatrix4x3fv(GetProc<PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC>("glProgramUniformMatrix4x3fv", Null_glProgramUniformMatrix4x3fv)),
-		ProgramUniformMatrix2x3dv(GetProc<PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC>("glProgramUniformMatrix2x3dv", Null_glProgramUniformMatrix2x3dv)),
-		ProgramUniformMatrix3x2dv(GetProc<PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC>("glProgramUniformMatrix3x2dv", Null_glProgramUniformMatrix3x2dv)),
-		ProgramUniformMatrix2x4dv(GetProc<PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC>("glProgramUniformMatrix2x4dv", Null_glProgramUniformMatrix2x4dv)),
-		ProgramUniformMatrix4x2dv(GetProc<PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC>("glProgramUniformMatrix4x2dv", Null_glProgramUniformMatrix4x2dv)),
-		ProgramUniformMatrix3x4dv(GetProc<PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC>("glProgramUniformMatrix3x4dv", Null_glProgramUniformMatrix3x4dv)),
-		ProgramUniformMatrix4x3dv(GetProc<PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC>("glProgramUniformMatrix4x3dv", Null_glProgramUniformMatrix4x3dv)),
-		ValidateProgramPipeline(GetProc<PFNGLVALIDATEPROGRAMPIPELINEPROC>("glValidateProgramPipeline", Null_glValidateProgramPipeline)),
-		GetProgramPipelineInfoLog(GetProc<PFNGLGETPROGRAMPIPELINEINFOLOGPROC>("glGetProgramPipelineInfoLog", Null_glGetProgramPipelineInfoLog)),
-		VertexAttribL1d(GetProc<PFNGLVERTEXATTRIBL1DPROC>("glVertexAttribL1d", Null_glVertexAttribL1d)),
-		VertexAttribL2d(GetProc<PFNGLVERTEXATTRIBL2DPROC>("glVertexAttribL2d", Null_glVertexAttribL2d)),
-		VertexAttribL3d(GetProc<PFNGLVERTEXATTRIBL3DPROC>("glVertexAttribL3d", Null_glVertexAttribL3d)),
-		VertexAttribL4d(GetProc<PFNGLVERTEXATTRIBL4DPROC>("glVertexAttribL4d", Null_glVertexAttribL4d)),
-		VertexAttribL1dv(GetProc<PFNGLVERTEXATTRIBL1DVPROC>("glVertexAttribL1dv", Null_glVertexAttribL1dv)),
-		VertexAttribL2dv(GetProc<PFNGLVERTEXATTRIBL2DVPROC>("glVertexAttribL2dv", Null_glVertexAttribL2dv)),
-		VertexAttribL3dv(GetProc<PFNGLVERTEXATTRIBL3DVPROC>("glVertexAttribL3dv", Null_glVertexAttribL3dv)),
-		VertexAttribL4dv(GetProc<PFNGLVERTEXATTRIBL4DVPROC>("glVertexAttribL4dv", Null_glVertexAttribL4dv)),
-		VertexAttribLPointer(GetProc<PFNGLVERTEXATTRIBLPOINTERPROC>("glVertexAttribLPointer", Null_glVertexAttribLPointer)),
-		GetVertexAttribLdv(GetProc<PFNGLGETVERTEXATTRIBLDVPROC>("glGetVertexAttribLdv", Null_glGetVertexAttribLdv)),
-		ViewportArrayv(GetProc<PFNGLVIEWPORTARRAYVPROC>("glViewportArrayv", Null_glViewportArrayv)),
-		ViewportIndexedf(GetProc<PFNGLVIEWPORTINDEXEDFPROC>("glViewportIndexedf", Null_glViewportIndexedf)),
-		ViewportIndexedfv(GetProc<PFNGLVIEWPORTINDEXEDFVPROC>("glViewportIndexedfv", Null_glViewportIndexedfv)),
-		ScissorArrayv(GetProc<PFNGLSCISSORARRAYVPROC>("glScissorArrayv", Null_glScissorArrayv)),
-		ScissorIndexed(GetProc<PFNGLSCISSORINDEXEDPROC>("glScissorIndexed", Null_glScissorIndexed)),
-		ScissorIndexedv(GetProc<PFNGLSCISSORINDEXEDVPROC>("glScissorIndexedv", Null_glScissorIndexedv)),
-		DepthRangeArrayv(GetProc<PFNGLDEPTHRANGEARRAYVPROC>("glDepthRangeArrayv", Null_glDepthRangeArrayv)),
-		DepthRangeIndexed(GetProc<PFNGLDEPTHRANGEINDEXEDPROC>("glDepthRangeIndexed", Null_glDepthRangeIndexed)),
-		GetFloati_v(GetProc<PFNGLGETFLOATI_VPROC>("glGetFloati_v", Null_glGetFloati_v)),
-		GetDoublei_v(GetProc<PFNGLGETDOUBLEI_VPROC>("glGetDoublei_v", Null_glGetDoublei_v))
+	static void Resolve_glReleaseShaderCompiler(Version46& c){ c.ReleaseShaderCompiler = c.GetProc<decltype(c.ReleaseShaderCompiler)>("glReleaseShaderCompiler", Null_glReleaseShaderCompiler); }
+	static void Resolve_glShaderBinary(Version46& c){ c.ShaderBinary = c.GetProc<decltype(c.ShaderBinary)>("glShaderBinary", Null_glShaderBinary); }
+	static void Resolve_glGetShaderPrecisionFormat(Version46& c){ c.GetShaderPrecisionFormat = c.GetProc<decltype(c.GetShaderPrecisionFormat)>("glGetShaderPrecisionFormat", Null_glGetShaderPrecisionFormat); }
+	static void Resolve_glDepthRangef(Version46& c){ c.DepthRangef = c.GetProc<decltype(c.DepthRangef)>("glDepthRangef", Null_glDepthRangef); }
+	static void Resolve_glClearDepthf(Version46& c){ c.ClearDepthf = c.GetProc<decltype(c.ClearDepthf)>("glClearDepthf", Null_glClearDepthf); }
+	static void Resolve_glGetProgramBinary(Version46& c){ c.GetProgramBinary = c.GetProc<decltype(c.GetProgramBinary)>("glGetProgramBinary", Null_glGetProgramBinary); }
+	static void Resolve_glProgramBinary(Version46& c){ c.ProgramBinary = c.GetProc<decltype(c.ProgramBinary)>("glProgramBinary", Null_glProgramBinary); }
+	static void Resolve_glProgramParameteri(Version46& c){ c.ProgramParameteri = c.GetProc<decltype(c.ProgramParameteri)>("glProgramParameteri", Null_glProgramParameteri); }
+	static void Resolve_glUseProgramStages(Version46& c){ c.UseProgramStages = c.GetProc<decltype(c.UseProgramStages)>("glUseProgramStages", Null_glUseProgramStages); }
+	static void Resolve_glActiveShaderProgram(Version46& c){ c.ActiveShaderProgram = c.GetProc<decltype(c.ActiveShaderProgram)>("glActiveShaderProgram", Null_glActiveShaderProgram); }
+	static void Resolve_glCreateShaderProgramv(Version46& c){ c.CreateShaderProgramv = c.GetProc<decltype(c.CreateShaderProgramv)>("glCreateShaderProgramv", Null_glCreateShaderProgramv); }
+	static void Resolve_glBindProgramPipeline(Version46& c){ c.BindProgramPipeline = c.GetProc<decltype(c.BindProgramPipeline)>("glBindProgramPipeline", Null_glBindProgramPipeline); }
+	static void Resolve_glDeleteProgramPipelines(Version46& c){ c.DeleteProgramPipelines = c.GetProc<decltype(c.DeleteProgramPipelines)>("glDeleteProgramPipelines", Null_glDeleteProgramPipelines); }
+	static void Resolve_glGenProgramPipelines(Version46& c){ c.GenProgramPipelines = c.GetProc<decltype(c.GenProgramPipelines)>("glGenProgramPipelines", Null_glGenProgramPipelines); }
+	static void Resolve_glIsProgramPipeline(Version46& c){ c.IsProgramPipeline = c.GetProc<decltype(c.IsProgramPipeline)>("glIsProgramPipeline", Null_glIsProgramPipeline); }
+	static void Resolve_glGetProgramPipelineiv(Version46& c){ c.GetProgramPipelineiv = c.GetProc<decltype(c.GetProgramPipelineiv)>("glGetProgramPipelineiv", Null_glGetProgramPipelineiv); }
+	static void Resolve_glProgramUniform1i(Version46& c){ c.ProgramUniform1i = c.GetProc<decltype(c.ProgramUniform1i)>("glProgramUniform1i", Null_glProgramUniform1i); }
+	static void Resolve_glProgramUniform1iv(Version46& c){ c.ProgramUniform1iv = c.GetProc<decltype(c.ProgramUniform1iv)>("glProgramUniform1iv", Null_glProgramUniform1iv); }
+	static void Resolve_glProgramUniform1f(Version46& c){ c.ProgramUniform1f = c.GetProc<decltype(c.ProgramUniform1f)>("glProgramUniform1f", Null_glProgramUniform1f); }
+	static void Resolve_glProgramUniform1fv(Version46& c){ c.ProgramUniform1fv = c.GetProc<decltype(c.ProgramUniform1fv)>("glProgramUniform1fv", Null_glProgramUniform1fv); }
+	static void Resolve_glProgramUniform1d(Version46& c){ c.ProgramUniform1d = c.GetProc<decltype(c.ProgramUniform1d)>("glProgramUniform1d", Null_glProgramUniform1d); }
+	static void Resolve_glProgramUniform1dv(Version46& c){ c.ProgramUniform1dv = c.GetProc<decltype(c.ProgramUniform1dv)>("glProgramUniform1dv", Null_glProgramUniform1dv); }
+	static void Resolve_glProgramUniform1ui(Version46& c){ c.ProgramUniform1ui = c.GetProc<decltype(c.ProgramUniform1ui)>("glProgramUniform1ui", Null_glProgramUniform1ui); }
+	static void Resolve_glProgramUniform1uiv(Version46& c){ c.ProgramUniform1uiv = c.GetProc<decltype(c.ProgramUniform1uiv)>("glProgramUniform1uiv", Null_glProgramUniform1uiv); }
+	static void Resolve_glProgramUniform2i(Version46& c){ c.ProgramUniform2i = c.GetProc<decltype(c.ProgramUniform2i)>("glProgramUniform2i", Null_glProgramUniform2i); }
+	static void Resolve_glProgramUniform2iv(Version46& c){ c.ProgramUniform2iv = c.GetProc<decltype(c.ProgramUniform2iv)>("glProgramUniform2iv", Null_glProgramUniform2iv); }
+	static void Resolve_glProgramUniform2f(Version46& c){ c.ProgramUniform2f = c.GetProc<decltype(c.ProgramUniform2f)>("glProgramUniform2f", Null_glProgramUniform2f); }
+	static void Resolve_glProgramUniform2fv(Version46& c){ c.ProgramUniform2fv = c.GetProc<decltype(c.ProgramUniform2fv)>("glProgramUniform2fv", Null_glProgramUniform2fv); }
+	static void Resolve_glProgramUniform2d(Version46& c){ c.ProgramUniform2d = c.GetProc<decltype(c.ProgramUniform2d)>("glProgramUniform2d", Null_glProgramUniform2d); }
+	static void Resolve_glProgramUniform2dv(Version46& c){ c.ProgramUniform2dv = c.GetProc<decltype(c.ProgramUniform2dv)>("glProgramUniform2dv", Null_glProgramUniform2dv); }
+	static void Resolve_glProgramUniform2ui(Version46& c){ c.ProgramUniform2ui = c.GetProc<decltype(c.ProgramUniform2ui)>("glProgramUniform2ui", Null_glProgramUniform2ui); }
+	static void Resolve_glProgramUniform2uiv(Version46& c){ c.ProgramUniform2uiv = c.GetProc<decltype(c.ProgramUniform2uiv)>("glProgramUniform2uiv", Null_glProgramUniform2uiv); }
+	static void Resolve_glProgramUniform3i(Version46& c){ c.ProgramUniform3i = c.GetProc<decltype(c.ProgramUniform3i)>("glProgramUniform3i", Null_glProgramUniform3i); }
+	static void Resolve_glProgramUniform3iv(Version46& c){ c.ProgramUniform3iv = c.GetProc<decltype(c.ProgramUniform3iv)>("glProgramUniform3iv", Null_glProgramUniform3iv); }
+	static void Resolve_glProgramUniform3f(Version46& c){ c.ProgramUniform3f = c.GetProc<decltype(c.ProgramUniform3f)>("glProgramUniform3f", Null_glProgramUniform3f); }
+	static void Resolve_glProgramUniform3fv(Version46& c){ c.ProgramUniform3fv = c.GetProc<decltype(c.ProgramUniform3fv)>("glProgramUniform3fv", Null_glProgramUniform3fv); }
+	static void Resolve_glProgramUniform3d(Version46& c){ c.ProgramUniform3d = c.GetProc<decltype(c.ProgramUniform3d)>("glProgramUniform3d", Null_glProgramUniform3d); }
+	static void Resolve_glProgramUniform3dv(Version46& c){ c.ProgramUniform3dv = c.GetProc<decltype(c.ProgramUniform3dv)>("glProgramUniform3dv", Null_glProgramUniform3dv); }
+	static void Resolve_glProgramUniform3ui(Version46& c){ c.ProgramUniform3ui = c.GetProc<decltype(c.ProgramUniform3ui)>("glProgramUniform3ui", Null_glProgramUniform3ui); }
+	static void Resolve_glProgramUniform3uiv(Version46& c){ c.ProgramUniform3uiv = c.GetProc<decltype(c.ProgramUniform3uiv)>("glProgramUniform3uiv", Null_glProgramUniform3uiv); }
+	static void Resolve_glProgramUniform4i(Version46& c){ c.ProgramUniform4i = c.GetProc<decltype(c.ProgramUniform4i)>("glProgramUniform4i", Null_glProgramUniform4i); }
+	static void Resolve_glProgramUniform4iv(Version46& c){ c.ProgramUniform4iv = c.GetProc<decltype(c.ProgramUniform4iv)>("glProgramUniform4iv", Null_glProgramUniform4iv); }
+	static void Resolve_glProgramUniform4f(Version46& c){ c.ProgramUniform4f = c.GetProc<decltype(c.ProgramUniform4f)>("glProgramUniform4f", Null_glProgramUniform4f); }
+	static void Resolve_glProgramUniform4fv(Version46& c){ c.ProgramUniform4fv = c.GetProc<decltype(c.ProgramUniform4fv)>("glProgramUniform4fv", Null_glProgramUniform4fv); }
+	static void Resolve_glProgramUniform4d(Version46& c){ c.ProgramUniform4d = c.GetProc<decltype(c.ProgramUniform4d)>("glProgramUniform4d", Null_glProgramUniform4d); }
+	static void Resolve_glProgramUniform4dv(Version46& c){ c.ProgramUniform4dv = c.GetProc<decltype(c.ProgramUniform4dv)>("glProgramUniform4dv", Null_glProgramUniform4dv); }
+	static void Resolve_glProgramUniform4ui(Version46& c){ c.ProgramUniform4ui = c.GetProc<decltype(c.ProgramUniform4ui)>("glProgramUniform4ui", Null_glProgramUniform4ui); }
+	static void Resolve_glProgramUniform4uiv(Version46& c){ c.ProgramUniform4uiv = c.GetProc<decltype(c.ProgramUniform4uiv)>("glProgramUniform4uiv", Null_glProgramUniform4uiv); }
+	static void Resolve_glProgramUniformMatrix2fv(Version46& c){ c.ProgramUniformMatrix2fv = c.GetProc<decltype(c.ProgramUniformMatrix2fv)>("glProgramUniformMatrix2fv", Null_glProgramUniformMatrix2fv); }
+	static void Resolve_glProgramUniformMatrix3fv(Version46& c){ c.ProgramUniformMatrix3fv = c.GetProc<decltype(c.ProgramUniformMatrix3fv)>("glProgramUniformMatrix3fv", Null_glProgramUniformMatrix3fv); }
+	static void Resolve_glProgramUniformMatrix4fv(Version46& c){ c.ProgramUniformMatrix4fv = c.GetProc<decltype(c.ProgramUniformMatrix4fv)>("glProgramUniformMatrix4fv", Null_glProgramUniformMatrix4fv); }
+	static void Resolve_glProgramUniformMatrix2dv(Version46& c){ c.ProgramUniformMatrix2dv = c.GetProc<decltype(c.ProgramUniformMatrix2dv)>("glProgramUniformMatrix2dv", Null_glProgramUniformMatrix2dv); }
+	static void Resolve_glProgramUniformMatrix3dv(Version46& c){ c.ProgramUniformMatrix3dv = c.GetProc<decltype(c.ProgramUniformMatrix3dv)>("glProgramUniformMatrix3dv", Null_glProgramUniformMatrix3dv); }
+	static void Resolve_glProgramUniformMatrix4dv(Version46& c){ c.ProgramUniformMatrix4dv = c.GetProc<decltype(c.ProgramUniformMatrix4dv)>("glProgramUniformMatrix4dv", Null_glProgramUniformMatrix4dv); }
+	static void Resolve_glProgramUniformMatrix2x3fv(Version46& c){ c.ProgramUniformMatrix2x3fv = c.GetProc<decltype(c.ProgramUniformMatrix2x3fv)>("glProgramUniformMatrix2x3fv", Null_glProgramUniformMatrix2x3fv); }
+	static void Resolve_glProgramUniformMatrix3x2fv(Version46& c){ c.ProgramUniformMatrix3x2fv = c.GetProc<decltype(c.ProgramUniformMatrix3x2fv)>("glProgramUniformMatrix3x2fv", Null_glProgramUniformMatrix3x2fv); }
+	static void Resolve_glProgramUniformMatrix2x4fv(Version46& c){ c.ProgramUniformMatrix2x4fv = c.GetProc<decltype(c.ProgramUniformMatrix2x4fv)>("glProgramUniformMatrix2x4fv", Null_glProgramUniformMatrix2x4fv); }
+	static void Resolve_glProgramUniformMatrix4x2fv(Version46& c){ c.ProgramUniformMatrix4x2fv = c.GetProc<decltype(c.ProgramUniformMatrix4x2fv)>("glProgramUniformMatrix4x2fv", Null_glProgramUniformMatrix4x2fv); }
+	static void Resolve_glProgramUniformMatrix3x4fv(Version46& c){ c.ProgramUniformMatrix3x4fv = c.GetProc<decltype(c.ProgramUniformMatrix3x4fv)>("glProgramUniformMatrix3x4fv", Null_glProgramUniformMatrix3x4fv); }
+	static void Resolve_glProgramUniformMatrix4x3fv(Version46& c){ c.ProgramUniformMatrix4x3fv = c.GetProc<decltype(c.ProgramUniformMatrix4x3fv)>("glProgramUniformMatrix4x3fv", Null_glProgramUniformMatrix4x3fv); }
+	static void Resolve_glProgramUniformMatrix2x3dv(Version46& c){ c.ProgramUniformMatrix2x3dv = c.GetProc<decltype(c.ProgramUniformMatrix2x3dv)>("glProgramUniformMatrix2x3dv", Null_glProgramUniformMatrix2x3dv); }
+	static void Resolve_glProgramUniformMatrix3x2dv(Version46& c){ c.ProgramUniformMatrix3x2dv = c.GetProc<decltype(c.ProgramUniformMatrix3x2dv)>("glProgramUniformMatrix3x2dv", Null_glProgramUniformMatrix3x2dv); }
+	static void Resolve_glProgramUniformMatrix2x4dv(Version46& c){ c.ProgramUniformMatrix2x4dv = c.GetProc<decltype(c.ProgramUniformMatrix2x4dv)>("glProgramUniformMatrix2x4dv", Null_glProgramUniformMatrix2x4dv); }
+	static void Resolve_glProgramUniformMatrix4x2dv(Version46& c){ c.ProgramUniformMatrix4x2dv = c.GetProc<decltype(c.ProgramUniformMatrix4x2dv)>("glProgramUniformMatrix4x2dv", Null_glProgramUniformMatrix4x2dv); }
+	static void Resolve_glProgramUniformMatrix3x4dv(Version46& c){ c.ProgramUniformMatrix3x4dv = c.GetProc<decltype(c.ProgramUniformMatrix3x4dv)>("glProgramUniformMatrix3x4dv", Null_glProgramUniformMatrix3x4dv); }
+	static void Resolve_glProgramUniformMatrix4x3dv(Version46& c){ c.ProgramUniformMatrix4x3dv = c.GetProc<decltype(c.ProgramUniformMatrix4x3dv)>("glProgramUniformMatrix4x3dv", Null_glProgramUniformMatrix4x3dv); }
+	static void Resolve_glValidateProgramPipeline(Version46& c){ c.ValidateProgramPipeline = c.GetProc<decltype(c.ValidateProgramPipeline)>("glValidateProgramPipeline", Null_glValidateProgramPipeline); }
+	static void Resolve_glGetProgramPipelineInfoLog(Version46& c){ c.GetProgramPipelineInfoLog = c.GetProc<decltype(c.GetProgramPipelineInfoLog)>("glGetProgramPipelineInfoLog", Null_glGetProgramPipelineInfoLog); }
+	static void Resolve_glVertexAttribL1d(Version46& c){ c.VertexAttribL1d = c.GetProc<decltype(c.VertexAttribL1d)>("glVertexAttribL1d", Null_glVertexAttribL1d); }
+	static void Resolve_glVertexAttribL2d(Version46& c){ c.VertexAttribL2d = c.GetProc<decltype(c.VertexAttribL2d)>("glVertexAttribL2d", Null_glVertexAttribL2d); }
+	static void Resolve_glVertexAttribL3d(Version46& c){ c.VertexAttribL3d = c.GetProc<decltype(c.VertexAttribL3d)>("glVertexAttribL3d", Null_glVertexAttribL3d); }
+	static void Resolve_glVertexAttribL4d(Version46& c){ c.VertexAttribL4d = c.GetProc<decltype(c.VertexAttribL4d)>("glVertexAttribL4d", Null_glVertexAttribL4d); }
+	static void Resolve_glVertexAttribL1dv(Version46& c){ c.VertexAttribL1dv = c.GetProc<decltype(c.VertexAttribL1dv)>("glVertexAttribL1dv", Null_glVertexAttribL1dv); }
+	static void Resolve_glVertexAttribL2dv(Version46& c){ c.VertexAttribL2dv = c.GetProc<decltype(c.VertexAttribL2dv)>("glVertexAttribL2dv", Null_glVertexAttribL2dv); }
+	static void Resolve_glVertexAttribL3dv(Version46& c){ c.VertexAttribL3dv = c.GetProc<decltype(c.VertexAttribL3dv)>("glVertexAttribL3dv", Null_glVertexAttribL3dv); }
+	static void Resolve_glVertexAttribL4dv(Version46& c){ c.VertexAttribL4dv = c.GetProc<decltype(c.VertexAttribL4dv)>("glVertexAttribL4dv", Null_glVertexAttribL4dv); }
+	static void Resolve_glVertexAttribLPointer(Version46& c){ c.VertexAttribLPointer = c.GetProc<decltype(c.VertexAttribLPointer)>("glVertexAttribLPointer", Null_glVertexAttribLPointer); }
+	static void Resolve_glGetVertexAttribLdv(Version46& c){ c.GetVertexAttribLdv = c.GetProc<decltype(c.GetVertexAttribLdv)>("glGetVertexAttribLdv", Null_glGetVertexAttribLdv); }
+	static void Resolve_glViewportArrayv(Version46& c){ c.ViewportArrayv = c.GetProc<decltype(c.ViewportArrayv)>("glViewportArrayv", Null_glViewportArrayv); }
+	static void Resolve_glViewportIndexedf(Version46& c){ c.ViewportIndexedf = c.GetProc<decltype(c.ViewportIndexedf)>("glViewportIndexedf", Null_glViewportIndexedf); }
+	static void Resolve_glViewportIndexedfv(Version46& c){ c.ViewportIndexedfv = c.GetProc<decltype(c.ViewportIndexedfv)>("glViewportIndexedfv", Null_glViewportIndexedfv); }
+	static void Resolve_glScissorArrayv(Version46& c){ c.ScissorArrayv = c.GetProc<decltype(c.ScissorArrayv)>("glScissorArrayv", Null_glScissorArrayv); }
+	static void Resolve_glScissorIndexed(Version46& c){ c.ScissorIndexed = c.GetProc<decltype(c.ScissorIndexed)>("glScissorIndexed", Null_glScissorIndexed); }
+	static void Resolve_glScissorIndexedv(Version46& c){ c.ScissorIndexedv = c.GetProc<decltype(c.ScissorIndexedv)>("glScissorIndexedv", Null_glScissorIndexedv); }
+	static void Resolve_glDepthRangeArrayv(Version46& c){ c.DepthRangeArrayv = c.GetProc<decltype(c.DepthRangeArrayv)>("glDepthRangeArrayv", Null_glDepthRangeArrayv); }
+	static void Resolve_glDepthRangeIndexed(Version46& c){ c.DepthRangeIndexed = c.GetProc<decltype(c.DepthRangeIndexed)>("glDepthRangeIndexed", Null_glDepthRangeIndexed); }
+	static void Resolve_glGetFloati_v(Version46& c){ c.GetFloati_v = c.GetProc<decltype(c.GetFloati_v)>("glGetFloati_v", Null_glGetFloati_v); }
+	static void Resolve_glGetDoublei_v(Version46& c){ c.GetDoublei_v = c.GetProc<decltype(c.GetDoublei_v)>("glGetDoublei_v", Null_glGetDoublei_v); }
+	static void APIENTRY Lazy_glReleaseShaderCompiler (void){ auto& c = ResolveLazy(Resolve_glReleaseShaderCompiler, [](const Version46& c){ return c.ReleaseShaderCompiler == Lazy_glReleaseShaderCompiler; }); return c.ReleaseShaderCompiler(); }
+	static void APIENTRY Lazy_glShaderBinary (GLsizei count, const GLuint* shaders, GLenum binaryFormat, const void* binary, GLsizei length){ auto& c = ResolveLazy(Resolve_glShaderBinary, [](const Version46& c){ return c.ShaderBinary == Lazy_glShaderBinary; }); return c.ShaderBinary(count, shaders, binaryFormat, binary, length); }
+	static void APIENTRY Lazy_glGetShaderPrecisionFormat (GLenum shadertype, GLenum precisiontype, GLint* range, GLint* precision){ auto& c = ResolveLazy(Resolve_glGetShaderPrecisionFormat, [](const Version46& c){ return c.GetShaderPrecisionFormat == Lazy_glGetShaderPrecisionFormat; }); return c.GetShaderPrecisionFormat(shadertype, precisiontype, range, precision); }
+	static void APIENTRY Lazy_glDepthRangef (GLfloat n, GLfloat f){ auto& c = ResolveLazy(Resolve_glDepthRangef, [](const Version46& c){ return c.DepthRangef == Lazy_glDepthRangef; }); return c.DepthRangef(n, f); }
+	static void APIENTRY Lazy_glClearDepthf (GLfloat d){ auto& c = ResolveLazy(Resolve_glClearDepthf, [](const Version46& c){ return c.ClearDepthf == Lazy_glClearDepthf; }); return c.ClearDepthf(d); }
+	static void APIENTRY Lazy_glGetProgramBinary (GLuint program, GLsizei bufSize, GLsizei* length, GLenum* binaryFormat, void* binary){ auto& c = ResolveLazy(Resolve_glGetProgramBinary, [](const Version46& c){ return c.GetProgramBinary == Lazy_glGetProgramBinary; }); return c.GetProgramBinary(program, bufSize, length, binaryFormat, binary); }
+	static void APIENTRY Lazy_glProgramBinary (GLuint program, GLenum binaryFormat, const void* binary, GLsizei length){ auto& c = ResolveLazy(Resolve_glProgramBinary, [](const Version46& c){ return c.ProgramBinary == Lazy_glProgramBinary; }); return c.ProgramBinary(program, binaryFormat, binary, length); }
+	static void APIENTRY Lazy_glProgramParameteri (GLuint program, GLenum pname, GLint value){ auto& c = ResolveLazy(Resolve_glProgramParameteri, [](const Version46& c){ return c.ProgramParameteri == Lazy_glProgramParameteri; }); return c.ProgramParameteri(program, pname, value); }
+	static void APIENTRY Lazy_glUseProgramStages (GLuint pipeline, GLbitfield stages, GLuint program){ auto& c = ResolveLazy(Resolve_glUseProgramStages, [](const Version46& c){ return c.UseProgramStages == Lazy_glUseProgramStages; }); return c.UseProgramStages(pipeline, stages, program); }
+	static void APIENTRY Lazy_glActiveShaderProgram (GLuint pipeline, GLuint program){ auto& c = ResolveLazy(Resolve_glActiveShaderProgram, [](const Version46& c){ return c.ActiveShaderProgram == Lazy_glActiveShaderProgram; }); return c.ActiveShaderProgram(pipeline, program); }
+	static GLuint APIENTRY Lazy_glCreateShaderProgramv (GLenum type, GLsizei count, const GLchar* const* strings){ auto& c = ResolveLazy(Resolve_glCreateShaderProgramv, [](const Version46& c){ return c.CreateShaderProgramv == Lazy_glCreateShaderProgramv; }); return c.CreateShaderProgramv(type, count, strings); }
+	static void APIENTRY Lazy_glBindProgramPipeline (GLuint pipeline){ auto& c = ResolveLazy(Resolve_glBindProgramPipeline, [](const Version46& c){ return c.BindProgramPipeline == Lazy_glBindProgramPipeline; }); return c.BindProgramPipeline(pipeline); }
+	static void APIENTRY Lazy_glDeleteProgramPipelines (GLsizei n, const GLuint* pipelines){ auto& c = ResolveLazy(Resolve_glDeleteProgramPipelines, [](const Version46& c){ return c.DeleteProgramPipelines == Lazy_glDeleteProgramPipelines; }); return c.DeleteProgramPipelines(n, pipelines); }
+	static void APIENTRY Lazy_glGenProgramPipelines (GLsizei n, GLuint* pipelines){ auto& c = ResolveLazy(Resolve_glGenProgramPipelines, [](const Version46& c){ return c.GenProgramPipelines == Lazy_glGenProgramPipelines; }); return c.GenProgramPipelines(n, pipelines); }
+	static GLboolean APIENTRY Lazy_glIsProgramPipeline (GLuint pipeline){ auto& c = ResolveLazy(Resolve_glIsProgramPipeline, [](const Version46& c){ return c.IsProgramPipeline == Lazy_glIsProgramPipeline; }); return c.IsProgramPipeline(pipeline); }
+	static void APIENTRY Lazy_glGetProgramPipelineiv (GLuint pipeline, GLenum pname, GLint* params){ auto& c = ResolveLazy(Resolve_glGetProgramPipelineiv, [](const Version46& c){ return c.GetProgramPipelineiv == Lazy_glGetProgramPipelineiv; }); return c.GetProgramPipelineiv(pipeline, pname, params); }
+	static void APIENTRY Lazy_glProgramUniform1i (GLuint program, GLint location, GLint v0){ auto& c = ResolveLazy(Resolve_glProgramUniform1i, [](const Version46& c){ return c.ProgramUniform1i == Lazy_glProgramUniform1i; }); return c.ProgramUniform1i(program, location, v0); }
+	static void APIENTRY Lazy_glProgramUniform1iv (GLuint program, GLint location, GLsizei count, const GLint* value){ auto& c = ResolveLazy(Resolve_glProgramUniform1iv, [](const Version46& c){ return c.ProgramUniform1iv == Lazy_glProgramUniform1iv; }); return c.ProgramUniform1iv(program, location, count, value); }
+	static void APIENTRY Lazy_glProgramUniform1f (GLuint program, GLint location, GLfloat v0){ auto& c = ResolveLazy(Resolve_glProgramUniform1f, [](const Version46& c){ return c.ProgramUniform1f == Lazy_glProgramUniform1f; }); return c.ProgramUniform1f(program, location, v0); }
+	static void APIENTRY Lazy_glProgramUniform1fv (GLuint program, GLint location, GLsizei count, const GLfloat* value){ auto& c = ResolveLazy(Resolve_glProgramUniform1fv, [](const Version46& c){ return c.ProgramUniform1fv == Lazy_glProgramUniform1fv; }); return c.ProgramUniform1fv(program, location, count, value); }
+	static void APIENTRY Lazy_glProgramUniform1d (GLuint program, GLint location, GLdouble v0){ auto& c = ResolveLazy(Resolve_glProgramUniform1d, [](const Version46& c){ return c.ProgramUniform1d == Lazy_glProgramUniform1d; }); return c.ProgramUniform1d(program, location, v0); }
+	static void APIENTRY Lazy_glProgramUniform1dv (GLuint program, GLint location, GLsizei count, const GLdouble* value){ auto& c = ResolveLazy(Resolve_glProgramUniform1dv, [](const Version46& c){ return c.ProgramUniform1dv == Lazy_glProgramUniform1dv; }); return c.ProgramUniform1dv(program, location, count, value); }
+	static void APIENTRY Lazy_glProgramUniform1ui (GLuint program, GLint location, GLuint v0){ auto& c = ResolveLazy(Resolve_glProgramUniform1ui, [](const Version46& c){ return c.ProgramUniform1ui == Lazy_glProgramUniform1ui; }); return c.ProgramUniform1ui(program, location, v0); }
+	static void APIENTRY Lazy_glProgramUniform1uiv (GLuint program, GLint location, GLsizei count, const GLuint* value){ auto& c = ResolveLazy(Resolve_glProgramUniform1uiv, [](const Version46& c){ return c.ProgramUniform1uiv == Lazy_glProgramUniform1uiv; }); return c.ProgramUniform1uiv(program, location, count, value); }
+	static void APIENTRY Lazy_glProgramUniform2i (GLuint program, GLint location, GLint v0, GLint v1){ auto& c = ResolveLazy(Resolve_glProgramUniform2i, [](const Version46& c){ return c.ProgramUniform2i == Lazy_glProgramUniform2i; }); return c.ProgramUniform2i(program, location, v0, v1); }
+	static void APIENTRY Lazy_glProgramUniform2iv (GLuint program, GLint location, GLsizei count, const GLint* value){ auto& c = ResolveLazy(Resolve_glProgramUniform2iv, [](const Version46& c){ return c.ProgramUniform2iv == Lazy_glProgramUniform2iv; }); return c.ProgramUniform2iv(program, location, count, value); }
+	static void APIENTRY Lazy_glProgramUniform2f (GLuint program, GLint location, GLfloat v0, GLfloat v1){ auto& c = ResolveLazy(Resolve_glProgramUniform2f, [](const Version46& c){ return c.ProgramUniform2f == Lazy_glProgramUniform2f; }); return c.ProgramUniform2f(program, location, v0, v1); }
+	static void APIENTRY Lazy_glProgramUniform2fv (GLuint program, GLint location, GLsizei count, const GLfloat* value){ auto& c = ResolveLazy(Resolve_glProgramUniform2fv, [](const Version46& c){ return c.ProgramUniform2fv == Lazy_glProgramUniform2fv; }); return c.ProgramUniform2fv(program, location, count, value); }
+	static void APIENTRY Lazy_glProgramUniform2d (GLuint program, GLint location, GLdouble v0, GLdouble v1){ auto& c = ResolveLazy(Resolve_glProgramUniform2d, [](const Version46& c){ return c.ProgramUniform2d == Lazy_glProgramUniform2d; }); return c.ProgramUniform2d(program, location, v0, v1); }
+	static void APIENTRY Lazy_glProgramUniform2dv (GLuint program, GLint location, GLsizei count, const GLdouble* value){ auto& c = ResolveLazy(Resolve_glProgramUniform2dv, [](const Version46& c){ return c.ProgramUniform2dv == Lazy_glProgramUniform2dv; }); return c.ProgramUniform2dv(program, location, count, value); }
+	static void APIENTRY Lazy_glProgramUniform2ui (GLuint program, GLint location, GLuint v0, GLuint v1){ auto& c = ResolveLazy(Resolve_glProgramUniform2ui, [](const Version46& c){ return c.ProgramUniform2ui == Lazy_glProgramUniform2ui; }); return c.ProgramUniform2ui(program, location, v0, v1); }
+	static void APIENTRY Lazy_glProgramUniform2uiv (GLuint program, GLint location, GLsizei count, const GLuint* value){ auto& c = ResolveLazy(Resolve_glProgramUniform2uiv, [](const Version46& c){ return c.ProgramUniform2uiv == Lazy_glProgramUniform2uiv; }); return c.ProgramUniform2uiv(program, location, count, value); }
+	static void APIENTRY Lazy_glProgramUniform3i (GLuint program, GLint location, GLint v0, GLint v1, GLint v2){ auto& c = ResolveLazy(Resolve_glProgramUniform3i, [](const Version46& c){ return c.ProgramUniform3i == Lazy_glProgramUniform3i; }); return c.ProgramUniform3i(program, location, v0, v1, v2); }
+	static void APIENTRY Lazy_glProgramUniform3iv (GLuint program, GLint location, GLsizei count, const GLint* value){ auto& c = ResolveLazy(Resolve_glProgramUniform3iv, [](const Version46& c){ return c.ProgramUniform3iv == Lazy_glProgramUniform3iv; }); return c.ProgramUniform3iv(program, location, count, value); }
+	static void APIENTRY Lazy_glProgramUniform3f (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2){ auto& c = ResolveLazy(Resolve_glProgramUniform3f, [](const Version46& c){ return c.ProgramUniform3f == Lazy_glProgramUniform3f; }); return c.ProgramUniform3f(program, location, v0, v1, v2); }
+	static void APIENTRY Lazy_glProgramUniform3fv (GLuint program, GLint location, GLsizei count, const GLfloat* value){ auto& c = ResolveLazy(Resolve_glProgramUniform3fv, [](const Version46& c){ return c.ProgramUniform3fv == Lazy_glProgramUniform3fv; }); return c.ProgramUniform3fv(program, location, count, value); }
+	static void APIENTRY Lazy_glProgramUniform3d (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2){ auto& c = ResolveLazy(Resolve_glProgramUniform3d, [](const Version46& c){ return c.ProgramUniform3d == Lazy_glProgramUniform3d; }); return c.ProgramUniform3d(program, location, v0, v1, v2); }
+	static void APIENTRY Lazy_glProgramUniform3dv (GLuint program, GLint location, GLsizei count, const GLdouble* value){ auto& c = ResolveLazy(Resolve_glProgramUniform3dv, [](const Version46& c){ return c.ProgramUniform3dv == Lazy_glProgramUniform3dv; }); return c.ProgramUniform3dv(program, location, count, value); }
+	static void APIENTRY Lazy_glProgramUniform3ui (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2){ auto& c = ResolveLazy(Resolve_glProgramUniform3ui, [](const Version46& c){ return c.ProgramUniform3ui == Lazy_glProgramUniform3ui; }); return c.ProgramUniform3ui(program, location, v0, v1, v2); }
+	static void APIENTRY Lazy_glProgramUniform3uiv (GLuint program, GLint location, GLsizei count, const GLuint* value){ auto& c = ResolveLazy(Resolve_glProgramUniform3uiv, [](const Version46& c){ return c.ProgramUniform3uiv == Lazy_glProgramUniform3uiv; }); return c.ProgramUniform3uiv(program, location, count, value); }
+	static void APIENTRY Lazy_glProgramUniform4i (GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3){ auto& c = ResolveLazy(Resolve_glProgramUniform4i, [](const Version46& c){ return c.ProgramUniform4i == Lazy_glProgramUniform4i; }); return c.ProgramUniform4i(program, location, v0, v1, v2, v3); }
+	static void APIENTRY Lazy_glProgramUniform4iv (GLuint program, GLint location, GLsizei count, const GLint* value){ auto& c = ResolveLazy(Resolve_glProgramUniform4iv, [](const Version46& c){ return c.ProgramUniform4iv == Lazy_glProgramUniform4iv; }); return c.ProgramUniform4iv(program, location, count, value); }
+	static void APIENTRY Lazy_glProgramUniform4f (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3){ auto& c = ResolveLazy(Resolve_glProgramUniform4f, [](const Version46& c){ return c.ProgramUniform4f == Lazy_glProgramUniform4f; }); return c.ProgramUniform4f(program, location, v0, v1, v2, v3); }
+	static void APIENTRY Lazy_glProgramUniform4fv (GLuint program, GLint location, GLsizei count, const GLfloat* value){ auto& c = ResolveLazy(Resolve_glProgramUniform4fv, [](const Version46& c){ return c.ProgramUniform4fv == Lazy_glProgramUniform4fv; }); return c.ProgramUniform4fv(program, location, count, value); }
+	static void APIENTRY Lazy_glProgramUniform4d (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3){ auto& c = ResolveLazy(Resolve_glProgramUniform4d, [](const Version46& c){ return c.ProgramUniform4d == Lazy_glProgramUniform4d; }); return c.ProgramUniform4d(program, location, v0, v1, v2, v3); }
+	static void APIENTRY Lazy_glProgramUniform4dv (GLuint program, GLint location, GLsizei count, const GLdouble* value){ auto& c = ResolveLazy(Resolve_glProgramUniform4dv, [](const Version46& c){ return c.ProgramUniform4dv == Lazy_glProgramUniform4dv; }); return c.ProgramUniform4dv(program, location, count, value); }
+	static void APIENTRY Lazy_glProgramUniform4ui (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3){ auto& c = ResolveLazy(Resolve_glProgramUniform4ui, [](const Version46& c){ return c.ProgramUniform4ui == Lazy_glProgramUniform4ui; }); return c.ProgramUniform4ui(program, location, v0, v1, v2, v3); }
+	static void APIENTRY Lazy_glProgramUniform4uiv (GLuint program, GLint location, GLsizei count, const GLuint* value){ auto& c = ResolveLazy(Resolve_glProgramUniform4uiv, [](const Version46& c){ return c.ProgramUniform4uiv == Lazy_glProgramUniform4uiv; }); return c.ProgramUniform4uiv(program, location, count, value); }
+	static void APIENTRY Lazy_glProgramUniformMatrix2fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value){ auto& c = ResolveLazy(Resolve_glProgramUniformMatrix2fv, [](const Version46& c){ return c.ProgramUniformMatrix2fv == Lazy_glProgramUniformMatrix2fv; }); return c.ProgramUniformMatrix2fv(program, location, count, transpose, value); }
+	static void APIENTRY Lazy_glProgramUniformMatrix3fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value){ auto& c = ResolveLazy(Resolve_glProgramUniformMatrix3fv, [](const Version46& c){ return c.ProgramUniformMatrix3fv == Lazy_glProgramUniformMatrix3fv; }); return c.ProgramUniformMatrix3fv(program, location, count, transpose, value); }
+	static void APIENTRY Lazy_glProgramUniformMatrix4fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value){ auto& c = ResolveLazy(Resolve_glProgramUniformMatrix4fv, [](const Version46& c){ return c.ProgramUniformMatrix4fv == Lazy_glProgramUniformMatrix4fv; }); return c.ProgramUniformMatrix4fv(program, location, count, transpose, value); }
+	static void APIENTRY Lazy_glProgramUniformMatrix2dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value){ auto& c = ResolveLazy(Resolve_glProgramUniformMatrix2dv, [](const Version46& c){ return c.ProgramUniformMatrix2dv == Lazy_glProgramUniformMatrix2dv; }); return c.ProgramUniformMatrix2dv(program, location, count, transpose, value); }
+	static void APIENTRY Lazy_glProgramUniformMatrix3dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value){ auto& c = ResolveLazy(Resolve_glProgramUniformMatrix3dv, [](const Version46& c){ return c.ProgramUniformMatrix3dv == Lazy_glProgramUniformMatrix3dv; }); return c.ProgramUniformMatrix3dv(program, location, count, transpose, value); }
+	static void APIENTRY Lazy_glProgramUniformMatrix4dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value){ auto& c = ResolveLazy(Resolve_glProgramUniformMatrix4dv, [](const Version46& c){ return c.ProgramUniformMatrix4dv == Lazy_glProgramUniformMatrix4dv; }); return c.ProgramUniformMatrix4dv(program, location, count, transpose, value); }
+	static void APIENTRY Lazy_glProgramUniformMatrix2x3fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value){ auto& c = ResolveLazy(Resolve_glProgramUniformMatrix2x3fv, [](const Version46& c){ return c.ProgramUniformMatrix2x3fv == Lazy_glProgramUniformMatrix2x3fv; }); return c.ProgramUniformMatrix2x3fv(program, location, count, transpose, value); }
+	static void APIENTRY Lazy_glProgramUniformMatrix3x2fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value){ auto& c = ResolveLazy(Resolve_glProgramUniformMatrix3x2fv, [](const Version46& c){ return c.ProgramUniformMatrix3x2fv == Lazy_glProgramUniformMatrix3x2fv; }); return c.ProgramUniformMatrix3x2fv(program, location, count, transpose, value); }
+	static void APIENTRY Lazy_glProgramUniformMatrix2x4fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value){ auto& c = ResolveLazy(Resolve_glProgramUniformMatrix2x4fv, [](const Version46& c){ return c.ProgramUniformMatrix2x4fv == Lazy_glProgramUniformMatrix2x4fv; }); return c.ProgramUniformMatrix2x4fv(program, location, count, transpose, value); }
+	static void APIENTRY Lazy_glProgramUniformMatrix4x2fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value){ auto& c = ResolveLazy(Resolve_glProgramUniformMatrix4x2fv, [](const Version46& c){ return c.ProgramUniformMatrix4x2fv == Lazy_glProgramUniformMatrix4x2fv; }); return c.ProgramUniformMatrix4x2fv(program, location, count, transpose, value); }
+	static void APIENTRY Lazy_glProgramUniformMatrix3x4fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value){ auto& c = ResolveLazy(Resolve_glProgramUniformMatrix3x4fv, [](const Version46& c){ return c.ProgramUniformMatrix3x4fv == Lazy_glProgramUniformMatrix3x4fv; }); return c.ProgramUniformMatrix3x4fv(program, location, count, transpose, value); }
+	static void APIENTRY Lazy_glProgramUniformMatrix4x3fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value){ auto& c = ResolveLazy(Resolve_glProgramUniformMatrix4x3fv, [](const Version46& c){ return c.ProgramUniformMatrix4x3fv == Lazy_glProgramUniformMatrix4x3fv; }); return c.ProgramUniformMatrix4x3fv(program, location, count, transpose, value); }
+	static void APIENTRY Lazy_glProgramUniformMatrix2x3dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value){ auto& c = ResolveLazy(Resolve_glProgramUniformMatrix2x3dv, [](const Version46& c){ return c.ProgramUniformMatrix2x3dv == Lazy_glProgramUniformMatrix2x3dv; }); return c.ProgramUniformMatrix2x3dv(program, location, count, transpose, value); }
+	static void APIENTRY Lazy_glProgramUniformMatrix3x2dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value){ auto& c = ResolveLazy(Resolve_glProgramUniformMatrix3x2dv, [](const Version46& c){ return c.ProgramUniformMatrix3x2dv == Lazy_glProgramUniformMatrix3x2dv; }); return c.ProgramUniformMatrix3x2dv(program, location, count, transpose, value); }
+	static void APIENTRY Lazy_glProgramUniformMatrix2x4dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value){ auto& c = ResolveLazy(Resolve_glProgramUniformMatrix2x4dv, [](const Version46& c){ return c.ProgramUniformMatrix2x4dv == Lazy_glProgramUniformMatrix2x4dv; }); return c.ProgramUniformMatrix2x4dv(program, location, count, transpose, value); }
+	static void APIENTRY Lazy_glProgramUniformMatrix4x2dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value){ auto& c = ResolveLazy(Resolve_glProgramUniformMatrix4x2dv, [](const Version46& c){ return c.ProgramUniformMatrix4x2dv == Lazy_glProgramUniformMatrix4x2dv; }); return c.ProgramUniformMatrix4x2dv(program, location, count, transpose, value); }
+	static void APIENTRY Lazy_glProgramUniformMatrix3x4dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value){ auto& c = ResolveLazy(Resolve_glProgramUniformMatrix3x4dv, [](const Version46& c){ return c.ProgramUniformMatrix3x4dv == Lazy_glProgramUniformMatrix3x4dv; }); return c.ProgramUniformMatrix3x4dv(program, location, count, transpose, value); }
+	static void APIENTRY Lazy_glProgramUniformMatrix4x3dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value){ auto& c = ResolveLazy(Resolve_glProgramUniformMatrix4x3dv, [](const Version46& c){ return c.ProgramUniformMatrix4x3dv == Lazy_glProgramUniformMatrix4x3dv; }); return c.ProgramUniformMatrix4x3dv(program, location, count, transpose, value); }
+	static void APIENTRY Lazy_glValidateProgramPipeline (GLuint pipeline){ auto& c = ResolveLazy(Resolve_glValidateProgramPipeline, [](const Version46& c){ return c.ValidateProgramPipeline == Lazy_glValidateProgramPipeline; }); return c.ValidateProgramPipeline(pipeline); }
+	static void APIENTRY Lazy_glGetProgramPipelineInfoLog (GLuint pipeline, GLsizei bufSize, GLsizei* length, GLchar* infoLog){ auto& c = ResolveLazy(Resolve_glGetProgramPipelineInfoLog, [](const Version46& c){ return c.GetProgramPipelineInfoLog == Lazy_glGetProgramPipelineInfoLog; }); return c.GetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog); }
+	static void APIENTRY Lazy_glVertexAttribL1d (GLuint index, GLdouble x){ auto& c = ResolveLazy(Resolve_glVertexAttribL1d, [](const Version46& c){ return c.VertexAttribL1d == Lazy_glVertexAttribL1d; }); return c.VertexAttribL1d(index, x); }
+	static void APIENTRY Lazy_glVertexAttribL2d (GLuint index, GLdouble x, GLdouble y){ auto& c = ResolveLazy(Resolve_glVertexAttribL2d, [](const Version46& c){ return c.VertexAttribL2d == Lazy_glVertexAttribL2d; }); return c.VertexAttribL2d(index, x, y); }
+	static void APIENTRY Lazy_glVertexAttribL3d (GLuint index, GLdouble x, GLdouble y, GLdouble z){ auto& c = ResolveLazy(Resolve_glVertexAttribL3d, [](const Version46& c){ return c.VertexAttribL3d == Lazy_glVertexAttribL3d; }); return c.VertexAttribL3d(index, x, y, z); }
+	static void APIENTRY Lazy_glVertexAttribL4d (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w){ auto& c = ResolveLazy(Resolve_glVertexAttribL4d, [](const Version46& c){ return c.VertexAttribL4d == Lazy_glVertexAttribL4d; }); return c.VertexAttribL4d(index, x, y, z, w); }
+	static void APIENTRY Lazy_glVertexAttribL1dv (GLuint index, const GLdouble* v){ auto& c = ResolveLazy(Resolve_glVertexAttribL1dv, [](const Version46& c){ return c.VertexAttribL1dv == Lazy_glVertexAttribL1dv; }); return c.VertexAttribL1dv(index, v); }
+	static void APIENTRY Lazy_glVertexAttribL2dv (GLuint index, const GLdouble* v){ auto& c = ResolveLazy(Resolve_glVertexAttribL2dv, [](const Version46& c){ return c.VertexAttribL2dv == Lazy_glVertexAttribL2dv; }); return c.VertexAttribL2dv(index, v); }
+	static void APIENTRY Lazy_glVertexAttribL3dv (GLuint index, const GLdouble* v){ auto& c = ResolveLazy(Resolve_glVertexAttribL3dv, [](const Version46& c){ return c.VertexAttribL3dv == Lazy_glVertexAttribL3dv; }); return c.VertexAttribL3dv(index, v); }
+	static void APIENTRY Lazy_glVertexAttribL4dv (GLuint index, const GLdouble* v){ auto& c = ResolveLazy(Resolve_glVertexAttribL4dv, [](const Version46& c){ return c.VertexAttribL4dv == Lazy_glVertexAttribL4dv; }); return c.VertexAttribL4dv(index, v); }
+	static void APIENTRY Lazy_glVertexAttribLPointer (GLuint index, GLint size, GLenum type, GLsizei stride, const void* pointer){ auto& c = ResolveLazy(Resolve_glVertexAttribLPointer, [](const Version46& c){ return c.VertexAttribLPointer == Lazy_glVertexAttribLPointer; }); return c.VertexAttribLPointer(index, size, type, stride, pointer); }
+	static void APIENTRY Lazy_glGetVertexAttribLdv (GLuint index, GLenum pname, GLdouble* params){ auto& c = ResolveLazy(Resolve_glGetVertexAttribLdv, [](const Version46& c){ return c.GetVertexAttribLdv == Lazy_glGetVertexAttribLdv; }); return c.GetVertexAttribLdv(index, pname, params); }
+	static void APIENTRY Lazy_glViewportArrayv (GLuint first, GLsizei count, const GLfloat* v){ auto& c = ResolveLazy(Resolve_glViewportArrayv, [](const Version46& c){ return c.ViewportArrayv == Lazy_glViewportArrayv; }); return c.ViewportArrayv(first, count, v); }
+	static void APIENTRY Lazy_glViewportIndexedf (GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h){ auto& c = ResolveLazy(Resolve_glViewportIndexedf, [](const Version46& c){ return c.ViewportIndexedf == Lazy_glViewportIndexedf; }); return c.ViewportIndexedf(index, x, y, w, h); }
+	static void APIENTRY Lazy_glViewportIndexedfv (GLuint index, const GLfloat* v){ auto& c = ResolveLazy(Resolve_glViewportIndexedfv, [](const Version46& c){ return c.ViewportIndexedfv == Lazy_glViewportIndexedfv; }); return c.ViewportIndexedfv(index, v); }
+	static void APIENTRY Lazy_glScissorArrayv (GLuint first, GLsizei count, const GLint* v){ auto& c = ResolveLazy(Resolve_glScissorArrayv, [](const Version46& c){ return c.ScissorArrayv == Lazy_glScissorArrayv; }); return c.ScissorArrayv(first, count, v); }
+	static void APIENTRY Lazy_glScissorIndexed (GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height){ auto& c = ResolveLazy(Resolve_glScissorIndexed, [](const Version46& c){ return c.ScissorIndexed == Lazy_glScissorIndexed; }); return c.ScissorIndexed(index, left, bottom, width, height); }
+	static void APIENTRY Lazy_glScissorIndexedv (GLuint index, const GLint* v){ auto& c = ResolveLazy(Resolve_glScissorIndexedv, [](const Version46& c){ return c.ScissorIndexedv == Lazy_glScissorIndexedv; }); return c.ScissorIndexedv(index, v); }
+	static void APIENTRY Lazy_glDepthRangeArrayv (GLuint first, GLsizei count, const GLdouble* v){ auto& c = ResolveLazy(Resolve_glDepthRangeArrayv, [](const Version46& c){ return c.DepthRangeArrayv == Lazy_glDepthRangeArrayv; }); return c.DepthRangeArrayv(first, count, v); }
+	static void APIENTRY Lazy_glDepthRangeIndexed (GLuint index, GLdouble n, GLdouble f){ auto& c = ResolveLazy(Resolve_glDepthRangeIndexed, [](const Version46& c){ return c.DepthRangeIndexed == Lazy_glDepthRangeIndexed; }); return c.DepthRangeIndexed(index, n, f); }
+	static void APIENTRY Lazy_glGetFloati_v (GLenum target, GLuint index, GLfloat* data){ auto& c = ResolveLazy(Resolve_glGetFloati_v, [](const Version46& c){ return c.GetFloati_v == Lazy_glGetFloati_v; }); return c.GetFloati_v(target, index, data); }
+	static void APIENTRY Lazy_glGetDoublei_v (GLenum target, GLuint index, GLdouble* data){ auto& c = ResolveLazy(Resolve_glGetDoublei_v, [](const Version46& c){ return c.GetDoublei_v == Lazy_glGetDoublei_v; }); return c.GetDoublei_v(target, index, data); }
+	Version41::Version41(Func_GetProcAddress GetProcAddress, LoadMode Mode):
+		Version40(GetProcAddress, Mode),
+		ReleaseShaderCompiler(GetProc<PFNGLRELEASESHADERCOMPILERPROC>("glReleaseShaderCompiler", Null_glReleaseShaderCompiler, Lazy_glReleaseShaderCompiler)),
+		ShaderBinary(GetProc<PFNGLSHADERBINARYPROC>("glShaderBinary", Null_glShaderBinary, Lazy_glShaderBinary)),
+		GetShaderPrecisionFormat(GetProc<PFNGLGETSHADERPRECISIONFORMATPROC>("glGetShaderPrecisionFormat", Null_glGetShaderPrecisionFormat, Lazy_glGetShaderPrecisionFormat)),
+		DepthRangef(GetProc<PFNGLDEPTHRANGEFPROC>("glDepthRangef", Null_glDepthRangef, Lazy_glDepthRangef)),
+		ClearDepthf(GetProc<PFNGLCLEARDEPTHFPROC>("glClearDepthf", Null_glClearDepthf, Lazy_glClearDepthf)),
+		GetProgramBinary(GetProc<PFNGLGETPROGRAMBINARYPROC>("glGetProgramBinary", Null_glGetProgramBinary, Lazy_glGetProgramBinary)),
+		ProgramBinary(GetProc<PFNGLPROGRAMBINARYPROC>("glProgramBinary", Null_glProgramBinary, Lazy_glProgramBinary)),
+		ProgramParameteri(GetProc<PFNGLPROGRAMPARAMETERIPROC>("glProgramParameteri", Null_glProgramParameteri, Lazy_glProgramParameteri)),
+		UseProgramStages(GetProc<PFNGLUSEPROGRAMSTAGESPROC>("glUseProgramStages", Null_glUseProgramStages, Lazy_glUseProgramStages)),
+		ActiveShaderProgram(GetProc<PFNGLACTIVESHADERPROGRAMPROC>("glActiveShaderProgram", Null_glActiveShaderProgram, Lazy_glActiveShaderProgram)),
+		CreateShaderProgramv(GetProc<PFNGLCREATESHADERPROGRAMVPROC>("glCreateShaderProgramv", Null_glCreateShaderProgramv, Lazy_glCreateShaderProgramv)),
+		BindProgramPipeline(GetProc<PFNGLBINDPROGRAMPIPELINEPROC>("glBindProgramPipeline", Null_glBindProgramPipeline, Lazy_glBindProgramPipeline)),
+		DeleteProgramPipelines(GetProc<PFNGLDELETEPROGRAMPIPELINESPROC>("glDeleteProgramPipelines", Null_glDeleteProgramPipelines, Lazy_glDeleteProgramPipelines)),
+		GenProgramPipelines(GetProc<PFNGLGENPROGRAMPIPELINESPROC>("glGenProgramPipelines", Null_glGenProgramPipelines, Lazy_glGenProgramPipelines)),
+		IsProgramPipeline(GetProc<PFNGLISPROGRAMPIPELINEPROC>("glIsProgramPipeline", Null_glIsProgramPipeline, Lazy_glIsProgramPipeline)),
+		GetProgramPipelineiv(GetProc<PFNGLGETPROGRAMPIPELINEIVPROC>("glGetProgramPipelineiv", Null_glGetProgramPipelineiv, Lazy_glGetProgramPipelineiv)),
+		ProgramUniform1i(GetProc<PFNGLPROGRAMUNIFORM1IPROC>("glProgramUniform1i", Null_glProgramUniform1i, Lazy_glProgramUniform1i)),
+		ProgramUniform1iv(GetProc<PFNGLPROGRAMUNIFORM1IVPROC>("glProgramUniform1iv", Null_glProgramUniform1iv, Lazy_glProgramUniform1iv)),
+		ProgramUniform1f(GetProc<PFNGLPROGRAMUNIFORM1FPROC>("glProgramUniform1f", Null_glProgramUniform1f, Lazy_glProgramUniform1f)),
+		ProgramUniform1fv(GetProc<PFNGLPROGRAMUNIFORM1FVPROC>("glProgramUniform1fv", Null_glProgramUniform1fv, Lazy_glProgramUniform1fv)),
+		ProgramUniform1d(GetProc<PFNGLPROGRAMUNIFORM1DPROC>("glProgramUniform1d", Null_glProgramUniform1d, Lazy_glProgramUniform1d)),
+		ProgramUniform1dv(GetProc<PFNGLPROGRAMUNIFORM1DVPROC>("glProgramUniform1dv", Null_glProgramUniform1dv, Lazy_glProgramUniform1dv)),
+		ProgramUniform1ui(GetProc<PFNGLPROGRAMUNIFORM1UIPROC>("glProgramUniform1ui", Null_glProgramUniform1ui, Lazy_glProgramUniform1ui)),
+		ProgramUniform1uiv(GetProc<PFNGLPROGRAMUNIFORM1UIVPROC>("glProgramUniform1uiv", Null_glProgramUniform1uiv, Lazy_glProgramUniform1uiv)),
+		ProgramUniform2i(GetProc<PFNGLPROGRAMUNIFORM2IPROC>("glProgramUniform2i", Null_glProgramUniform2i, Lazy_glProgramUniform2i)),
+		ProgramUniform2iv(GetProc<PFNGLPROGRAMUNIFORM2IVPROC>("glProgramUniform2iv", Null_glProgramUniform2iv, Lazy_glProgramUniform2iv)),
+		ProgramUniform2f(GetProc<PFNGLPROGRAMUNIFORM2FPROC>("glProgramUniform2f", Null_glProgramUniform2f, Lazy_glProgramUniform2f)),
+		ProgramUniform2fv(GetProc<PFNGLPROGRAMUNIFORM2FVPROC>("glProgramUniform2fv", Null_glProgramUniform2fv, Lazy_glProgramUniform2fv)),
+		ProgramUniform2d(GetProc<PFNGLPROGRAMUNIFORM2DPROC>("glProgramUniform2d", Null_glProgramUniform2d, Lazy_glProgramUniform2d)),
+		ProgramUniform2dv(GetProc<PFNGLPROGRAMUNIFORM2DVPROC>("glProgramUniform2dv", Null_glProgramUniform2dv, Lazy_glProgramUniform2dv)),
+		ProgramUniform2ui(GetProc<PFNGLPROGRAMUNIFORM2UIPROC>("glProgramUniform2ui", Null_glProgramUniform2ui, Lazy_glProgramUniform2ui)),
+		ProgramUniform2uiv(GetProc<PFNGLPROGRAMUNIFORM2UIVPROC>("glProgramUniform2uiv", Null_glProgramUniform2uiv, Lazy_glProgramUniform2uiv)),
+		ProgramUniform3i(GetProc<PFNGLPROGRAMUNIFORM3IPROC>("glProgramUniform3i", Null_glProgramUniform3i, Lazy_glProgramUniform3i)),
+		ProgramUniform3iv(GetProc<PFNGLPROGRAMUNIFORM3IVPROC>("glProgramUniform3iv", Null_glProgramUniform3iv, Lazy_glProgramUniform3iv)),
+		ProgramUniform3f(GetProc<PFNGLPROGRAMUNIFORM3FPROC>("glProgramUniform3f", Null_glProgramUniform3f, Lazy_glProgramUniform3f)),
+		ProgramUniform3fv(GetProc<PFNGLPROGRAMUNIFORM3FVPROC>("glProgramUniform3fv", Null_glProgramUniform3fv, Lazy_glProgramUniform3fv)),
+		ProgramUniform3d(GetProc<PFNGLPROGRAMUNIFORM3DPROC>("glProgramUniform3d", Null_glProgramUniform3d, Lazy_glProgramUniform3d)),
+		ProgramUniform3dv(GetProc<PFNGLPROGRAMUNIFORM3DVPROC>("glProgramUniform3dv", Null_glProgramUniform3dv, Lazy_glProgramUniform3dv)),
+		ProgramUniform3ui(GetProc<PFNGLPROGRAMUNIFORM3UIPROC>("glProgramUniform3ui", Null_glProgramUniform3ui, Lazy_glProgramUniform3ui)),
+		ProgramUniform3uiv(GetProc<PFNGLPROGRAMUNIFORM3UIVPROC>("glProgramUniform3uiv", Null_glProgramUniform3uiv, Lazy_glProgramUniform3uiv)),
+		ProgramUniform4i(GetProc<PFNGLPROGRAMUNIFORM4IPROC>("glProgramUniform4i", Null_glProgramUniform4i, Lazy_glProgramUniform4i)),
+		ProgramUniform4iv(GetProc<PFNGLPROGRAMUNIFORM4IVPROC>("glProgramUniform4iv", Null_glProgramUniform4iv, Lazy_glProgramUniform4iv)),
+		ProgramUniform4f(GetProc<PFNGLPROGRAMUNIFORM4FPROC>("glProgramUniform4f", Null_glProgramUniform4f, Lazy_glProgramUniform4f)),
+		ProgramUniform4fv(GetProc<PFNGLPROGRAMUNIFORM4FVPROC>("glProgramUniform4fv", Null_glProgramUniform4fv, Lazy_glProgramUniform4fv)),
+		ProgramUniform4d(GetProc<PFNGLPROGRAMUNIFORM4DPROC>("glProgramUniform4d", Null_glProgramUniform4d, Lazy_glProgramUniform4d)),
+		ProgramUniform4dv(GetProc<PFNGLPROGRAMUNIFORM4DVPROC>("glProgramUniform4dv", Null_glProgramUniform4dv, Lazy_glProgramUniform4dv)),
+		ProgramUniform4ui(GetProc<PFNGLPROGRAMUNIFORM4UIPROC>("glProgramUniform4ui", Null_glProgramUniform4ui, Lazy_glProgramUniform4ui)),
+		ProgramUniform4uiv(GetProc<PFNGLPROGRAMUNIFORM4UIVPROC>("glProgramUniform4uiv", Null_glProgramUniform4uiv, Lazy_glProgramUniform4uiv)),
+		ProgramUniformMatrix2fv(GetProc<PFNGLPROGRAMUNIFORMMATRIX2FVPROC>("glProgramUniformMatrix2fv", Null_glProgramUniformMatrix2fv, Lazy_glProgramUniformMatrix2fv)),
+		ProgramUniformMatrix3fv(GetProc<PFNGLPROGRAMUNIFORMMATRIX3FVPROC>("glProgramUniformMatrix3fv", Null_glProgramUniformMatrix3fv, Lazy_glProgramUniformMatrix3fv)),
+		ProgramUniformMatrix4fv(GetProc<PFNGLPROGRAMUNIFORMMATRIX4FVPROC>("glProgramUniformMatrix4fv", Null_glProgramUniformMatrix4fv, Lazy_glProgramUniformMatrix4fv)),
+		ProgramUniformMatrix2dv(GetProc<PFNGLPROGRAMUNIFORMMATRIX2DVPROC>("glProgramUniformMatrix2dv", Null_glProgramUniformMatrix2dv, Lazy_glProgramUniformMatrix2dv)),
+		ProgramUniformMatrix3dv(GetProc<PFNGLPROGRAMUNIFORMMATRIX3DVPROC>("glProgramUniformMatrix3dv", Null_glProgramUniformMatrix3dv, Lazy_glProgramUniformMatrix3dv)),
+		ProgramUniformMatrix4dv(GetProc<PFNGLPROGRAMUNIFORMMATRIX4DVPROC>("glProgramUniformMatrix4dv", Null_glProgramUniformMatrix4dv, Lazy_glProgramUniformMatrix4dv)),
+		ProgramUniformMatrix2x3fv(GetProc<PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC>("glProgramUniformMatrix2x3fv", Null_glProgramUniformMatrix2x3fv, Lazy_glProgramUniformMatrix2x3fv)),
+		ProgramUniformMatrix3x2fv(GetProc<PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC>("glProgramUniformMatrix3x2fv", Null_glProgramUniformMatrix3x2fv, Lazy_glProgramUniformMatrix3x2fv)),
+		ProgramUniformMatrix2x4fv(GetProc<PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC>("glProgramUniformMatrix2x4fv", Null_glProgramUniformMatrix2x4fv, Lazy_glProgramUniformMatrix2x4fv)),
+		ProgramUniformMatrix4x2fv(GetProc<PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC>("glProgramUniformMatrix4x2fv", Null_glProgramUniformMatrix4x2fv, Lazy_glProgramUniformMatrix4x2fv)),
+		ProgramUniformMatrix3x4fv(GetProc<PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC>("glProgramUniformMatrix3x4fv", Null_glProgramUniformMatrix3x4fv, Lazy_glProgramUniformMatrix3x4fv)),
+		ProgramUniformMatrix4x3fv(GetProc<PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC>("glProgramUniformMatrix4x3fv", Null_glProgramUniformMatrix4x3fv, Lazy_glProgramUniformMatrix4x3fv)),
+		ProgramUniformMatrix2x3dv(GetProc<PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC>("glProgramUniformMatrix2x3dv", Null_glProgramUniformMatrix2x3dv, Lazy_glProgramUniformMatrix2x3dv)),
+		ProgramUniformMatrix3x2dv(GetProc<PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC>("glProgramUniformMatrix3x2dv", Null_glProgramUniformMatrix3x2dv, Lazy_glProgramUniformMatrix3x2dv)),
+		ProgramUniformMatrix2x4dv(GetProc<PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC>("glProgramUniformMatrix2x4dv", Null_glProgramUniformMatrix2x4dv, Lazy_glProgramUniformMatrix2x4dv)),
+		ProgramUniformMatrix4x2dv(GetProc<PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC>("glProgramUniformMatrix4x2dv", Null_glProgramUniformMatrix4x2dv, Lazy_glProgramUniformMatrix4x2dv)),
+		ProgramUniformMatrix3x4dv(GetProc<PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC>("glProgramUniformMatrix3x4dv", Null_glProgramUniformMatrix3x4dv, Lazy_glProgramUniformMatrix3x4dv)),
+		ProgramUniformMatrix4x3dv(GetProc<PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC>("glProgramUniformMatrix4x3dv", Null_glProgramUniformMatrix4x3dv, Lazy_glProgramUniformMatrix4x3dv)),
+		ValidateProgramPipeline(GetProc<PFNGLVALIDATEPROGRAMPIPELINEPROC>("glValidateProgramPipeline", Null_glValidateProgramPipeline, Lazy_glValidateProgramPipeline)),
+		GetProgramPipelineInfoLog(GetProc<PFNGLGETPROGRAMPIPELINEINFOLOGPROC>("glGetProgramPipelineInfoLog", Null_glGetProgramPipelineInfoLog, Lazy_glGetProgramPipelineInfoLog)),
+		VertexAttribL1d(GetProc<PFNGLVERTEXATTRIBL1DPROC>("glVertexAttribL1d", Null_glVertexAttribL1d, Lazy_glVertexAttribL1d)),
+		VertexAttribL2d(GetProc<PFNGLVERTEXATTRIBL2DPROC>("glVertexAttribL2d", Null_glVertexAttribL2d, Lazy_glVertexAttribL2d)),
+		VertexAttribL3d(GetProc<PFNGLVERTEXATTRIBL3DPROC>("glVertexAttribL3d", Null_glVertexAttribL3d, Lazy_glVertexAttribL3d)),
+		VertexAttribL4d(GetProc<PFNGLVERTEXATTRIBL4DPROC>("glVertexAttribL4d", Null_glVertexAttribL4d, Lazy_glVertexAttribL4d)),
+		VertexAttribL1dv(GetProc<PFNGLVERTEXATTRIBL1DVPROC>("glVertexAttribL1dv", Null_glVertexAttribL1dv, Lazy_glVertexAttribL1dv)),
+		VertexAttribL2dv(GetProc<PFNGLVERTEXATTRIBL2DVPROC>("glVertexAttribL2dv", Null_glVertexAttribL2dv, Lazy_glVertexAttribL2dv)),
+		VertexAttribL3dv(GetProc<PFNGLVERTEXATTRIBL3DVPROC>("glVertexAttribL3dv", Null_glVertexAttribL3dv, Lazy_glVertexAttribL3dv)),
+		VertexAttribL4dv(GetProc<PFNGLVERTEXATTRIBL4DVPROC>("glVertexAttribL4dv", Null_glVertexAttribL4dv, Lazy_glVertexAttribL4dv)),
+		VertexAttribLPointer(GetProc<PFNGLVERTEXATTRIBLPOINTERPROC>("glVertexAttribLPointer", Null_glVertexAttribLPointer, Lazy_glVertexAttribLPointer)),
+		GetVertexAttribLdv(GetProc<PFNGLGETVERTEXATTRIBLDVPROC>("glGetVertexAttribLdv", Null_glGetVertexAttribLdv, Lazy_glGetVertexAttribLdv)),
+		ViewportArrayv(GetProc<PFNGLVIEWPORTARRAYVPROC>("glViewportArrayv", Null_glViewportArrayv, Lazy_glViewportArrayv)),
+		ViewportIndexedf(GetProc<PFNGLVIEWPORTINDEXEDFPROC>("glViewportIndexedf", Null_glViewportIndexedf, Lazy_glViewportIndexedf)),
+		ViewportIndexedfv(GetProc<PFNGLVIEWPORTINDEXEDFVPROC>("glViewportIndexedfv", Null_glViewportIndexedfv, Lazy_glViewportIndexedfv)),
+		ScissorArrayv(GetProc<PFNGLSCISSORARRAYVPROC>("glScissorArrayv", Null_glScissorArrayv, Lazy_glScissorArrayv)),
+		ScissorIndexed(GetProc<PFNGLSCISSORINDEXEDPROC>("glScissorIndexed", Null_glScissorIndexed, Lazy_glScissorIndexed)),
+		ScissorIndexedv(GetProc<PFNGLSCISSORINDEXEDVPROC>("glScissorIndexedv", Null_glScissorIndexedv, Lazy_glScissorIndexedv)),
+		DepthRangeArrayv(GetProc<PFNGLDEPTHRANGEARRAYVPROC>("glDepthRangeArrayv", Null_glDepthRangeArrayv, Lazy_glDepthRangeArrayv)),
+		DepthRangeIndexed(GetProc<PFNGLDEPTHRANGEINDEXEDPROC>("glDepthRangeIndexed", Null_glDepthRangeIndexed, Lazy_glDepthRangeIndexed)),
+		GetFloati_v(GetProc<PFNGLGETFLOATI_VPROC>("glGetFloati_v", Null_glGetFloati_v, Lazy_glGetFloati_v)),
+		GetDoublei_v(GetProc<PFNGLGETDOUBLEI_VPROC>("glGetDoublei_v", Null_glGetDoublei_v, Lazy_glGetDoublei_v))
 	{
 		Available = Ver_Major > 4 || (Ver_Major == 4 && (Ver_Minor > 1 || (Ver_Minor == 1 && Ver_Release >= 0)));
 	}
 
+	Version41::Version41(Func_GetProcAddress GetProcAddress):
+		Version41(GetProcAddress, LoadMode::Eager)
+	{
+	}
+
 
 	static void APIENTRY Null_glDrawArraysInstancedBaseInstance (GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance){ NullFuncPtr(); }
 	static void APIENTRY Null_glDrawElementsInstancedBaseInstance (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount, GLuint baseinstance){ NullFuncPtr(); }
@@ -1374,24 +2637,53 @@ namespace GL
 	static void APIENTRY Null_glTexStorage3D (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth){ NullFuncPtr(); }
 	static void APIENTRY Null_glDrawTransformFeedbackInstanced (GLenum mode, GLuint id, GLsizei instancecount){ NullFuncPtr(); }
 	static void APIENTRY Null_glDrawTransformFeedbackStreamInstanced (GLenum mode, GLuint id, GLuint stream, GLsizei instancecount){ NullFuncPtr(); }
-	Version42::Version42(Func_GetProcAddress GetProcAddress):
-		Version41(GetProcAddress),
-		DrawArraysInstancedBaseInstance(GetProc<PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC>("glDrawArraysInstancedBaseInstance", Null_glDrawArraysInstancedBaseInstance)),
-		DrawElementsInstancedBaseInstance(GetProc<PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC>("glDrawElementsInstancedBaseInstance", Null_glDrawElementsInstancedBaseInstance)),
-		DrawElementsInstancedBaseVertexBaseInstance(GetProc<PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC>("glDrawElementsInstancedBaseVertexBaseInstance", Null_glDrawElementsInstancedBaseVertexBaseInstance)),
-		GetInternalformativ(GetProc<PFNGLGETINTERNALFORMATIVPROC>("glGetInternalformativ", Null_glGetInternalformativ)),
-		GetActiveAtomicCounterBufferiv(GetProc<PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC>("glGetActiveAtomicCounterBufferiv", Null_glGetActiveAtomicCounterBufferiv)),
-		BindImageTexture(GetProc<PFNGLBINDIMAGETEXTUREPROC>("glBindImageTexture", Null_glBindImageTexture)),
-		MemoryBarrier(GetProc<PFNGLMEMORYBARRIERPROC>("glMemoryBarrier", Null_glMemoryBarrier)),
-		TexStorage1D(GetProc<PFNGLTEXSTORAGE1DPROC>("glTexStorage1D", Null_glTexStorage1D)),
-		TexStorage2D(GetProc<PFNGLTEXSTORAGE2DPROC>("glTexStorage2D", Null_glTexStorage2D)),
-		TexStorage3D(GetProc<PFNGLTEXSTORAGE3DPROC>("glTexStorage3D", Null_glTexStorage3D)),
-		DrawTransformFeedbackInstanced(GetProc<PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC>("glDrawTransformFeedbackInstanced", Null_glDrawTransformFeedbackInstanced)),
-		DrawTransformFeedbackStreamInstanced(GetProc<PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC>("glDrawTransformFeedbackStreamInstanced", Null_glDrawTransformFeedbackStreamInstanced))
+	static void Resolve_glDrawArraysInstancedBaseInstance(Version46& c){ c.DrawArraysInstancedBaseInstance = c.GetProc<decltype(c.DrawArraysInstancedBaseInstance)>("glDrawArraysInstancedBaseInstance", Null_glDrawArraysInstancedBaseInstance); }
+	static void Resolve_glDrawElementsInstancedBaseInstance(Version46& c){ c.DrawElementsInstancedBaseInstance = c.GetProc<decltype(c.DrawElementsInstancedBaseInstance)>("glDrawElementsInstancedBaseInstance", Null_glDrawElementsInstancedBaseInstance); }
+	static void Resolve_glDrawElementsInstancedBaseVertexBaseInstance(Version46& c){ c.DrawElementsInstancedBaseVertexBaseInstance = c.GetProc<decltype(c.DrawElementsInstancedBaseVertexBaseInstance)>("glDrawElementsInstancedBaseVertexBaseInstance", Null_glDrawElementsInstancedBaseVertexBaseInstance); }
+	static void Resolve_glGetInternalformativ(Version46& c){ c.GetInternalformativ = c.GetProc<decltype(c.GetInternalformativ)>("glGetInternalformativ", Null_glGetInternalformativ); }
+	static void Resolve_glGetActiveAtomicCounterBufferiv(Version46& c){ c.GetActiveAtomicCounterBufferiv = c.GetProc<decltype(c.GetActiveAtomicCounterBufferiv)>("glGetActiveAtomicCounterBufferiv", Null_glGetActiveAtomicCounterBufferiv); }
+	static void Resolve_glBindImageTexture(Version46& c){ c.BindImageTexture = c.GetProc<decltype(c.BindImageTexture)>("glBindImageTexture", Null_glBindImageTexture); }
+	static void Resolve_glMemoryBarrier(Version46& c){ c.MemoryBarrier = c.GetProc<decltype(c.MemoryBarrier)>("glMemoryBarrier", Null_glMemoryBarrier); }
+	static void Resolve_glTexStorage1D(Version46& c){ c.TexStorage1D = c.GetProc<decltype(c.TexStorage1D)>("glTexStorage1D", Null_glTexStorage1D); }
+	static void Resolve_glTexStorage2D(Version46& c){ c.TexStorage2D = c.GetProc<decltype(c.TexStorage2D)>("glTexStorage2D", Null_glTexStorage2D); }
+	static void Resolve_glTexStorage3D(Version46& c){ c.TexStorage3D = c.GetProc<decltype(c.TexStorage3D)>("glTexStorage3D", Null_glTexStorage3D); }
+	static void Resolve_glDrawTransformFeedbackInstanced(Version46& c){ c.DrawTransformFeedbackInstanced = c.GetProc<decltype(c.DrawTransformFeedbackInstanced)>("glDrawTransformFeedbackInstanced", Null_glDrawTransformFeedbackInstanced); }
+	static void Resolve_glDrawTransformFeedbackStreamInstanced(Version46& c){ c.DrawTransformFeedbackStreamInstanced = c.GetProc<decltype(c.DrawTransformFeedbackStreamInstanced)>("glDrawTransformFeedbackStreamInstanced", Null_glDrawTransformFeedbackStreamInstanced); }
+	static void APIENTRY Lazy_glDrawArraysInstancedBaseInstance (GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance){ auto& c = ResolveLazy(Resolve_glDrawArraysInstancedBaseInstance, [](const Version46& c){ return c.DrawArraysInstancedBaseInstance == Lazy_glDrawArraysInstancedBaseInstance; }); return c.DrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance); }
+	static void APIENTRY Lazy_glDrawElementsInstancedBaseInstance (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount, GLuint baseinstance){ auto& c = ResolveLazy(Resolve_glDrawElementsInstancedBaseInstance, [](const Version46& c){ return c.DrawElementsInstancedBaseInstance == Lazy_glDrawElementsInstancedBaseInstance; }); return c.DrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance); }
+	static void APIENTRY Lazy_glDrawElementsInstancedBaseVertexBaseInstance (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance){ auto& c = ResolveLazy(Resolve_glDrawElementsInstancedBaseVertexBaseInstance, [](const Version46& c){ return c.DrawElementsInstancedBaseVertexBaseInstance == Lazy_glDrawElementsInstancedBaseVertexBaseInstance; }); return c.DrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance); }
+	static void APIENTRY Lazy_glGetInternalformativ (GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint* params){ auto& c = ResolveLazy(Resolve_glGetInternalformativ, [](const Version46& c){ return c.GetInternalformativ == Lazy_glGetInternalformativ; }); return c.GetInternalformativ(target, internalformat, pname, count, params); }
+	static void APIENTRY Lazy_glGetActiveAtomicCounterBufferiv (GLuint program, GLuint bufferIndex, GLenum pname, GLint* params){ auto& c = ResolveLazy(Resolve_glGetActiveAtomicCounterBufferiv, [](const Version46& c){ return c.GetActiveAtomicCounterBufferiv == Lazy_glGetActiveAtomicCounterBufferiv; }); return c.GetActiveAtomicCounterBufferiv(program, bufferIndex, pname, params); }
+	static void APIENTRY Lazy_glBindImageTexture (GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format){ auto& c = ResolveLazy(Resolve_glBindImageTexture, [](const Version46& c){ return c.BindImageTexture == Lazy_glBindImageTexture; }); return c.BindImageTexture(unit, texture, level, layered, layer, access, format); }
+	static void APIENTRY Lazy_glMemoryBarrier (GLbitfield barriers){ auto& c = ResolveLazy(Resolve_glMemoryBarrier, [](const Version46& c){ return c.MemoryBarrier == Lazy_glMemoryBarrier; }); return c.MemoryBarrier(barriers); }
+	static void APIENTRY Lazy_glTexStorage1D (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width){ auto& c = ResolveLazy(Resolve_glTexStorage1D, [](const Version46& c){ return c.TexStorage1D == Lazy_glTexStorage1D; }); return c.TexStorage1D(target, levels, internalformat, width); }
+	static void APIENTRY Lazy_glTexStorage2D (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height){ auto& c = ResolveLazy(Resolve_glTexStorage2D, [](const Version46& c){ return c.TexStorage2D == Lazy_glTexStorage2D; }); return c.TexStorage2D(target, levels, internalformat, width, height); }
+	static void APIENTRY Lazy_glTexStorage3D (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth){ auto& c = ResolveLazy(Resolve_glTexStorage3D, [](const Version46& c){ return c.TexStorage3D == Lazy_glTexStorage3D; }); return c.TexStorage3D(target, levels, internalformat, width, height, depth); }
+	static void APIENTRY Lazy_glDrawTransformFeedbackInstanced (GLenum mode, GLuint id, GLsizei instancecount){ auto& c = ResolveLazy(Resolve_glDrawTransformFeedbackInstanced, [](const Version46& c){ return c.DrawTransformFeedbackInstanced == Lazy_glDrawTransformFeedbackInstanced; }); return c.DrawTransformFeedbackInstanced(mode, id, instancecount); }
+	static void APIENTRY Lazy_glDrawTransformFeedbackStreamInstanced (GLenum mode, GLuint id, GLuint stream, GLsizei instancecount){ auto& c = ResolveLazy(Resolve_glDrawTransformFeedbackStreamInstanced, [](const Version46& c){ return c.DrawTransformFeedbackStreamInstanced == Lazy_glDrawTransformFeedbackStreamInstanced; }); return c.DrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount); }
+	Version42::Version42(Func_GetProcAddress GetProcAddress, LoadMode Mode):
+		Version41(GetProcAddress, Mode),
+		DrawArraysInstancedBaseInstance(GetProc<PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC>("glDrawArraysInstancedBaseInstance", Null_glDrawArraysInstancedBaseInstance, Lazy_glDrawArraysInstancedBaseInstance)),
+		DrawElementsInstancedBaseInstance(GetProc<PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC>("glDrawElementsInstancedBaseInstance", Null_glDrawElementsInstancedBaseInstance, Lazy_glDrawElementsInstancedBaseInstance)),
+		DrawElementsInstancedBaseVertexBaseInstance(GetProc<PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC>("glDrawElementsInstancedBaseVertexBaseInstance", Null_glDrawElementsInstancedBaseVertexBaseInstance, Lazy_glDrawElementsInstancedBaseVertexBaseInstance)),
+		GetInternalformativ(GetProc<PFNGLGETINTERNALFORMATIVPROC>("glGetInternalformativ", Null_glGetInternalformativ, Lazy_glGetInternalformativ)),
+		GetActiveAtomicCounterBufferiv(GetProc<PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC>("glGetActiveAtomicCounterBufferiv", Null_glGetActiveAtomicCounterBufferiv, Lazy_glGetActiveAtomicCounterBufferiv)),
+		BindImageTexture(GetProc<PFNGLBINDIMAGETEXTUREPROC>("glBindImageTexture", Null_glBindImageTexture, Lazy_glBindImageTexture)),
+		MemoryBarrier(GetProc<PFNGLMEMORYBARRIERPROC>("glMemoryBarrier", Null_glMemoryBarrier, Lazy_glMemoryBarrier)),
+		TexStorage1D(GetProc<PFNGLTEXSTORAGE1DPROC>("glTexStorage1D", Null_glTexStorage1D, Lazy_glTexStorage1D)),
+		TexStorage2D(GetProc<PFNGLTEXSTORAGE2DPROC>("glTexStorage2D", Null_glTexStorage2D, Lazy_glTexStorage2D)),
+		TexStorage3D(GetProc<PFNGLTEXSTORAGE3DPROC>("glTexStorage3D", Null_glTexStorage3D, Lazy_glTexStorage3D)),
+		DrawTransformFeedbackInstanced(GetProc<PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC>("glDrawTransformFeedbackInstanced", Null_glDrawTransformFeedbackInstanced, Lazy_glDrawTransformFeedbackInstanced)),
+		DrawTransformFeedbackStreamInstanced(GetProc<PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC>("glDrawTransformFeedbackStreamInstanced", Null_glDrawTransformFeedbackStreamInstanced, Lazy_glDrawTransformFeedbackStreamInstanced))
 	{
 		Available = Ver_Major > 4 || (Ver_Major == 4 && (Ver_Minor > 2 || (Ver_Minor == 2 && Ver_Release >= 0)));
 	}
 
+	Version42::Version42(Func_GetProcAddress GetProcAddress):
+		Version42(GetProcAddress, LoadMode::Eager)
+	{
+	}
+
 
 	static void APIENTRY Null_glClearBufferData (GLenum target, GLenum internalformat, GLenum format, GLenum type, const void* data){ NullFuncPtr(); }
 	static void APIENTRY Null_glClearBufferSubData (GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void* data){ NullFuncPtr(); }
@@ -1436,55 +2728,146 @@ namespace GL
 	static void APIENTRY Null_glGetObjectLabel (GLenum identifier, GLuint name, GLsizei bufSize, GLsizei* length, GLchar* label){ NullFuncPtr(); }
 	static void APIENTRY Null_glObjectPtrLabel (const void* ptr, GLsizei length, const GLchar* label){ NullFuncPtr(); }
 	static void APIENTRY Null_glGetObjectPtrLabel (const void* ptr, GLsizei bufSize, GLsizei* length, GLchar* label){ NullFuncPtr(); }
-	Version43::Version43(Func_GetProcAddress GetProcAddress):
-		Version42(GetProcAddress),
-		ClearBufferData(GetProc<PFNGLCLEARBUFFERDATAPROC>("glClearBufferData", Null_glClearBufferData)),
-		ClearBufferSubData(GetProc<PFNGLCLEARBUFFERSUBDATAPROC>("glClearBufferSubData", Null_glClearBufferSubData)),
-		DispatchCompute(GetProc<PFNGLDISPATCHCOMPUTEPROC>("glDispatchCompute", Null_glDispatchCompute)),
-		DispatchComputeIndirect(GetProc<PFNGLDISPATCHCOMPUTEINDIRECTPROC>("glDispatchComputeIndirect", Null_glDispatchComputeIndirect)),
-		CopyImageSubData(GetProc<PFNGLCOPYIMAGESUBDATAPROC>("glCopyImageSubData", Null_glCopyImageSubData)),
-		FramebufferParameteri(GetProc<PFNGLFRAMEBUFFERPARAMETERIPROC>("glFramebufferParameteri", Null_glFramebufferParameteri)),
-		GetFramebufferParameteriv(GetProc<PFNGLGETFRAMEBUFFERPARAMETERIVPROC>("glGetFramebufferParameteriv", Null_glGetFramebufferParameteriv)),
-		GetInternalformati64v(GetProc<PFNGLGETINTERNALFORMATI64VPROC>("glGetInternalformati64v", Null_glGetInternalformati64v)),
-		InvalidateTexSubImage(GetProc<PFNGLINVALIDATETEXSUBIMAGEPROC>("glInvalidateTexSubImage", Null_glInvalidateTexSubImage)),
-		InvalidateTexImage(GetProc<PFNGLINVALIDATETEXIMAGEPROC>("glInvalidateTexImage", Null_glInvalidateTexImage)),
-		InvalidateBufferSubData(GetProc<PFNGLINVALIDATEBUFFERSUBDATAPROC>("glInvalidateBufferSubData", Null_glInvalidateBufferSubData)),
-		InvalidateBufferData(GetProc<PFNGLINVALIDATEBUFFERDATAPROC>("glInvalidateBufferData", Null_glInvalidateBufferData)),
-		InvalidateFramebuffer(GetProc<PFNGLINVALIDATEFRAMEBUFFERPROC>("glInvalidateFramebuffer", Null_glInvalidateFramebuffer)),
-		InvalidateSubFramebuffer(GetProc<PFNGLINVALIDATESUBFRAMEBUFFERPROC>("glInvalidateSubFramebuffer", Null_glInvalidateSubFramebuffer)),
-		MultiDrawArraysIndirect(GetProc<PFNGLMULTIDRAWARRAYSINDIRECTPROC>("glMultiDrawArraysIndirect", Null_glMultiDrawArraysIndirect)),
-		MultiDrawElementsIndirect(GetProc<PFNGLMULTIDRAWELEMENTSINDIRECTPROC>("glMultiDrawElementsIndirect", Null_glMultiDrawElementsIndirect)),
-		GetProgramInterfaceiv(GetProc<PFNGLGETPROGRAMINTERFACEIVPROC>("glGetProgramInterfaceiv", Null_glGetProgramInterfaceiv)),
-		GetProgramResourceIndex(GetProc<PFNGLGETPROGRAMRESOURCEINDEXPROC>("glGetProgramResourceIndex", Null_glGetProgramResourceIndex)),
-		GetProgramResourceName(GetProc<PFNGLGETPROGRAMRESOURCENAMEPROC>("glGetProgramResourceName", Null_glGetProgramResourceName)),
-		GetProgramResourceiv(GetProc<PFNGLGETPROGRAMRESOURCEIVPROC>("glGetProgramResourceiv", Null_glGetProgramResourceiv)),
-		GetProgramResourceLocation(GetProc<PFNGLGETPROGRAMRESOURCELOCATIONPROC>("glGetProgramResourceLocation", Null_glGetProgramResourceLocation)),
-		GetProgramResourceLocationIndex(GetProc<PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC>("glGetProgramResourceLocationIndex", Null_glGetProgramResourceLocationIndex)),
-		ShaderStorageBlockBinding(GetProc<PFNGLSHADERSTORAGEBLOCKBINDINGPROC>("glShaderStorageBlockBinding", Null_glShaderStorageBlockBinding)),
-		TexBufferRange(GetProc<PFNGLTEXBUFFERRANGEPROC>("glTexBufferRange", Null_glTexBufferRange)),
-		TexStorage2DMultisample(GetProc<PFNGLTEXSTORAGE2DMULTISAMPLEPROC>("glTexStorage2DMultisample", Null_glTexStorage2DMultisample)),
-		TexStorage3DMultisample(GetProc<PFNGLTEXSTORAGE3DMULTISAMPLEPROC>("glTexStorage3DMultisample", Null_glTexStorage3DMultisample)),
-		TextureView(GetProc<PFNGLTEXTUREVIEWPROC>("glTextureView", Null_glTextureView)),
-		BindVertexBuffer(GetProc<PFNGLBINDVERTEXBUFFERPROC>("glBindVertexBuffer", Null_glBindVertexBuffer)),
-		VertexAttribFormat(GetProc<PFNGLVERTEXATTRIBFORMATPROC>("glVertexAttribFormat", Null_glVertexAttribFormat)),
-		VertexAttribIFormat(GetProc<PFNGLVERTEXATTRIBIFORMATPROC>("glVertexAttribIFormat", Null_glVertexAttribIFormat)),
-		VertexAttribLFormat(GetProc<PFNGLVERTEXATTRIBLFORMATPROC>("glVertexAttribLFormat", Null_glVertexAttribLFormat)),
-		VertexAttribBinding(GetProc<PFNGLVERTEXATTRIBBINDINGPROC>("glVertexAttribBinding", Null_glVertexAttribBinding)),
-		VertexBindingDivisor(GetProc<PFNGLVERTEXBINDINGDIVISORPROC>("glVertexBindingDivisor", Null_glVertexBindingDivisor)),
-		DebugMessageControl(GetProc<PFNGLDEBUGMESSAGECONTROLPROC>("glDebugMessageControl", Null_glDebugMessageControl)),
-		DebugMessageInsert(GetProc<PFNGLDEBUGMESSAGEINSERTPROC>("glDebugMessageInsert", Null_glDebugMessageInsert)),
-		DebugMessageCallback(GetProc<PFNGLDEBUGMESSAGECALLBACKPROC>("glDebugMessageCallback", Null_glDebugMessageCallback)),
-		GetDebugMessageLog(GetProc<PFNGLGETDEBUGMESSAGELOGPROC>("glGetDebugMessageLog", Null_glGetDebugMessageLog)),
-		PushDebugGroup(GetProc<PFNGLPUSHDEBUGGROUPPROC>("glPushDebugGroup", Null_glPushDebugGroup)),
-		PopDebugGroup(GetProc<PFNGLPOPDEBUGGROUPPROC>("glPopDebugGroup", Null_glPopDebugGroup)),
-		ObjectLabel(GetProc<PFNGLOBJECTLABELPROC>("glObjectLabel", Null_glObjectLabel)),
-		GetObjectLabel(GetProc<PFNGLGETOBJECTLABELPROC>("glGetObjectLabel", Null_glGetObjectLabel)),
-		ObjectPtrLabel(GetProc<PFNGLOBJECTPTRLABELPROC>("glObjectPtrLabel", Null_glObjectPtrLabel)),
-		GetObjectPtrLabel(GetProc<PFNGLGETOBJECTPTRLABELPROC>("glGetObjectPtrLabel", Null_glGetObjectPtrLabel))
+	static void Resolve_glClearBufferData(Version46& c){ c.ClearBufferData = c.GetProc<decltype(c.ClearBufferData)>("glClearBufferData", Null_glClearBufferData); }
+	static void Resolve_glClearBufferSubData(Version46& c){ c.ClearBufferSubData = c.GetProc<decltype(c.ClearBufferSubData)>("glClearBufferSubData", Null_glClearBufferSubData); }
+	static void Resolve_glDispatchCompute(Version46& c){ c.DispatchCompute = c.GetProc<decltype(c.DispatchCompute)>("glDispatchCompute", Null_glDispatchCompute); }
+	static void Resolve_glDispatchComputeIndirect(Version46& c){ c.DispatchComputeIndirect = c.GetProc<decltype(c.DispatchComputeIndirect)>("glDispatchComputeIndirect", Null_glDispatchComputeIndirect); }
+	static void Resolve_glCopyImageSubData(Version46& c){ c.CopyImageSubData = c.GetProc<decltype(c.CopyImageSubData)>("glCopyImageSubData", Null_glCopyImageSubData); }
+	static void Resolve_glFramebufferParameteri(Version46& c){ c.FramebufferParameteri = c.GetProc<decltype(c.FramebufferParameteri)>("glFramebufferParameteri", Null_glFramebufferParameteri); }
+	static void Resolve_glGetFramebufferParameteriv(Version46& c){ c.GetFramebufferParameteriv = c.GetProc<decltype(c.GetFramebufferParameteriv)>("glGetFramebufferParameteriv", Null_glGetFramebufferParameteriv); }
+	static void Resolve_glGetInternalformati64v(Version46& c){ c.GetInternalformati64v = c.GetProc<decltype(c.GetInternalformati64v)>("glGetInternalformati64v", Null_glGetInternalformati64v); }
+	static void Resolve_glInvalidateTexSubImage(Version46& c){ c.InvalidateTexSubImage = c.GetProc<decltype(c.InvalidateTexSubImage)>("glInvalidateTexSubImage", Null_glInvalidateTexSubImage); }
+	static void Resolve_glInvalidateTexImage(Version46& c){ c.InvalidateTexImage = c.GetProc<decltype(c.InvalidateTexImage)>("glInvalidateTexImage", Null_glInvalidateTexImage); }
+	static void Resolve_glInvalidateBufferSubData(Version46& c){ c.InvalidateBufferSubData = c.GetProc<decltype(c.InvalidateBufferSubData)>("glInvalidateBufferSubData", Null_glInvalidateBufferSubData); }
+	static void Resolve_glInvalidateBufferData(Version46& c){ c.InvalidateBufferData = c.GetProc<decltype(c.InvalidateBufferData)>("glInvalidateBufferData", Null_glInvalidateBufferData); }
+	static void Resolve_glInvalidateFramebuffer(Version46& c){ c.InvalidateFramebuffer = c.GetProc<decltype(c.InvalidateFramebuffer)>("glInvalidateFramebuffer", Null_glInvalidateFramebuffer); }
+	static void Resolve_glInvalidateSubFramebuffer(Version46& c){ c.InvalidateSubFramebuffer = c.GetProc<decltype(c.InvalidateSubFramebuffer)>("glInvalidateSubFramebuffer", Null_glInvalidateSubFramebuffer); }
+	static void Resolve_glMultiDrawArraysIndirect(Version46& c){ c.MultiDrawArraysIndirect = c.GetProc<decltype(c.MultiDrawArraysIndirect)>("glMultiDrawArraysIndirect", Null_glMultiDrawArraysIndirect); }
+	static void Resolve_glMultiDrawElementsIndirect(Version46& c){ c.MultiDrawElementsIndirect = c.GetProc<decltype(c.MultiDrawElementsIndirect)>("glMultiDrawElementsIndirect", Null_glMultiDrawElementsIndirect); }
+	static void Resolve_glGetProgramInterfaceiv(Version46& c){ c.GetProgramInterfaceiv = c.GetProc<decltype(c.GetProgramInterfaceiv)>("glGetProgramInterfaceiv", Null_glGetProgramInterfaceiv); }
+	static void Resolve_glGetProgramResourceIndex(Version46& c){ c.GetProgramResourceIndex = c.GetProc<decltype(c.GetProgramResourceIndex)>("glGetProgramResourceIndex", Null_glGetProgramResourceIndex); }
+	static void Resolve_glGetProgramResourceName(Version46& c){ c.GetProgramResourceName = c.GetProc<decltype(c.GetProgramResourceName)>("glGetProgramResourceName", Null_glGetProgramResourceName); }
+	static void Resolve_glGetProgramResourceiv(Version46& c){ c.GetProgramResourceiv = c.GetProc<decltype(c.GetProgramResourceiv)>("glGetProgramResourceiv", Null_glGetProgramResourceiv); }
+	static void Resolve_glGetProgramResourceLocation(Version46& c){ c.GetProgramResourceLocation = c.GetProc<decltype(c.GetProgramResourceLocation)>("glGetProgramResourceLocation", Null_glGetProgramResourceLocation); }
+	static void Resolve_glGetProgramResourceLocationIndex(Version46& c){ c.GetProgramResourceLocationIndex = c.GetProc<decltype(c.GetProgramResourceLocationIndex)>("glGetProgramResourceLocationIndex", Null_glGetProgramResourceLocationIndex); }
+	static void Resolve_glShaderStorageBlockBinding(Version46& c){ c.ShaderStorageBlockBinding = c.GetProc<decltype(c.ShaderStorageBlockBinding)>("glShaderStorageBlockBinding", Null_glShaderStorageBlockBinding); }
+	static void Resolve_glTexBufferRange(Version46& c){ c.TexBufferRange = c.GetProc<decltype(c.TexBufferRange)>("glTexBufferRange", Null_glTexBufferRange); }
+	static void Resolve_glTexStorage2DMultisample(Version46& c){ c.TexStorage2DMultisample = c.GetProc<decltype(c.TexStorage2DMultisample)>("glTexStorage2DMultisample", Null_glTexStorage2DMultisample); }
+	static void Resolve_glTexStorage3DMultisample(Version46& c){ c.TexStorage3DMultisample = c.GetProc<decltype(c.TexStorage3DMultisample)>("glTexStorage3DMultisample", Null_glTexStorage3DMultisample); }
+	static void Resolve_glTextureView(Version46& c){ c.TextureView = c.GetProc<decltype(c.TextureView)>("glTextureView", Null_glTextureView); }
+	static void Resolve_glBindVertexBuffer(Version46& c){ c.BindVertexBuffer = c.GetProc<decltype(c.BindVertexBuffer)>("glBindVertexBuffer", Null_glBindVertexBuffer); }
+	static void Resolve_glVertexAttribFormat(Version46& c){ c.VertexAttribFormat = c.GetProc<decltype(c.VertexAttribFormat)>("glVertexAttribFormat", Null_glVertexAttribFormat); }
+	static void Resolve_glVertexAttribIFormat(Version46& c){ c.VertexAttribIFormat = c.GetProc<decltype(c.VertexAttribIFormat)>("glVertexAttribIFormat", Null_glVertexAttribIFormat); }
+	static void Resolve_glVertexAttribLFormat(Version46& c){ c.VertexAttribLFormat = c.GetProc<decltype(c.VertexAttribLFormat)>("glVertexAttribLFormat", Null_glVertexAttribLFormat); }
+	static void Resolve_glVertexAttribBinding(Version46& c){ c.VertexAttribBinding = c.GetProc<decltype(c.VertexAttribBinding)>("glVertexAttribBinding", Null_glVertexAttribBinding); }
+	static void Resolve_glVertexBindingDivisor(Version46& c){ c.VertexBindingDivisor = c.GetProc<decltype(c.VertexBindingDivisor)>("glVertexBindingDivisor", Null_glVertexBindingDivisor); }
+	static void Resolve_glDebugMessageControl(Version46& c){ c.DebugMessageControl = c.GetProc<decltype(c.DebugMessageControl)>("glDebugMessageControl", Null_glDebugMessageControl); }
+	static void Resolve_glDebugMessageInsert(Version46& c){ c.DebugMessageInsert = c.GetProc<decltype(c.DebugMessageInsert)>("glDebugMessageInsert", Null_glDebugMessageInsert); }
+	static void Resolve_glDebugMessageCallback(Version46& c){ c.DebugMessageCallback = c.GetProc<decltype(c.DebugMessageCallback)>("glDebugMessageCallback", Null_glDebugMessageCallback); }
+	static void Resolve_glGetDebugMessageLog(Version46& c){ c.GetDebugMessageLog = c.GetProc<decltype(c.GetDebugMessageLog)>("glGetDebugMessageLog", Null_glGetDebugMessageLog); }
+	static void Resolve_glPushDebugGroup(Version46& c){ c.PushDebugGroup = c.GetProc<decltype(c.PushDebugGroup)>("glPushDebugGroup", Null_glPushDebugGroup); }
+	static void Resolve_glPopDebugGroup(Version46& c){ c.PopDebugGroup = c.GetProc<decltype(c.PopDebugGroup)>("glPopDebugGroup", Null_glPopDebugGroup); }
+	static void Resolve_glObjectLabel(Version46& c){ c.ObjectLabel = c.GetProc<decltype(c.ObjectLabel)>("glObjectLabel", Null_glObjectLabel); }
+	static void Resolve_glGetObjectLabel(Version46& c){ c.GetObjectLabel = c.GetProc<decltype(c.GetObjectLabel)>("glGetObjectLabel", Null_glGetObjectLabel); }
+	static void Resolve_glObjectPtrLabel(Version46& c){ c.ObjectPtrLabel = c.GetProc<decltype(c.ObjectPtrLabel)>("glObjectPtrLabel", Null_glObjectPtrLabel); }
+	static void Resolve_glGetObjectPtrLabel(Version46& c){ c.GetObjectPtrLabel = c.GetProc<decltype(c.GetObjectPtrLabel)>("glGetObjectPtrLabel", Null_glGetObjectPtrLabel); }
+	static void APIENTRY Lazy_glClearBufferData (GLenum target, GLenum internalformat, GLenum format, GLenum type, const void* data){ auto& c = ResolveLazy(Resolve_glClearBufferData, [](const Version46& c){ return c.ClearBufferData == Lazy_glClearBufferData; }); return c.ClearBufferData(target, internalformat, format, type, data); }
+	static void APIENTRY Lazy_glClearBufferSubData (GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void* data){ auto& c = ResolveLazy(Resolve_glClearBufferSubData, [](const Version46& c){ return c.ClearBufferSubData == Lazy_glClearBufferSubData; }); return c.ClearBufferSubData(target, internalformat, offset, size, format, type, data); }
+	static void APIENTRY Lazy_glDispatchCompute (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z){ auto& c = ResolveLazy(Resolve_glDispatchCompute, [](const Version46& c){ return c.DispatchCompute == Lazy_glDispatchCompute; }); return c.DispatchCompute(num_groups_x, num_groups_y, num_groups_z); }
+	static void APIENTRY Lazy_glDispatchComputeIndirect (GLintptr indirect){ auto& c = ResolveLazy(Resolve_glDispatchComputeIndirect, [](const Version46& c){ return c.DispatchComputeIndirect == Lazy_glDispatchComputeIndirect; }); return c.DispatchComputeIndirect(indirect); }
+	static void APIENTRY Lazy_glCopyImageSubData (GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth){ auto& c = ResolveLazy(Resolve_glCopyImageSubData, [](const Version46& c){ return c.CopyImageSubData == Lazy_glCopyImageSubData; }); return c.CopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth); }
+	static void APIENTRY Lazy_glFramebufferParameteri (GLenum target, GLenum pname, GLint param){ auto& c = ResolveLazy(Resolve_glFramebufferParameteri, [](const Version46& c){ return c.FramebufferParameteri == Lazy_glFramebufferParameteri; }); return c.FramebufferParameteri(target, pname, param); }
+	static void APIENTRY Lazy_glGetFramebufferParameteriv (GLenum target, GLenum pname, GLint* params){ auto& c = ResolveLazy(Resolve_glGetFramebufferParameteriv, [](const Version46& c){ return c.GetFramebufferParameteriv == Lazy_glGetFramebufferParameteriv; }); return c.GetFramebufferParameteriv(target, pname, params); }
+	static void APIENTRY Lazy_glGetInternalformati64v (GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint64* params){ auto& c = ResolveLazy(Resolve_glGetInternalformati64v, [](const Version46& c){ return c.GetInternalformati64v == Lazy_glGetInternalformati64v; }); return c.GetInternalformati64v(target, internalformat, pname, count, params); }
+	static void APIENTRY Lazy_glInvalidateTexSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth){ auto& c = ResolveLazy(Resolve_glInvalidateTexSubImage, [](const Version46& c){ return c.InvalidateTexSubImage == Lazy_glInvalidateTexSubImage; }); return c.InvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth); }
+	static void APIENTRY Lazy_glInvalidateTexImage (GLuint texture, GLint level){ auto& c = ResolveLazy(Resolve_glInvalidateTexImage, [](const Version46& c){ return c.InvalidateTexImage == Lazy_glInvalidateTexImage; }); return c.InvalidateTexImage(texture, level); }
+	static void APIENTRY Lazy_glInvalidateBufferSubData (GLuint buffer, GLintptr offset, GLsizeiptr length){ auto& c = ResolveLazy(Resolve_glInvalidateBufferSubData, [](const Version46& c){ return c.InvalidateBufferSubData == Lazy_glInvalidateBufferSubData; }); return c.InvalidateBufferSubData(buffer, offset, length); }
+	static void APIENTRY Lazy_glInvalidateBufferData (GLuint buffer){ auto& c = ResolveLazy(Resolve_glInvalidateBufferData, [](const Version46& c){ return c.InvalidateBufferData == Lazy_glInvalidateBufferData; }); return c.InvalidateBufferData(buffer); }
+	static void APIENTRY Lazy_glInvalidateFramebuffer (GLenum target, GLsizei numAttachments, const GLenum* attachments){ auto& c = ResolveLazy(Resolve_glInvalidateFramebuffer, [](const Version46& c){ return c.InvalidateFramebuffer == Lazy_glInvalidateFramebuffer; }); return c.InvalidateFramebuffer(target, numAttachments, attachments); }
+	static void APIENTRY Lazy_glInvalidateSubFramebuffer (GLenum target, GLsizei numAttachments, const GLenum* attachments, GLint x, GLint y, GLsizei width, GLsizei height){ auto& c = ResolveLazy(Resolve_glInvalidateSubFramebuffer, [](const Version46& c){ return c.InvalidateSubFramebuffer == Lazy_glInvalidateSubFramebuffer; }); return c.InvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height); }
+	static void APIENTRY Lazy_glMultiDrawArraysIndirect (GLenum mode, const void* indirect, GLsizei drawcount, GLsizei stride){ auto& c = ResolveLazy(Resolve_glMultiDrawArraysIndirect, [](const Version46& c){ return c.MultiDrawArraysIndirect == Lazy_glMultiDrawArraysIndirect; }); return c.MultiDrawArraysIndirect(mode, indirect, drawcount, stride); }
+	static void APIENTRY Lazy_glMultiDrawElementsIndirect (GLenum mode, GLenum type, const void* indirect, GLsizei drawcount, GLsizei stride){ auto& c = ResolveLazy(Resolve_glMultiDrawElementsIndirect, [](const Version46& c){ return c.MultiDrawElementsIndirect == Lazy_glMultiDrawElementsIndirect; }); return c.MultiDrawElementsIndirect(mode, type, indirect, drawcount, stride); }
+	static void APIENTRY Lazy_glGetProgramInterfaceiv (GLuint program, GLenum programInterface, GLenum pname, GLint* params){ auto& c = ResolveLazy(Resolve_glGetProgramInterfaceiv, [](const Version46& c){ return c.GetProgramInterfaceiv == Lazy_glGetProgramInterfaceiv; }); return c.GetProgramInterfaceiv(program, programInterface, pname, params); }
+	static GLuint APIENTRY Lazy_glGetProgramResourceIndex (GLuint program, GLenum programInterface, const GLchar* name){ auto& c = ResolveLazy(Resolve_glGetProgramResourceIndex, [](const Version46& c){ return c.GetProgramResourceIndex == Lazy_glGetProgramResourceIndex; }); return c.GetProgramResourceIndex(program, programInterface, name); }
+	static void APIENTRY Lazy_glGetProgramResourceName (GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei* length, GLchar* name){ auto& c = ResolveLazy(Resolve_glGetProgramResourceName, [](const Version46& c){ return c.GetProgramResourceName == Lazy_glGetProgramResourceName; }); return c.GetProgramResourceName(program, programInterface, index, bufSize, length, name); }
+	static void APIENTRY Lazy_glGetProgramResourceiv (GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum* props, GLsizei count, GLsizei* length, GLint* params){ auto& c = ResolveLazy(Resolve_glGetProgramResourceiv, [](const Version46& c){ return c.GetProgramResourceiv == Lazy_glGetProgramResourceiv; }); return c.GetProgramResourceiv(program, programInterface, index, propCount, props, count, length, params); }
+	static GLint APIENTRY Lazy_glGetProgramResourceLocation (GLuint program, GLenum programInterface, const GLchar* name){ auto& c = ResolveLazy(Resolve_glGetProgramResourceLocation, [](const Version46& c){ return c.GetProgramResourceLocation == Lazy_glGetProgramResourceLocation; }); return c.GetProgramResourceLocation(program, programInterface, name); }
+	static GLint APIENTRY Lazy_glGetProgramResourceLocationIndex (GLuint program, GLenum programInterface, const GLchar* name){ auto& c = ResolveLazy(Resolve_glGetProgramResourceLocationIndex, [](const Version46& c){ return c.GetProgramResourceLocationIndex == Lazy_glGetProgramResourceLocationIndex; }); return c.GetProgramResourceLocationIndex(program, programInterface, name); }
+	static void APIENTRY Lazy_glShaderStorageBlockBinding (GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding){ auto& c = ResolveLazy(Resolve_glShaderStorageBlockBinding, [](const Version46& c){ return c.ShaderStorageBlockBinding == Lazy_glShaderStorageBlockBinding; }); return c.ShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding); }
+	static void APIENTRY Lazy_glTexBufferRange (GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size){ auto& c = ResolveLazy(Resolve_glTexBufferRange, [](const Version46& c){ return c.TexBufferRange == Lazy_glTexBufferRange; }); return c.TexBufferRange(target, internalformat, buffer, offset, size); }
+	static void APIENTRY Lazy_glTexStorage2DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations){ auto& c = ResolveLazy(Resolve_glTexStorage2DMultisample, [](const Version46& c){ return c.TexStorage2DMultisample == Lazy_glTexStorage2DMultisample; }); return c.TexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations); }
+	static void APIENTRY Lazy_glTexStorage3DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations){ auto& c = ResolveLazy(Resolve_glTexStorage3DMultisample, [](const Version46& c){ return c.TexStorage3DMultisample == Lazy_glTexStorage3DMultisample; }); return c.TexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations); }
+	static void APIENTRY Lazy_glTextureView (GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers){ auto& c = ResolveLazy(Resolve_glTextureView, [](const Version46& c){ return c.TextureView == Lazy_glTextureView; }); return c.TextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers); }
+	static void APIENTRY Lazy_glBindVertexBuffer (GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride){ auto& c = ResolveLazy(Resolve_glBindVertexBuffer, [](const Version46& c){ return c.BindVertexBuffer == Lazy_glBindVertexBuffer; }); return c.BindVertexBuffer(bindingindex, buffer, offset, stride); }
+	static void APIENTRY Lazy_glVertexAttribFormat (GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset){ auto& c = ResolveLazy(Resolve_glVertexAttribFormat, [](const Version46& c){ return c.VertexAttribFormat == Lazy_glVertexAttribFormat; }); return c.VertexAttribFormat(attribindex, size, type, normalized, relativeoffset); }
+	static void APIENTRY Lazy_glVertexAttribIFormat (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset){ auto& c = ResolveLazy(Resolve_glVertexAttribIFormat, [](const Version46& c){ return c.VertexAttribIFormat == Lazy_glVertexAttribIFormat; }); return c.VertexAttribIFormat(attribindex, size, type, relativeoffset); }
+	static void APIENTRY Lazy_glVertexAttribLFormat (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset){ auto& c = ResolveLazy(Resolve_glVertexAttribLFormat, [](const Version46& c){ return c.VertexAttribLFormat == Lazy_glVertexAttribLFormat; }); return c.VertexAttribLFormat(attribindex, size, type, relativeoffset); }
+	static void APIENTRY Lazy_glVertexAttribBinding (GLuint attribindex, GLuint bindingindex){ auto& c = ResolveLazy(Resolve_glVertexAttribBinding, [](const Version46& c){ return c.VertexAttribBinding == Lazy_glVertexAttribBinding; }); return c.VertexAttribBinding(attribindex, bindingindex); }
+	static void APIENTRY Lazy_glVertexBindingDivisor (GLuint bindingindex, GLuint divisor){ auto& c = ResolveLazy(Resolve_glVertexBindingDivisor, [](const Version46& c){ return c.VertexBindingDivisor == Lazy_glVertexBindingDivisor; }); return c.VertexBindingDivisor(bindingindex, divisor); }
+	static void APIENTRY Lazy_glDebugMessageControl (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint* ids, GLboolean enabled){ auto& c = ResolveLazy(Resolve_glDebugMessageControl, [](const Version46& c){ return c.DebugMessageControl == Lazy_glDebugMessageControl; }); return c.DebugMessageControl(source, type, severity, count, ids, enabled); }
+	static void APIENTRY Lazy_glDebugMessageInsert (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* buf){ auto& c = ResolveLazy(Resolve_glDebugMessageInsert, [](const Version46& c){ return c.DebugMessageInsert == Lazy_glDebugMessageInsert; }); return c.DebugMessageInsert(source, type, id, severity, length, buf); }
+	static void APIENTRY Lazy_glDebugMessageCallback (GLDEBUGPROC callback, const void* userParam){ auto& c = ResolveLazy(Resolve_glDebugMessageCallback, [](const Version46& c){ return c.DebugMessageCallback == Lazy_glDebugMessageCallback; }); return c.DebugMessageCallback(callback, userParam); }
+	static GLuint APIENTRY Lazy_glGetDebugMessageLog (GLuint count, GLsizei bufSize, GLenum* sources, GLenum* types, GLuint* ids, GLenum* severities, GLsizei* lengths, GLchar* messageLog){ auto& c = ResolveLazy(Resolve_glGetDebugMessageLog, [](const Version46& c){ return c.GetDebugMessageLog == Lazy_glGetDebugMessageLog; }); return c.GetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog); }
+	static void APIENTRY Lazy_glPushDebugGroup (GLenum source, GLuint id, GLsizei length, const GLchar* message){ auto& c = ResolveLazy(Resolve_glPushDebugGroup, [](const Version46& c){ return c.PushDebugGroup == Lazy_glPushDebugGroup; }); return c.PushDebugGroup(source, id, length, message); }
+	static void APIENTRY Lazy_glPopDebugGroup (void){ auto& c = ResolveLazy(Resolve_glPopDebugGroup, [](const Version46& c){ return c.PopDebugGroup == Lazy_glPopDebugGroup; }); return c.PopDebugGroup(); }
+	static void APIENTRY Lazy_glObjectLabel (GLenum identifier, GLuint name, GLsizei length, const GLchar* label){ auto& c = ResolveLazy(Resolve_glObjectLabel, [](const Version46& c){ return c.ObjectLabel == Lazy_glObjectLabel; }); return c.ObjectLabel(identifier, name, length, label); }
+	static void APIENTRY Lazy_glGetObjectLabel (GLenum identifier, GLuint name, GLsizei bufSize, GLsizei* length, GLchar* label){ auto& c = ResolveLazy(Resolve_glGetObjectLabel, [](const Version46& c){ return c.GetObjectLabel == Lazy_glGetObjectLabel; }); return c.GetObjectLabel(identifier, name, bufSize, length, label); }
+	static void APIENTRY Lazy_glObjectPtrLabel (const void* ptr, GLsizei length, const GLchar* label){ auto& c = ResolveLazy(Resolve_glObjectPtrLabel, [](const Version46& c){ return c.ObjectPtrLabel == Lazy_glObjectPtrLabel; }); return c.ObjectPtrLabel(ptr, length, label); }
+	static void APIENTRY Lazy_glGetObjectPtrLabel (const void* ptr, GLsizei bufSize, GLsizei* length, GLchar* label){ auto& c = ResolveLazy(Resolve_glGetObjectPtrLabel, [](const Version46& c){ return c.GetObjectPtrLabel == Lazy_glGetObjectPtrLabel; }); return c.GetObjectPtrLabel(ptr, bufSize, length, label); }
+	Version43::Version43(Func_GetProcAddress GetProcAddress, LoadMode Mode):
+		Version42(GetProcAddress, Mode),
+		ClearBufferData(GetProc<PFNGLCLEARBUFFERDATAPROC>("glClearBufferData", Null_glClearBufferData, Lazy_glClearBufferData)),
+		ClearBufferSubData(GetProc<PFNGLCLEARBUFFERSUBDATAPROC>("glClearBufferSubData", Null_glClearBufferSubData, Lazy_glClearBufferSubData)),
+		DispatchCompute(GetProc<PFNGLDISPATCHCOMPUTEPROC>("glDispatchCompute", Null_glDispatchCompute, Lazy_glDispatchCompute)),
+		DispatchComputeIndirect(GetProc<PFNGLDISPATCHCOMPUTEINDIRECTPROC>("glDispatchComputeIndirect", Null_glDispatchComputeIndirect, Lazy_glDispatchComputeIndirect)),
+		CopyImageSubData(GetProc<PFNGLCOPYIMAGESUBDATAPROC>("glCopyImageSubData", Null_glCopyImageSubData, Lazy_glCopyImageSubData)),
+		FramebufferParameteri(GetProc<PFNGLFRAMEBUFFERPARAMETERIPROC>("glFramebufferParameteri", Null_glFramebufferParameteri, Lazy_glFramebufferParameteri)),
+		GetFramebufferParameteriv(GetProc<PFNGLGETFRAMEBUFFERPARAMETERIVPROC>("glGetFramebufferParameteriv", Null_glGetFramebufferParameteriv, Lazy_glGetFramebufferParameteriv)),
+		GetInternalformati64v(GetProc<PFNGLGETINTERNALFORMATI64VPROC>("glGetInternalformati64v", Null_glGetInternalformati64v, Lazy_glGetInternalformati64v)),
+		InvalidateTexSubImage(GetProc<PFNGLINVALIDATETEXSUBIMAGEPROC>("glInvalidateTexSubImage", Null_glInvalidateTexSubImage, Lazy_glInvalidateTexSubImage)),
+		InvalidateTexImage(GetProc<PFNGLINVALIDATETEXIMAGEPROC>("glInvalidateTexImage", Null_glInvalidateTexImage, Lazy_glInvalidateTexImage)),
+		InvalidateBufferSubData(GetProc<PFNGLINVALIDATEBUFFERSUBDATAPROC>("glInvalidateBufferSubData", Null_glInvalidateBufferSubData, Lazy_glInvalidateBufferSubData)),
+		InvalidateBufferData(GetProc<PFNGLINVALIDATEBUFFERDATAPROC>("glInvalidateBufferData", Null_glInvalidateBufferData, Lazy_glInvalidateBufferData)),
+		InvalidateFramebuffer(GetProc<PFNGLINVALIDATEFRAMEBUFFERPROC>("glInvalidateFramebuffer", Null_glInvalidateFramebuffer, Lazy_glInvalidateFramebuffer)),
+		InvalidateSubFramebuffer(GetProc<PFNGLINVALIDATESUBFRAMEBUFFERPROC>("glInvalidateSubFramebuffer", Null_glInvalidateSubFramebuffer, Lazy_glInvalidateSubFramebuffer)),
+		MultiDrawArraysIndirect(GetProc<PFNGLMULTIDRAWARRAYSINDIRECTPROC>("glMultiDrawArraysIndirect", Null_glMultiDrawArraysIndirect, Lazy_glMultiDrawArraysIndirect)),
+		MultiDrawElementsIndirect(GetProc<PFNGLMULTIDRAWELEMENTSINDIRECTPROC>("glMultiDrawElementsIndirect", Null_glMultiDrawElementsIndirect, Lazy_glMultiDrawElementsIndirect)),
+		GetProgramInterfaceiv(GetProc<PFNGLGETPROGRAMINTERFACEIVPROC>("glGetProgramInterfaceiv", Null_glGetProgramInterfaceiv, Lazy_glGetProgramInterfaceiv)),
+		GetProgramResourceIndex(GetProc<PFNGLGETPROGRAMRESOURCEINDEXPROC>("glGetProgramResourceIndex", Null_glGetProgramResourceIndex, Lazy_glGetProgramResourceIndex)),
+		GetProgramResourceName(GetProc<PFNGLGETPROGRAMRESOURCENAMEPROC>("glGetProgramResourceName", Null_glGetProgramResourceName, Lazy_glGetProgramResourceName)),
+		GetProgramResourceiv(GetProc<PFNGLGETPROGRAMRESOURCEIVPROC>("glGetProgramResourceiv", Null_glGetProgramResourceiv, Lazy_glGetProgramResourceiv)),
+		GetProgramResourceLocation(GetProc<PFNGLGETPROGRAMRESOURCELOCATIONPROC>("glGetProgramResourceLocation", Null_glGetProgramResourceLocation, Lazy_glGetProgramResourceLocation)),
+		GetProgramResourceLocationIndex(GetProc<PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC>("glGetProgramResourceLocationIndex", Null_glGetProgramResourceLocationIndex, Lazy_glGetProgramResourceLocationIndex)),
+		ShaderStorageBlockBinding(GetProc<PFNGLSHADERSTORAGEBLOCKBINDINGPROC>("glShaderStorageBlockBinding", Null_glShaderStorageBlockBinding, Lazy_glShaderStorageBlockBinding)),
+		TexBufferRange(GetProc<PFNGLTEXBUFFERRANGEPROC>("glTexBufferRange", Null_glTexBufferRange, Lazy_glTexBufferRange)),
+		TexStorage2DMultisample(GetProc<PFNGLTEXSTORAGE2DMULTISAMPLEPROC>("glTexStorage2DMultisample", Null_glTexStorage2DMultisample, Lazy_glTexStorage2DMultisample)),
+		TexStorage3DMultisample(GetProc<PFNGLTEXSTORAGE3DMULTISAMPLEPROC>("glTexStorage3DMultisample", Null_glTexStorage3DMultisample, Lazy_glTexStorage3DMultisample)),
+		TextureView(GetProc<PFNGLTEXTUREVIEWPROC>("glTextureView", Null_glTextureView, Lazy_glTextureView)),
+		BindVertexBuffer(GetProc<PFNGLBINDVERTEXBUFFERPROC>("glBindVertexBuffer", Null_glBindVertexBuffer, Lazy_glBindVertexBuffer)),
+		VertexAttribFormat(GetProc<PFNGLVERTEXATTRIBFORMATPROC>("glVertexAttribFormat", Null_glVertexAttribFormat, Lazy_glVertexAttribFormat)),
+		VertexAttribIFormat(GetProc<PFNGLVERTEXATTRIBIFORMATPROC>("glVertexAttribIFormat", Null_glVertexAttribIFormat, Lazy_glVertexAttribIFormat)),
+		VertexAttribLFormat(GetProc<PFNGLVERTEXATTRIBLFORMATPROC>("glVertexAttribLFormat", Null_glVertexAttribLFormat, Lazy_glVertexAttribLFormat)),
+		VertexAttribBinding(GetProc<PFNGLVERTEXATTRIBBINDINGPROC>("glVertexAttribBinding", Null_glVertexAttribBinding, Lazy_glVertexAttribBinding)),
+		VertexBindingDivisor(GetProc<PFNGLVERTEXBINDINGDIVISORPROC>("glVertexBindingDivisor", Null_glVertexBindingDivisor, Lazy_glVertexBindingDivisor)),
+		DebugMessageControl(GetProc<PFNGLDEBUGMESSAGECONTROLPROC>("glDebugMessageControl", Null_glDebugMessageControl, Lazy_glDebugMessageControl)),
+		DebugMessageInsert(GetProc<PFNGLDEBUGMESSAGEINSERTPROC>("glDebugMessageInsert", Null_glDebugMessageInsert, Lazy_glDebugMessageInsert)),
+		DebugMessageCallback(GetProc<PFNGLDEBUGMESSAGECALLBACKPROC>("glDebugMessageCallback", Null_glDebugMessageCallback, Lazy_glDebugMessageCallback)),
+		GetDebugMessageLog(GetProc<PFNGLGETDEBUGMESSAGELOGPROC>("glGetDebugMessageLog", Null_glGetDebugMessageLog, Lazy_glGetDebugMessageLog)),
+		PushDebugGroup(GetProc<PFNGLPUSHDEBUGGROUPPROC>("glPushDebugGroup", Null_glPushDebugGroup, Lazy_glPushDebugGroup)),
+		PopDebugGroup(GetProc<PFNGLPOPDEBUGGROUPPROC>("glPopDebugGroup", Null_glPopDebugGroup, Lazy_glPopDebugGroup)),
+		ObjectLabel(GetProc<PFNGLOBJECTLABELPROC>("glObjectLabel", Null_glObjectLabel, Lazy_glObjectLabel)),
+		GetObjectLabel(GetProc<PFNGLGETOBJECTLABELPROC>("glGetObjectLabel", Null_glGetObjectLabel, Lazy_glGetObjectLabel)),
+		ObjectPtrLabel(GetProc<PFNGLOBJECTPTRLABELPROC>("glObjectPtrLabel", Null_glObjectPtrLabel, Lazy_glObjectPtrLabel)),
+		GetObjectPtrLabel(GetProc<PFNGLGETOBJECTPTRLABELPROC>("glGetObjectPtrLabel", Null_glGetObjectPtrLabel, Lazy_glGetObjectPtrLabel))
 	{
 		Available = Ver_Major > 4 || (Ver_Major == 4 && (Ver_Minor > 3 || (Ver_Minor == 3 && Ver_Release >= 0)));
 	}
 
+	Version43::Version43(Func_GetProcAddress GetProcAddress):
+		Version43(GetProcAddress, LoadMode::Eager)
+	{
+	}
+
 
 	static void APIENTRY Null_glBufferStorage (GLenum target, GLsizeiptr size, const void* data, GLbitfield flags){ NullFuncPtr(); }
 	static void APIENTRY Null_glClearTexImage (GLuint texture, GLint level, GLenum format, GLenum type, const void* data){ NullFuncPtr(); }
@@ -1495,21 +2878,44 @@ namespace GL
 	static void APIENTRY Null_glBindSamplers (GLuint first, GLsizei count, const GLuint* samplers){ NullFuncPtr(); }
 	static void APIENTRY Null_glBindImageTextures (GLuint first, GLsizei count, const GLuint* textures){ NullFuncPtr(); }
 	static void APIENTRY Null_glBindVertexBuffers (GLuint first, GLsizei count, const GLuint* buffers, const GLintptr* offsets, const GLsizei* strides){ NullFuncPtr(); }
-	Version44::Version44(Func_GetProcAddress GetProcAddress):
-		Version43(GetProcAddress),
-		BufferStorage(GetProc<PFNGLBUFFERSTORAGEPROC>("glBufferStorage", Null_glBufferStorage)),
-		ClearTexImage(GetProc<PFNGLCLEARTEXIMAGEPROC>("glClearTexImage", Null_glClearTexImage)),
-		ClearTexSubImage(GetProc<PFNGLCLEARTEXSUBIMAGEPROC>("glClearTexSubImage", Null_glClearTexSubImage)),
-		BindBuffersBase(GetProc<PFNGLBINDBUFFERSBASEPROC>("glBindBuffersBase", Null_glBindBuffersBase)),
-		BindBuffersRange(GetProc<PFNGLBINDBUFFERSRANGEPROC>("glBindBuffersRange", Null_glBindBuffersRange)),
-		BindTextures(GetProc<PFNGLBINDTEXTURESPROC>("glBindTextures", Null_glBindTextures)),
-		BindSamplers(GetProc<PFNGLBINDSAMPLERSPROC>("glBindSamplers", Null_glBindSamplers)),
-		BindImageTextures(GetProc<PFNGLBINDIMAGETEXTURESPROC>("glBindImageTextures", Null_glBindImageTextures)),
-		BindVertexBuffers(GetProc<PFNGLBINDVERTEXBUFFERSPROC>("glBindVertexBuffers", Null_glBindVertexBuffers))
+	static void Resolve_glBufferStorage(Version46& c){ c.BufferStorage = c.GetProc<decltype(c.BufferStorage)>("glBufferStorage", Null_glBufferStorage); }
+	static void Resolve_glClearTexImage(Version46& c){ c.ClearTexImage = c.GetProc<decltype(c.ClearTexImage)>("glClearTexImage", Null_glClearTexImage); }
+	static void Resolve_glClearTexSubImage(Version46& c){ c.ClearTexSubImage = c.GetProc<decltype(c.ClearTexSubImage)>("glClearTexSubImage", Null_glClearTexSubImage); }
+	static void Resolve_glBindBuffersBase(Version46& c){ c.BindBuffersBase = c.GetProc<decltype(c.BindBuffersBase)>("glBindBuffersBase", Null_glBindBuffersBase); }
+	static void Resolve_glBindBuffersRange(Version46& c){ c.BindBuffersRange = c.GetProc<decltype(c.BindBuffersRange)>("glBindBuffersRange", Null_glBindBuffersRange); }
+	static void Resolve_glBindTextures(Version46& c){ c.BindTextures = c.GetProc<decltype(c.BindTextures)>("glBindTextures", Null_glBindTextures); }
+	static void Resolve_glBindSamplers(Version46& c){ c.BindSamplers = c.GetProc<decltype(c.BindSamplers)>("glBindSamplers", Null_glBindSamplers); }
+	static void Resolve_glBindImageTextures(Version46& c){ c.BindImageTextures = c.GetProc<decltype(c.BindImageTextures)>("glBindImageTextures", Null_glBindImageTextures); }
+	static void Resolve_glBindVertexBuffers(Version46& c){ c.BindVertexBuffers = c.GetProc<decltype(c.BindVertexBuffers)>("glBindVertexBuffers", Null_glBindVertexBuffers); }
+	static void APIENTRY Lazy_glBufferStorage (GLenum target, GLsizeiptr size, const void* data, GLbitfield flags){ auto& c = ResolveLazy(Resolve_glBufferStorage, [](const Version46& c){ return c.BufferStorage == Lazy_glBufferStorage; }); return c.BufferStorage(target, size, data, flags); }
+	static void APIENTRY Lazy_glClearTexImage (GLuint texture, GLint level, GLenum format, GLenum type, const void* data){ auto& c = ResolveLazy(Resolve_glClearTexImage, [](const Version46& c){ return c.ClearTexImage == Lazy_glClearTexImage; }); return c.ClearTexImage(texture, level, format, type, data); }
+	static void APIENTRY Lazy_glClearTexSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void* data){ auto& c = ResolveLazy(Resolve_glClearTexSubImage, [](const Version46& c){ return c.ClearTexSubImage == Lazy_glClearTexSubImage; }); return c.ClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data); }
+	static void APIENTRY Lazy_glBindBuffersBase (GLenum target, GLuint first, GLsizei count, const GLuint* buffers){ auto& c = ResolveLazy(Resolve_glBindBuffersBase, [](const Version46& c){ return c.BindBuffersBase == Lazy_glBindBuffersBase; }); return c.BindBuffersBase(target, first, count, buffers); }
+	static void APIENTRY Lazy_glBindBuffersRange (GLenum target, GLuint first, GLsizei count, const GLuint* buffers, const GLintptr* offsets, const GLsizeiptr* sizes){ auto& c = ResolveLazy(Resolve_glBindBuffersRange, [](const Version46& c){ return c.BindBuffersRange == Lazy_glBindBuffersRange; }); return c.BindBuffersRange(target, first, count, buffers, offsets, sizes); }
+	static void APIENTRY Lazy_glBindTextures (GLuint first, GLsizei count, const GLuint* textures){ auto& c = ResolveLazy(Resolve_glBindTextures, [](const Version46& c){ return c.BindTextures == Lazy_glBindTextures; }); return c.BindTextures(first, count, textures); }
+	static void APIENTRY Lazy_glBindSamplers (GLuint first, GLsizei count, const GLuint* samplers){ auto& c = ResolveLazy(Resolve_glBindSamplers, [](const Version46& c){ return c.BindSamplers == Lazy_glBindSamplers; }); return c.BindSamplers(first, count, samplers); }
+	static void APIENTRY Lazy_glBindImageTextures (GLuint first, GLsizei count, const GLuint* textures){ auto& c = ResolveLazy(Resolve_glBindImageTextures, [](const Version46& c){ return c.BindImageTextures == Lazy_glBindImageTextures; }); return c.BindImageTextures(first, count, textures); }
+	static void APIENTRY Lazy_glBindVertexBuffers (GLuint first, GLsizei count, const GLuint* buffers, const GLintptr* offsets, const GLsizei* strides){ auto& c = ResolveLazy(Resolve_glBindVertexBuffers, [](const Version46& c){ return c.BindVertexBuffers == Lazy_glBindVertexBuffers; }); return c.BindVertexBuffers(first, count, buffers, offsets, strides); }
+	Version44::Version44(Func_GetProcAddress GetProcAddress, LoadMode Mode):
+		Version43(GetProcAddress, Mode),
+		BufferStorage(GetProc<PFNGLBUFFERSTORAGEPROC>("glBufferStorage", Null_glBufferStorage, Lazy_glBufferStorage)),
+		ClearTexImage(GetProc<PFNGLCLEARTEXIMAGEPROC>("glClearTexImage", Null_glClearTexImage, Lazy_glClearTexImage)),
+		ClearTexSubImage(GetProc<PFNGLCLEARTEXSUBIMAGEPROC>("glClearTexSubImage", Null_glClearTexSubImage, Lazy_glClearTexSubImage)),
+		BindBuffersBase(GetProc<PFNGLBINDBUFFERSBASEPROC>("glBindBuffersBase", Null_glBindBuffersBase, Lazy_glBindBuffersBase)),
+		BindBuffersRange(GetProc<PFNGLBINDBUFFERSRANGEPROC>("glBindBuffersRange", Null_glBindBuffersRange, Lazy_glBindBuffersRange)),
+		BindTextures(GetProc<PFNGLBINDTEXTURESPROC>("glBindTextures", Null_glBindTextures, Lazy_glBindTextures)),
+		BindSamplers(GetProc<PFNGLBINDSAMPLERSPROC>("glBindSamplers", Null_glBindSamplers, Lazy_glBindSamplers)),
+		BindImageTextures(GetProc<PFNGLBINDIMAGETEXTURESPROC>("glBindImageTextures", Null_glBindImageTextures, Lazy_glBindImageTextures)),
+		BindVertexBuffers(GetProc<PFNGLBINDVERTEXBUFFERSPROC>("glBindVertexBuffers", Null_glBindVertexBuffers, Lazy_glBindVertexBuffers))
 	{
 		Available = Ver_Major > 4 || (Ver_Major == 4 && (Ver_Minor > 4 || (Ver_Minor == 4 && Ver_Release >= 0)));
 	}
 
+	Version44::Version44(Func_GetProcAddress GetProcAddress):
+		Version44(GetProcAddress, LoadMode::Eager)
+	{
+	}
+
 
 	static void APIENTRY Null_glClipControl (GLenum origin, GLenum depth){ NullFuncPtr(); }
 	static void APIENTRY Null_glCreateTransformFeedbacks (GLsizei n, GLuint* ids){ NullFuncPtr(); }
@@ -1633,147 +3039,1336 @@ namespace GL
 	static void APIENTRY Null_glGetnHistogram (GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void* values){ NullFuncPtr(); }
 	static void APIENTRY Null_glGetnMinmax (GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void* values){ NullFuncPtr(); }
 	static void APIENTRY Null_glTextureBarrier (void){ NullFuncPtr(); }
-	Version45::Version45(Func_GetProcAddress GetProcAddress):
-		Version44(GetProcAddress),
-		ClipControl(GetProc<PFNGLCLIPCONTROLPROC>("glClipControl", Null_glClipControl)),
-		CreateTransformFeedbacks(GetProc<PFNGLCREATETRANSFORMFEEDBACKSPROC>("glCreateTransformFeedbacks", Null_glCreateTransformFeedbacks)),
-		TransformFeedbackBufferBase(GetProc<PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC>("glTransformFeedbackBufferBase", Null_glTransformFeedbackBufferBase)),
-		TransformFeedbackBufferRange(GetProc<PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC>("glTransformFeedbackBufferRange", Null_glTransformFeedbackBufferRange)),
-		GetTransformFeedbackiv(GetProc<PFNGLGETTRANSFORMFEEDBACKIVPROC>("glGetTransformFeedbackiv", Null_glGetTransformFeedbackiv)),
-		GetTransformFeedbacki_v(GetProc<PFNGLGETTRANSFORMFEEDBACKI_VPROC>("glGetTransformFeedbacki_v", Null_glGetTransformFeedbacki_v)),
-		GetTransformFeedbacki64_v(GetProc<PFNGLGETTRANSFORMFEEDBACKI64_VPROC>("glGetTransformFeedbacki64_v", Null_glGetTransformFeedbacki64_v)),
-		CreateBuffers(GetProc<PFNGLCREATEBUFFERSPROC>("glCreateBuffers", Null_glCreateBuffers)),
-		NamedBufferStorage(GetProc<PFNGLNAMEDBUFFERSTORAGEPROC>("glNamedBufferStorage", Null_glNamedBufferStorage)),
-		NamedBufferData(GetProc<PFNGLNAMEDBUFFERDATAPROC>("glNamedBufferData", Null_glNamedBufferData)),
-		NamedBufferSubData(GetProc<PFNGLNAMEDBUFFERSUBDATAPROC>("glNamedBufferSubData", Null_glNamedBufferSubData)),
-		CopyNamedBufferSubData(GetProc<PFNGLCOPYNAMEDBUFFERSUBDATAPROC>("glCopyNamedBufferSubData", Null_glCopyNamedBufferSubData)),
-		ClearNamedBufferData(GetProc<PFNGLCLEARNAMEDBUFFERDATAPROC>("glClearNamedBufferData", Null_glClearNamedBufferData)),
-		ClearNamedBufferSubData(GetProc<PFNGLCLEARNAMEDBUFFERSUBDATAPROC>("glClearNamedBufferSubData", Null_glClearNamedBufferSubData)),
-		MapNamedBuffer(GetProc<PFNGLMAPNAMEDBUFFERPROC>("glMapNamedBuffer", Null_glMapNamedBuffer)),
-		MapNamedBufferRange(GetProc<PFNGLMAPNAMEDBUFFERRANGEPROC>("glMapNamedBufferRange", Null_glMapNamedBufferRange)),
-		UnmapNamedBuffer(GetProc<PFNGLUNMAPNAMEDBUFFERPROC>("glUnmapNamedBuffer", Null_glUnmapNamedBuffer)),
-		FlushMappedNamedBufferRange(GetProc<PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC>("glFlushMappedNamedBufferRange", Null_glFlushMappedNamedBufferRange)),
-		GetNamedBufferParameteriv(GetProc<PFNGLGETNAMEDBUFFERPARAMETERIVPROC>("glGetNamedBufferParameteriv", Null_glGetNamedBufferParameteriv)),
-		GetNamedBufferParameteri64v(GetProc<PFNGLGETNAMEDBUFFERPARAMETERI64VPROC>("glGetNamedBufferParameteri64v", Null_glGetNamedBufferParameteri64v)),
-		GetNamedBufferPointerv(GetProc<PFNGLGETNAMEDBUFFERPOINTERVPROC>("glGetNamedBufferPointerv", Null_glGetNamedBufferPointerv)),
-		GetNamedBufferSubData(GetProc<PFNGLGETNAMEDBUFFERSUBDATAPROC>("glGetNamedBufferSubData", Null_glGetNamedBufferSubData)),
-		CreateFramebuffers(GetProc<PFNGLCREATEFRAMEBUFFERSPROC>("glCreateFramebuffers", Null_glCreateFramebuffers)),
-		NamedFramebufferRenderbuffer(GetProc<PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC>("glNamedFramebufferRenderbuffer", Null_glNamedFramebufferRenderbuffer)),
-		NamedFramebufferParameteri(GetProc<PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC>("glNamedFramebufferParameteri", Null_glNamedFramebufferParameteri)),
-		NamedFramebufferTexture(GetProc<PFNGLNAMEDFRAMEBUFFERTEXTUREPROC>("glNamedFramebufferTexture", Null_glNamedFramebufferTexture)),
-		NamedFramebufferTextureLayer(GetProc<PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC>("glNamedFramebufferTextureLayer", Null_glNamedFramebufferTextureLayer)),
-		NamedFramebufferDrawBuffer(GetProc<PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC>("glNamedFramebufferDrawBuffer", Null_glNamedFramebufferDrawBuffer)),
-		NamedFramebufferDrawBuffers(GetProc<PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC>("glNamedFramebufferDrawBuffers", Null_glNamedFramebufferDrawBuffers)),
-		NamedFramebufferReadBuffer(GetProc<PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC>("glNamedFramebufferReadBuffer", Null_glNamedFramebufferReadBuffer)),
-		InvalidateNamedFramebufferData(GetProc<PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC>("glInvalidateNamedFramebufferData", Null_glInvalidateNamedFramebufferData)),
-		InvalidateNamedFramebufferSubData(GetProc<PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC>("glInvalidateNamedFramebufferSubData", Null_glInvalidateNamedFramebufferSubData)),
-		ClearNamedFramebufferiv(GetProc<PFNGLCLEARNAMEDFRAMEBUFFERIVPROC>("glClearNamedFramebufferiv", Null_glClearNamedFramebufferiv)),
-		ClearNamedFramebufferuiv(GetProc<PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC>("glClearNamedFramebufferuiv", Null_glClearNamedFramebufferuiv)),
-		ClearNamedFramebufferfv(GetProc<PFNGLCLEARNAMEDFRAMEBUFFERFVPROC>("glClearNamedFramebufferfv", Null_glClearNamedFramebufferfv)),
-		ClearNamedFramebufferfi(GetProc<PFNGLCLEARNAMEDFRAMEBUFFERFIPROC>("glClearNamedFramebufferfi", Null_glClearNamedFramebufferfi)),
-		BlitNamedFramebuffer(GetProc<PFNGLBLITNAMEDFRAMEBUFFERPROC>("glBlitNamedFramebuffer", Null_glBlitNamedFramebuffer)),
-		CheckNamedFramebufferStatus(GetProc<PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC>("glCheckNamedFramebufferStatus", Null_glCheckNamedFramebufferStatus)),
-		GetNamedFramebufferParameteriv(GetProc<PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC>("glGetNamedFramebufferParameteriv", Null_glGetNamedFramebufferParameteriv)),
-		GetNamedFramebufferAttachmentParameteriv(GetProc<PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC>("glGetNamedFramebufferAttachmentParameteriv", Null_glGetNamedFramebufferAttachmentParameteriv)),
-		CreateRenderbuffers(GetProc<PFNGLCREATERENDERBUFFERSPROC>("glCreateRenderbuffers", Null_glCreateRenderbuffers)),
-		NamedRenderbufferStorage(GetProc<PFNGLNAMEDRENDERBUFFERSTORAGEPROC>("glNamedRenderbufferStorage", Null_glNamedRenderbufferStorage)),
-		NamedRenderbufferStorageMultisample(GetProc<PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC>("glNamedRenderbufferStorageMultisample", Null_glNamedRenderbufferStorageMultisample)),
-		GetNamedRenderbufferParameteriv(GetProc<PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC>("glGetNamedRenderbufferParameteriv", Null_glGetNamedRenderbufferParameteriv)),
-		CreateTextures(GetProc<PFNGLCREATETEXTURESPROC>("glCreateTextures", Null_glCreateTextures)),
-		TextureBuffer(GetProc<PFNGLTEXTUREBUFFERPROC>("glTextureBuffer", Null_glTextureBuffer)),
-		TextureBufferRange(GetProc<PFNGLTEXTUREBUFFERRANGEPROC>("glTextureBufferRange", Null_glTextureBufferRange)),
-		TextureStorage1D(GetProc<PFNGLTEXTURESTORAGE1DPROC>("glTextureStorage1D", Null_glTextureStorage1D)),
-		TextureStorage2D(GetProc<PFNGLTEXTURESTORAGE2DPROC>("glTextureStorage2D", Null_glTextureStorage2D)),
-		TextureStorage3D(GetProc<PFNGLTEXTURESTORAGE3DPROC>("glTextureStorage3D", Null_glTextureStorage3D)),
-		TextureStorage2DMultisample(GetProc<PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC>("glTextureStorage2DMultisample", Null_glTextureStorage2DMultisample)),
-		TextureStorage3DMultisample(GetProc<PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC>("glTextureStorage3DMultisample", Null_glTextureStorage3DMultisample)),
-		TextureSubImage1D(GetProc<PFNGLTEXTURESUBIMAGE1DPROC>("glTextureSubImage1D", Null_glTextureSubImage1D)),
-		TextureSubImage2D(GetProc<PFNGLTEXTURESUBIMAGE2DPROC>("glTextureSubImage2D", Null_glTextureSubImage2D)),
-		TextureSubImage3D(GetProc<PFNGLTEXTURESUBIMAGE3DPROC>("glTextureSubImage3D", Null_glTextureSubImage3D)),
-		CompressedTextureSubImage1D(GetProc<PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC>("glCompressedTextureSubImage1D", Null_glCompressedTextureSubImage1D)),
-		CompressedTextureSubImage2D(GetProc<PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC>("glCompressedTextureSubImage2D", Null_glCompressedTextureSubImage2D)),
-		CompressedTextureSubImage3D(GetProc<PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC>("glCompressedTextureSubImage3D", Null_glCompressedTextureSubImage3D)),
-		CopyTextureSubImage1D(GetProc<PFNGLCOPYTEXTURESUBIMAGE1DPROC>("glCopyTextureSubImage1D", Null_glCopyTextureSubImage1D)),
-		CopyTextureSubImage2D(GetProc<PFNGLCOPYTEXTURESUBIMAGE2DPROC>("glCopyTextureSubImage2D", Null_glCopyTextureSubImage2D)),
-		CopyTextureSubImage3D(GetProc<PFNGLCOPYTEXTURESUBIMAGE3DPROC>("glCopyTextureSubImage3D", Null_glCopyTextureSubImage3D)),
-		TextureParameterf(GetProc<PFNGLTEXTUREPARAMETERFPROC>("glTextureParameterf", Null_glTextureParameterf)),
-		TextureParameterfv(GetProc<PFNGLTEXTUREPARAMETERFVPROC>("glTextureParameterfv", Null_glTextureParameterfv)),
-		TextureParameteri(GetProc<PFNGLTEXTUREPARAMETERIPROC>("glTextureParameteri", Null_glTextureParameteri)),
-		TextureParameterIiv(GetProc<PFNGLTEXTUREPARAMETERIIVPROC>("glTextureParameterIiv", Null_glTextureParameterIiv)),
-		TextureParameterIuiv(GetProc<PFNGLTEXTUREPARAMETERIUIVPROC>("glTextureParameterIuiv", Null_glTextureParameterIuiv)),
-		TextureParameteriv(GetProc<PFNGLTEXTUREPARAMETERIVPROC>("glTextureParameteriv", Null_glTextureParameteriv)),
-		GenerateTextureMipmap(GetProc<PFNGLGENERATETEXTUREMIPMAPPROC>("glGenerateTextureMipmap", Null_glGenerateTextureMipmap)),
-		BindTextureUnit(GetProc<PFNGLBINDTEXTUREUNITPROC>("glBindTextureUnit", Null_glBindTextureUnit)),
-		GetTextureImage(GetProc<PFNGLGETTEXTUREIMAGEPROC>("glGetTextureImage", Null_glGetTextureImage)),
-		GetCompressedTextureImage(GetProc<PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC>("glGetCompressedTextureImage", Null_glGetCompressedTextureImage)),
-		GetTextureLevelParameterfv(GetProc<PFNGLGETTEXTURELEVELPARAMETERFVPROC>("glGetTextureLevelParameterfv", Null_glGetTextureLevelParameterfv)),
-		GetTextureLevelParameteriv(GetProc<PFNGLGETTEXTURELEVELPARAMETERIVPROC>("glGetTextureLevelParameteriv", Null_glGetTextureLevelParameteriv)),
-		GetTextureParameterfv(GetProc<PFNGLGETTEXTUREPARAMETERFVPROC>("glGetTextureParameterfv", Null_glGetTextureParameterfv)),
-		GetTextureParameterIiv(GetProc<PFNGLGETTEXTUREPARAMETERIIVPROC>("glGetTextureParameterIiv", Null_glGetTextureParameterIiv)),
-		GetTextureParameterIuiv(GetProc<PFNGLGETTEXTUREPARAMETERIUIVPROC>("glGetTextureParameterIuiv", Null_glGetTextureParameterIuiv)),
-		GetTextureParameteriv(GetProc<PFNGLGETTEXTUREPARAMETERIVPROC>("glGetTextureParameteriv", Null_glGetTextureParameteriv)),
-		CreateVertexArrays(GetProc<PFNGLCREATEVERTEXARRAYSPROC>("glCreateVertexArrays", Null_glCreateVertexArrays)),
-		DisableVertexArrayAttrib(GetProc<PFNGLDISABLEVERTEXARRAYATTRIBPROC>("glDisableVertexArrayAttrib", Null_glDisableVertexArrayAttrib)),
-		EnableVertexArrayAttrib(GetProc<PFNGLENABLEVERTEXARRAYATTRIBPROC>("glEnableVertexArrayAttrib", Null_glEnableVertexArrayAttrib)),
-		VertexArrayElementBuffer(GetProc<PFNGLVERTEXARRAYELEMENTBUFFERPROC>("glVertexArrayElementBuffer", Null_glVertexArrayElementBuffer)),
-		VertexArrayVertexBuffer(GetProc<PFNGLVERTEXARRAYVERTEXBUFFERPROC>("glVertexArrayVertexBuffer", Null_glVertexArrayVertexBuffer)),
-		VertexArrayVertexBuffers(GetProc<PFNGLVERTEXARRAYVERTEXBUFFERSPROC>("glVertexArrayVertexBuffers", Null_glVertexArrayVertexBuffers)),
-		VertexArrayAttribBinding(GetProc<PFNGLVERTEXARRAYATTRIBBINDINGPROC>("glVertexArrayAttribBinding", Null_glVertexArrayAttribBinding)),
-		VertexArrayAttribFormat(GetProc<PFNGLVERTEXARRAYATTRIBFORMATPROC>("glVertexArrayAttribFormat", Null_glVertexArrayAttribFormat)),
-		VertexArrayAttribIFormat(GetProc<PFNGLVERTEXARRAYATTRIBIFORMATPROC>("glVertexArrayAttribIFormat", Null_glVertexArrayAttribIFormat)),
-		VertexArrayAttribLFormat(GetProc<PFNGLVERTEXARRAYATTRIBLFORMATPROC>("glVertexArrayAttribLFormat", Null_glVertexArrayAttribLFormat)),
-		VertexArrayBindingDivisor(GetProc<PFNGLVERTEXARRAYBINDINGDIVISORPROC>("glVertexArrayBindingDivisor", Null_glVertexArrayBindingDivisor)),
-		GetVertexArrayiv(GetProc<PFNGLGETVERTEXARRAYIVPROC>("glGetVertexArrayiv", Null_glGetVertexArrayiv)),
-		GetVertexArrayIndexediv(GetProc<PFNGLGETVERTEXARRAYINDEXEDIVPROC>("glGetVertexArrayIndexediv", Null_glGetVertexArrayIndexediv)),
-		GetVertexArrayIndexed64iv(GetProc<PFNGLGETVERTEXARRAYINDEXED64IVPROC>("glGetVertexArrayIndexed64iv", Null_glGetVertexArrayIndexed64iv)),
-		CreateSamplers(GetProc<PFNGLCREATESAMPLERSPROC>("glCreateSamplers", Null_glCreateSamplers)),
-		CreateProgramPipelines(GetProc<PFNGLCREATEPROGRAMPIPELINESPROC>("glCreateProgramPipelines", Null_glCreateProgramPipelines)),
-		CreateQueries(GetProc<PFNGLCREATEQUERIESPROC>("glCreateQueries", Null_glCreateQueries)),
-		GetQueryBufferObjecti64v(GetProc<PFNGLGETQUERYBUFFEROBJECTI64VPROC>("glGetQueryBufferObjecti64v", Null_glGetQueryBufferObjecti64v)),
-		GetQueryBufferObjectiv(GetProc<PFNGLGETQUERYBUFFEROBJECTIVPROC>("glGetQueryBufferObjectiv", Null_glGetQueryBufferObjectiv)),
-		GetQueryBufferObjectui64v(GetProc<PFNGLGETQUERYBUFFEROBJECTUI64VPROC>("glGetQueryBufferObjectui64v", Null_glGetQueryBufferObjectui64v)),
-		GetQueryBufferObjectuiv(GetProc<PFNGLGETQUERYBUFFEROBJECTUIVPROC>("glGetQueryBufferObjectuiv", Null_glGetQueryBufferObjectuiv)),
-		MemoryBarrierByRegion(GetProc<PFNGLMEMORYBARRIERBYREGIONPROC>("glMemoryBarrierByRegion", Null_glMemoryBarrierByRegion)),
-		GetTextureSubImage(GetProc<PFNGLGETTEXTURESUBIMAGEPROC>("glGetTextureSubImage", Null_glGetTextureSubImage)),
-		GetCompressedTextureSubImage(GetProc<PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC>("glGetCompressedTextureSubImage", Null_glGetCompressedTextureSubImage)),
-		GetGraphicsResetStatus(GetProc<PFNGLGETGRAPHICSRESETSTATUSPROC>("glGetGraphicsResetStatus", Null_glGetGraphicsResetStatus)),
-		GetnCompressedTexImage(GetProc<PFNGLGETNCOMPRESSEDTEXIMAGEPROC>("glGetnCompressedTexImage", Null_glGetnCompressedTexImage)),
-		GetnTexImage(GetProc<PFNGLGETNTEXIMAGEPROC>("glGetnTexImage", Null_glGetnTexImage)),
-		GetnUniformdv(GetProc<PFNGLGETNUNIFORMDVPROC>("glGetnUniformdv", Null_glGetnUniformdv)),
-		GetnUniformfv(GetProc<PFNGLGETNUNIFORMFVPROC>("glGetnUniformfv", Null_glGetnUniformfv)),
-		GetnUniformiv(GetProc<PFNGLGETNUNIFORMIVPROC>("glGetnUniformiv", Null_glGetnUniformiv)),
-		GetnUniformuiv(GetProc<PFNGLGETNUNIFORMUIVPROC>("glGetnUniformuiv", Null_glGetnUniformuiv)),
-		ReadnPixels(GetProc<PFNGLREADNPIXELSPROC>("glReadnPixels", Null_glReadnPixels)),
-		GetnMapdv(GetProc<PFNGLGETNMAPDVPROC>("glGetnMapdv", Null_glGetnMapdv)),
-		GetnMapfv(GetProc<PFNGLGETNMAPFVPROC>("glGetnMapfv", Null_glGetnMapfv)),
-		GetnMapiv(GetProc<PFNGLGETNMAPIVPROC>("glGetnMapiv", Null_glGetnMapiv)),
-		GetnPixelMapfv(GetProc<PFNGLGETNPIXELMAPFVPROC>("glGetnPixelMapfv", Null_glGetnPixelMapfv)),
-		GetnPixelMapuiv(GetProc<PFNGLGETNPIXELMAPUIVPROC>("glGetnPixelMapuiv", Null_glGetnPixelMapuiv)),
-		GetnPixelMapusv(GetProc<PFNGLGETNPIXELMAPUSVPROC>("glGetnPixelMapusv", Null_glGetnPixelMapusv)),
-		GetnPolygonStipple(GetProc<PFNGLGETNPOLYGONSTIPPLEPROC>("glGetnPolygonStipple", Null_glGetnPolygonStipple)),
-		GetnColorTable(GetProc<PFNGLGETNCOLORTABLEPROC>("glGetnColorTable", Null_glGetnColorTable)),
-		GetnConvolutionFilter(GetProc<PFNGLGETNCONVOLUTIONFILTERPROC>("glGetnConvolutionFilter", Null_glGetnConvolutionFilter)),
-		GetnSeparableFilter(GetProc<PFNGLGETNSEPARABLEFILTERPROC>("glGetnSeparableFilter", Null_glGetnSeparableFilter)),
-		GetnHistogram(GetProc<PFNGLGETNHISTOGRAMPROC>("glGetnHistogram", Null_glGetnHistogram)),
-		GetnMinmax(GetProc<PFNGLGETNMINMAXPROC>("glGetnMinmax", Null_glGetnMinmax)),
-		TextureBarrier(GetProc<PFNGLTEXTUREBARRIERPROC>("glTextureBarrier", Null_glTextureBarrier))
+	static void Resolve_glClipControl(Version46& c){ c.ClipControl = c.GetProc<decltype(c.ClipControl)>("glClipControl", Null_glClipControl); }
+	static void Resolve_glCreateTransformFeedbacks(Version46& c){ c.CreateTransformFeedbacks = c.GetProc<decltype(c.CreateTransformFeedbacks)>("glCreateTransformFeedbacks", Null_glCreateTransformFeedbacks); }
+	static void Resolve_glTransformFeedbackBufferBase(Version46& c){ c.TransformFeedbackBufferBase = c.GetProc<decltype(c.TransformFeedbackBufferBase)>("glTransformFeedbackBufferBase", Null_glTransformFeedbackBufferBase); }
+	static void Resolve_glTransformFeedbackBufferRange(Version46& c){ c.TransformFeedbackBufferRange = c.GetProc<decltype(c.TransformFeedbackBufferRange)>("glTransformFeedbackBufferRange", Null_glTransformFeedbackBufferRange); }
+	static void Resolve_glGetTransformFeedbackiv(Version46& c){ c.GetTransformFeedbackiv = c.GetProc<decltype(c.GetTransformFeedbackiv)>("glGetTransformFeedbackiv", Null_glGetTransformFeedbackiv); }
+	static void Resolve_glGetTransformFeedbacki_v(Version46& c){ c.GetTransformFeedbacki_v = c.GetProc<decltype(c.GetTransformFeedbacki_v)>("glGetTransformFeedbacki_v", Null_glGetTransformFeedbacki_v); }
+	static void Resolve_glGetTransformFeedbacki64_v(Version46& c){ c.GetTransformFeedbacki64_v = c.GetProc<decltype(c.GetTransformFeedbacki64_v)>("glGetTransformFeedbacki64_v", Null_glGetTransformFeedbacki64_v); }
+	static void Resolve_glCreateBuffers(Version46& c){ c.CreateBuffers = c.GetProc<decltype(c.CreateBuffers)>("glCreateBuffers", Null_glCreateBuffers); }
+	static void Resolve_glNamedBufferStorage(Version46& c){ c.NamedBufferStorage = c.GetProc<decltype(c.NamedBufferStorage)>("glNamedBufferStorage", Null_glNamedBufferStorage); }
+	static void Resolve_glNamedBufferData(Version46& c){ c.NamedBufferData = c.GetProc<decltype(c.NamedBufferData)>("glNamedBufferData", Null_glNamedBufferData); }
+	static void Resolve_glNamedBufferSubData(Version46& c){ c.NamedBufferSubData = c.GetProc<decltype(c.NamedBufferSubData)>("glNamedBufferSubData", Null_glNamedBufferSubData); }
+	static void Resolve_glCopyNamedBufferSubData(Version46& c){ c.CopyNamedBufferSubData = c.GetProc<decltype(c.CopyNamedBufferSubData)>("glCopyNamedBufferSubData", Null_glCopyNamedBufferSubData); }
+	static void Resolve_glClearNamedBufferData(Version46& c){ c.ClearNamedBufferData = c.GetProc<decltype(c.ClearNamedBufferData)>("glClearNamedBufferData", Null_glClearNamedBufferData); }
+	static void Resolve_glClearNamedBufferSubData(Version46& c){ c.ClearNamedBufferSubData = c.GetProc<decltype(c.ClearNamedBufferSubData)>("glClearNamedBufferSubData", Null_glClearNamedBufferSubData); }
+	static void Resolve_glMapNamedBuffer(Version46& c){ c.MapNamedBuffer = c.GetProc<decltype(c.MapNamedBuffer)>("glMapNamedBuffer", Null_glMapNamedBuffer); }
+	static void Resolve_glMapNamedBufferRange(Version46& c){ c.MapNamedBufferRange = c.GetProc<decltype(c.MapNamedBufferRange)>("glMapNamedBufferRange", Null_glMapNamedBufferRange); }
+	static void Resolve_glUnmapNamedBuffer(Version46& c){ c.UnmapNamedBuffer = c.GetProc<decltype(c.UnmapNamedBuffer)>("glUnmapNamedBuffer", Null_glUnmapNamedBuffer); }
+	static void Resolve_glFlushMappedNamedBufferRange(Version46& c){ c.FlushMappedNamedBufferRange = c.GetProc<decltype(c.FlushMappedNamedBufferRange)>("glFlushMappedNamedBufferRange", Null_glFlushMappedNamedBufferRange); }
+	static void Resolve_glGetNamedBufferParameteriv(Version46& c){ c.GetNamedBufferParameteriv = c.GetProc<decltype(c.GetNamedBufferParameteriv)>("glGetNamedBufferParameteriv", Null_glGetNamedBufferParameteriv); }
+	static void Resolve_glGetNamedBufferParameteri64v(Version46& c){ c.GetNamedBufferParameteri64v = c.GetProc<decltype(c.GetNamedBufferParameteri64v)>("glGetNamedBufferParameteri64v", Null_glGetNamedBufferParameteri64v); }
+	static void Resolve_glGetNamedBufferPointerv(Version46& c){ c.GetNamedBufferPointerv = c.GetProc<decltype(c.GetNamedBufferPointerv)>("glGetNamedBufferPointerv", Null_glGetNamedBufferPointerv); }
+	static void Resolve_glGetNamedBufferSubData(Version46& c){ c.GetNamedBufferSubData = c.GetProc<decltype(c.GetNamedBufferSubData)>("glGetNamedBufferSubData", Null_glGetNamedBufferSubData); }
+	static void Resolve_glCreateFramebuffers(Version46& c){ c.CreateFramebuffers = c.GetProc<decltype(c.CreateFramebuffers)>("glCreateFramebuffers", Null_glCreateFramebuffers); }
+	static void Resolve_glNamedFramebufferRenderbuffer(Version46& c){ c.NamedFramebufferRenderbuffer = c.GetProc<decltype(c.NamedFramebufferRenderbuffer)>("glNamedFramebufferRenderbuffer", Null_glNamedFramebufferRenderbuffer); }
+	static void Resolve_glNamedFramebufferParameteri(Version46& c){ c.NamedFramebufferParameteri = c.GetProc<decltype(c.NamedFramebufferParameteri)>("glNamedFramebufferParameteri", Null_glNamedFramebufferParameteri); }
+	static void Resolve_glNamedFramebufferTexture(Version46& c){ c.NamedFramebufferTexture = c.GetProc<decltype(c.NamedFramebufferTexture)>("glNamedFramebufferTexture", Null_glNamedFramebufferTexture); }
+	static void Resolve_glNamedFramebufferTextureLayer(Version46& c){ c.NamedFramebufferTextureLayer = c.GetProc<decltype(c.NamedFramebufferTextureLayer)>("glNamedFramebufferTextureLayer", Null_glNamedFramebufferTextureLayer); }
+	static void Resolve_glNamedFramebufferDrawBuffer(Version46& c){ c.NamedFramebufferDrawBuffer = c.GetProc<decltype(c.NamedFramebufferDrawBuffer)>("glNamedFramebufferDrawBuffer", Null_glNamedFramebufferDrawBuffer); }
+	static void Resolve_glNamedFramebufferDrawBuffers(Version46& c){ c.NamedFramebufferDrawBuffers = c.GetProc<decltype(c.NamedFramebufferDrawBuffers)>("glNamedFramebufferDrawBuffers", Null_glNamedFramebufferDrawBuffers); }
+	static void Resolve_glNamedFramebufferReadBuffer(Version46& c){ c.NamedFramebufferReadBuffer = c.GetProc<decltype(c.NamedFramebufferReadBuffer)>("glNamedFramebufferReadBuffer", Null_glNamedFramebufferReadBuffer); }
+	static void Resolve_glInvalidateNamedFramebufferData(Version46& c){ c.InvalidateNamedFramebufferData = c.GetProc<decltype(c.InvalidateNamedFramebufferData)>("glInvalidateNamedFramebufferData", Null_glInvalidateNamedFramebufferData); }
+	static void Resolve_glInvalidateNamedFramebufferSubData(Version46& c){ c.InvalidateNamedFramebufferSubData = c.GetProc<decltype(c.InvalidateNamedFramebufferSubData)>("glInvalidateNamedFramebufferSubData", Null_glInvalidateNamedFramebufferSubData); }
+	static void Resolve_glClearNamedFramebufferiv(Version46& c){ c.ClearNamedFramebufferiv = c.GetProc<decltype(c.ClearNamedFramebufferiv)>("glClearNamedFramebufferiv", Null_glClearNamedFramebufferiv); }
+	static void Resolve_glClearNamedFramebufferuiv(Version46& c){ c.ClearNamedFramebufferuiv = c.GetProc<decltype(c.ClearNamedFramebufferuiv)>("glClearNamedFramebufferuiv", Null_glClearNamedFramebufferuiv); }
+	static void Resolve_glClearNamedFramebufferfv(Version46& c){ c.ClearNamedFramebufferfv = c.GetProc<decltype(c.ClearNamedFramebufferfv)>("glClearNamedFramebufferfv", Null_glClearNamedFramebufferfv); }
+	static void Resolve_glClearNamedFramebufferfi(Version46& c){ c.ClearNamedFramebufferfi = c.GetProc<decltype(c.ClearNamedFramebufferfi)>("glClearNamedFramebufferfi", Null_glClearNamedFramebufferfi); }
+	static void Resolve_glBlitNamedFramebuffer(Version46& c){ c.BlitNamedFramebuffer = c.GetProc<decltype(c.BlitNamedFramebuffer)>("glBlitNamedFramebuffer", Null_glBlitNamedFramebuffer); }
+	static void Resolve_glCheckNamedFramebufferStatus(Version46& c){ c.CheckNamedFramebufferStatus = c.GetProc<decltype(c.CheckNamedFramebufferStatus)>("glCheckNamedFramebufferStatus", Null_glCheckNamedFramebufferStatus); }
+	static void Resolve_glGetNamedFramebufferParameteriv(Version46& c){ c.GetNamedFramebufferParameteriv = c.GetProc<decltype(c.GetNamedFramebufferParameteriv)>("glGetNamedFramebufferParameteriv", Null_glGetNamedFramebufferParameteriv); }
+	static void Resolve_glGetNamedFramebufferAttachmentParameteriv(Version46& c){ c.GetNamedFramebufferAttachmentParameteriv = c.GetProc<decltype(c.GetNamedFramebufferAttachmentParameteriv)>("glGetNamedFramebufferAttachmentParameteriv", Null_glGetNamedFramebufferAttachmentParameteriv); }
+	static void Resolve_glCreateRenderbuffers(Version46& c){ c.CreateRenderbuffers = c.GetProc<decltype(c.CreateRenderbuffers)>("glCreateRenderbuffers", Null_glCreateRenderbuffers); }
+	static void Resolve_glNamedRenderbufferStorage(Version46& c){ c.NamedRenderbufferStorage = c.GetProc<decltype(c.NamedRenderbufferStorage)>("glNamedRenderbufferStorage", Null_glNamedRenderbufferStorage); }
+	static void Resolve_glNamedRenderbufferStorageMultisample(Version46& c){ c.NamedRenderbufferStorageMultisample = c.GetProc<decltype(c.NamedRenderbufferStorageMultisample)>("glNamedRenderbufferStorageMultisample", Null_glNamedRenderbufferStorageMultisample); }
+	static void Resolve_glGetNamedRenderbufferParameteriv(Version46& c){ c.GetNamedRenderbufferParameteriv = c.GetProc<decltype(c.GetNamedRenderbufferParameteriv)>("glGetNamedRenderbufferParameteriv", Null_glGetNamedRenderbufferParameteriv); }
+	static void Resolve_glCreateTextures(Version46& c){ c.CreateTextures = c.GetProc<decltype(c.CreateTextures)>("glCreateTextures", Null_glCreateTextures); }
+	static void Resolve_glTextureBuffer(Version46& c){ c.TextureBuffer = c.GetProc<decltype(c.TextureBuffer)>("glTextureBuffer", Null_glTextureBuffer); }
+	static void Resolve_glTextureBufferRange(Version46& c){ c.TextureBufferRange = c.GetProc<decltype(c.TextureBufferRange)>("glTextureBufferRange", Null_glTextureBufferRange); }
+	static void Resolve_glTextureStorage1D(Version46& c){ c.TextureStorage1D = c.GetProc<decltype(c.TextureStorage1D)>("glTextureStorage1D", Null_glTextureStorage1D); }
+	static void Resolve_glTextureStorage2D(Version46& c){ c.TextureStorage2D = c.GetProc<decltype(c.TextureStorage2D)>("glTextureStorage2D", Null_glTextureStorage2D); }
+	static void Resolve_glTextureStorage3D(Version46& c){ c.TextureStorage3D = c.GetProc<decltype(c.TextureStorage3D)>("glTextureStorage3D", Null_glTextureStorage3D); }
+	static void Resolve_glTextureStorage2DMultisample(Version46& c){ c.TextureStorage2DMultisample = c.GetProc<decltype(c.TextureStorage2DMultisample)>("glTextureStorage2DMultisample", Null_glTextureStorage2DMultisample); }
+	static void Resolve_glTextureStorage3DMultisample(Version46& c){ c.TextureStorage3DMultisample = c.GetProc<decltype(c.TextureStorage3DMultisample)>("glTextureStorage3DMultisample", Null_glTextureStorage3DMultisample); }
+	static void Resolve_glTextureSubImage1D(Version46& c){ c.TextureSubImage1D = c.GetProc<decltype(c.TextureSubImage1D)>("glTextureSubImage1D", Null_glTextureSubImage1D); }
+	static void Resolve_glTextureSubImage2D(Version46& c){ c.TextureSubImage2D = c.GetProc<decltype(c.TextureSubImage2D)>("glTextureSubImage2D", Null_glTextureSubImage2D); }
+	static void Resolve_glTextureSubImage3D(Version46& c){ c.TextureSubImage3D = c.GetProc<decltype(c.TextureSubImage3D)>("glTextureSubImage3D", Null_glTextureSubImage3D); }
+	static void Resolve_glCompressedTextureSubImage1D(Version46& c){ c.CompressedTextureSubImage1D = c.GetProc<decltype(c.CompressedTextureSubImage1D)>("glCompressedTextureSubImage1D", Null_glCompressedTextureSubImage1D); }
+	static void Resolve_glCompressedTextureSubImage2D(Version46& c){ c.CompressedTextureSubImage2D = c.GetProc<decltype(c.CompressedTextureSubImage2D)>("glCompressedTextureSubImage2D", Null_glCompressedTextureSubImage2D); }
+	static void Resolve_glCompressedTextureSubImage3D(Version46& c){ c.CompressedTextureSubImage3D = c.GetProc<decltype(c.CompressedTextureSubImage3D)>("glCompressedTextureSubImage3D", Null_glCompressedTextureSubImage3D); }
+	static void Resolve_glCopyTextureSubImage1D(Version46& c){ c.CopyTextureSubImage1D = c.GetProc<decltype(c.CopyTextureSubImage1D)>("glCopyTextureSubImage1D", Null_glCopyTextureSubImage1D); }
+	static void Resolve_glCopyTextureSubImage2D(Version46& c){ c.CopyTextureSubImage2D = c.GetProc<decltype(c.CopyTextureSubImage2D)>("glCopyTextureSubImage2D", Null_glCopyTextureSubImage2D); }
+	static void Resolve_glCopyTextureSubImage3D(Version46& c){ c.CopyTextureSubImage3D = c.GetProc<decltype(c.CopyTextureSubImage3D)>("glCopyTextureSubImage3D", Null_glCopyTextureSubImage3D); }
+	static void Resolve_glTextureParameterf(Version46& c){ c.TextureParameterf = c.GetProc<decltype(c.TextureParameterf)>("glTextureParameterf", Null_glTextureParameterf); }
+	static void Resolve_glTextureParameterfv(Version46& c){ c.TextureParameterfv = c.GetProc<decltype(c.TextureParameterfv)>("glTextureParameterfv", Null_glTextureParameterfv); }
+	static void Resolve_glTextureParameteri(Version46& c){ c.TextureParameteri = c.GetProc<decltype(c.TextureParameteri)>("glTextureParameteri", Null_glTextureParameteri); }
+	static void Resolve_glTextureParameterIiv(Version46& c){ c.TextureParameterIiv = c.GetProc<decltype(c.TextureParameterIiv)>("glTextureParameterIiv", Null_glTextureParameterIiv); }
+	static void Resolve_glTextureParameterIuiv(Version46& c){ c.TextureParameterIuiv = c.GetProc<decltype(c.TextureParameterIuiv)>("glTextureParameterIuiv", Null_glTextureParameterIuiv); }
+	static void Resolve_glTextureParameteriv(Version46& c){ c.TextureParameteriv = c.GetProc<decltype(c.TextureParameteriv)>("glTextureParameteriv", Null_glTextureParameteriv); }
+	static void Resolve_glGenerateTextureMipmap(Version46& c){ c.GenerateTextureMipmap = c.GetProc<decltype(c.GenerateTextureMipmap)>("glGenerateTextureMipmap", Null_glGenerateTextureMipmap); }
+	static void Resolve_glBindTextureUnit(Version46& c){ c.BindTextureUnit = c.GetProc<decltype(c.BindTextureUnit)>("glBindTextureUnit", Null_glBindTextureUnit); }
+	static void Resolve_glGetTextureImage(Version46& c){ c.GetTextureImage = c.GetProc<decltype(c.GetTextureImage)>("glGetTextureImage", Null_glGetTextureImage); }
+	static void Resolve_glGetCompressedTextureImage(Version46& c){ c.GetCompressedTextureImage = c.GetProc<decltype(c.GetCompressedTextureImage)>("glGetCompressedTextureImage", Null_glGetCompressedTextureImage); }
+	static void Resolve_glGetTextureLevelParameterfv(Version46& c){ c.GetTextureLevelParameterfv = c.GetProc<decltype(c.GetTextureLevelParameterfv)>("glGetTextureLevelParameterfv", Null_glGetTextureLevelParameterfv); }
+	static void Resolve_glGetTextureLevelParameteriv(Version46& c){ c.GetTextureLevelParameteriv = c.GetProc<decltype(c.GetTextureLevelParameteriv)>("glGetTextureLevelParameteriv", Null_glGetTextureLevelParameteriv); }
+	static void Resolve_glGetTextureParameterfv(Version46& c){ c.GetTextureParameterfv = c.GetProc<decltype(c.GetTextureParameterfv)>("glGetTextureParameterfv", Null_glGetTextureParameterfv); }
+	static void Resolve_glGetTextureParameterIiv(Version46& c){ c.GetTextureParameterIiv = c.GetProc<decltype(c.GetTextureParameterIiv)>("glGetTextureParameterIiv", Null_glGetTextureParameterIiv); }
+	static void Resolve_glGetTextureParameterIuiv(Version46& c){ c.GetTextureParameterIuiv = c.GetProc<decltype(c.GetTextureParameterIuiv)>("glGetTextureParameterIuiv", Null_glGetTextureParameterIuiv); }
+	static void Resolve_glGetTextureParameteriv(Version46& c){ c.GetTextureParameteriv = c.GetProc<decltype(c.GetTextureParameteriv)>("glGetTextureParameteriv", Null_glGetTextureParameteriv); }
+	static void Resolve_glCreateVertexArrays(Version46& c){ c.CreateVertexArrays = c.GetProc<decltype(c.CreateVertexArrays)>("glCreateVertexArrays", Null_glCreateVertexArrays); }
+	static void Resolve_glDisableVertexArrayAttrib(Version46& c){ c.DisableVertexArrayAttrib = c.GetProc<decltype(c.DisableVertexArrayAttrib)>("glDisableVertexArrayAttrib", Null_glDisableVertexArrayAttrib); }
+	static void Resolve_glEnableVertexArrayAttrib(Version46& c){ c.EnableVertexArrayAttrib = c.GetProc<decltype(c.EnableVertexArrayAttrib)>("glEnableVertexArrayAttrib", Null_glEnableVertexArrayAttrib); }
+	static void Resolve_glVertexArrayElementBuffer(Version46& c){ c.VertexArrayElementBuffer = c.GetProc<decltype(c.VertexArrayElementBuffer)>("glVertexArrayElementBuffer", Null_glVertexArrayElementBuffer); }
+	static void Resolve_glVertexArrayVertexBuffer(Version46& c){ c.VertexArrayVertexBuffer = c.GetProc<decltype(c.VertexArrayVertexBuffer)>("glVertexArrayVertexBuffer", Null_glVertexArrayVertexBuffer); }
+	static void Resolve_glVertexArrayVertexBuffers(Version46& c){ c.VertexArrayVertexBuffers = c.GetProc<decltype(c.VertexArrayVertexBuffers)>("glVertexArrayVertexBuffers", Null_glVertexArrayVertexBuffers); }
+	static void Resolve_glVertexArrayAttribBinding(Version46& c){ c.VertexArrayAttribBinding = c.GetProc<decltype(c.VertexArrayAttribBinding)>("glVertexArrayAttribBinding", Null_glVertexArrayAttribBinding); }
+	static void Resolve_glVertexArrayAttribFormat(Version46& c){ c.VertexArrayAttribFormat = c.GetProc<decltype(c.VertexArrayAttribFormat)>("glVertexArrayAttribFormat", Null_glVertexArrayAttribFormat); }
+	static void Resolve_glVertexArrayAttribIFormat(Version46& c){ c.VertexArrayAttribIFormat = c.GetProc<decltype(c.VertexArrayAttribIFormat)>("glVertexArrayAttribIFormat", Null_glVertexArrayAttribIFormat); }
+	static void Resolve_glVertexArrayAttribLFormat(Version46& c){ c.VertexArrayAttribLFormat = c.GetProc<decltype(c.VertexArrayAttribLFormat)>("glVertexArrayAttribLFormat", Null_glVertexArrayAttribLFormat); }
+	static void Resolve_glVertexArrayBindingDivisor(Version46& c){ c.VertexArrayBindingDivisor = c.GetProc<decltype(c.VertexArrayBindingDivisor)>("glVertexArrayBindingDivisor", Null_glVertexArrayBindingDivisor); }
+	static void Resolve_glGetVertexArrayiv(Version46& c){ c.GetVertexArrayiv = c.GetProc<decltype(c.GetVertexArrayiv)>("glGetVertexArrayiv", Null_glGetVertexArrayiv); }
+	static void Resolve_glGetVertexArrayIndexediv(Version46& c){ c.GetVertexArrayIndexediv = c.GetProc<decltype(c.GetVertexArrayIndexediv)>("glGetVertexArrayIndexediv", Null_glGetVertexArrayIndexediv); }
+	static void Resolve_glGetVertexArrayIndexed64iv(Version46& c){ c.GetVertexArrayIndexed64iv = c.GetProc<decltype(c.GetVertexArrayIndexed64iv)>("glGetVertexArrayIndexed64iv", Null_glGetVertexArrayIndexed64iv); }
+	static void Resolve_glCreateSamplers(Version46& c){ c.CreateSamplers = c.GetProc<decltype(c.CreateSamplers)>("glCreateSamplers", Null_glCreateSamplers); }
+	static void Resolve_glCreateProgramPipelines(Version46& c){ c.CreateProgramPipelines = c.GetProc<decltype(c.CreateProgramPipelines)>("glCreateProgramPipelines", Null_glCreateProgramPipelines); }
+	static void Resolve_glCreateQueries(Version46& c){ c.CreateQueries = c.GetProc<decltype(c.CreateQueries)>("glCreateQueries", Null_glCreateQueries); }
+	static void Resolve_glGetQueryBufferObjecti64v(Version46& c){ c.GetQueryBufferObjecti64v = c.GetProc<decltype(c.GetQueryBufferObjecti64v)>("glGetQueryBufferObjecti64v", Null_glGetQueryBufferObjecti64v); }
+	static void Resolve_glGetQueryBufferObjectiv(Version46& c){ c.GetQueryBufferObjectiv = c.GetProc<decltype(c.GetQueryBufferObjectiv)>("glGetQueryBufferObjectiv", Null_glGetQueryBufferObjectiv); }
+	static void Resolve_glGetQueryBufferObjectui64v(Version46& c){ c.GetQueryBufferObjectui64v = c.GetProc<decltype(c.GetQueryBufferObjectui64v)>("glGetQueryBufferObjectui64v", Null_glGetQueryBufferObjectui64v); }
+	static void Resolve_glGetQueryBufferObjectuiv(Version46& c){ c.GetQueryBufferObjectuiv = c.GetProc<decltype(c.GetQueryBufferObjectuiv)>("glGetQueryBufferObjectuiv", Null_glGetQueryBufferObjectuiv); }
+	static void Resolve_glMemoryBarrierByRegion(Version46& c){ c.MemoryBarrierByRegion = c.GetProc<decltype(c.MemoryBarrierByRegion)>("glMemoryBarrierByRegion", Null_glMemoryBarrierByRegion); }
+	static void Resolve_glGetTextureSubImage(Version46& c){ c.GetTextureSubImage = c.GetProc<decltype(c.GetTextureSubImage)>("glGetTextureSubImage", Null_glGetTextureSubImage); }
+	static void Resolve_glGetCompressedTextureSubImage(Version46& c){ c.GetCompressedTextureSubImage = c.GetProc<decltype(c.GetCompressedTextureSubImage)>("glGetCompressedTextureSubImage", Null_glGetCompressedTextureSubImage); }
+	static void Resolve_glGetGraphicsResetStatus(Version46& c){ c.GetGraphicsResetStatus = c.GetProc<decltype(c.GetGraphicsResetStatus)>("glGetGraphicsResetStatus", Null_glGetGraphicsResetStatus); }
+	static void Resolve_glGetnCompressedTexImage(Version46& c){ c.GetnCompressedTexImage = c.GetProc<decltype(c.GetnCompressedTexImage)>("glGetnCompressedTexImage", Null_glGetnCompressedTexImage); }
+	static void Resolve_glGetnTexImage(Version46& c){ c.GetnTexImage = c.GetProc<decltype(c.GetnTexImage)>("glGetnTexImage", Null_glGetnTexImage); }
+	static void Resolve_glGetnUniformdv(Version46& c){ c.GetnUniformdv = c.GetProc<decltype(c.GetnUniformdv)>("glGetnUniformdv", Null_glGetnUniformdv); }
+	static void Resolve_glGetnUniformfv(Version46& c){ c.GetnUniformfv = c.GetProc<decltype(c.GetnUniformfv)>("glGetnUniformfv", Null_glGetnUniformfv); }
+	static void Resolve_glGetnUniformiv(Version46& c){ c.GetnUniformiv = c.GetProc<decltype(c.GetnUniformiv)>("glGetnUniformiv", Null_glGetnUniformiv); }
+	static void Resolve_glGetnUniformuiv(Version46& c){ c.GetnUniformuiv = c.GetProc<decltype(c.GetnUniformuiv)>("glGetnUniformuiv", Null_glGetnUniformuiv); }
+	static void Resolve_glReadnPixels(Version46& c){ c.ReadnPixels = c.GetProc<decltype(c.ReadnPixels)>("glReadnPixels", Null_glReadnPixels); }
+	static void Resolve_glGetnMapdv(Version46& c){ c.GetnMapdv = c.GetProc<decltype(c.GetnMapdv)>("glGetnMapdv", Null_glGetnMapdv); }
+	static void Resolve_glGetnMapfv(Version46& c){ c.GetnMapfv = c.GetProc<decltype(c.GetnMapfv)>("glGetnMapfv", Null_glGetnMapfv); }
+	static void Resolve_glGetnMapiv(Version46& c){ c.GetnMapiv = c.GetProc<decltype(c.GetnMapiv)>("glGetnMapiv", Null_glGetnMapiv); }
+	static void Resolve_glGetnPixelMapfv(Version46& c){ c.GetnPixelMapfv = c.GetProc<decltype(c.GetnPixelMapfv)>("glGetnPixelMapfv", Null_glGetnPixelMapfv); }
+	static void Resolve_glGetnPixelMapuiv(Version46& c){ c.GetnPixelMapuiv = c.GetProc<decltype(c.GetnPixelMapuiv)>("glGetnPixelMapuiv", Null_glGetnPixelMapuiv); }
+	static void Resolve_glGetnPixelMapusv(Version46& c){ c.GetnPixelMapusv = c.GetProc<decltype(c.GetnPixelMapusv)>("glGetnPixelMapusv", Null_glGetnPixelMapusv); }
+	static void Resolve_glGetnPolygonStipple(Version46& c){ c.GetnPolygonStipple = c.GetProc<decltype(c.GetnPolygonStipple)>("glGetnPolygonStipple", Null_glGetnPolygonStipple); }
+	static void Resolve_glGetnColorTable(Version46& c){ c.GetnColorTable = c.GetProc<decltype(c.GetnColorTable)>("glGetnColorTable", Null_glGetnColorTable); }
+	static void Resolve_glGetnConvolutionFilter(Version46& c){ c.GetnConvolutionFilter = c.GetProc<decltype(c.GetnConvolutionFilter)>("glGetnConvolutionFilter", Null_glGetnConvolutionFilter); }
+	static void Resolve_glGetnSeparableFilter(Version46& c){ c.GetnSeparableFilter = c.GetProc<decltype(c.GetnSeparableFilter)>("glGetnSeparableFilter", Null_glGetnSeparableFilter); }
+	static void Resolve_glGetnHistogram(Version46& c){ c.GetnHistogram = c.GetProc<decltype(c.GetnHistogram)>("glGetnHistogram", Null_glGetnHistogram); }
+	static void Resolve_glGetnMinmax(Version46& c){ c.GetnMinmax = c.GetProc<decltype(c.GetnMinmax)>("glGetnMinmax", Null_glGetnMinmax); }
+	static void Resolve_glTextureBarrier(Version46& c){ c.TextureBarrier = c.GetProc<decltype(c.TextureBarrier)>("glTextureBarrier", Null_glTextureBarrier); }
+	static void APIENTRY Lazy_glClipControl (GLenum origin, GLenum depth){ auto& c = ResolveLazy(Resolve_glClipControl, [](const Version46& c){ return c.ClipControl == Lazy_glClipControl; }); return c.ClipControl(origin, depth); }
+	static void APIENTRY Lazy_glCreateTransformFeedbacks (GLsizei n, GLuint* ids){ auto& c = ResolveLazy(Resolve_glCreateTransformFeedbacks, [](const Version46& c){ return c.CreateTransformFeedbacks == Lazy_glCreateTransformFeedbacks; }); return c.CreateTransformFeedbacks(n, ids); }
+	static void APIENTRY Lazy_glTransformFeedbackBufferBase (GLuint xfb, GLuint index, GLuint buffer){ auto& c = ResolveLazy(Resolve_glTransformFeedbackBufferBase, [](const Version46& c){ return c.TransformFeedbackBufferBase == Lazy_glTransformFeedbackBufferBase; }); return c.TransformFeedbackBufferBase(xfb, index, buffer); }
+	static void APIENTRY Lazy_glTransformFeedbackBufferRange (GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size){ auto& c = ResolveLazy(Resolve_glTransformFeedbackBufferRange, [](const Version46& c){ return c.TransformFeedbackBufferRange == Lazy_glTransformFeedbackBufferRange; }); return c.TransformFeedbackBufferRange(xfb, index, buffer, offset, size); }
+	static void APIENTRY Lazy_glGetTransformFeedbackiv (GLuint xfb, GLenum pname, GLint* param){ auto& c = ResolveLazy(Resolve_glGetTransformFeedbackiv, [](const Version46& c){ return c.GetTransformFeedbackiv == Lazy_glGetTransformFeedbackiv; }); return c.GetTransformFeedbackiv(xfb, pname, param); }
+	static void APIENTRY Lazy_glGetTransformFeedbacki_v (GLuint xfb, GLenum pname, GLuint index, GLint* param){ auto& c = ResolveLazy(Resolve_glGetTransformFeedbacki_v, [](const Version46& c){ return c.GetTransformFeedbacki_v == Lazy_glGetTransformFeedbacki_v; }); return c.GetTransformFeedbacki_v(xfb, pname, index, param); }
+	static void APIENTRY Lazy_glGetTransformFeedbacki64_v (GLuint xfb, GLenum pname, GLuint index, GLint64* param){ auto& c = ResolveLazy(Resolve_glGetTransformFeedbacki64_v, [](const Version46& c){ return c.GetTransformFeedbacki64_v == Lazy_glGetTransformFeedbacki64_v; }); return c.GetTransformFeedbacki64_v(xfb, pname, index, param); }
+	static void APIENTRY Lazy_glCreateBuffers (GLsizei n, GLuint* buffers){ auto& c = ResolveLazy(Resolve_glCreateBuffers, [](const Version46& c){ return c.CreateBuffers == Lazy_glCreateBuffers; }); return c.CreateBuffers(n, buffers); }
+	static void APIENTRY Lazy_glNamedBufferStorage (GLuint buffer, GLsizeiptr size, const void* data, GLbitfield flags){ auto& c = ResolveLazy(Resolve_glNamedBufferStorage, [](const Version46& c){ return c.NamedBufferStorage == Lazy_glNamedBufferStorage; }); return c.NamedBufferStorage(buffer, size, data, flags); }
+	static void APIENTRY Lazy_glNamedBufferData (GLuint buffer, GLsizeiptr size, const void* data, GLenum usage){ auto& c = ResolveLazy(Resolve_glNamedBufferData, [](const Version46& c){ return c.NamedBufferData == Lazy_glNamedBufferData; }); return c.NamedBufferData(buffer, size, data, usage); }
+	static void APIENTRY Lazy_glNamedBufferSubData (GLuint buffer, GLintptr offset, GLsizeiptr size, const void* data){ auto& c = ResolveLazy(Resolve_glNamedBufferSubData, [](const Version46& c){ return c.NamedBufferSubData == Lazy_glNamedBufferSubData; }); return c.NamedBufferSubData(buffer, offset, size, data); }
+	static void APIENTRY Lazy_glCopyNamedBufferSubData (GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size){ auto& c = ResolveLazy(Resolve_glCopyNamedBufferSubData, [](const Version46& c){ return c.CopyNamedBufferSubData == Lazy_glCopyNamedBufferSubData; }); return c.CopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size); }
+	static void APIENTRY Lazy_glClearNamedBufferData (GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void* data){ auto& c = ResolveLazy(Resolve_glClearNamedBufferData, [](const Version46& c){ return c.ClearNamedBufferData == Lazy_glClearNamedBufferData; }); return c.ClearNamedBufferData(buffer, internalformat, format, type, data); }
+	static void APIENTRY Lazy_glClearNamedBufferSubData (GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void* data){ auto& c = ResolveLazy(Resolve_glClearNamedBufferSubData, [](const Version46& c){ return c.ClearNamedBufferSubData == Lazy_glClearNamedBufferSubData; }); return c.ClearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data); }
+	static void* APIENTRY Lazy_glMapNamedBuffer (GLuint buffer, GLenum access){ auto& c = ResolveLazy(Resolve_glMapNamedBuffer, [](const Version46& c){ return c.MapNamedBuffer == Lazy_glMapNamedBuffer; }); return c.MapNamedBuffer(buffer, access); }
+	static void* APIENTRY Lazy_glMapNamedBufferRange (GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access){ auto& c = ResolveLazy(Resolve_glMapNamedBufferRange, [](const Version46& c){ return c.MapNamedBufferRange == Lazy_glMapNamedBufferRange; }); return c.MapNamedBufferRange(buffer, offset, length, access); }
+	static GLboolean APIENTRY Lazy_glUnmapNamedBuffer (GLuint buffer){ auto& c = ResolveLazy(Resolve_glUnmapNamedBuffer, [](const Version46& c){ return c.UnmapNamedBuffer == Lazy_glUnmapNamedBuffer; }); return c.UnmapNamedBuffer(buffer); }
+	static void APIENTRY Lazy_glFlushMappedNamedBufferRange (GLuint buffer, GLintptr offset, GLsizeiptr length){ auto& c = ResolveLazy(Resolve_glFlushMappedNamedBufferRange, [](const Version46& c){ return c.FlushMappedNamedBufferRange == Lazy_glFlushMappedNamedBufferRange; }); return c.FlushMappedNamedBufferRange(buffer, offset, length); }
+	static void APIENTRY Lazy_glGetNamedBufferParameteriv (GLuint buffer, GLenum pname, GLint* params){ auto& c = ResolveLazy(Resolve_glGetNamedBufferParameteriv, [](const Version46& c){ return c.GetNamedBufferParameteriv == Lazy_glGetNamedBufferParameteriv; }); return c.GetNamedBufferParameteriv(buffer, pname, params); }
+	static void APIENTRY Lazy_glGetNamedBufferParameteri64v (GLuint buffer, GLenum pname, GLint64* params){ auto& c = ResolveLazy(Resolve_glGetNamedBufferParameteri64v, [](const Version46& c){ return c.GetNamedBufferParameteri64v == Lazy_glGetNamedBufferParameteri64v; }); return c.GetNamedBufferParameteri64v(buffer, pname, params); }
+	static void APIENTRY Lazy_glGetNamedBufferPointerv (GLuint buffer, GLenum pname, void** params){ auto& c = ResolveLazy(Resolve_glGetNamedBufferPointerv, [](const Version46& c){ return c.GetNamedBufferPointerv == Lazy_glGetNamedBufferPointerv; }); return c.GetNamedBufferPointerv(buffer, pname, params); }
+	static void APIENTRY Lazy_glGetNamedBufferSubData (GLuint buffer, GLintptr offset, GLsizeiptr size, void* data){ auto& c = ResolveLazy(Resolve_glGetNamedBufferSubData, [](const Version46& c){ return c.GetNamedBufferSubData == Lazy_glGetNamedBufferSubData; }); return c.GetNamedBufferSubData(buffer, offset, size, data); }
+	static void APIENTRY Lazy_glCreateFramebuffers (GLsizei n, GLuint* framebuffers){ auto& c = ResolveLazy(Resolve_glCreateFramebuffers, [](const Version46& c){ return c.CreateFramebuffers == Lazy_glCreateFramebuffers; }); return c.CreateFramebuffers(n, framebuffers); }
+	static void APIENTRY Lazy_glNamedFramebufferRenderbuffer (GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer){ auto& c = ResolveLazy(Resolve_glNamedFramebufferRenderbuffer, [](const Version46& c){ return c.NamedFramebufferRenderbuffer == Lazy_glNamedFramebufferRenderbuffer; }); return c.NamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer); }
+	static void APIENTRY Lazy_glNamedFramebufferParameteri (GLuint framebuffer, GLenum pname, GLint param){ auto& c = ResolveLazy(Resolve_glNamedFramebufferParameteri, [](const Version46& c){ return c.NamedFramebufferParameteri == Lazy_glNamedFramebufferParameteri; }); return c.NamedFramebufferParameteri(framebuffer, pname, param); }
+	static void APIENTRY Lazy_glNamedFramebufferTexture (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level){ auto& c = ResolveLazy(Resolve_glNamedFramebufferTexture, [](const Version46& c){ return c.NamedFramebufferTexture == Lazy_glNamedFramebufferTexture; }); return c.NamedFramebufferTexture(framebuffer, attachment, texture, level); }
+	static void APIENTRY Lazy_glNamedFramebufferTextureLayer (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer){ auto& c = ResolveLazy(Resolve_glNamedFramebufferTextureLayer, [](const Version46& c){ return c.NamedFramebufferTextureLayer == Lazy_glNamedFramebufferTextureLayer; }); return c.NamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer); }
+	static void APIENTRY Lazy_glNamedFramebufferDrawBuffer (GLuint framebuffer, GLenum buf){ auto& c = ResolveLazy(Resolve_glNamedFramebufferDrawBuffer, [](const Version46& c){ return c.NamedFramebufferDrawBuffer == Lazy_glNamedFramebufferDrawBuffer; }); return c.NamedFramebufferDrawBuffer(framebuffer, buf); }
+	static void APIENTRY Lazy_glNamedFramebufferDrawBuffers (GLuint framebuffer, GLsizei n, const GLenum* bufs){ auto& c = ResolveLazy(Resolve_glNamedFramebufferDrawBuffers, [](const Version46& c){ return c.NamedFramebufferDrawBuffers == Lazy_glNamedFramebufferDrawBuffers; }); return c.NamedFramebufferDrawBuffers(framebuffer, n, bufs); }
+	static void APIENTRY Lazy_glNamedFramebufferReadBuffer (GLuint framebuffer, GLenum src){ auto& c = ResolveLazy(Resolve_glNamedFramebufferReadBuffer, [](const Version46& c){ return c.NamedFramebufferReadBuffer == Lazy_glNamedFramebufferReadBuffer; }); return c.NamedFramebufferReadBuffer(framebuffer, src); }
+	static void APIENTRY Lazy_glInvalidateNamedFramebufferData (GLuint framebuffer, GLsizei numAttachments, const GLenum* attachments){ auto& c = ResolveLazy(Resolve_glInvalidateNamedFramebufferData, [](const Version46& c){ return c.InvalidateNamedFramebufferData == Lazy_glInvalidateNamedFramebufferData; }); return c.InvalidateNamedFramebufferData(framebuffer, numAttachments, attachments); }
+	static void APIENTRY Lazy_glInvalidateNamedFramebufferSubData (GLuint framebuffer, GLsizei numAttachments, const GLenum* attachments, GLint x, GLint y, GLsizei width, GLsizei height){ auto& c = ResolveLazy(Resolve_glInvalidateNamedFramebufferSubData, [](const Version46& c){ return c.InvalidateNamedFramebufferSubData == Lazy_glInvalidateNamedFramebufferSubData; }); return c.InvalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height); }
+	static void APIENTRY Lazy_glClearNamedFramebufferiv (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint* value){ auto& c = ResolveLazy(Resolve_glClearNamedFramebufferiv, [](const Version46& c){ return c.ClearNamedFramebufferiv == Lazy_glClearNamedFramebufferiv; }); return c.ClearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value); }
+	static void APIENTRY Lazy_glClearNamedFramebufferuiv (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint* value){ auto& c = ResolveLazy(Resolve_glClearNamedFramebufferuiv, [](const Version46& c){ return c.ClearNamedFramebufferuiv == Lazy_glClearNamedFramebufferuiv; }); return c.ClearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value); }
+	static void APIENTRY Lazy_glClearNamedFramebufferfv (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat* value){ auto& c = ResolveLazy(Resolve_glClearNamedFramebufferfv, [](const Version46& c){ return c.ClearNamedFramebufferfv == Lazy_glClearNamedFramebufferfv; }); return c.ClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value); }
+	static void APIENTRY Lazy_glClearNamedFramebufferfi (GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil){ auto& c = ResolveLazy(Resolve_glClearNamedFramebufferfi, [](const Version46& c){ return c.ClearNamedFramebufferfi == Lazy_glClearNamedFramebufferfi; }); return c.ClearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil); }
+	static void APIENTRY Lazy_glBlitNamedFramebuffer (GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter){ auto& c = ResolveLazy(Resolve_glBlitNamedFramebuffer, [](const Version46& c){ return c.BlitNamedFramebuffer == Lazy_glBlitNamedFramebuffer; }); return c.BlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter); }
+	static GLenum APIENTRY Lazy_glCheckNamedFramebufferStatus (GLuint framebuffer, GLenum target){ auto& c = ResolveLazy(Resolve_glCheckNamedFramebufferStatus, [](const Version46& c){ return c.CheckNamedFramebufferStatus == Lazy_glCheckNamedFramebufferStatus; }); return c.CheckNamedFramebufferStatus(framebuffer, target); }
+	static void APIENTRY Lazy_glGetNamedFramebufferParameteriv (GLuint framebuffer, GLenum pname, GLint* param){ auto& c = ResolveLazy(Resolve_glGetNamedFramebufferParameteriv, [](const Version46& c){ return c.GetNamedFramebufferParameteriv == Lazy_glGetNamedFramebufferParameteriv; }); return c.GetNamedFramebufferParameteriv(framebuffer, pname, param); }
+	static void APIENTRY Lazy_glGetNamedFramebufferAttachmentParameteriv (GLuint framebuffer, GLenum attachment, GLenum pname, GLint* params){ auto& c = ResolveLazy(Resolve_glGetNamedFramebufferAttachmentParameteriv, [](const Version46& c){ return c.GetNamedFramebufferAttachmentParameteriv == Lazy_glGetNamedFramebufferAttachmentParameteriv; }); return c.GetNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params); }
+	static void APIENTRY Lazy_glCreateRenderbuffers (GLsizei n, GLuint* renderbuffers){ auto& c = ResolveLazy(Resolve_glCreateRenderbuffers, [](const Version46& c){ return c.CreateRenderbuffers == Lazy_glCreateRenderbuffers; }); return c.CreateRenderbuffers(n, renderbuffers); }
+	static void APIENTRY Lazy_glNamedRenderbufferStorage (GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height){ auto& c = ResolveLazy(Resolve_glNamedRenderbufferStorage, [](const Version46& c){ return c.NamedRenderbufferStorage == Lazy_glNamedRenderbufferStorage; }); return c.NamedRenderbufferStorage(renderbuffer, internalformat, width, height); }
+	static void APIENTRY Lazy_glNamedRenderbufferStorageMultisample (GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height){ auto& c = ResolveLazy(Resolve_glNamedRenderbufferStorageMultisample, [](const Version46& c){ return c.NamedRenderbufferStorageMultisample == Lazy_glNamedRenderbufferStorageMultisample; }); return c.NamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height); }
+	static void APIENTRY Lazy_glGetNamedRenderbufferParameteriv (GLuint renderbuffer, GLenum pname, GLint* params){ auto& c = ResolveLazy(Resolve_glGetNamedRenderbufferParameteriv, [](const Version46& c){ return c.GetNamedRenderbufferParameteriv == Lazy_glGetNamedRenderbufferParameteriv; }); return c.GetNamedRenderbufferParameteriv(renderbuffer, pname, params); }
+	static void APIENTRY Lazy_glCreateTextures (GLenum target, GLsizei n, GLuint* textures){ auto& c = ResolveLazy(Resolve_glCreateTextures, [](const Version46& c){ return c.CreateTextures == Lazy_glCreateTextures; }); return c.CreateTextures(target, n, textures); }
+	static void APIENTRY Lazy_glTextureBuffer (GLuint texture, GLenum internalformat, GLuint buffer){ auto& c = ResolveLazy(Resolve_glTextureBuffer, [](const Version46& c){ return c.TextureBuffer == Lazy_glTextureBuffer; }); return c.TextureBuffer(texture, internalformat, buffer); }
+	static void APIENTRY Lazy_glTextureBufferRange (GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size){ auto& c = ResolveLazy(Resolve_glTextureBufferRange, [](const Version46& c){ return c.TextureBufferRange == Lazy_glTextureBufferRange; }); return c.TextureBufferRange(texture, internalformat, buffer, offset, size); }
+	static void APIENTRY Lazy_glTextureStorage1D (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width){ auto& c = ResolveLazy(Resolve_glTextureStorage1D, [](const Version46& c){ return c.TextureStorage1D == Lazy_glTextureStorage1D; }); return c.TextureStorage1D(texture, levels, internalformat, width); }
+	static void APIENTRY Lazy_glTextureStorage2D (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height){ auto& c = ResolveLazy(Resolve_glTextureStorage2D, [](const Version46& c){ return c.TextureStorage2D == Lazy_glTextureStorage2D; }); return c.TextureStorage2D(texture, levels, internalformat, width, height); }
+	static void APIENTRY Lazy_glTextureStorage3D (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth){ auto& c = ResolveLazy(Resolve_glTextureStorage3D, [](const Version46& c){ return c.TextureStorage3D == Lazy_glTextureStorage3D; }); return c.TextureStorage3D(texture, levels, internalformat, width, height, depth); }
+	static void APIENTRY Lazy_glTextureStorage2DMultisample (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations){ auto& c = ResolveLazy(Resolve_glTextureStorage2DMultisample, [](const Version46& c){ return c.TextureStorage2DMultisample == Lazy_glTextureStorage2DMultisample; }); return c.TextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations); }
+	static void APIENTRY Lazy_glTextureStorage3DMultisample (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations){ auto& c = ResolveLazy(Resolve_glTextureStorage3DMultisample, [](const Version46& c){ return c.TextureStorage3DMultisample == Lazy_glTextureStorage3DMultisample; }); return c.TextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations); }
+	static void APIENTRY Lazy_glTextureSubImage1D (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void* pixels){ auto& c = ResolveLazy(Resolve_glTextureSubImage1D, [](const Version46& c){ return c.TextureSubImage1D == Lazy_glTextureSubImage1D; }); return c.TextureSubImage1D(texture, level, xoffset, width, format, type, pixels); }
+	static void APIENTRY Lazy_glTextureSubImage2D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels){ auto& c = ResolveLazy(Resolve_glTextureSubImage2D, [](const Version46& c){ return c.TextureSubImage2D == Lazy_glTextureSubImage2D; }); return c.TextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels); }
+	static void APIENTRY Lazy_glTextureSubImage3D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void* pixels){ auto& c = ResolveLazy(Resolve_glTextureSubImage3D, [](const Version46& c){ return c.TextureSubImage3D == Lazy_glTextureSubImage3D; }); return c.TextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels); }
+	static void APIENTRY Lazy_glCompressedTextureSubImage1D (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void* data){ auto& c = ResolveLazy(Resolve_glCompressedTextureSubImage1D, [](const Version46& c){ return c.CompressedTextureSubImage1D == Lazy_glCompressedTextureSubImage1D; }); return c.CompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data); }
+	static void APIENTRY Lazy_glCompressedTextureSubImage2D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void* data){ auto& c = ResolveLazy(Resolve_glCompressedTextureSubImage2D, [](const Version46& c){ return c.CompressedTextureSubImage2D == Lazy_glCompressedTextureSubImage2D; }); return c.CompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data); }
+	static void APIENTRY Lazy_glCompressedTextureSubImage3D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void* data){ auto& c = ResolveLazy(Resolve_glCompressedTextureSubImage3D, [](const Version46& c){ return c.CompressedTextureSubImage3D == Lazy_glCompressedTextureSubImage3D; }); return c.CompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data); }
+	static void APIENTRY Lazy_glCopyTextureSubImage1D (GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width){ auto& c = ResolveLazy(Resolve_glCopyTextureSubImage1D, [](const Version46& c){ return c.CopyTextureSubImage1D == Lazy_glCopyTextureSubImage1D; }); return c.CopyTextureSubImage1D(texture, level, xoffset, x, y, width); }
+	static void APIENTRY Lazy_glCopyTextureSubImage2D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height){ auto& c = ResolveLazy(Resolve_glCopyTextureSubImage2D, [](const Version46& c){ return c.CopyTextureSubImage2D == Lazy_glCopyTextureSubImage2D; }); return c.CopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height); }
+	static void APIENTRY Lazy_glCopyTextureSubImage3D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height){ auto& c = ResolveLazy(Resolve_glCopyTextureSubImage3D, [](const Version46& c){ return c.CopyTextureSubImage3D == Lazy_glCopyTextureSubImage3D; }); return c.CopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height); }
+	static void APIENTRY Lazy_glTextureParameterf (GLuint texture, GLenum pname, GLfloat param){ auto& c = ResolveLazy(Resolve_glTextureParameterf, [](const Version46& c){ return c.TextureParameterf == Lazy_glTextureParameterf; }); return c.TextureParameterf(texture, pname, param); }
+	static void APIENTRY Lazy_glTextureParameterfv (GLuint texture, GLenum pname, const GLfloat* param){ auto& c = ResolveLazy(Resolve_glTextureParameterfv, [](const Version46& c){ return c.TextureParameterfv == Lazy_glTextureParameterfv; }); return c.TextureParameterfv(texture, pname, param); }
+	static void APIENTRY Lazy_glTextureParameteri (GLuint texture, GLenum pname, GLint param){ auto& c = ResolveLazy(Resolve_glTextureParameteri, [](const Version46& c){ return c.TextureParameteri == Lazy_glTextureParameteri; }); return c.TextureParameteri(texture, pname, param); }
+	static void APIENTRY Lazy_glTextureParameterIiv (GLuint texture, GLenum pname, const GLint* params){ auto& c = ResolveLazy(Resolve_glTextureParameterIiv, [](const Version46& c){ return c.TextureParameterIiv == Lazy_glTextureParameterIiv; }); return c.TextureParameterIiv(texture, pname, params); }
+	static void APIENTRY Lazy_glTextureParameterIuiv (GLuint texture, GLenum pname, const GLuint* params){ auto& c = ResolveLazy(Resolve_glTextureParameterIuiv, [](const Version46& c){ return c.TextureParameterIuiv == Lazy_glTextureParameterIuiv; }); return c.TextureParameterIuiv(texture, pname, params); }
+	static void APIENTRY Lazy_glTextureParameteriv (GLuint texture, GLenum pname, const GLint* param){ auto& c = ResolveLazy(Resolve_glTextureParameteriv, [](const Version46& c){ return c.TextureParameteriv == Lazy_glTextureParameteriv; }); return c.TextureParameteriv(texture, pname, param); }
+	static void APIENTRY Lazy_glGenerateTextureMipmap (GLuint texture){ auto& c = ResolveLazy(Resolve_glGenerateTextureMipmap, [](const Version46& c){ return c.GenerateTextureMipmap == Lazy_glGenerateTextureMipmap; }); return c.GenerateTextureMipmap(texture); }
+	static void APIENTRY Lazy_glBindTextureUnit (GLuint unit, GLuint texture){ auto& c = ResolveLazy(Resolve_glBindTextureUnit, [](const Version46& c){ return c.BindTextureUnit == Lazy_glBindTextureUnit; }); return c.BindTextureUnit(unit, texture); }
+	static void APIENTRY Lazy_glGetTextureImage (GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void* pixels){ auto& c = ResolveLazy(Resolve_glGetTextureImage, [](const Version46& c){ return c.GetTextureImage == Lazy_glGetTextureImage; }); return c.GetTextureImage(texture, level, format, type, bufSize, pixels); }
+	static void APIENTRY Lazy_glGetCompressedTextureImage (GLuint texture, GLint level, GLsizei bufSize, void* pixels){ auto& c = ResolveLazy(Resolve_glGetCompressedTextureImage, [](const Version46& c){ return c.GetCompressedTextureImage == Lazy_glGetCompressedTextureImage; }); return c.GetCompressedTextureImage(texture, level, bufSize, pixels); }
+	static void APIENTRY Lazy_glGetTextureLevelParameterfv (GLuint texture, GLint level, GLenum pname, GLfloat* params){ auto& c = ResolveLazy(Resolve_glGetTextureLevelParameterfv, [](const Version46& c){ return c.GetTextureLevelParameterfv == Lazy_glGetTextureLevelParameterfv; }); return c.GetTextureLevelParameterfv(texture, level, pname, params); }
+	static void APIENTRY Lazy_glGetTextureLevelParameteriv (GLuint texture, GLint level, GLenum pname, GLint* params){ auto& c = ResolveLazy(Resolve_glGetTextureLevelParameteriv, [](const Version46& c){ return c.GetTextureLevelParameteriv == Lazy_glGetTextureLevelParameteriv; }); return c.GetTextureLevelParameteriv(texture, level, pname, params); }
+	static void APIENTRY Lazy_glGetTextureParameterfv (GLuint texture, GLenum pname, GLfloat* params){ auto& c = ResolveLazy(Resolve_glGetTextureParameterfv, [](const Version46& c){ return c.GetTextureParameterfv == Lazy_glGetTextureParameterfv; }); return c.GetTextureParameterfv(texture, pname, params); }
+	static void APIENTRY Lazy_glGetTextureParameterIiv (GLuint texture, GLenum pname, GLint* params){ auto& c = ResolveLazy(Resolve_glGetTextureParameterIiv, [](const Version46& c){ return c.GetTextureParameterIiv == Lazy_glGetTextureParameterIiv; }); return c.GetTextureParameterIiv(texture, pname, params); }
+	static void APIENTRY Lazy_glGetTextureParameterIuiv (GLuint texture, GLenum pname, GLuint* params){ auto& c = ResolveLazy(Resolve_glGetTextureParameterIuiv, [](const Version46& c){ return c.GetTextureParameterIuiv == Lazy_glGetTextureParameterIuiv; }); return c.GetTextureParameterIuiv(texture, pname, params); }
+	static void APIENTRY Lazy_glGetTextureParameteriv (GLuint texture, GLenum pname, GLint* params){ auto& c = ResolveLazy(Resolve_glGetTextureParameteriv, [](const Version46& c){ return c.GetTextureParameteriv == Lazy_glGetTextureParameteriv; }); return c.GetTextureParameteriv(texture, pname, params); }
+	static void APIENTRY Lazy_glCreateVertexArrays (GLsizei n, GLuint* arrays){ auto& c = ResolveLazy(Resolve_glCreateVertexArrays, [](const Version46& c){ return c.CreateVertexArrays == Lazy_glCreateVertexArrays; }); return c.CreateVertexArrays(n, arrays); }
+	static void APIENTRY Lazy_glDisableVertexArrayAttrib (GLuint vaobj, GLuint index){ auto& c = ResolveLazy(Resolve_glDisableVertexArrayAttrib, [](const Version46& c){ return c.DisableVertexArrayAttrib == Lazy_glDisableVertexArrayAttrib; }); return c.DisableVertexArrayAttrib(vaobj, index); }
+	static void APIENTRY Lazy_glEnableVertexArrayAttrib (GLuint vaobj, GLuint index){ auto& c = ResolveLazy(Resolve_glEnableVertexArrayAttrib, [](const Version46& c){ return c.EnableVertexArrayAttrib == Lazy_glEnableVertexArrayAttrib; }); return c.EnableVertexArrayAttrib(vaobj, index); }
+	static void APIENTRY Lazy_glVertexArrayElementBuffer (GLuint vaobj, GLuint buffer){ auto& c = ResolveLazy(Resolve_glVertexArrayElementBuffer, [](const Version46& c){ return c.VertexArrayElementBuffer == Lazy_glVertexArrayElementBuffer; }); return c.VertexArrayElementBuffer(vaobj, buffer); }
+	static void APIENTRY Lazy_glVertexArrayVertexBuffer (GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride){ auto& c = ResolveLazy(Resolve_glVertexArrayVertexBuffer, [](const Version46& c){ return c.VertexArrayVertexBuffer == Lazy_glVertexArrayVertexBuffer; }); return c.VertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride); }
+	static void APIENTRY Lazy_glVertexArrayVertexBuffers (GLuint vaobj, GLuint first, GLsizei count, const GLuint* buffers, const GLintptr* offsets, const GLsizei* strides){ auto& c = ResolveLazy(Resolve_glVertexArrayVertexBuffers, [](const Version46& c){ return c.VertexArrayVertexBuffers == Lazy_glVertexArrayVertexBuffers; }); return c.VertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides); }
+	static void APIENTRY Lazy_glVertexArrayAttribBinding (GLuint vaobj, GLuint attribindex, GLuint bindingindex){ auto& c = ResolveLazy(Resolve_glVertexArrayAttribBinding, [](const Version46& c){ return c.VertexArrayAttribBinding == Lazy_glVertexArrayAttribBinding; }); return c.VertexArrayAttribBinding(vaobj, attribindex, bindingindex); }
+	static void APIENTRY Lazy_glVertexArrayAttribFormat (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset){ auto& c = ResolveLazy(Resolve_glVertexArrayAttribFormat, [](const Version46& c){ return c.VertexArrayAttribFormat == Lazy_glVertexArrayAttribFormat; }); return c.VertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset); }
+	static void APIENTRY Lazy_glVertexArrayAttribIFormat (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset){ auto& c = ResolveLazy(Resolve_glVertexArrayAttribIFormat, [](const Version46& c){ return c.VertexArrayAttribIFormat == Lazy_glVertexArrayAttribIFormat; }); return c.VertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset); }
+	static void APIENTRY Lazy_glVertexArrayAttribLFormat (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset){ auto& c = ResolveLazy(Resolve_glVertexArrayAttribLFormat, [](const Version46& c){ return c.VertexArrayAttribLFormat == Lazy_glVertexArrayAttribLFormat; }); return c.VertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset); }
+	static void APIENTRY Lazy_glVertexArrayBindingDivisor (GLuint vaobj, GLuint bindingindex, GLuint divisor){ auto& c = ResolveLazy(Resolve_glVertexArrayBindingDivisor, [](const Version46& c){ return c.VertexArrayBindingDivisor == Lazy_glVertexArrayBindingDivisor; }); return c.VertexArrayBindingDivisor(vaobj, bindingindex, divisor); }
+	static void APIENTRY Lazy_glGetVertexArrayiv (GLuint vaobj, GLenum pname, GLint* param){ auto& c = ResolveLazy(Resolve_glGetVertexArrayiv, [](const Version46& c){ return c.GetVertexArrayiv == Lazy_glGetVertexArrayiv; }); return c.GetVertexArrayiv(vaobj, pname, param); }
+	static void APIENTRY Lazy_glGetVertexArrayIndexediv (GLuint vaobj, GLuint index, GLenum pname, GLint* param){ auto& c = ResolveLazy(Resolve_glGetVertexArrayIndexediv, [](const Version46& c){ return c.GetVertexArrayIndexediv == Lazy_glGetVertexArrayIndexediv; }); return c.GetVertexArrayIndexediv(vaobj, index, pname, param); }
+	static void APIENTRY Lazy_glGetVertexArrayIndexed64iv (GLuint vaobj, GLuint index, GLenum pname, GLint64* param){ auto& c = ResolveLazy(Resolve_glGetVertexArrayIndexed64iv, [](const Version46& c){ return c.GetVertexArrayIndexed64iv == Lazy_glGetVertexArrayIndexed64iv; }); return c.GetVertexArrayIndexed64iv(vaobj, index, pname, param); }
+	static void APIENTRY Lazy_glCreateSamplers (GLsizei n, GLuint* samplers){ auto& c = ResolveLazy(Resolve_glCreateSamplers, [](const Version46& c){ return c.CreateSamplers == Lazy_glCreateSamplers; }); return c.CreateSamplers(n, samplers); }
+	static void APIENTRY Lazy_glCreateProgramPipelines (GLsizei n, GLuint* pipelines){ auto& c = ResolveLazy(Resolve_glCreateProgramPipelines, [](const Version46& c){ return c.CreateProgramPipelines == Lazy_glCreateProgramPipelines; }); return c.CreateProgramPipelines(n, pipelines); }
+	static void APIENTRY Lazy_glCreateQueries (GLenum target, GLsizei n, GLuint* ids){ auto& c = ResolveLazy(Resolve_glCreateQueries, [](const Version46& c){ return c.CreateQueries == Lazy_glCreateQueries; }); return c.CreateQueries(target, n, ids); }
+	static void APIENTRY Lazy_glGetQueryBufferObjecti64v (GLuint id, GLuint buffer, GLenum pname, GLintptr offset){ auto& c = ResolveLazy(Resolve_glGetQueryBufferObjecti64v, [](const Version46& c){ return c.GetQueryBufferObjecti64v == Lazy_glGetQueryBufferObjecti64v; }); return c.GetQueryBufferObjecti64v(id, buffer, pname, offset); }
+	static void APIENTRY Lazy_glGetQueryBufferObjectiv (GLuint id, GLuint buffer, GLenum pname, GLintptr offset){ auto& c = ResolveLazy(Resolve_glGetQueryBufferObjectiv, [](const Version46& c){ return c.GetQueryBufferObjectiv == Lazy_glGetQueryBufferObjectiv; }); return c.GetQueryBufferObjectiv(id, buffer, pname, offset); }
+	static void APIENTRY Lazy_glGetQueryBufferObjectui64v (GLuint id, GLuint buffer, GLenum pname, GLintptr offset){ auto& c = ResolveLazy(Resolve_glGetQueryBufferObjectui64v, [](const Version46& c){ return c.GetQueryBufferObjectui64v == Lazy_glGetQueryBufferObjectui64v; }); return c.GetQueryBufferObjectui64v(id, buffer, pname, offset); }
+	static void APIENTRY Lazy_glGetQueryBufferObjectuiv (GLuint id, GLuint buffer, GLenum pname, GLintptr offset){ auto& c = ResolveLazy(Resolve_glGetQueryBufferObjectuiv, [](const Version46& c){ return c.GetQueryBufferObjectuiv == Lazy_glGetQueryBufferObjectuiv; }); return c.GetQueryBufferObjectuiv(id, buffer, pname, offset); }
+	static void APIENTRY Lazy_glMemoryBarrierByRegion (GLbitfield barriers){ auto& c = ResolveLazy(Resolve_glMemoryBarrierByRegion, [](const Version46& c){ return c.MemoryBarrierByRegion == Lazy_glMemoryBarrierByRegion; }); return c.MemoryBarrierByRegion(barriers); }
+	static void APIENTRY Lazy_glGetTextureSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void* pixels){ auto& c = ResolveLazy(Resolve_glGetTextureSubImage, [](const Version46& c){ return c.GetTextureSubImage == Lazy_glGetTextureSubImage; }); return c.GetTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels); }
+	static void APIENTRY Lazy_glGetCompressedTextureSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void* pixels){ auto& c = ResolveLazy(Resolve_glGetCompressedTextureSubImage, [](const Version46& c){ return c.GetCompressedTextureSubImage == Lazy_glGetCompressedTextureSubImage; }); return c.GetCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels); }
+	static GLenum APIENTRY Lazy_glGetGraphicsResetStatus (void){ auto& c = ResolveLazy(Resolve_glGetGraphicsResetStatus, [](const Version46& c){ return c.GetGraphicsResetStatus == Lazy_glGetGraphicsResetStatus; }); return c.GetGraphicsResetStatus(); }
+	static void APIENTRY Lazy_glGetnCompressedTexImage (GLenum target, GLint lod, GLsizei bufSize, void* pixels){ auto& c = ResolveLazy(Resolve_glGetnCompressedTexImage, [](const Version46& c){ return c.GetnCompressedTexImage == Lazy_glGetnCompressedTexImage; }); return c.GetnCompressedTexImage(target, lod, bufSize, pixels); }
+	static void APIENTRY Lazy_glGetnTexImage (GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void* pixels){ auto& c = ResolveLazy(Resolve_glGetnTexImage, [](const Version46& c){ return c.GetnTexImage == Lazy_glGetnTexImage; }); return c.GetnTexImage(target, level, format, type, bufSize, pixels); }
+	static void APIENTRY Lazy_glGetnUniformdv (GLuint program, GLint location, GLsizei bufSize, GLdouble* params){ auto& c = ResolveLazy(Resolve_glGetnUniformdv, [](const Version46& c){ return c.GetnUniformdv == Lazy_glGetnUniformdv; }); return c.GetnUniformdv(program, location, bufSize, params); }
+	static void APIENTRY Lazy_glGetnUniformfv (GLuint program, GLint location, GLsizei bufSize, GLfloat* params){ auto& c = ResolveLazy(Resolve_glGetnUniformfv, [](const Version46& c){ return c.GetnUniformfv == Lazy_glGetnUniformfv; }); return c.GetnUniformfv(program, location, bufSize, params); }
+	static void APIENTRY Lazy_glGetnUniformiv (GLuint program, GLint location, GLsizei bufSize, GLint* params){ auto& c = ResolveLazy(Resolve_glGetnUniformiv, [](const Version46& c){ return c.GetnUniformiv == Lazy_glGetnUniformiv; }); return c.GetnUniformiv(program, location, bufSize, params); }
+	static void APIENTRY Lazy_glGetnUniformuiv (GLuint program, GLint location, GLsizei bufSize, GLuint* params){ auto& c = ResolveLazy(Resolve_glGetnUniformuiv, [](const Version46& c){ return c.GetnUniformuiv == Lazy_glGetnUniformuiv; }); return c.GetnUniformuiv(program, location, bufSize, params); }
+	static void APIENTRY Lazy_glReadnPixels (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void* data){ auto& c = ResolveLazy(Resolve_glReadnPixels, [](const Version46& c){ return c.ReadnPixels == Lazy_glReadnPixels; }); return c.ReadnPixels(x, y, width, height, format, type, bufSize, data); }
+	static void APIENTRY Lazy_glGetnMapdv (GLenum target, GLenum query, GLsizei bufSize, GLdouble* v){ auto& c = ResolveLazy(Resolve_glGetnMapdv, [](const Version46& c){ return c.GetnMapdv == Lazy_glGetnMapdv; }); return c.GetnMapdv(target, query, bufSize, v); }
+	static void APIENTRY Lazy_glGetnMapfv (GLenum target, GLenum query, GLsizei bufSize, GLfloat* v){ auto& c = ResolveLazy(Resolve_glGetnMapfv, [](const Version46& c){ return c.GetnMapfv == Lazy_glGetnMapfv; }); return c.GetnMapfv(target, query, bufSize, v); }
+	static void APIENTRY Lazy_glGetnMapiv (GLenum target, GLenum query, GLsizei bufSize, GLint* v){ auto& c = ResolveLazy(Resolve_glGetnMapiv, [](const Version46& c){ return c.GetnMapiv == Lazy_glGetnMapiv; }); return c.GetnMapiv(target, query, bufSize, v); }
+	static void APIENTRY Lazy_glGetnPixelMapfv (GLenum map, GLsizei bufSize, GLfloat* values){ auto& c = ResolveLazy(Resolve_glGetnPixelMapfv, [](const Version46& c){ return c.GetnPixelMapfv == Lazy_glGetnPixelMapfv; }); return c.GetnPixelMapfv(map, bufSize, values); }
+	static void APIENTRY Lazy_glGetnPixelMapuiv (GLenum map, GLsizei bufSize, GLuint* values){ auto& c = ResolveLazy(Resolve_glGetnPixelMapuiv, [](const Version46& c){ return c.GetnPixelMapuiv == Lazy_glGetnPixelMapuiv; }); return c.GetnPixelMapuiv(map, bufSize, values); }
+	static void APIENTRY Lazy_glGetnPixelMapusv (GLenum map, GLsizei bufSize, GLushort* values){ auto& c = ResolveLazy(Resolve_glGetnPixelMapusv, [](const Version46& c){ return c.GetnPixelMapusv == Lazy_glGetnPixelMapusv; }); return c.GetnPixelMapusv(map, bufSize, values); }
+	static void APIENTRY Lazy_glGetnPolygonStipple (GLsizei bufSize, GLubyte* pattern){ auto& c = ResolveLazy(Resolve_glGetnPolygonStipple, [](const Version46& c){ return c.GetnPolygonStipple == Lazy_glGetnPolygonStipple; }); return c.GetnPolygonStipple(bufSize, pattern); }
+	static void APIENTRY Lazy_glGetnColorTable (GLenum target, GLenum format, GLenum type, GLsizei bufSize, void* table){ auto& c = ResolveLazy(Resolve_glGetnColorTable, [](const Version46& c){ return c.GetnColorTable == Lazy_glGetnColorTable; }); return c.GetnColorTable(target, format, type, bufSize, table); }
+	static void APIENTRY Lazy_glGetnConvolutionFilter (GLenum target, GLenum format, GLenum type, GLsizei bufSize, void* image){ auto& c = ResolveLazy(Resolve_glGetnConvolutionFilter, [](const Version46& c){ return c.GetnConvolutionFilter == Lazy_glGetnConvolutionFilter; }); return c.GetnConvolutionFilter(target, format, type, bufSize, image); }
+	static void APIENTRY Lazy_glGetnSeparableFilter (GLenum target, GLenum format, GLenum type, GLsizei rowBufSize, void* row, GLsizei columnBufSize, void* column, void* span){ auto& c = ResolveLazy(Resolve_glGetnSeparableFilter, [](const Version46& c){ return c.GetnSeparableFilter == Lazy_glGetnSeparableFilter; }); return c.GetnSeparableFilter(target, format, type, rowBufSize, row, columnBufSize, column, span); }
+	static void APIENTRY Lazy_glGetnHistogram (GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void* values){ auto& c = ResolveLazy(Resolve_glGetnHistogram, [](const Version46& c){ return c.GetnHistogram == Lazy_glGetnHistogram; }); return c.GetnHistogram(target, reset, format, type, bufSize, values); }
+	static void APIENTRY Lazy_glGetnMinmax (GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void* values){ auto& c = ResolveLazy(Resolve_glGetnMinmax, [](const Version46& c){ return c.GetnMinmax == Lazy_glGetnMinmax; }); return c.GetnMinmax(target, reset, format, type, bufSize, values); }
+	static void APIENTRY Lazy_glTextureBarrier (void){ auto& c = ResolveLazy(Resolve_glTextureBarrier, [](const Version46& c){ return c.TextureBarrier == Lazy_glTextureBarrier; }); return c.TextureBarrier(); }
+	Version45::Version45(Func_GetProcAddress GetProcAddress, LoadMode Mode):
+		Version44(GetProcAddress, Mode),
+		ClipControl(GetProc<PFNGLCLIPCONTROLPROC>("glClipControl", Null_glClipControl, Lazy_glClipControl)),
+		CreateTransformFeedbacks(GetProc<PFNGLCREATETRANSFORMFEEDBACKSPROC>("glCreateTransformFeedbacks", Null_glCreateTransformFeedbacks, Lazy_glCreateTransformFeedbacks)),
+		TransformFeedbackBufferBase(GetProc<PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC>("glTransformFeedbackBufferBase", Null_glTransformFeedbackBufferBase, Lazy_glTransformFeedbackBufferBase)),
+		TransformFeedbackBufferRange(GetProc<PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC>("glTransformFeedbackBufferRange", Null_glTransformFeedbackBufferRange, Lazy_glTransformFeedbackBufferRange)),
+		GetTransformFeedbackiv(GetProc<PFNGLGETTRANSFORMFEEDBACKIVPROC>("glGetTransformFeedbackiv", Null_glGetTransformFeedbackiv, Lazy_glGetTransformFeedbackiv)),
+		GetTransformFeedbacki_v(GetProc<PFNGLGETTRANSFORMFEEDBACKI_VPROC>("glGetTransformFeedbacki_v", Null_glGetTransformFeedbacki_v, Lazy_glGetTransformFeedbacki_v)),
+		GetTransformFeedbacki64_v(GetProc<PFNGLGETTRANSFORMFEEDBACKI64_VPROC>("glGetTransformFeedbacki64_v", Null_glGetTransformFeedbacki64_v, Lazy_glGetTransformFeedbacki64_v)),
+		CreateBuffers(GetProc<PFNGLCREATEBUFFERSPROC>("glCreateBuffers", Null_glCreateBuffers, Lazy_glCreateBuffers)),
+		NamedBufferStorage(GetProc<PFNGLNAMEDBUFFERSTORAGEPROC>("glNamedBufferStorage", Null_glNamedBufferStorage, Lazy_glNamedBufferStorage)),
+		NamedBufferData(GetProc<PFNGLNAMEDBUFFERDATAPROC>("glNamedBufferData", Null_glNamedBufferData, Lazy_glNamedBufferData)),
+		NamedBufferSubData(GetProc<PFNGLNAMEDBUFFERSUBDATAPROC>("glNamedBufferSubData", Null_glNamedBufferSubData, Lazy_glNamedBufferSubData)),
+		CopyNamedBufferSubData(GetProc<PFNGLCOPYNAMEDBUFFERSUBDATAPROC>("glCopyNamedBufferSubData", Null_glCopyNamedBufferSubData, Lazy_glCopyNamedBufferSubData)),
+		ClearNamedBufferData(GetProc<PFNGLCLEARNAMEDBUFFERDATAPROC>("glClearNamedBufferData", Null_glClearNamedBufferData, Lazy_glClearNamedBufferData)),
+		ClearNamedBufferSubData(GetProc<PFNGLCLEARNAMEDBUFFERSUBDATAPROC>("glClearNamedBufferSubData", Null_glClearNamedBufferSubData, Lazy_glClearNamedBufferSubData)),
+		MapNamedBuffer(GetProc<PFNGLMAPNAMEDBUFFERPROC>("glMapNamedBuffer", Null_glMapNamedBuffer, Lazy_glMapNamedBuffer)),
+		MapNamedBufferRange(GetProc<PFNGLMAPNAMEDBUFFERRANGEPROC>("glMapNamedBufferRange", Null_glMapNamedBufferRange, Lazy_glMapNamedBufferRange)),
+		UnmapNamedBuffer(GetProc<PFNGLUNMAPNAMEDBUFFERPROC>("glUnmapNamedBuffer", Null_glUnmapNamedBuffer, Lazy_glUnmapNamedBuffer)),
+		FlushMappedNamedBufferRange(GetProc<PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC>("glFlushMappedNamedBufferRange", Null_glFlushMappedNamedBufferRange, Lazy_glFlushMappedNamedBufferRange)),
+		GetNamedBufferParameteriv(GetProc<PFNGLGETNAMEDBUFFERPARAMETERIVPROC>("glGetNamedBufferParameteriv", Null_glGetNamedBufferParameteriv, Lazy_glGetNamedBufferParameteriv)),
+		GetNamedBufferParameteri64v(GetProc<PFNGLGETNAMEDBUFFERPARAMETERI64VPROC>("glGetNamedBufferParameteri64v", Null_glGetNamedBufferParameteri64v, Lazy_glGetNamedBufferParameteri64v)),
+		GetNamedBufferPointerv(GetProc<PFNGLGETNAMEDBUFFERPOINTERVPROC>("glGetNamedBufferPointerv", Null_glGetNamedBufferPointerv, Lazy_glGetNamedBufferPointerv)),
+		GetNamedBufferSubData(GetProc<PFNGLGETNAMEDBUFFERSUBDATAPROC>("glGetNamedBufferSubData", Null_glGetNamedBufferSubData, Lazy_glGetNamedBufferSubData)),
+		CreateFramebuffers(GetProc<PFNGLCREATEFRAMEBUFFERSPROC>("glCreateFramebuffers", Null_glCreateFramebuffers, Lazy_glCreateFramebuffers)),
+		NamedFramebufferRenderbuffer(GetProc<PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC>("glNamedFramebufferRenderbuffer", Null_glNamedFramebufferRenderbuffer, Lazy_glNamedFramebufferRenderbuffer)),
+		NamedFramebufferParameteri(GetProc<PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC>("glNamedFramebufferParameteri", Null_glNamedFramebufferParameteri, Lazy_glNamedFramebufferParameteri)),
+		NamedFramebufferTexture(GetProc<PFNGLNAMEDFRAMEBUFFERTEXTUREPROC>("glNamedFramebufferTexture", Null_glNamedFramebufferTexture, Lazy_glNamedFramebufferTexture)),
+		NamedFramebufferTextureLayer(GetProc<PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC>("glNamedFramebufferTextureLayer", Null_glNamedFramebufferTextureLayer, Lazy_glNamedFramebufferTextureLayer)),
+		NamedFramebufferDrawBuffer(GetProc<PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC>("glNamedFramebufferDrawBuffer", Null_glNamedFramebufferDrawBuffer, Lazy_glNamedFramebufferDrawBuffer)),
+		NamedFramebufferDrawBuffers(GetProc<PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC>("glNamedFramebufferDrawBuffers", Null_glNamedFramebufferDrawBuffers, Lazy_glNamedFramebufferDrawBuffers)),
+		NamedFramebufferReadBuffer(GetProc<PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC>("glNamedFramebufferReadBuffer", Null_glNamedFramebufferReadBuffer, Lazy_glNamedFramebufferReadBuffer)),
+		InvalidateNamedFramebufferData(GetProc<PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC>("glInvalidateNamedFramebufferData", Null_glInvalidateNamedFramebufferData, Lazy_glInvalidateNamedFramebufferData)),
+		InvalidateNamedFramebufferSubData(GetProc<PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC>("glInvalidateNamedFramebufferSubData", Null_glInvalidateNamedFramebufferSubData, Lazy_glInvalidateNamedFramebufferSubData)),
+		ClearNamedFramebufferiv(GetProc<PFNGLCLEARNAMEDFRAMEBUFFERIVPROC>("glClearNamedFramebufferiv", Null_glClearNamedFramebufferiv, Lazy_glClearNamedFramebufferiv)),
+		ClearNamedFramebufferuiv(GetProc<PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC>("glClearNamedFramebufferuiv", Null_glClearNamedFramebufferuiv, Lazy_glClearNamedFramebufferuiv)),
+		ClearNamedFramebufferfv(GetProc<PFNGLCLEARNAMEDFRAMEBUFFERFVPROC>("glClearNamedFramebufferfv", Null_glClearNamedFramebufferfv, Lazy_glClearNamedFramebufferfv)),
+		ClearNamedFramebufferfi(GetProc<PFNGLCLEARNAMEDFRAMEBUFFERFIPROC>("glClearNamedFramebufferfi", Null_glClearNamedFramebufferfi, Lazy_glClearNamedFramebufferfi)),
+		BlitNamedFramebuffer(GetProc<PFNGLBLITNAMEDFRAMEBUFFERPROC>("glBlitNamedFramebuffer", Null_glBlitNamedFramebuffer, Lazy_glBlitNamedFramebuffer)),
+		CheckNamedFramebufferStatus(GetProc<PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC>("glCheckNamedFramebufferStatus", Null_glCheckNamedFramebufferStatus, Lazy_glCheckNamedFramebufferStatus)),
+		GetNamedFramebufferParameteriv(GetProc<PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC>("glGetNamedFramebufferParameteriv", Null_glGetNamedFramebufferParameteriv, Lazy_glGetNamedFramebufferParameteriv)),
+		GetNamedFramebufferAttachmentParameteriv(GetProc<PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC>("glGetNamedFramebufferAttachmentParameteriv", Null_glGetNamedFramebufferAttachmentParameteriv, Lazy_glGetNamedFramebufferAttachmentParameteriv)),
+		CreateRenderbuffers(GetProc<PFNGLCREATERENDERBUFFERSPROC>("glCreateRenderbuffers", Null_glCreateRenderbuffers, Lazy_glCreateRenderbuffers)),
+		NamedRenderbufferStorage(GetProc<PFNGLNAMEDRENDERBUFFERSTORAGEPROC>("glNamedRenderbufferStorage", Null_glNamedRenderbufferStorage, Lazy_glNamedRenderbufferStorage)),
+		NamedRenderbufferStorageMultisample(GetProc<PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC>("glNamedRenderbufferStorageMultisample", Null_glNamedRenderbufferStorageMultisample, Lazy_glNamedRenderbufferStorageMultisample)),
+		GetNamedRenderbufferParameteriv(GetProc<PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC>("glGetNamedRenderbufferParameteriv", Null_glGetNamedRenderbufferParameteriv, Lazy_glGetNamedRenderbufferParameteriv)),
+		CreateTextures(GetProc<PFNGLCREATETEXTURESPROC>("glCreateTextures", Null_glCreateTextures, Lazy_glCreateTextures)),
+		TextureBuffer(GetProc<PFNGLTEXTUREBUFFERPROC>("glTextureBuffer", Null_glTextureBuffer, Lazy_glTextureBuffer)),
+		TextureBufferRange(GetProc<PFNGLTEXTUREBUFFERRANGEPROC>("glTextureBufferRange", Null_glTextureBufferRange, Lazy_glTextureBufferRange)),
+		TextureStorage1D(GetProc<PFNGLTEXTURESTORAGE1DPROC>("glTextureStorage1D", Null_glTextureStorage1D, Lazy_glTextureStorage1D)),
+		TextureStorage2D(GetProc<PFNGLTEXTURESTORAGE2DPROC>("glTextureStorage2D", Null_glTextureStorage2D, Lazy_glTextureStorage2D)),
+		TextureStorage3D(GetProc<PFNGLTEXTURESTORAGE3DPROC>("glTextureStorage3D", Null_glTextureStorage3D, Lazy_glTextureStorage3D)),
+		TextureStorage2DMultisample(GetProc<PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC>("glTextureStorage2DMultisample", Null_glTextureStorage2DMultisample, Lazy_glTextureStorage2DMultisample)),
+		TextureStorage3DMultisample(GetProc<PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC>("glTextureStorage3DMultisample", Null_glTextureStorage3DMultisample, Lazy_glTextureStorage3DMultisample)),
+		TextureSubImage1D(GetProc<PFNGLTEXTURESUBIMAGE1DPROC>("glTextureSubImage1D", Null_glTextureSubImage1D, Lazy_glTextureSubImage1D)),
+		TextureSubImage2D(GetProc<PFNGLTEXTURESUBIMAGE2DPROC>("glTextureSubImage2D", Null_glTextureSubImage2D, Lazy_glTextureSubImage2D)),
+		TextureSubImage3D(GetProc<PFNGLTEXTURESUBIMAGE3DPROC>("glTextureSubImage3D", Null_glTextureSubImage3D, Lazy_glTextureSubImage3D)),
+		CompressedTextureSubImage1D(GetProc<PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC>("glCompressedTextureSubImage1D", Null_glCompressedTextureSubImage1D, Lazy_glCompressedTextureSubImage1D)),
+		CompressedTextureSubImage2D(GetProc<PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC>("glCompressedTextureSubImage2D", Null_glCompressedTextureSubImage2D, Lazy_glCompressedTextureSubImage2D)),
+		CompressedTextureSubImage3D(GetProc<PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC>("glCompressedTextureSubImage3D", Null_glCompressedTextureSubImage3D, Lazy_glCompressedTextureSubImage3D)),
+		CopyTextureSubImage1D(GetProc<PFNGLCOPYTEXTURESUBIMAGE1DPROC>("glCopyTextureSubImage1D", Null_glCopyTextureSubImage1D, Lazy_glCopyTextureSubImage1D)),
+		CopyTextureSubImage2D(GetProc<PFNGLCOPYTEXTURESUBIMAGE2DPROC>("glCopyTextureSubImage2D", Null_glCopyTextureSubImage2D, Lazy_glCopyTextureSubImage2D)),
+		CopyTextureSubImage3D(GetProc<PFNGLCOPYTEXTURESUBIMAGE3DPROC>("glCopyTextureSubImage3D", Null_glCopyTextureSubImage3D, Lazy_glCopyTextureSubImage3D)),
+		TextureParameterf(GetProc<PFNGLTEXTUREPARAMETERFPROC>("glTextureParameterf", Null_glTextureParameterf, Lazy_glTextureParameterf)),
+		TextureParameterfv(GetProc<PFNGLTEXTUREPARAMETERFVPROC>("glTextureParameterfv", Null_glTextureParameterfv, Lazy_glTextureParameterfv)),
+		TextureParameteri(GetProc<PFNGLTEXTUREPARAMETERIPROC>("glTextureParameteri", Null_glTextureParameteri, Lazy_glTextureParameteri)),
+		TextureParameterIiv(GetProc<PFNGLTEXTUREPARAMETERIIVPROC>("glTextureParameterIiv", Null_glTextureParameterIiv, Lazy_glTextureParameterIiv)),
+		TextureParameterIuiv(GetProc<PFNGLTEXTUREPARAMETERIUIVPROC>("glTextureParameterIuiv", Null_glTextureParameterIuiv, Lazy_glTextureParameterIuiv)),
+		TextureParameteriv(GetProc<PFNGLTEXTUREPARAMETERIVPROC>("glTextureParameteriv", Null_glTextureParameteriv, Lazy_glTextureParameteriv)),
+		GenerateTextureMipmap(GetProc<PFNGLGENERATETEXTUREMIPMAPPROC>("glGenerateTextureMipmap", Null_glGenerateTextureMipmap, Lazy_glGenerateTextureMipmap)),
+		BindTextureUnit(GetProc<PFNGLBINDTEXTUREUNITPROC>("glBindTextureUnit", Null_glBindTextureUnit, Lazy_glBindTextureUnit)),
+		GetTextureImage(GetProc<PFNGLGETTEXTUREIMAGEPROC>("glGetTextureImage", Null_glGetTextureImage, Lazy_glGetTextureImage)),
+		GetCompressedTextureImage(GetProc<PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC>("glGetCompressedTextureImage", Null_glGetCompressedTextureImage, Lazy_glGetCompressedTextureImage)),
+		GetTextureLevelParameterfv(GetProc<PFNGLGETTEXTURELEVELPARAMETERFVPROC>("glGetTextureLevelParameterfv", Null_glGetTextureLevelParameterfv, Lazy_glGetTextureLevelParameterfv)),
+		GetTextureLevelParameteriv(GetProc<PFNGLGETTEXTURELEVELPARAMETERIVPROC>("glGetTextureLevelParameteriv", Null_glGetTextureLevelParameteriv, Lazy_glGetTextureLevelParameteriv)),
+		GetTextureParameterfv(GetProc<PFNGLGETTEXTUREPARAMETERFVPROC>("glGetTextureParameterfv", Null_glGetTextureParameterfv, Lazy_glGetTextureParameterfv)),
+		GetTextureParameterIiv(GetProc<PFNGLGETTEXTUREPARAMETERIIVPROC>("glGetTextureParameterIiv", Null_glGetTextureParameterIiv, Lazy_glGetTextureParameterIiv)),
+		GetTextureParameterIuiv(GetProc<PFNGLGETTEXTUREPARAMETERIUIVPROC>("glGetTextureParameterIuiv", Null_glGetTextureParameterIuiv, Lazy_glGetTextureParameterIuiv)),
+		GetTextureParameteriv(GetProc<PFNGLGETTEXTUREPARAMETERIVPROC>("glGetTextureParameteriv", Null_glGetTextureParameteriv, Lazy_glGetTextureParameteriv)),
+		CreateVertexArrays(GetProc<PFNGLCREATEVERTEXARRAYSPROC>("glCreateVertexArrays", Null_glCreateVertexArrays, Lazy_glCreateVertexArrays)),
+		DisableVertexArrayAttrib(GetProc<PFNGLDISABLEVERTEXARRAYATTRIBPROC>("glDisableVertexArrayAttrib", Null_glDisableVertexArrayAttrib, Lazy_glDisableVertexArrayAttrib)),
+		EnableVertexArrayAttrib(GetProc<PFNGLENABLEVERTEXARRAYATTRIBPROC>("glEnableVertexArrayAttrib", Null_glEnableVertexArrayAttrib, Lazy_glEnableVertexArrayAttrib)),
+		VertexArrayElementBuffer(GetProc<PFNGLVERTEXARRAYELEMENTBUFFERPROC>("glVertexArrayElementBuffer", Null_glVertexArrayElementBuffer, Lazy_glVertexArrayElementBuffer)),
+		VertexArrayVertexBuffer(GetProc<PFNGLVERTEXARRAYVERTEXBUFFERPROC>("glVertexArrayVertexBuffer", Null_glVertexArrayVertexBuffer, Lazy_glVertexArrayVertexBuffer)),
+		VertexArrayVertexBuffers(GetProc<PFNGLVERTEXARRAYVERTEXBUFFERSPROC>("glVertexArrayVertexBuffers", Null_glVertexArrayVertexBuffers, Lazy_glVertexArrayVertexBuffers)),
+		VertexArrayAttribBinding(GetProc<PFNGLVERTEXARRAYATTRIBBINDINGPROC>("glVertexArrayAttribBinding", Null_glVertexArrayAttribBinding, Lazy_glVertexArrayAttribBinding)),
+		VertexArrayAttribFormat(GetProc<PFNGLVERTEXARRAYATTRIBFORMATPROC>("glVertexArrayAttribFormat", Null_glVertexArrayAttribFormat, Lazy_glVertexArrayAttribFormat)),
+		VertexArrayAttribIFormat(GetProc<PFNGLVERTEXARRAYATTRIBIFORMATPROC>("glVertexArrayAttribIFormat", Null_glVertexArrayAttribIFormat, Lazy_glVertexArrayAttribIFormat)),
+		VertexArrayAttribLFormat(GetProc<PFNGLVERTEXARRAYATTRIBLFORMATPROC>("glVertexArrayAttribLFormat", Null_glVertexArrayAttribLFormat, Lazy_glVertexArrayAttribLFormat)),
+		VertexArrayBindingDivisor(GetProc<PFNGLVERTEXARRAYBINDINGDIVISORPROC>("glVertexArrayBindingDivisor", Null_glVertexArrayBindingDivisor, Lazy_glVertexArrayBindingDivisor)),
+		GetVertexArrayiv(GetProc<PFNGLGETVERTEXARRAYIVPROC>("glGetVertexArrayiv", Null_glGetVertexArrayiv, Lazy_glGetVertexArrayiv)),
+		GetVertexArrayIndexediv(GetProc<PFNGLGETVERTEXARRAYINDEXEDIVPROC>("glGetVertexArrayIndexediv", Null_glGetVertexArrayIndexediv, Lazy_glGetVertexArrayIndexediv)),
+		GetVertexArrayIndexed64iv(GetProc<PFNGLGETVERTEXARRAYINDEXED64IVPROC>("glGetVertexArrayIndexed64iv", Null_glGetVertexArrayIndexed64iv, Lazy_glGetVertexArrayIndexed64iv)),
+		CreateSamplers(GetProc<PFNGLCREATESAMPLERSPROC>("glCreateSamplers", Null_glCreateSamplers, Lazy_glCreateSamplers)),
+		CreateProgramPipelines(GetProc<PFNGLCREATEPROGRAMPIPELINESPROC>("glCreateProgramPipelines", Null_glCreateProgramPipelines, Lazy_glCreateProgramPipelines)),
+		CreateQueries(GetProc<PFNGLCREATEQUERIESPROC>("glCreateQueries", Null_glCreateQueries, Lazy_glCreateQueries)),
+		GetQueryBufferObjecti64v(GetProc<PFNGLGETQUERYBUFFEROBJECTI64VPROC>("glGetQueryBufferObjecti64v", Null_glGetQueryBufferObjecti64v, Lazy_glGetQueryBufferObjecti64v)),
+		GetQueryBufferObjectiv(GetProc<PFNGLGETQUERYBUFFEROBJECTIVPROC>("glGetQueryBufferObjectiv", Null_glGetQueryBufferObjectiv, Lazy_glGetQueryBufferObjectiv)),
+		GetQueryBufferObjectui64v(GetProc<PFNGLGETQUERYBUFFEROBJECTUI64VPROC>("glGetQueryBufferObjectui64v", Null_glGetQueryBufferObjectui64v, Lazy_glGetQueryBufferObjectui64v)),
+		GetQueryBufferObjectuiv(GetProc<PFNGLGETQUERYBUFFEROBJECTUIVPROC>("glGetQueryBufferObjectuiv", Null_glGetQueryBufferObjectuiv, Lazy_glGetQueryBufferObjectuiv)),
+		MemoryBarrierByRegion(GetProc<PFNGLMEMORYBARRIERBYREGIONPROC>("glMemoryBarrierByRegion", Null_glMemoryBarrierByRegion, Lazy_glMemoryBarrierByRegion)),
+		GetTextureSubImage(GetProc<PFNGLGETTEXTURESUBIMAGEPROC>("glGetTextureSubImage", Null_glGetTextureSubImage, Lazy_glGetTextureSubImage)),
+		GetCompressedTextureSubImage(GetProc<PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC>("glGetCompressedTextureSubImage", Null_glGetCompressedTextureSubImage, Lazy_glGetCompressedTextureSubImage)),
+		GetGraphicsResetStatus(GetProc<PFNGLGETGRAPHICSRESETSTATUSPROC>("glGetGraphicsResetStatus", Null_glGetGraphicsResetStatus, Lazy_glGetGraphicsResetStatus)),
+		GetnCompressedTexImage(GetProc<PFNGLGETNCOMPRESSEDTEXIMAGEPROC>("glGetnCompressedTexImage", Null_glGetnCompressedTexImage, Lazy_glGetnCompressedTexImage)),
+		GetnTexImage(GetProc<PFNGLGETNTEXIMAGEPROC>("glGetnTexImage", Null_glGetnTexImage, Lazy_glGetnTexImage)),
+		GetnUniformdv(GetProc<PFNGLGETNUNIFORMDVPROC>("glGetnUniformdv", Null_glGetnUniformdv, Lazy_glGetnUniformdv)),
+		GetnUniformfv(GetProc<PFNGLGETNUNIFORMFVPROC>("glGetnUniformfv", Null_glGetnUniformfv, Lazy_glGetnUniformfv)),
+		GetnUniformiv(GetProc<PFNGLGETNUNIFORMIVPROC>("glGetnUniformiv", Null_glGetnUniformiv, Lazy_glGetnUniformiv)),
+		GetnUniformuiv(GetProc<PFNGLGETNUNIFORMUIVPROC>("glGetnUniformuiv", Null_glGetnUniformuiv, Lazy_glGetnUniformuiv)),
+		ReadnPixels(GetProc<PFNGLREADNPIXELSPROC>("glReadnPixels", Null_glReadnPixels, Lazy_glReadnPixels)),
+		GetnMapdv(GetProc<PFNGLGETNMAPDVPROC>("glGetnMapdv", Null_glGetnMapdv, Lazy_glGetnMapdv)),
+		GetnMapfv(GetProc<PFNGLGETNMAPFVPROC>("glGetnMapfv", Null_glGetnMapfv, Lazy_glGetnMapfv)),
+		GetnMapiv(GetProc<PFNGLGETNMAPIVPROC>("glGetnMapiv", Null_glGetnMapiv, Lazy_glGetnMapiv)),
+		GetnPixelMapfv(GetProc<PFNGLGETNPIXELMAPFVPROC>("glGetnPixelMapfv", Null_glGetnPixelMapfv, Lazy_glGetnPixelMapfv)),
+		GetnPixelMapuiv(GetProc<PFNGLGETNPIXELMAPUIVPROC>("glGetnPixelMapuiv", Null_glGetnPixelMapuiv, Lazy_glGetnPixelMapuiv)),
+		GetnPixelMapusv(GetProc<PFNGLGETNPIXELMAPUSVPROC>("glGetnPixelMapusv", Null_glGetnPixelMapusv, Lazy_glGetnPixelMapusv)),
+		GetnPolygonStipple(GetProc<PFNGLGETNPOLYGONSTIPPLEPROC>("glGetnPolygonStipple", Null_glGetnPolygonStipple, Lazy_glGetnPolygonStipple)),
+		GetnColorTable(GetProc<PFNGLGETNCOLORTABLEPROC>("glGetnColorTable", Null_glGetnColorTable, Lazy_glGetnColorTable)),
+		GetnConvolutionFilter(GetProc<PFNGLGETNCONVOLUTIONFILTERPROC>("glGetnConvolutionFilter", Null_glGetnConvolutionFilter, Lazy_glGetnConvolutionFilter)),
+		GetnSeparableFilter(GetProc<PFNGLGETNSEPARABLEFILTERPROC>("glGetnSeparableFilter", Null_glGetnSeparableFilter, Lazy_glGetnSeparableFilter)),
+		GetnHistogram(GetProc<PFNGLGETNHISTOGRAMPROC>("glGetnHistogram", Null_glGetnHistogram, Lazy_glGetnHistogram)),
+		GetnMinmax(GetProc<PFNGLGETNMINMAXPROC>("glGetnMinmax", Null_glGetnMinmax, Lazy_glGetnMinmax)),
+		TextureBarrier(GetProc<PFNGLTEXTUREBARRIERPROC>("glTextureBarrier", Null_glTextureBarrier, Lazy_glTextureBarrier))
 	{
 		Available = Ver_Major > 4 || (Ver_Major == 4 && (Ver_Minor > 5 || (Ver_Minor == 5 && Ver_Release >= 0)));
 	}
 
+	Version45::Version45(Func_GetProcAddress GetProcAddress):
+		Version45(GetProcAddress, LoadMode::Eager)
+	{
+	}
+
 
 	static void APIENTRY Null_glSpecializeShader (GLuint shader, const GLchar* pEntryPoint, GLuint numSpecializationConstants, const GLuint* pConstantIndex, const GLuint* pConstantValue){ NullFuncPtr(); }
 	static void APIENTRY Null_glMultiDrawArraysIndirectCount (GLenum mode, const void* indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride){ NullFuncPtr(); }
 	static void APIENTRY Null_glMultiDrawElementsIndirectCount (GLenum mode, GLenum type, const void* indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride){ NullFuncPtr(); }
 	static void APIENTRY Null_glPolygonOffsetClamp (GLfloat factor, GLfloat units, GLfloat clamp){ NullFuncPtr(); }
-	Version46::Version46(Func_GetProcAddress GetProcAddress):
-		Version45(GetProcAddress),
-		SpecializeShader(GetProc<PFNGLSPECIALIZESHADERPROC>("glSpecializeShader", Null_glSpecializeShader)),
-		MultiDrawArraysIndirectCount(GetProc<PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC>("glMultiDrawArraysIndirectCount", Null_glMultiDrawArraysIndirectCount)),
-		MultiDrawElementsIndirectCount(GetProc<PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC>("glMultiDrawElementsIndirectCount", Null_glMultiDrawElementsIndirectCount)),
-		PolygonOffsetClamp(GetProc<PFNGLPOLYGONOFFSETCLAMPPROC>("glPolygonOffsetClamp", Null_glPolygonOffsetClamp))
+	static void Resolve_glSpecializeShader(Version46& c){ c.SpecializeShader = c.GetProc<decltype(c.SpecializeShader)>("glSpecializeShader", Null_glSpecializeShader); }
+	static void Resolve_glMultiDrawArraysIndirectCount(Version46& c){ c.MultiDrawArraysIndirectCount = c.GetProc<decltype(c.MultiDrawArraysIndirectCount)>("glMultiDrawArraysIndirectCount", Null_glMultiDrawArraysIndirectCount); }
+	static void Resolve_glMultiDrawElementsIndirectCount(Version46& c){ c.MultiDrawElementsIndirectCount = c.GetProc<decltype(c.MultiDrawElementsIndirectCount)>("glMultiDrawElementsIndirectCount", Null_glMultiDrawElementsIndirectCount); }
+	static void Resolve_glPolygonOffsetClamp(Version46& c){ c.PolygonOffsetClamp = c.GetProc<decltype(c.PolygonOffsetClamp)>("glPolygonOffsetClamp", Null_glPolygonOffsetClamp); }
+	static void APIENTRY Lazy_glSpecializeShader (GLuint shader, const GLchar* pEntryPoint, GLuint numSpecializationConstants, const GLuint* pConstantIndex, const GLuint* pConstantValue){ auto& c = ResolveLazy(Resolve_glSpecializeShader, [](const Version46& c){ return c.SpecializeShader == Lazy_glSpecializeShader; }); return c.SpecializeShader(shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue); }
+	static void APIENTRY Lazy_glMultiDrawArraysIndirectCount (GLenum mode, const void* indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride){ auto& c = ResolveLazy(Resolve_glMultiDrawArraysIndirectCount, [](const Version46& c){ return c.MultiDrawArraysIndirectCount == Lazy_glMultiDrawArraysIndirectCount; }); return c.MultiDrawArraysIndirectCount(mode, indirect, drawcount, maxdrawcount, stride); }
+	static void APIENTRY Lazy_glMultiDrawElementsIndirectCount (GLenum mode, GLenum type, const void* indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride){ auto& c = ResolveLazy(Resolve_glMultiDrawElementsIndirectCount, [](const Version46& c){ return c.MultiDrawElementsIndirectCount == Lazy_glMultiDrawElementsIndirectCount; }); return c.MultiDrawElementsIndirectCount(mode, type, indirect, drawcount, maxdrawcount, stride); }
+	static void APIENTRY Lazy_glPolygonOffsetClamp (GLfloat factor, GLfloat units, GLfloat clamp){ auto& c = ResolveLazy(Resolve_glPolygonOffsetClamp, [](const Version46& c){ return c.PolygonOffsetClamp == Lazy_glPolygonOffsetClamp; }); return c.PolygonOffsetClamp(factor, units, clamp); }
+	static void ResolveAll(Version46& c);
+
+	Version46::Version46(Func_GetProcAddress GetProcAddress, LoadMode Mode):
+		Version45(GetProcAddress, Mode),
+		SpecializeShader(GetProc<PFNGLSPECIALIZESHADERPROC>("glSpecializeShader", Null_glSpecializeShader, Lazy_glSpecializeShader)),
+		MultiDrawArraysIndirectCount(GetProc<PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC>("glMultiDrawArraysIndirectCount", Null_glMultiDrawArraysIndirectCount, Lazy_glMultiDrawArraysIndirectCount)),
+		MultiDrawElementsIndirectCount(GetProc<PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC>("glMultiDrawElementsIndirectCount", Null_glMultiDrawElementsIndirectCount, Lazy_glMultiDrawElementsIndirectCount)),
+		PolygonOffsetClamp(GetProc<PFNGLPOLYGONOFFSETCLAMPPROC>("glPolygonOffsetClamp", Null_glPolygonOffsetClamp, Lazy_glPolygonOffsetClamp))
 	{
 		Available = Ver_Major > 4 || (Ver_Major == 4 && (Ver_Minor > 6 || (Ver_Minor == 6 && Ver_Release >= 0)));
+		if (Mode == LoadMode::Lazy)
+		{
+			auto lock = std::scoped_lock(LazyContextsLock);
+			LazyContexts.push_back(this);
+			LazyContext = this;
+		}
+		if (Mode == LoadMode::Cached)
+		{
+			ProcCache = ProcAddressCache::Acquire(GetProcAddress, Vendor, Renderer, Version);
+			ResolveAll(*this);
+		}
+	}
+
+	Version46::~Version46()
+	{
+		if (LazyContext == this) LazyContext = nullptr;
+		if (Mode == LoadMode::Lazy)
+		{
+			auto lock = std::scoped_lock(LazyContextsLock);
+			LazyContexts.erase(std::find(LazyContexts.begin(), LazyContexts.end(), this));
+		}
+	}
+
+	void Version46::MakeLazyCurrent()
+	{
+		LazyContext = this;
+	}
+
+	struct LazyResolver
+	{
+		const char* Symbol;
+		void (*Resolve)(Version46& c);
+	};
+
+	// 按函数名排序，用于二分查找
+	static const LazyResolver LazyResolvers[] =
+	{
+		{ "glActiveShaderProgram", Resolve_glActiveShaderProgram },
+		{ "glActiveTexture", Resolve_glActiveTexture },
+		{ "glAttachShader", Resolve_glAttachShader },
+		{ "glBeginConditionalRender", Resolve_glBeginConditionalRender },
+		{ "glBeginQuery", Resolve_glBeginQuery },
+		{ "glBeginQueryIndexed", Resolve_glBeginQueryIndexed },
+		{ "glBeginTransformFeedback", Resolve_glBeginTransformFeedback },
+		{ "glBindAttribLocation", Resolve_glBindAttribLocation },
+		{ "glBindBuffer", Resolve_glBindBuffer },
+		{ "glBindBufferBase", Resolve_glBindBufferBase },
+		{ "glBindBufferRange", Resolve_glBindBufferRange },
+		{ "glBindBuffersBase", Resolve_glBindBuffersBase },
+		{ "glBindBuffersRange", Resolve_glBindBuffersRange },
+		{ "glBindFragDataLocation", Resolve_glBindFragDataLocation },
+		{ "glBindFragDataLocationIndexed", Resolve_glBindFragDataLocationIndexed },
+		{ "glBindFramebuffer", Resolve_glBindFramebuffer },
+		{ "glBindImageTexture", Resolve_glBindImageTexture },
+		{ "glBindImageTextures", Resolve_glBindImageTextures },
+		{ "glBindProgramPipeline", Resolve_glBindProgramPipeline },
+		{ "glBindRenderbuffer", Resolve_glBindRenderbuffer },
+		{ "glBindSampler", Resolve_glBindSampler },
+		{ "glBindSamplers", Resolve_glBindSamplers },
+		{ "glBindTexture", Resolve_glBindTexture },
+		{ "glBindTextureUnit", Resolve_glBindTextureUnit },
+		{ "glBindTextures", Resolve_glBindTextures },
+		{ "glBindTransformFeedback", Resolve_glBindTransformFeedback },
+		{ "glBindVertexArray", Resolve_glBindVertexArray },
+		{ "glBindVertexBuffer", Resolve_glBindVertexBuffer },
+		{ "glBindVertexBuffers", Resolve_glBindVertexBuffers },
+		{ "glBlendColor", Resolve_glBlendColor },
+		{ "glBlendEquation", Resolve_glBlendEquation },
+		{ "glBlendEquationSeparate", Resolve_glBlendEquationSeparate },
+		{ "glBlendEquationSeparatei", Resolve_glBlendEquationSeparatei },
+		{ "glBlendEquationi", Resolve_glBlendEquationi },
+		{ "glBlendFunc", Resolve_glBlendFunc },
+		{ "glBlendFuncSeparate", Resolve_glBlendFuncSeparate },
+		{ "glBlendFuncSeparatei", Resolve_glBlendFuncSeparatei },
+		{ "glBlendFunci", Resolve_glBlendFunci },
+		{ "glBlitFramebuffer", Resolve_glBlitFramebuffer },
+		{ "glBlitNamedFramebuffer", Resolve_glBlitNamedFramebuffer },
+		{ "glBufferData", Resolve_glBufferData },
+		{ "glBufferStorage", Resolve_glBufferStorage },
+		{ "glBufferSubData", Resolve_glBufferSubData },
+		{ "glCheckFramebufferStatus", Resolve_glCheckFramebufferStatus },
+		{ "glCheckNamedFramebufferStatus", Resolve_glCheckNamedFramebufferStatus },
+		{ "glClampColor", Resolve_glClampColor },
+		{ "glClear", Resolve_glClear },
+		{ "glClearBufferData", Resolve_glClearBufferData },
+		{ "glClearBufferSubData", Resolve_glClearBufferSubData },
+		{ "glClearBufferfi", Resolve_glClearBufferfi },
+		{ "glClearBufferfv", Resolve_glClearBufferfv },
+		{ "glClearBufferiv", Resolve_glClearBufferiv },
+		{ "glClearBufferuiv", Resolve_glClearBufferuiv },
+		{ "glClearColor", Resolve_glClearColor },
+		{ "glClearDepth", Resolve_glClearDepth },
+		{ "glClearDepthf", Resolve_glClearDepthf },
+		{ "glClearNamedBufferData", Resolve_glClearNamedBufferData },
+		{ "glClearNamedBufferSubData", Resolve_glClearNamedBufferSubData },
+		{ "glClearNamedFramebufferfi", Resolve_glClearNamedFramebufferfi },
+		{ "glClearNamedFramebufferfv", Resolve_glClearNamedFramebufferfv },
+		{ "glClearNamedFramebufferiv", Resolve_glClearNamedFramebufferiv },
+		{ "glClearNamedFramebufferuiv", Resolve_glClearNamedFramebufferuiv },
+		{ "glClearStencil", Resolve_glClearStencil },
+		{ "glClearTexImage", Resolve_glClearTexImage },
+		{ "glClearTexSubImage", Resolve_glClearTexSubImage },
+		{ "glClientActiveTexture", Resolve_glClientActiveTexture },
+		{ "glClientWaitSync", Resolve_glClientWaitSync },
+		{ "glClipControl", Resolve_glClipControl },
+		{ "glColorMask", Resolve_glColorMask },
+		{ "glColorMaski", Resolve_glColorMaski },
+		{ "glColorP3ui", Resolve_glColorP3ui },
+		{ "glColorP3uiv", Resolve_glColorP3uiv },
+		{ "glColorP4ui", Resolve_glColorP4ui },
+		{ "glColorP4uiv", Resolve_glColorP4uiv },
+		{ "glCompileShader", Resolve_glCompileShader },
+		{ "glCompressedTexImage1D", Resolve_glCompressedTexImage1D },
+		{ "glCompressedTexImage2D", Resolve_glCompressedTexImage2D },
+		{ "glCompressedTexImage3D", Resolve_glCompressedTexImage3D },
+		{ "glCompressedTexSubImage1D", Resolve_glCompressedTexSubImage1D },
+		{ "glCompressedTexSubImage2D", Resolve_glCompressedTexSubImage2D },
+		{ "glCompressedTexSubImage3D", Resolve_glCompressedTexSubImage3D },
+		{ "glCompressedTextureSubImage1D", Resolve_glCompressedTextureSubImage1D },
+		{ "glCompressedTextureSubImage2D", Resolve_glCompressedTextureSubImage2D },
+		{ "glCompressedTextureSubImage3D", Resolve_glCompressedTextureSubImage3D },
+		{ "glCopyBufferSubData", Resolve_glCopyBufferSubData },
+		{ "glCopyImageSubData", Resolve_glCopyImageSubData },
+		{ "glCopyNamedBufferSubData", Resolve_glCopyNamedBufferSubData },
+		{ "glCopyTexImage1D", Resolve_glCopyTexImage1D },
+		{ "glCopyTexImage2D", Resolve_glCopyTexImage2D },
+		{ "glCopyTexSubImage1D", Resolve_glCopyTexSubImage1D },
+		{ "glCopyTexSubImage2D", Resolve_glCopyTexSubImage2D },
+		{ "glCopyTexSubImage3D", Resolve_glCopyTexSubImage3D },
+		{ "glCopyTextureSubImage1D", Resolve_glCopyTextureSubImage1D },
+		{ "glCopyTextureSubImage2D", Resolve_glCopyTextureSubImage2D },
+		{ "glCopyTextureSubImage3D", Resolve_glCopyTextureSubImage3D },
+		{ "glCreateBuffers", Resolve_glCreateBuffers },
+		{ "glCreateFramebuffers", Resolve_glCreateFramebuffers },
+		{ "glCreateProgram", Resolve_glCreateProgram },
+		{ "glCreateProgramPipelines", Resolve_glCreateProgramPipelines },
+		{ "glCreateQueries", Resolve_glCreateQueries },
+		{ "glCreateRenderbuffers", Resolve_glCreateRenderbuffers },
+		{ "glCreateSamplers", Resolve_glCreateSamplers },
+		{ "glCreateShader", Resolve_glCreateShader },
+		{ "glCreateShaderProgramv", Resolve_glCreateShaderProgramv },
+		{ "glCreateTextures", Resolve_glCreateTextures },
+		{ "glCreateTransformFeedbacks", Resolve_glCreateTransformFeedbacks },
+		{ "glCreateVertexArrays", Resolve_glCreateVertexArrays },
+		{ "glCullFace", Resolve_glCullFace },
+		{ "glDebugMessageCallback", Resolve_glDebugMessageCallback },
+		{ "glDebugMessageControl", Resolve_glDebugMessageControl },
+		{ "glDebugMessageInsert", Resolve_glDebugMessageInsert },
+		{ "glDeleteBuffers", Resolve_glDeleteBuffers },
+		{ "glDeleteFramebuffers", Resolve_glDeleteFramebuffers },
+		{ "glDeleteProgram", Resolve_glDeleteProgram },
+		{ "glDeleteProgramPipelines", Resolve_glDeleteProgramPipelines },
+		{ "glDeleteQueries", Resolve_glDeleteQueries },
+		{ "glDeleteRenderbuffers", Resolve_glDeleteRenderbuffers },
+		{ "glDeleteSamplers", Resolve_glDeleteSamplers },
+		{ "glDeleteShader", Resolve_glDeleteShader },
+		{ "glDeleteSync", Resolve_glDeleteSync },
+		{ "glDeleteTextures", Resolve_glDeleteTextures },
+		{ "glDeleteTransformFeedbacks", Resolve_glDeleteTransformFeedbacks },
+		{ "glDeleteVertexArrays", Resolve_glDeleteVertexArrays },
+		{ "glDepthFunc", Resolve_glDepthFunc },
+		{ "glDepthMask", Resolve_glDepthMask },
+		{ "glDepthRange", Resolve_glDepthRange },
+		{ "glDepthRangeArrayv", Resolve_glDepthRangeArrayv },
+		{ "glDepthRangeIndexed", Resolve_glDepthRangeIndexed },
+		{ "glDepthRangef", Resolve_glDepthRangef },
+		{ "glDetachShader", Resolve_glDetachShader },
+		{ "glDisable", Resolve_glDisable },
+		{ "glDisableVertexArrayAttrib", Resolve_glDisableVertexArrayAttrib },
+		{ "glDisableVertexAttribArray", Resolve_glDisableVertexAttribArray },
+		{ "glDisablei", Resolve_glDisablei },
+		{ "glDispatchCompute", Resolve_glDispatchCompute },
+		{ "glDispatchComputeIndirect", Resolve_glDispatchComputeIndirect },
+		{ "glDrawArrays", Resolve_glDrawArrays },
+		{ "glDrawArraysIndirect", Resolve_glDrawArraysIndirect },
+		{ "glDrawArraysInstanced", Resolve_glDrawArraysInstanced },
+		{ "glDrawArraysInstancedBaseInstance", Resolve_glDrawArraysInstancedBaseInstance },
+		{ "glDrawBuffer", Resolve_glDrawBuffer },
+		{ "glDrawBuffers", Resolve_glDrawBuffers },
+		{ "glDrawElements", Resolve_glDrawElements },
+		{ "glDrawElementsBaseVertex", Resolve_glDrawElementsBaseVertex },
+		{ "glDrawElementsIndirect", Resolve_glDrawElementsIndirect },
+		{ "glDrawElementsInstanced", Resolve_glDrawElementsInstanced },
+		{ "glDrawElementsInstancedBaseInstance", Resolve_glDrawElementsInstancedBaseInstance },
+		{ "glDrawElementsInstancedBaseVertex", Resolve_glDrawElementsInstancedBaseVertex },
+		{ "glDrawElementsInstancedBaseVertexBaseInstance", Resolve_glDrawElementsInstancedBaseVertexBaseInstance },
+		{ "glDrawRangeElements", Resolve_glDrawRangeElements },
+		{ "glDrawRangeElementsBaseVertex", Resolve_glDrawRangeElementsBaseVertex },
+		{ "glDrawTransformFeedback", Resolve_glDrawTransformFeedback },
+		{ "glDrawTransformFeedbackInstanced", Resolve_glDrawTransformFeedbackInstanced },
+		{ "glDrawTransformFeedbackStream", Resolve_glDrawTransformFeedbackStream },
+		{ "glDrawTransformFeedbackStreamInstanced", Resolve_glDrawTransformFeedbackStreamInstanced },
+		{ "glEnable", Resolve_glEnable },
+		{ "glEnableVertexArrayAttrib", Resolve_glEnableVertexArrayAttrib },
+		{ "glEnableVertexAttribArray", Resolve_glEnableVertexAttribArray },
+		{ "glEnablei", Resolve_glEnablei },
+		{ "glEndConditionalRender", Resolve_glEndConditionalRender },
+		{ "glEndQuery", Resolve_glEndQuery },
+		{ "glEndQueryIndexed", Resolve_glEndQueryIndexed },
+		{ "glEndTransformFeedback", Resolve_glEndTransformFeedback },
+		{ "glFenceSync", Resolve_glFenceSync },
+		{ "glFinish", Resolve_glFinish },
+		{ "glFlush", Resolve_glFlush },
+		{ "glFlushMappedBufferRange", Resolve_glFlushMappedBufferRange },
+		{ "glFlushMappedNamedBufferRange", Resolve_glFlushMappedNamedBufferRange },
+		{ "glFogCoordPointer", Resolve_glFogCoordPointer },
+		{ "glFogCoordd", Resolve_glFogCoordd },
+		{ "glFogCoorddv", Resolve_glFogCoorddv },
+		{ "glFogCoordf", Resolve_glFogCoordf },
+		{ "glFogCoordfv", Resolve_glFogCoordfv },
+		{ "glFramebufferParameteri", Resolve_glFramebufferParameteri },
+		{ "glFramebufferRenderbuffer", Resolve_glFramebufferRenderbuffer },
+		{ "glFramebufferTexture", Resolve_glFramebufferTexture },
+		{ "glFramebufferTexture1D", Resolve_glFramebufferTexture1D },
+		{ "glFramebufferTexture2D", Resolve_glFramebufferTexture2D },
+		{ "glFramebufferTexture3D", Resolve_glFramebufferTexture3D },
+		{ "glFramebufferTextureLayer", Resolve_glFramebufferTextureLayer },
+		{ "glFrontFace", Resolve_glFrontFace },
+		{ "glGenBuffers", Resolve_glGenBuffers },
+		{ "glGenFramebuffers", Resolve_glGenFramebuffers },
+		{ "glGenProgramPipelines", Resolve_glGenProgramPipelines },
+		{ "glGenQueries", Resolve_glGenQueries },
+		{ "glGenRenderbuffers", Resolve_glGenRenderbuffers },
+		{ "glGenSamplers", Resolve_glGenSamplers },
+		{ "glGenTextures", Resolve_glGenTextures },
+		{ "glGenTransformFeedbacks", Resolve_glGenTransformFeedbacks },
+		{ "glGenVertexArrays", Resolve_glGenVertexArrays },
+		{ "glGenerateMipmap", Resolve_glGenerateMipmap },
+		{ "glGenerateTextureMipmap", Resolve_glGenerateTextureMipmap },
+		{ "glGetActiveAtomicCounterBufferiv", Resolve_glGetActiveAtomicCounterBufferiv },
+		{ "glGetActiveAttrib", Resolve_glGetActiveAttrib },
+		{ "glGetActiveSubroutineName", Resolve_glGetActiveSubroutineName },
+		{ "glGetActiveSubroutineUniformName", Resolve_glGetActiveSubroutineUniformName },
+		{ "glGetActiveSubroutineUniformiv", Resolve_glGetActiveSubroutineUniformiv },
+		{ "glGetActiveUniform", Resolve_glGetActiveUniform },
+		{ "glGetActiveUniformBlockName", Resolve_glGetActiveUniformBlockName },
+		{ "glGetActiveUniformBlockiv", Resolve_glGetActiveUniformBlockiv },
+		{ "glGetActiveUniformName", Resolve_glGetActiveUniformName },
+		{ "glGetActiveUniformsiv", Resolve_glGetActiveUniformsiv },
+		{ "glGetAttachedShaders", Resolve_glGetAttachedShaders },
+		{ "glGetAttribLocation", Resolve_glGetAttribLocation },
+		{ "glGetBooleani_v", Resolve_glGetBooleani_v },
+		{ "glGetBooleanv", Resolve_glGetBooleanv },
+		{ "glGetBufferParameteri64v", Resolve_glGetBufferParameteri64v },
+		{ "glGetBufferParameteriv", Resolve_glGetBufferParameteriv },
+		{ "glGetBufferPointerv", Resolve_glGetBufferPointerv },
+		{ "glGetBufferSubData", Resolve_glGetBufferSubData },
+		{ "glGetCompressedTexImage", Resolve_glGetCompressedTexImage },
+		{ "glGetCompressedTextureImage", Resolve_glGetCompressedTextureImage },
+		{ "glGetCompressedTextureSubImage", Resolve_glGetCompressedTextureSubImage },
+		{ "glGetDebugMessageLog", Resolve_glGetDebugMessageLog },
+		{ "glGetDoublei_v", Resolve_glGetDoublei_v },
+		{ "glGetDoublev", Resolve_glGetDoublev },
+		{ "glGetError", Resolve_glGetError },
+		{ "glGetFloati_v", Resolve_glGetFloati_v },
+		{ "glGetFloatv", Resolve_glGetFloatv },
+		{ "glGetFragDataIndex", Resolve_glGetFragDataIndex },
+		{ "glGetFragDataLocation", Resolve_glGetFragDataLocation },
+		{ "glGetFramebufferAttachmentParameteriv", Resolve_glGetFramebufferAttachmentParameteriv },
+		{ "glGetFramebufferParameteriv", Resolve_glGetFramebufferParameteriv },
+		{ "glGetGraphicsResetStatus", Resolve_glGetGraphicsResetStatus },
+		{ "glGetInteger64i_v", Resolve_glGetInteger64i_v },
+		{ "glGetInteger64v", Resolve_glGetInteger64v },
+		{ "glGetIntegeri_v", Resolve_glGetIntegeri_v },
+		{ "glGetIntegerv", Resolve_glGetIntegerv },
+		{ "glGetInternalformati64v", Resolve_glGetInternalformati64v },
+		{ "glGetInternalformativ", Resolve_glGetInternalformativ },
+		{ "glGetMultisamplefv", Resolve_glGetMultisamplefv },
+		{ "glGetNamedBufferParameteri64v", Resolve_glGetNamedBufferParameteri64v },
+		{ "glGetNamedBufferParameteriv", Resolve_glGetNamedBufferParameteriv },
+		{ "glGetNamedBufferPointerv", Resolve_glGetNamedBufferPointerv },
+		{ "glGetNamedBufferSubData", Resolve_glGetNamedBufferSubData },
+		{ "glGetNamedFramebufferAttachmentParameteriv", Resolve_glGetNamedFramebufferAttachmentParameteriv },
+		{ "glGetNamedFramebufferParameteriv", Resolve_glGetNamedFramebufferParameteriv },
+		{ "glGetNamedRenderbufferParameteriv", Resolve_glGetNamedRenderbufferParameteriv },
+		{ "glGetObjectLabel", Resolve_glGetObjectLabel },
+		{ "glGetObjectPtrLabel", Resolve_glGetObjectPtrLabel },
+		{ "glGetPointerv", Resolve_glGetPointerv },
+		{ "glGetProgramBinary", Resolve_glGetProgramBinary },
+		{ "glGetProgramInfoLog", Resolve_glGetProgramInfoLog },
+		{ "glGetProgramInterfaceiv", Resolve_glGetProgramInterfaceiv },
+		{ "glGetProgramPipelineInfoLog", Resolve_glGetProgramPipelineInfoLog },
+		{ "glGetProgramPipelineiv", Resolve_glGetProgramPipelineiv },
+		{ "glGetProgramResourceIndex", Resolve_glGetProgramResourceIndex },
+		{ "glGetProgramResourceLocation", Resolve_glGetProgramResourceLocation },
+		{ "glGetProgramResourceLocationIndex", Resolve_glGetProgramResourceLocationIndex },
+		{ "glGetProgramResourceName", Resolve_glGetProgramResourceName },
+		{ "glGetProgramResourceiv", Resolve_glGetProgramResourceiv },
+		{ "glGetProgramStageiv", Resolve_glGetProgramStageiv },
+		{ "glGetProgramiv", Resolve_glGetProgramiv },
+		{ "glGetQueryBufferObjecti64v", Resolve_glGetQueryBufferObjecti64v },
+		{ "glGetQueryBufferObjectiv", Resolve_glGetQueryBufferObjectiv },
+		{ "glGetQueryBufferObjectui64v", Resolve_glGetQueryBufferObjectui64v },
+		{ "glGetQueryBufferObjectuiv", Resolve_glGetQueryBufferObjectuiv },
+		{ "glGetQueryIndexediv", Resolve_glGetQueryIndexediv },
+		{ "glGetQueryObjecti64v", Resolve_glGetQueryObjecti64v },
+		{ "glGetQueryObjectiv", Resolve_glGetQueryObjectiv },
+		{ "glGetQueryObjectui64v", Resolve_glGetQueryObjectui64v },
+		{ "glGetQueryObjectuiv", Resolve_glGetQueryObjectuiv },
+		{ "glGetQueryiv", Resolve_glGetQueryiv },
+		{ "glGetRenderbufferParameteriv", Resolve_glGetRenderbufferParameteriv },
+		{ "glGetSamplerParameterIiv", Resolve_glGetSamplerParameterIiv },
+		{ "glGetSamplerParameterIuiv", Resolve_glGetSamplerParameterIuiv },
+		{ "glGetSamplerParameterfv", Resolve_glGetSamplerParameterfv },
+		{ "glGetSamplerParameteriv", Resolve_glGetSamplerParameteriv },
+		{ "glGetShaderInfoLog", Resolve_glGetShaderInfoLog },
+		{ "glGetShaderPrecisionFormat", Resolve_glGetShaderPrecisionFormat },
+		{ "glGetShaderSource", Resolve_glGetShaderSource },
+		{ "glGetShaderiv", Resolve_glGetShaderiv },
+		{ "glGetStringi", Resolve_glGetStringi },
+		{ "glGetSubroutineIndex", Resolve_glGetSubroutineIndex },
+		{ "glGetSubroutineUniformLocation", Resolve_glGetSubroutineUniformLocation },
+		{ "glGetSynciv", Resolve_glGetSynciv },
+		{ "glGetTexImage", Resolve_glGetTexImage },
+		{ "glGetTexLevelParameterfv", Resolve_glGetTexLevelParameterfv },
+		{ "glGetTexLevelParameteriv", Resolve_glGetTexLevelParameteriv },
+		{ "glGetTexParameterIiv", Resolve_glGetTexParameterIiv },
+		{ "glGetTexParameterIuiv", Resolve_glGetTexParameterIuiv },
+		{ "glGetTexParameterfv", Resolve_glGetTexParameterfv },
+		{ "glGetTexParameteriv", Resolve_glGetTexParameteriv },
+		{ "glGetTextureImage", Resolve_glGetTextureImage },
+		{ "glGetTextureLevelParameterfv", Resolve_glGetTextureLevelParameterfv },
+		{ "glGetTextureLevelParameteriv", Resolve_glGetTextureLevelParameteriv },
+		{ "glGetTextureParameterIiv", Resolve_glGetTextureParameterIiv },
+		{ "glGetTextureParameterIuiv", Resolve_glGetTextureParameterIuiv },
+		{ "glGetTextureParameterfv", Resolve_glGetTextureParameterfv },
+		{ "glGetTextureParameteriv", Resolve_glGetTextureParameteriv },
+		{ "glGetTextureSubImage", Resolve_glGetTextureSubImage },
+		{ "glGetTransformFeedbackVarying", Resolve_glGetTransformFeedbackVarying },
+		{ "glGetTransformFeedbacki64_v", Resolve_glGetTransformFeedbacki64_v },
+		{ "glGetTransformFeedbacki_v", Resolve_glGetTransformFeedbacki_v },
+		{ "glGetTransformFeedbackiv", Resolve_glGetTransformFeedbackiv },
+		{ "glGetUniformBlockIndex", Resolve_glGetUniformBlockIndex },
+		{ "glGetUniformIndices", Resolve_glGetUniformIndices },
+		{ "glGetUniformLocation", Resolve_glGetUniformLocation },
+		{ "glGetUniformSubroutineuiv", Resolve_glGetUniformSubroutineuiv },
+		{ "glGetUniformdv", Resolve_glGetUniformdv },
+		{ "glGetUniformfv", Resolve_glGetUniformfv },
+		{ "glGetUniformiv", Resolve_glGetUniformiv },
+		{ "glGetUniformuiv", Resolve_glGetUniformuiv },
+		{ "glGetVertexArrayIndexed64iv", Resolve_glGetVertexArrayIndexed64iv },
+		{ "glGetVertexArrayIndexediv", Resolve_glGetVertexArrayIndexediv },
+		{ "glGetVertexArrayiv", Resolve_glGetVertexArrayiv },
+		{ "glGetVertexAttribIiv", Resolve_glGetVertexAttribIiv },
+		{ "glGetVertexAttribIuiv", Resolve_glGetVertexAttribIuiv },
+		{ "glGetVertexAttribLdv", Resolve_glGetVertexAttribLdv },
+		{ "glGetVertexAttribPointerv", Resolve_glGetVertexAttribPointerv },
+		{ "glGetVertexAttribdv", Resolve_glGetVertexAttribdv },
+		{ "glGetVertexAttribfv", Resolve_glGetVertexAttribfv },
+		{ "glGetVertexAttribiv", Resolve_glGetVertexAttribiv },
+		{ "glGetnColorTable", Resolve_glGetnColorTable },
+		{ "glGetnCompressedTexImage", Resolve_glGetnCompressedTexImage },
+		{ "glGetnConvolutionFilter", Resolve_glGetnConvolutionFilter },
+		{ "glGetnHistogram", Resolve_glGetnHistogram },
+		{ "glGetnMapdv", Resolve_glGetnMapdv },
+		{ "glGetnMapfv", Resolve_glGetnMapfv },
+		{ "glGetnMapiv", Resolve_glGetnMapiv },
+		{ "glGetnMinmax", Resolve_glGetnMinmax },
+		{ "glGetnPixelMapfv", Resolve_glGetnPixelMapfv },
+		{ "glGetnPixelMapuiv", Resolve_glGetnPixelMapuiv },
+		{ "glGetnPixelMapusv", Resolve_glGetnPixelMapusv },
+		{ "glGetnPolygonStipple", Resolve_glGetnPolygonStipple },
+		{ "glGetnSeparableFilter", Resolve_glGetnSeparableFilter },
+		{ "glGetnTexImage", Resolve_glGetnTexImage },
+		{ "glGetnUniformdv", Resolve_glGetnUniformdv },
+		{ "glGetnUniformfv", Resolve_glGetnUniformfv },
+		{ "glGetnUniformiv", Resolve_glGetnUniformiv },
+		{ "glGetnUniformuiv", Resolve_glGetnUniformuiv },
+		{ "glHint", Resolve_glHint },
+		{ "glInvalidateBufferData", Resolve_glInvalidateBufferData },
+		{ "glInvalidateBufferSubData", Resolve_glInvalidateBufferSubData },
+		{ "glInvalidateFramebuffer", Resolve_glInvalidateFramebuffer },
+		{ "glInvalidateNamedFramebufferData", Resolve_glInvalidateNamedFramebufferData },
+		{ "glInvalidateNamedFramebufferSubData", Resolve_glInvalidateNamedFramebufferSubData },
+		{ "glInvalidateSubFramebuffer", Resolve_glInvalidateSubFramebuffer },
+		{ "glInvalidateTexImage", Resolve_glInvalidateTexImage },
+		{ "glInvalidateTexSubImage", Resolve_glInvalidateTexSubImage },
+		{ "glIsBuffer", Resolve_glIsBuffer },
+		{ "glIsEnabled", Resolve_glIsEnabled },
+		{ "glIsEnabledi", Resolve_glIsEnabledi },
+		{ "glIsFramebuffer", Resolve_glIsFramebuffer },
+		{ "glIsProgram", Resolve_glIsProgram },
+		{ "glIsProgramPipeline", Resolve_glIsProgramPipeline },
+		{ "glIsQuery", Resolve_glIsQuery },
+		{ "glIsRenderbuffer", Resolve_glIsRenderbuffer },
+		{ "glIsSampler", Resolve_glIsSampler },
+		{ "glIsShader", Resolve_glIsShader },
+		{ "glIsSync", Resolve_glIsSync },
+		{ "glIsTexture", Resolve_glIsTexture },
+		{ "glIsTransformFeedback", Resolve_glIsTransformFeedback },
+		{ "glIsVertexArray", Resolve_glIsVertexArray },
+		{ "glLineWidth", Resolve_glLineWidth },
+		{ "glLinkProgram", Resolve_glLinkProgram },
+		{ "glLoadTransposeMatrixd", Resolve_glLoadTransposeMatrixd },
+		{ "glLoadTransposeMatrixf", Resolve_glLoadTransposeMatrixf },
+		{ "glLogicOp", Resolve_glLogicOp },
+		{ "glMapBuffer", Resolve_glMapBuffer },
+		{ "glMapBufferRange", Resolve_glMapBufferRange },
+		{ "glMapNamedBuffer", Resolve_glMapNamedBuffer },
+		{ "glMapNamedBufferRange", Resolve_glMapNamedBufferRange },
+		{ "glMemoryBarrier", Resolve_glMemoryBarrier },
+		{ "glMemoryBarrierByRegion", Resolve_glMemoryBarrierByRegion },
+		{ "glMinSampleShading", Resolve_glMinSampleShading },
+		{ "glMultTransposeMatrixd", Resolve_glMultTransposeMatrixd },
+		{ "glMultTransposeMatrixf", Resolve_glMultTransposeMatrixf },
+		{ "glMultiDrawArrays", Resolve_glMultiDrawArrays },
+		{ "glMultiDrawArraysIndirect", Resolve_glMultiDrawArraysIndirect },
+		{ "glMultiDrawArraysIndirectCount", Resolve_glMultiDrawArraysIndirectCount },
+		{ "glMultiDrawElements", Resolve_glMultiDrawElements },
+		{ "glMultiDrawElementsBaseVertex", Resolve_glMultiDrawElementsBaseVertex },
+		{ "glMultiDrawElementsIndirect", Resolve_glMultiDrawElementsIndirect },
+		{ "glMultiDrawElementsIndirectCount", Resolve_glMultiDrawElementsIndirectCount },
+		{ "glMultiTexCoord1d", Resolve_glMultiTexCoord1d },
+		{ "glMultiTexCoord1dv", Resolve_glMultiTexCoord1dv },
+		{ "glMultiTexCoord1f", Resolve_glMultiTexCoord1f },
+		{ "glMultiTexCoord1fv", Resolve_glMultiTexCoord1fv },
+		{ "glMultiTexCoord1i", Resolve_glMultiTexCoord1i },
+		{ "glMultiTexCoord1iv", Resolve_glMultiTexCoord1iv },
+		{ "glMultiTexCoord1s", Resolve_glMultiTexCoord1s },
+		{ "glMultiTexCoord1sv", Resolve_glMultiTexCoord1sv },
+		{ "glMultiTexCoord2d", Resolve_glMultiTexCoord2d },
+		{ "glMultiTexCoord2dv", Resolve_glMultiTexCoord2dv },
+		{ "glMultiTexCoord2f", Resolve_glMultiTexCoord2f },
+		{ "glMultiTexCoord2fv", Resolve_glMultiTexCoord2fv },
+		{ "glMultiTexCoord2i", Resolve_glMultiTexCoord2i },
+		{ "glMultiTexCoord2iv", Resolve_glMultiTexCoord2iv },
+		{ "glMultiTexCoord2s", Resolve_glMultiTexCoord2s },
+		{ "glMultiTexCoord2sv", Resolve_glMultiTexCoord2sv },
+		{ "glMultiTexCoord3d", Resolve_glMultiTexCoord3d },
+		{ "glMultiTexCoord3dv", Resolve_glMultiTexCoord3dv },
+		{ "glMultiTexCoord3f", Resolve_glMultiTexCoord3f },
+		{ "glMultiTexCoord3fv", Resolve_glMultiTexCoord3fv },
+		{ "glMultiTexCoord3i", Resolve_glMultiTexCoord3i },
+		{ "glMultiTexCoord3iv", Resolve_glMultiTexCoord3iv },
+		{ "glMultiTexCoord3s", Resolve_glMultiTexCoord3s },
+		{ "glMultiTexCoord3sv", Resolve_glMultiTexCoord3sv },
+		{ "glMultiTexCoord4d", Resolve_glMultiTexCoord4d },
+		{ "glMultiTexCoord4dv", Resolve_glMultiTexCoord4dv },
+		{ "glMultiTexCoord4f", Resolve_glMultiTexCoord4f },
+		{ "glMultiTexCoord4fv", Resolve_glMultiTexCoord4fv },
+		{ "glMultiTexCoord4i", Resolve_glMultiTexCoord4i },
+		{ "glMultiTexCoord4iv", Resolve_glMultiTexCoord4iv },
+		{ "glMultiTexCoord4s", Resolve_glMultiTexCoord4s },
+		{ "glMultiTexCoord4sv", Resolve_glMultiTexCoord4sv },
+		{ "glMultiTexCoordP1ui", Resolve_glMultiTexCoordP1ui },
+		{ "glMultiTexCoordP1uiv", Resolve_glMultiTexCoordP1uiv },
+		{ "glMultiTexCoordP2ui", Resolve_glMultiTexCoordP2ui },
+		{ "glMultiTexCoordP2uiv", Resolve_glMultiTexCoordP2uiv },
+		{ "glMultiTexCoordP3ui", Resolve_glMultiTexCoordP3ui },
+		{ "glMultiTexCoordP3uiv", Resolve_glMultiTexCoordP3uiv },
+		{ "glMultiTexCoordP4ui", Resolve_glMultiTexCoordP4ui },
+		{ "glMultiTexCoordP4uiv", Resolve_glMultiTexCoordP4uiv },
+		{ "glNamedBufferData", Resolve_glNamedBufferData },
+		{ "glNamedBufferStorage", Resolve_glNamedBufferStorage },
+		{ "glNamedBufferSubData", Resolve_glNamedBufferSubData },
+		{ "glNamedFramebufferDrawBuffer", Resolve_glNamedFramebufferDrawBuffer },
+		{ "glNamedFramebufferDrawBuffers", Resolve_glNamedFramebufferDrawBuffers },
+		{ "glNamedFramebufferParameteri", Resolve_glNamedFramebufferParameteri },
+		{ "glNamedFramebufferReadBuffer", Resolve_glNamedFramebufferReadBuffer },
+		{ "glNamedFramebufferRenderbuffer", Resolve_glNamedFramebufferRenderbuffer },
+		{ "glNamedFramebufferTexture", Resolve_glNamedFramebufferTexture },
+		{ "glNamedFramebufferTextureLayer", Resolve_glNamedFramebufferTextureLayer },
+		{ "glNamedRenderbufferStorage", Resolve_glNamedRenderbufferStorage },
+		{ "glNamedRenderbufferStorageMultisample", Resolve_glNamedRenderbufferStorageMultisample },
+		{ "glNormalP3ui", Resolve_glNormalP3ui },
+		{ "glNormalP3uiv", Resolve_glNormalP3uiv },
+		{ "glObjectLabel", Resolve_glObjectLabel },
+		{ "glObjectPtrLabel", Resolve_glObjectPtrLabel },
+		{ "glPatchParameterfv", Resolve_glPatchParameterfv },
+		{ "glPatchParameteri", Resolve_glPatchParameteri },
+		{ "glPauseTransformFeedback", Resolve_glPauseTransformFeedback },
+		{ "glPixelStoref", Resolve_glPixelStoref },
+		{ "glPixelStorei", Resolve_glPixelStorei },
+		{ "glPointParameterf", Resolve_glPointParameterf },
+		{ "glPointParameterfv", Resolve_glPointParameterfv },
+		{ "glPointParameteri", Resolve_glPointParameteri },
+		{ "glPointParameteriv", Resolve_glPointParameteriv },
+		{ "glPointSize", Resolve_glPointSize },
+		{ "glPolygonMode", Resolve_glPolygonMode },
+		{ "glPolygonOffset", Resolve_glPolygonOffset },
+		{ "glPolygonOffsetClamp", Resolve_glPolygonOffsetClamp },
+		{ "glPopDebugGroup", Resolve_glPopDebugGroup },
+		{ "glPrimitiveRestartIndex", Resolve_glPrimitiveRestartIndex },
+		{ "glProgramBinary", Resolve_glProgramBinary },
+		{ "glProgramParameteri", Resolve_glProgramParameteri },
+		{ "glProgramUniform1d", Resolve_glProgramUniform1d },
+		{ "glProgramUniform1dv", Resolve_glProgramUniform1dv },
+		{ "glProgramUniform1f", Resolve_glProgramUniform1f },
+		{ "glProgramUniform1fv", Resolve_glProgramUniform1fv },
+		{ "glProgramUniform1i", Resolve_glProgramUniform1i },
+		{ "glProgramUniform1iv", Resolve_glProgramUniform1iv },
+		{ "glProgramUniform1ui", Resolve_glProgramUniform1ui },
+		{ "glProgramUniform1uiv", Resolve_glProgramUniform1uiv },
+		{ "glProgramUniform2d", Resolve_glProgramUniform2d },
+		{ "glProgramUniform2dv", Resolve_glProgramUniform2dv },
+		{ "glProgramUniform2f", Resolve_glProgramUniform2f },
+		{ "glProgramUniform2fv", Resolve_glProgramUniform2fv },
+		{ "glProgramUniform2i", Resolve_glProgramUniform2i },
+		{ "glProgramUniform2iv", Resolve_glProgramUniform2iv },
+		{ "glProgramUniform2ui", Resolve_glProgramUniform2ui },
+		{ "glProgramUniform2uiv", Resolve_glProgramUniform2uiv },
+		{ "glProgramUniform3d", Resolve_glProgramUniform3d },
+		{ "glProgramUniform3dv", Resolve_glProgramUniform3dv },
+		{ "glProgramUniform3f", Resolve_glProgramUniform3f },
+		{ "glProgramUniform3fv", Resolve_glProgramUniform3fv },
+		{ "glProgramUniform3i", Resolve_glProgramUniform3i },
+		{ "glProgramUniform3iv", Resolve_glProgramUniform3iv },
+		{ "glProgramUniform3ui", Resolve_glProgramUniform3ui },
+		{ "glProgramUniform3uiv", Resolve_glProgramUniform3uiv },
+		{ "glProgramUniform4d", Resolve_glProgramUniform4d },
+		{ "glProgramUniform4dv", Resolve_glProgramUniform4dv },
+		{ "glProgramUniform4f", Resolve_glProgramUniform4f },
+		{ "glProgramUniform4fv", Resolve_glProgramUniform4fv },
+		{ "glProgramUniform4i", Resolve_glProgramUniform4i },
+		{ "glProgramUniform4iv", Resolve_glProgramUniform4iv },
+		{ "glProgramUniform4ui", Resolve_glProgramUniform4ui },
+		{ "glProgramUniform4uiv", Resolve_glProgramUniform4uiv },
+		{ "glProgramUniformMatrix2dv", Resolve_glProgramUniformMatrix2dv },
+		{ "glProgramUniformMatrix2fv", Resolve_glProgramUniformMatrix2fv },
+		{ "glProgramUniformMatrix2x3dv", Resolve_glProgramUniformMatrix2x3dv },
+		{ "glProgramUniformMatrix2x3fv", Resolve_glProgramUniformMatrix2x3fv },
+		{ "glProgramUniformMatrix2x4dv", Resolve_glProgramUniformMatrix2x4dv },
+		{ "glProgramUniformMatrix2x4fv", Resolve_glProgramUniformMatrix2x4fv },
+		{ "glProgramUniformMatrix3dv", Resolve_glProgramUniformMatrix3dv },
+		{ "glProgramUniformMatrix3fv", Resolve_glProgramUniformMatrix3fv },
+		{ "glProgramUniformMatrix3x2dv", Resolve_glProgramUniformMatrix3x2dv },
+		{ "glProgramUniformMatrix3x2fv", Resolve_glProgramUniformMatrix3x2fv },
+		{ "glProgramUniformMatrix3x4dv", Resolve_glProgramUniformMatrix3x4dv },
+		{ "glProgramUniformMatrix3x4fv", Resolve_glProgramUniformMatrix3x4fv },
+		{ "glProgramUniformMatrix4dv", Resolve_glProgramUniformMatrix4dv },
+		{ "glProgramUniformMatrix4fv", Resolve_glProgramUniformMatrix4fv },
+		{ "glProgramUniformMatrix4x2dv", Resolve_glProgramUniformMatrix4x2dv },
+		{ "glProgramUniformMatrix4x2fv", Resolve_glProgramUniformMatrix4x2fv },
+		{ "glProgramUniformMatrix4x3dv", Resolve_glProgramUniformMatrix4x3dv },
+		{ "glProgramUniformMatrix4x3fv", Resolve_glProgramUniformMatrix4x3fv },
+		{ "glProvokingVertex", Resolve_glProvokingVertex },
+		{ "glPushDebugGroup", Resolve_glPushDebugGroup },
+		{ "glQueryCounter", Resolve_glQueryCounter },
+		{ "glReadBuffer", Resolve_glReadBuffer },
+		{ "glReadPixels", Resolve_glReadPixels },
+		{ "glReadnPixels", Resolve_glReadnPixels },
+		{ "glReleaseShaderCompiler", Resolve_glReleaseShaderCompiler },
+		{ "glRenderbufferStorage", Resolve_glRenderbufferStorage },
+		{ "glRenderbufferStorageMultisample", Resolve_glRenderbufferStorageMultisample },
+		{ "glResumeTransformFeedback", Resolve_glResumeTransformFeedback },
+		{ "glSampleCoverage", Resolve_glSampleCoverage },
+		{ "glSampleMaski", Resolve_glSampleMaski },
+		{ "glSamplerParameterIiv", Resolve_glSamplerParameterIiv },
+		{ "glSamplerParameterIuiv", Resolve_glSamplerParameterIuiv },
+		{ "glSamplerParameterf", Resolve_glSamplerParameterf },
+		{ "glSamplerParameterfv", Resolve_glSamplerParameterfv },
+		{ "glSamplerParameteri", Resolve_glSamplerParameteri },
+		{ "glSamplerParameteriv", Resolve_glSamplerParameteriv },
+		{ "glScissor", Resolve_glScissor },
+		{ "glScissorArrayv", Resolve_glScissorArrayv },
+		{ "glScissorIndexed", Resolve_glScissorIndexed },
+		{ "glScissorIndexedv", Resolve_glScissorIndexedv },
+		{ "glSecondaryColor3b", Resolve_glSecondaryColor3b },
+		{ "glSecondaryColor3bv", Resolve_glSecondaryColor3bv },
+		{ "glSecondaryColor3d", Resolve_glSecondaryColor3d },
+		{ "glSecondaryColor3dv", Resolve_glSecondaryColor3dv },
+		{ "glSecondaryColor3f", Resolve_glSecondaryColor3f },
+		{ "glSecondaryColor3fv", Resolve_glSecondaryColor3fv },
+		{ "glSecondaryColor3i", Resolve_glSecondaryColor3i },
+		{ "glSecondaryColor3iv", Resolve_glSecondaryColor3iv },
+		{ "glSecondaryColor3s", Resolve_glSecondaryColor3s },
+		{ "glSecondaryColor3sv", Resolve_glSecondaryColor3sv },
+		{ "glSecondaryColor3ub", Resolve_glSecondaryColor3ub },
+		{ "glSecondaryColor3ubv", Resolve_glSecondaryColor3ubv },
+		{ "glSecondaryColor3ui", Resolve_glSecondaryColor3ui },
+		{ "glSecondaryColor3uiv", Resolve_glSecondaryColor3uiv },
+		{ "glSecondaryColor3us", Resolve_glSecondaryColor3us },
+		{ "glSecondaryColor3usv", Resolve_glSecondaryColor3usv },
+		{ "glSecondaryColorP3ui", Resolve_glSecondaryColorP3ui },
+		{ "glSecondaryColorP3uiv", Resolve_glSecondaryColorP3uiv },
+		{ "glSecondaryColorPointer", Resolve_glSecondaryColorPointer },
+		{ "glShaderBinary", Resolve_glShaderBinary },
+		{ "glShaderSource", Resolve_glShaderSource },
+		{ "glShaderStorageBlockBinding", Resolve_glShaderStorageBlockBinding },
+		{ "glSpecializeShader", Resolve_glSpecializeShader },
+		{ "glStencilFunc", Resolve_glStencilFunc },
+		{ "glStencilFuncSeparate", Resolve_glStencilFuncSeparate },
+		{ "glStencilMask", Resolve_glStencilMask },
+		{ "glStencilMaskSeparate", Resolve_glStencilMaskSeparate },
+		{ "glStencilOp", Resolve_glStencilOp },
+		{ "glStencilOpSeparate", Resolve_glStencilOpSeparate },
+		{ "glTexBuffer", Resolve_glTexBuffer },
+		{ "glTexBufferRange", Resolve_glTexBufferRange },
+		{ "glTexCoordP1ui", Resolve_glTexCoordP1ui },
+		{ "glTexCoordP1uiv", Resolve_glTexCoordP1uiv },
+		{ "glTexCoordP2ui", Resolve_glTexCoordP2ui },
+		{ "glTexCoordP2uiv", Resolve_glTexCoordP2uiv },
+		{ "glTexCoordP3ui", Resolve_glTexCoordP3ui },
+		{ "glTexCoordP3uiv", Resolve_glTexCoordP3uiv },
+		{ "glTexCoordP4ui", Resolve_glTexCoordP4ui },
+		{ "glTexCoordP4uiv", Resolve_glTexCoordP4uiv },
+		{ "glTexImage1D", Resolve_glTexImage1D },
+		{ "glTexImage2D", Resolve_glTexImage2D },
+		{ "glTexImage2DMultisample", Resolve_glTexImage2DMultisample },
+		{ "glTexImage3D", Resolve_glTexImage3D },
+		{ "glTexImage3DMultisample", Resolve_glTexImage3DMultisample },
+		{ "glTexParameterIiv", Resolve_glTexParameterIiv },
+		{ "glTexParameterIuiv", Resolve_glTexParameterIuiv },
+		{ "glTexParameterf", Resolve_glTexParameterf },
+		{ "glTexParameterfv", Resolve_glTexParameterfv },
+		{ "glTexParameteri", Resolve_glTexParameteri },
+		{ "glTexParameteriv", Resolve_glTexParameteriv },
+		{ "glTexStorage1D", Resolve_glTexStorage1D },
+		{ "glTexStorage2D", Resolve_glTexStorage2D },
+		{ "glTexStorage2DMultisample", Resolve_glTexStorage2DMultisample },
+		{ "glTexStorage3D", Resolve_glTexStorage3D },
+		{ "glTexStorage3DMultisample", Resolve_glTexStorage3DMultisample },
+		{ "glTexSubImage1D", Resolve_glTexSubImage1D },
+		{ "glTexSubImage2D", Resolve_glTexSubImage2D },
+		{ "glTexSubImage3D", Resolve_glTexSubImage3D },
+		{ "glTextureBarrier", Resolve_glTextureBarrier },
+		{ "glTextureBuffer", Resolve_glTextureBuffer },
+		{ "glTextureBufferRange", Resolve_glTextureBufferRange },
+		{ "glTextureParameterIiv", Resolve_glTextureParameterIiv },
+		{ "glTextureParameterIuiv", Resolve_glTextureParameterIuiv },
+		{ "glTextureParameterf", Resolve_glTextureParameterf },
+		{ "glTextureParameterfv", Resolve_glTextureParameterfv },
+		{ "glTextureParameteri", Resolve_glTextureParameteri },
+		{ "glTextureParameteriv", Resolve_glTextureParameteriv },
+		{ "glTextureStorage1D", Resolve_glTextureStorage1D },
+		{ "glTextureStorage2D", Resolve_glTextureStorage2D },
+		{ "glTextureStorage2DMultisample", Resolve_glTextureStorage2DMultisample },
+		{ "glTextureStorage3D", Resolve_glTextureStorage3D },
+		{ "glTextureStorage3DMultisample", Resolve_glTextureStorage3DMultisample },
+		{ "glTextureSubImage1D", Resolve_glTextureSubImage1D },
+		{ "glTextureSubImage2D", Resolve_glTextureSubImage2D },
+		{ "glTextureSubImage3D", Resolve_glTextureSubImage3D },
+		{ "glTextureView", Resolve_glTextureView },
+		{ "glTransformFeedbackBufferBase", Resolve_glTransformFeedbackBufferBase },
+		{ "glTransformFeedbackBufferRange", Resolve_glTransformFeedbackBufferRange },
+		{ "glTransformFeedbackVaryings", Resolve_glTransformFeedbackVaryings },
+		{ "glUniform1d", Resolve_glUniform1d },
+		{ "glUniform1dv", Resolve_glUniform1dv },
+		{ "glUniform1f", Resolve_glUniform1f },
+		{ "glUniform1fv", Resolve_glUniform1fv },
+		{ "glUniform1i", Resolve_glUniform1i },
+		{ "glUniform1iv", Resolve_glUniform1iv },
+		{ "glUniform1ui", Resolve_glUniform1ui },
+		{ "glUniform1uiv", Resolve_glUniform1uiv },
+		{ "glUniform2d", Resolve_glUniform2d },
+		{ "glUniform2dv", Resolve_glUniform2dv },
+		{ "glUniform2f", Resolve_glUniform2f },
+		{ "glUniform2fv", Resolve_glUniform2fv },
+		{ "glUniform2i", Resolve_glUniform2i },
+		{ "glUniform2iv", Resolve_glUniform2iv },
+		{ "glUniform2ui", Resolve_glUniform2ui },
+		{ "glUniform2uiv", Resolve_glUniform2uiv },
+		{ "glUniform3d", Resolve_glUniform3d },
+		{ "glUniform3dv", Resolve_glUniform3dv },
+		{ "glUniform3f", Resolve_glUniform3f },
+		{ "glUniform3fv", Resolve_glUniform3fv },
+		{ "glUniform3i", Resolve_glUniform3i },
+		{ "glUniform3iv", Resolve_glUniform3iv },
+		{ "glUniform3ui", Resolve_glUniform3ui },
+		{ "glUniform3uiv", Resolve_glUniform3uiv },
+		{ "glUniform4d", Resolve_glUniform4d },
+		{ "glUniform4dv", Resolve_glUniform4dv },
+		{ "glUniform4f", Resolve_glUniform4f },
+		{ "glUniform4fv", Resolve_glUniform4fv },
+		{ "glUniform4i", Resolve_glUniform4i },
+		{ "glUniform4iv", Resolve_glUniform4iv },
+		{ "glUniform4ui", Resolve_glUniform4ui },
+		{ "glUniform4uiv", Resolve_glUniform4uiv },
+		{ "glUniformBlockBinding", Resolve_glUniformBlockBinding },
+		{ "glUniformMatrix2dv", Resolve_glUniformMatrix2dv },
+		{ "glUniformMatrix2fv", Resolve_glUniformMatrix2fv },
+		{ "glUniformMatrix2x3dv", Resolve_glUniformMatrix2x3dv },
+		{ "glUniformMatrix2x3fv", Resolve_glUniformMatrix2x3fv },
+		{ "glUniformMatrix2x4dv", Resolve_glUniformMatrix2x4dv },
+		{ "glUniformMatrix2x4fv", Resolve_glUniformMatrix2x4fv },
+		{ "glUniformMatrix3dv", Resolve_glUniformMatrix3dv },
+		{ "glUniformMatrix3fv", Resolve_glUniformMatrix3fv },
+		{ "glUniformMatrix3x2dv", Resolve_glUniformMatrix3x2dv },
+		{ "glUniformMatrix3x2fv", Resolve_glUniformMatrix3x2fv },
+		{ "glUniformMatrix3x4dv", Resolve_glUniformMatrix3x4dv },
+		{ "glUniformMatrix3x4fv", Resolve_glUniformMatrix3x4fv },
+		{ "glUniformMatrix4dv", Resolve_glUniformMatrix4dv },
+		{ "glUniformMatrix4fv", Resolve_glUniformMatrix4fv },
+		{ "glUniformMatrix4x2dv", Resolve_glUniformMatrix4x2dv },
+		{ "glUniformMatrix4x2fv", Resolve_glUniformMatrix4x2fv },
+		{ "glUniformMatrix4x3dv", Resolve_glUniformMatrix4x3dv },
+		{ "glUniformMatrix4x3fv", Resolve_glUniformMatrix4x3fv },
+		{ "glUniformSubroutinesuiv", Resolve_glUniformSubroutinesuiv },
+		{ "glUnmapBuffer", Resolve_glUnmapBuffer },
+		{ "glUnmapNamedBuffer", Resolve_glUnmapNamedBuffer },
+		{ "glUseProgram", Resolve_glUseProgram },
+		{ "glUseProgramStages", Resolve_glUseProgramStages },
+		{ "glValidateProgram", Resolve_glValidateProgram },
+		{ "glValidateProgramPipeline", Resolve_glValidateProgramPipeline },
+		{ "glVertexArrayAttribBinding", Resolve_glVertexArrayAttribBinding },
+		{ "glVertexArrayAttribFormat", Resolve_glVertexArrayAttribFormat },
+		{ "glVertexArrayAttribIFormat", Resolve_glVertexArrayAttribIFormat },
+		{ "glVertexArrayAttribLFormat", Resolve_glVertexArrayAttribLFormat },
+		{ "glVertexArrayBindingDivisor", Resolve_glVertexArrayBindingDivisor },
+		{ "glVertexArrayElementBuffer", Resolve_glVertexArrayElementBuffer },
+		{ "glVertexArrayVertexBuffer", Resolve_glVertexArrayVertexBuffer },
+		{ "glVertexArrayVertexBuffers", Resolve_glVertexArrayVertexBuffers },
+		{ "glVertexAttrib1d", Resolve_glVertexAttrib1d },
+		{ "glVertexAttrib1dv", Resolve_glVertexAttrib1dv },
+		{ "glVertexAttrib1f", Resolve_glVertexAttrib1f },
+		{ "glVertexAttrib1fv", Resolve_glVertexAttrib1fv },
+		{ "glVertexAttrib1s", Resolve_glVertexAttrib1s },
+		{ "glVertexAttrib1sv", Resolve_glVertexAttrib1sv },
+		{ "glVertexAttrib2d", Resolve_glVertexAttrib2d },
+		{ "glVertexAttrib2dv", Resolve_glVertexAttrib2dv },
+		{ "glVertexAttrib2f", Resolve_glVertexAttrib2f },
+		{ "glVertexAttrib2fv", Resolve_glVertexAttrib2fv },
+		{ "glVertexAttrib2s", Resolve_glVertexAttrib2s },
+		{ "glVertexAttrib2sv", Resolve_glVertexAttrib2sv },
+		{ "glVertexAttrib3d", Resolve_glVertexAttrib3d },
+		{ "glVertexAttrib3dv", Resolve_glVertexAttrib3dv },
+		{ "glVertexAttrib3f", Resolve_glVertexAttrib3f },
+		{ "glVertexAttrib3fv", Resolve_glVertexAttrib3fv },
+		{ "glVertexAttrib3s", Resolve_glVertexAttrib3s },
+		{ "glVertexAttrib3sv", Resolve_glVertexAttrib3sv },
+		{ "glVertexAttrib4Nbv", Resolve_glVertexAttrib4Nbv },
+		{ "glVertexAttrib4Niv", Resolve_glVertexAttrib4Niv },
+		{ "glVertexAttrib4Nsv", Resolve_glVertexAttrib4Nsv },
+		{ "glVertexAttrib4Nub", Resolve_glVertexAttrib4Nub },
+		{ "glVertexAttrib4Nubv", Resolve_glVertexAttrib4Nubv },
+		{ "glVertexAttrib4Nuiv", Resolve_glVertexAttrib4Nuiv },
+		{ "glVertexAttrib4Nusv", Resolve_glVertexAttrib4Nusv },
+		{ "glVertexAttrib4bv", Resolve_glVertexAttrib4bv },
+		{ "glVertexAttrib4d", Resolve_glVertexAttrib4d },
+		{ "glVertexAttrib4dv", Resolve_glVertexAttrib4dv },
+		{ "glVertexAttrib4f", Resolve_glVertexAttrib4f },
+		{ "glVertexAttrib4fv", Resolve_glVertexAttrib4fv },
+		{ "glVertexAttrib4iv", Resolve_glVertexAttrib4iv },
+		{ "glVertexAttrib4s", Resolve_glVertexAttrib4s },
+		{ "glVertexAttrib4sv", Resolve_glVertexAttrib4sv },
+		{ "glVertexAttrib4ubv", Resolve_glVertexAttrib4ubv },
+		{ "glVertexAttrib4uiv", Resolve_glVertexAttrib4uiv },
+		{ "glVertexAttrib4usv", Resolve_glVertexAttrib4usv },
+		{ "glVertexAttribBinding", Resolve_glVertexAttribBinding },
+		{ "glVertexAttribDivisor", Resolve_glVertexAttribDivisor },
+		{ "glVertexAttribFormat", Resolve_glVertexAttribFormat },
+		{ "glVertexAttribI1i", Resolve_glVertexAttribI1i },
+		{ "glVertexAttribI1iv", Resolve_glVertexAttribI1iv },
+		{ "glVertexAttribI1ui", Resolve_glVertexAttribI1ui },
+		{ "glVertexAttribI1uiv", Resolve_glVertexAttribI1uiv },
+		{ "glVertexAttribI2i", Resolve_glVertexAttribI2i },
+		{ "glVertexAttribI2iv", Resolve_glVertexAttribI2iv },
+		{ "glVertexAttribI2ui", Resolve_glVertexAttribI2ui },
+		{ "glVertexAttribI2uiv", Resolve_glVertexAttribI2uiv },
+		{ "glVertexAttribI3i", Resolve_glVertexAttribI3i },
+		{ "glVertexAttribI3iv", Resolve_glVertexAttribI3iv },
+		{ "glVertexAttribI3ui", Resolve_glVertexAttribI3ui },
+		{ "glVertexAttribI3uiv", Resolve_glVertexAttribI3uiv },
+		{ "glVertexAttribI4bv", Resolve_glVertexAttribI4bv },
+		{ "glVertexAttribI4i", Resolve_glVertexAttribI4i },
+		{ "glVertexAttribI4iv", Resolve_glVertexAttribI4iv },
+		{ "glVertexAttribI4sv", Resolve_glVertexAttribI4sv },
+		{ "glVertexAttribI4ubv", Resolve_glVertexAttribI4ubv },
+		{ "glVertexAttribI4ui", Resolve_glVertexAttribI4ui },
+		{ "glVertexAttribI4uiv", Resolve_glVertexAttribI4uiv },
+		{ "glVertexAttribI4usv", Resolve_glVertexAttribI4usv },
+		{ "glVertexAttribIFormat", Resolve_glVertexAttribIFormat },
+		{ "glVertexAttribIPointer", Resolve_glVertexAttribIPointer },
+		{ "glVertexAttribL1d", Resolve_glVertexAttribL1d },
+		{ "glVertexAttribL1dv", Resolve_glVertexAttribL1dv },
+		{ "glVertexAttribL2d", Resolve_glVertexAttribL2d },
+		{ "glVertexAttribL2dv", Resolve_glVertexAttribL2dv },
+		{ "glVertexAttribL3d", Resolve_glVertexAttribL3d },
+		{ "glVertexAttribL3dv", Resolve_glVertexAttribL3dv },
+		{ "glVertexAttribL4d", Resolve_glVertexAttribL4d },
+		{ "glVertexAttribL4dv", Resolve_glVertexAttribL4dv },
+		{ "glVertexAttribLFormat", Resolve_glVertexAttribLFormat },
+		{ "glVertexAttribLPointer", Resolve_glVertexAttribLPointer },
+		{ "glVertexAttribP1ui", Resolve_glVertexAttribP1ui },
+		{ "glVertexAttribP1uiv", Resolve_glVertexAttribP1uiv },
+		{ "glVertexAttribP2ui", Resolve_glVertexAttribP2ui },
+		{ "glVertexAttribP2uiv", Resolve_glVertexAttribP2uiv },
+		{ "glVertexAttribP3ui", Resolve_glVertexAttribP3ui },
+		{ "glVertexAttribP3uiv", Resolve_glVertexAttribP3uiv },
+		{ "glVertexAttribP4ui", Resolve_glVertexAttribP4ui },
+		{ "glVertexAttribP4uiv", Resolve_glVertexAttribP4uiv },
+		{ "glVertexAttribPointer", Resolve_glVertexAttribPointer },
+		{ "glVertexBindingDivisor", Resolve_glVertexBindingDivisor },
+		{ "glVertexP2ui", Resolve_glVertexP2ui },
+		{ "glVertexP2uiv", Resolve_glVertexP2uiv },
+		{ "glVertexP3ui", Resolve_glVertexP3ui },
+		{ "glVertexP3uiv", Resolve_glVertexP3uiv },
+		{ "glVertexP4ui", Resolve_glVertexP4ui },
+		{ "glVertexP4uiv", Resolve_glVertexP4uiv },
+		{ "glViewport", Resolve_glViewport },
+		{ "glViewportArrayv", Resolve_glViewportArrayv },
+		{ "glViewportIndexedf", Resolve_glViewportIndexedf },
+		{ "glViewportIndexedfv", Resolve_glViewportIndexedfv },
+		{ "glWaitSync", Resolve_glWaitSync },
+		{ "glWindowPos2d", Resolve_glWindowPos2d },
+		{ "glWindowPos2dv", Resolve_glWindowPos2dv },
+		{ "glWindowPos2f", Resolve_glWindowPos2f },
+		{ "glWindowPos2fv", Resolve_glWindowPos2fv },
+		{ "glWindowPos2i", Resolve_glWindowPos2i },
+		{ "glWindowPos2iv", Resolve_glWindowPos2iv },
+		{ "glWindowPos2s", Resolve_glWindowPos2s },
+		{ "glWindowPos2sv", Resolve_glWindowPos2sv },
+		{ "glWindowPos3d", Resolve_glWindowPos3d },
+		{ "glWindowPos3dv", Resolve_glWindowPos3dv },
+		{ "glWindowPos3f", Resolve_glWindowPos3f },
+		{ "glWindowPos3fv", Resolve_glWindowPos3fv },
+		{ "glWindowPos3i", Resolve_glWindowPos3i },
+		{ "glWindowPos3iv", Resolve_glWindowPos3iv },
+		{ "glWindowPos3s", Resolve_glWindowPos3s },
+		{ "glWindowPos3sv", Resolve_glWindowPos3sv },
+	};
+
+	static constexpr size_t NumLazyResolvers = std::size(LazyResolvers);
+
+	// 返回函数名在 `LazyResolvers` 里的下标，找不到时返回 `NumLazyResolvers`
+	static size_t FindResolver(const char* Symbol)
+	{
+		size_t Lo = 0, Hi = NumLazyResolvers;
+		while (Lo < Hi)
+		{
+			size_t Mid = (Lo + Hi) / 2;
+			if (strcmp(LazyResolvers[Mid].Symbol, Symbol) < 0) Lo = Mid + 1;
+			else Hi = Mid;
+		}
+		if (Lo == NumLazyResolvers || strcmp(LazyResolvers[Lo].Symbol, Symbol)) return NumLazyResolvers;
+		return Lo;
+	}
+
+	static void ResolveAll(Version46& c)
+	{
+		for (auto& r : LazyResolvers) r.Resolve(c);
+	}
+
+	size_t Version46::Preload(const char* const* Symbols, size_t Count)
+	{
+		if (Mode != LoadMode::Lazy) return 0;
+		for (size_t i = 0; i < Count; i++)
+		{
+			size_t Index = FindResolver(Symbols[i]);
+			if (Index == NumLazyResolvers)
+			{
+				throw std::invalid_argument(std::string("Unknown OpenGL function `") + Symbols[i] + "`.");
+			}
+			LazyResolvers[Index].Resolve(*this);
+		}
+		return Count;
+	}
+
+	size_t Version46::Preload(std::initializer_list<const char*> Symbols)
+	{
+		return Preload(Symbols.begin(), Symbols.size());
+	}
+
+	size_t Version46::PreloadAll()
+	{
+		if (Mode != LoadMode::Lazy) return 0;
+		ResolveAll(*this);
+		return NumLazyResolvers;
+	}
+
+	void* Version10::LookupProc(const char* symbol)
+	{
+		if (ProcCache) return ProcCache->Find(symbol);
+		NumProcLookups++;
+		return GetProcAddress(symbol);
+	}
+
+	bool Version10::HasSameDriver(const Version10& Other) const
+	{
+		return GetProcAddress == Other.GetProcAddress && Vendor == Other.Vendor && Renderer == Other.Renderer && Version == Other.Version;
+	}
+
+	ProcAddressCache::ProcAddressCache(Func_GetProcAddress GetProcAddress, const std::string& Vendor, const std::string& Renderer, const std::string& Version) :
+		GetProcAddress(GetProcAddress),
+		Vendor(Vendor),
+		Renderer(Renderer),
+		Version(Version),
+		Procs(NumLazyResolvers)
+	{
+		for (size_t i = 0; i < NumLazyResolvers; i++) Procs[i] = GetProcAddress(LazyResolvers[i].Symbol);
+	}
+
+	void* ProcAddressCache::Find(const char* symbol) const
+	{
+		size_t Index = FindResolver(symbol);
+		if (Index == NumLazyResolvers) return GetProcAddress(symbol);
+		return Procs[Index];
+	}
+
+	size_t ProcAddressCache::GetNumProcs() const
+	{
+		return Procs.size();
+	}
+
+	bool ProcAddressCache::Matches(Func_GetProcAddress GetProcAddress, const std::string& Vendor, const std::string& Renderer, const std::string& Version) const
+	{
+		return this->GetProcAddress == GetProcAddress && this->Vendor == Vendor && this->Renderer == Renderer && this->Version == Version;
+	}
+
+	// 只持有弱引用，最后一个使用某个缓存的上下文销毁后缓存也随之释放
+	static std::mutex CachesLock;
+	static std::vector<std::weak_ptr<const ProcAddressCache>> Caches;
+
+	std::shared_ptr<const ProcAddressCache> ProcAddressCache::Acquire(Func_GetProcAddress GetProcAddress, const std::string& Vendor, const std::string& Renderer, const std::string& Version)
+	{
+		auto lock = std::scoped_lock(CachesLock);
+		for (auto it = Caches.begin(); it != Caches.end();)
+		{
+			auto Cache = it->lock();
+			if (!Cache)
+			{
+				it = Caches.erase(it);
+				continue;
+			}
+			if (Cache->Matches(GetProcAddress, Vendor, Renderer, Version)) return Cache;
+			it++;
+		}
+
+		// 不同的驱动各自建立一个缓存
+		auto Cache = std::make_shared<const ProcAddressCache>(GetProcAddress, Vendor, Renderer, Version);
+		Caches.push_back(Cache);
+		return Cache;
+	}
+
+	size_t ProcAddressCache::GetNumCaches()
+	{
+		auto lock = std::scoped_lock(CachesLock);
+		size_t Count = 0;
+		for (auto& t : Caches) if (!t.expired()) Count++;
+		return Count;
 	}
 
 
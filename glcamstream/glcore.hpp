@@ -4,6 +4,9 @@
 #include<cstdint>
 #include<cstddef>
 #include<stdexcept>
+#include<initializer_list>
+#include<memory>
+#include<vector>
 
 namespace GL
 {
@@ -45,6 +48,17 @@ namespace GL
 	typedef int8_t GLbyte;
 	typedef unsigned short GLushort;
 
+	// `Lazy` 模式下构造时不查询函数地址，每个函数指针先指向一个跳板函数，第一次调用时才查询并替换为真正的地址
+	// `Cached` 模式下从进程内的函数地址缓存里取地址，同一个驱动的所有函数只向驱动查询一次，之后的上下文构造时不再查询
+	enum class LoadMode
+	{
+		Eager,
+		Lazy,
+		Cached
+	};
+
+	class ProcAddressCache;
+
 	class Version10
 	{
 	protected:
@@ -97,27 +111,43 @@ namespace GL
 		using PFNGLDEPTHRANGEPROC = void (APIENTRYP) (GLdouble n, GLdouble f);
 		using PFNGLVIEWPORTPROC = void (APIENTRYP) (GLint x, GLint y, GLsizei width, GLsizei height);
 		Func_GetProcAddress GetProcAddress;
+		LoadMode Mode;
+		size_t NumProcLookups = 0;
+		std::shared_ptr<const ProcAddressCache> ProcCache;
 		int Ver_Major;
 		int Ver_Minor;
 		int Ver_Release;
 		std::string Vendor;
 		std::string Renderer;
 		std::string Version;
+		Version10(Func_GetProcAddress GetProcAddress, LoadMode Mode);
 
 	private:
 		bool Available;
 
 	public:
+		// 有函数地址缓存时从缓存里取，否则向驱动查询
+		void* LookupProc(const char* symbol);
+
+		// `GetProcAddress` 和 (vendor, renderer, version) 都相同的上下文查到的函数地址也相同
+		bool HasSameDriver(const Version10& Other) const;
+
 		template<typename FuncType>
 		FuncType GetProc(const char* symbol, FuncType DefaultBehaviorFunc)
 		{
-			void *ProcAddress = GetProcAddress(symbol);
+			void *ProcAddress = LookupProc(symbol);
 			if (!ProcAddress)
 			{
 				return DefaultBehaviorFunc;
 			}
 			return reinterpret_cast<FuncType>(ProcAddress);
 		}
+		template<typename FuncType>
+		FuncType GetProc(const char* symbol, FuncType DefaultBehaviorFunc, FuncType LazyFunc)
+		{
+			if (Mode != LoadMode::Eager) return LazyFunc;
+			return GetProc(symbol, DefaultBehaviorFunc);
+		}
 		inline void GetVersion(int& Major, int& Minor, int& Release)
 		{
 			Major = Ver_Major;
@@ -127,6 +157,9 @@ namespace GL
 		inline std::string GetVendor() { return Vendor; }
 		inline std::string GetRenderer() { return Renderer; }
 		inline std::string GetVersion() { return Version; }
+		inline LoadMode GetLoadMode() const { return Mode; }
+		inline size_t GetNumProcLookups() const { return NumProcLookups; }
+		inline std::shared_ptr<const ProcAddressCache> GetProcAddressCache() const { return ProcCache; }
 		Version10() = delete;
 		Version10(Func_GetProcAddress GetProcAddress);
 		inline bool Version10IsAvailable() { return Available; }
@@ -361,6 +394,7 @@ namespace GL
 	class Version11 : public Version10
 	{
 	protected:
+		Version11(Func_GetProcAddress GetProcAddress, LoadMode Mode);
 		using PFNGLDRAWARRAYSPROC = void (APIENTRYP) (GLenum mode, GLint first, GLsizei count);
 		using PFNGLDRAWELEMENTSPROC = void (APIENTRYP) (GLenum mode, GLsizei count, GLenum type, const void* indices);
 		using PFNGLGETPOINTERVPROC = void (APIENTRYP) (GLenum pname, void** params);
@@ -436,6 +470,7 @@ namespace GL
 	class Version12 : public Version11
 	{
 	protected:
+		Version12(Func_GetProcAddress GetProcAddress, LoadMode Mode);
 		using PFNGLDRAWRANGEELEMENTSPROC = void (APIENTRYP) (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void* indices);
 		using PFNGLTEXIMAGE3DPROC = void (APIENTRYP) (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void* pixels);
 		using PFNGLTEXSUBIMAGE3DPROC = void (APIENTRYP) (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void* pixels);
@@ -501,6 +536,7 @@ namespace GL
 	class Version13 : public Version12
 	{
 	protected:
+		Version13(Func_GetProcAddress GetProcAddress, LoadMode Mode);
 		using PFNGLACTIVETEXTUREPROC = void (APIENTRYP) (GLenum texture);
 		using PFNGLSAMPLECOVERAGEPROC = void (APIENTRYP) (GLfloat value, GLboolean invert);
 		using PFNGLCOMPRESSEDTEXIMAGE3DPROC = void (APIENTRYP) (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void* data);
@@ -705,6 +741,7 @@ namespace GL
 	class Version14 : public Version13
 	{
 	protected:
+		Version14(Func_GetProcAddress GetProcAddress, LoadMode Mode);
 		using PFNGLBLENDFUNCSEPARATEPROC = void (APIENTRYP) (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha);
 		using PFNGLMULTIDRAWARRAYSPROC = void (APIENTRYP) (GLenum mode, const GLint* first, const GLsizei* count, GLsizei drawcount);
 		using PFNGLMULTIDRAWELEMENTSPROC = void (APIENTRYP) (GLenum mode, const GLsizei* count, GLenum type, const void* const* indices, GLsizei drawcount);
@@ -867,6 +904,7 @@ namespace GL
 	class Version15 : public Version14
 	{
 	protected:
+		Version15(Func_GetProcAddress GetProcAddress, LoadMode Mode);
 		using PFNGLGENQUERIESPROC = void (APIENTRYP) (GLsizei n, GLuint* ids);
 		using PFNGLDELETEQUERIESPROC = void (APIENTRYP) (GLsizei n, const GLuint* ids);
 		using PFNGLISQUERYPROC = GLboolean (APIENTRYP) (GLuint id);
@@ -972,6 +1010,7 @@ namespace GL
 	class Version20 : public Version15
 	{
 	protected:
+		Version20(Func_GetProcAddress GetProcAddress, LoadMode Mode);
 		using PFNGLBLENDEQUATIONSEPARATEPROC = void (APIENTRYP) (GLenum modeRGB, GLenum modeAlpha);
 		using PFNGLDRAWBUFFERSPROC = void (APIENTRYP) (GLsizei n, const GLenum* bufs);
 		using PFNGLSTENCILOPSEPARATEPROC = void (APIENTRYP) (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass);
@@ -1281,6 +1320,7 @@ namespace GL
 	class Version21 : public Version20
 	{
 	protected:
+		Version21(Func_GetProcAddress GetProcAddress, LoadMode Mode);
 		using PFNGLUNIFORMMATRIX2X3FVPROC = void (APIENTRYP) (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value);
 		using PFNGLUNIFORMMATRIX3X2FVPROC = void (APIENTRYP) (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value);
 		using PFNGLUNIFORMMATRIX2X4FVPROC = void (APIENTRYP) (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value);
@@ -1333,6 +1373,7 @@ namespace GL
 	class Version30 : public Version21
 	{
 	protected:
+		Version30(Func_GetProcAddress GetProcAddress, LoadMode Mode);
 		using PFNGLCOLORMASKIPROC = void (APIENTRYP) (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a);
 		using PFNGLGETBOOLEANI_VPROC = void (APIENTRYP) (GLenum target, GLuint index, GLboolean* data);
 		using PFNGLGETINTEGERI_VPROC = void (APIENTRYP) (GLenum target, GLuint index, GLint* data);
@@ -1766,6 +1807,7 @@ namespace GL
 	class Version31 : public Version30
 	{
 	protected:
+		Version31(Func_GetProcAddress GetProcAddress, LoadMode Mode);
 		using PFNGLDRAWARRAYSINSTANCEDPROC = void (APIENTRYP) (GLenum mode, GLint first, GLsizei count, GLsizei instancecount);
 		using PFNGLDRAWELEMENTSINSTANCEDPROC = void (APIENTRYP) (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount);
 		using PFNGLTEXBUFFERPROC = void (APIENTRYP) (GLenum target, GLenum internalformat, GLuint buffer);
@@ -1870,6 +1912,7 @@ namespace GL
 	class Version32 : public Version31
 	{
 	protected:
+		Version32(Func_GetProcAddress GetProcAddress, LoadMode Mode);
 		using PFNGLDRAWELEMENTSBASEVERTEXPROC = void (APIENTRYP) (GLenum mode, GLsizei count, GLenum type, const void* indices, GLint basevertex);
 		using PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC = void (APIENTRYP) (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void* indices, GLint basevertex);
 		using PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC = void (APIENTRYP) (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount, GLint basevertex);
@@ -1988,6 +2031,7 @@ namespace GL
 	class Version33 : public Version32
 	{
 	protected:
+		Version33(Func_GetProcAddress GetProcAddress, LoadMode Mode);
 		using PFNGLBINDFRAGDATALOCATIONINDEXEDPROC = void (APIENTRYP) (GLuint program, GLuint colorNumber, GLuint index, const GLchar* name);
 		using PFNGLGETFRAGDATAINDEXPROC = GLint (APIENTRYP) (GLuint program, const GLchar* name);
 		using PFNGLGENSAMPLERSPROC = void (APIENTRYP) (GLsizei count, GLuint* samplers);
@@ -2136,6 +2180,7 @@ namespace GL
 	class Version40 : public Version33
 	{
 	protected:
+		Version40(Func_GetProcAddress GetProcAddress, LoadMode Mode);
 		using PFNGLMINSAMPLESHADINGPROC = void (APIENTRYP) (GLfloat value);
 		using PFNGLBLENDEQUATIONIPROC = void (APIENTRYP) (GLuint buf, GLenum mode);
 		using PFNGLBLENDEQUATIONSEPARATEIPROC = void (APIENTRYP) (GLuint buf, GLenum modeRGB, GLenum modeAlpha);
@@ -2325,6 +2370,7 @@ namespace GL
 	class Version41 : public Version40
 	{
 	protected:
+		Version41(Func_GetProcAddress GetProcAddress, LoadMode Mode);
 		using PFNGLRELEASESHADERCOMPILERPROC = void (APIENTRYP) (void);
 		using PFNGLSHADERBINARYPROC = void (APIENTRYP) (GLsizei count, const GLuint* shaders, GLenum binaryFormat, const void* binary, GLsizei length);
 		using PFNGLGETSHADERPRECISIONFORMATPROC = void (APIENTRYP) (GLenum shadertype, GLenum precisiontype, GLint* range, GLint* precision);
@@ -2572,6 +2618,7 @@ namespace GL
 	class Version42 : public Version41
 	{
 	protected:
+		Version42(Func_GetProcAddress GetProcAddress, LoadMode Mode);
 		using PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC = void (APIENTRYP) (GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance);
 		using PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC = void (APIENTRYP) (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount, GLuint baseinstance);
 		using PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC = void (APIENTRYP) (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance);
@@ -2725,6 +2772,7 @@ namespace GL
 	class Version43 : public Version42
 	{
 	protected:
+		Version43(Func_GetProcAddress GetProcAddress, LoadMode Mode);
 		using PFNGLCLEARBUFFERDATAPROC = void (APIENTRYP) (GLenum target, GLenum internalformat, GLenum format, GLenum type, const void* data);
 		using PFNGLCLEARBUFFERSUBDATAPROC = void (APIENTRYP) (GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void* data);
 		using PFNGLDISPATCHCOMPUTEPROC = void (APIENTRYP) (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z);
@@ -3086,6 +3134,7 @@ namespace GL
 	class Version44 : public Version43
 	{
 	protected:
+		Version44(Func_GetProcAddress GetProcAddress, LoadMode Mode);
 		using PFNGLBUFFERSTORAGEPROC = void (APIENTRYP) (GLenum target, GLsizeiptr size, const void* data, GLbitfield flags);
 		using PFNGLCLEARTEXIMAGEPROC = void (APIENTRYP) (GLuint texture, GLint level, GLenum format, GLenum type, const void* data);
 		using PFNGLCLEARTEXSUBIMAGEPROC = void (APIENTRYP) (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void* data);
@@ -3139,6 +3188,7 @@ namespace GL
 	class Version45 : public Version44
 	{
 	protected:
+		Version45(Func_GetProcAddress GetProcAddress, LoadMode Mode);
 		using PFNGLCLIPCONTROLPROC = void (APIENTRYP) (GLenum origin, GLenum depth);
 		using PFNGLCREATETRANSFORMFEEDBACKSPROC = void (APIENTRYP) (GLsizei n, GLuint* ids);
 		using PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC = void (APIENTRYP) (GLuint xfb, GLuint index, GLuint buffer);
@@ -3443,7 +3493,16 @@ namespace GL
 
 	public:
 		Version46() = delete;
-		Version46(Func_GetProcAddress GetProcAddress);
+		Version46(Func_GetProcAddress GetProcAddress, LoadMode Mode = LoadMode::Eager);
+		~Version46();
+
+		// 跳板函数按当前线程的当前上下文查询地址并转发调用，切换 GL 上下文时要一起调用。没有当前懒加载上下文的线程调用跳板函数会抛出 `NullFuncPtrException`
+		void MakeLazyCurrent();
+
+		// 提前查询指定的函数（如 "glDrawArrays"），避免第一次调用时的查询。返回查询的个数，非懒加载模式下什么也不做
+		size_t Preload(std::initializer_list<const char*> Symbols);
+		size_t Preload(const char* const* Symbols, size_t Count);
+		size_t PreloadAll();
 		inline bool Version46IsAvailable() { return Available; }
 
 		static constexpr GLenum SHADER_BINARY_FORMAT_SPIR_V = 0x9551;
@@ -3475,4 +3534,30 @@ namespace GL
 		PFNGLPOLYGONOFFSETCLAMPPROC PolygonOffsetClamp;
 
 	};
+
+	// 按 (GetProcAddress, vendor, renderer, version) 缓存的函数地址。同一个驱动的上下文函数地址相同，可以从缓存里取而不必各自向驱动查询。
+	// 只是查询的缓存，上下文仍然把地址复制到自己的函数指针里。建立后不再修改，多个线程可以同时读取
+	class ProcAddressCache
+	{
+	protected:
+		Func_GetProcAddress GetProcAddress;
+		std::string Vendor;
+		std::string Renderer;
+		std::string Version;
+		std::vector<void*> Procs;
+
+	public:
+		ProcAddressCache(Func_GetProcAddress GetProcAddress, const std::string& Vendor, const std::string& Renderer, const std::string& Version);
+		ProcAddressCache(const ProcAddressCache&) = delete;
+		ProcAddressCache& operator = (const ProcAddressCache&) = delete;
+
+		// 找不到或驱动不支持时返回 `nullptr`
+		void* Find(const char* symbol) const;
+		size_t GetNumProcs() const;
+		bool Matches(Func_GetProcAddress GetProcAddress, const std::string& Vendor, const std::string& Renderer, const std::string& Version) const;
+
+		// 返回匹配的缓存，没有时在当前线程的当前上下文上查询并建立一个。不再被任何上下文引用的缓存会被释放
+		static std::shared_ptr<const ProcAddressCache> Acquire(Func_GetProcAddress GetProcAddress, const std::string& Vendor, const std::string& Renderer, const std::string& Version);
+		static size_t GetNumCaches();
+	};
 };
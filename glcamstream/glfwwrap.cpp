@@ -17,9 +17,10 @@ namespace GLFWWrap
 		return reinterpret_cast<void*>(glfwGetProcAddress(symbol));
 	}
 
-	GLCtxType::GLCtxType(GLFWwindowType& w) :
+	GLCtxType::GLCtxType(GLFWwindowType& w, GL::LoadMode Mode) :
 		w(w),
-		Version46(glfw_GetProcAddress)
+		Version46(glfw_GetProcAddress, Mode),
+		State(*this)
 	{
 	}
 
@@ -27,12 +28,13 @@ namespace GLFWWrap
 	{
 		auto window = *w.Internal;
 		glfwMakeContextCurrent(window);
+		MakeLazyCurrent();
 	}
 
 	std::unordered_map<GLFWwindow*, GLFWwindowType&> GLFWwindowType::Instances;
 	std::mutex GLFWwindowType::InstancesLock;
 
-	GLFWwindowType::GLFWwindowType()
+	GLFWwindowType::GLFWwindowType(GL::LoadMode Mode)
 	{
 		auto lock = std::scoped_lock(InstancesLock);
 		glfwSetErrorCallback(ErrorCallBack);
@@ -49,7 +51,7 @@ namespace GLFWWrap
 		}
 		glfwSetKeyCallback(window, KeyCallback);
 		glfwMakeContextCurrent(window);
-		GLCtx = std::make_shared<GLCtxType>(*this);
+		GLCtx = std::make_shared<GLCtxType>(*this, Mode);
 	}
 
 	void GLFWwindowType::ErrorCallBack(int error, const char* description)
@@ -79,6 +81,7 @@ namespace GLFWWrap
 	{
 		auto window = *Internal;
 		glfwSwapBuffers(window);
+		GLCtx->State.EndFrame();
 	}
 
 	void GLFWwindowType::EnterMainLoop()
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "glcore.hpp"
+#include "glstate.hpp"
 
 #include <memory>
 #include <stdexcept>
@@ -28,8 +29,11 @@ namespace GLFWWrap
 		std::mutex CtxLock;
 
 	public:
-		GLCtxType(GLFWwindowType& w);
+		GLCtxType(GLFWwindowType& w, GL::LoadMode Mode = GL::LoadMode::Eager);
 		void MakeCurrent();
+
+		// ״̬棬 `const GLCtxType&` 
+		mutable GL::StateCache State;
 	};
 
 	class GLFWwindowType
@@ -44,7 +48,7 @@ namespace GLFWWrap
 		static void KeyCallback(GLFWwindow* window, int key, int scancode, int action, int mods);
 
 	public:
-		GLFWwindowType();
+		GLFWwindowType(GL::LoadMode Mode = GL::LoadMode::Cached);
 		~GLFWwindowType();
 
 		void SetWindowShouldClose() const;
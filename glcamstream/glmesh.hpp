@@ -45,7 +45,7 @@ namespace GLRenderer
 			{
 				if (NumElements)
 				{
-					gl.BindBuffer(gl.ELEMENT_ARRAY_BUFFER, ElementsBuffer);
+					gl.State.BindBuffer(gl.ELEMENT_ARRAY_BUFFER, ElementsBuffer);
 					if constexpr (std::is_same_v<Te, GLubyte>)
 						gl.DrawElementsInstanced(gl.TRIANGLES, NumElements, gl.UNSIGNED_BYTE, nullptr, InstanceCount);
 					else if constexpr (std::is_same_v<Te, GLushort>)
@@ -54,7 +54,6 @@ namespace GLRenderer
 						gl.DrawElementsInstanced(gl.TRIANGLES, NumElements, gl.UNSIGNED_INT, nullptr, InstanceCount);
 					else
 						throw std::invalid_argument("Could not cast `ElementsType` to a type.");
-					gl.BindBuffer(gl.ELEMENT_ARRAY_BUFFER, 0);
 				}
 				else
 				{
@@ -65,7 +64,7 @@ namespace GLRenderer
 			{
 				if (NumElements)
 				{
-					gl.BindBuffer(gl.ELEMENT_ARRAY_BUFFER, ElementsBuffer);
+					gl.State.BindBuffer(gl.ELEMENT_ARRAY_BUFFER, ElementsBuffer);
 					if constexpr (std::is_same_v<Te, GLubyte>)
 						gl.DrawElements(gl.TRIANGLES, NumElements, gl.UNSIGNED_BYTE, nullptr);
 					else if constexpr (std::is_same_v<Te, GLushort>)
@@ -74,7 +73,6 @@ namespace GLRenderer
 						gl.DrawElements(gl.TRIANGLES, NumElements, gl.UNSIGNED_INT, nullptr);
 					else
 						throw std::invalid_argument("Could not cast `ElementsType` to a type.");
-					gl.BindBuffer(gl.ELEMENT_ARRAY_BUFFER, 0);
 				}
 				else
 				{
@@ -96,9 +94,8 @@ namespace GLRenderer
 			if (!NumVertices) throw std::invalid_argument("Meshes must have vertices.");
 
 			gl.GenBuffers(1, &VertexBuffer);
-			gl.BindBuffer(gl.ARRAY_BUFFER, VertexBuffer);
+			gl.State.BindBuffer(gl.ARRAY_BUFFER, VertexBuffer);
 			gl.BufferData(gl.ARRAY_BUFFER, sizeof(Vertices[0]) * Vertices.size(), &Vertices[0], gl.STATIC_DRAW);
-			gl.BindBuffer(gl.ARRAY_BUFFER, 0);
 		}
 		Mesh(const GLCtxType& GLCtx, const std::vector<Tv>& Vertices, const std::vector<Te>& Indices) :
 			Mesh(GLCtx, Vertices)
@@ -106,10 +103,11 @@ namespace GLRenderer
 			NumElements = GLsizei(Indices.size());
 			if (NumElements)
 			{
+				// 元素缓冲区的绑定属于 VAO，不能绑定到别人留下的 VAO 上
 				gl.GenBuffers(1, &ElementsBuffer);
-				gl.BindBuffer(gl.ELEMENT_ARRAY_BUFFER, ElementsBuffer);
+				gl.State.BindVertexArray(0);
+				gl.State.BindBuffer(gl.ELEMENT_ARRAY_BUFFER, ElementsBuffer);
 				gl.BufferData(gl.ELEMENT_ARRAY_BUFFER, sizeof(Indices[0]) * Indices.size(), &Indices[0], gl.STATIC_DRAW);
-				gl.BindBuffer(gl.ELEMENT_ARRAY_BUFFER, 0);
 			}
 		}
 		Mesh(const GLCtxType& GLCtx, const std::vector<Tv>& Vertices, const std::vector<Te>& Indices, const std::vector<Ti>& Instances) :
@@ -119,20 +117,20 @@ namespace GLRenderer
 			if (NumInstances)
 			{
 				gl.GenBuffers(1, &InstancesBuffer);
-				gl.BindBuffer(gl.ARRAY_BUFFER, InstancesBuffer);
+				gl.State.BindBuffer(gl.ARRAY_BUFFER, InstancesBuffer);
 				gl.BufferData(gl.ARRAY_BUFFER, sizeof(Instances[0]) * Instances.size(), &Instances[0], gl.DYNAMIC_DRAW);
-				gl.BindBuffer(gl.ARRAY_BUFFER, 0);
 			}
 		}
 		~Mesh()
 		{
+			for (auto& Pipeline : Pipelines) gl.State.DeleteVertexArrays(1, &Pipeline.second);
 			GLuint Buffers[3] = { VertexBuffer , ElementsBuffer, InstancesBuffer };
-			gl.DeleteBuffers(3, Buffers);
+			gl.State.DeleteBuffers(3, Buffers);
 		}
 
 		void DescribeArrayBuffer(const Program& ShaderProgram)
 		{
-			gl.BindBuffer(gl.ARRAY_BUFFER, VertexBuffer);
+			gl.State.BindBuffer(gl.ARRAY_BUFFER, VertexBuffer);
 			if constexpr (Tv::HasPosition)
 			{
 				ShaderProgram.SetVertexAttrib<Tv::PositionDim, Tv::PositionType::value_type>
@@ -148,13 +146,11 @@ namespace GLRenderer
 				ShaderProgram.SetVertexAttrib<Tv::NormalDim, Tv::NormalType::value_type>
 					("iNormal", reinterpret_cast<void*>(Tv::NormalOffset), false, sizeof(Tv));
 			}
-			gl.BindBuffer(gl.ARRAY_BUFFER, 0);
 		}
 
 		void DescribeInstanceBuffer(const Program& ShaderProgram)
 		{
-			gl.BindBuffer(gl.ARRAY_BUFFER, InstancesBuffer);
-			gl.BindBuffer(gl.ARRAY_BUFFER, 0);
+			gl.State.BindBuffer(gl.ARRAY_BUFFER, InstancesBuffer);
 		}
 
 		void Draw(const Program& ShaderProgram, GLsizei InstanceCount)
@@ -163,13 +159,13 @@ namespace GLRenderer
 
 			try
 			{
-				gl.BindVertexArray(GetAssociatedVAO(ShaderProgram));
+				gl.State.BindVertexArray(GetAssociatedVAO(ShaderProgram));
 			}
 			catch (const std::out_of_range&)
 			{
 				GLuint VAO = 0;
 				gl.GenVertexArrays(1, &VAO);
-				gl.BindVertexArray(VAO);
+				gl.State.BindVertexArray(VAO);
 				Pipelines[ShaderProgram] = VAO;
 				DescribeArrayBuffer(ShaderProgram);
 				DescribeInstanceBuffer(ShaderProgram);
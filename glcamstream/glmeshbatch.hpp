@@ -0,0 +1,272 @@
+#pragma once
+
+#include "glfwwrap.hpp"
+#include "glprogram.hpp"
+#include "glmesh.hpp"
+
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+#include <stdexcept>
+
+namespace GLRenderer
+{
+	using namespace GL;
+
+	// `MultiDrawElementsIndirect` 的一条绘制命令，布局由 GL 规定
+	struct DrawElementsIndirectCommand
+	{
+		GLuint Count;
+		GLuint InstanceCount;
+		GLuint FirstIndex;
+		GLint BaseVertex;
+		GLuint BaseInstance;
+	};
+
+	//-------------------------------------------------------------------
+	// MeshBatch
+	//
+	// Packs the vertices and indices of many meshes into one vertex and
+	// one index buffer, keeps one indirect draw command per mesh in a
+	// `DRAW_INDIRECT_BUFFER`, and draws the whole batch with a single
+	// `MultiDrawElementsIndirect`. Each mesh keeps its own indices, the
+	// command's base vertex moves them to where the mesh was packed.
+	//
+	// Each draw also has a `Td` in a shader storage buffer, which the
+	// vertex shader reads as `DrawData[gl_DrawID]` from a `std430`
+	// buffer block at `DrawDataBinding`; `Td` must match that layout.
+	// The capacities are fixed when the batch is created.
+	//-------------------------------------------------------------------
+
+	template <typename Tv, ElementsType Te, typename Td>
+	class MeshBatch
+	{
+	protected:
+		const GLCtxType& gl;
+		std::unordered_map<GLuint, GLuint> Pipelines;
+
+		GLsizei MaxVertices;
+		GLsizei MaxIndices;
+		GLsizei MaxDraws;
+		GLsizei NumVertices = 0;
+		GLsizei NumIndices = 0;
+
+		std::vector<DrawElementsIndirectCommand> Commands;
+		std::vector<Td> DrawData;
+
+		// 命令或绘制数据改动过的范围，绘制前才上传
+		size_t DirtyBegin = 0;
+		size_t DirtyEnd = 0;
+
+		static constexpr GLenum GetIndexType()
+		{
+			if constexpr (std::is_same_v<Te, GLubyte>) return GLCtxType::UNSIGNED_BYTE;
+			else if constexpr (std::is_same_v<Te, GLushort>) return GLCtxType::UNSIGNED_SHORT;
+			else return GLCtxType::UNSIGNED_INT;
+		}
+
+		void MarkDirty(size_t Draw)
+		{
+			if (DirtyBegin == DirtyEnd)
+			{
+				DirtyBegin = Draw;
+				DirtyEnd = Draw + 1;
+			}
+			else
+			{
+				DirtyBegin = std::min(DirtyBegin, Draw);
+				DirtyEnd = std::max(DirtyEnd, Draw + 1);
+			}
+		}
+
+		size_t AddCommand(GLsizei MeshVertices, GLsizei MeshIndices, GLsizei InstanceCount, const Td& Data)
+		{
+			DrawElementsIndirectCommand Cmd;
+			Cmd.Count = GLuint(MeshIndices);
+			Cmd.InstanceCount = GLuint(InstanceCount);
+			Cmd.FirstIndex = GLuint(NumIndices);
+			Cmd.BaseVertex = NumVertices;
+			Cmd.BaseInstance = 0;
+			Commands.push_back(Cmd);
+			DrawData.push_back(Data);
+			NumVertices += MeshVertices;
+			NumIndices += MeshIndices;
+			MarkDirty(Commands.size() - 1);
+			return Commands.size() - 1;
+		}
+
+		void CheckCapacity(GLsizei MeshVertices, GLsizei MeshIndices) const
+		{
+			if (!MeshVertices || !MeshIndices) throw std::invalid_argument("`MeshBatch` needs meshes with vertices and indices.");
+			if (GLsizei(Commands.size()) >= MaxDraws) throw std::out_of_range("`MeshBatch` is full of draws.");
+			if (MeshVertices > MaxVertices - NumVertices) throw std::out_of_range("`MeshBatch` has no room for " + std::to_string(MeshVertices) + " more vertices.");
+			if (MeshIndices > MaxIndices - NumIndices) throw std::out_of_range("`MeshBatch` has no room for " + std::to_string(MeshIndices) + " more indices.");
+		}
+
+		void Upload()
+		{
+			if (DirtyBegin == DirtyEnd) return;
+			gl.State.BindBuffer(gl.DRAW_INDIRECT_BUFFER, CommandsBuffer);
+			gl.BufferSubData(gl.DRAW_INDIRECT_BUFFER, sizeof(DrawElementsIndirectCommand) * DirtyBegin, sizeof(DrawElementsIndirectCommand) * (DirtyEnd - DirtyBegin), &Commands[DirtyBegin]);
+			gl.State.BindBuffer(gl.SHADER_STORAGE_BUFFER, DrawDataBuffer);
+			gl.BufferSubData(gl.SHADER_STORAGE_BUFFER, sizeof(Td) * DirtyBegin, sizeof(Td) * (DirtyEnd - DirtyBegin), &DrawData[DirtyBegin]);
+			DirtyBegin = DirtyEnd = 0;
+		}
+
+		void DescribeArrayBuffer(const Program& ShaderProgram)
+		{
+			gl.State.BindBuffer(gl.ARRAY_BUFFER, VertexBuffer);
+			if constexpr (Tv::HasPosition)
+			{
+				ShaderProgram.SetVertexAttrib<Tv::PositionDim, Tv::PositionType::value_type>
+					("iPosition", reinterpret_cast<void*>(Tv::PositionOffset), false, sizeof(Tv));
+			}
+			if constexpr (Tv::HasTexCoord)
+			{
+				ShaderProgram.SetVertexAttrib<Tv::TexCoordDim, Tv::TexCoordType::value_type>
+					("iTexCoord", reinterpret_cast<void*>(Tv::TexCoordOffset), false, sizeof(Tv));
+			}
+			if constexpr (Tv::HasNormal)
+			{
+				ShaderProgram.SetVertexAttrib<Tv::NormalDim, Tv::NormalType::value_type>
+					("iNormal", reinterpret_cast<void*>(Tv::NormalOffset), false, sizeof(Tv));
+			}
+			gl.State.BindBuffer(gl.ELEMENT_ARRAY_BUFFER, ElementsBuffer);
+		}
+
+	public:
+		GLuint VertexBuffer = 0;
+		GLuint ElementsBuffer = 0;
+		GLuint CommandsBuffer = 0;
+		GLuint DrawDataBuffer = 0;
+		GLuint DrawDataBinding = 0;
+
+		MeshBatch(const GLCtxType& GLCtx, GLsizei MaxVertices, GLsizei MaxIndices, GLsizei MaxDraws, GLuint DrawDataBinding = 0) :
+			gl(GLCtx),
+			MaxVertices(MaxVertices),
+			MaxIndices(MaxIndices),
+			MaxDraws(MaxDraws),
+			DrawDataBinding(DrawDataBinding)
+		{
+			if (MaxVertices <= 0 || MaxIndices <= 0 || MaxDraws <= 0) throw std::invalid_argument("The capacities of `MeshBatch` must be positive.");
+			Commands.reserve(MaxDraws);
+			DrawData.reserve(MaxDraws);
+
+			gl.GenBuffers(1, &VertexBuffer);
+			gl.State.BindBuffer(gl.ARRAY_BUFFER, VertexBuffer);
+			gl.BufferData(gl.ARRAY_BUFFER, sizeof(Tv) * MaxVertices, nullptr, gl.STATIC_DRAW);
+
+			gl.GenBuffers(1, &ElementsBuffer);
+			gl.State.BindVertexArray(0);
+			gl.State.BindBuffer(gl.ELEMENT_ARRAY_BUFFER, ElementsBuffer);
+			gl.BufferData(gl.ELEMENT_ARRAY_BUFFER, sizeof(Te) * MaxIndices, nullptr, gl.STATIC_DRAW);
+
+			gl.GenBuffers(1, &CommandsBuffer);
+			gl.State.BindBuffer(gl.DRAW_INDIRECT_BUFFER, CommandsBuffer);
+			gl.BufferData(gl.DRAW_INDIRECT_BUFFER, sizeof(DrawElementsIndirectCommand) * MaxDraws, nullptr, gl.DYNAMIC_DRAW);
+
+			gl.GenBuffers(1, &DrawDataBuffer);
+			gl.State.BindBuffer(gl.SHADER_STORAGE_BUFFER, DrawDataBuffer);
+			gl.BufferData(gl.SHADER_STORAGE_BUFFER, sizeof(Td) * MaxDraws, nullptr, gl.DYNAMIC_DRAW);
+		}
+
+		MeshBatch(const MeshBatch&) = delete;
+		MeshBatch& operator = (const MeshBatch&) = delete;
+
+		~MeshBatch()
+		{
+			for (auto& Pipeline : Pipelines) gl.State.DeleteVertexArrays(1, &Pipeline.second);
+			GLuint Buffers[4] = { VertexBuffer, ElementsBuffer, CommandsBuffer, DrawDataBuffer };
+			gl.State.DeleteBuffers(4, Buffers);
+		}
+
+		// 加入一个网格，返回它的绘制序号，即着色器里的 `gl_DrawID`
+		size_t AddMesh(const std::vector<Tv>& Vertices, const std::vector<Te>& Indices, const Td& Data, GLsizei InstanceCount = 1)
+		{
+			GLsizei MeshVertices = GLsizei(Vertices.size());
+			GLsizei MeshIndices = GLsizei(Indices.size());
+			CheckCapacity(MeshVertices, MeshIndices);
+
+			gl.State.BindBuffer(gl.ARRAY_BUFFER, VertexBuffer);
+			gl.BufferSubData(gl.ARRAY_BUFFER, sizeof(Tv) * NumVertices, sizeof(Tv) * MeshVertices, &Vertices[0]);
+
+			// 下标通过 `COPY_WRITE_BUFFER` 写入，不改动当前 VAO 的元素缓冲区
+			gl.State.BindBuffer(gl.COPY_WRITE_BUFFER, ElementsBuffer);
+			gl.BufferSubData(gl.COPY_WRITE_BUFFER, sizeof(Te) * NumIndices, sizeof(Te) * MeshIndices, &Indices[0]);
+			return AddCommand(MeshVertices, MeshIndices, InstanceCount, Data);
+		}
+
+		// 从已有的 `Mesh` 复制顶点和下标，数据不经过 CPU
+		template <typename Ti>
+		size_t AddMesh(const Mesh<Tv, Te, Ti>& m, const Td& Data, GLsizei InstanceCount = 1)
+		{
+			CheckCapacity(m.NumVertices, m.NumElements);
+
+			gl.State.BindBuffer(gl.COPY_READ_BUFFER, m.VertexBuffer);
+			gl.State.BindBuffer(gl.COPY_WRITE_BUFFER, VertexBuffer);
+			gl.CopyBufferSubData(gl.COPY_READ_BUFFER, gl.COPY_WRITE_BUFFER, 0, sizeof(Tv) * NumVertices, sizeof(Tv) * m.NumVertices);
+			gl.State.BindBuffer(gl.COPY_READ_BUFFER, m.ElementsBuffer);
+			gl.State.BindBuffer(gl.COPY_WRITE_BUFFER, ElementsBuffer);
+			gl.CopyBufferSubData(gl.COPY_READ_BUFFER, gl.COPY_WRITE_BUFFER, 0, sizeof(Te) * NumIndices, sizeof(Te) * m.NumElements);
+			return AddCommand(m.NumVertices, m.NumElements, InstanceCount, Data);
+		}
+
+		// 实例数为 0 的绘制仍然在批次里，但什么也不画，用来临时隐藏一个网格
+		void SetInstanceCount(size_t Draw, GLsizei InstanceCount)
+		{
+			Commands.at(Draw).InstanceCount = GLuint(InstanceCount);
+			MarkDirty(Draw);
+		}
+
+		void SetDrawData(size_t Draw, const Td& Data)
+		{
+			DrawData.at(Draw) = Data;
+			MarkDirty(Draw);
+		}
+
+		const Td& GetDrawData(size_t Draw) const
+		{
+			return DrawData.at(Draw);
+		}
+
+		// 清空所有网格，缓冲区保留
+		void Clear()
+		{
+			Commands.clear();
+			DrawData.clear();
+			NumVertices = 0;
+			NumIndices = 0;
+			DirtyBegin = DirtyEnd = 0;
+		}
+
+		size_t GetNumDraws() const
+		{
+			return Commands.size();
+		}
+
+		void Draw(const Program& ShaderProgram)
+		{
+			if (Commands.empty()) return;
+			Upload();
+
+			ShaderProgram.Use();
+			auto it = Pipelines.find(ShaderProgram);
+			if (it != Pipelines.end())
+			{
+				gl.State.BindVertexArray(it->second);
+			}
+			else
+			{
+				GLuint VAO = 0;
+				gl.GenVertexArrays(1, &VAO);
+				gl.State.BindVertexArray(VAO);
+				Pipelines[ShaderProgram] = VAO;
+				DescribeArrayBuffer(ShaderProgram);
+			}
+
+			gl.State.BindBuffer(gl.DRAW_INDIRECT_BUFFER, CommandsBuffer);
+			gl.State.BindBufferBase(gl.SHADER_STORAGE_BUFFER, DrawDataBinding, DrawDataBuffer);
+			gl.MultiDrawElementsIndirect(gl.TRIANGLES, GetIndexType(), nullptr, GLsizei(Commands.size()), 0);
+		}
+	};
+}
@@ -0,0 +1,291 @@
+#include "glprofiler.hpp"
+
+#include <cmath>
+#include <algorithm>
+
+namespace GLRenderer
+{
+	ProfilerError::ProfilerError(const std::string& what) noexcept :
+		std::runtime_error(what)
+	{
+	}
+
+	double TimingHistogram::GetBucketUpperMs(size_t Bucket)
+	{
+		if (Bucket >= NumBuckets - 1) return INFINITY;
+		return std::ldexp(1.0, int(Bucket) - 6);
+	}
+
+	void TimingHistogram::Add(double Ms)
+	{
+		size_t i = 0;
+		while (i < NumBuckets - 1 && Ms >= GetBucketUpperMs(i)) i++;
+		Buckets[i]++;
+		MinMs = Count ? std::min(MinMs, Ms) : Ms;
+		MaxMs = Count ? std::max(MaxMs, Ms) : Ms;
+		TotalMs += Ms;
+		Count++;
+	}
+
+	double TimingHistogram::GetAvgMs() const
+	{
+		return Count ? TotalMs / Count : 0;
+	}
+
+	double TimingHistogram::GetPercentileMs(double Percent) const
+	{
+		if (!Count) return 0;
+		auto Target = uint64_t(std::ceil(double(Count) * std::clamp(Percent, 0.0, 100.0) / 100.0));
+		if (!Target) Target = 1;
+		uint64_t Sum = 0;
+		for (size_t i = 0; i < NumBuckets; i++)
+		{
+			Sum += Buckets[i];
+			if (Sum >= Target) return std::min(GetBucketUpperMs(i), MaxMs);
+		}
+		return MaxMs;
+	}
+
+	GPUProfiler::GPUProfiler(const GLCtxType& GLCtx, size_t FramesInFlight, bool DebugOutput, bool Notifications, size_t MaxMessages) :
+		gl(GLCtx),
+		DebugOutput(DebugOutput),
+		Frames(FramesInFlight),
+		MaxMessages(MaxMessages)
+	{
+		if (!FramesInFlight) throw std::invalid_argument("`FramesInFlight` must be at least 1.");
+
+		if (DebugOutput)
+		{
+			// 同步模式下回调在发出调用的线程上执行，才能知道消息属于哪个作用域
+			gl.Enable(gl.DEBUG_OUTPUT);
+			gl.Enable(gl.DEBUG_OUTPUT_SYNCHRONOUS);
+			gl.DebugMessageCallback(DebugCallback, this);
+			gl.DebugMessageControl(gl.DONT_CARE, gl.DONT_CARE, gl.DONT_CARE, 0, nullptr, true);
+			if (!Notifications) gl.DebugMessageControl(gl.DONT_CARE, gl.DONT_CARE, gl.DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, false);
+		}
+	}
+
+	GPUProfiler::~GPUProfiler()
+	{
+		if (DebugOutput)
+		{
+			gl.DebugMessageCallback(nullptr, nullptr);
+			gl.Disable(gl.DEBUG_OUTPUT_SYNCHRONOUS);
+			gl.Disable(gl.DEBUG_OUTPUT);
+		}
+		if (AllQueries.size()) gl.DeleteQueries(GLsizei(AllQueries.size()), AllQueries.data());
+	}
+
+	GLuint GPUProfiler::AcquireQuery()
+	{
+		if (FreeQueries.empty())
+		{
+			GLuint Query = 0;
+			gl.GenQueries(1, &Query);
+			AllQueries.push_back(Query);
+			return Query;
+		}
+		auto Query = FreeQueries.back();
+		FreeQueries.pop_back();
+		return Query;
+	}
+
+	size_t GPUProfiler::GetScopeIndex(const char* Name)
+	{
+		auto it = ScopeIndices.find(Name);
+		if (it != ScopeIndices.end()) return it->second;
+		ProfileScopeStats s;
+		s.Name = Name;
+		Scopes.push_back(s);
+		ScopeIndices.emplace(Name, Scopes.size() - 1);
+		return Scopes.size() - 1;
+	}
+
+	void GPUProfiler::BeginFrame()
+	{
+		if (InFrame) throw ProfilerError("`BeginFrame()` called twice without `EndFrame()`.");
+		Poll();
+		if (NumPendingFrames == Frames.size())
+		{
+			Stats.NumStalls++;
+			Resolve(true);
+		}
+		Frames[Head].Scopes.clear();
+		InFrame = true;
+	}
+
+	void GPUProfiler::EndFrame()
+	{
+		if (!InFrame) throw ProfilerError("`EndFrame()` called without `BeginFrame()`.");
+		if (OpenScopes.size()) throw ProfilerError("Scope `" + Scopes[OpenScopes.back().Scope].Name + "` is still open at the end of the frame.");
+		InFrame = false;
+		Head = (Head + 1) % Frames.size();
+		NumPendingFrames++;
+		Stats.NumFrames++;
+	}
+
+	void GPUProfiler::BeginScope(const char* Name)
+	{
+		if (!InFrame) throw ProfilerError("`BeginScope()` must be called between `BeginFrame()` and `EndFrame()`.");
+		OpenScope s;
+		s.Scope = GetScopeIndex(Name);
+		s.BeginQuery = AcquireQuery();
+		gl.QueryCounter(s.BeginQuery, gl.TIMESTAMP);
+		if (DebugOutput) gl.PushDebugGroup(gl.DEBUG_SOURCE_APPLICATION, 0, -1, Name);
+		s.BeginTime = ClockType::now();
+		OpenScopes.push_back(s);
+	}
+
+	void GPUProfiler::EndScope()
+	{
+		if (OpenScopes.empty()) throw ProfilerError("`EndScope()` called without `BeginScope()`.");
+		auto s = OpenScopes.back();
+		auto CPUTime = std::chrono::duration<double, std::milli>(ClockType::now() - s.BeginTime).count();
+		if (DebugOutput) gl.PopDebugGroup();
+		OpenScopes.pop_back();
+
+		PendingScope p;
+		p.Scope = s.Scope;
+		p.BeginQuery = s.BeginQuery;
+		p.EndQuery = AcquireQuery();
+		gl.QueryCounter(p.EndQuery, gl.TIMESTAMP);
+		Frames[Head].Scopes.push_back(p);
+		Scopes[s.Scope].CPU.Add(CPUTime);
+	}
+
+	GPUProfiler::ScopeGuard::ScopeGuard(GPUProfiler& Profiler, const char* Name) :
+		Profiler(Profiler)
+	{
+		Profiler.BeginScope(Name);
+	}
+
+	GPUProfiler::ScopeGuard::~ScopeGuard()
+	{
+		Profiler.EndScope();
+	}
+
+	GPUProfiler::ScopeGuard GPUProfiler::Scope(const char* Name)
+	{
+		return ScopeGuard(*this, Name);
+	}
+
+	bool GPUProfiler::Resolve(bool Wait)
+	{
+		if (!NumPendingFrames) return false;
+		auto& Frame = Frames[Tail];
+
+		// 时间戳按顺序写入，最后一个可用时前面的都已经可用
+		if (!Wait && Frame.Scopes.size())
+		{
+			GLint Available = 0;
+			gl.GetQueryObjectiv(Frame.Scopes.back().EndQuery, gl.QUERY_RESULT_AVAILABLE, &Available);
+			if (!Available) return false;
+		}
+
+		for (auto& p : Frame.Scopes)
+		{
+			GLuint64 BeginNs = 0, EndNs = 0;
+			gl.GetQueryObjectui64v(p.BeginQuery, gl.QUERY_RESULT, &BeginNs);
+			gl.GetQueryObjectui64v(p.EndQuery, gl.QUERY_RESULT, &EndNs);
+			Scopes[p.Scope].GPU.Add(EndNs > BeginNs ? double(EndNs - BeginNs) / 1000000.0 : 0.0);
+			FreeQueries.push_back(p.BeginQuery);
+			FreeQueries.push_back(p.EndQuery);
+		}
+		Frame.Scopes.clear();
+		Tail = (Tail + 1) % Frames.size();
+		NumPendingFrames--;
+		return true;
+	}
+
+	size_t GPUProfiler::Poll()
+	{
+		size_t Count = 0;
+		while (Resolve(false)) Count++;
+		return Count;
+	}
+
+	void GPUProfiler::Flush()
+	{
+		while (NumPendingFrames) Resolve(true);
+	}
+
+	void APIENTRY GPUProfiler::DebugCallback(GLenum Source, GLenum Type, GLuint Id, GLenum Severity, GLsizei Length, const GLchar* Message, const void* UserParam)
+	{
+		auto Profiler = const_cast<GPUProfiler*>(static_cast<const GPUProfiler*>(UserParam));
+		Profiler->OnDebugMessage(Source, Type, Id, Severity, Length, Message);
+	}
+
+	void GPUProfiler::OnDebugMessage(GLenum Source, GLenum Type, GLuint Id, GLenum Severity, GLsizei Length, const GLchar* Message)
+	{
+		// 自己的调试组产生的消息
+		if (Type == gl.DEBUG_TYPE_PUSH_GROUP || Type == gl.DEBUG_TYPE_POP_GROUP) return;
+
+		DebugMessage Msg;
+		Msg.Source = Source;
+		Msg.Type = Type;
+		Msg.Id = Id;
+		Msg.Severity = Severity;
+		Msg.Message = Length < 0 ? std::string(Message) : std::string(Message, size_t(Length));
+		if (OpenScopes.size()) Msg.Scope = Scopes[OpenScopes.back().Scope].Name;
+
+		{
+			auto lock = std::scoped_lock(MessagesLock);
+			if (Type == gl.DEBUG_TYPE_ERROR) Stats.NumErrors++;
+			else if (Type == gl.DEBUG_TYPE_PERFORMANCE) Stats.NumPerformanceWarnings++;
+			else Stats.NumOtherMessages++;
+			if (MaxMessages)
+			{
+				if (Messages.size() == MaxMessages) Messages.pop_front();
+				Messages.push_back(Msg);
+			}
+		}
+
+		if (OnMessage) OnMessage(Userdata, Msg);
+	}
+
+	const std::vector<ProfileScopeStats>& GPUProfiler::GetScopes() const
+	{
+		return Scopes;
+	}
+
+	const ProfileScopeStats* GPUProfiler::FindScope(const std::string& Name) const
+	{
+		auto it = ScopeIndices.find(Name);
+		if (it == ScopeIndices.end()) return nullptr;
+		return &Scopes[it->second];
+	}
+
+	size_t GPUProfiler::GetNumPendingFrames() const
+	{
+		return NumPendingFrames;
+	}
+
+	ProfilerStats GPUProfiler::GetStats() const
+	{
+		auto lock = std::scoped_lock(MessagesLock);
+		return Stats;
+	}
+
+	std::vector<DebugMessage> GPUProfiler::GetMessages() const
+	{
+		auto lock = std::scoped_lock(MessagesLock);
+		return std::vector<DebugMessage>(Messages.begin(), Messages.end());
+	}
+
+	void GPUProfiler::ClearMessages()
+	{
+		auto lock = std::scoped_lock(MessagesLock);
+		Messages.clear();
+	}
+
+	void GPUProfiler::ResetStats()
+	{
+		auto lock = std::scoped_lock(MessagesLock);
+		Stats = ProfilerStats();
+		for (auto& s : Scopes)
+		{
+			s.CPU = TimingHistogram();
+			s.GPU = TimingHistogram();
+		}
+	}
+}
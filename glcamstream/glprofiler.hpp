@@ -0,0 +1,199 @@
+#pragma once
+
+#include "glfwwrap.hpp"
+
+#include <array>
+#include <deque>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <stdexcept>
+
+namespace GLRenderer
+{
+	using namespace GL;
+	using GLCtxType = GLFWWrap::GLCtxType;
+
+	class ProfilerError : public std::runtime_error
+	{
+	public:
+		ProfilerError(const std::string& what) noexcept;
+	};
+
+	// 按 2 的幂分桶的耗时直方图。第 0 个桶是小于 1/64 毫秒的耗时，之后每个桶的上限翻倍，最后一个桶没有上限
+	struct TimingHistogram
+	{
+		static constexpr size_t NumBuckets = 16;
+
+		std::array<uint64_t, NumBuckets> Buckets = {};
+		uint64_t Count = 0;
+		double TotalMs = 0;
+		double MinMs = 0;
+		double MaxMs = 0;
+
+		void Add(double Ms);
+		double GetAvgMs() const;
+
+		// 返回包含第 `Percent` 百分位的桶的上限，最后一个桶返回 `MaxMs`
+		double GetPercentileMs(double Percent) const;
+
+		static double GetBucketUpperMs(size_t Bucket);
+	};
+
+	// 同名的作用域共用一份统计，GPU 的直方图要等查询结果回来之后才更新，比 CPU 的晚几帧
+	struct ProfileScopeStats
+	{
+		std::string Name;
+		TimingHistogram CPU;
+		TimingHistogram GPU;
+	};
+
+	// `Scope` 是驱动发出消息时最内层的作用域名
+	struct DebugMessage
+	{
+		GLenum Source = 0;
+		GLenum Type = 0;
+		GLuint Id = 0;
+		GLenum Severity = 0;
+		std::string Message;
+		std::string Scope;
+	};
+
+	// `NumStalls` 是帧环满了、只能等待最早一帧的查询结果的次数
+	struct ProfilerStats
+	{
+		size_t NumFrames = 0;
+		size_t NumStalls = 0;
+		size_t NumErrors = 0;
+		size_t NumPerformanceWarnings = 0;
+		size_t NumOtherMessages = 0;
+	};
+
+	using DebugMessageCBType = void (*)(void* Userdata, const DebugMessage& Msg);
+
+	//-------------------------------------------------------------------
+	// GPUProfiler
+	//
+	// Opt-in GPU-side visibility. Named scopes are bracketed by a pair of
+	// `QueryCounter(TIMESTAMP)` queries and by CPU clock readings. The
+	// CPU time goes into the scope's histogram right away; the queries
+	// of a frame are only read back once the last of them is available,
+	// which is usually a few frames later, so reading them never stalls
+	// the pipeline unless all `FramesInFlight` frames are still pending.
+	//
+	// With debug output enabled it installs a synchronous
+	// `DebugMessageCallback`, pushes a debug group per scope, and keeps
+	// the recent driver messages, e.g. the performance warning about a
+	// `TexStream::Update` stalling on its PBO, tagged with the scope
+	// they were raised in.
+	//
+	// Everything has to be called on the GL thread.
+	//-------------------------------------------------------------------
+
+	class GPUProfiler
+	{
+	protected:
+		using ClockType = std::chrono::steady_clock;
+
+		struct PendingScope
+		{
+			size_t Scope;
+			GLuint BeginQuery;
+			GLuint EndQuery;
+		};
+
+		struct FrameType
+		{
+			std::vector<PendingScope> Scopes;
+		};
+
+		struct OpenScope
+		{
+			size_t Scope;
+			GLuint BeginQuery;
+			ClockType::time_point BeginTime;
+		};
+
+		const GLCtxType& gl;
+		bool DebugOutput;
+
+		std::vector<ProfileScopeStats> Scopes;
+		std::unordered_map<std::string, size_t> ScopeIndices;
+
+		// 环形排列的帧，`Tail` 是最早的还没有读回结果的帧
+		std::vector<FrameType> Frames;
+		size_t Head = 0;
+		size_t Tail = 0;
+		size_t NumPendingFrames = 0;
+		bool InFrame = false;
+
+		std::vector<OpenScope> OpenScopes;
+		std::vector<GLuint> FreeQueries;
+		std::vector<GLuint> AllQueries;
+
+		ProfilerStats Stats;
+
+		// 调试消息可能来自驱动的线程，单独加锁
+		mutable std::mutex MessagesLock;
+		std::deque<DebugMessage> Messages;
+		size_t MaxMessages;
+
+		GLuint AcquireQuery();
+		size_t GetScopeIndex(const char* Name);
+
+		// 读回最早一帧的结果，`Wait` 为 false 时如果结果还没有全部可用就返回 false
+		bool Resolve(bool Wait);
+
+		static void APIENTRY DebugCallback(GLenum Source, GLenum Type, GLuint Id, GLenum Severity, GLsizei Length, const GLchar* Message, const void* UserParam);
+		void OnDebugMessage(GLenum Source, GLenum Type, GLuint Id, GLenum Severity, GLsizei Length, const GLchar* Message);
+
+	public:
+		// `DebugOutput` 为 true 时安装调试回调，通知级别的消息只在 `Notifications` 为 true 时接收
+		GPUProfiler(const GLCtxType& GLCtx, size_t FramesInFlight = 4, bool DebugOutput = true, bool Notifications = false, size_t MaxMessages = 64);
+		GPUProfiler(const GPUProfiler&) = delete;
+		GPUProfiler& operator = (const GPUProfiler&) = delete;
+		~GPUProfiler();
+
+		// 每帧开始时调用，同时读回已经完成的帧
+		void BeginFrame();
+		void EndFrame();
+
+		// 作用域可以嵌套，但必须在 `BeginFrame()` 和 `EndFrame()` 之间成对调用
+		void BeginScope(const char* Name);
+		void EndScope();
+
+		class ScopeGuard
+		{
+		protected:
+			GPUProfiler& Profiler;
+
+		public:
+			ScopeGuard(GPUProfiler& Profiler, const char* Name);
+			ScopeGuard(const ScopeGuard&) = delete;
+			ScopeGuard& operator = (const ScopeGuard&) = delete;
+			~ScopeGuard();
+		};
+
+		// auto s = Profiler.Scope("Upload");
+		ScopeGuard Scope(const char* Name);
+
+		// 读回所有已经完成的帧，返回读回的帧数
+		size_t Poll();
+
+		// 等待并读回所有已经结束的帧
+		void Flush();
+
+		const std::vector<ProfileScopeStats>& GetScopes() const;
+		const ProfileScopeStats* FindScope(const std::string& Name) const;
+		size_t GetNumPendingFrames() const;
+		ProfilerStats GetStats() const;
+		std::vector<DebugMessage> GetMessages() const;
+		void ClearMessages();
+		void ResetStats();
+
+		void* Userdata = nullptr;
+		DebugMessageCBType OnMessage = nullptr;
+	};
+}
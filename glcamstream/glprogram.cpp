@@ -139,7 +139,7 @@ namespace GLRenderer
 
 	Program::~Program()
 	{
-		gl.DeleteProgram(ShaderProgram);
+		gl.State.DeleteProgram(ShaderProgram);
 	}
 
 	Program::Program(const GLCtxType& GLCtx) :
@@ -165,6 +165,6 @@ namespace GLRenderer
 
 	void Program::Use() const
 	{
-		gl.UseProgram(ShaderProgram);
+		gl.State.UseProgram(ShaderProgram);
 	}
 }
@@ -0,0 +1,164 @@
+#include "glreadback.hpp"
+
+#include <cstring>
+#include <algorithm>
+
+namespace GLRenderer
+{
+	ReadbackError::ReadbackError(const std::string& what) noexcept :
+		std::runtime_error(what)
+	{
+	}
+
+	TexReadback::TexReadback(const GLCtxType& GLCtx, uint32_t Width, uint32_t Height, ReadbackCBType OnFrame, void* Userdata, size_t RingSize) :
+		gl(GLCtx),
+		Width(Width),
+		Height(Height),
+		Ring(RingSize),
+		Frame(Width, Height, Pixel_RGBA8(0, 0, 0, 255)),
+		Userdata(Userdata),
+		OnFrame(OnFrame)
+	{
+		if (!Width || !Height) throw std::invalid_argument("The size of `TexReadback` must not be zero.");
+		if (!RingSize) throw std::invalid_argument("The ring size of `TexReadback` must not be zero.");
+
+		for (auto& Slot : Ring)
+		{
+			gl.GenBuffers(1, &Slot.PBO);
+			gl.State.BindBuffer(gl.PIXEL_PACK_BUFFER, Slot.PBO);
+			gl.BufferData(gl.PIXEL_PACK_BUFFER, size_t(Width) * Height * sizeof(Pixel_RGBA8), nullptr, gl.STREAM_READ);
+		}
+		gl.State.BindBuffer(gl.PIXEL_PACK_BUFFER, 0);
+	}
+
+	TexReadback::~TexReadback()
+	{
+		for (auto& Slot : Ring)
+		{
+			if (Slot.Fence) gl.DeleteSync(Slot.Fence);
+			gl.State.DeleteBuffers(1, &Slot.PBO);
+		}
+	}
+
+	void TexReadback::Read(uint64_t FrameId, GLint X, GLint Y)
+	{
+		// 所有的 PBO 都在等待时，只能先等最早的一个完成
+		if (NumInFlight == Ring.size())
+		{
+			Stats.NumStalls++;
+			Deliver(true);
+		}
+
+		auto& Slot = Ring[(Tail + NumInFlight) % Ring.size()];
+		gl.State.BindBuffer(gl.PIXEL_PACK_BUFFER, Slot.PBO);
+		gl.PixelStorei(gl.PACK_ALIGNMENT, 4);
+		gl.ReadPixels(X, Y, Width, Height, gl.RGBA, gl.UNSIGNED_BYTE, nullptr);
+		gl.State.BindBuffer(gl.PIXEL_PACK_BUFFER, 0);
+
+		Slot.Fence = gl.FenceSync(gl.SYNC_GPU_COMMANDS_COMPLETE, 0);
+		if (!Slot.Fence) throw ReadbackError("`TexReadback::Read()` failed to create a fence.");
+		Slot.FrameId = FrameId;
+		Slot.RequestIndex = NumRequests++;
+		Slot.RequestTime = ClockType::now();
+		NumInFlight++;
+		Stats.NumRequested++;
+	}
+
+	bool TexReadback::Deliver(bool Wait)
+	{
+		if (!NumInFlight) return false;
+		auto& Slot = Ring[Tail];
+
+		// 不等待时超时为 0，只查询状态；等待时要刷新命令队列，否则栅栏可能永远不会被执行到
+		GLenum Result = gl.ClientWaitSync(Slot.Fence, Wait ? gl.SYNC_FLUSH_COMMANDS_BIT : 0, Wait ? GLuint64(1000000000) : 0);
+		if (Result == gl.WAIT_FAILED) throw ReadbackError("`TexReadback` failed to wait for a readback.");
+		if (Result != gl.ALREADY_SIGNALED && Result != gl.CONDITION_SATISFIED)
+		{
+			if (!Wait) return false;
+			while ((Result = gl.ClientWaitSync(Slot.Fence, gl.SYNC_FLUSH_COMMANDS_BIT, GLuint64(1000000000))) == gl.TIMEOUT_EXPIRED);
+			if (Result == gl.WAIT_FAILED) throw ReadbackError("`TexReadback` failed to wait for a readback.");
+		}
+		gl.DeleteSync(Slot.Fence);
+		Slot.Fence = nullptr;
+
+		size_t RowBytes = size_t(Width) * sizeof(Pixel_RGBA8);
+		gl.State.BindBuffer(gl.PIXEL_PACK_BUFFER, Slot.PBO);
+		void* MapPtr = gl.MapBufferRange(gl.PIXEL_PACK_BUFFER, 0, GLsizeiptr(RowBytes * Height), gl.MAP_READ_BIT);
+		if (!MapPtr)
+		{
+			gl.State.BindBuffer(gl.PIXEL_PACK_BUFFER, 0);
+			throw ReadbackError("`TexReadback` failed to map PBO.");
+		}
+
+		// `ReadPixels` 的第一行是最下面的一行
+		for (uint32_t y = 0; y < Height; y++)
+		{
+			const void* SrcRow = reinterpret_cast<const void*>(reinterpret_cast<size_t>(MapPtr) + RowBytes * (Height - 1 - y));
+			memcpy(Frame.GetBitmapRowPtr(y), SrcRow, RowBytes);
+		}
+		gl.UnmapBuffer(gl.PIXEL_PACK_BUFFER);
+		gl.State.BindBuffer(gl.PIXEL_PACK_BUFFER, 0);
+
+		ReadbackInfo Info;
+		Info.FrameId = Slot.FrameId;
+		Info.LatencyMs = std::chrono::duration<double, std::milli>(ClockType::now() - Slot.RequestTime).count();
+		Info.LatencyFrames = uint32_t(NumRequests - 1 - Slot.RequestIndex);
+
+		Tail = (Tail + 1) % Ring.size();
+		NumInFlight--;
+
+		Stats.NumDelivered++;
+		TotalLatencyMs += Info.LatencyMs;
+		TotalLatencyFrames += Info.LatencyFrames;
+		Stats.AvgLatencyMs = TotalLatencyMs / Stats.NumDelivered;
+		Stats.AvgLatencyFrames = TotalLatencyFrames / Stats.NumDelivered;
+		Stats.MaxLatencyMs = std::max(Stats.MaxLatencyMs, Info.LatencyMs);
+
+		if (OnFrame) OnFrame(Userdata, Frame, Info);
+		return true;
+	}
+
+	size_t TexReadback::Poll()
+	{
+		size_t NumDelivered = 0;
+		while (Deliver(false)) NumDelivered++;
+		return NumDelivered;
+	}
+
+	void TexReadback::Flush()
+	{
+		while (Deliver(true));
+	}
+
+	uint32_t TexReadback::GetWidth() const
+	{
+		return Width;
+	}
+
+	uint32_t TexReadback::GetHeight() const
+	{
+		return Height;
+	}
+
+	size_t TexReadback::GetRingSize() const
+	{
+		return Ring.size();
+	}
+
+	size_t TexReadback::GetNumInFlight() const
+	{
+		return NumInFlight;
+	}
+
+	ReadbackStats TexReadback::GetStats() const
+	{
+		return Stats;
+	}
+
+	void TexReadback::ResetStats()
+	{
+		Stats = ReadbackStats();
+		TotalLatencyMs = 0;
+		TotalLatencyFrames = 0;
+	}
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "glfwwrap.hpp"
+
+#include <unibmp/unibmp.hpp>
+
+#include <chrono>
+#include <vector>
+#include <stdexcept>
+
+namespace GLRenderer
+{
+	using namespace GL;
+	using GLCtxType = GLFWWrap::GLCtxType;
+	using namespace UniformBitmap;
+
+	class ReadbackError : public std::runtime_error
+	{
+	public:
+		ReadbackError(const std::string& what) noexcept;
+	};
+
+	// 一帧读回的信息，`LatencyFrames` 是发起读回之后又发起了多少次读回才拿到这一帧
+	struct ReadbackInfo
+	{
+		uint64_t FrameId = 0;
+		double LatencyMs = 0;
+		uint32_t LatencyFrames = 0;
+	};
+
+	// `NumStalls` 是环形缓冲区满了、只能等待最早的读回完成的次数
+	struct ReadbackStats
+	{
+		size_t NumRequested = 0;
+		size_t NumDelivered = 0;
+		size_t NumStalls = 0;
+		double AvgLatencyMs = 0;
+		double MaxLatencyMs = 0;
+		double AvgLatencyFrames = 0;
+	};
+
+	using ReadbackCBType = void (*)(void* Userdata, const Image_RGBA8& Frame, const ReadbackInfo& Info);
+
+	//-------------------------------------------------------------------
+	// TexReadback
+	//
+	// Reads rendered frames back to the CPU without stalling the render
+	// loop. `Read()` only queues a `ReadPixels` into the next PACK PBO of
+	// a ring and puts a fence after it; `Poll()` maps the PBOs whose
+	// fences have signaled, oldest first, and hands the pixels to the
+	// callback as an `Image_RGBA8`. With a ring of N PBOs a frame usually
+	// arrives one or two frames later, and the render loop only waits
+	// when all N readbacks are still in flight.
+	//
+	// Rows are flipped so the image is top-down like the camera frames.
+	//-------------------------------------------------------------------
+
+	class TexReadback
+	{
+	protected:
+		using ClockType = std::chrono::steady_clock;
+
+		struct SlotType
+		{
+			GLuint PBO = 0;
+			GLsync Fence = nullptr;
+			uint64_t FrameId = 0;
+			uint64_t RequestIndex = 0;
+			ClockType::time_point RequestTime;
+		};
+
+		const GLCtxType& gl;
+		uint32_t Width;
+		uint32_t Height;
+		std::vector<SlotType> Ring;
+
+		// `Tail` 是最早的还没有交付的读回
+		size_t Tail = 0;
+		size_t NumInFlight = 0;
+		uint64_t NumRequests = 0;
+
+		Image_RGBA8 Frame;
+		ReadbackStats Stats;
+		double TotalLatencyMs = 0;
+		double TotalLatencyFrames = 0;
+
+		// 交付最早的读回，`Wait` 为 false 时如果它还没完成就返回 false
+		bool Deliver(bool Wait);
+
+	public:
+		TexReadback(const GLCtxType& GLCtx, uint32_t Width, uint32_t Height, ReadbackCBType OnFrame, void* Userdata, size_t RingSize = 3);
+		TexReadback(const TexReadback&) = delete;
+		TexReadback& operator = (const TexReadback&) = delete;
+		~TexReadback();
+
+		// 从当前绑定的读帧缓冲读取左下角为 (`X`, `Y`) 的区域
+		void Read(uint64_t FrameId = 0, GLint X = 0, GLint Y = 0);
+
+		// 交付所有已经完成的读回，在渲染循环里每帧调用一次
+		size_t Poll();
+
+		// 等待并交付所有还在进行的读回
+		void Flush();
+
+		uint32_t GetWidth() const;
+		uint32_t GetHeight() const;
+		size_t GetRingSize() const;
+		size_t GetNumInFlight() const;
+		ReadbackStats GetStats() const;
+		void ResetStats();
+
+		void* Userdata = nullptr;
+		ReadbackCBType OnFrame = nullptr;
+	};
+}
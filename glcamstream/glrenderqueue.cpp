@@ -0,0 +1,187 @@
+#include "glrenderqueue.hpp"
+
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
+
+namespace GLRenderer
+{
+	UniformValue::UniformValue(GLint Location, GLfloat v) : Location(Location), Type(UniformValueType::Float) { f[0] = v; }
+	UniformValue::UniformValue(GLint Location, const glm::vec2& v) : Location(Location), Type(UniformValueType::Vec2) { memcpy(f, &v, sizeof v); }
+	UniformValue::UniformValue(GLint Location, const glm::vec3& v) : Location(Location), Type(UniformValueType::Vec3) { memcpy(f, &v, sizeof v); }
+	UniformValue::UniformValue(GLint Location, const glm::vec4& v) : Location(Location), Type(UniformValueType::Vec4) { memcpy(f, &v, sizeof v); }
+	UniformValue::UniformValue(GLint Location, GLint v) : Location(Location), Type(UniformValueType::Int) { i[0] = v; }
+	UniformValue::UniformValue(GLint Location, const glm::ivec2& v) : Location(Location), Type(UniformValueType::IVec2) { memcpy(i, &v, sizeof v); }
+	UniformValue::UniformValue(GLint Location, const glm::ivec3& v) : Location(Location), Type(UniformValueType::IVec3) { memcpy(i, &v, sizeof v); }
+	UniformValue::UniformValue(GLint Location, const glm::ivec4& v) : Location(Location), Type(UniformValueType::IVec4) { memcpy(i, &v, sizeof v); }
+	UniformValue::UniformValue(GLint Location, const glm::mat4& m) : Location(Location), Type(UniformValueType::Mat4) { memcpy(f, &m, sizeof m); }
+
+	void CommandArena::Record(const DrawPacket& Packet, const UniformValue* Uniforms, size_t NumUniforms)
+	{
+		RecordedPacket p;
+		p.Packet = Packet;
+		p.FirstUniform = uint32_t(this->Uniforms.size());
+		p.NumUniforms = uint32_t(NumUniforms);
+		this->Uniforms.insert(this->Uniforms.end(), Uniforms, Uniforms + NumUniforms);
+		Packets.push_back(p);
+	}
+
+	void CommandArena::Record(const DrawPacket& Packet, std::initializer_list<UniformValue> Uniforms)
+	{
+		Record(Packet, Uniforms.begin(), Uniforms.size());
+	}
+
+	void CommandArena::Clear()
+	{
+		Packets.clear();
+		Uniforms.clear();
+	}
+
+	size_t CommandArena::GetNumPackets() const
+	{
+		return Packets.size();
+	}
+
+	RenderQueue::RenderQueue(const GLCtxType& GLCtx) :
+		gl(GLCtx)
+	{
+	}
+
+	uint64_t RenderQueue::MakeSortKey(const DrawPacket& Packet)
+	{
+		// 对象名一般很小，只取低 16 位；截断只影响排序的效果，不影响绘制结果
+		return
+			(uint64_t(Packet.Layer) << 56) |
+			(uint64_t(Packet.Program & 0xFFFF) << 40) |
+			(uint64_t(Packet.Textures[0].Texture & 0xFFFF) << 24) |
+			(uint64_t(Packet.VAO & 0xFFFF) << 8) |
+			uint64_t(Packet.Order);
+	}
+
+	CommandArena& RenderQueue::AcquireArena()
+	{
+		auto lock = std::scoped_lock(ArenasLock);
+		if (NumAcquired == Arenas.size()) Arenas.push_back(std::make_unique<CommandArena>());
+		return *Arenas[NumAcquired++];
+	}
+
+	void RenderQueue::Record(const DrawPacket& Packet, const UniformValue* Uniforms, size_t NumUniforms)
+	{
+		if (!MainArena) MainArena = &AcquireArena();
+		MainArena->Record(Packet, Uniforms, NumUniforms);
+	}
+
+	void RenderQueue::Record(const DrawPacket& Packet, std::initializer_list<UniformValue> Uniforms)
+	{
+		Record(Packet, Uniforms.begin(), Uniforms.size());
+	}
+
+	void RenderQueue::Execute(const CommandArena::RecordedPacket& p, const CommandArena& Arena, const DrawPacket* Prev, RenderQueueStats& Stats)
+	{
+		auto& Packet = p.Packet;
+
+		if (!Prev || Prev->Program != Packet.Program) Stats.NumProgramChanges++;
+		gl.State.UseProgram(Packet.Program);
+
+		for (GLuint u = 0; u < DrawPacket::MaxTextures; u++)
+		{
+			auto& t = Packet.Textures[u];
+			if (!t.Target) continue;
+			if (!Prev || Prev->Textures[u].Target != t.Target || Prev->Textures[u].Texture != t.Texture) Stats.NumTextureChanges++;
+			gl.State.BindTextureUnit(u, t.Target, t.Texture);
+		}
+
+		for (uint32_t i = 0; i < p.NumUniforms; i++)
+		{
+			auto& v = Arena.Uniforms[p.FirstUniform + i];
+			switch (v.Type)
+			{
+			case UniformValueType::Float: gl.Uniform1fv(v.Location, 1, v.f); break;
+			case UniformValueType::Vec2: gl.Uniform2fv(v.Location, 1, v.f); break;
+			case UniformValueType::Vec3: gl.Uniform3fv(v.Location, 1, v.f); break;
+			case UniformValueType::Vec4: gl.Uniform4fv(v.Location, 1, v.f); break;
+			case UniformValueType::Int: gl.Uniform1iv(v.Location, 1, v.i); break;
+			case UniformValueType::IVec2: gl.Uniform2iv(v.Location, 1, v.i); break;
+			case UniformValueType::IVec3: gl.Uniform3iv(v.Location, 1, v.i); break;
+			case UniformValueType::IVec4: gl.Uniform4iv(v.Location, 1, v.i); break;
+			case UniformValueType::Mat4: gl.UniformMatrix4fv(v.Location, 1, false, v.f); break;
+			}
+		}
+		Stats.NumUniforms += p.NumUniforms;
+
+		if (!Prev || Prev->VAO != Packet.VAO) Stats.NumVAOChanges++;
+		gl.State.BindVertexArray(Packet.VAO);
+
+		if (!Packet.IndexType)
+		{
+			gl.DrawArraysInstancedBaseInstance(Packet.Mode, Packet.First, Packet.Count, Packet.InstanceCount, Packet.BaseInstance);
+		}
+		else
+		{
+			size_t IndexSize;
+			switch (Packet.IndexType)
+			{
+			case GLCtxType::UNSIGNED_BYTE: IndexSize = 1; break;
+			case GLCtxType::UNSIGNED_SHORT: IndexSize = 2; break;
+			case GLCtxType::UNSIGNED_INT: IndexSize = 4; break;
+			default: throw std::invalid_argument("`DrawPacket::IndexType` must be `UNSIGNED_BYTE`, `UNSIGNED_SHORT` or `UNSIGNED_INT`.");
+			}
+			auto Offset = reinterpret_cast<const void*>(size_t(Packet.First) * IndexSize);
+			gl.DrawElementsInstancedBaseInstance(Packet.Mode, Packet.Count, Packet.IndexType, Offset, Packet.InstanceCount, Packet.BaseInstance);
+		}
+	}
+
+	RenderQueueStats RenderQueue::Submit()
+	{
+		RenderQueueStats Stats;
+
+		{
+			auto lock = std::scoped_lock(ArenasLock);
+			Stats.NumArenas = NumAcquired;
+		}
+
+		// 排序的只是键和下标，绘制包留在各自的竞技场里
+		SortEntries.clear();
+		for (uint32_t a = 0; a < Stats.NumArenas; a++)
+		{
+			auto& Packets = Arenas[a]->Packets;
+			for (uint32_t p = 0; p < Packets.size(); p++)
+			{
+				SortEntries.push_back({ MakeSortKey(Packets[p].Packet), a, p });
+			}
+		}
+		std::sort(SortEntries.begin(), SortEntries.end(), [](const SortEntry& a, const SortEntry& b)
+		{
+			if (a.Key != b.Key) return a.Key < b.Key;
+			if (a.Arena != b.Arena) return a.Arena < b.Arena;
+			return a.Packet < b.Packet;
+		});
+
+		const DrawPacket* Prev = nullptr;
+		for (auto& e : SortEntries)
+		{
+			auto& Arena = *Arenas[e.Arena];
+			auto& p = Arena.Packets[e.Packet];
+			Execute(p, Arena, Prev, Stats);
+			Prev = &p.Packet;
+		}
+		Stats.NumPackets = SortEntries.size();
+
+		Clear();
+		LastStats = Stats;
+		return Stats;
+	}
+
+	void RenderQueue::Clear()
+	{
+		auto lock = std::scoped_lock(ArenasLock);
+		for (size_t i = 0; i < NumAcquired; i++) Arenas[i]->Clear();
+		NumAcquired = 0;
+		MainArena = nullptr;
+	}
+
+	RenderQueueStats RenderQueue::GetLastStats() const
+	{
+		return LastStats;
+	}
+}
@@ -0,0 +1,182 @@
+#pragma once
+
+#include "glfwwrap.hpp"
+
+#include <glm/glm/glm.hpp>
+
+#include <array>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <initializer_list>
+
+namespace GLRenderer
+{
+	using namespace GL;
+	using GLCtxType = GLFWWrap::GLCtxType;
+
+	enum class UniformValueType : uint8_t
+	{
+		Float,
+		Vec2,
+		Vec3,
+		Vec4,
+		Int,
+		IVec2,
+		IVec3,
+		IVec4,
+		Mat4
+	};
+
+	// 随绘制包记录的 uniform 值，提交时按记录的顺序设置
+	struct UniformValue
+	{
+		GLint Location = -1;
+		UniformValueType Type = UniformValueType::Float;
+		union
+		{
+			GLfloat f[16];
+			GLint i[4];
+		};
+
+		UniformValue() = default;
+		UniformValue(GLint Location, GLfloat v);
+		UniformValue(GLint Location, const glm::vec2& v);
+		UniformValue(GLint Location, const glm::vec3& v);
+		UniformValue(GLint Location, const glm::vec4& v);
+		UniformValue(GLint Location, GLint v);
+		UniformValue(GLint Location, const glm::ivec2& v);
+		UniformValue(GLint Location, const glm::ivec3& v);
+		UniformValue(GLint Location, const glm::ivec4& v);
+		UniformValue(GLint Location, const glm::mat4& m);
+	};
+
+	// `Target` 为 0 的纹理单元不绑定
+	struct TextureBinding
+	{
+		GLenum Target = 0;
+		GLuint Texture = 0;
+	};
+
+	// 一次绘制需要的全部状态。`IndexType` 为 0 时按 `DrawArrays` 绘制，否则 `First` 是元素缓冲区里的第一个下标
+	struct DrawPacket
+	{
+		static constexpr size_t MaxTextures = 4;
+
+		uint8_t Layer = 0;
+		uint8_t Order = 0;
+		GLuint Program = 0;
+		GLuint VAO = 0;
+		std::array<TextureBinding, MaxTextures> Textures;
+		GLenum Mode = GLCtxType::TRIANGLES;
+		GLenum IndexType = 0;
+		GLint First = 0;
+		GLsizei Count = 0;
+		GLsizei InstanceCount = 1;
+		GLuint BaseInstance = 0;
+	};
+
+	struct RenderQueueStats
+	{
+		size_t NumPackets = 0;
+		size_t NumArenas = 0;
+		size_t NumProgramChanges = 0;
+		size_t NumVAOChanges = 0;
+		size_t NumTextureChanges = 0;
+		size_t NumUniforms = 0;
+	};
+
+	//-------------------------------------------------------------------
+	// CommandArena
+	//
+	// Packets recorded by one thread. Recording only appends to vectors
+	// that keep their capacity from frame to frame, so it doesn't touch
+	// GL, doesn't lock and, once warmed up, doesn't allocate.
+	//-------------------------------------------------------------------
+
+	class CommandArena
+	{
+	protected:
+		friend class RenderQueue;
+
+		struct RecordedPacket
+		{
+			DrawPacket Packet;
+			uint32_t FirstUniform;
+			uint32_t NumUniforms;
+		};
+
+		std::vector<RecordedPacket> Packets;
+		std::vector<UniformValue> Uniforms;
+
+	public:
+		void Record(const DrawPacket& Packet, const UniformValue* Uniforms = nullptr, size_t NumUniforms = 0);
+		void Record(const DrawPacket& Packet, std::initializer_list<UniformValue> Uniforms);
+		void Clear();
+		size_t GetNumPackets() const;
+	};
+
+	//-------------------------------------------------------------------
+	// RenderQueue
+	//
+	// Collects draw packets during a frame and submits them in one pass
+	// on the GL thread. Worker threads each take an arena with
+	// `AcquireArena()` and record into it without locking; `Submit()`
+	// merges all arenas, sorts the packets by a 64-bit state key so that
+	// packets sharing a program, texture and VAO end up next to each
+	// other, and issues them through the context's `StateCache`, which
+	// drops the binds that don't change anything.
+	//
+	// The key is, from the most significant bits down: layer (8 bits),
+	// program (16), first texture (16), VAO (16), order (8). Layers are
+	// drawn in order, so use them for anything that must be drawn after
+	// something else, e.g. blended overlays. Packets with equal keys are
+	// drawn in the order they were recorded.
+	//-------------------------------------------------------------------
+
+	class RenderQueue
+	{
+	protected:
+		struct SortEntry
+		{
+			uint64_t Key;
+			uint32_t Arena;
+			uint32_t Packet;
+		};
+
+		const GLCtxType& gl;
+
+		// 每帧开始时所有的竞技场都是空闲的，取用的顺序就是合并的顺序
+		std::mutex ArenasLock;
+		std::vector<std::unique_ptr<CommandArena>> Arenas;
+		size_t NumAcquired = 0;
+		CommandArena* MainArena = nullptr;
+
+		std::vector<SortEntry> SortEntries;
+		RenderQueueStats LastStats;
+
+		void Execute(const CommandArena::RecordedPacket& p, const CommandArena& Arena, const DrawPacket* Prev, RenderQueueStats& Stats);
+
+	public:
+		RenderQueue(const GLCtxType& GLCtx);
+		RenderQueue(const RenderQueue&) = delete;
+		RenderQueue& operator = (const RenderQueue&) = delete;
+
+		static uint64_t MakeSortKey(const DrawPacket& Packet);
+
+		// 可以在任何线程调用；返回的竞技场只能由一个线程使用，到 `Submit()` 为止有效
+		CommandArena& AcquireArena();
+
+		// 在 GL 线程上直接记录
+		void Record(const DrawPacket& Packet, const UniformValue* Uniforms = nullptr, size_t NumUniforms = 0);
+		void Record(const DrawPacket& Packet, std::initializer_list<UniformValue> Uniforms);
+
+		// 在 GL 线程上调用，调用前所有线程必须已经记录完。提交后清空所有竞技场
+		RenderQueueStats Submit();
+
+		// 丢弃记录的绘制包
+		void Clear();
+
+		RenderQueueStats GetLastStats() const;
+	};
+}
@@ -0,0 +1,286 @@
+#include "glstate.hpp"
+
+#include <algorithm>
+
+namespace GL
+{
+	StateCacheError::StateCacheError(const std::string& what) noexcept :
+		std::runtime_error(what)
+	{
+	}
+
+	struct TargetBinding
+	{
+		GLenum Target;
+		GLenum Binding;
+	};
+
+	// 按 `Buffers` 的下标排列
+	static const TargetBinding BufferTargets[] =
+	{
+		{ Version46::ARRAY_BUFFER, Version46::ARRAY_BUFFER_BINDING },
+		{ Version46::ELEMENT_ARRAY_BUFFER, Version46::ELEMENT_ARRAY_BUFFER_BINDING },
+		{ Version46::PIXEL_PACK_BUFFER, Version46::PIXEL_PACK_BUFFER_BINDING },
+		{ Version46::PIXEL_UNPACK_BUFFER, Version46::PIXEL_UNPACK_BUFFER_BINDING },
+		{ Version46::UNIFORM_BUFFER, Version46::UNIFORM_BUFFER_BINDING },
+		{ Version46::DRAW_INDIRECT_BUFFER, Version46::DRAW_INDIRECT_BUFFER_BINDING },
+		{ Version46::COPY_READ_BUFFER, Version46::COPY_READ_BUFFER_BINDING },
+		{ Version46::COPY_WRITE_BUFFER, Version46::COPY_WRITE_BUFFER_BINDING },
+		{ Version46::SHADER_STORAGE_BUFFER, Version46::SHADER_STORAGE_BUFFER_BINDING },
+		{ Version46::DISPATCH_INDIRECT_BUFFER, Version46::DISPATCH_INDIRECT_BUFFER_BINDING },
+		{ Version46::ATOMIC_COUNTER_BUFFER, Version46::ATOMIC_COUNTER_BUFFER_BINDING },
+		{ Version46::QUERY_BUFFER, Version46::QUERY_BUFFER_BINDING },
+	};
+
+	// 按每个纹理单元的数组的下标排列
+	static const TargetBinding TextureTargets[] =
+	{
+		{ Version46::TEXTURE_1D, Version46::TEXTURE_BINDING_1D },
+		{ Version46::TEXTURE_2D, Version46::TEXTURE_BINDING_2D },
+		{ Version46::TEXTURE_3D, Version46::TEXTURE_BINDING_3D },
+		{ Version46::TEXTURE_1D_ARRAY, Version46::TEXTURE_BINDING_1D_ARRAY },
+		{ Version46::TEXTURE_2D_ARRAY, Version46::TEXTURE_BINDING_2D_ARRAY },
+		{ Version46::TEXTURE_RECTANGLE, Version46::TEXTURE_BINDING_RECTANGLE },
+		{ Version46::TEXTURE_CUBE_MAP, Version46::TEXTURE_BINDING_CUBE_MAP },
+		{ Version46::TEXTURE_CUBE_MAP_ARRAY, Version46::TEXTURE_BINDING_CUBE_MAP_ARRAY },
+		{ Version46::TEXTURE_2D_MULTISAMPLE, Version46::TEXTURE_BINDING_2D_MULTISAMPLE },
+		{ Version46::TEXTURE_2D_MULTISAMPLE_ARRAY, Version46::TEXTURE_BINDING_2D_MULTISAMPLE_ARRAY },
+	};
+
+	static_assert(std::size(BufferTargets) == 12 && std::size(TextureTargets) == 10);
+
+	StateCache::StateCache(const Version46& gl) :
+		gl(gl)
+	{
+		Invalidate();
+	}
+
+	int StateCache::GetBufferTargetIndex(GLenum Target)
+	{
+		for (int i = 0; i < int(NumBufferTargets); i++) if (BufferTargets[i].Target == Target) return i;
+		return -1;
+	}
+
+	int StateCache::GetTextureTargetIndex(GLenum Target)
+	{
+		for (int i = 0; i < int(NumTextureTargets); i++) if (TextureTargets[i].Target == Target) return i;
+		return -1;
+	}
+
+	std::array<GLuint, StateCache::NumTextureTargets>& StateCache::GetUnit(GLuint Unit)
+	{
+		if (Unit >= Units.size())
+		{
+			std::array<GLuint, NumTextureTargets> UnknownUnit;
+			UnknownUnit.fill(Unknown);
+			Units.resize(size_t(Unit) + 1, UnknownUnit);
+		}
+		return Units[Unit];
+	}
+
+	void StateCache::CheckBinding(GLenum BindingQuery, GLuint Expected, const char* What, GLuint Offset) const
+	{
+		GLint Actual = 0;
+		gl.GetIntegerv(BindingQuery, &Actual);
+		if (GLuint(Actual) != Expected + Offset)
+		{
+			throw StateCacheError(std::string("The cached ") + What + " is " + std::to_string(Expected) + " but the context has " + std::to_string(int64_t(GLuint(Actual)) - int64_t(Offset)) + ".");
+		}
+	}
+
+	bool StateCache::Request(GLuint& Shadow, GLuint Value, GLenum BindingQuery, const char* What, GLuint Offset)
+	{
+		CurFrame.NumRequested++;
+		if (Shadow == Value)
+		{
+			if (Debug) CheckBinding(BindingQuery, Value, What, Offset);
+			CurFrame.NumSkipped++;
+			return false;
+		}
+		Shadow = Value;
+		CurFrame.NumIssued++;
+		return true;
+	}
+
+	void StateCache::UseProgram(GLuint Program)
+	{
+		if (Request(CurProgram, Program, gl.CURRENT_PROGRAM, "program")) gl.UseProgram(Program);
+	}
+
+	void StateCache::BindVertexArray(GLuint VAO)
+	{
+		if (!Request(CurVAO, VAO, gl.VERTEX_ARRAY_BINDING, "VAO")) return;
+		gl.BindVertexArray(VAO);
+
+		// 元素缓冲区跟着 VAO 切换
+		auto it = ElementBuffers.find(VAO);
+		Buffers[1] = it != ElementBuffers.end() ? it->second : Unknown;
+	}
+
+	void StateCache::BindBuffer(GLenum Target, GLuint Buffer)
+	{
+		int i = GetBufferTargetIndex(Target);
+		if (i < 0)
+		{
+			CurFrame.NumRequested++;
+			CurFrame.NumIssued++;
+			gl.BindBuffer(Target, Buffer);
+			return;
+		}
+		if (!Request(Buffers[i], Buffer, BufferTargets[i].Binding, "buffer binding")) return;
+		gl.BindBuffer(Target, Buffer);
+		if (Target == gl.ELEMENT_ARRAY_BUFFER && CurVAO != Unknown) ElementBuffers[CurVAO] = Buffer;
+	}
+
+	void StateCache::BindBufferBase(GLenum Target, GLuint Index, GLuint Buffer)
+	{
+		CurFrame.NumRequested++;
+		CurFrame.NumIssued++;
+		gl.BindBufferBase(Target, Index, Buffer);
+		int i = GetBufferTargetIndex(Target);
+		if (i >= 0) Buffers[i] = Buffer;
+	}
+
+	void StateCache::ActiveTexture(GLuint Unit)
+	{
+		if (Request(ActiveUnit, Unit, gl.ACTIVE_TEXTURE, "active texture unit", gl.TEXTURE0)) gl.ActiveTexture(gl.TEXTURE0 + Unit);
+	}
+
+	void StateCache::BindTexture(GLenum Target, GLuint Texture)
+	{
+		int i = GetTextureTargetIndex(Target);
+		if (i < 0 || ActiveUnit == Unknown)
+		{
+			CurFrame.NumRequested++;
+			CurFrame.NumIssued++;
+			gl.BindTexture(Target, Texture);
+			return;
+		}
+		if (Request(GetUnit(ActiveUnit)[i], Texture, TextureTargets[i].Binding, "texture binding")) gl.BindTexture(Target, Texture);
+	}
+
+	void StateCache::BindTextureUnit(GLuint Unit, GLenum Target, GLuint Texture)
+	{
+		ActiveTexture(Unit);
+		BindTexture(Target, Texture);
+	}
+
+	void StateCache::DeleteBuffers(GLsizei n, const GLuint* Buffers)
+	{
+		gl.DeleteBuffers(n, Buffers);
+		for (GLsizei i = 0; i < n; i++)
+		{
+			if (!Buffers[i]) continue;
+			for (auto& b : this->Buffers) if (b == Buffers[i]) b = 0;
+
+			// 其它 VAO 仍然引用着被删除的缓冲区，它的名字之后可能被重用，不再认为知道这些 VAO 的元素缓冲区
+			for (auto& e : ElementBuffers) if (e.second == Buffers[i]) e.second = Unknown;
+		}
+	}
+
+	void StateCache::DeleteTextures(GLsizei n, const GLuint* Textures)
+	{
+		gl.DeleteTextures(n, Textures);
+		for (GLsizei i = 0; i < n; i++)
+		{
+			if (!Textures[i]) continue;
+			for (auto& u : Units) for (auto& t : u) if (t == Textures[i]) t = 0;
+		}
+	}
+
+	void StateCache::DeleteVertexArrays(GLsizei n, const GLuint* VAOs)
+	{
+		gl.DeleteVertexArrays(n, VAOs);
+		for (GLsizei i = 0; i < n; i++)
+		{
+			if (!VAOs[i]) continue;
+			if (CurVAO == VAOs[i])
+			{
+				CurVAO = 0;
+				auto it = ElementBuffers.find(0);
+				Buffers[1] = it != ElementBuffers.end() ? it->second : Unknown;
+			}
+			ElementBuffers.erase(VAOs[i]);
+		}
+	}
+
+	void StateCache::DeleteProgram(GLuint Program)
+	{
+		gl.DeleteProgram(Program);
+
+		// 正在使用的程序对象要等到不再使用时才真正删除，名字仍然有效
+	}
+
+	void StateCache::Invalidate()
+	{
+		CurProgram = Unknown;
+		CurVAO = Unknown;
+		ActiveUnit = Unknown;
+		Buffers.fill(Unknown);
+		Units.clear();
+		ElementBuffers.clear();
+	}
+
+	void StateCache::Verify()
+	{
+		if (CurProgram != Unknown) CheckBinding(gl.CURRENT_PROGRAM, CurProgram, "program");
+		if (CurVAO != Unknown) CheckBinding(gl.VERTEX_ARRAY_BINDING, CurVAO, "VAO");
+		for (size_t i = 0; i < NumBufferTargets; i++)
+		{
+			if (Buffers[i] != Unknown) CheckBinding(BufferTargets[i].Binding, Buffers[i], "buffer binding");
+		}
+
+		// 逐个切换纹理单元查询，最后恢复原来的活动单元
+		GLint OrigActive = 0;
+		gl.GetIntegerv(gl.ACTIVE_TEXTURE, &OrigActive);
+		if (ActiveUnit != Unknown) CheckBinding(gl.ACTIVE_TEXTURE, ActiveUnit, "active texture unit", gl.TEXTURE0);
+		for (size_t u = 0; u < Units.size(); u++)
+		{
+			gl.ActiveTexture(gl.TEXTURE0 + GLenum(u));
+			for (size_t i = 0; i < NumTextureTargets; i++)
+			{
+				if (Units[u][i] == Unknown) continue;
+				try
+				{
+					CheckBinding(TextureTargets[i].Binding, Units[u][i], "texture binding");
+				}
+				catch (const StateCacheError&)
+				{
+					gl.ActiveTexture(GLenum(OrigActive));
+					throw;
+				}
+			}
+		}
+		gl.ActiveTexture(GLenum(OrigActive));
+	}
+
+	void StateCache::SetDebug(bool Debug)
+	{
+		this->Debug = Debug;
+	}
+
+	bool StateCache::GetDebug() const
+	{
+		return Debug;
+	}
+
+	void StateCache::EndFrame()
+	{
+		Total.NumRequested += CurFrame.NumRequested;
+		Total.NumIssued += CurFrame.NumIssued;
+		Total.NumSkipped += CurFrame.NumSkipped;
+		LastFrame = CurFrame;
+		CurFrame = StateCacheStats();
+		if (Debug) Verify();
+	}
+
+	StateCacheStats StateCache::GetLastFrameStats() const
+	{
+		return LastFrame;
+	}
+
+	StateCacheStats StateCache::GetTotalStats() const
+	{
+		return Total;
+	}
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "glcore.hpp"
+
+#include <array>
+#include <vector>
+#include <unordered_map>
+#include <stdexcept>
+
+namespace GL
+{
+	class StateCacheError : public std::runtime_error
+	{
+	public:
+		StateCacheError(const std::string& what) noexcept;
+	};
+
+	// `NumRequested` 是经过缓存的绑定调用数，其中 `NumSkipped` 个因为状态没有变化而没有调用 GL
+	struct StateCacheStats
+	{
+		size_t NumRequested = 0;
+		size_t NumIssued = 0;
+		size_t NumSkipped = 0;
+	};
+
+	//-------------------------------------------------------------------
+	// StateCache
+	//
+	// Shadows the bound program, VAO, active texture unit, the textures
+	// bound to each unit and the buffers bound to each target, and only
+	// calls GL when a binding really changes. The element array buffer
+	// is part of the VAO state, so it's remembered per VAO.
+	//
+	// The shadow is only right as long as every bind and delete goes
+	// through the cache; code that binds things directly must call
+	// `Invalidate()` afterwards. In debug mode every skipped call is
+	// checked against `GetIntegerv`, and `Verify()` checks everything.
+	//-------------------------------------------------------------------
+
+	class StateCache
+	{
+	protected:
+		static constexpr GLuint Unknown = ~GLuint(0);
+		static constexpr size_t NumBufferTargets = 12;
+		static constexpr size_t NumTextureTargets = 10;
+
+		const Version46& gl;
+		bool Debug = false;
+
+		GLuint CurProgram = Unknown;
+		GLuint CurVAO = Unknown;
+		GLuint ActiveUnit = Unknown;
+		std::array<GLuint, NumBufferTargets> Buffers;
+		std::vector<std::array<GLuint, NumTextureTargets>> Units;
+
+		// 各个 VAO 绑定的元素缓冲区
+		std::unordered_map<GLuint, GLuint> ElementBuffers;
+
+		StateCacheStats CurFrame;
+		StateCacheStats LastFrame;
+		StateCacheStats Total;
+
+		static int GetBufferTargetIndex(GLenum Target);
+		static int GetTextureTargetIndex(GLenum Target);
+		std::array<GLuint, NumTextureTargets>& GetUnit(GLuint Unit);
+
+		// 记录一次调用，返回是否需要调用 GL；调试模式下跳过之前先查询实际的绑定
+		// `Offset` 是查询结果与影子值之间的差，活动纹理单元查到的是 `TEXTURE0 + n`
+		bool Request(GLuint& Shadow, GLuint Value, GLenum BindingQuery, const char* What, GLuint Offset = 0);
+		void CheckBinding(GLenum BindingQuery, GLuint Expected, const char* What, GLuint Offset = 0) const;
+
+	public:
+		StateCache(const Version46& gl);
+		StateCache(const StateCache&) = delete;
+		StateCache& operator = (const StateCache&) = delete;
+
+		void UseProgram(GLuint Program);
+		void BindVertexArray(GLuint VAO);
+		void BindBuffer(GLenum Target, GLuint Buffer);
+
+		// 索引绑定点不缓存，只更新它同时改变的通用绑定
+		void BindBufferBase(GLenum Target, GLuint Index, GLuint Buffer);
+
+		// `Unit` 是从 0 开始的序号，不是 `TEXTURE0 + n`
+		void ActiveTexture(GLuint Unit);
+		void BindTexture(GLenum Target, GLuint Texture);
+		void BindTextureUnit(GLuint Unit, GLenum Target, GLuint Texture);
+
+		// 删除对象并更新影子状态，否则名字被重用时会以为新对象已经绑定
+		void DeleteBuffers(GLsizei n, const GLuint* Buffers);
+		void DeleteTextures(GLsizei n, const GLuint* Textures);
+		void DeleteVertexArrays(GLsizei n, const GLuint* VAOs);
+		void DeleteProgram(GLuint Program);
+
+		// 绕过缓存改变了绑定之后调用，之后的每种绑定都会先真正调用一次
+		void Invalidate();
+
+		// 把所有已知的影子状态与 `GetIntegerv` 比较，不一致时抛出 `StateCacheError`
+		void Verify();
+
+		void SetDebug(bool Debug);
+		bool GetDebug() const;
+
+		// 每帧结束时调用，`GetLastFrameStats()` 返回上一帧的计数
+		void EndFrame();
+		StateCacheStats GetLastFrameStats() const;
+		StateCacheStats GetTotalStats() const;
+	};
+}
@@ -9,29 +9,88 @@ namespace GLRenderer
 	{
 	}
 
-	TexStream::TexStream(const GLCtxType& GLCtx, const Image_RGBA8& Image) :
+	// 按 `TexFormat` 索引
+	struct TexFormatInfo
+	{
+		GLenum InternalFormat;
+		GLenum Format;
+		GLenum Type;
+		size_t BytesPerPixel;
+	};
+
+	static const TexFormatInfo TexFormatInfos[] =
+	{
+		{ GLCtxType::RGBA, GLCtxType::RGBA, GLCtxType::UNSIGNED_BYTE, 4 },
+		{ GLCtxType::R16, GLCtxType::RED, GLCtxType::UNSIGNED_SHORT, 2 },
+		{ GLCtxType::RGBA16, GLCtxType::RGBA, GLCtxType::UNSIGNED_SHORT, 8 },
+	};
+
+	TexStream::TexStream(const GLCtxType& GLCtx, const Image_RGBA8& Image, uint32_t HistoryLength) :
+		gl(GLCtx),
+		Image(&Image),
+		Format(TexFormat::RGBA8),
+		Width(Image.GetWidth()),
+		Height(Image.GetHeight()),
+		Target(HistoryLength > 1 ? GLCtxType::TEXTURE_2D_ARRAY : GLCtxType::TEXTURE_2D),
+		HistoryLength(HistoryLength)
+	{
+		CreateTexture(Image.GetBitmapDataPtr());
+	}
+
+	TexStream::TexStream(const GLCtxType& GLCtx, TexFormat Format, uint32_t Width, uint32_t Height, uint32_t HistoryLength) :
 		gl(GLCtx),
-		Image(Image)
+		Format(Format),
+		Width(Width),
+		Height(Height),
+		Target(HistoryLength > 1 ? GLCtxType::TEXTURE_2D_ARRAY : GLCtxType::TEXTURE_2D),
+		HistoryLength(HistoryLength)
 	{
+		CreateTexture(nullptr);
+	}
+
+	void TexStream::CreateTexture(const void* InitialData)
+	{
+		auto& Info = TexFormatInfos[size_t(Format)];
+
+		if (!HistoryLength) throw std::invalid_argument("The history length of `TexStream` must not be zero.");
+		if (HistoryLength > 1)
+		{
+			GLint MaxLayers = 0;
+			gl.GetIntegerv(gl.MAX_ARRAY_TEXTURE_LAYERS, &MaxLayers);
+			if (GLint(HistoryLength) > MaxLayers) throw std::invalid_argument("The history length " + std::to_string(HistoryLength) + " of `TexStream` exceeds the " + std::to_string(MaxLayers) + " texture array layers supported.");
+		}
+
+		// 绑定图像时 PBO 的布局与图像相同，每行按图像的行距排列
+		size_t PBOSize = Image ? Image->GetPitch() * Height : size_t(Width) * Height * Info.BytesPerPixel;
 		gl.GenBuffers(1, &StreamerPBO);
-		gl.BindBuffer(gl.PIXEL_UNPACK_BUFFER, StreamerPBO);
-		gl.BufferData(gl.PIXEL_UNPACK_BUFFER, Image.GetBitmapSizeInTotal(), Image.GetBitmapDataPtr(), gl.STREAM_DRAW);
+		gl.State.BindBuffer(gl.PIXEL_UNPACK_BUFFER, StreamerPBO);
+		gl.BufferData(gl.PIXEL_UNPACK_BUFFER, PBOSize, InitialData, gl.STREAM_DRAW);
 
 		gl.GenTextures(1, &Texture);
-		gl.BindTexture(gl.TEXTURE_2D, Texture);
-		gl.TexParameteri(gl.TEXTURE_2D, gl.TEXTURE_WRAP_S, gl.CLAMP_TO_EDGE);
-		gl.TexParameteri(gl.TEXTURE_2D, gl.TEXTURE_WRAP_T, gl.CLAMP_TO_EDGE);
-		gl.TexParameteri(gl.TEXTURE_2D, gl.TEXTURE_MIN_FILTER, gl.LINEAR);
-		gl.TexParameteri(gl.TEXTURE_2D, gl.TEXTURE_MAG_FILTER, gl.LINEAR);
-		gl.TexImage2D(gl.TEXTURE_2D, 0, gl.RGBA, Image.GetWidth(), Image.GetHeight(), 0, gl.RGBA, gl.UNSIGNED_BYTE, nullptr);
-		gl.BindTexture(gl.TEXTURE_2D, 0);
+		gl.State.BindTexture(Target, Texture);
+		gl.TexParameteri(Target, gl.TEXTURE_WRAP_S, gl.CLAMP_TO_EDGE);
+		gl.TexParameteri(Target, gl.TEXTURE_WRAP_T, gl.CLAMP_TO_EDGE);
+		gl.TexParameteri(Target, gl.TEXTURE_MIN_FILTER, gl.LINEAR);
+		gl.TexParameteri(Target, gl.TEXTURE_MAG_FILTER, gl.LINEAR);
+		if (HistoryLength > 1)
+		{
+			// 所有层一次分配好，之后只用 `TexSubImage3D` 覆盖最旧的一层
+			gl.TexImage3D(Target, 0, Info.InternalFormat, Width, Height, HistoryLength, 0, Info.Format, Info.Type, nullptr);
+		}
+		else
+		{
+			gl.TexImage2D(Target, 0, Info.InternalFormat, Width, Height, 0, Info.Format, Info.Type, nullptr);
+		}
 
-		gl.BindBuffer(gl.PIXEL_UNPACK_BUFFER, 0);
+		gl.State.BindBuffer(gl.PIXEL_UNPACK_BUFFER, 0);
 	}
 
 	void TexStream::Update()
 	{
-		gl.BindBuffer(gl.PIXEL_UNPACK_BUFFER, StreamerPBO);
+		if (!Image) throw UpdateError("`TexStream::Update()` needs the pixel data when the texture isn't bound to an image.");
+		auto& Image = *this->Image;
+
+		gl.State.BindBuffer(gl.PIXEL_UNPACK_BUFFER, StreamerPBO);
 		void* MapPtr = gl.MapBuffer(gl.PIXEL_UNPACK_BUFFER, gl.WRITE_ONLY);
 		if (!MapPtr) throw UpdateError("`TexStream::Update()` failed to map PBO.");
 
@@ -46,11 +105,99 @@ namespace GLRenderer
 		}
 		gl.UnmapBuffer(gl.PIXEL_UNPACK_BUFFER);
 
-		gl.BindTexture(gl.TEXTURE_2D, Texture);
-		gl.TexImage2D(gl.TEXTURE_2D, 0, gl.RGBA, Image.GetWidth(), Image.GetHeight(), 0, gl.RGBA, gl.UNSIGNED_BYTE, nullptr);
-		gl.BindTexture(gl.TEXTURE_2D, 0);
+		gl.PixelStorei(gl.UNPACK_ROW_LENGTH, GLint(Pitch / sizeof(Pixel_RGBA8)));
+		if (HistoryLength > 1)
+		{
+			UploadToNextLayer(gl.RGBA, gl.UNSIGNED_BYTE);
+		}
+		else
+		{
+			gl.State.BindTexture(gl.TEXTURE_2D, Texture);
+			gl.TexImage2D(gl.TEXTURE_2D, 0, gl.RGBA, Image.GetWidth(), Image.GetHeight(), 0, gl.RGBA, gl.UNSIGNED_BYTE, nullptr);
+		}
+		gl.PixelStorei(gl.UNPACK_ROW_LENGTH, 0);
+
+		gl.State.BindBuffer(gl.PIXEL_UNPACK_BUFFER, 0);
+	}
+
+	void TexStream::Update(uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height)
+	{
+		if (!Image) throw UpdateError("`TexStream::Update()` needs the pixel data when the texture isn't bound to an image.");
+		if (HistoryLength > 1) throw UpdateError("`TexStream::Update()`: a texture with history can't be partially updated, every frame goes into a new layer.");
+		auto& Image = *this->Image;
+
+		if (X >= Image.GetWidth() || Y >= Image.GetHeight()) return;
+		if (Width > Image.GetWidth() - X) Width = Image.GetWidth() - X;
+		if (Height > Image.GetHeight() - Y) Height = Image.GetHeight() - Y;
+		if (!Width || !Height) return;
+
+		size_t Pitch = Image.GetPitch();
+		size_t RowBytes = size_t(Width) * sizeof(Pixel_RGBA8);
+
+		// PBO 的布局与图像相同，只映射并写入脏区域覆盖到的行
+		gl.State.BindBuffer(gl.PIXEL_UNPACK_BUFFER, StreamerPBO);
+		void* MapPtr = gl.MapBufferRange(gl.PIXEL_UNPACK_BUFFER, GLintptr(Pitch * Y), GLsizeiptr(Pitch * Height), gl.MAP_WRITE_BIT | gl.MAP_INVALIDATE_RANGE_BIT);
+		if (!MapPtr) throw UpdateError("`TexStream::Update()` failed to map PBO range.");
+
+		for (uint32_t y = 0; y < Height; y++)
+		{
+			void* DstRow = reinterpret_cast<void*>(reinterpret_cast<size_t>(MapPtr) + Pitch * y + sizeof(Pixel_RGBA8) * X);
+			memcpy(DstRow, Image.GetBitmapRowPtr(Y + y) + X, RowBytes);
+		}
+		gl.UnmapBuffer(gl.PIXEL_UNPACK_BUFFER);
+
+		gl.PixelStorei(gl.UNPACK_ROW_LENGTH, GLint(Pitch / sizeof(Pixel_RGBA8)));
+		gl.PixelStorei(gl.UNPACK_SKIP_PIXELS, X);
+		gl.PixelStorei(gl.UNPACK_SKIP_ROWS, Y);
 
-		gl.BindBuffer(gl.PIXEL_UNPACK_BUFFER, 0);
+		gl.State.BindTexture(gl.TEXTURE_2D, Texture);
+		gl.TexSubImage2D(gl.TEXTURE_2D, 0, X, Y, Width, Height, gl.RGBA, gl.UNSIGNED_BYTE, nullptr);
+
+		gl.PixelStorei(gl.UNPACK_ROW_LENGTH, 0);
+		gl.PixelStorei(gl.UNPACK_SKIP_PIXELS, 0);
+		gl.PixelStorei(gl.UNPACK_SKIP_ROWS, 0);
+
+		gl.State.BindBuffer(gl.PIXEL_UNPACK_BUFFER, 0);
+	}
+
+	void TexStream::Update(const void* pData, size_t Pitch)
+	{
+		auto& Info = TexFormatInfos[size_t(Format)];
+		size_t RowBytes = size_t(Width) * Info.BytesPerPixel;
+		if (Pitch < RowBytes) throw UpdateError("`TexStream::Update()`: the pitch is smaller than a row of the texture.");
+
+		gl.State.BindBuffer(gl.PIXEL_UNPACK_BUFFER, StreamerPBO);
+		void* MapPtr = gl.MapBufferRange(gl.PIXEL_UNPACK_BUFFER, 0, GLsizeiptr(RowBytes * Height), gl.MAP_WRITE_BIT | gl.MAP_INVALIDATE_BUFFER_BIT);
+		if (!MapPtr) throw UpdateError("`TexStream::Update()` failed to map PBO.");
+
+		// PBO 里紧密排列，16 位的行长度总是 2 的倍数
+		for (uint32_t y = 0; y < Height; y++)
+		{
+			void* DstRow = reinterpret_cast<void*>(reinterpret_cast<size_t>(MapPtr) + RowBytes * y);
+			memcpy(DstRow, reinterpret_cast<const uint8_t*>(pData) + Pitch * y, RowBytes);
+		}
+		gl.UnmapBuffer(gl.PIXEL_UNPACK_BUFFER);
+
+		gl.PixelStorei(gl.UNPACK_ALIGNMENT, 2);
+		if (HistoryLength > 1) UploadToNextLayer(Info.Format, Info.Type);
+		else
+		{
+			gl.State.BindTexture(gl.TEXTURE_2D, Texture);
+			gl.TexSubImage2D(gl.TEXTURE_2D, 0, 0, 0, Width, Height, Info.Format, Info.Type, nullptr);
+		}
+		gl.PixelStorei(gl.UNPACK_ALIGNMENT, 4);
+
+		gl.State.BindBuffer(gl.PIXEL_UNPACK_BUFFER, 0);
+	}
+
+	void TexStream::UploadToNextLayer(GLenum PixelFormat, GLenum PixelType)
+	{
+		// 最旧的一层被新的帧覆盖
+		uint32_t Layer = uint32_t(NumFrames % HistoryLength);
+		gl.State.BindTexture(gl.TEXTURE_2D_ARRAY, Texture);
+		gl.TexSubImage3D(gl.TEXTURE_2D_ARRAY, 0, 0, 0, Layer, Width, Height, 1, PixelFormat, PixelType, nullptr);
+		Head = Layer;
+		NumFrames++;
 	}
 
 	void TexStream::BindUniform(const Program& p, const std::string& UniformName, int BindPoint) const
@@ -59,12 +206,44 @@ namespace GLRenderer
 
 		if (Location >= 0)
 		{
-			gl.ActiveTexture(gl.TEXTURE0 + BindPoint);
-			gl.BindTexture(gl.TEXTURE_2D, Texture);
+			gl.State.BindTextureUnit(BindPoint, Target, Texture);
 			gl.Uniform1i(Location, BindPoint);
 		}
 	}
 
+	void TexStream::BindHistoryUniform(const Program& p, const std::string& UniformName, const std::string& HeadUniformName, int BindPoint) const
+	{
+		BindUniform(p, UniformName, BindPoint);
+
+		auto HeadLocation = p.GetUniformLocation(HeadUniformName);
+		if (HeadLocation >= 0) gl.Uniform1i(HeadLocation, GLint(Head));
+	}
+
+	TexFormat TexStream::GetFormat() const
+	{
+		return Format;
+	}
+
+	GLenum TexStream::GetTarget() const
+	{
+		return Target;
+	}
+
+	uint32_t TexStream::GetHistoryLength() const
+	{
+		return HistoryLength;
+	}
+
+	uint32_t TexStream::GetHead() const
+	{
+		return Head;
+	}
+
+	uint32_t TexStream::GetNumValidLayers() const
+	{
+		return NumFrames < HistoryLength ? uint32_t(NumFrames) : HistoryLength;
+	}
+
 	GLuint TexStream::GetTexture() const
 	{
 		return Texture;
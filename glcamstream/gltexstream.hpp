@@ -21,21 +21,75 @@ namespace GLRenderer
 
 	class Program;
 
+	// 纹理的像素格式，16 位的格式用于高位深的帧（如 `OutputFormatType::Gray16`、`RGBA16`）
+	enum class TexFormat
+	{
+		RGBA8,
+		R16,
+		RGBA16
+	};
+
+	//-------------------------------------------------------------------
+	// TexStream
+	//
+	// Streams frames into a texture through a PBO. With a history length
+	// K greater than 1 the texture is a `TEXTURE_2D_ARRAY` of K layers
+	// used as a ring: frame n goes into layer n % K, and the shaders are
+	// told which layer holds the newest frame, so temporal filters can
+	// read the last K frames without anything being copied or
+	// reallocated. In a shader the frame `Age` frames old is layer
+	// `(Head + K - Age) % K`, and K is `textureSize(...).z`.
+	//-------------------------------------------------------------------
+
 	class TexStream
 	{
 	protected:
 		const GLCtxType& gl;
-		const Image_RGBA8& Image;
+		const Image_RGBA8* Image = nullptr;
+		TexFormat Format = TexFormat::RGBA8;
+		uint32_t Width = 0;
+		uint32_t Height = 0;
 		GLuint Texture = 0;
 		GLuint StreamerPBO = 0;
 
+		// 历史长度为 1 时是普通的 `TEXTURE_2D`
+		GLenum Target;
+		uint32_t HistoryLength = 1;
+		uint32_t Head = 0;
+		uint64_t NumFrames = 0;
+
+		void CreateTexture(const void* InitialData);
+
+		// 把 PBO 里紧密排列或按 `UNPACK_ROW_LENGTH` 排列的数据写到下一个历史层，并把它作为最新的一层
+		void UploadToNextLayer(GLenum PixelFormat, GLenum PixelType);
+
 	public:
-		TexStream(const GLCtxType& GLCtx, const Image_RGBA8& Image);
+		TexStream(const GLCtxType& GLCtx, const Image_RGBA8& Image, uint32_t HistoryLength = 1);
+
+		// 不绑定 `Image_RGBA8` 的纹理，数据由 `Update(pData, Pitch)` 提供
+		TexStream(const GLCtxType& GLCtx, TexFormat Format, uint32_t Width, uint32_t Height, uint32_t HistoryLength = 1);
 
 		void BindUniform(const Program& p, const std::string& UniformName, int BindPoint) const;
 
+		// 绑定历史纹理，并把最新一帧所在的层号写到 `int` 类型的 `HeadUniformName`
+		void BindHistoryUniform(const Program& p, const std::string& UniformName, const std::string& HeadUniformName, int BindPoint) const;
+
 		void Update();
 
+		// 只上传图像中的脏区域，其余部分保留上次的内容；有历史时每一帧都写到新的一层，不能只上传脏区域
+		void Update(uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height);
+
+		// 上传整幅图像，`pData` 的像素格式与纹理相同，`Pitch` 为每行的字节数
+		void Update(const void* pData, size_t Pitch);
+
+		TexFormat GetFormat() const;
+		GLenum GetTarget() const;
+
+		// `GetNumValidLayers()` 是已经写入过帧的层数，不超过历史长度
+		uint32_t GetHistoryLength() const;
+		uint32_t GetHead() const;
+		uint32_t GetNumValidLayers() const;
+
 		GLuint GetTexture() const;
 		GLuint GetStreamerPBO() const;
 	};
@@ -0,0 +1,335 @@
+#include "glvideowall.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+
+namespace GLRenderer
+{
+	// 四边形的四个角，配合 `TRIANGLE_STRIP` 画成两个三角形
+	static const GLfloat QuadCorners[] =
+	{
+		0, 0,
+		1, 0,
+		0, 1,
+		1, 1,
+	};
+
+	static const char* VideoWallVS =
+"#version 330\n"
+"layout(location = 0) in vec2 iCorner;"
+"layout(location = 1) in vec4 iRect;"
+"layout(location = 2) in vec4 iTexRect;"
+"layout(location = 3) in float iLayer;"
+"out vec3 vTexCoord;"
+"void main()"
+"{"
+"    vTexCoord = vec3(iTexRect.xy + iCorner * iTexRect.zw, iLayer);"
+"    gl_Position = vec4(iRect.xy + iCorner * iRect.zw, 0, 1);"
+"}";
+
+	static const char* VideoWallFS =
+"#version 330\n"
+"in vec3 vTexCoord;"
+"uniform sampler2DArray iTexture;"
+"out vec4 FragColor;"
+"void main()"
+"{"
+"    FragColor = texture(iTexture, vTexCoord);"
+"}";
+
+	VideoWall::VideoWall(const GLCtxType& GLCtx, uint32_t NumTiles, uint32_t SlotWidth, uint32_t SlotHeight) :
+		gl(GLCtx),
+		SlotWidth(SlotWidth),
+		SlotHeight(SlotHeight),
+		Tiles(NumTiles)
+	{
+		if (!NumTiles || !SlotWidth || !SlotHeight) throw std::invalid_argument("`VideoWall` needs at least one tile with a non-zero size.");
+
+		GLint MaxLayers = 0;
+		gl.GetIntegerv(gl.MAX_ARRAY_TEXTURE_LAYERS, &MaxLayers);
+		if (GLint(NumTiles) > MaxLayers) throw std::invalid_argument("`VideoWall`: " + std::to_string(NumTiles) + " tiles exceed the " + std::to_string(MaxLayers) + " texture array layers supported.");
+
+		gl.GenTextures(1, &Texture);
+		gl.State.BindTexture(gl.TEXTURE_2D_ARRAY, Texture);
+		gl.TexParameteri(gl.TEXTURE_2D_ARRAY, gl.TEXTURE_WRAP_S, gl.CLAMP_TO_EDGE);
+		gl.TexParameteri(gl.TEXTURE_2D_ARRAY, gl.TEXTURE_WRAP_T, gl.CLAMP_TO_EDGE);
+		gl.TexParameteri(gl.TEXTURE_2D_ARRAY, gl.TEXTURE_MIN_FILTER, gl.LINEAR);
+		gl.TexParameteri(gl.TEXTURE_2D_ARRAY, gl.TEXTURE_MAG_FILTER, gl.LINEAR);
+		gl.TexImage3D(gl.TEXTURE_2D_ARRAY, 0, gl.RGBA8, SlotWidth, SlotHeight, NumTiles, 0, gl.RGBA, gl.UNSIGNED_BYTE, nullptr);
+
+		gl.GenBuffers(1, &StreamerPBO);
+		gl.State.BindBuffer(gl.PIXEL_UNPACK_BUFFER, StreamerPBO);
+		gl.BufferData(gl.PIXEL_UNPACK_BUFFER, size_t(SlotWidth) * SlotHeight * sizeof(Pixel_RGBA8), nullptr, gl.STREAM_DRAW);
+		gl.State.BindBuffer(gl.PIXEL_UNPACK_BUFFER, 0);
+
+		DrawProgram = std::make_unique<Program>(gl, VideoWallVS, "", VideoWallFS);
+		TextureLocation = DrawProgram->GetUniformLocation("iTexture");
+
+		gl.GenVertexArrays(1, &VAO);
+		gl.State.BindVertexArray(VAO);
+
+		gl.GenBuffers(1, &QuadBuffer);
+		gl.State.BindBuffer(gl.ARRAY_BUFFER, QuadBuffer);
+		gl.BufferData(gl.ARRAY_BUFFER, sizeof QuadCorners, QuadCorners, gl.STATIC_DRAW);
+		gl.EnableVertexAttribArray(0);
+		gl.VertexAttribPointer(0, 2, gl.FLOAT, false, 2 * sizeof(GLfloat), nullptr);
+
+		// 每个格子一个实例，缓冲区按格子数一次分配好
+		gl.GenBuffers(1, &InstancesBuffer);
+		gl.State.BindBuffer(gl.ARRAY_BUFFER, InstancesBuffer);
+		gl.BufferData(gl.ARRAY_BUFFER, sizeof(TileInstance) * NumTiles, nullptr, gl.DYNAMIC_DRAW);
+		gl.EnableVertexAttribArray(1);
+		gl.VertexAttribPointer(1, 4, gl.FLOAT, false, sizeof(TileInstance), reinterpret_cast<void*>(offsetof(TileInstance, Rect)));
+		gl.VertexAttribDivisor(1, 1);
+		gl.EnableVertexAttribArray(2);
+		gl.VertexAttribPointer(2, 4, gl.FLOAT, false, sizeof(TileInstance), reinterpret_cast<void*>(offsetof(TileInstance, TexRect)));
+		gl.VertexAttribDivisor(2, 1);
+		gl.EnableVertexAttribArray(3);
+		gl.VertexAttribPointer(3, 1, gl.FLOAT, false, sizeof(TileInstance), reinterpret_cast<void*>(offsetof(TileInstance, Layer)));
+		gl.VertexAttribDivisor(3, 1);
+
+		SetGridLayout();
+	}
+
+	VideoWall::~VideoWall()
+	{
+		GLuint Buffers[3] = { StreamerPBO, QuadBuffer, InstancesBuffer };
+		gl.State.DeleteBuffers(3, Buffers);
+		gl.State.DeleteVertexArrays(1, &VAO);
+		gl.State.DeleteTextures(1, &Texture);
+	}
+
+	void VideoWall::SetGridLayout(uint32_t Columns, TileScaleMode ScaleMode)
+	{
+		uint32_t NumTiles = uint32_t(Tiles.size());
+		if (!Columns) Columns = uint32_t(std::ceil(std::sqrt(double(NumTiles))));
+		uint32_t Rows = (NumTiles + Columns - 1) / Columns;
+
+		for (uint32_t i = 0; i < NumTiles; i++)
+		{
+			auto& Layout = Tiles[i].Layout;
+			Layout.X = float(i % Columns) / Columns;
+			Layout.Y = float(i / Columns) / Rows;
+			Layout.Width = 1.0f / Columns;
+			Layout.Height = 1.0f / Rows;
+			Layout.ScaleMode = ScaleMode;
+			Layout.Visible = true;
+		}
+		InstancesDirty = true;
+	}
+
+	void VideoWall::SetTileLayout(uint32_t Index, const TileLayout& Layout)
+	{
+		Tiles.at(Index).Layout = Layout;
+		InstancesDirty = true;
+	}
+
+	const TileLayout& VideoWall::GetTileLayout(uint32_t Index) const
+	{
+		return Tiles.at(Index).Layout;
+	}
+
+	void VideoWall::SetUploadPolicy(TileUploadPolicy Policy)
+	{
+		UploadPolicy = Policy;
+	}
+
+	TileUploadPolicy VideoWall::GetUploadPolicy() const
+	{
+		return UploadPolicy;
+	}
+
+	uint64_t VideoWall::HashFrame(const void* pData, size_t Pitch, uint32_t Width, uint32_t Height)
+	{
+		// FNV-1a，按 8 字节一次，每行剩下的字节逐个加入
+		uint64_t Hash = 0xcbf29ce484222325ull;
+		size_t RowBytes = size_t(Width) * sizeof(Pixel_RGBA8);
+		for (uint32_t y = 0; y < Height; y++)
+		{
+			auto Row = reinterpret_cast<const uint8_t*>(pData) + Pitch * y;
+			size_t x = 0;
+			for (; x + 8 <= RowBytes; x += 8)
+			{
+				uint64_t Word;
+				memcpy(&Word, Row + x, 8);
+				Hash = (Hash ^ Word) * 0x100000001b3ull;
+			}
+			for (; x < RowBytes; x++) Hash = (Hash ^ Row[x]) * 0x100000001b3ull;
+		}
+		return Hash;
+	}
+
+	bool VideoWall::UpdateTile(uint32_t Index, const Image_RGBA8& Image, uint64_t FrameId)
+	{
+		return UpdateTile(Index, Image.GetBitmapDataPtr(), Image.GetPitch(), Image.GetWidth(), Image.GetHeight(), FrameId);
+	}
+
+	bool VideoWall::UpdateTile(uint32_t Index, const void* pData, size_t Pitch, uint32_t Width, uint32_t Height, uint64_t FrameId)
+	{
+		auto& Tile = Tiles.at(Index);
+		if (Width > SlotWidth || Height > SlotHeight)
+		{
+			throw UpdateError("`VideoWall::UpdateTile()`: the " + std::to_string(Width) + "x" + std::to_string(Height) + " frame doesn't fit in the " + std::to_string(SlotWidth) + "x" + std::to_string(SlotHeight) + " tiles.");
+		}
+		size_t RowBytes = size_t(Width) * sizeof(Pixel_RGBA8);
+		if (Pitch < RowBytes) throw UpdateError("`VideoWall::UpdateTile()`: the pitch is smaller than a row of the frame.");
+
+		// 帧号 0 表示不知道帧号，总是当作新的一帧
+		bool SameSize = Tile.HasFrame && Tile.Width == Width && Tile.Height == Height;
+		if (SameSize && UploadPolicy != TileUploadPolicy::Always && FrameId && FrameId == Tile.FrameId)
+		{
+			NumSkippedUploads++;
+			return false;
+		}
+		uint64_t ContentHash = 0;
+		if (UploadPolicy == TileUploadPolicy::IfContentChanged)
+		{
+			ContentHash = HashFrame(pData, Pitch, Width, Height);
+			if (SameSize && ContentHash == Tile.ContentHash)
+			{
+				Tile.FrameId = FrameId;
+				NumSkippedUploads++;
+				return false;
+			}
+		}
+
+		// 每次上传前废弃 PBO 原来的内容，不用等上一次上传完成
+		gl.State.BindBuffer(gl.PIXEL_UNPACK_BUFFER, StreamerPBO);
+		void* MapPtr = gl.MapBufferRange(gl.PIXEL_UNPACK_BUFFER, 0, GLsizeiptr(RowBytes * Height), gl.MAP_WRITE_BIT | gl.MAP_INVALIDATE_BUFFER_BIT);
+		if (!MapPtr) throw UpdateError("`VideoWall::UpdateTile()` failed to map PBO.");
+		for (uint32_t y = 0; y < Height; y++)
+		{
+			void* DstRow = reinterpret_cast<void*>(reinterpret_cast<size_t>(MapPtr) + RowBytes * y);
+			memcpy(DstRow, reinterpret_cast<const uint8_t*>(pData) + Pitch * y, RowBytes);
+		}
+		gl.UnmapBuffer(gl.PIXEL_UNPACK_BUFFER);
+
+		gl.State.BindTexture(gl.TEXTURE_2D_ARRAY, Texture);
+		gl.TexSubImage3D(gl.TEXTURE_2D_ARRAY, 0, 0, 0, Index, Width, Height, 1, gl.RGBA, gl.UNSIGNED_BYTE, nullptr);
+		gl.State.BindBuffer(gl.PIXEL_UNPACK_BUFFER, 0);
+
+		if (!SameSize) InstancesDirty = true;
+		Tile.HasFrame = true;
+		Tile.Width = Width;
+		Tile.Height = Height;
+		Tile.FrameId = FrameId;
+		Tile.ContentHash = ContentHash;
+		NumUploads++;
+		return true;
+	}
+
+	void VideoWall::BuildInstances()
+	{
+		Instances.clear();
+		for (uint32_t i = 0; i < Tiles.size(); i++)
+		{
+			auto& Tile = Tiles[i];
+			auto& Layout = Tile.Layout;
+			if (!Tile.HasFrame || !Layout.Visible) continue;
+
+			// 以像素计算格子和画面的宽高比
+			float X = Layout.X, Y = Layout.Y, W = Layout.Width, H = Layout.Height;
+			float U = 0, V = 0, UW = float(Tile.Width) / SlotWidth, VH = float(Tile.Height) / SlotHeight;
+			float TileAspect = (W * ViewportWidth) / (H * ViewportHeight);
+			float FrameAspect = float(Tile.Width) / Tile.Height;
+			switch (Layout.ScaleMode)
+			{
+			case TileScaleMode::Stretch:
+				break;
+			case TileScaleMode::Fit:
+				if (FrameAspect > TileAspect)
+				{
+					float NewH = H * TileAspect / FrameAspect;
+					Y += (H - NewH) / 2;
+					H = NewH;
+				}
+				else
+				{
+					float NewW = W * FrameAspect / TileAspect;
+					X += (W - NewW) / 2;
+					W = NewW;
+				}
+				break;
+			case TileScaleMode::Fill:
+				if (FrameAspect > TileAspect)
+				{
+					float NewUW = UW * TileAspect / FrameAspect;
+					U += (UW - NewUW) / 2;
+					UW = NewUW;
+				}
+				else
+				{
+					float NewVH = VH * FrameAspect / TileAspect;
+					V += (VH - NewVH) / 2;
+					VH = NewVH;
+				}
+				break;
+			}
+
+			// 换算到 NDC，纹理的第一行是图像的第一行，在格子的上方
+			TileInstance Instance;
+			Instance.Rect[0] = X * 2 - 1;
+			Instance.Rect[1] = 1 - Y * 2;
+			Instance.Rect[2] = W * 2;
+			Instance.Rect[3] = -H * 2;
+			Instance.TexRect[0] = U;
+			Instance.TexRect[1] = V;
+			Instance.TexRect[2] = UW;
+			Instance.TexRect[3] = VH;
+			Instance.Layer = float(i);
+			Instances.push_back(Instance);
+		}
+
+		gl.State.BindBuffer(gl.ARRAY_BUFFER, InstancesBuffer);
+		if (Instances.size()) gl.BufferSubData(gl.ARRAY_BUFFER, 0, sizeof(TileInstance) * Instances.size(), Instances.data());
+		InstancesDirty = false;
+	}
+
+	void VideoWall::Draw(uint32_t ViewportWidth, uint32_t ViewportHeight)
+	{
+		if (!ViewportWidth || !ViewportHeight) return;
+		if (ViewportWidth != this->ViewportWidth || ViewportHeight != this->ViewportHeight)
+		{
+			this->ViewportWidth = ViewportWidth;
+			this->ViewportHeight = ViewportHeight;
+			InstancesDirty = true;
+		}
+		if (InstancesDirty) BuildInstances();
+		if (Instances.empty()) return;
+
+		DrawProgram->Use();
+		gl.State.BindTextureUnit(0, gl.TEXTURE_2D_ARRAY, Texture);
+		gl.Uniform1i(TextureLocation, 0);
+
+		gl.State.BindVertexArray(VAO);
+		gl.DrawArraysInstanced(gl.TRIANGLE_STRIP, 0, 4, GLsizei(Instances.size()));
+		NumDrawCalls++;
+	}
+
+	uint32_t VideoWall::GetNumTiles() const
+	{
+		return uint32_t(Tiles.size());
+	}
+
+	GLuint VideoWall::GetTexture() const
+	{
+		return Texture;
+	}
+
+	size_t VideoWall::GetNumUploads() const
+	{
+		return NumUploads;
+	}
+
+	size_t VideoWall::GetNumSkippedUploads() const
+	{
+		return NumSkippedUploads;
+	}
+
+	size_t VideoWall::GetNumDrawCalls() const
+	{
+		return NumDrawCalls;
+	}
+}
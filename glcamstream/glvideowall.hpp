@@ -0,0 +1,134 @@
+#pragma once
+
+#include "glfwwrap.hpp"
+#include "gltexstream.hpp"
+#include "glprogram.hpp"
+
+#include <unibmp/unibmp.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace GLRenderer
+{
+	using namespace GL;
+	using GLCtxType = GLFWWrap::GLCtxType;
+	using namespace UniformBitmap;
+
+	// 画面与格子宽高比不同时的处理：拉伸、完整显示并留边、填满并裁掉多出的部分
+	enum class TileScaleMode
+	{
+		Stretch,
+		Fit,
+		Fill
+	};
+
+	// 格子在窗口中的位置，以窗口宽高为 1、左上角为原点
+	struct TileLayout
+	{
+		float X = 0;
+		float Y = 0;
+		float Width = 1;
+		float Height = 1;
+		TileScaleMode ScaleMode = TileScaleMode::Fit;
+		bool Visible = true;
+	};
+
+	// `IfFrameIdChanged` 时帧号与上次相同就不上传（帧号为 0 时总是上传），`IfContentChanged` 时再比较整帧的哈希，用于画面冻结的摄像头
+	enum class TileUploadPolicy
+	{
+		Always,
+		IfFrameIdChanged,
+		IfContentChanged
+	};
+
+	//-------------------------------------------------------------------
+	// VideoWall
+	//
+	// Draws the frames of many cameras as tiles of one window. Every
+	// camera has a layer of one `TEXTURE_2D_ARRAY`, and the tiles are
+	// drawn with one instanced draw call whose per-instance data (the
+	// tile rectangle, the part of the layer holding the frame and the
+	// layer) only changes when the layout or a frame size changes. So
+	// the number of binds and draw calls doesn't grow with the number
+	// of cameras.
+	//
+	// Frames may be smaller than the layers; a frame larger than the
+	// layers is rejected.
+	//-------------------------------------------------------------------
+
+	class VideoWall
+	{
+	protected:
+		struct TileInstance
+		{
+			float Rect[4];
+			float TexRect[4];
+			float Layer;
+		};
+
+		struct TileType
+		{
+			TileLayout Layout;
+			uint32_t Width = 0;
+			uint32_t Height = 0;
+			bool HasFrame = false;
+			uint64_t FrameId = 0;
+			uint64_t ContentHash = 0;
+		};
+
+		const GLCtxType& gl;
+		uint32_t SlotWidth;
+		uint32_t SlotHeight;
+		std::vector<TileType> Tiles;
+		TileUploadPolicy UploadPolicy = TileUploadPolicy::IfFrameIdChanged;
+
+		GLuint Texture = 0;
+		GLuint StreamerPBO = 0;
+		GLuint QuadBuffer = 0;
+		GLuint InstancesBuffer = 0;
+		GLuint VAO = 0;
+		std::unique_ptr<Program> DrawProgram;
+		GLint TextureLocation = -1;
+
+		// 布局或帧的尺寸变了才重新生成实例数据
+		std::vector<TileInstance> Instances;
+		bool InstancesDirty = true;
+		uint32_t ViewportWidth = 0;
+		uint32_t ViewportHeight = 0;
+
+		size_t NumUploads = 0;
+		size_t NumSkippedUploads = 0;
+		size_t NumDrawCalls = 0;
+
+		void BuildInstances();
+		static uint64_t HashFrame(const void* pData, size_t Pitch, uint32_t Width, uint32_t Height);
+
+	public:
+		VideoWall(const GLCtxType& GLCtx, uint32_t NumTiles, uint32_t SlotWidth, uint32_t SlotHeight);
+		VideoWall(const VideoWall&) = delete;
+		VideoWall& operator = (const VideoWall&) = delete;
+		~VideoWall();
+
+		// 按行排列所有格子，`Columns` 为 0 时按格子数自动选择列数
+		void SetGridLayout(uint32_t Columns = 0, TileScaleMode ScaleMode = TileScaleMode::Fit);
+		void SetTileLayout(uint32_t Index, const TileLayout& Layout);
+		const TileLayout& GetTileLayout(uint32_t Index) const;
+
+		void SetUploadPolicy(TileUploadPolicy Policy);
+		TileUploadPolicy GetUploadPolicy() const;
+
+		// 上传第 `Index` 个格子的帧，按上传策略跳过时返回 false
+		bool UpdateTile(uint32_t Index, const Image_RGBA8& Image, uint64_t FrameId = 0);
+		bool UpdateTile(uint32_t Index, const void* pData, size_t Pitch, uint32_t Width, uint32_t Height, uint64_t FrameId = 0);
+
+		// 画出所有可见且有帧的格子，只有一次绘制调用
+		void Draw(uint32_t ViewportWidth, uint32_t ViewportHeight);
+
+		uint32_t GetNumTiles() const;
+		GLuint GetTexture() const;
+		size_t GetNumUploads() const;
+		size_t GetNumSkippedUploads() const;
+		size_t GetNumDrawCalls() const;
+	};
+}
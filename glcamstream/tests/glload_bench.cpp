@@ -0,0 +1,67 @@
+// 比较各种 `LoadMode` 下构造上下文的耗时和向驱动查询的次数。stubgl.hpp 的假驱动每次查询额外空转一段时间，模拟真正驱动的开销：
+// g++ -std=c++20 -O2 -I.. glload_bench.cpp ../glcore.cpp -o glload_bench && ./glload_bench [重复次数]
+
+#include "stubgl.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+#include <memory>
+#include <algorithm>
+
+using namespace GL;
+
+static void* APIENTRY SlowGetProcAddress(const char* symbol)
+{
+	volatile int Spin = 0;
+	for (int i = 0; i < 200; i++) Spin = Spin + i;
+	return StubGL::GetProcAddress(symbol);
+}
+
+struct ResultType
+{
+	double BestMicroseconds = 1e9;
+	size_t NumLookups = 0;
+};
+
+// 取多次构造里最快的一次
+static ResultType MeasureConstruction(LoadMode Mode, int Repeats)
+{
+	ResultType Result;
+	for (int i = 0; i < Repeats; i++)
+	{
+		auto Begin = std::chrono::steady_clock::now();
+		auto c = std::make_unique<Version46>(SlowGetProcAddress, Mode);
+		double Elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - Begin).count();
+		Result.BestMicroseconds = std::min(Result.BestMicroseconds, Elapsed);
+		Result.NumLookups = c->GetNumProcLookups();
+	}
+	return Result;
+}
+
+int main(int argc, char** argv)
+{
+	int Repeats = argc > 1 ? std::atoi(argv[1]) : 200;
+
+	std::printf("%-28s %12s %8s\n", "mode", "best us", "lookups");
+	auto Eager = MeasureConstruction(LoadMode::Eager, Repeats);
+	std::printf("%-28s %12.1f %8zu\n", "eager", Eager.BestMicroseconds, Eager.NumLookups);
+
+	auto Lazy = MeasureConstruction(LoadMode::Lazy, Repeats);
+	std::printf("%-28s %12.1f %8zu\n", "lazy", Lazy.BestMicroseconds, Lazy.NumLookups);
+
+	// 缓存由第一个上下文建立，之后的上下文从缓存里取地址
+	{
+		Version46 First(SlowGetProcAddress, LoadMode::Cached);
+		auto Cached = MeasureConstruction(LoadMode::Cached, Repeats);
+		std::printf("%-28s %12.1f %8zu\n", "cached, cache already built", Cached.BestMicroseconds, Cached.NumLookups);
+	}
+
+	// 懒加载的上下文只为真正调用过的函数查询
+	Version46 c(SlowGetProcAddress, LoadMode::Lazy);
+	c.UseProgram(1);
+	c.UseProgram(2);
+	c.BindBuffer(c.ARRAY_BUFFER, 3);
+	std::printf("lazy, after 3 calls to 2 functions: %zu lookups\n", c.GetNumProcLookups());
+	return 0;
+}
@@ -0,0 +1,99 @@
+// 懒加载模式的测试：跳板函数只替换与当前线程的当前上下文驱动相同的上下文，用 stubgl.hpp 的假驱动运行：
+// g++ -std=c++20 -O2 -pthread -I.. glload_test.cpp ../glcore.cpp -o glload_test && ./glload_test
+
+#include "stubgl.hpp"
+#include "../../webcam/tests/check.hpp"
+
+#include <cstdio>
+#include <thread>
+
+using namespace GL;
+
+// 与 `StubGL::GetProcAddress` 返回同样的地址，但作为另一个驱动的入口
+static void* APIENTRY OtherGetProcAddress(const char* symbol)
+{
+	return StubGL::GetProcAddress(symbol);
+}
+
+static void TestSameDriverOnly()
+{
+	StubGL::Reset();
+	StubGL::RendererString = "Stub Renderer";
+	Version46 a(StubGL::GetProcAddress, LoadMode::Lazy);
+	Version46 b(StubGL::GetProcAddress, LoadMode::Lazy);
+	StubGL::RendererString = "Other Renderer";
+	Version46 c(StubGL::GetProcAddress, LoadMode::Lazy);
+	StubGL::RendererString = "Stub Renderer";
+	Version46 d(OtherGetProcAddress, LoadMode::Lazy);
+
+	// 构造时只查询了 glGetString
+	CHECK(a.GetNumProcLookups() == 1);
+	CHECK(c.GetNumProcLookups() == 1);
+
+	// 同一个驱动的 `b` 一起替换，另一个 renderer 的 `c` 和另一个入口的 `d` 留在跳板函数上
+	a.MakeLazyCurrent();
+	a.UseProgram(3);
+	CHECK(StubGL::State.Program == 3);
+	CHECK(a.HasSameDriver(b));
+	CHECK(!a.HasSameDriver(c));
+	CHECK(!a.HasSameDriver(d));
+	CHECK(a.GetNumProcLookups() == 2);
+	CHECK(b.GetNumProcLookups() == 2);
+	CHECK(c.GetNumProcLookups() == 1);
+	CHECK(d.GetNumProcLookups() == 1);
+
+	// 已经替换过的不再查询
+	b.UseProgram(4);
+	CHECK(StubGL::State.Program == 4);
+	CHECK(b.GetNumProcLookups() == 2);
+
+	// 通过不是当前的上下文调用时转发给当前上下文，不替换被调用的上下文
+	c.UseProgram(5);
+	CHECK(StubGL::State.Program == 5);
+	CHECK(c.GetNumProcLookups() == 1);
+
+	// 切换到 `c` 之后它自己的调用才替换它
+	c.MakeLazyCurrent();
+	c.UseProgram(6);
+	CHECK(StubGL::State.Program == 6);
+	CHECK(c.GetNumProcLookups() == 2);
+	CHECK(d.GetNumProcLookups() == 1);
+}
+
+// 没有当前懒加载上下文的线程无从知道该向哪个驱动查询
+static void TestNoCurrentContext()
+{
+	StubGL::Reset();
+	Version46 a(StubGL::GetProcAddress, LoadMode::Lazy);
+	bool Threw = false;
+	std::thread([&]()
+	{
+		try
+		{
+			a.BindVertexArray(1);
+		}
+		catch (const NullFuncPtrException&)
+		{
+			Threw = true;
+		}
+	}).join();
+	CHECK(Threw);
+	CHECK(a.GetNumProcLookups() == 1);
+
+	// 在新线程上设为当前上下文之后就可以调用
+	std::thread([&]()
+	{
+		a.MakeLazyCurrent();
+		a.BindVertexArray(1);
+	}).join();
+	CHECK(StubGL::State.VAO == 1);
+	CHECK(a.GetNumProcLookups() == 2);
+}
+
+int main()
+{
+	TestSameDriverOnly();
+	TestNoCurrentContext();
+
+	return ReportResults();
+}
@@ -0,0 +1,198 @@
+// StateCache 的测试，用 stubgl.hpp 的假驱动代替真正的 GL 上下文，可以在 Linux 上运行：
+// g++ -std=c++20 -O2 -I.. glstate_test.cpp ../glstate.cpp ../glcore.cpp -o glstate_test && ./glstate_test
+
+#include "../glstate.hpp"
+#include "stubgl.hpp"
+#include "../../webcam/tests/check.hpp"
+
+#include <cstdio>
+#include <string>
+
+using namespace GL;
+
+// 调用 `f` 并返回它是否抛出了 `StateCacheError`
+template<typename F>
+static bool Throws(F&& f)
+{
+	try
+	{
+		f();
+	}
+	catch (const StateCacheError&)
+	{
+		return true;
+	}
+	return false;
+}
+
+// 重复的绑定不再调用 GL；调试模式下每次跳过都查询过实际的绑定，包括活动纹理单元
+static void TestSkip(bool Debug)
+{
+	StubGL::Reset();
+	Version46 gl(StubGL::GetProcAddress);
+	StateCache c(gl);
+	c.SetDebug(Debug);
+
+	for (int Frame = 0; Frame < 3; Frame++)
+	{
+		StubGL::State.NumCalls = 0;
+		size_t NumCalls = 0;
+		bool Threw = Throws([&]()
+		{
+			c.UseProgram(3);
+			c.BindVertexArray(5);
+			c.BindBuffer(gl.ARRAY_BUFFER, 7);
+			c.BindTextureUnit(0, gl.TEXTURE_2D, 9);
+			c.BindTextureUnit(1, gl.TEXTURE_2D, 10);
+			c.BindTextureUnit(1, gl.TEXTURE_2D, 10);
+			NumCalls = StubGL::State.NumCalls;
+			c.EndFrame();
+		});
+		CHECK(!Threw);
+
+		// 第一帧调用 7 次，单元 1 上的第二次绑定已经跳过；之后每帧只剩下两次切换纹理单元
+		auto Stats = c.GetLastFrameStats();
+		CHECK(Stats.NumRequested == 9);
+		CHECK(Stats.NumIssued == (Frame ? 2u : 7u));
+		CHECK(NumCalls == Stats.NumIssued);
+		CHECK(Stats.NumSkipped + Stats.NumIssued == Stats.NumRequested);
+	}
+	CHECK(c.GetTotalStats().NumRequested == 27);
+	CHECK(StubGL::State.Program == 3);
+	CHECK(StubGL::State.ActiveUnit == 1);
+	CHECK((StubGL::State.Textures[{ 0, gl.TEXTURE_2D }] == 9));
+}
+
+// 元素缓冲区跟着 VAO 走，切回原来的 VAO 不需要重新绑定
+static void TestElementBufferPerVAO()
+{
+	StubGL::Reset();
+	Version46 gl(StubGL::GetProcAddress);
+	StateCache c(gl);
+	c.SetDebug(true);
+
+	c.BindVertexArray(1);
+	c.BindBuffer(gl.ELEMENT_ARRAY_BUFFER, 11);
+	c.BindVertexArray(2);
+	c.BindBuffer(gl.ELEMENT_ARRAY_BUFFER, 12);
+	c.BindVertexArray(1);
+	StubGL::State.NumCalls = 0;
+	CHECK(!Throws([&]() { c.BindBuffer(gl.ELEMENT_ARRAY_BUFFER, 11); }));
+	CHECK(StubGL::State.NumCalls == 0);
+	CHECK(!Throws([&]() { c.Verify(); }));
+}
+
+// 绕过缓存改变的绑定在调试模式下被发现，`Invalidate()` 之后重新调用
+static void TestOutsideChange()
+{
+	StubGL::Reset();
+	Version46 gl(StubGL::GetProcAddress);
+	StateCache c(gl);
+	c.SetDebug(true);
+
+	c.UseProgram(3);
+	gl.UseProgram(4);
+	CHECK(Throws([&]() { c.UseProgram(3); }));
+
+	c.ActiveTexture(1);
+	gl.ActiveTexture(gl.TEXTURE0 + 3);
+	std::string What;
+	try
+	{
+		c.ActiveTexture(1);
+	}
+	catch (const StateCacheError& e)
+	{
+		What = e.what();
+	}
+	CHECK(What == "The cached active texture unit is 1 but the context has 3.");
+	CHECK(Throws([&]() { c.Verify(); }));
+
+	c.Invalidate();
+	StubGL::State.NumCalls = 0;
+	CHECK(!Throws([&]()
+	{
+		c.UseProgram(3);
+		c.ActiveTexture(1);
+	}));
+	CHECK(StubGL::State.NumCalls == 2);
+	CHECK(!Throws([&]() { c.Verify(); }));
+	CHECK(StubGL::State.Program == 3);
+	CHECK(StubGL::State.ActiveUnit == 1);
+
+	// 不在调试模式时信任影子状态
+	c.SetDebug(false);
+	gl.UseProgram(4);
+	CHECK(!Throws([&]() { c.UseProgram(3); }));
+	CHECK(StubGL::State.Program == 4);
+}
+
+// 删除对象之后，重用的名字要重新绑定
+static void TestDelete()
+{
+	StubGL::Reset();
+	Version46 gl(StubGL::GetProcAddress);
+	StateCache c(gl);
+	c.SetDebug(true);
+
+	GLuint Buffer = 7, Texture = 9, VAO = 5;
+	c.BindVertexArray(VAO);
+	c.BindBuffer(gl.ARRAY_BUFFER, Buffer);
+	c.BindBuffer(gl.ELEMENT_ARRAY_BUFFER, Buffer);
+	c.BindTextureUnit(2, gl.TEXTURE_2D, Texture);
+	c.DeleteBuffers(1, &Buffer);
+	c.DeleteTextures(1, &Texture);
+	CHECK(!Throws([&]() { c.Verify(); }));
+
+	StubGL::State.NumCalls = 0;
+	c.BindBuffer(gl.ARRAY_BUFFER, Buffer);
+	c.BindBuffer(gl.ELEMENT_ARRAY_BUFFER, Buffer);
+	c.BindTexture(gl.TEXTURE_2D, Texture);
+	CHECK(StubGL::State.NumCalls == 3);
+
+	c.DeleteVertexArrays(1, &VAO);
+	CHECK(StubGL::State.VAO == 0);
+	StubGL::State.NumCalls = 0;
+	c.BindVertexArray(VAO);
+	CHECK(StubGL::State.NumCalls == 1);
+	CHECK(!Throws([&]() { c.Verify(); }));
+}
+
+// `Verify()` 逐个检查纹理单元，之后恢复原来的活动单元
+static void TestVerify()
+{
+	StubGL::Reset();
+	Version46 gl(StubGL::GetProcAddress);
+	StateCache c(gl);
+
+	c.BindTextureUnit(0, gl.TEXTURE_2D, 1);
+	c.BindTextureUnit(1, gl.TEXTURE_3D, 2);
+	c.BindTextureUnit(2, gl.TEXTURE_2D, 3);
+	c.BindBuffer(gl.PIXEL_UNPACK_BUFFER, 4);
+	CHECK(!Throws([&]() { c.Verify(); }));
+	CHECK(StubGL::State.ActiveUnit == 2);
+
+	StubGL::State.Textures[{ 1, gl.TEXTURE_3D }] = 5;
+	CHECK(Throws([&]() { c.Verify(); }));
+	CHECK(StubGL::State.ActiveUnit == 2);
+
+	StubGL::State.Textures[{ 1, gl.TEXTURE_3D }] = 2;
+	StubGL::State.Buffers[gl.PIXEL_UNPACK_BUFFER] = 0;
+	CHECK(Throws([&]() { c.Verify(); }));
+
+	// 调试模式下 `EndFrame()` 也会检查
+	c.SetDebug(true);
+	CHECK(Throws([&]() { c.EndFrame(); }));
+}
+
+int main()
+{
+	TestSkip(false);
+	TestSkip(true);
+	TestElementBufferPerVAO();
+	TestOutsideChange();
+	TestDelete();
+	TestVerify();
+
+	return ReportResults();
+}
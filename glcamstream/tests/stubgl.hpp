@@ -0,0 +1,158 @@
+#pragma once
+
+// 用来代替驱动的假 GL：只记录绑定状态和调用次数，`GetIntegerv` 返回记录的绑定，不需要窗口和 GPU
+#include "../glcore.hpp"
+
+#include <cstring>
+#include <map>
+#include <utility>
+
+namespace StubGL
+{
+	using GL::GLenum;
+	using GL::GLuint;
+	using GL::GLint;
+	using GL::GLsizei;
+	using GL::GLubyte;
+	using GL::Version46;
+
+	// 驱动内部的绑定状态，元素缓冲区属于 VAO
+	struct StateType
+	{
+		GLuint Program = 0;
+		GLuint VAO = 0;
+		GLuint ActiveUnit = 0;
+		std::map<GLenum, GLuint> Buffers;
+		std::map<GLuint, GLuint> ElementBuffers;
+		std::map<std::pair<GLuint, GLenum>, GLuint> Textures;
+
+		// 改变状态的调用次数和 `GetProcAddress` 的查询次数
+		size_t NumCalls = 0;
+		size_t NumLookups = 0;
+	};
+
+	inline StateType State;
+	inline const char* RendererString = "Stub Renderer";
+
+	inline const GLubyte* APIENTRY GetString(GLenum name)
+	{
+		switch (name)
+		{
+		case Version46::VENDOR: return reinterpret_cast<const GLubyte*>("Stub Vendor");
+		case Version46::RENDERER: return reinterpret_cast<const GLubyte*>(RendererString);
+		case Version46::VERSION: return reinterpret_cast<const GLubyte*>("4.6.0 Stub");
+		default: return nullptr;
+		}
+	}
+
+	inline void APIENTRY UseProgram(GLuint program)
+	{
+		State.NumCalls++;
+		State.Program = program;
+	}
+
+	inline void APIENTRY BindVertexArray(GLuint array)
+	{
+		State.NumCalls++;
+		State.VAO = array;
+	}
+
+	inline void APIENTRY BindBuffer(GLenum target, GLuint buffer)
+	{
+		State.NumCalls++;
+		if (target == Version46::ELEMENT_ARRAY_BUFFER) State.ElementBuffers[State.VAO] = buffer;
+		else State.Buffers[target] = buffer;
+	}
+
+	inline void APIENTRY BindBufferBase(GLenum target, GLuint, GLuint buffer)
+	{
+		BindBuffer(target, buffer);
+	}
+
+	inline void APIENTRY ActiveTexture(GLenum texture)
+	{
+		State.NumCalls++;
+		State.ActiveUnit = texture - Version46::TEXTURE0;
+	}
+
+	inline void APIENTRY BindTexture(GLenum target, GLuint texture)
+	{
+		State.NumCalls++;
+		State.Textures[{ State.ActiveUnit, target }] = texture;
+	}
+
+	inline void APIENTRY DeleteBuffers(GLsizei n, const GLuint* buffers)
+	{
+		for (GLsizei i = 0; i < n; i++)
+		{
+			for (auto& b : State.Buffers) if (b.second == buffers[i]) b.second = 0;
+			if (State.ElementBuffers[State.VAO] == buffers[i]) State.ElementBuffers[State.VAO] = 0;
+		}
+	}
+
+	inline void APIENTRY DeleteTextures(GLsizei n, const GLuint* textures)
+	{
+		for (GLsizei i = 0; i < n; i++)
+		{
+			for (auto& t : State.Textures) if (t.second == textures[i]) t.second = 0;
+		}
+	}
+
+	inline void APIENTRY DeleteVertexArrays(GLsizei n, const GLuint* arrays)
+	{
+		for (GLsizei i = 0; i < n; i++)
+		{
+			if (State.VAO == arrays[i]) State.VAO = 0;
+			State.ElementBuffers.erase(arrays[i]);
+		}
+	}
+
+	inline void APIENTRY DeleteProgram(GLuint)
+	{
+	}
+
+	inline void APIENTRY GetIntegerv(GLenum pname, GLint* data)
+	{
+		GLuint Value = 0;
+		switch (pname)
+		{
+		case Version46::CURRENT_PROGRAM: Value = State.Program; break;
+		case Version46::VERTEX_ARRAY_BINDING: Value = State.VAO; break;
+		case Version46::ACTIVE_TEXTURE: Value = Version46::TEXTURE0 + State.ActiveUnit; break;
+		case Version46::ELEMENT_ARRAY_BUFFER_BINDING: Value = State.ElementBuffers[State.VAO]; break;
+		case Version46::ARRAY_BUFFER_BINDING: Value = State.Buffers[Version46::ARRAY_BUFFER]; break;
+		case Version46::PIXEL_PACK_BUFFER_BINDING: Value = State.Buffers[Version46::PIXEL_PACK_BUFFER]; break;
+		case Version46::PIXEL_UNPACK_BUFFER_BINDING: Value = State.Buffers[Version46::PIXEL_UNPACK_BUFFER]; break;
+		case Version46::UNIFORM_BUFFER_BINDING: Value = State.Buffers[Version46::UNIFORM_BUFFER]; break;
+		case Version46::TEXTURE_BINDING_2D: Value = State.Textures[{ State.ActiveUnit, Version46::TEXTURE_2D }]; break;
+		case Version46::TEXTURE_BINDING_3D: Value = State.Textures[{ State.ActiveUnit, Version46::TEXTURE_3D }]; break;
+		}
+		*data = GLint(Value);
+	}
+
+	// 其它函数都当作不支持，调用时会抛出 `NullFuncPtrException`
+	inline void* APIENTRY GetProcAddress(const char* symbol)
+	{
+		State.NumLookups++;
+#define STUBGL_PROC(name) if (!strcmp(symbol, "gl" #name)) return reinterpret_cast<void*>(&name)
+		STUBGL_PROC(GetString);
+		STUBGL_PROC(UseProgram);
+		STUBGL_PROC(BindVertexArray);
+		STUBGL_PROC(BindBuffer);
+		STUBGL_PROC(BindBufferBase);
+		STUBGL_PROC(ActiveTexture);
+		STUBGL_PROC(BindTexture);
+		STUBGL_PROC(DeleteBuffers);
+		STUBGL_PROC(DeleteTextures);
+		STUBGL_PROC(DeleteVertexArrays);
+		STUBGL_PROC(DeleteProgram);
+		STUBGL_PROC(GetIntegerv);
+#undef STUBGL_PROC
+		return nullptr;
+	}
+
+	inline void Reset()
+	{
+		State = StateType();
+	}
+}
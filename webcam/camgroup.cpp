@@ -0,0 +1,428 @@
+#include "camgroup.hpp"
+
+#include <iostream>
+#include <algorithm>
+#include <stdexcept>
+
+namespace WindowsWebCamTypeLib
+{
+	// 当前线程所属的线程池，不是工作线程时为 nullptr
+	static thread_local const WorkStealingPoolType* CurrentPool = nullptr;
+
+	WorkStealingPoolType::WorkStealingPoolType(size_t NumWorkers)
+	{
+		if (!NumWorkers) NumWorkers = std::max(std::thread::hardware_concurrency(), 1u);
+		for (size_t i = 0; i < NumWorkers; i++)
+		{
+			Queues.push_back(std::make_unique<WorkerQueueType>());
+		}
+		for (size_t i = 0; i < NumWorkers; i++)
+		{
+			Workers.push_back(std::thread(&WorkStealingPoolType::WorkerProc, this, i));
+		}
+	}
+
+	WorkStealingPoolType::~WorkStealingPoolType()
+	{
+		{
+			auto lock = std::scoped_lock(SleepLock);
+			Quit = true;
+		}
+		TaskQueued.notify_all();
+		for (auto& w : Workers) w.join();
+	}
+
+	void WorkStealingPoolType::Submit(TaskFuncType Func, void* Userdata, size_t Hint)
+	{
+		if (Hint == SIZE_MAX) Hint = NextQueue++;
+		auto& Queue = *Queues[Hint % Queues.size()];
+
+		// 先计数再入队，否则工作线程可能在计数之前就取走并执行完任务，计数会下溢
+		NumUnfinished++;
+		NumPending++;
+		{
+			auto lock = std::scoped_lock(Queue.Lock);
+			Queue.Tasks.push_back(TaskType{ Func, Userdata });
+		}
+
+		// 空的临界区：正在准备睡眠的线程要么已经看到了新的任务，要么已经在等待通知
+		{
+			auto lock = std::scoped_lock(SleepLock);
+		}
+		TaskQueued.notify_one();
+	}
+
+	bool WorkStealingPoolType::TryPop(size_t Self, TaskType& Task)
+	{
+		{
+			auto& Queue = *Queues[Self];
+			auto lock = std::scoped_lock(Queue.Lock);
+			if (Queue.Tasks.size())
+			{
+				Task = Queue.Tasks.front();
+				Queue.Tasks.pop_front();
+				return true;
+			}
+		}
+
+		// 自己的队列空了，从下一个工作线程开始依次找，取走最早的任务
+		bool Stolen = false;
+		for (size_t i = 1; i < Queues.size() && !Stolen; i++)
+		{
+			auto& Queue = *Queues[(Self + i) % Queues.size()];
+			auto lock = std::scoped_lock(Queue.Lock);
+			if (Queue.Tasks.size())
+			{
+				Task = Queue.Tasks.front();
+				Queue.Tasks.pop_front();
+				Stolen = true;
+			}
+		}
+
+		// 不能同时持有两个队列的锁，两个线程互相窃取时会死锁
+		if (Stolen)
+		{
+			auto& Queue = *Queues[Self];
+			auto lock = std::scoped_lock(Queue.Lock);
+			Queue.NumStolen++;
+		}
+		return Stolen;
+	}
+
+	void WorkStealingPoolType::WorkerProc(size_t Self)
+	{
+		CurrentPool = this;
+		for (;;)
+		{
+			TaskType Task;
+			if (TryPop(Self, Task))
+			{
+				NumPending--;
+				Task.Func(Task.Userdata);
+				{
+					auto& Queue = *Queues[Self];
+					auto lock = std::scoped_lock(Queue.Lock);
+					Queue.NumExecuted++;
+				}
+				if (!--NumUnfinished)
+				{
+					auto lock = std::scoped_lock(SleepLock);
+					AllDone.notify_all();
+				}
+				continue;
+			}
+
+			auto lock = std::unique_lock(SleepLock);
+			TaskQueued.wait(lock, [this]() { return Quit || NumPending.load(); });
+			if (Quit && !NumPending.load()) return;
+		}
+	}
+
+	void WorkStealingPoolType::Wait()
+	{
+		if (IsWorkerThread()) throw std::logic_error("`WorkStealingPoolType::Wait()` called on a worker thread.");
+		auto lock = std::unique_lock(SleepLock);
+		AllDone.wait(lock, [this]() { return !NumUnfinished.load(); });
+	}
+
+	size_t WorkStealingPoolType::GetNumWorkers() const
+	{
+		return Workers.size();
+	}
+
+	size_t WorkStealingPoolType::GetNumExecuted(size_t Worker) const
+	{
+		auto& Queue = *Queues.at(Worker);
+		auto lock = std::scoped_lock(Queue.Lock);
+		return Queue.NumExecuted;
+	}
+
+	size_t WorkStealingPoolType::GetNumStolen(size_t Worker) const
+	{
+		auto& Queue = *Queues.at(Worker);
+		auto lock = std::scoped_lock(Queue.Lock);
+		return Queue.NumStolen;
+	}
+
+	bool WorkStealingPoolType::IsWorkerThread() const
+	{
+		return CurrentPool == this;
+	}
+
+	CameraGroupType::CameraGroupType(CameraGroupFrameCBType OnFrameCB, void* Userdata, size_t NumWorkers, bool Verbose) :
+		Pool(NumWorkers),
+		Verbose(Verbose),
+		Userdata(Userdata),
+		OnFrameCB(OnFrameCB)
+	{
+		if (Verbose)
+		{
+			std::cout << std::string("[INFO] Camera group converts frames on ") + std::to_string(Pool.GetNumWorkers()) + " worker threads.\n";
+		}
+	}
+
+	CameraGroupType::~CameraGroupType()
+	{
+		Stop();
+	}
+
+	std::unique_ptr<CameraGroupType::CameraSlotType> CameraGroupType::NewSlot(const CameraBudget& Budget)
+	{
+		if (!(Budget.MaxFps >= 0) || !(Budget.MaxCpuShare >= 0)) throw std::invalid_argument("Camera budgets must not be negative.");
+		auto Slot = std::make_unique<CameraSlotType>();
+		Slot->Group = this;
+		Slot->Budget = Budget;
+
+		// 摄像头的构造函数会先打开第一个设备
+		Slot->Camera = std::make_unique<WebCamType>(OnCameraFrame, Slot.get(), Verbose);
+		return Slot;
+	}
+
+	size_t CameraGroupType::AddSlot(std::unique_ptr<CameraSlotType> Slot)
+	{
+		auto& s = *Slot;
+		bool Start;
+		{
+			auto lock = std::scoped_lock(Lock);
+			s.Index = Slots.size();
+			Slots.push_back(std::move(Slot));
+			Start = Running;
+		}
+
+		// 运行中加入的摄像头立即开始采集
+		if (Start)
+		{
+			s.Camera->SetFrameDispatcher(OnCameraDispatch, &s);
+			s.Camera->QueryFrame();
+		}
+		return s.Index;
+	}
+
+	size_t CameraGroupType::AddCamera(size_t DeviceIndex, const CameraBudget& Budget)
+	{
+		auto Slot = NewSlot(Budget);
+		if (DeviceIndex) Slot->Camera->SetDevice(DeviceIndex);
+		return AddSlot(std::move(Slot));
+	}
+
+	size_t CameraGroupType::AddCamera(const std::string& DevPath, const CameraBudget& Budget)
+	{
+		auto Slot = NewSlot(Budget);
+		Slot->Camera->SetDevice(DevPath);
+		return AddSlot(std::move(Slot));
+	}
+
+	CameraGroupType::CameraSlotType& CameraGroupType::GetSlot(size_t Index) const
+	{
+		auto lock = std::scoped_lock(Lock);
+		if (Index >= Slots.size()) throw std::out_of_range("Camera index `" + std::to_string(Index) + "` is out of bound.");
+		return *Slots[Index];
+	}
+
+	size_t CameraGroupType::GetNumCameras() const
+	{
+		auto lock = std::scoped_lock(Lock);
+		return Slots.size();
+	}
+
+	WebCamType& CameraGroupType::GetCamera(size_t Index)
+	{
+		return *GetSlot(Index).Camera;
+	}
+
+	void CameraGroupType::SetBudget(size_t Index, const CameraBudget& Budget)
+	{
+		if (!(Budget.MaxFps >= 0) || !(Budget.MaxCpuShare >= 0)) throw std::invalid_argument("Camera budgets must not be negative.");
+		auto& Slot = GetSlot(Index);
+		auto lock = std::scoped_lock(Slot.Lock);
+		Slot.Budget = Budget;
+	}
+
+	CameraBudget CameraGroupType::GetBudget(size_t Index) const
+	{
+		auto& Slot = GetSlot(Index);
+		auto lock = std::scoped_lock(Slot.Lock);
+		return Slot.Budget;
+	}
+
+	std::vector<CameraGroupType::CameraSlotType*> CameraGroupType::SetRunning(bool Running)
+	{
+		auto lock = std::scoped_lock(Lock);
+		auto Ret = std::vector<CameraSlotType*>();
+		if (this->Running == Running) return Ret;
+		this->Running = Running;
+		for (auto& s : Slots) Ret.push_back(s.get());
+		return Ret;
+	}
+
+	// 设置调度时要等摄像头正在进行的转换结束，这时不能持有 `Lock`，否则回调里调用 `GetStats()` 会死锁
+	void CameraGroupType::Start()
+	{
+		for (auto s : SetRunning(true))
+		{
+			s->Camera->SetFrameDispatcher(OnCameraDispatch, s);
+			s->Camera->QueryFrame();
+		}
+	}
+
+	void CameraGroupType::Stop()
+	{
+		auto Stopped = SetRunning(false);
+		if (Stopped.empty()) return;
+
+		// 返回时采集线程上已经没有正在进行的调度，之后不会再有新的任务
+		for (auto s : Stopped) s->Camera->SetFrameDispatcher(nullptr, nullptr);
+		Pool.Wait();
+	}
+
+	bool CameraGroupType::IsRunning() const
+	{
+		return Running;
+	}
+
+	bool CameraGroupType::AcceptFrame(CameraSlotType& Slot)
+	{
+		auto Now = ClockType::now();
+		auto& Budget = Slot.Budget;
+
+		// 允许帧提前四分之一个间隔到达，免得抖动使帧率刚好等于限额的摄像头丢帧
+		ClockType::duration Interval = ClockType::duration::zero();
+		if (Budget.MaxFps > 0)
+		{
+			Interval = std::chrono::duration_cast<ClockType::duration>(std::chrono::duration<double>(1.0 / Budget.MaxFps));
+			if (Now < Slot.NextDue - Interval / 4) return false;
+		}
+
+		// CPU 时间按限额随时间累积，最多攒下半秒的量；转换用掉的时间在转换之后扣除
+		if (Budget.MaxCpuShare > 0)
+		{
+			double Elapsed = std::chrono::duration<double>(Now - Slot.CreditTime).count();
+			Slot.CpuCredit = std::min(Slot.CpuCredit + Elapsed * Budget.MaxCpuShare, 0.5 * Budget.MaxCpuShare);
+			Slot.CreditTime = Now;
+			if (Slot.CpuCredit <= 0) return false;
+		}
+
+		// 落后时最多补一帧，不会因为之前的空闲而连续放行
+		if (Budget.MaxFps > 0) Slot.NextDue = std::max(Slot.NextDue, Now - Interval) + Interval;
+		return true;
+	}
+
+	void CameraGroupType::OnCameraDispatch(void* Userdata, WebCamType& wc)
+	{
+		auto& Slot = *reinterpret_cast<CameraSlotType*>(Userdata);
+		auto& Group = *Slot.Group;
+
+		bool Accepted;
+		{
+			auto lock = std::scoped_lock(Slot.Lock);
+			Slot.Stats.NumReceived++;
+			Accepted = AcceptFrame(Slot);
+			if (!Accepted) Slot.Stats.NumDropped++;
+			else if (Slot.TaskQueued.exchange(true)) Slot.Stats.NumSuperseded++;
+			else Group.Pool.Submit(ConvertTask, &Slot, Slot.Index);
+		}
+
+		// 不等转换完成就请求下一帧
+		if (Group.Running) wc.QueryFrame();
+	}
+
+	void CameraGroupType::ConvertTask(void* Userdata)
+	{
+		auto& Slot = *reinterpret_cast<CameraSlotType*>(Userdata);
+
+		// 转换期间到达的帧需要新的任务
+		Slot.TaskQueued = false;
+
+		auto Start = ClockType::now();
+		bool Converted = false;
+		bool Failed = false;
+		try
+		{
+			Converted = Slot.Camera->ProcessPendingFrame();
+		}
+		catch (const std::exception& e)
+		{
+			Failed = true;
+			if (Slot.Group->Verbose)
+			{
+				std::cerr << std::string("[WARN] Camera ") + std::to_string(Slot.Index) + " failed to convert a frame: " + e.what() + "\n";
+			}
+		}
+		double Seconds = std::chrono::duration<double>(ClockType::now() - Start).count();
+
+		auto lock = std::scoped_lock(Slot.Lock);
+		Slot.CpuCredit -= Seconds;
+		if (Failed) Slot.Stats.NumFailed++;
+		if (!Converted) return;
+		Slot.Stats.NumConverted++;
+		Slot.ConvertSeconds += Seconds;
+	}
+
+	void CameraGroupType::OnCameraFrame(void* Userdata, WebCamType& wc, bool FrameUpdated)
+	{
+		auto& Slot = *reinterpret_cast<CameraSlotType*>(Userdata);
+		auto& Group = *Slot.Group;
+		if (!Group.Running) return;
+
+		// 在采集线程上调用说明这一帧没有经过调度（没有取到帧或者关闭了预览），需要在这里请求下一帧
+		if (!Group.Pool.IsWorkerThread()) wc.QueryFrame();
+		if (Group.OnFrameCB) Group.OnFrameCB(Group.Userdata, Group, Slot.Index, wc, FrameUpdated);
+	}
+
+	CameraGroupStats CameraGroupType::GetStats() const
+	{
+		auto lock = std::scoped_lock(Lock);
+		auto Ret = CameraGroupStats();
+		double Seconds = std::chrono::duration<double>(ClockType::now() - StatsStart).count();
+		double TotalConvertSeconds = 0;
+
+		for (auto& s : Slots)
+		{
+			auto slot_lock = std::scoped_lock(s->Lock);
+			auto Stats = s->Stats;
+			Stats.Seconds = Seconds;
+			if (Seconds > 0)
+			{
+				Stats.Fps = Stats.NumConverted / Seconds;
+				Stats.CpuShare = s->ConvertSeconds / Seconds;
+			}
+			if (Stats.NumConverted) Stats.AvgConvertMs = s->ConvertSeconds * 1000 / Stats.NumConverted;
+			TotalConvertSeconds += s->ConvertSeconds;
+
+			Ret.Total.NumReceived += Stats.NumReceived;
+			Ret.Total.NumConverted += Stats.NumConverted;
+			Ret.Total.NumDropped += Stats.NumDropped;
+			Ret.Total.NumSuperseded += Stats.NumSuperseded;
+			Ret.Total.NumFailed += Stats.NumFailed;
+			Ret.Total.Fps += Stats.Fps;
+			Ret.Total.CpuShare += Stats.CpuShare;
+			Ret.Cameras.push_back(Stats);
+		}
+		Ret.Total.Seconds = Seconds;
+		if (Ret.Total.NumConverted) Ret.Total.AvgConvertMs = TotalConvertSeconds * 1000 / Ret.Total.NumConverted;
+
+		for (size_t i = 0; i < Pool.GetNumWorkers(); i++)
+		{
+			Ret.WorkerExecuted.push_back(Pool.GetNumExecuted(i));
+			Ret.WorkerStolen.push_back(Pool.GetNumStolen(i));
+		}
+		return Ret;
+	}
+
+	void CameraGroupType::ResetStats()
+	{
+		auto lock = std::scoped_lock(Lock);
+		StatsStart = ClockType::now();
+		for (auto& s : Slots)
+		{
+			auto slot_lock = std::scoped_lock(s->Lock);
+			s->Stats = CameraStats();
+			s->ConvertSeconds = 0;
+		}
+	}
+
+	size_t CameraGroupType::GetNumWorkers() const
+	{
+		return Pool.GetNumWorkers();
+	}
+}
@@ -0,0 +1,202 @@
+#pragma once
+
+#include "webcam.hpp"
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <condition_variable>
+
+namespace WindowsWebCamTypeLib
+{
+	//-------------------------------------------------------------------
+	// WorkStealingPoolType
+	//
+	// A fixed pool of worker threads, each with its own task queue.
+	// A task is queued on the worker given by the hint, so the tasks of
+	// one camera stay on one core while the load is even; a worker whose
+	// queue is empty takes the oldest task of another worker before it
+	// goes to sleep. Tasks are a function pointer and a user pointer,
+	// queueing one doesn't allocate.
+	//-------------------------------------------------------------------
+
+	class WorkStealingPoolType
+	{
+	public:
+		using TaskFuncType = void (*)(void* Userdata);
+
+	protected:
+		struct TaskType
+		{
+			TaskFuncType Func;
+			void* Userdata;
+		};
+
+		struct WorkerQueueType
+		{
+			std::mutex Lock;
+			std::deque<TaskType> Tasks;
+			size_t NumExecuted = 0;
+			size_t NumStolen = 0;
+		};
+
+		std::vector<std::unique_ptr<WorkerQueueType>> Queues;
+		std::vector<std::thread> Workers;
+
+		// 只在没有任务可做时才用到这个锁
+		std::mutex SleepLock;
+		std::condition_variable TaskQueued;
+		std::condition_variable AllDone;
+		std::atomic<size_t> NumPending = 0;
+		std::atomic<size_t> NumUnfinished = 0;
+		std::atomic<size_t> NextQueue = 0;
+		bool Quit = false;
+
+		bool TryPop(size_t Self, TaskType& Task);
+		void WorkerProc(size_t Self);
+
+	public:
+		// `NumWorkers` 为 0 时按 CPU 的核心数
+		WorkStealingPoolType(size_t NumWorkers = 0);
+		WorkStealingPoolType(const WorkStealingPoolType&) = delete;
+		WorkStealingPoolType& operator = (const WorkStealingPoolType&) = delete;
+
+		// 执行完已经提交的任务再退出
+		~WorkStealingPoolType();
+
+		// `Hint` 按工作线程数取模；为 `SIZE_MAX` 时轮流放到各个工作线程的队列里
+		void Submit(TaskFuncType Func, void* Userdata, size_t Hint = SIZE_MAX);
+
+		// 等待已经提交的任务全部执行完，不能在工作线程上调用
+		void Wait();
+
+		size_t GetNumWorkers() const;
+		size_t GetNumExecuted(size_t Worker) const;
+		size_t GetNumStolen(size_t Worker) const;
+		bool IsWorkerThread() const;
+	};
+
+	// 每个摄像头的限额，0 表示不限。`MaxCpuShare` 是转换帧可以占用的 CPU 时间与经过的时间之比（1 为一个核心）
+	struct CameraBudget
+	{
+		float MaxFps = 0;
+		float MaxCpuShare = 0;
+	};
+
+	// `NumDropped` 是超出限额没有转换的帧，`NumSuperseded` 是转换之前就被更新的帧替换掉的帧
+	struct CameraStats
+	{
+		size_t NumReceived = 0;
+		size_t NumConverted = 0;
+		size_t NumDropped = 0;
+		size_t NumSuperseded = 0;
+		size_t NumFailed = 0;
+		double Seconds = 0;
+		double Fps = 0;
+		double CpuShare = 0;
+		double AvgConvertMs = 0;
+	};
+
+	// `Total` 的帧率和 CPU 占用是各个摄像头的和
+	struct CameraGroupStats
+	{
+		std::vector<CameraStats> Cameras;
+		CameraStats Total;
+		std::vector<size_t> WorkerExecuted;
+		std::vector<size_t> WorkerStolen;
+	};
+
+	class CameraGroupType;
+	using CameraGroupFrameCBType = void (*)(void* Userdata, CameraGroupType& Group, size_t CameraIndex, WebCamType& wc, bool FrameUpdated);
+
+	//-------------------------------------------------------------------
+	// CameraGroupType
+	//
+	// Owns a set of cameras and converts their frames on one shared
+	// `WorkStealingPoolType` instead of on each camera's capture
+	// thread. The capture thread only checks the camera's budget,
+	// queues a conversion and requests the next frame, so capturing and
+	// converting overlap. A camera over its FPS or CPU budget has its
+	// frames dropped before they cost anything; a camera whose
+	// conversions fall behind only ever has its newest frame converted.
+	//
+	// The frame callback is called on a worker thread.
+	//-------------------------------------------------------------------
+
+	class CameraGroupType
+	{
+	protected:
+		using ClockType = std::chrono::steady_clock;
+
+		struct CameraSlotType
+		{
+			CameraGroupType* Group = nullptr;
+			size_t Index = 0;
+			std::unique_ptr<WebCamType> Camera;
+
+			// 已经有转换任务在排队时，新的帧由这个任务一起转换
+			std::atomic<bool> TaskQueued = false;
+
+			std::mutex Lock;
+			CameraBudget Budget;
+			ClockType::time_point NextDue;
+			ClockType::time_point CreditTime;
+			double CpuCredit = 0;
+			CameraStats Stats;
+			double ConvertSeconds = 0;
+		};
+
+		mutable std::mutex Lock;
+
+		// 在 `Slots` 之前声明，所以在所有摄像头析构之后才析构，析构时已经没有摄像头会提交任务
+		WorkStealingPoolType Pool;
+
+		std::vector<std::unique_ptr<CameraSlotType>> Slots;
+		std::atomic<bool> Running = false;
+		ClockType::time_point StatsStart = ClockType::now();
+		bool Verbose;
+
+		static void OnCameraFrame(void* Userdata, WebCamType& wc, bool FrameUpdated);
+		static void OnCameraDispatch(void* Userdata, WebCamType& wc);
+		static void ConvertTask(void* Userdata);
+		static bool AcceptFrame(CameraSlotType& Slot);
+		std::unique_ptr<CameraSlotType> NewSlot(const CameraBudget& Budget);
+		size_t AddSlot(std::unique_ptr<CameraSlotType> Slot);
+		CameraSlotType& GetSlot(size_t Index) const;
+		std::vector<CameraSlotType*> SetRunning(bool Running);
+
+	public:
+		CameraGroupType(CameraGroupFrameCBType OnFrameCB, void* Userdata, size_t NumWorkers = 0, bool Verbose = false);
+		CameraGroupType(const CameraGroupType&) = delete;
+		CameraGroupType& operator = (const CameraGroupType&) = delete;
+		~CameraGroupType();
+
+		// 返回摄像头在组里的序号
+		size_t AddCamera(size_t DeviceIndex, const CameraBudget& Budget = CameraBudget());
+		size_t AddCamera(const std::string& DevPath, const CameraBudget& Budget = CameraBudget());
+
+		size_t GetNumCameras() const;
+		WebCamType& GetCamera(size_t Index);
+		void SetBudget(size_t Index, const CameraBudget& Budget);
+		CameraBudget GetBudget(size_t Index) const;
+
+		// 开始或停止所有摄像头的采集；`Stop()` 返回时已经没有正在进行的转换
+		void Start();
+		void Stop();
+		bool IsRunning() const;
+
+		CameraGroupStats GetStats() const;
+		void ResetStats();
+		size_t GetNumWorkers() const;
+
+		void* Userdata = nullptr;
+		CameraGroupFrameCBType OnFrameCB = nullptr;
+	};
+}
@@ -0,0 +1,39 @@
+#include "devreg.hpp"
+
+namespace WindowsWebCamTypeLib
+{
+	DeviceRegistryType::DeviceRegistryType(std::unique_ptr<DeviceEnumeratorType> Enumerator) :
+		Enumerator(std::move(Enumerator))
+	{
+	}
+
+	std::shared_ptr<const DeviceListType> DeviceRegistryType::GetDevices()
+	{
+		auto lock = std::scoped_lock(Lock);
+
+		// 枚举期间又有设备变化时，下一次调用会重新枚举
+		uint64_t Current = Generation.load();
+		if (Devices && CachedGeneration == Current) return Devices;
+
+		Devices = std::make_shared<const DeviceListType>(Enumerator->Enumerate());
+		CachedGeneration = Current;
+		NumEnumerations++;
+		return Devices;
+	}
+
+	void DeviceRegistryType::Invalidate()
+	{
+		Generation++;
+	}
+
+	uint64_t DeviceRegistryType::GetGeneration() const
+	{
+		return Generation.load();
+	}
+
+	size_t DeviceRegistryType::GetNumEnumerations()
+	{
+		auto lock = std::scoped_lock(Lock);
+		return NumEnumerations;
+	}
+}
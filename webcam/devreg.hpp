@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+
+namespace WindowsWebCamTypeLib
+{
+	// 一个视频采集设备。`Handle` 是平台相关的设备对象（Windows 上是 `IMFActivate`），最后一个引用释放时一起释放
+	struct DeviceEntry
+	{
+		std::shared_ptr<void> Handle;
+		std::wstring SymbolicLinkW;
+		std::string SymbolicLink;
+		std::wstring FriendlyNameW;
+		std::string FriendlyName;
+	};
+
+	using DeviceListType = std::vector<DeviceEntry>;
+
+	// 实际枚举设备的接口，由平台相关的代码实现
+	class DeviceEnumeratorType
+	{
+	public:
+		virtual ~DeviceEnumeratorType() = default;
+		virtual DeviceListType Enumerate() = 0;
+	};
+
+	//-------------------------------------------------------------------
+	// DeviceRegistryType
+	//
+	// Caches the device list of an enumerator. The list is only
+	// enumerated again after `Invalidate()`, which the platform code
+	// calls when a device arrives or is removed. `GetDevices()` hands
+	// out a shared snapshot, so a caller can keep using it while
+	// another thread invalidates and re-enumerates.
+	//
+	// Nothing here depends on the platform.
+	//-------------------------------------------------------------------
+
+	class DeviceRegistryType
+	{
+	protected:
+		std::mutex Lock;
+		std::unique_ptr<DeviceEnumeratorType> Enumerator;
+		std::shared_ptr<const DeviceListType> Devices;
+
+		// `Invalidate()` 只增加计数，不需要等正在进行的枚举结束
+		std::atomic<uint64_t> Generation = 1;
+		uint64_t CachedGeneration = 0;
+		size_t NumEnumerations = 0;
+
+	public:
+		DeviceRegistryType(std::unique_ptr<DeviceEnumeratorType> Enumerator);
+
+		std::shared_ptr<const DeviceListType> GetDevices();
+		void Invalidate();
+
+		uint64_t GetGeneration() const;
+		size_t GetNumEnumerations();
+	};
+}
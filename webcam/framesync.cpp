@@ -0,0 +1,205 @@
+#include "framesync.hpp"
+
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
+
+namespace WindowsWebCamTypeLib
+{
+	FrameSynchronizerType::SlotType& FrameSynchronizerType::StreamType::At(size_t i)
+	{
+		return Ring[(Head + i) % Ring.size()];
+	}
+
+	void FrameSynchronizerType::StreamType::PopFront()
+	{
+		auto& Slot = Ring[Head];
+		if (FreeImages.size() < 2) FreeImages.push_back(std::move(Slot.Image));
+		Slot.Image.reset();
+		Head = (Head + 1) % Ring.size();
+		Count--;
+	}
+
+	FrameSynchronizerType::FrameSynchronizerType(size_t NumStreams, int64_t Tolerance, FrameSetCBType OnFrameSet, void* Userdata, size_t RingSize) :
+		Streams(NumStreams),
+		RingSize(RingSize),
+		Tolerance(Tolerance),
+		Chosen(NumStreams),
+		Userdata(Userdata),
+		OnFrameSet(OnFrameSet)
+	{
+		if (!NumStreams) throw std::invalid_argument("`FrameSynchronizerType` needs at least one stream.");
+		if (!RingSize) throw std::invalid_argument("The ring size of `FrameSynchronizerType` must not be zero.");
+		if (Tolerance < 0) throw std::invalid_argument("The tolerance must not be negative.");
+		for (auto& s : Streams) s.Ring.resize(RingSize);
+		FrameSet.Frames.resize(NumStreams);
+	}
+
+	std::unique_ptr<Image_RGBA8> FrameSynchronizerType::AcquireImage(StreamType& Stream, uint32_t Width, uint32_t Height)
+	{
+		while (Stream.FreeImages.size())
+		{
+			auto Image = std::move(Stream.FreeImages.back());
+			Stream.FreeImages.pop_back();
+			if (Image->GetWidth() == Width && Image->GetHeight() == Height) return Image;
+		}
+		return nullptr;
+	}
+
+	void FrameSynchronizerType::Push(size_t Stream, int64_t Timestamp, const Image_RGBA8& Frame)
+	{
+		if (Stream >= Streams.size()) throw std::out_of_range("Stream `" + std::to_string(Stream) + "` is out of bound.");
+		auto& s = Streams[Stream];
+
+		std::unique_ptr<Image_RGBA8> Image;
+		{
+			auto lock = std::scoped_lock(Lock);
+			s.Stats.NumPushed++;
+
+			// 每一路的时间戳必须递增，否则配对时的假设不成立
+			if (s.HasLast && Timestamp <= s.LastTimestamp)
+			{
+				s.Stats.NumLate++;
+				return;
+			}
+			s.HasLast = true;
+			s.LastTimestamp = Timestamp;
+			Image = AcquireImage(s, Frame.GetWidth(), Frame.GetHeight());
+		}
+
+		// 复制帧的时候不持有锁，别的摄像头可以同时送帧
+		if (!Image) Image = std::make_unique<Image_RGBA8>(Frame.GetWidth(), Frame.GetHeight(), Pixel_RGBA8(0, 0, 0, 255));
+		memcpy(Image->GetBitmapDataPtr(), Frame.GetBitmapDataPtr(), Frame.GetBitmapSizeInTotal());
+
+		auto lock = std::scoped_lock(Lock);
+		if (s.Count == RingSize)
+		{
+			s.PopFront();
+			s.Stats.NumOverflowed++;
+		}
+		auto& Slot = s.At(s.Count);
+		Slot.Image = std::move(Image);
+		Slot.Timestamp = Timestamp;
+		s.Count++;
+
+		Match();
+	}
+
+	void FrameSynchronizerType::Push(size_t Stream, const WebCamType& wc)
+	{
+		Push(Stream, wc.GetFrameTimestamp().SystemTime, wc.GetFrameBuffer());
+	}
+
+	void FrameSynchronizerType::Match()
+	{
+		for (;;)
+		{
+			// 基准是各路最早的帧里最晚的一个，每一组都必须包含基准那一路不早于它的帧
+			int64_t Reference = 0;
+			for (size_t i = 0; i < Streams.size(); i++)
+			{
+				auto& s = Streams[i];
+				if (!s.Count) return;
+				if (!i || s.At(0).Timestamp > Reference) Reference = s.At(0).Timestamp;
+			}
+
+			// 比基准早太多的帧不可能再配成组；丢弃之后新的最早的帧可能比基准晚，需要重新确定基准
+			bool Dropped = false;
+			for (auto& s : Streams)
+			{
+				while (s.Count && s.At(0).Timestamp < Reference - Tolerance)
+				{
+					s.PopFront();
+					s.Stats.NumDropped++;
+					Dropped = true;
+				}
+			}
+			if (Dropped) continue;
+
+			// 每一路取最接近基准的帧；还没有收到不早于基准的帧时，之后的帧可能更接近，先等待
+			int64_t Earliest = Reference, Latest = Reference;
+			for (size_t i = 0; i < Streams.size(); i++)
+			{
+				auto& s = Streams[i];
+				size_t Best = 0;
+				int64_t BestDiff = Reference - s.At(0).Timestamp;
+				size_t j = 1;
+				for (; j < s.Count && s.At(j).Timestamp <= Reference + Tolerance; j++)
+				{
+					int64_t Diff = s.At(j).Timestamp > Reference ? s.At(j).Timestamp - Reference : Reference - s.At(j).Timestamp;
+					if (Diff < BestDiff)
+					{
+						Best = j;
+						BestDiff = Diff;
+					}
+				}
+				if (BestDiff && s.At(s.Count - 1).Timestamp < Reference) return;
+
+				Chosen[i] = Best;
+				auto& Slot = s.At(Best);
+				FrameSet.Frames[i].Image = Slot.Image.get();
+				FrameSet.Frames[i].Timestamp = Slot.Timestamp;
+				Earliest = std::min(Earliest, Slot.Timestamp);
+				Latest = std::max(Latest, Slot.Timestamp);
+			}
+
+			FrameSet.Timestamp = Reference;
+			FrameSet.Spread = Latest - Earliest;
+			NumFrameSets++;
+
+			// 回调期间一直持有锁，组里的图像还在环形缓冲区里，解锁之后别的路的 `Push()` 可能把它们挤出去
+			if (OnFrameSet) OnFrameSet(Userdata, FrameSet);
+
+			// 选中的帧和它之前的帧都不会再用到
+			for (size_t i = 0; i < Streams.size(); i++)
+			{
+				auto& s = Streams[i];
+				s.Stats.NumDropped += Chosen[i];
+				s.Stats.NumMatched++;
+				for (size_t j = 0; j <= Chosen[i]; j++) s.PopFront();
+			}
+		}
+	}
+
+	void FrameSynchronizerType::Reset()
+	{
+		auto lock = std::scoped_lock(Lock);
+		for (auto& s : Streams)
+		{
+			while (s.Count) s.PopFront();
+			s.HasLast = false;
+		}
+	}
+
+	void FrameSynchronizerType::SetTolerance(int64_t Tolerance)
+	{
+		if (Tolerance < 0) throw std::invalid_argument("The tolerance must not be negative.");
+		auto lock = std::scoped_lock(Lock);
+		this->Tolerance = Tolerance;
+		Match();
+	}
+
+	int64_t FrameSynchronizerType::GetTolerance() const
+	{
+		auto lock = std::scoped_lock(Lock);
+		return Tolerance;
+	}
+
+	size_t FrameSynchronizerType::GetNumStreams() const
+	{
+		return Streams.size();
+	}
+
+	size_t FrameSynchronizerType::GetNumFrameSets() const
+	{
+		auto lock = std::scoped_lock(Lock);
+		return NumFrameSets;
+	}
+
+	StreamSyncStats FrameSynchronizerType::GetStats(size_t Stream) const
+	{
+		if (Stream >= Streams.size()) throw std::out_of_range("Stream `" + std::to_string(Stream) + "` is out of bound.");
+		auto lock = std::scoped_lock(Lock);
+		return Streams[Stream].Stats;
+	}
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "webcam.hpp"
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <memory>
+#include <mutex>
+
+namespace WindowsWebCamTypeLib
+{
+	// 同步好的一组帧，`Frames` 按路的序号排列，只在回调里有效
+	struct SyncedFrame
+	{
+		const Image_RGBA8* Image = nullptr;
+		int64_t Timestamp = 0;
+	};
+
+	struct FrameSetType
+	{
+		// 基准时间，以及这一组里最早与最晚的帧的时间差
+		int64_t Timestamp = 0;
+		int64_t Spread = 0;
+		std::vector<SyncedFrame> Frames;
+	};
+
+	using FrameSetCBType = void (*)(void* Userdata, const FrameSetType& FrameSet);
+
+	// `NumDropped` 是没能配成组的帧，`NumOverflowed` 是等待配对时因为环形缓冲区满了而丢弃的帧，`NumLate` 是时间戳倒退而丢弃的帧
+	struct StreamSyncStats
+	{
+		size_t NumPushed = 0;
+		size_t NumMatched = 0;
+		size_t NumDropped = 0;
+		size_t NumOverflowed = 0;
+		size_t NumLate = 0;
+	};
+
+	//-------------------------------------------------------------------
+	// FrameSynchronizerType
+	//
+	// Groups frames from several cameras into framesets captured at the
+	// same moment. Each stream buffers its newest frames in a small ring
+	// of pooled images. The reference time is the latest of the oldest
+	// frames of all streams: older frames can't be part of any set and
+	// are dropped, and once every stream has a frame at or after the
+	// reference, the frame closest to it in each stream forms a set if
+	// it's within the tolerance. Every frame is looked at a bounded
+	// number of times, so matching is amortized O(1) per frame, and the
+	// memory is `RingSize + 1` images per stream.
+	//
+	// Timestamps only need to be monotonic per stream and on a shared
+	// clock, e.g. `FrameTimestamp::SystemTime`.
+	//-------------------------------------------------------------------
+
+	class FrameSynchronizerType
+	{
+	protected:
+		struct SlotType
+		{
+			std::unique_ptr<Image_RGBA8> Image;
+			int64_t Timestamp = 0;
+		};
+
+		struct StreamType
+		{
+			std::vector<SlotType> Ring;
+			size_t Head = 0;
+			size_t Count = 0;
+			bool HasLast = false;
+			int64_t LastTimestamp = 0;
+
+			// 出队的图像留给下一帧用
+			std::vector<std::unique_ptr<Image_RGBA8>> FreeImages;
+			StreamSyncStats Stats;
+
+			SlotType& At(size_t i);
+			void PopFront();
+		};
+
+		mutable std::mutex Lock;
+		std::vector<StreamType> Streams;
+		size_t RingSize;
+		int64_t Tolerance;
+		FrameSetType FrameSet;
+		std::vector<size_t> Chosen;
+		size_t NumFrameSets = 0;
+
+		std::unique_ptr<Image_RGBA8> AcquireImage(StreamType& Stream, uint32_t Width, uint32_t Height);
+		void Match();
+
+	public:
+		// `Tolerance` 与时间戳的单位相同
+		FrameSynchronizerType(size_t NumStreams, int64_t Tolerance, FrameSetCBType OnFrameSet, void* Userdata, size_t RingSize = 4);
+		FrameSynchronizerType(const FrameSynchronizerType&) = delete;
+		FrameSynchronizerType& operator = (const FrameSynchronizerType&) = delete;
+
+		// 复制一帧到第 `Stream` 路，凑齐一组时在调用的线程上调用 `OnFrameSet`
+		// `OnFrameSet` 调用时持有内部的锁：各个线程上的回调依次执行，组里的图像在回调期间不会被覆盖，
+		// 但回调里不能再调用这个对象的成员函数（会死锁），耗时的处理应当先复制需要的帧，否则会挡住其他路的 `Push()`
+		void Push(size_t Stream, int64_t Timestamp, const Image_RGBA8& Frame);
+
+		// 取摄像头帧缓冲区里的帧，按 `SystemTime` 对齐；在 `OnFrameCB` 里调用
+		void Push(size_t Stream, const WebCamType& wc);
+
+		// 丢弃所有等待配对的帧
+		void Reset();
+
+		// 放宽容差可能立即凑齐一组，同样在持有锁时调用 `OnFrameSet`
+		void SetTolerance(int64_t Tolerance);
+		int64_t GetTolerance() const;
+		size_t GetNumStreams() const;
+		size_t GetNumFrameSets() const;
+		StreamSyncStats GetStats(size_t Stream) const;
+
+		void* Userdata = nullptr;
+		FrameSetCBType OnFrameSet = nullptr;
+	};
+}
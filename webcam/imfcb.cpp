@@ -1,9 +1,10 @@
 ﻿#include "imfcb.hpp"
 
 #include <mutex>
-
-#include <locale>
-#include <codecvt>
+#include <vector>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
 
 namespace WindowsWebCamTypeLib
 {
@@ -401,6 +402,7 @@ namespace WindowsWebCamTypeLib
 		Userdata(Userdata),
 		Verbose(Verbose)
 	{
+		memcpy(FormatCosts, RawFrameConversionCosts, sizeof FormatCosts);
 		if (!CoInitCalled)
 		{
 			CoInitCalled = SUCCEEDED(CoInitialize(nullptr));
@@ -410,7 +412,7 @@ namespace WindowsWebCamTypeLib
 	WebCamTypeInternal::~WebCamTypeInternal()
 	{
 		// 最后释放前再进一次锁，利用 RAII 减少直接退出前报错率。
-		auto lock = std::scoped_lock(*Lock);
+		auto lock = std::scoped_lock(ConvertLock, *Lock);
 	}
 
 	size_t GUID_Hash::operator () (const GUID& g) const
@@ -424,13 +426,10 @@ namespace WindowsWebCamTypeLib
 			hasher(size_t(data[3]) << 8);
 	}
 
-	const std::unordered_map<GUID, ConverterFuncType, GUID_Hash> VideoFormatConverters =
-	{
-		{ MFVideoFormat_RGB32, TransformImage_RGB32 },
-		{ MFVideoFormat_RGB24, TransformImage_RGB24 },
-		{ MFVideoFormat_YUY2,  TransformImage_YUY2  },
-		{ MFVideoFormat_NV12,  TransformImage_NV12  },
-	};
+	// UVC 灰度摄像头使用的 FourCC，Media Foundation 没有为它们定义 GUID
+	static const GUID VideoFormat_Y800 = { FCC('Y800'), 0x0000, 0x0010, { 0x80, 0x00, 0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71 } };
+	static const GUID VideoFormat_GREY = { FCC('GREY'), 0x0000, 0x0010, { 0x80, 0x00, 0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71 } };
+	static const GUID VideoFormat_Y16 = { FCC('Y16 '), 0x0000, 0x0010, { 0x80, 0x00, 0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71 } };
 
 	const std::unordered_map <GUID, RawFrameType, GUID_Hash> VideoFormatEnumMap =
 	{
@@ -438,6 +437,19 @@ namespace WindowsWebCamTypeLib
 		{ MFVideoFormat_RGB24, RawFrameType::RGB24 },
 		{ MFVideoFormat_YUY2,  RawFrameType::YUY2  },
 		{ MFVideoFormat_NV12,  RawFrameType::NV12  },
+		{ MFVideoFormat_UYVY,  RawFrameType::UYVY  },
+		{ MFVideoFormat_YVYU,  RawFrameType::YVYU  },
+		{ MFVideoFormat_NV21,  RawFrameType::NV21  },
+		{ MFVideoFormat_I420,  RawFrameType::I420  },
+		{ MFVideoFormat_IYUV,  RawFrameType::I420  },
+		{ MFVideoFormat_YV12,  RawFrameType::YV12  },
+		{ VideoFormat_Y800,    RawFrameType::Y8    },
+		{ VideoFormat_GREY,    RawFrameType::Y8    },
+		{ MFVideoFormat_L8,    RawFrameType::Y8    },
+		{ MFVideoFormat_P010,  RawFrameType::P010  },
+		{ VideoFormat_Y16,     RawFrameType::Y16   },
+		{ MFVideoFormat_L16,   RawFrameType::Y16   },
+		{ MFVideoFormat_MJPG,  RawFrameType::MJPG  },
 	};
 
 	const std::unordered_map<RawFrameType, GUID> VideoFormatToGUIDMap =
@@ -446,6 +458,15 @@ namespace WindowsWebCamTypeLib
 		{ RawFrameType::RGB24, MFVideoFormat_RGB24 },
 		{ RawFrameType::YUY2,  MFVideoFormat_YUY2  },
 		{ RawFrameType::NV12,  MFVideoFormat_NV12  },
+		{ RawFrameType::UYVY,  MFVideoFormat_UYVY  },
+		{ RawFrameType::YVYU,  MFVideoFormat_YVYU  },
+		{ RawFrameType::NV21,  MFVideoFormat_NV21  },
+		{ RawFrameType::I420,  MFVideoFormat_I420  },
+		{ RawFrameType::YV12,  MFVideoFormat_YV12  },
+		{ RawFrameType::Y8,    VideoFormat_Y800    },
+		{ RawFrameType::P010,  MFVideoFormat_P010  },
+		{ RawFrameType::Y16,   VideoFormat_Y16     },
+		{ RawFrameType::MJPG,  MFVideoFormat_MJPG  },
 	};
 
 	std::string GUID2Str(const GUID& g, const std::string& delims)
@@ -472,9 +493,29 @@ namespace WindowsWebCamTypeLib
 		return ret;
 	}
 
+	static std::string WideToUtf8(const std::wstring& Str)
+	{
+		if (Str.empty()) return std::string();
+		int Length = WideCharToMultiByte(CP_UTF8, 0, Str.data(), int(Str.size()), nullptr, 0, nullptr, nullptr);
+		std::string Ret(size_t(Length), '\0');
+		WideCharToMultiByte(CP_UTF8, 0, Str.data(), int(Str.size()), Ret.data(), Length, nullptr, nullptr);
+		return Ret;
+	}
+
 	std::string GetDevicePath(IMFActivate* Device)
 	{
-		return std::wstring_convert<std::codecvt_utf8<wchar_t>>().to_bytes(GetDevicePathW(Device));
+		return WideToUtf8(GetDevicePathW(Device));
+	}
+
+	static std::wstring GetDeviceFriendlyNameW(IMFActivate* Device)
+	{
+		WCHAR* buf = nullptr;
+		uint32_t StrSize = 0;
+		HRESULT hr = Device->GetAllocatedString(MF_DEVSOURCE_ATTRIBUTE_FRIENDLY_NAME, &buf, &StrSize);
+		if (FAILED(hr) || !buf) return std::wstring();
+		auto ret = std::wstring(buf, StrSize);
+		CoTaskMemFree(buf);
+		return ret;
 	}
 
 	EnumeratedDevices::EnumeratedDevices()
@@ -504,6 +545,132 @@ namespace WindowsWebCamTypeLib
 		::CoTaskMemFree(Devices);
 	}
 
+	DeviceListType MFDeviceEnumeratorType::Enumerate()
+	{
+		auto enumerated = EnumeratedDevices();
+		auto ret = DeviceListType();
+		ret.reserve(enumerated.Count);
+
+		for (size_t i = 0; i < enumerated.Count; i++)
+		{
+			IMFActivate* Device = enumerated.Devices[i];
+			DeviceEntry Entry;
+			Entry.SymbolicLinkW = GetDevicePathW(Device);
+			Entry.SymbolicLink = WideToUtf8(Entry.SymbolicLinkW);
+			Entry.FriendlyNameW = GetDeviceFriendlyNameW(Device);
+			Entry.FriendlyName = WideToUtf8(Entry.FriendlyNameW);
+
+			// 缓存持有自己的引用，`EnumeratedDevices` 析构时释放的是枚举时的引用
+			Device->AddRef();
+			Entry.Handle = std::shared_ptr<void>(Device, [](void* p) { reinterpret_cast<IMFActivate*>(p)->Release(); });
+			ret.push_back(std::move(Entry));
+		}
+
+		return ret;
+	}
+
+	// 摄像头会注册在这两个设备接口类中的一个或两个里
+	static const GUID KSCATEGORY_CAPTURE_GUID = { 0x65E8773D, 0x8F56, 0x11D0, { 0xA3, 0xB9, 0x00, 0xA0, 0xC9, 0x22, 0x31, 0x96 } };
+	static const GUID KSCATEGORY_VIDEO_CAMERA_GUID = { 0xE5323777, 0xF976, 0x4F5B, { 0x9B, 0x55, 0xB9, 0x46, 0x99, 0xC4, 0x6E, 0x44 } };
+
+	DeviceChangeNotifierType::DeviceChangeNotifierType(DeviceRegistryType& Registry) :
+		Registry(Registry)
+	{
+		std::promise<HWND> Ready;
+		auto Result = Ready.get_future();
+		Thread = std::thread(&DeviceChangeNotifierType::ThreadProc, this, std::ref(Ready));
+		Window = Result.get();
+		if (!Window) Thread.join();
+	}
+
+	DeviceChangeNotifierType::~DeviceChangeNotifierType()
+	{
+		if (!Window) return;
+		PostMessageW(Window, WM_CLOSE, 0, 0);
+		Thread.join();
+	}
+
+	bool DeviceChangeNotifierType::IsRunning() const
+	{
+		return Window != nullptr;
+	}
+
+	LRESULT CALLBACK DeviceChangeNotifierType::WndProc(HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam)
+	{
+		auto Notifier = reinterpret_cast<DeviceChangeNotifierType*>(GetWindowLongPtrW(hWnd, GWLP_USERDATA));
+		switch (Msg)
+		{
+		case WM_DEVICECHANGE:
+			if (Notifier && (wParam == DBT_DEVICEARRIVAL || wParam == DBT_DEVICEREMOVECOMPLETE))
+			{
+				Notifier->Registry.Invalidate();
+			}
+			return TRUE;
+		case WM_CLOSE:
+			DestroyWindow(hWnd);
+			return 0;
+		case WM_DESTROY:
+			PostQuitMessage(0);
+			return 0;
+		}
+		return DefWindowProcW(hWnd, Msg, wParam, lParam);
+	}
+
+	void DeviceChangeNotifierType::ThreadProc(std::promise<HWND>& Ready)
+	{
+		static constexpr const wchar_t* ClassName = L"WindowsWebCamDeviceNotifier";
+
+		WNDCLASSEXW wc = { sizeof wc };
+		wc.lpfnWndProc = WndProc;
+		wc.hInstance = GetModuleHandleW(nullptr);
+		wc.lpszClassName = ClassName;
+		RegisterClassExW(&wc);
+
+		// 只收消息的窗口，不会显示出来
+		HWND hWnd = CreateWindowExW(0, ClassName, L"", 0, 0, 0, 0, 0, HWND_MESSAGE, nullptr, wc.hInstance, nullptr);
+		if (!hWnd)
+		{
+			Ready.set_value(nullptr);
+			return;
+		}
+		SetWindowLongPtrW(hWnd, GWLP_USERDATA, LONG_PTR(this));
+
+		HDEVNOTIFY Notifications[2] = { nullptr, nullptr };
+		const GUID* Categories[2] = { &KSCATEGORY_CAPTURE_GUID, &KSCATEGORY_VIDEO_CAMERA_GUID };
+		for (size_t i = 0; i < 2; i++)
+		{
+			DEV_BROADCAST_DEVICEINTERFACE_W Filter = { sizeof Filter };
+			Filter.dbcc_devicetype = DBT_DEVTYP_DEVICEINTERFACE;
+			Filter.dbcc_classguid = *Categories[i];
+			Notifications[i] = RegisterDeviceNotificationW(hWnd, &Filter, DEVICE_NOTIFY_WINDOW_HANDLE);
+		}
+		if (!Notifications[0] && !Notifications[1])
+		{
+			DestroyWindow(hWnd);
+			Ready.set_value(nullptr);
+			return;
+		}
+		Ready.set_value(hWnd);
+
+		MSG Msg;
+		while (GetMessageW(&Msg, nullptr, 0, 0) > 0)
+		{
+			TranslateMessage(&Msg);
+			DispatchMessageW(&Msg);
+		}
+
+		for (auto n : Notifications) if (n) UnregisterDeviceNotification(n);
+	}
+
+	std::shared_ptr<const DeviceListType> GetCachedDevices()
+	{
+		static DeviceRegistryType Registry(std::make_unique<MFDeviceEnumeratorType>());
+		static DeviceChangeNotifierType Notifier(Registry);
+
+		if (!Notifier.IsRunning()) Registry.Invalidate();
+		return Registry.GetDevices();
+	}
+
 	STDMETHODIMP WebCamTypeInternal::QueryInterface(const IID& riid, void** v)
 	{
 		static const QITAB qit[] =
@@ -572,24 +739,209 @@ namespace WindowsWebCamTypeLib
 			return hr;
 		}
 
+		// 驱动给出了采集时的 QPC 时间就用它，否则用收到帧的时间；不同的摄像头之间只能比较 `SystemTime`
+		FrameTimestamp Timestamp;
+		Timestamp.SampleTime = llTimestamp;
+		UINT64 DeviceTime = 0;
+		if (SUCCEEDED(Sample->GetUINT64(MFSampleExtension_DeviceTimestamp, &DeviceTime)))
+		{
+			Timestamp.SystemTime = int64_t(DeviceTime);
+			Timestamp.FromDevice = true;
+		}
+		else
+		{
+			Timestamp.SystemTime = MFGetSystemTime();
+		}
+
 		BYTE* LockPtr = nullptr;
 		DWORD MaxLength = 0;
 		DWORD CurLength = 0;
 		hr = Buffer->Lock(&LockPtr, &MaxLength, &CurLength);
 		if (FAILED(hr)) throw FetchFrameFailed(FH(hr) + "Buffer->Lock()");
 
-		FormatConverter(*FrameBuffer, LockPtr, SrcPitch, SrcWidth, SrcHeight);
+		// 录制的帧原样写入文件，不需要解码
+		if (Recorder)
+		{
+			try
+			{
+				Recorder->WriteFrame(LockPtr, CurLength, llTimestamp);
+			}
+			catch (const WriteVideoFailed& e)
+			{
+				if (Verbose)
+				{
+					std::cerr << std::string("[WARN] Recording stopped: ") + e.what() + "\n";
+				}
+				Recorder.reset();
+			}
+		}
+		if (RawRecorder)
+		{
+			try
+			{
+				bool Compressed = CurRawFrameType == RawFrameType::MJPG;
+				RawRecorder->WriteFrame(LockPtr, CurLength, Compressed ? 0 : SrcPitch, SrcWidth, SrcHeight, CurRawFrameType, llTimestamp);
+			}
+			catch (const RawRecordFailed& e)
+			{
+				if (Verbose)
+				{
+					std::cerr << std::string("[WARN] Raw recording stopped: ") + e.what() + "\n";
+				}
+				RawRecorder.reset();
+			}
+		}
+
+		// 没有预览时跳过解码和转换，帧缓冲区保持不变
+		if (!PreviewEnabled)
+		{
+			Buffer->Unlock();
+			Buffer.reset();
+			FrameUpdated = false;
+			if (OnFrameCB) OnFrameCB(Userdata, *this, false);
+			return S_OK;
+		}
+
+		// 交给调度者安排转换，这里只留住这一帧
+		if (DispatchCB)
+		{
+			Buffer->Unlock();
+			Buffer.reset();
+			Sample->AddRef();
+			PendingSample = Sample;
+			PendingTimestamp = Timestamp;
+			DispatchCB(DispatchUserdata, *this);
+			return S_OK;
+		}
+
+		ConvertSample(Buffer, LockPtr, CurLength, Timestamp);
+		return S_OK;
+	}
+
+	void WebCamTypeInternal::ConvertSample(IMFMediaBuffer* Buffer, BYTE* LockPtr, DWORD CurLength, const FrameTimestamp& Timestamp)
+	{
+		HRESULT hr = S_OK;
+
+		// 步长为负数时图像是倒置存储的，缓冲区开头是最后一行
+		const BYTE* pScanline0 = SrcPitch < 0 ? LockPtr + ptrdiff_t(-SrcPitch) * (SrcHeight - 1) : LockPtr;
+		int32_t FramePitch = SrcPitch;
+		uint32_t FrameWidth = SrcWidth;
+		uint32_t FrameHeight = SrcHeight;
+		bool Decoded = false;
+
+		if (CurRawFrameType == RawFrameType::MJPG)
+		{
+			// MJPG 帧先解码，之后的转换与 RGB32 相同
+			FrameWidth = JpegFrameWidth;
+			FrameHeight = JpegFrameHeight;
+			try
+			{
+				Decoded = DecodeJpegSample(LockPtr, CurLength, pScanline0, FramePitch);
+			}
+			catch (const DecodeJpegFailed& e)
+			{
+				if (Verbose)
+				{
+					std::cerr << std::string("[WARN] Dropped an MJPG frame: ") + e.what() + "\n";
+				}
+				Buffer->Unlock();
+				FrameUpdated = false;
+				if (OnFrameCB) OnFrameCB(Userdata, *this, false);
+				return;
+			}
+		}
+		else if (ToneMapNeeded)
+		{
+			// 高位深的帧先映射到 8 位，之后的转换与 NV12 或 Y8 相同
+			ToneMapSample(pScanline0, FramePitch);
+		}
+
+		// 旋转 90 度或 270 度时帧缓冲区的宽高与源图像相反
+		bool Transposed = IsOrientationTransposed(Orientation);
+		uint32_t OrientedWidth = Transposed ? SrcRegion.Height : SrcRegion.Width;
+		uint32_t OrientedHeight = Transposed ? SrcRegion.Width : SrcRegion.Height;
+		if (Decoded)
+		{
+			// 已经直接解码到帧缓冲区或输出缓冲区
+		}
+		else if (OutputFormat != OutputFormatType::RGBA8)
+		{
+			// 直接转换到指定的输出格式，不经过 RGBA 帧缓冲区
+			OutputConverter(OutputBuffer.Data.data(), OutputBuffer.Pitch, pScanline0, FramePitch, FrameHeight, SrcRegion.X, SrcRegion.Y, SrcRegion.Width, SrcRegion.Height, Orientation == OrientationType::FlipV);
+		}
+		else if (FrameBuffer->GetWidth() != OrientedWidth || FrameBuffer->GetHeight() != OrientedHeight)
+		{
+			ScaledFormatConverter(*FrameBuffer, pScanline0, FramePitch, FrameWidth, FrameHeight, SrcRegion, Orientation, ScaleFilter);
+		}
+		else if (SrcRegion.Width != FrameWidth || SrcRegion.Height != FrameHeight)
+		{
+			RegionFormatConverter(*FrameBuffer, pScanline0, FramePitch, FrameWidth, FrameHeight, SrcRegion, Orientation);
+		}
+		else
+		{
+			FormatConverter(*FrameBuffer, pScanline0, FramePitch, FrameWidth, FrameHeight, Orientation);
+		}
 
 		hr = Buffer->Unlock();
 		if (FAILED(hr)) throw FetchFrameFailed(FH(hr) + "Buffer->Unlock()");
 
-		// 获取到的缓冲区需要释放
-		Buffer.reset();
-
+		CurTimestamp = Timestamp;
 		FrameUpdated = true;
 		if (OnFrameCB) OnFrameCB(Userdata, *this, true);
-		
-		return S_OK;
+	}
+
+	void WebCamTypeInternal::SetFrameDispatcher(FrameDispatchCBInternalType DispatchCB, void* Userdata)
+	{
+		auto lock = std::scoped_lock(ConvertLock, *Lock);
+		this->DispatchCB = DispatchCB;
+		DispatchUserdata = Userdata;
+		PendingSample.reset();
+	}
+
+	bool WebCamTypeInternal::ProcessPendingSample()
+	{
+		COMPtr<IMFMediaBuffer> Buffer = nullptr;
+		COMPtr<IMFSample> Sample = nullptr;
+		FrameTimestamp Timestamp;
+		HRESULT hr = S_OK;
+
+		// 只在取走帧的时候持有 `Lock`，转换时采集线程可以继续接收下一帧；改变格式的调用要等转换结束
+		auto convert_lock = std::scoped_lock(ConvertLock);
+		{
+			auto lock = std::scoped_lock(*Lock);
+
+			// 已经被别的线程转换，或者格式变了被丢弃
+			if (!PendingSample) return false;
+			IMFSample* pSample = PendingSample.get();
+			pSample->AddRef();
+			Sample = pSample;
+			Timestamp = PendingTimestamp;
+			PendingSample.reset();
+		}
+
+		hr = Sample->GetBufferByIndex(0, &Buffer);
+		if (FAILED(hr))
+		{
+			if (Verbose)
+			{
+				std::cerr << std::string("[WARN] ") + FH(hr) + ": `Sample->GetBufferByIndex(0, &Buffer)`.\n";
+			}
+			return false;
+		}
+
+		BYTE* LockPtr = nullptr;
+		DWORD MaxLength = 0;
+		DWORD CurLength = 0;
+		hr = Buffer->Lock(&LockPtr, &MaxLength, &CurLength);
+		if (FAILED(hr)) throw FetchFrameFailed(FH(hr) + "Buffer->Lock()");
+
+		ConvertSample(Buffer, LockPtr, CurLength, Timestamp);
+		return true;
+	}
+
+	FrameTimestamp WebCamTypeInternal::GetFrameTimestamp() const
+	{
+		return CurTimestamp;
 	}
 
 	STDMETHODIMP WebCamTypeInternal::OnEvent(DWORD, IMFMediaEvent*)
@@ -609,8 +961,11 @@ namespace WindowsWebCamTypeLib
 
 	void WebCamTypeInternal::CloseDevice()
 	{
-		auto lock = std::scoped_lock(*Lock);
+		auto lock = std::scoped_lock(ConvertLock, *Lock);
+		PendingSample.reset();
 		Reader.reset();
+		MediaTypes.clear();
+		MediaTypesEnumerated = false;
 	}
 
 	bool WebCamTypeInternal::IsFormatSupported(REFGUID subtype)
@@ -654,7 +1009,7 @@ namespace WindowsWebCamTypeLib
 				std::cout << "[WARN] The media type is not supported directly without conversion needed.\n";
 			}
 			// 是否解码后可支持
-			if (VideoFormatConverters.contains(subtype))
+			if (VideoFormatEnumMap.contains(subtype))
 			{
 				hr = Type->SetGUID(MF_MT_SUBTYPE, subtype);
 				if (FAILED(hr)) throw SetDeviceFailed(FH(hr) + ": Type->SetGUID(MF_MT_SUBTYPE, {" + GUID2Str(subtype, ":") + "}) failed.");
@@ -695,7 +1050,15 @@ namespace WindowsWebCamTypeLib
 
 		LONG srcPitch;
 		hr = MFGetStrideForBitmapInfoHeader(subtype.Data1, SrcWidth, &srcPitch);
-		if (FAILED(hr)) throw SetupFrameBufferFailed(FH(hr) + ": `MFGetStrideForBitmapInfoHeader()` failed.");
+		if (FAILED(hr))
+		{
+			// Media Foundation 不认识的 FourCC（如 Y16）按紧密排列计算
+			auto GetLayout = RawFrameLayouts[size_t(CurRawFrameType)];
+			if (!GetLayout) throw SetupFrameBufferFailed(FH(hr) + ": `MFGetStrideForBitmapInfoHeader()` failed.");
+			size_t Pitch;
+			GetLayout(SrcWidth, 1, Pitch);
+			srcPitch = LONG(Pitch);
+		}
 
 		if (Verbose)
 		{
@@ -718,137 +1081,693 @@ namespace WindowsWebCamTypeLib
 			std::cout << std::string("[INFO] Setting up the framebuffer.\n");
 		}
 
+		// 按旧格式收到的帧不能再按新格式转换
+		PendingSample.reset();
+
 		hr = Type->GetGUID(MF_MT_SUBTYPE, &subtype);
 		if (FAILED(hr)) throw SetupFrameBufferFailed(FH(hr) + ": `Type->GetGUID(MF_MT_SUBTYPE)` failed.");
 
-		FormatConverter = VideoFormatConverters.at(subtype);
+		// 格式或尺寸可能改变，正在进行的录制在此结束
+		if (Recorder)
+		{
+			if (Verbose)
+			{
+				std::cout << std::string("[INFO] Recording to `") + Recorder->GetPath() + "` stopped because the media type changed.\n";
+			}
+			Recorder.reset();
+		}
+
 		CurRawFrameType = VideoFormatEnumMap.at(subtype);
+		auto ConverterRFT = GetConverterRawFrameType(CurRawFrameType);
+		FormatConverter = VideoFormatConverters[size_t(ConverterRFT)];
+		RegionFormatConverter = VideoFormatRegionConverters[size_t(ConverterRFT)];
+		ScaledFormatConverter = VideoFormatScaledConverters[size_t(ConverterRFT)];
 
 		hr = MFGetAttributeSize(Type, MF_MT_FRAME_SIZE, &SrcWidth, &SrcHeight);
 		if (FAILED(hr)) throw SetupFrameBufferFailed(FH(hr) + ": `MFGetAttributeSize(MF_MT_FRAME_SIZE)` failed.");
 
-		FrameBuffer = std::make_shared<Image_RGBA8>(SrcWidth, SrcHeight, Pixel_RGBA8(0, 0, 0, 255));
-		
-		GetSrcPitch(Type, subtype, &SrcPitch);
+		AllocFrameBuffer();
+
+		// 压缩格式没有步长，解码后的步长由解码缓冲区决定
+		if (CurRawFrameType == RawFrameType::MJPG) SrcPitch = 0;
+		else GetSrcPitch(Type, subtype, &SrcPitch);
 
 		if (Verbose)
 		{
-			std::cout << std::string("[INFO] The framebuffer is set to ") + std::to_string(SrcWidth) + "x" + std::to_string(SrcHeight) + " with pitch(stride) = " + std::to_string(SrcPitch) + " for source format `" + GetRawFrameTypeStr(subtype) + "`.\n";
+			std::cout << std::string("[INFO] The framebuffer is set to ") + std::to_string(FrameBuffer->GetWidth()) + "x" + std::to_string(FrameBuffer->GetHeight()) + " from source " + std::to_string(SrcWidth) + "x" + std::to_string(SrcHeight) + " with pitch(stride) = " + std::to_string(SrcPitch) + " for source format `" + GetRawFrameTypeStr(subtype) + "`.\n";
 		}
 	}
 
-	bool WebCamTypeInternal::SetRawFrameType(RawFrameType RFT)
+	void WebCamTypeInternal::AllocFrameBuffer()
 	{
-		PreferredRawFrameType = RFT;
-		if (Verbose)
+		uint32_t FrameWidth = SrcWidth;
+		uint32_t FrameHeight = SrcHeight;
+		if (CurRawFrameType == RawFrameType::MJPG)
 		{
-			std::cout << std::string("[INFO] Setting up media type to the specified media type (`") + GetRawFrameTypeStr(RFT) + "`)}.\n";
+			// 感兴趣区域等都以解码后的尺寸为准
+			JpegScaleDenom = ChooseJpegScaleDenom();
+			JpegFrameWidth = FrameWidth = JpegDecoderType::GetScaledSize(SrcWidth, JpegScaleDenom);
+			JpegFrameHeight = FrameHeight = JpegDecoderType::GetScaledSize(SrcHeight, JpegScaleDenom);
 		}
-		if (RFT == CurRawFrameType)
+		SrcRegion = AlignRegionToSubsampling(CurRawFrameType, RequestedRegion, FrameWidth, FrameHeight);
+
+		// 高位深的格式除了 16 位输出和原样输出以外，都要先经过色调映射
+		bool RawOutput = OutputFormat == OutputFormatType::Passthrough || OutputFormatBitDepth[size_t(OutputFormat)] == 16;
+		bool HighDepth = RawFrameToneMappers[size_t(CurRawFrameType)] != nullptr;
+		ToneMapNeeded = HighDepth && !RawOutput;
+		AutoWindowValid = false;
+		if (ToneMapNeeded)
 		{
-			if (Verbose)
-			{
-				std::cout << std::string("[INFO] The current media type GUID matches the specified media type (`") + GetRawFrameTypeStr(RFT) + "`)}.\n";
-			}
-			return true;
+			ToneMappedFrame.resize(RawFrameLayouts[size_t(GetToneMappedRawFrameType(CurRawFrameType))](SrcWidth, SrcHeight, ToneMappedPitch));
+		}
+		else
+		{
+			ToneMappedFrame.clear();
+			ToneMappedPitch = 0;
 		}
-		auto& MyTypeGUID = VideoFormatToGUIDMap.at(RFT);
-		GUID TheCurGUID = { 0 };
-		auto Type = COMPtr<IMFMediaType>();
-		HRESULT hr = Reader->GetCurrentMediaType(
-			MF_SOURCE_READER_FIRST_VIDEO_STREAM,
-			&Type
-		);
-		if (!SUCCEEDED(hr)) throw SetDeviceFailed(FH(hr) + ": `Reader->GetCurrentMediaType()` failed.");
 
-		hr = Type->GetGUID(MF_MT_SUBTYPE, &TheCurGUID);
-		if (!SUCCEEDED(hr)) throw SetDeviceFailed(FH(hr) + ": `Type->GetGUID(MF_MT_SUBTYPE)` failed.");
+		// 指定了输出尺寸时，帧缓冲区按输出尺寸分配，转换时直接缩放，否则与感兴趣区域一样大
+		// 输出尺寸是旋转后的尺寸
+		bool Transposed = IsOrientationTransposed(Orientation);
+		uint32_t FBWidth = DstWidth ? DstWidth : (Transposed ? SrcRegion.Height : SrcRegion.Width);
+		uint32_t FBHeight = DstHeight ? DstHeight : (Transposed ? SrcRegion.Width : SrcRegion.Height);
+		FrameBuffer = std::make_shared<Image_RGBA8>(FBWidth, FBHeight, Pixel_RGBA8(0, 0, 0, 255));
+		FrameUpdated = false;
 
-		if (TheCurGUID == MyTypeGUID)
+		OutputBuffer.Format = OutputFormat;
+		if (OutputFormat == OutputFormatType::RGBA8)
 		{
-			if (Verbose)
-			{
-				std::cout << std::string("[INFO] The current media type GUID matches the specified media type (`") + GetRawFrameTypeStr(RFT) + "`) GUID {" + GUID2Str(TheCurGUID, "-") + "}.\n";
-			}
-			CurRawFrameType = RFT;
-			SetupFrameBuffer(Type);
-			return true;
+			OutputBuffer.Width = OutputBuffer.Height = 0;
+			OutputBuffer.Pitch = 0;
+			OutputBuffer.Data.clear();
+			return;
 		}
 
-		hr = Type->SetGUID(MF_MT_SUBTYPE, MyTypeGUID);
-		if (!SUCCEEDED(hr)) throw SetDeviceFailed(FH(hr) + ": `Type->SetGUID(MF_MT_SUBTYPE)` failed.");
+		// 其它输出格式只支持区域裁剪和上下翻转
+		if (DstWidth || (Orientation != OrientationType::Normal && Orientation != OrientationType::FlipV))
+		{
+			throw SetupFrameBufferFailed("Output formats other than RGBA8 don't support scaling, rotation or horizontal flipping.");
+		}
 
-		hr = Reader->SetCurrentMediaType(
-			MF_SOURCE_READER_FIRST_VIDEO_STREAM,
-			NULL,
-			Type
-		);
-		if (SUCCEEDED(hr))
+		auto OutputRFT = HighDepth && !ToneMapNeeded ? CurRawFrameType : GetConverterRawFrameType(CurRawFrameType);
+		OutputConverter = OutputFormatConverters[size_t(OutputFormat)][size_t(OutputRFT)];
+		if (!OutputConverter && !(OutputFormat == OutputFormatType::Passthrough && CurRawFrameType == RawFrameType::MJPG))
 		{
-			CurRawFrameType = RFT;
-			SetupFrameBuffer(Type);
-			if (Verbose)
+			throw SetupFrameBufferFailed("The output format doesn't support the raw frame type `" + GetRawFrameTypeStr(CurRawFrameType) + "`.");
+		}
+		OutputBuffer.Width = SrcRegion.Width;
+		OutputBuffer.Height = SrcRegion.Height;
+		if (OutputFormat == OutputFormatType::Passthrough && CurRawFrameType == RawFrameType::MJPG)
+		{
+			// 原样输出压缩的帧，每一帧的大小都不同
+			if (SrcRegion.Width != SrcWidth || SrcRegion.Height != SrcHeight || Orientation != OrientationType::Normal)
 			{
-				std::cout << std::string("[INFO] The media type is set to specified type: ") + GetRawFrameTypeStr(RFT) + "\n";
+				throw SetupFrameBufferFailed("Passthrough output of MJPG doesn't support region of interest or flipping.");
 			}
-			return true;
+			OutputBuffer.Pitch = 0;
+			OutputBuffer.Data.clear();
+		}
+		else if (OutputFormat == OutputFormatType::Passthrough)
+		{
+			OutputBuffer.Data.resize(RawFrameLayouts[size_t(CurRawFrameType)](SrcRegion.Width, SrcRegion.Height, OutputBuffer.Pitch));
 		}
 		else
 		{
-			if (Verbose)
-			{
-				std::cerr << std::string("[WARN] Try to set the media type to specified type: ") + GetRawFrameTypeStr(RFT) + " failed: " + FH(hr) + "\n";
-			}
-			return false;
+			OutputBuffer.Pitch = size_t(SrcRegion.Width) * OutputFormatBytesPerPixel[size_t(OutputFormat)];
+			OutputBuffer.Data.resize(OutputBuffer.Pitch * SrcRegion.Height);
 		}
 	}
 
-	void WebCamTypeInternal::SetNativeRawFrameType()
+	uint32_t WebCamTypeInternal::ChooseJpegScaleDenom() const
 	{
-		// 枚举格式
-		for (uint32_t i = 0; ; i++)
-		{
-			auto Type = COMPtr<IMFMediaType>();
-			HRESULT hr = Reader->GetNativeMediaType(
-				MF_SOURCE_READER_FIRST_VIDEO_STREAM,
-				i,
-				&Type
-			);
-
-			// 穷举到最后一种格式类型
-			if (FAILED(hr)) { break; }
-
-			// 测试这种格式类型是否支持
-			hr = TryMediaType(Type);
+		// 只在整帧缩小输出时缩小解码，且缩小后的尺寸不小于输出尺寸，剩下的部分由缩放转换完成
+		if (!DstWidth || !DstHeight || (RequestedRegion.Width && RequestedRegion.Height)) return 1;
 
-			if (SUCCEEDED(hr))
-			{
-				GUID subtype = { 0 };
-				hr = Type->GetGUID(MF_MT_SUBTYPE, &subtype);
-				CurRawFrameType = VideoFormatEnumMap.at(subtype);
-				if (CurRawFrameType == PreferredRawFrameType)
-				{
-					if (Verbose)
-					{
-						std::cout << std::string("[INFO] The selected format matches the preferred raw format: ") + GetRawFrameTypeStr(PreferredRawFrameType) + "\n";
-					}
-				}
-				break;
-			}
+		bool Transposed = IsOrientationTransposed(Orientation);
+		uint32_t Width = Transposed ? DstHeight : DstWidth;
+		uint32_t Height = Transposed ? DstWidth : DstHeight;
+		for (uint32_t Denom = 8; Denom > 1; Denom /= 2)
+		{
+			if (JpegDecoderType::GetScaledSize(SrcWidth, Denom) >= Width && JpegDecoderType::GetScaledSize(SrcHeight, Denom) >= Height) return Denom;
 		}
+		return 1;
 	}
 
-	void WebCamTypeInternal::SetDevice(IMFActivate* Device)
+	bool WebCamTypeInternal::DecodeJpegSample(const BYTE* pData, DWORD Size, const BYTE*& pScanline0, int32_t& Pitch)
 	{
-		auto Source = COMPtr<IMFMediaSource>();
-		auto Attributes = COMPtr<IMFAttributes>();
+		bool Succeeded = true;
+		bool FullFrame = SrcRegion.Width == JpegFrameWidth && SrcRegion.Height == JpegFrameHeight;
+		bool Direct = false;
 
-		HRESULT hr = S_OK;
+		if (OutputFormat == OutputFormatType::Passthrough)
+		{
+			OutputBuffer.Data.assign(pData, pData + Size);
+			return true;
+		}
+		else if (FullFrame && Orientation == OrientationType::Normal && OutputFormat != OutputFormatType::RGBA8 && JpegOutputDecoders[size_t(OutputFormat)])
+		{
+			Succeeded = (JpegDecoder.*JpegOutputDecoders[size_t(OutputFormat)])(pData, Size, OutputBuffer.Data.data(), OutputBuffer.Pitch, OutputBuffer.Width, OutputBuffer.Height, JpegScaleDenom);
+			Direct = true;
+		}
+		else if (FullFrame && Orientation == OrientationType::Normal && FrameBuffer->GetWidth() == JpegFrameWidth && FrameBuffer->GetHeight() == JpegFrameHeight)
+		{
+			Succeeded = JpegDecoder.Decode(pData, Size, *FrameBuffer, JpegScaleDenom);
+			Direct = true;
+		}
+		else
+		{
+			// 解码成 RGB32，之后按 RGB32 裁剪、旋转、缩放
+			Pitch = int32_t(JpegFrameWidth * 4);
+			JpegFrame.resize(size_t(Pitch) * JpegFrameHeight);
+			Succeeded = JpegDecoder.Decode<BGRA8Traits>(pData, Size, JpegFrame.data(), Pitch, JpegFrameWidth, JpegFrameHeight, JpegScaleDenom);
+			pScanline0 = JpegFrame.data();
+		}
 
-		CloseDevice();
+		if (!Succeeded && VerboseOnGetFrame)
+		{
+			std::cerr << "[WARN] The MJPG frame is corrupted, only part of it was decoded.\n";
+		}
+		return Direct;
+	}
+
+	void WebCamTypeInternal::SetFrameBufferSize(uint32_t Width, uint32_t Height, ScaleFilterType Filter)
+	{
+		if (!Width != !Height) throw SetupFrameBufferFailed("`SetFrameBufferSize()`: width and height must be both zero or both non-zero.");
+
+		auto lock = std::scoped_lock(ConvertLock, *Lock);
+
+		DstWidth = Width;
+		DstHeight = Height;
+		ScaleFilter = Filter;
+
+		// 设备已打开时立即重新分配帧缓冲区，否则等 `SetupFrameBuffer()` 时再分配
+		if (SrcWidth && SrcHeight)
+		{
+			AllocFrameBuffer();
+
+			if (Verbose)
+			{
+				std::cout << std::string("[INFO] The framebuffer is resized to ") + std::to_string(FrameBuffer->GetWidth()) + "x" + std::to_string(FrameBuffer->GetHeight()) + ".\n";
+			}
+		}
+	}
+
+	void WebCamTypeInternal::SetRegionOfInterest(const FrameRegion& Region)
+	{
+		auto lock = std::scoped_lock(ConvertLock, *Lock);
+
+		RequestedRegion = Region;
+
+		if (SrcWidth && SrcHeight)
+		{
+			AllocFrameBuffer();
+
+			if (Verbose)
+			{
+				std::cout << std::string("[INFO] The region of interest is set to (") + std::to_string(SrcRegion.X) + ", " + std::to_string(SrcRegion.Y) + ") " + std::to_string(SrcRegion.Width) + "x" + std::to_string(SrcRegion.Height) + ".\n";
+			}
+		}
+	}
+
+	FrameRegion WebCamTypeInternal::GetRegionOfInterest() const
+	{
+		return SrcRegion;
+	}
+
+	void WebCamTypeInternal::SetOrientation(OrientationType Orientation)
+	{
+		auto lock = std::scoped_lock(ConvertLock, *Lock);
+
+		this->Orientation = Orientation;
+
+		if (SrcWidth && SrcHeight)
+		{
+			AllocFrameBuffer();
+
+			if (Verbose)
+			{
+				std::cout << std::string("[INFO] The framebuffer is reoriented to ") + std::to_string(FrameBuffer->GetWidth()) + "x" + std::to_string(FrameBuffer->GetHeight()) + ".\n";
+			}
+		}
+	}
+
+	OrientationType WebCamTypeInternal::GetOrientation() const
+	{
+		return Orientation;
+	}
+
+	void WebCamTypeInternal::SetOutputFormat(OutputFormatType Format)
+	{
+		auto lock = std::scoped_lock(ConvertLock, *Lock);
+
+		OutputFormat = Format;
+
+		if (SrcWidth && SrcHeight)
+		{
+			AllocFrameBuffer();
+
+			if (Verbose && OutputFormat != OutputFormatType::RGBA8)
+			{
+				std::cout << std::string("[INFO] The output buffer is set to ") + std::to_string(OutputBuffer.Width) + "x" + std::to_string(OutputBuffer.Height) + " with pitch = " + std::to_string(OutputBuffer.Pitch) + ".\n";
+			}
+		}
+	}
+
+	OutputFormatType WebCamTypeInternal::GetOutputFormat() const
+	{
+		return OutputFormat;
+	}
+
+	void WebCamTypeInternal::StartRecording(const std::string& Path)
+	{
+		auto lock = std::scoped_lock(*Lock);
+
+		if (CurRawFrameType != RawFrameType::MJPG)
+		{
+			throw WriteVideoFailed("Recording without decoding needs the MJPG raw frame type, the current type is `" + GetRawFrameTypeStr(CurRawFrameType) + "`.");
+		}
+
+		Recorder = std::make_unique<MotionJpegSinkType>(Path, SrcWidth, SrcHeight);
+
+		if (Verbose)
+		{
+			std::cout << std::string("[INFO] Recording MJPG frames to `") + Path + "`.\n";
+		}
+	}
+
+	void WebCamTypeInternal::StopRecording()
+	{
+		auto lock = std::scoped_lock(*Lock);
+
+		if (!Recorder) return;
+		auto Sink = std::move(Recorder);
+		Sink->Close();
+
+		if (Verbose)
+		{
+			std::cout << std::string("[INFO] Recorded ") + std::to_string(Sink->GetNumFrames()) + " frames to `" + Sink->GetPath() + "`.\n";
+		}
+	}
+
+	bool WebCamTypeInternal::IsRecording() const
+	{
+		return Recorder != nullptr;
+	}
+
+	void WebCamTypeInternal::StartRawRecording(const std::string& Path)
+	{
+		auto lock = std::scoped_lock(*Lock);
+
+		RawRecorder = std::make_unique<RawFrameRecorderType>(Path);
+
+		if (Verbose)
+		{
+			std::cout << std::string("[INFO] Recording raw frames to `") + Path + "`.\n";
+		}
+	}
 
+	void WebCamTypeInternal::StopRawRecording()
+	{
 		auto lock = std::scoped_lock(*Lock);
 
+		if (!RawRecorder) return;
+		auto Sink = std::move(RawRecorder);
+		Sink->Close();
+
+		if (Verbose)
+		{
+			std::cout << std::string("[INFO] Recorded ") + std::to_string(Sink->GetNumFrames()) + " raw frames to `" + Sink->GetPath() + "`.\n";
+		}
+	}
+
+	bool WebCamTypeInternal::IsRawRecording() const
+	{
+		return RawRecorder != nullptr;
+	}
+
+	void WebCamTypeInternal::SetPreviewEnabled(bool Enabled)
+	{
+		auto lock = std::scoped_lock(*Lock);
+		PreviewEnabled = Enabled;
+	}
+
+	bool WebCamTypeInternal::GetPreviewEnabled() const
+	{
+		return PreviewEnabled;
+	}
+
+	void WebCamTypeInternal::SetToneMapping(const ToneMapping& Params)
+	{
+		if (!Params.AutoWindow && Params.Low >= Params.High) throw SetupFrameBufferFailed("`SetToneMapping()`: `Low` must be less than `High`.");
+		if (!(Params.Gamma > 0)) throw SetupFrameBufferFailed("`SetToneMapping()`: `Gamma` must be positive.");
+		if (!(Params.AutoClipPercent >= 0 && Params.AutoClipPercent < 50)) throw SetupFrameBufferFailed("`SetToneMapping()`: `AutoClipPercent` must be in [0, 50).");
+
+		auto lock = std::scoped_lock(ConvertLock, *Lock);
+		ToneMap = Params;
+		AutoWindowValid = false;
+	}
+
+	ToneMapping WebCamTypeInternal::GetToneMapping() const
+	{
+		return ToneMap;
+	}
+
+	void WebCamTypeInternal::ToneMapSample(const BYTE*& pScanline0, int32_t& Pitch)
+	{
+		uint16_t Low = ToneMap.Low;
+		uint16_t High = ToneMap.High;
+		if (ToneMap.AutoWindow)
+		{
+			// 窗口逐帧向测量值靠近，避免画面闪烁
+			MeasureLumaWindow16(pScanline0, Pitch, SrcWidth, SrcHeight, ToneMap.AutoClipPercent, Low, High);
+			if (AutoWindowValid)
+			{
+				Low = uint16_t((uint32_t(AutoWindowLow) * 7 + Low + 4) / 8);
+				High = uint16_t((uint32_t(AutoWindowHigh) * 7 + High + 4) / 8);
+			}
+			AutoWindowLow = Low;
+			AutoWindowHigh = High;
+
+			// 平滑后的窗口每帧仍会变动几个单位，每次都重建 65536 项的查找表太贵。
+			// 变动不到窗口宽度的 1/256（输出不到一级灰度）时沿用上次的窗口，最少按 10 位数据的一级计
+			uint16_t Threshold = std::max<uint16_t>(uint16_t((High > Low ? High - Low : 0) / 256), 64);
+			if (!AutoWindowValid || std::abs(int(Low) - int(AppliedWindowLow)) >= Threshold || std::abs(int(High) - int(AppliedWindowHigh)) >= Threshold)
+			{
+				AppliedWindowLow = Low;
+				AppliedWindowHigh = High;
+			}
+			Low = AppliedWindowLow;
+			High = AppliedWindowHigh;
+			AutoWindowValid = true;
+		}
+
+		// YUV 格式的亮度映射到视频范围，灰度格式映射到全范围
+		bool VideoRange = GetToneMappedRawFrameType(CurRawFrameType) != RawFrameType::Y8;
+		ToneMapTable->Build(Low, High, ToneMap.Gamma, VideoRange ? 16 : 0, VideoRange ? 235 : 255);
+		RawFrameToneMappers[size_t(CurRawFrameType)](ToneMappedFrame.data(), ToneMappedPitch, pScanline0, Pitch, SrcWidth, SrcHeight, ToneMapTable->GetTable());
+
+		pScanline0 = ToneMappedFrame.data();
+		Pitch = int32_t(ToneMappedPitch);
+	}
+
+	bool WebCamTypeInternal::SetRawFrameType(RawFrameType RFT)
+	{
+		PreferredRawFrameType = RFT;
+		if (Verbose)
+		{
+			std::cout << std::string("[INFO] Setting up media type to the specified media type (`") + GetRawFrameTypeStr(RFT) + "`)}.\n";
+		}
+		if (RFT == CurRawFrameType)
+		{
+			if (Verbose)
+			{
+				std::cout << std::string("[INFO] The current media type GUID matches the specified media type (`") + GetRawFrameTypeStr(RFT) + "`)}.\n";
+			}
+			return true;
+		}
+		auto& MyTypeGUID = VideoFormatToGUIDMap.at(RFT);
+		GUID TheCurGUID = { 0 };
+		auto Type = COMPtr<IMFMediaType>();
+		HRESULT hr = Reader->GetCurrentMediaType(
+			MF_SOURCE_READER_FIRST_VIDEO_STREAM,
+			&Type
+		);
+		if (!SUCCEEDED(hr)) throw SetDeviceFailed(FH(hr) + ": `Reader->GetCurrentMediaType()` failed.");
+
+		hr = Type->GetGUID(MF_MT_SUBTYPE, &TheCurGUID);
+		if (!SUCCEEDED(hr)) throw SetDeviceFailed(FH(hr) + ": `Type->GetGUID(MF_MT_SUBTYPE)` failed.");
+
+		if (TheCurGUID == MyTypeGUID)
+		{
+			if (Verbose)
+			{
+				std::cout << std::string("[INFO] The current media type GUID matches the specified media type (`") + GetRawFrameTypeStr(RFT) + "`) GUID {" + GUID2Str(TheCurGUID, "-") + "}.\n";
+			}
+			CurRawFrameType = RFT;
+			SetupFrameBuffer(Type);
+			return true;
+		}
+
+		hr = Type->SetGUID(MF_MT_SUBTYPE, MyTypeGUID);
+		if (!SUCCEEDED(hr)) throw SetDeviceFailed(FH(hr) + ": `Type->SetGUID(MF_MT_SUBTYPE)` failed.");
+
+		hr = Reader->SetCurrentMediaType(
+			MF_SOURCE_READER_FIRST_VIDEO_STREAM,
+			NULL,
+			Type
+		);
+		if (SUCCEEDED(hr))
+		{
+			CurRawFrameType = RFT;
+			SetupFrameBuffer(Type);
+			if (Verbose)
+			{
+				std::cout << std::string("[INFO] The media type is set to specified type: ") + GetRawFrameTypeStr(RFT) + "\n";
+			}
+			return true;
+		}
+		else
+		{
+			if (Verbose)
+			{
+				std::cerr << std::string("[WARN] Try to set the media type to specified type: ") + GetRawFrameTypeStr(RFT) + " failed: " + FH(hr) + "\n";
+			}
+			return false;
+		}
+	}
+
+	void WebCamTypeInternal::SetNativeRawFrameType()
+	{
+		// 枚举格式
+		for (uint32_t i = 0; ; i++)
+		{
+			auto Type = COMPtr<IMFMediaType>();
+			HRESULT hr = Reader->GetNativeMediaType(
+				MF_SOURCE_READER_FIRST_VIDEO_STREAM,
+				i,
+				&Type
+			);
+
+			// 穷举到最后一种格式类型
+			if (FAILED(hr)) { break; }
+
+			// 测试这种格式类型是否支持
+			hr = TryMediaType(Type);
+
+			if (SUCCEEDED(hr))
+			{
+				GUID subtype = { 0 };
+				hr = Type->GetGUID(MF_MT_SUBTYPE, &subtype);
+				CurRawFrameType = VideoFormatEnumMap.at(subtype);
+				if (CurRawFrameType == PreferredRawFrameType)
+				{
+					if (Verbose)
+					{
+						std::cout << std::string("[INFO] The selected format matches the preferred raw format: ") + GetRawFrameTypeStr(PreferredRawFrameType) + "\n";
+					}
+				}
+				break;
+			}
+		}
+	}
+
+	static double GetFps(uint32_t Num, uint32_t Den)
+	{
+		return Den ? double(Num) / Den : 0;
+	}
+
+	std::vector<MediaTypeInfo> WebCamTypeInternal::GetMediaTypes()
+	{
+		auto lock = std::scoped_lock(*Lock);
+		if (MediaTypesEnumerated || !Reader) return MediaTypes;
+
+		for (uint32_t i = 0; ; i++)
+		{
+			auto Type = COMPtr<IMFMediaType>();
+			HRESULT hr = Reader->GetNativeMediaType(MF_SOURCE_READER_FIRST_VIDEO_STREAM, i, &Type);
+			if (FAILED(hr)) break;
+
+			MediaTypeInfo Info;
+			Info.Index = i;
+
+			GUID subtype = { 0 };
+			hr = Type->GetGUID(MF_MT_SUBTYPE, &subtype);
+			if (SUCCEEDED(hr) && VideoFormatEnumMap.contains(subtype))
+			{
+				auto RFT = VideoFormatEnumMap.at(subtype);
+				Info.Format = GetRawFrameTypeStr(RFT);
+				Info.Supported = true;
+				Info.ConversionCost = FormatCosts[size_t(RFT)];
+			}
+			else
+			{
+				Info.Format = GetRawFrameTypeStr(subtype);
+			}
+
+			MFGetAttributeSize(Type, MF_MT_FRAME_SIZE, &Info.Width, &Info.Height);
+			MFGetAttributeRatio(Type, MF_MT_FRAME_RATE, &Info.FpsNum, &Info.FpsDen);
+			Info.MinFpsNum = Info.MaxFpsNum = Info.FpsNum;
+			Info.MinFpsDen = Info.MaxFpsDen = Info.FpsDen;
+			MFGetAttributeRatio(Type, MF_MT_FRAME_RATE_RANGE_MIN, &Info.MinFpsNum, &Info.MinFpsDen);
+			MFGetAttributeRatio(Type, MF_MT_FRAME_RATE_RANGE_MAX, &Info.MaxFpsNum, &Info.MaxFpsDen);
+
+			UINT32 Stride = 0;
+			if (SUCCEEDED(Type->GetUINT32(MF_MT_DEFAULT_STRIDE, &Stride))) Info.Pitch = int32_t(Stride);
+
+			MediaTypes.push_back(Info);
+		}
+		MediaTypesEnumerated = true;
+
+		if (Verbose)
+		{
+			std::cout << std::string("[INFO] The device has ") + std::to_string(MediaTypes.size()) + " native media types.\n";
+		}
+		return MediaTypes;
+	}
+
+	// 在 `Request` 能够取到的帧率中选离要求最近的
+	static double GetEffectiveFps(const MediaTypeInfo& Info, const MediaTypeRequest& Request)
+	{
+		double MinFps = GetFps(Info.MinFpsNum, Info.MinFpsDen);
+		double MaxFps = GetFps(Info.MaxFpsNum, Info.MaxFpsDen);
+		if (Request.Fps <= 0) return MaxFps;
+		if (Request.Fps >= MaxFps) return MaxFps;
+		if (Request.Fps <= MinFps) return MinFps;
+		return Request.Fps;
+	}
+
+	// 各项得分都在 (0, 1] 之间，按权重取幂后相乘
+	static double ScoreMediaType(const MediaTypeInfo& Info, const MediaTypeRequest& Request, uint64_t MaxArea, double MaxFps, float MinCost)
+	{
+		uint64_t Area = uint64_t(Info.Width) * Info.Height;
+		double Fps = GetEffectiveFps(Info, Request);
+		if (!Area || Fps <= 0) return 0;
+
+		// 比要求大时只是多了缩小的开销，比要求小时画面会变模糊，扣分更多
+		double Resolution;
+		if (Request.Width && Request.Height)
+		{
+			double rw = double(Info.Width) / Request.Width;
+			double rh = double(Info.Height) / Request.Height;
+			if (rw >= 1 && rh >= 1) Resolution = std::sqrt(1 / (rw * rh));
+			else Resolution = 0.5 * (rw < 1 ? rw : 1) * (rh < 1 ? rh : 1);
+		}
+		else Resolution = double(Area) / MaxArea;
+
+		// 帧率不够时按比例的平方扣分，超过要求的帧率只是多了转换的开销
+		double FpsScore;
+		if (Request.Fps > 0) FpsScore = Fps >= Request.Fps - 0.5 ? std::sqrt(Request.Fps / Fps > 1 ? 1 : Request.Fps / Fps) : (Fps / Request.Fps) * (Fps / Request.Fps);
+		else FpsScore = Fps / MaxFps;
+
+		double Cost = Info.ConversionCost > 0 ? MinCost / Info.ConversionCost : 1;
+
+		return std::pow(Resolution, Request.ResolutionWeight) * std::pow(FpsScore, Request.FpsWeight) * std::pow(Cost, Request.CostWeight);
+	}
+
+	bool WebCamTypeInternal::SelectMediaType(const MediaTypeRequest& Request)
+	{
+		auto Types = GetMediaTypes();
+
+		uint64_t MaxArea = 0;
+		double MaxFps = 0;
+		float MinCost = 0;
+		for (auto& t : Types)
+		{
+			if (!t.Supported) continue;
+			uint64_t Area = uint64_t(t.Width) * t.Height;
+			double Fps = GetFps(t.MaxFpsNum, t.MaxFpsDen);
+			if (Area > MaxArea) MaxArea = Area;
+			if (Fps > MaxFps) MaxFps = Fps;
+			if (t.ConversionCost > 0 && (MinCost == 0 || t.ConversionCost < MinCost)) MinCost = t.ConversionCost;
+		}
+
+		std::vector<std::pair<double, const MediaTypeInfo*>> Candidates;
+		for (auto& t : Types)
+		{
+			if (!t.Supported) continue;
+			double Score = ScoreMediaType(t, Request, MaxArea, MaxFps, MinCost);
+			if (Score > 0) Candidates.push_back({ Score, &t });
+		}
+		std::stable_sort(Candidates.begin(), Candidates.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+
+		// 驱动可能拒绝某些组合，依次尝试
+		for (auto& c : Candidates)
+		{
+			auto& t = *c.second;
+			if (Verbose)
+			{
+				std::cout << std::string("[INFO] Trying media type #") + std::to_string(t.Index) + ": " + t.Format + " " + std::to_string(t.Width) + "x" + std::to_string(t.Height) + " @ " + std::to_string(GetEffectiveFps(t, Request)) + " fps, score " + std::to_string(c.first) + ".\n";
+			}
+			if (SetMediaType(t.Index, float(GetEffectiveFps(t, Request)))) return true;
+		}
+		return false;
+	}
+
+	bool WebCamTypeInternal::SetMediaType(uint32_t Index, float Fps)
+	{
+		auto lock = std::scoped_lock(ConvertLock, *Lock);
+		if (!Reader) return false;
+
+		auto Type = COMPtr<IMFMediaType>();
+		HRESULT hr = Reader->GetNativeMediaType(MF_SOURCE_READER_FIRST_VIDEO_STREAM, Index, &Type);
+		if (FAILED(hr)) return false;
+
+		GUID subtype = { 0 };
+		hr = Type->GetGUID(MF_MT_SUBTYPE, &subtype);
+		if (FAILED(hr) || !VideoFormatEnumMap.contains(subtype)) return false;
+
+		// 帧率可调时先按要求设置，驱动不接受就用原来的帧率
+		UINT32 FpsNum = 0, FpsDen = 1;
+		MFGetAttributeRatio(Type, MF_MT_FRAME_RATE, &FpsNum, &FpsDen);
+		bool FpsChanged = Fps > 0 && std::abs(GetFps(FpsNum, FpsDen) - Fps) > 0.01;
+		if (FpsChanged) MFSetAttributeRatio(Type, MF_MT_FRAME_RATE, UINT32(Fps * 1000 + 0.5f), 1000);
+
+		hr = Reader->SetCurrentMediaType(MF_SOURCE_READER_FIRST_VIDEO_STREAM, NULL, Type);
+		if (FAILED(hr) && FpsChanged)
+		{
+			MFSetAttributeRatio(Type, MF_MT_FRAME_RATE, FpsNum, FpsDen);
+			hr = Reader->SetCurrentMediaType(MF_SOURCE_READER_FIRST_VIDEO_STREAM, NULL, Type);
+		}
+		if (FAILED(hr))
+		{
+			if (Verbose)
+			{
+				std::cerr << std::string("[WARN] Setting the native media type #") + std::to_string(Index) + " failed: " + FH(hr) + "\n";
+			}
+			return false;
+		}
+
+		SetupFrameBuffer(Type);
+		PreferredRawFrameType = CurRawFrameType;
+		return true;
+	}
+
+	void WebCamTypeInternal::SetFormatCost(const std::string& Format, float Cost)
+	{
+		if (!(Cost > 0)) throw std::invalid_argument("The conversion cost must be positive.");
+
+		auto lock = std::scoped_lock(*Lock);
+		for (size_t i = 1; i < NumRawFrameTypes; i++)
+		{
+			if (GetRawFrameTypeStr(RawFrameType(i)) != Format) continue;
+			FormatCosts[i] = Cost;
+			for (auto& t : MediaTypes) if (t.Format == Format) t.ConversionCost = Cost;
+			return;
+		}
+		throw std::invalid_argument("Unknown raw frame type `" + Format + "`.");
+	}
+
+	void WebCamTypeInternal::SetDevice(IMFActivate* Device)
+	{
+		auto Source = COMPtr<IMFMediaSource>();
+		auto Attributes = COMPtr<IMFAttributes>();
+
+		HRESULT hr = S_OK;
+
+		CloseDevice();
+
+		auto lock = std::scoped_lock(ConvertLock, *Lock);
+
 		if (Verbose)
 		{
 			std::wcout << L"[INFO] Set device: " << GetDevicePathW(Device) << "\n";
@@ -861,6 +1780,9 @@ namespace WindowsWebCamTypeLib
 		);
 		if (!SUCCEEDED(hr)) throw SetDeviceFailed(FH(hr) + ": `Device->ActivateObject()` failed.");
 
+		// 设备对象来自缓存，会被多次激活；分离后下次激活时会创建新的媒体源，而不是返回已经关闭的这个
+		Device->DetachObject();
+
 		hr = MFCreateAttributes(&Attributes, 2);
 		if (!SUCCEEDED(hr)) throw SetDeviceFailed(FH(hr) + ": `MFCreateAttributes()` failed.");
 
@@ -924,37 +1846,247 @@ namespace WindowsWebCamTypeLib
 		FrameUpdated = IsUpdated;
 	}
 
-	RawFrameType WebCamTypeInternal::GetCurRawFrameType() const
+	RawFrameType WebCamTypeInternal::GetCurRawFrameType() const
+	{
+		return CurRawFrameType;
+	}
+
+	std::string WebCamTypeInternal::GetCurRawFrameTypeStr() const
+	{
+		return GetRawFrameTypeStr(CurRawFrameType);
+	}
+
+	std::string WebCamTypeInternal::GetRawFrameTypeStr(const GUID& guid)
+	try
+	{
+		return GetRawFrameTypeStr(VideoFormatEnumMap.at(guid));
+	}
+	catch (const std::out_of_range&)
+	{
+		return "unknown";
+	}
+
+	std::string WebCamTypeInternal::GetRawFrameTypeStr(RawFrameType RFT)
+	{
+		switch (RFT)
+		{
+		default:
+		case RawFrameType::Unknown: return "unknown";
+		case RawFrameType::RGB32: return "RGB32";
+		case RawFrameType::RGB24: return "RGB24";
+		case RawFrameType::YUY2: return "YUY2";
+		case RawFrameType::NV12: return "NV12";
+		case RawFrameType::UYVY: return "UYVY";
+		case RawFrameType::YVYU: return "YVYU";
+		case RawFrameType::NV21: return "NV21";
+		case RawFrameType::I420: return "I420";
+		case RawFrameType::YV12: return "YV12";
+		case RawFrameType::Y8: return "Y8";
+		case RawFrameType::P010: return "P010";
+		case RawFrameType::Y16: return "Y16";
+		case RawFrameType::MJPG: return "MJPG";
+		};
+	}
+
+	//-------------------------------------------------------------------
+	// Orientation helpers
+	//
+	// Every converter writes the logical (unrotated) image row by row.
+	// `GetOrientedRow()` returns where logical row `Y` starts in the
+	// frame buffer and the distance between two adjacent pixels of that
+	// row, so flips and rotations cost no extra pass over the image.
+	//-------------------------------------------------------------------
+
+	bool IsOrientationTransposed(OrientationType Orientation)
+	{
+		return Orientation == OrientationType::Rotate90 || Orientation == OrientationType::Rotate270;
+	}
+
+	static void GetOrientedSize(const Image_RGBA8& FrameBuffer, OrientationType Orientation, uint32_t& Width, uint32_t& Height)
+	{
+		if (IsOrientationTransposed(Orientation))
+		{
+			Width = FrameBuffer.GetHeight();
+			Height = FrameBuffer.GetWidth();
+		}
+		else
+		{
+			Width = FrameBuffer.GetWidth();
+			Height = FrameBuffer.GetHeight();
+		}
+	}
+
+	static Pixel_RGBA8* GetOrientedRow
+	(
+		Image_RGBA8& FrameBuffer,
+		uint32_t Width, uint32_t Height,
+		uint32_t Y, OrientationType Orientation,
+		ptrdiff_t& Step
+	)
+	{
+		ptrdiff_t Pitch = ptrdiff_t(FrameBuffer.GetPitch() / sizeof(Pixel_RGBA8));
+		switch (Orientation)
+		{
+		default:
+		case OrientationType::Normal:
+			Step = 1;
+			return FrameBuffer.GetBitmapRowPtr(Y);
+		case OrientationType::FlipH:
+			Step = -1;
+			return FrameBuffer.GetBitmapRowPtr(Y) + (Width - 1);
+		case OrientationType::FlipV:
+			Step = 1;
+			return FrameBuffer.GetBitmapRowPtr(Height - 1 - Y);
+		case OrientationType::Rotate180:
+			Step = -1;
+			return FrameBuffer.GetBitmapRowPtr(Height - 1 - Y) + (Width - 1);
+		case OrientationType::Rotate90:
+			// 顺时针旋转：源图像的第 Y 行成为输出图像的倒数第 Y 列
+			Step = Pitch;
+			return FrameBuffer.GetBitmapRowPtr(0) + (Height - 1 - Y);
+		case OrientationType::Rotate270:
+			// 逆时针旋转：源图像的第 Y 行成为输出图像的第 Y 列，从下往上写
+			Step = -Pitch;
+			return FrameBuffer.GetBitmapRowPtr(Width - 1) + Y;
+		}
+	}
+
+	//-------------------------------------------------------------------
+	// DecodeRow_*
+	//
+	// Decode `Count` pixels of source row `Y` starting at column `X0`
+	// into RGBA. The scaling and orienting converters use these so that
+	// every source row is read only once and no full-size RGBA copy is
+	// produced.
+	//-------------------------------------------------------------------
+
+	using RowDecoderFuncType = void(*)(Pixel_RGBA8* pDst, const BYTE* pSrc, int32_t SrcPitch, uint32_t SrcHeight, uint32_t Y, uint32_t X0, uint32_t Count);
+
+	static void DecodeRow_RGB32(Pixel_RGBA8* pDst, const BYTE* pSrc, int32_t SrcPitch, uint32_t SrcHeight, uint32_t Y, uint32_t X0, uint32_t Count)
 	{
-		return CurRawFrameType;
+		// 与 `TransformImage_RGB32` 一样直接拷贝
+		memcpy(pDst, pSrc + ptrdiff_t(Y) * SrcPitch + size_t(X0) * 4, size_t(Count) * 4);
 	}
 
-	std::string WebCamTypeInternal::GetCurRawFrameTypeStr() const
+	static void DecodeRow_RGB24(Pixel_RGBA8* pDst, const BYTE* pSrc, int32_t SrcPitch, uint32_t SrcHeight, uint32_t Y, uint32_t X0, uint32_t Count)
 	{
-		return GetRawFrameTypeStr(CurRawFrameType);
+		const RGBTRIPLE* pSrcPel = reinterpret_cast<const RGBTRIPLE*>(pSrc + ptrdiff_t(Y) * SrcPitch) + X0;
+		for (uint32_t i = 0; i < Count; i++)
+		{
+			pDst[i] = Pixel_RGBA8(pSrcPel[i].rgbtRed, pSrcPel[i].rgbtGreen, pSrcPel[i].rgbtBlue, 255);
+		}
 	}
 
-	std::string WebCamTypeInternal::GetRawFrameTypeStr(const GUID& guid)
-	try
+	static void DecodeRow_Y8(Pixel_RGBA8* pDst, const BYTE* pSrc, int32_t SrcPitch, uint32_t SrcHeight, uint32_t Y, uint32_t X0, uint32_t Count)
 	{
-		return GetRawFrameTypeStr(VideoFormatEnumMap.at(guid));
+		const BYTE* pLine = pSrc + ptrdiff_t(Y) * SrcPitch + X0;
+		for (uint32_t i = 0; i < Count; i++)
+		{
+			pDst[i] = Pixel_RGBA8(pLine[i], pLine[i], pLine[i], 255);
+		}
 	}
-	catch (const std::out_of_range&)
+
+	template<RawFrameType RFT>
+	static void DecodeRow_YUV(Pixel_RGBA8* pDst, const BYTE* pSrc, int32_t SrcPitch, uint32_t SrcHeight, uint32_t Y, uint32_t X0, uint32_t Count)
 	{
-		return "unknown";
+		using Traits = RawFrameTraits<RFT>;
+		const BYTE* lpLineY = pSrc + ptrdiff_t(Y) * SrcPitch;
+		if constexpr (Traits::NumPlanes == 1)
+		{
+			for (uint32_t i = 0; i < Count; i++)
+			{
+				// 每两个像素共用一组 U V，字节顺序由格式决定
+				uint32_t x = X0 + i;
+				const BYTE* pPair = lpLineY + (x >> 1) * 4;
+				pDst[i] = ConvertYUVToRGBA8(pPair[(x & 1) ? Traits::OffY1 : Traits::OffY0], pPair[Traits::OffU], pPair[Traits::OffV]);
+			}
+		}
+		else
+		{
+			auto Chroma = Traits::OffsetChroma(Traits::GetChromaPlanes(pSrc, SrcPitch, SrcHeight), 0, Y);
+			for (uint32_t i = 0; i < Count; i++)
+			{
+				uint32_t x = X0 + i;
+				size_t c = size_t(x >> 1) * Traits::ChromaStep;
+				pDst[i] = ConvertYUVToRGBA8(lpLineY[x], Chroma.pCb[c], Chroma.pCr[c]);
+			}
+		}
 	}
 
-	std::string WebCamTypeInternal::GetRawFrameTypeStr(RawFrameType RFT)
+	//-------------------------------------------------------------------
+	// OrientImage
+	//
+	// Convert `Region` of the source into `FrameBuffer` with any
+	// orientation. Flips decode row by row. Rotations decode a band of
+	// `TileSize` rows and write it out in `TileSize` x `TileSize`
+	// tiles, so both the band and the touched output rows stay in cache
+	// while the image is transposed.
+	//-------------------------------------------------------------------
+
+	static void OrientImage
+	(
+		Image_RGBA8& FrameBuffer,
+		RowDecoderFuncType DecodeRow,
+		const BYTE* pSrc, int32_t SrcPitch,
+		uint32_t SrcHeight, const FrameRegion& Region,
+		OrientationType Orientation
+	)
 	{
-		switch (RFT)
+		uint32_t Width = Region.Width;
+		uint32_t Height = Region.Height;
+		ptrdiff_t Step;
+
+		if (!IsOrientationTransposed(Orientation))
 		{
-		default:
-		case RawFrameType::Unknown: return "unknown";
-		case RawFrameType::RGB32: return "RGB32";
-		case RawFrameType::RGB24: return "RGB24";
-		case RawFrameType::YUY2: return "YUY2";
-		case RawFrameType::NV12: return "NV12";
-		};
+			thread_local std::vector<Pixel_RGBA8> Row;
+			Row.resize(Width);
+			for (uint32_t y = 0; y < Height; y++)
+			{
+				auto pDestPel = GetOrientedRow(FrameBuffer, Width, Height, y, Orientation, Step);
+				if (Step == 1)
+				{
+					DecodeRow(pDestPel, pSrc, SrcPitch, SrcHeight, Region.Y + y, Region.X, Width);
+					continue;
+				}
+				DecodeRow(&Row[0], pSrc, SrcPitch, SrcHeight, Region.Y + y, Region.X, Width);
+				for (uint32_t x = 0; x < Width; x++)
+				{
+					pDestPel[ptrdiff_t(x) * Step] = Row[x];
+				}
+			}
+			return;
+		}
+
+		constexpr uint32_t TileSize = 32;
+		thread_local std::vector<Pixel_RGBA8> Band;
+		Band.resize(size_t(Width) * TileSize);
+		Pixel_RGBA8* DestRows[TileSize];
+
+		for (uint32_t by = 0; by < Height; by += TileSize)
+		{
+			uint32_t Rows = Height - by < TileSize ? Height - by : TileSize;
+			for (uint32_t j = 0; j < Rows; j++)
+			{
+				DecodeRow(&Band[size_t(j) * Width], pSrc, SrcPitch, SrcHeight, Region.Y + by + j, Region.X, Width);
+				DestRows[j] = GetOrientedRow(FrameBuffer, Width, Height, by + j, Orientation, Step);
+			}
+
+			for (uint32_t bx = 0; bx < Width; bx += TileSize)
+			{
+				uint32_t Cols = Width - bx < TileSize ? Width - bx : TileSize;
+
+				// 源图像的一列对应输出图像的一行，内层循环按输出图像的行连续写入
+				for (uint32_t i = 0; i < Cols; i++)
+				{
+					ptrdiff_t Offset = ptrdiff_t(bx + i) * Step;
+					const Pixel_RGBA8* pBandPel = &Band[bx + i];
+					for (uint32_t j = 0; j < Rows; j++)
+					{
+						DestRows[j][Offset] = pBandPel[size_t(j) * Width];
+					}
+				}
+			}
+		}
 	}
 
 	//-------------------------------------------------------------------
@@ -967,26 +2099,22 @@ namespace WindowsWebCamTypeLib
 	(
 		Image_RGBA8& FrameBuffer,
 		const BYTE* pSrc, int32_t SrcPitch,
-		uint32_t Width, uint32_t Height
+		uint32_t Width, uint32_t Height,
+		OrientationType Orientation
 	)
 	{
-// 此处无需使用多线程
-// #pragma omp parallel for
-		for (int y = 0; y < int(Height); y++)
+		if (Orientation != OrientationType::Normal && Orientation != OrientationType::FlipV)
 		{
-			RGBTRIPLE* pSrcPel = (RGBTRIPLE*)(pSrc + y * SrcPitch);
-			auto pDestPel = FrameBuffer.GetBitmapRowPtr(y);
-
-			for (int x = 0; x < int(Width); x++)
-			{
-				pDestPel[x] = Pixel_RGBA8(
-					pSrcPel[x].rgbtRed,
-					pSrcPel[x].rgbtGreen,
-					pSrcPel[x].rgbtBlue,
-					255
-				);
-			}
+			return OrientImage(FrameBuffer, DecodeRow_RGB24, pSrc, SrcPitch, Height, FrameRegion{ 0, 0, Width, Height }, Orientation);
+		}
+		if (Orientation == OrientationType::FlipV)
+		{
+			// 上下翻转只需要从最后一行开始倒着读
+			pSrc += ptrdiff_t(Height - 1) * SrcPitch;
+			SrcPitch = -SrcPitch;
 		}
+
+		ConvertFrame<RawFrameType::RGB24, RGBA8Traits>(reinterpret_cast<uint8_t*>(FrameBuffer.GetBitmapDataPtr()), FrameBuffer.GetPitch(), pSrc, SrcPitch, Width, Height);
 	}
 
 	//-------------------------------------------------------------------
@@ -1002,9 +2130,20 @@ namespace WindowsWebCamTypeLib
 	(
 		Image_RGBA8& FrameBuffer,
 		const BYTE* pSrc, int32_t SrcPitch,
-		uint32_t Width, uint32_t Height
+		uint32_t Width, uint32_t Height,
+		OrientationType Orientation
 	)
 	{
+		if (Orientation != OrientationType::Normal && Orientation != OrientationType::FlipV)
+		{
+			return OrientImage(FrameBuffer, DecodeRow_RGB32, pSrc, SrcPitch, Height, FrameRegion{ 0, 0, Width, Height }, Orientation);
+		}
+		if (Orientation == OrientationType::FlipV)
+		{
+			pSrc += ptrdiff_t(Height - 1) * SrcPitch;
+			SrcPitch = -SrcPitch;
+		}
+
 		MFCopyImage(
 			reinterpret_cast<BYTE*>(FrameBuffer.GetBitmapDataPtr()),
 			FrameBuffer.GetPitch(),
@@ -1013,86 +2152,531 @@ namespace WindowsWebCamTypeLib
 	}
 
 	//-------------------------------------------------------------------
-	// TransformImage_YUY2 
+	// TransformImage_Y8
 	//
-	// YUY2 to RGB-32
+	// 8-bit grayscale to RGB-32, also used for tone mapped Y16 frames
 	//-------------------------------------------------------------------
 
-	void TransformImage_YUY2
+	void TransformImage_Y8
 	(
 		Image_RGBA8& FrameBuffer,
 		const BYTE* pSrc, int32_t SrcPitch,
-		uint32_t Width, uint32_t Height
+		uint32_t Width, uint32_t Height,
+		OrientationType Orientation
 	)
 	{
-// #pragma omp parallel for
-		for (int y = 0; y < int(Height); y++)
+		if (Orientation != OrientationType::Normal && Orientation != OrientationType::FlipV)
+		{
+			return OrientImage(FrameBuffer, DecodeRow_Y8, pSrc, SrcPitch, Height, FrameRegion{ 0, 0, Width, Height }, Orientation);
+		}
+		ConvertFrameRegion<RawFrameType::Y8, RGBA8Traits>(reinterpret_cast<uint8_t*>(FrameBuffer.GetBitmapDataPtr()), FrameBuffer.GetPitch(), pSrc, SrcPitch, Height, 0, 0, Width, Height, Orientation == OrientationType::FlipV);
+	}
+
+	//-------------------------------------------------------------------
+	// TransformImage_YUV
+	//
+	// YUV (YUY2, UYVY, YVYU, NV12, NV21, I420, YV12) to RGB-32. All of
+	// them share one kernel per layout, the byte order and the order of
+	// the chroma planes come from `RawFrameTraits`.
+	//-------------------------------------------------------------------
+
+	template<RawFrameType RFT>
+	void TransformImage_YUV
+	(
+		Image_RGBA8& FrameBuffer,
+		const BYTE* pSrc, int32_t SrcPitch,
+		uint32_t Width, uint32_t Height,
+		OrientationType Orientation
+	)
+	{
+		if (Orientation != OrientationType::Normal && Orientation != OrientationType::FlipV)
+		{
+			return OrientImage(FrameBuffer, DecodeRow_YUV<RFT>, pSrc, SrcPitch, Height, FrameRegion{ 0, 0, Width, Height }, Orientation);
+		}
+		ConvertFrameRegion<RFT, RGBA8Traits>(reinterpret_cast<uint8_t*>(FrameBuffer.GetBitmapDataPtr()), FrameBuffer.GetPitch(), pSrc, SrcPitch, Height, 0, 0, Width, Height, Orientation == OrientationType::FlipV);
+	}
+
+	//-------------------------------------------------------------------
+	// ScaleImage_Box / ScaleImage_Bilinear
+	//
+	// Generic scaling converters on top of a row decoder. The target
+	// size is the size of `FrameBuffer` before it is oriented.
+	//-------------------------------------------------------------------
+
+	static void ScaleImage_Box
+	(
+		Image_RGBA8& FrameBuffer,
+		RowDecoderFuncType DecodeRow,
+		const BYTE* pSrc, int32_t SrcPitch,
+		uint32_t SrcHeight, const FrameRegion& Region,
+		OrientationType Orientation
+	)
+	{
+		uint32_t DstWidth, DstHeight;
+		GetOrientedSize(FrameBuffer, Orientation, DstWidth, DstHeight);
+		uint32_t SrcWidth = Region.Width;
+
+		// 回调线程固定，缓冲区按线程复用，避免每帧分配内存
+		thread_local std::vector<uint32_t> SpanX;
+		thread_local std::vector<uint32_t> Acc;
+		thread_local std::vector<Pixel_RGBA8> Row;
+		SpanX.resize(size_t(DstWidth) + 1);
+		Acc.resize(size_t(DstWidth) * 4);
+		Row.resize(SrcWidth);
+
+		for (uint32_t x = 0; x <= DstWidth; x++)
+		{
+			SpanX[x] = uint32_t(uint64_t(x) * SrcWidth / DstWidth);
+		}
+
+		uint32_t DecodedY = UINT32_MAX;
+		for (uint32_t y = 0; y < DstHeight; y++)
+		{
+			uint32_t sy0 = uint32_t(uint64_t(y) * Region.Height / DstHeight);
+			uint32_t sy1 = uint32_t(uint64_t(y + 1) * Region.Height / DstHeight);
+			if (sy1 <= sy0) sy1 = sy0 + 1;
+
+			memset(&Acc[0], 0, Acc.size() * sizeof Acc[0]);
+			for (uint32_t sy = sy0; sy < sy1; sy++)
+			{
+				// 放大时相邻的目标行可能对应同一源行
+				if (sy != DecodedY)
+				{
+					DecodeRow(&Row[0], pSrc, SrcPitch, SrcHeight, Region.Y + sy, Region.X, SrcWidth);
+					DecodedY = sy;
+				}
+
+				for (uint32_t x = 0; x < DstWidth; x++)
+				{
+					uint32_t sx0 = SpanX[x];
+					uint32_t sx1 = SpanX[x + 1] > sx0 ? SpanX[x + 1] : sx0 + 1;
+					uint32_t* pAcc = &Acc[size_t(x) * 4];
+					for (uint32_t sx = sx0; sx < sx1; sx++)
+					{
+						pAcc[0] += Row[sx].R;
+						pAcc[1] += Row[sx].G;
+						pAcc[2] += Row[sx].B;
+						pAcc[3] += Row[sx].A;
+					}
+				}
+			}
+
+			ptrdiff_t Step;
+			auto pDestPel = GetOrientedRow(FrameBuffer, DstWidth, DstHeight, y, Orientation, Step);
+			for (uint32_t x = 0; x < DstWidth; x++)
+			{
+				uint32_t sx0 = SpanX[x];
+				uint32_t sx1 = SpanX[x + 1] > sx0 ? SpanX[x + 1] : sx0 + 1;
+				uint32_t Area = (sx1 - sx0) * (sy1 - sy0);
+				const uint32_t* pAcc = &Acc[size_t(x) * 4];
+				pDestPel[ptrdiff_t(x) * Step] = Pixel_RGBA8(
+					uint8_t((pAcc[0] + Area / 2) / Area),
+					uint8_t((pAcc[1] + Area / 2) / Area),
+					uint8_t((pAcc[2] + Area / 2) / Area),
+					uint8_t((pAcc[3] + Area / 2) / Area)
+				);
+			}
+		}
+	}
+
+	static void ScaleImage_Bilinear
+	(
+		Image_RGBA8& FrameBuffer,
+		RowDecoderFuncType DecodeRow,
+		const BYTE* pSrc, int32_t SrcPitch,
+		uint32_t SrcHeight, const FrameRegion& Region,
+		OrientationType Orientation
+	)
+	{
+		uint32_t DstWidth, DstHeight;
+		GetOrientedSize(FrameBuffer, Orientation, DstWidth, DstHeight);
+		uint32_t SrcWidth = Region.Width;
+
+		// 采样点按像素中心对齐，权重为 8 位定点数
+		auto GetSample = [](uint32_t d, uint32_t SrcSize, uint32_t DstSize, uint32_t& i0, uint32_t& i1, uint32_t& w)
+		{
+			int64_t f = (int64_t(2 * d + 1) * SrcSize * 256) / (int64_t(2) * DstSize) - 128;
+			if (f < 0) f = 0;
+			i0 = uint32_t(f >> 8);
+			w = uint32_t(f & 255);
+			if (i0 >= SrcSize - 1)
+			{
+				i0 = SrcSize - 1;
+				w = 0;
+			}
+			i1 = i0 + (w ? 1 : 0);
+		};
+
+		thread_local std::vector<uint32_t> SampleX;
+		thread_local std::vector<Pixel_RGBA8> Row0, Row1;
+		SampleX.resize(size_t(DstWidth) * 3);
+		Row0.resize(SrcWidth);
+		Row1.resize(SrcWidth);
+
+		for (uint32_t x = 0; x < DstWidth; x++)
+		{
+			GetSample(x, SrcWidth, DstWidth, SampleX[x * 3 + 0], SampleX[x * 3 + 1], SampleX[x * 3 + 2]);
+		}
+
+		uint32_t Row0Y = UINT32_MAX, Row1Y = UINT32_MAX;
+		for (uint32_t y = 0; y < DstHeight; y++)
 		{
-			auto pDestPel = FrameBuffer.GetBitmapRowPtr(y);
-			uint16_t* pSrcPel = (uint16_t*)(pSrc + y * SrcPitch);
+			uint32_t iy0, iy1, wy;
+			GetSample(y, Region.Height, DstHeight, iy0, iy1, wy);
+
+			// 下移一行时复用上次解码的行
+			if (Row0Y != iy0)
+			{
+				if (Row1Y == iy0)
+				{
+					std::swap(Row0, Row1);
+					std::swap(Row0Y, Row1Y);
+				}
+				else
+				{
+					DecodeRow(&Row0[0], pSrc, SrcPitch, SrcHeight, Region.Y + iy0, Region.X, SrcWidth);
+					Row0Y = iy0;
+				}
+			}
+			if (Row1Y != iy1 && iy1 != iy0)
+			{
+				DecodeRow(&Row1[0], pSrc, SrcPitch, SrcHeight, Region.Y + iy1, Region.X, SrcWidth);
+				Row1Y = iy1;
+			}
+			const Pixel_RGBA8* pTop = &Row0[0];
+			const Pixel_RGBA8* pBottom = iy1 != iy0 ? &Row1[0] : &Row0[0];
 
-			for (int x = 0; x < int(Width); x += 2)
+			ptrdiff_t Step;
+			auto pDestPel = GetOrientedRow(FrameBuffer, DstWidth, DstHeight, y, Orientation, Step);
+			for (uint32_t x = 0; x < DstWidth; x++)
 			{
-				// Byte order is U0 Y0 V0 Y1
+				uint32_t ix0 = SampleX[x * 3 + 0];
+				uint32_t ix1 = SampleX[x * 3 + 1];
+				uint32_t wx = SampleX[x * 3 + 2];
+				auto Lerp = [wx, wy](uint32_t c00, uint32_t c01, uint32_t c10, uint32_t c11)
+				{
+					uint32_t t = c00 * (256 - wx) + c01 * wx;
+					uint32_t b = c10 * (256 - wx) + c11 * wx;
+					return uint8_t((t * (256 - wy) + b * wy + 32768) >> 16);
+				};
+				pDestPel[ptrdiff_t(x) * Step] = Pixel_RGBA8(
+					Lerp(pTop[ix0].R, pTop[ix1].R, pBottom[ix0].R, pBottom[ix1].R),
+					Lerp(pTop[ix0].G, pTop[ix1].G, pBottom[ix0].G, pBottom[ix1].G),
+					Lerp(pTop[ix0].B, pTop[ix1].B, pBottom[ix0].B, pBottom[ix1].B),
+					Lerp(pTop[ix0].A, pTop[ix1].A, pBottom[ix0].A, pBottom[ix1].A)
+				);
+			}
+		}
+	}
+
+	static void ScaleImage
+	(
+		Image_RGBA8& FrameBuffer,
+		RowDecoderFuncType DecodeRow,
+		const BYTE* pSrc, int32_t SrcPitch,
+		uint32_t SrcHeight, const FrameRegion& Region,
+		OrientationType Orientation,
+		ScaleFilterType Filter
+	)
+	{
+		switch (Filter)
+		{
+		default:
+		case ScaleFilterType::Box: return ScaleImage_Box(FrameBuffer, DecodeRow, pSrc, SrcPitch, SrcHeight, Region, Orientation);
+		case ScaleFilterType::Bilinear: return ScaleImage_Bilinear(FrameBuffer, DecodeRow, pSrc, SrcPitch, SrcHeight, Region, Orientation);
+		}
+	}
+
+	static bool IsScaleRatio(const Image_RGBA8& FrameBuffer, const FrameRegion& Region, OrientationType Orientation, uint32_t Ratio)
+	{
+		uint32_t DstWidth, DstHeight;
+		GetOrientedSize(FrameBuffer, Orientation, DstWidth, DstHeight);
+		return DstWidth * Ratio == Region.Width && DstHeight * Ratio == Region.Height;
+	}
+
+	//-------------------------------------------------------------------
+	// ScaleImageBox_YUV
+	//
+	// Integer-ratio box filter that averages in YUV and converts once
+	// per output pixel. For 4:2:0 formats at 2x the chroma planes
+	// already have the target resolution, so they are used directly.
+	//-------------------------------------------------------------------
 
-				int y0 = (int)LOBYTE(pSrcPel[x + 0]);
-				int u0 = (int)HIBYTE(pSrcPel[x + 0]);
-				int y1 = (int)LOBYTE(pSrcPel[x + 1]);
-				int v0 = (int)HIBYTE(pSrcPel[x + 1]);
+	template<RawFrameType RFT, uint32_t N>
+	static void ScaleImageBox_YUV(Image_RGBA8& FrameBuffer, const BYTE* pSrc, int32_t SrcPitch, uint32_t SrcHeight, const FrameRegion& Region, OrientationType Orientation)
+	{
+		using Traits = RawFrameTraits<RFT>;
+		constexpr uint32_t CW = N / Traits::SubsampleX;
+		constexpr uint32_t CH = N / Traits::SubsampleY;
+		constexpr uint32_t AreaY = N * N;
+		constexpr uint32_t AreaC = CW * CH;
+		const BYTE* lpBitsY = pSrc + ptrdiff_t(Region.Y) * SrcPitch + size_t(Region.X) * Traits::BytesPerPixel;
+		ChromaPlanesType Chroma{};
+		if constexpr (Traits::NumPlanes > 1) Chroma = Traits::OffsetChroma(Traits::GetChromaPlanes(pSrc, SrcPitch, SrcHeight), Region.X, Region.Y);
+		uint32_t DstWidth, DstHeight;
+		GetOrientedSize(FrameBuffer, Orientation, DstWidth, DstHeight);
 
-				pDestPel[x + 0] = ConvertYCrCbToRGB(y0, v0, u0);
-				pDestPel[x + 1] = ConvertYCrCbToRGB(y1, v0, u0);
+// #pragma omp parallel for
+		for (int y = 0; y < int(DstHeight); y++)
+		{
+			ptrdiff_t Step;
+			auto pDestPel = GetOrientedRow(FrameBuffer, DstWidth, DstHeight, y, Orientation, Step);
+			for (uint32_t x = 0; x < DstWidth; x++)
+			{
+				uint32_t SumY = 0, SumCb = 0, SumCr = 0;
+				if constexpr (Traits::NumPlanes == 1)
+				{
+					for (uint32_t j = 0; j < N; j++)
+					{
+						const BYTE* pPair = lpBitsY + ptrdiff_t(y * N + j) * SrcPitch + size_t(x) * N * 2;
+						for (uint32_t i = 0; i < CW; i++)
+						{
+							SumY += pPair[i * 4 + Traits::OffY0] + pPair[i * 4 + Traits::OffY1];
+							SumCb += pPair[i * 4 + Traits::OffU];
+							SumCr += pPair[i * 4 + Traits::OffV];
+						}
+					}
+				}
+				else
+				{
+					for (uint32_t j = 0; j < N; j++)
+					{
+						const BYTE* lpLineY = lpBitsY + ptrdiff_t(y * N + j) * SrcPitch + size_t(x) * N;
+						for (uint32_t i = 0; i < N; i++) SumY += lpLineY[i];
+					}
+					for (uint32_t j = 0; j < CH; j++)
+					{
+						ptrdiff_t Offset = ptrdiff_t(y * CH + j) * Chroma.Pitch + ptrdiff_t(x) * CW * Traits::ChromaStep;
+						for (uint32_t i = 0; i < CW; i++)
+						{
+							SumCb += Chroma.pCb[Offset + i * Traits::ChromaStep];
+							SumCr += Chroma.pCr[Offset + i * Traits::ChromaStep];
+						}
+					}
+				}
+				pDestPel[ptrdiff_t(x) * Step] = ConvertYUVToRGBA8(
+					uint8_t((SumY + AreaY / 2) / AreaY),
+					uint8_t((SumCb + AreaC / 2) / AreaC),
+					uint8_t((SumCr + AreaC / 2) / AreaC));
 			}
 		}
 	}
 
 	//-------------------------------------------------------------------
-	// TransformImage_NV12
+	// TransformImageRegion_*
 	//
-	// NV12 to RGB-32
+	// Convert only `Region` of the source into `FrameBuffer`, which has
+	// the size of the region. Regions aligned to the chroma subsampling
+	// go through the regular kernels, others are decoded per pixel.
 	//-------------------------------------------------------------------
 
-	void TransformImage_NV12
+	void TransformImageRegion_RGB32
 	(
 		Image_RGBA8& FrameBuffer,
 		const BYTE* pSrc, int32_t SrcPitch,
-		uint32_t Width, uint32_t Height
+		uint32_t SrcWidth, uint32_t SrcHeight,
+		const FrameRegion& Region,
+		OrientationType Orientation
 	)
 	{
-		const BYTE* lpBitsY = pSrc;
-		const BYTE* lpBitsCb = lpBitsY + (Height * SrcPitch);
-		const BYTE* lpBitsCr = lpBitsCb + 1;
+		TransformImage_RGB32(FrameBuffer, pSrc + ptrdiff_t(Region.Y) * SrcPitch + size_t(Region.X) * 4, SrcPitch, Region.Width, Region.Height, Orientation);
+	}
 
-// #pragma omp parallel for
-		for (int y = 0; y < int(Height); y += 2)
+	void TransformImageRegion_RGB24
+	(
+		Image_RGBA8& FrameBuffer,
+		const BYTE* pSrc, int32_t SrcPitch,
+		uint32_t SrcWidth, uint32_t SrcHeight,
+		const FrameRegion& Region,
+		OrientationType Orientation
+	)
+	{
+		TransformImage_RGB24(FrameBuffer, pSrc + ptrdiff_t(Region.Y) * SrcPitch + size_t(Region.X) * 3, SrcPitch, Region.Width, Region.Height, Orientation);
+	}
+
+	void TransformImageRegion_Y8
+	(
+		Image_RGBA8& FrameBuffer,
+		const BYTE* pSrc, int32_t SrcPitch,
+		uint32_t SrcWidth, uint32_t SrcHeight,
+		const FrameRegion& Region,
+		OrientationType Orientation
+	)
+	{
+		TransformImage_Y8(FrameBuffer, pSrc + ptrdiff_t(Region.Y) * SrcPitch + Region.X, SrcPitch, Region.Width, Region.Height, Orientation);
+	}
+
+	template<RawFrameType RFT>
+	void TransformImageRegion_YUV
+	(
+		Image_RGBA8& FrameBuffer,
+		const BYTE* pSrc, int32_t SrcPitch,
+		uint32_t SrcWidth, uint32_t SrcHeight,
+		const FrameRegion& Region,
+		OrientationType Orientation
+	)
+	{
+		using Traits = RawFrameTraits<RFT>;
+		if (((Region.X | Region.Width) % Traits::SubsampleX) || ((Region.Y | Region.Height) % Traits::SubsampleY) ||
+			(Orientation != OrientationType::Normal && Orientation != OrientationType::FlipV))
+		{
+			return OrientImage(FrameBuffer, DecodeRow_YUV<RFT>, pSrc, SrcPitch, SrcHeight, Region, Orientation);
+		}
+		ConvertFrameRegion<RFT, RGBA8Traits>(reinterpret_cast<uint8_t*>(FrameBuffer.GetBitmapDataPtr()), FrameBuffer.GetPitch(), pSrc, SrcPitch, SrcHeight, Region.X, Region.Y, Region.Width, Region.Height, Orientation == OrientationType::FlipV);
+	}
+
+	FrameRegion AlignRegionToSubsampling(RawFrameType RFT, const FrameRegion& Region, uint32_t SrcWidth, uint32_t SrcHeight)
+	{
+		if (!Region.Width || !Region.Height) return FrameRegion{ 0, 0, SrcWidth, SrcHeight };
+
+		uint32_t AlignX = 1, AlignY = 1;
+		switch (RFT)
 		{
-			const BYTE* lpLineY1 = lpBitsY + SrcPitch * (y + 0);
-			const BYTE* lpLineY2 = lpBitsY + SrcPitch * (y + 1);
-			const BYTE* lpLineCb = lpBitsCb + (y >> 1) * SrcPitch;
-			const BYTE* lpLineCr = lpBitsCr + (y >> 1) * SrcPitch;
+		case RawFrameType::YUY2:
+		case RawFrameType::UYVY:
+		case RawFrameType::YVYU:
+			AlignX = 2;
+			break;
+		case RawFrameType::NV12:
+		case RawFrameType::NV21:
+		case RawFrameType::I420:
+		case RawFrameType::YV12:
+		case RawFrameType::P010:
+			AlignX = 2;
+			AlignY = 2;
+			break;
+		default: break;
+		}
 
-			auto lpDibLine1 = FrameBuffer.GetBitmapRowPtr(y + 0);
-			auto lpDibLine2 = FrameBuffer.GetBitmapRowPtr(y + 1);
+		uint64_t Left = Region.X;
+		uint64_t Top = Region.Y;
+		uint64_t Right = uint64_t(Region.X) + Region.Width;
+		uint64_t Bottom = uint64_t(Region.Y) + Region.Height;
+		if (Right > SrcWidth) Right = SrcWidth;
+		if (Bottom > SrcHeight) Bottom = SrcHeight;
+		if (Left >= Right || Top >= Bottom) throw SetupFrameBufferFailed("The region of interest is outside of the frame.");
+
+		// 一组色度样本不能被区域边界切开
+		Left -= Left % AlignX;
+		Top -= Top % AlignY;
+		Right += (AlignX - Right % AlignX) % AlignX;
+		Bottom += (AlignY - Bottom % AlignY) % AlignY;
+		if (Right > SrcWidth) Right = SrcWidth;
+		if (Bottom > SrcHeight) Bottom = SrcHeight;
+
+		return FrameRegion{ uint32_t(Left), uint32_t(Top), uint32_t(Right - Left), uint32_t(Bottom - Top) };
+	}
 
-			for (int x = 0; x < int(Width); x += 2)
-			{
-				int  y0 = (int)lpLineY1[0];
-				int  y1 = (int)lpLineY1[1];
-				int  y2 = (int)lpLineY2[0];
-				int  y3 = (int)lpLineY2[1];
-				int  cb = (int)lpLineCb[0];
-				int  cr = (int)lpLineCr[0];
-
-				lpDibLine1[x + 0] = ConvertYCrCbToRGB(y0, cr, cb);
-				lpDibLine1[x + 1] = ConvertYCrCbToRGB(y1, cr, cb);
-				lpDibLine2[x + 0] = ConvertYCrCbToRGB(y2, cr, cb);
-				lpDibLine2[x + 1] = ConvertYCrCbToRGB(y3, cr, cb);
-
-				lpLineY1 += 2;
-				lpLineY2 += 2;
-				lpLineCr += 2;
-				lpLineCb += 2;
-			}
+	std::shared_ptr<Image_RGBA8> ConvertRegion(RawFrameType RFT, const BYTE* pSrc, int32_t SrcPitch, uint32_t SrcWidth, uint32_t SrcHeight, const FrameRegion& Region, OrientationType Orientation)
+	{
+		if (!Region.Width || !Region.Height ||
+			uint64_t(Region.X) + Region.Width > SrcWidth ||
+			uint64_t(Region.Y) + Region.Height > SrcHeight)
+		{
+			throw SetupFrameBufferFailed("`ConvertRegion()`: the region is empty or outside of the frame.");
+		}
+		if (size_t(RFT) >= NumRawFrameTypes || !VideoFormatRegionConverters[size_t(RFT)])
+		{
+			throw SetupFrameBufferFailed(std::string("`ConvertRegion()`: unsupported raw frame type `") + WebCamTypeInternal::GetRawFrameTypeStr(RFT) + "`.");
+		}
+		bool Transposed = IsOrientationTransposed(Orientation);
+		auto Ret = std::make_shared<Image_RGBA8>(
+			Transposed ? Region.Height : Region.Width,
+			Transposed ? Region.Width : Region.Height,
+			Pixel_RGBA8(0, 0, 0, 255));
+		VideoFormatRegionConverters[size_t(RFT)](*Ret, pSrc, SrcPitch, SrcWidth, SrcHeight, Region, Orientation);
+		return Ret;
+	}
+
+	//-------------------------------------------------------------------
+	// TransformImageScaled_*
+	//
+	// Convert `Region` of the source and scale it to the size of
+	// `FrameBuffer` in one pass.
+	//-------------------------------------------------------------------
+
+	void TransformImageScaled_RGB32
+	(
+		Image_RGBA8& FrameBuffer,
+		const BYTE* pSrc, int32_t SrcPitch,
+		uint32_t SrcWidth, uint32_t SrcHeight,
+		const FrameRegion& Region,
+		OrientationType Orientation,
+		ScaleFilterType Filter
+	)
+	{
+		ScaleImage(FrameBuffer, DecodeRow_RGB32, pSrc, SrcPitch, SrcHeight, Region, Orientation, Filter);
+	}
+
+	void TransformImageScaled_RGB24
+	(
+		Image_RGBA8& FrameBuffer,
+		const BYTE* pSrc, int32_t SrcPitch,
+		uint32_t SrcWidth, uint32_t SrcHeight,
+		const FrameRegion& Region,
+		OrientationType Orientation,
+		ScaleFilterType Filter
+	)
+	{
+		ScaleImage(FrameBuffer, DecodeRow_RGB24, pSrc, SrcPitch, SrcHeight, Region, Orientation, Filter);
+	}
+
+	void TransformImageScaled_Y8
+	(
+		Image_RGBA8& FrameBuffer,
+		const BYTE* pSrc, int32_t SrcPitch,
+		uint32_t SrcWidth, uint32_t SrcHeight,
+		const FrameRegion& Region,
+		OrientationType Orientation,
+		ScaleFilterType Filter
+	)
+	{
+		ScaleImage(FrameBuffer, DecodeRow_Y8, pSrc, SrcPitch, SrcHeight, Region, Orientation, Filter);
+	}
+
+	template<RawFrameType RFT>
+	void TransformImageScaled_YUV
+	(
+		Image_RGBA8& FrameBuffer,
+		const BYTE* pSrc, int32_t SrcPitch,
+		uint32_t SrcWidth, uint32_t SrcHeight,
+		const FrameRegion& Region,
+		OrientationType Orientation,
+		ScaleFilterType Filter
+	)
+	{
+		using Traits = RawFrameTraits<RFT>;
+		if (Filter == ScaleFilterType::Box && !(Region.X % Traits::SubsampleX) && !(Region.Y % Traits::SubsampleY))
+		{
+			if (IsScaleRatio(FrameBuffer, Region, Orientation, 2)) return ScaleImageBox_YUV<RFT, 2>(FrameBuffer, pSrc, SrcPitch, SrcHeight, Region, Orientation);
+			if (IsScaleRatio(FrameBuffer, Region, Orientation, 4)) return ScaleImageBox_YUV<RFT, 4>(FrameBuffer, pSrc, SrcPitch, SrcHeight, Region, Orientation);
+			if (IsScaleRatio(FrameBuffer, Region, Orientation, 8)) return ScaleImageBox_YUV<RFT, 8>(FrameBuffer, pSrc, SrcPitch, SrcHeight, Region, Orientation);
 		}
+		ScaleImage(FrameBuffer, DecodeRow_YUV<RFT>, pSrc, SrcPitch, SrcHeight, Region, Orientation, Filter);
 	}
+
+	// 函数表在 imfcb.hpp 里，各 YUV 格式的转换函数在这里实例化
+	template void TransformImage_YUV<RawFrameType::YUY2>(Image_RGBA8&, const BYTE*, int32_t, uint32_t, uint32_t, OrientationType);
+	template void TransformImage_YUV<RawFrameType::UYVY>(Image_RGBA8&, const BYTE*, int32_t, uint32_t, uint32_t, OrientationType);
+	template void TransformImage_YUV<RawFrameType::YVYU>(Image_RGBA8&, const BYTE*, int32_t, uint32_t, uint32_t, OrientationType);
+	template void TransformImage_YUV<RawFrameType::NV12>(Image_RGBA8&, const BYTE*, int32_t, uint32_t, uint32_t, OrientationType);
+	template void TransformImage_YUV<RawFrameType::NV21>(Image_RGBA8&, const BYTE*, int32_t, uint32_t, uint32_t, OrientationType);
+	template void TransformImage_YUV<RawFrameType::I420>(Image_RGBA8&, const BYTE*, int32_t, uint32_t, uint32_t, OrientationType);
+	template void TransformImage_YUV<RawFrameType::YV12>(Image_RGBA8&, const BYTE*, int32_t, uint32_t, uint32_t, OrientationType);
+
+	template void TransformImageRegion_YUV<RawFrameType::YUY2>(Image_RGBA8&, const BYTE*, int32_t, uint32_t, uint32_t, const FrameRegion&, OrientationType);
+	template void TransformImageRegion_YUV<RawFrameType::UYVY>(Image_RGBA8&, const BYTE*, int32_t, uint32_t, uint32_t, const FrameRegion&, OrientationType);
+	template void TransformImageRegion_YUV<RawFrameType::YVYU>(Image_RGBA8&, const BYTE*, int32_t, uint32_t, uint32_t, const FrameRegion&, OrientationType);
+	template void TransformImageRegion_YUV<RawFrameType::NV12>(Image_RGBA8&, const BYTE*, int32_t, uint32_t, uint32_t, const FrameRegion&, OrientationType);
+	template void TransformImageRegion_YUV<RawFrameType::NV21>(Image_RGBA8&, const BYTE*, int32_t, uint32_t, uint32_t, const FrameRegion&, OrientationType);
+	template void TransformImageRegion_YUV<RawFrameType::I420>(Image_RGBA8&, const BYTE*, int32_t, uint32_t, uint32_t, const FrameRegion&, OrientationType);
+	template void TransformImageRegion_YUV<RawFrameType::YV12>(Image_RGBA8&, const BYTE*, int32_t, uint32_t, uint32_t, const FrameRegion&, OrientationType);
+
+	template void TransformImageScaled_YUV<RawFrameType::YUY2>(Image_RGBA8&, const BYTE*, int32_t, uint32_t, uint32_t, const FrameRegion&, OrientationType, ScaleFilterType);
+	template void TransformImageScaled_YUV<RawFrameType::UYVY>(Image_RGBA8&, const BYTE*, int32_t, uint32_t, uint32_t, const FrameRegion&, OrientationType, ScaleFilterType);
+	template void TransformImageScaled_YUV<RawFrameType::YVYU>(Image_RGBA8&, const BYTE*, int32_t, uint32_t, uint32_t, const FrameRegion&, OrientationType, ScaleFilterType);
+	template void TransformImageScaled_YUV<RawFrameType::NV12>(Image_RGBA8&, const BYTE*, int32_t, uint32_t, uint32_t, const FrameRegion&, OrientationType, ScaleFilterType);
+	template void TransformImageScaled_YUV<RawFrameType::NV21>(Image_RGBA8&, const BYTE*, int32_t, uint32_t, uint32_t, const FrameRegion&, OrientationType, ScaleFilterType);
+	template void TransformImageScaled_YUV<RawFrameType::I420>(Image_RGBA8&, const BYTE*, int32_t, uint32_t, uint32_t, const FrameRegion&, OrientationType, ScaleFilterType);
+	template void TransformImageScaled_YUV<RawFrameType::YV12>(Image_RGBA8&, const BYTE*, int32_t, uint32_t, uint32_t, const FrameRegion&, OrientationType, ScaleFilterType);
 }
@@ -1,6 +1,12 @@
 ﻿#pragma once
 
 #include "comptr.hpp"
+#include "webcam.hpp"
+#include "pixfmt.hpp"
+#include "jpegdec.hpp"
+#include "mjpgsink.hpp"
+#include "rawrec.hpp"
+#include "devreg.hpp"
 
 #include <unibmp/unibmp.hpp>
 
@@ -14,6 +20,8 @@
 
 #include <unordered_map>
 #include <mutex>
+#include <thread>
+#include <future>
 
 namespace WindowsWebCamTypeLib
 {
@@ -43,30 +51,174 @@ namespace WindowsWebCamTypeLib
 		FetchFrameFailed(const std::string& what) noexcept;
 	};
 
-	enum class RawFrameType
-	{
-		Unknown,
-		RGB32,
-		RGB24,
-		YUY2,
-		NV12
-	};
-
 	class WebCamTypeInternal;
 	using OnFrameCBInternalType = void (*)(void* Userdata, WebCamTypeInternal& wc, bool FrameUpdated);
+	using FrameDispatchCBInternalType = void (*)(void* Userdata, WebCamTypeInternal& wc);
+
+	using ConverterFuncType = void(*)(Image_RGBA8& FrameBuffer, const BYTE* pSrc, int32_t SrcPitch, uint32_t Width, uint32_t Height, OrientationType Orientation);
+	void TransformImage_RGB32(Image_RGBA8& FrameBuffer, const BYTE* pSrc, int32_t SrcPitch, uint32_t Width, uint32_t Height, OrientationType Orientation);
+	void TransformImage_RGB24(Image_RGBA8& FrameBuffer, const BYTE* pSrc, int32_t SrcPitch, uint32_t Width, uint32_t Height, OrientationType Orientation);
+	void TransformImage_Y8(Image_RGBA8& FrameBuffer, const BYTE* pSrc, int32_t SrcPitch, uint32_t Width, uint32_t Height, OrientationType Orientation);
+
+	// 所有的 YUV 格式共用一套转换函数，按格式实例化，字节顺序和平面顺序来自 `RawFrameTraits`
+	template<RawFrameType RFT> void TransformImage_YUV(Image_RGBA8& FrameBuffer, const BYTE* pSrc, int32_t SrcPitch, uint32_t Width, uint32_t Height, OrientationType Orientation);
+
+	// 所有转换函数在写入帧缓冲区的同时完成翻转或旋转，`FrameBuffer` 的尺寸是旋转后的尺寸
+	bool IsOrientationTransposed(OrientationType Orientation);
+
+	// 只转换源图像中 `Region` 区域，`FrameBuffer` 的尺寸与区域相同
+	using RegionConverterFuncType = void(*)(Image_RGBA8& FrameBuffer, const BYTE* pSrc, int32_t SrcPitch, uint32_t SrcWidth, uint32_t SrcHeight, const FrameRegion& Region, OrientationType Orientation);
+	void TransformImageRegion_RGB32(Image_RGBA8& FrameBuffer, const BYTE* pSrc, int32_t SrcPitch, uint32_t SrcWidth, uint32_t SrcHeight, const FrameRegion& Region, OrientationType Orientation);
+	void TransformImageRegion_RGB24(Image_RGBA8& FrameBuffer, const BYTE* pSrc, int32_t SrcPitch, uint32_t SrcWidth, uint32_t SrcHeight, const FrameRegion& Region, OrientationType Orientation);
+	void TransformImageRegion_Y8(Image_RGBA8& FrameBuffer, const BYTE* pSrc, int32_t SrcPitch, uint32_t SrcWidth, uint32_t SrcHeight, const FrameRegion& Region, OrientationType Orientation);
+	template<RawFrameType RFT> void TransformImageRegion_YUV(Image_RGBA8& FrameBuffer, const BYTE* pSrc, int32_t SrcPitch, uint32_t SrcWidth, uint32_t SrcHeight, const FrameRegion& Region, OrientationType Orientation);
+
+	// 转换源图像中 `Region` 区域的同时缩放到 `FrameBuffer` 的尺寸，不产生全分辨率的中间图像
+	using ScaledConverterFuncType = void(*)(Image_RGBA8& FrameBuffer, const BYTE* pSrc, int32_t SrcPitch, uint32_t SrcWidth, uint32_t SrcHeight, const FrameRegion& Region, OrientationType Orientation, ScaleFilterType Filter);
+	void TransformImageScaled_RGB32(Image_RGBA8& FrameBuffer, const BYTE* pSrc, int32_t SrcPitch, uint32_t SrcWidth, uint32_t SrcHeight, const FrameRegion& Region, OrientationType Orientation, ScaleFilterType Filter);
+	void TransformImageScaled_RGB24(Image_RGBA8& FrameBuffer, const BYTE* pSrc, int32_t SrcPitch, uint32_t SrcWidth, uint32_t SrcHeight, const FrameRegion& Region, OrientationType Orientation, ScaleFilterType Filter);
+	void TransformImageScaled_Y8(Image_RGBA8& FrameBuffer, const BYTE* pSrc, int32_t SrcPitch, uint32_t SrcWidth, uint32_t SrcHeight, const FrameRegion& Region, OrientationType Orientation, ScaleFilterType Filter);
+	template<RawFrameType RFT> void TransformImageScaled_YUV(Image_RGBA8& FrameBuffer, const BYTE* pSrc, int32_t SrcPitch, uint32_t SrcWidth, uint32_t SrcHeight, const FrameRegion& Region, OrientationType Orientation, ScaleFilterType Filter);
+
+	// 压缩格式解码后、高位深格式色调映射后所用的转换函数对应的格式
+	inline constexpr RawFrameType GetConverterRawFrameType(RawFrameType RFT)
+	{
+		return RFT == RawFrameType::MJPG ? RawFrameType::RGB32 : GetToneMappedRawFrameType(RFT);
+	}
 
-	using ConverterFuncType = void(*)(Image_RGBA8& FrameBuffer, const BYTE* pSrc, int32_t SrcPitch, uint32_t Width, uint32_t Height);
-	void TransformImage_RGB32(Image_RGBA8& FrameBuffer, const BYTE* pSrc, int32_t SrcPitch, uint32_t Width, uint32_t Height);
-	void TransformImage_RGB24(Image_RGBA8& FrameBuffer, const BYTE* pSrc, int32_t SrcPitch, uint32_t Width, uint32_t Height);
-	void TransformImage_YUY2(Image_RGBA8& FrameBuffer, const BYTE* pSrc, int32_t SrcPitch, uint32_t Width, uint32_t Height);
-	void TransformImage_NV12(Image_RGBA8& FrameBuffer, const BYTE* pSrc, int32_t SrcPitch, uint32_t Width, uint32_t Height);
+	// 把区域向外扩展到色度采样的边界并裁剪到图像内，区域为空时返回整幅图像
+	FrameRegion AlignRegionToSubsampling(RawFrameType RFT, const FrameRegion& Region, uint32_t SrcWidth, uint32_t SrcHeight);
+	std::shared_ptr<Image_RGBA8> ConvertRegion(RawFrameType RFT, const BYTE* pSrc, int32_t SrcPitch, uint32_t SrcWidth, uint32_t SrcHeight, const FrameRegion& Region, OrientationType Orientation = OrientationType::Normal);
 
 	struct GUID_Hash
 	{
 		size_t operator () (const GUID& g) const;
 	};
 
-	extern const std::unordered_map<GUID, ConverterFuncType, GUID_Hash> VideoFormatConverters;
+	// 转换函数表，按 `RawFrameType` 索引
+	inline constexpr ConverterFuncType VideoFormatConverters[NumRawFrameTypes] =
+	{
+		nullptr,
+		TransformImage_RGB32,
+		TransformImage_RGB24,
+		TransformImage_YUV<RawFrameType::YUY2>,
+		TransformImage_YUV<RawFrameType::NV12>,
+		TransformImage_YUV<RawFrameType::UYVY>,
+		TransformImage_YUV<RawFrameType::YVYU>,
+		TransformImage_YUV<RawFrameType::NV21>,
+		TransformImage_YUV<RawFrameType::I420>,
+		TransformImage_YUV<RawFrameType::YV12>,
+		TransformImage_Y8,
+		nullptr,
+		nullptr,
+		nullptr,
+	};
+
+	inline constexpr RegionConverterFuncType VideoFormatRegionConverters[NumRawFrameTypes] =
+	{
+		nullptr,
+		TransformImageRegion_RGB32,
+		TransformImageRegion_RGB24,
+		TransformImageRegion_YUV<RawFrameType::YUY2>,
+		TransformImageRegion_YUV<RawFrameType::NV12>,
+		TransformImageRegion_YUV<RawFrameType::UYVY>,
+		TransformImageRegion_YUV<RawFrameType::YVYU>,
+		TransformImageRegion_YUV<RawFrameType::NV21>,
+		TransformImageRegion_YUV<RawFrameType::I420>,
+		TransformImageRegion_YUV<RawFrameType::YV12>,
+		TransformImageRegion_Y8,
+		nullptr,
+		nullptr,
+		nullptr,
+	};
+
+	inline constexpr ScaledConverterFuncType VideoFormatScaledConverters[NumRawFrameTypes] =
+	{
+		nullptr,
+		TransformImageScaled_RGB32,
+		TransformImageScaled_RGB24,
+		TransformImageScaled_YUV<RawFrameType::YUY2>,
+		TransformImageScaled_YUV<RawFrameType::NV12>,
+		TransformImageScaled_YUV<RawFrameType::UYVY>,
+		TransformImageScaled_YUV<RawFrameType::YVYU>,
+		TransformImageScaled_YUV<RawFrameType::NV21>,
+		TransformImageScaled_YUV<RawFrameType::I420>,
+		TransformImageScaled_YUV<RawFrameType::YV12>,
+		TransformImageScaled_Y8,
+		nullptr,
+		nullptr,
+		nullptr,
+	};
+
+	// 非 `RGBA8` 输出格式的转换函数表，按 `OutputFormatType` 和 `RawFrameType` 索引
+	inline constexpr const RawRegionConverterFuncType* OutputFormatConverters[] =
+	{
+		RawFrameRegionConverters<RGBA8Traits>,
+		RawFrameRegionConverters<BGRA8Traits>,
+		RawFrameRegionConverters<RGB565Traits>,
+		RawFrameRegionConverters<Gray8Traits>,
+		RawFrameRegionConverters<RGBA16Traits>,
+		RawFrameRegionConverters<Gray16Traits>,
+		RawFrameRegionCopiers,
+	};
+
+	inline constexpr size_t OutputFormatBytesPerPixel[] =
+	{
+		RGBA8Traits::BytesPerPixel,
+		BGRA8Traits::BytesPerPixel,
+		RGB565Traits::BytesPerPixel,
+		Gray8Traits::BytesPerPixel,
+		RGBA16Traits::BytesPerPixel,
+		Gray16Traits::BytesPerPixel,
+		0,
+	};
+
+	// 16 位的输出格式直接从高位深的原始帧转换，不经过色调映射
+	inline constexpr uint32_t OutputFormatBitDepth[] =
+	{
+		RGBA8Traits::BitDepth,
+		BGRA8Traits::BitDepth,
+		RGB565Traits::BitDepth,
+		Gray8Traits::BitDepth,
+		RGBA16Traits::BitDepth,
+		Gray16Traits::BitDepth,
+		0,
+	};
+
+	// MJPG 帧直接解码到输出格式时使用的解码函数，按 `OutputFormatType` 索引
+	using JpegDecodeFuncType = bool(JpegDecoderType::*)(const uint8_t* pData, size_t Size, uint8_t* pDst, ptrdiff_t DstPitch, uint32_t DstWidth, uint32_t DstHeight, uint32_t ScaleDenom);
+
+	inline constexpr JpegDecodeFuncType JpegOutputDecoders[] =
+	{
+		&JpegDecoderType::Decode<RGBA8Traits>,
+		&JpegDecoderType::Decode<BGRA8Traits>,
+		&JpegDecoderType::Decode<RGB565Traits>,
+		&JpegDecoderType::Decode<Gray8Traits>,
+		nullptr,
+		nullptr,
+		nullptr,
+	};
+
+	// 把一帧转换到 RGBA8 帧缓冲区的相对开销（每像素，RGB32 为 1），用于选择媒体类型。
+	// 按转换时每个像素的读写量和运算量估计，MJPG 包括解码，P010、Y16 包括色调映射；可以用 `SetFormatCost()` 换成实测的数据
+	inline constexpr float RawFrameConversionCosts[NumRawFrameTypes] =
+	{
+		0.0f,
+		1.0f,
+		1.2f,
+		1.8f,
+		1.6f,
+		1.8f,
+		1.8f,
+		1.6f,
+		1.7f,
+		1.7f,
+		0.8f,
+		2.6f,
+		1.4f,
+		9.0f,
+	};
+
 	extern const std::unordered_map<GUID, RawFrameType, GUID_Hash> VideoFormatEnumMap;
 	extern const std::unordered_map<RawFrameType, GUID> VideoFormatToGUIDMap;
 
@@ -84,20 +236,108 @@ namespace WindowsWebCamTypeLib
 		~EnumeratedDevices();
 	};
 
+	// 用 `MFEnumDeviceSources()` 枚举，同时取得设备路径和名字
+	class MFDeviceEnumeratorType : public DeviceEnumeratorType
+	{
+	public:
+		DeviceListType Enumerate() override;
+	};
+
+	//-------------------------------------------------------------------
+	// DeviceChangeNotifierType
+	//
+	// Owns a thread with a message-only window registered for video
+	// capture device interface notifications. Every arrival or removal
+	// invalidates the registry, so the device list is enumerated again
+	// on the next request and never otherwise.
+	//-------------------------------------------------------------------
+
+	class DeviceChangeNotifierType
+	{
+	protected:
+		DeviceRegistryType& Registry;
+		std::thread Thread;
+		HWND Window = nullptr;
+
+		void ThreadProc(std::promise<HWND>& Ready);
+		static LRESULT CALLBACK WndProc(HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam);
+
+	public:
+		DeviceChangeNotifierType(DeviceRegistryType& Registry);
+		DeviceChangeNotifierType(const DeviceChangeNotifierType&) = delete;
+		DeviceChangeNotifierType& operator = (const DeviceChangeNotifierType&) = delete;
+		~DeviceChangeNotifierType();
+
+		bool IsRunning() const;
+	};
+
+	// 进程内共用的设备列表，只在设备插拔后重新枚举；收不到通知时每次都重新枚举
+	std::shared_ptr<const DeviceListType> GetCachedDevices();
+
 	class WebCamTypeInternal : public ::IMFSourceReaderCallback
 	{
 	protected:
 		COMPtr<IMFSourceReader> Reader = nullptr;
 		std::shared_ptr<std::mutex> Lock = std::make_shared<std::mutex>();
+
+		// 转换帧时持有，改变转换所用的状态时与 `Lock` 一起持有；采集线程只用 `Lock`，所以转换时不会阻塞采集
+		std::mutex ConvertLock;
 		RawFrameType CurRawFrameType = RawFrameType::Unknown;
 		uint32_t NumRef = 1;
 		bool FrameUpdated = false;
 		uint32_t SrcWidth = 0, SrcHeight = 0;
 		int32_t SrcPitch = 0;
+		uint32_t DstWidth = 0, DstHeight = 0;
+		ScaleFilterType ScaleFilter = ScaleFilterType::Box;
+		OrientationType Orientation = OrientationType::Normal;
+		FrameRegion RequestedRegion;
+		FrameRegion SrcRegion;
 		ConverterFuncType FormatConverter = nullptr;
+		RegionConverterFuncType RegionFormatConverter = nullptr;
+		ScaledConverterFuncType ScaledFormatConverter = nullptr;
+		OutputFormatType OutputFormat = OutputFormatType::RGBA8;
+		RawRegionConverterFuncType OutputConverter = nullptr;
+
+		// MJPG 帧在转换之前先解码；无法直接解码到输出缓冲区时，解码成 RGB32 格式放在 `JpegFrame` 里，再按 RGB32 转换
+		JpegDecoderType JpegDecoder;
+		uint32_t JpegScaleDenom = 1;
+		uint32_t JpegFrameWidth = 0, JpegFrameHeight = 0;
+		std::vector<uint8_t> JpegFrame;
+
+		// 录制时原样写入的 MJPG 帧；没有预览时只录制，不解码
+		std::unique_ptr<MotionJpegSinkType> Recorder;
+		bool PreviewEnabled = true;
+
+		// 录制未经转换的原始帧，任何格式都可以，中途换格式也不影响
+		std::unique_ptr<RawFrameRecorderType> RawRecorder;
+
+		// 高位深的帧转换到 8 位时先按窗口映射到 `ToneMappedFrame` 里，再按 NV12 或 Y8 转换
+		ToneMapping ToneMap;
+		bool ToneMapNeeded = false;
+		bool AutoWindowValid = false;
+		uint16_t AutoWindowLow = 0, AutoWindowHigh = 0;
+		uint16_t AppliedWindowLow = 0, AppliedWindowHigh = 0;
+		std::unique_ptr<ToneMapTableType> ToneMapTable = std::make_unique<ToneMapTableType>();
+		std::vector<uint8_t> ToneMappedFrame;
+		size_t ToneMappedPitch = 0;
+
+		// 设置了 `DispatchCB` 时，收到的帧只保留在 `PendingSample` 里，由 `ProcessPendingSample()` 在别的线程上解码和转换；
+		// 转换之前又收到新的帧时旧的帧被丢弃
+		FrameDispatchCBInternalType DispatchCB = nullptr;
+		void* DispatchUserdata = nullptr;
+		COMPtr<IMFSample> PendingSample = nullptr;
+		FrameTimestamp PendingTimestamp;
+
+		// 帧缓冲区里这一帧的时间戳
+		FrameTimestamp CurTimestamp;
 
 		void GetSrcPitch(IMFMediaType* Type, GUID& subtype, int32_t* SrcPitch);
 		void SetupFrameBuffer(IMFMediaType* Type);
+		void AllocFrameBuffer();
+		uint32_t ChooseJpegScaleDenom() const;
+		bool DecodeJpegSample(const BYTE* pData, DWORD Size, const BYTE*& pScanline0, int32_t& Pitch);
+		void ToneMapSample(const BYTE*& pScanline0, int32_t& Pitch);
+		void ConvertSample(IMFMediaBuffer* Buffer, BYTE* LockPtr, DWORD CurLength, const FrameTimestamp& Timestamp);
 
 	public:
 		WebCamTypeInternal(OnFrameCBInternalType OnFrameCB, void* Userdata, bool Verbose);
@@ -105,7 +345,13 @@ namespace WindowsWebCamTypeLib
 
 		RawFrameType PreferredRawFrameType = RawFrameType::Unknown;
 
+		// 原生媒体类型的列表，更换设备时清空；每种格式的转换开销可以由用户替换
+		std::vector<MediaTypeInfo> MediaTypes;
+		bool MediaTypesEnumerated = false;
+		float FormatCosts[NumRawFrameTypes];
+
 		std::shared_ptr<Image_RGBA8> FrameBuffer;
+		OutputFrame OutputBuffer;
 
 		STDMETHODIMP QueryInterface(const IID& riid, void** v) override;
 		STDMETHODIMP_(ULONG) AddRef() override;
@@ -136,6 +382,30 @@ namespace WindowsWebCamTypeLib
 		RawFrameType GetCurRawFrameType() const;
 		bool SetRawFrameType(RawFrameType RFT);
 		void SetNativeRawFrameType();
+		std::vector<MediaTypeInfo> GetMediaTypes();
+		bool SelectMediaType(const MediaTypeRequest& Request);
+		bool SetMediaType(uint32_t Index, float Fps = 0);
+		void SetFormatCost(const std::string& Format, float Cost);
+		void SetFrameBufferSize(uint32_t Width, uint32_t Height, ScaleFilterType Filter);
+		void SetRegionOfInterest(const FrameRegion& Region);
+		FrameRegion GetRegionOfInterest() const;
+		void SetOrientation(OrientationType Orientation);
+		OrientationType GetOrientation() const;
+		void SetOutputFormat(OutputFormatType Format);
+		OutputFormatType GetOutputFormat() const;
+		void StartRecording(const std::string& Path);
+		void StopRecording();
+		bool IsRecording() const;
+		void StartRawRecording(const std::string& Path);
+		void StopRawRecording();
+		bool IsRawRecording() const;
+		void SetPreviewEnabled(bool Enabled);
+		bool GetPreviewEnabled() const;
+		void SetToneMapping(const ToneMapping& Params);
+		ToneMapping GetToneMapping() const;
+		void SetFrameDispatcher(FrameDispatchCBInternalType DispatchCB, void* Userdata);
+		bool ProcessPendingSample();
+		FrameTimestamp GetFrameTimestamp() const;
 		std::string GetCurRawFrameTypeStr() const;
 
 		bool Verbose = false;
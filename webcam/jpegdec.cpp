@@ -0,0 +1,770 @@
+#include "jpegdec.hpp"
+
+#include <cstring>
+#include <cmath>
+
+namespace WindowsWebCamTypeLib
+{
+	DecodeJpegFailed::DecodeJpegFailed(const std::string& what) noexcept :
+		std::runtime_error(what)
+	{
+	}
+
+	// 之字形扫描顺序对应的自然顺序下标，多出的 16 项防止损坏的数据越界
+	static const uint8_t ZigZag[64 + 16] =
+	{
+		 0,  1,  8, 16,  9,  2,  3, 10,
+		17, 24, 32, 25, 18, 11,  4,  5,
+		12, 19, 26, 33, 40, 48, 41, 34,
+		27, 20, 13,  6,  7, 14, 21, 28,
+		35, 42, 49, 56, 57, 50, 43, 36,
+		29, 22, 15, 23, 30, 37, 44, 51,
+		58, 59, 52, 45, 38, 31, 39, 46,
+		53, 60, 61, 54, 47, 55, 62, 63,
+		63, 63, 63, 63, 63, 63, 63, 63,
+		63, 63, 63, 63, 63, 63, 63, 63,
+	};
+
+	//-------------------------------------------------------------------
+	// Default huffman tables
+	//
+	// The tables of the JPEG standard, Annex K.3. MJPG streams usually
+	// omit the DHT segment and rely on these.
+	//-------------------------------------------------------------------
+
+	static const uint8_t DefaultDCLumaBits[16] = { 0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0 };
+	static const uint8_t DefaultDCChromaBits[16] = { 0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0 };
+	static const uint8_t DefaultDCValues[12] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+
+	static const uint8_t DefaultACLumaBits[16] = { 0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7d };
+	static const uint8_t DefaultACLumaValues[162] =
+	{
+		0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07,
+		0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0,
+		0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28,
+		0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+		0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+		0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+		0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
+		0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5,
+		0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2,
+		0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8,
+		0xf9, 0xfa,
+	};
+
+	static const uint8_t DefaultACChromaBits[16] = { 0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 0x77 };
+	static const uint8_t DefaultACChromaValues[162] =
+	{
+		0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71,
+		0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0,
+		0x15, 0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26,
+		0x27, 0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+		0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+		0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+		0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5,
+		0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3,
+		0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda,
+		0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8,
+		0xf9, 0xfa,
+	};
+
+	struct DefaultHuffmanTablesType
+	{
+		JpegDecoderType::HuffmanTableType DC[2];
+		JpegDecoderType::HuffmanTableType AC[2];
+
+		DefaultHuffmanTablesType()
+		{
+			DC[0].Build(DefaultDCLumaBits, DefaultDCValues, sizeof DefaultDCValues);
+			DC[1].Build(DefaultDCChromaBits, DefaultDCValues, sizeof DefaultDCValues);
+			AC[0].Build(DefaultACLumaBits, DefaultACLumaValues, sizeof DefaultACLumaValues);
+			AC[1].Build(DefaultACChromaBits, DefaultACChromaValues, sizeof DefaultACChromaValues);
+		}
+	};
+
+	static const DefaultHuffmanTablesType& GetDefaultHuffmanTables()
+	{
+		static const DefaultHuffmanTablesType Tables;
+		return Tables;
+	}
+
+	void JpegDecoderType::HuffmanTableType::Build(const uint8_t* Bits, const uint8_t* Values, size_t NumValues)
+	{
+		size_t Total = 0;
+		for (int l = 0; l < 16; l++) Total += Bits[l];
+		if (Total > NumValues || Total > 256) throw DecodeJpegFailed("Bad huffman table.");
+
+		memset(Fast, 0, sizeof Fast);
+		int32_t Code = 0;
+		size_t k = 0;
+		for (int l = 1; l <= 16; l++)
+		{
+			ValOffset[l] = int32_t(k) - Code;
+			for (int i = 0; i < Bits[l - 1]; i++, k++, Code++)
+			{
+				if (Code >= (1 << l)) throw DecodeJpegFailed("Bad huffman table.");
+				// 短码直接填入快速查找表
+				if (l <= 9)
+				{
+					int32_t Base = Code << (9 - l);
+					for (int32_t j = 0; j < (1 << (9 - l)); j++)
+					{
+						Fast[Base + j] = uint16_t((l << 8) | Values[k]);
+					}
+				}
+			}
+			MaxCode[l] = Bits[l - 1] ? Code - 1 : -1;
+			Code <<= 1;
+		}
+		MaxCode[17] = INT32_MAX;
+		memcpy(Vals, Values, Total);
+		Defined = true;
+	}
+
+	//-------------------------------------------------------------------
+	// BitReaderType
+	//
+	// Reads the entropy-coded data of one segment MSB first, skipping
+	// the stuffed zero byte after 0xFF. Once a marker is reached only
+	// zero bits are returned, so damaged data cannot run past the end
+	// of the segment.
+	//-------------------------------------------------------------------
+
+	struct BitReaderType
+	{
+		const uint8_t* p;
+		const uint8_t* End;
+		uint32_t Acc = 0;
+		int32_t Count = 0;
+		bool Marker = false;
+		bool Error = false;
+
+		BitReaderType(const uint8_t* Begin, const uint8_t* End) :
+			p(Begin), End(End)
+		{
+		}
+
+		void Fill()
+		{
+			while (Count <= 24)
+			{
+				uint32_t b = 0;
+				if (!Marker && p < End)
+				{
+					b = *p++;
+					if (b == 0xFF)
+					{
+						if (p < End && *p == 0x00) p++;
+						else
+						{
+							Marker = true;
+							b = 0;
+						}
+					}
+				}
+				Acc |= b << (24 - Count);
+				Count += 8;
+			}
+		}
+
+		uint32_t GetBits(int n)
+		{
+			if (!n) return 0;
+			Fill();
+			uint32_t v = Acc >> (32 - n);
+			Acc <<= n;
+			Count -= n;
+			return v;
+		}
+
+		int32_t Receive(int s)
+		{
+			if (!s) return 0;
+			int32_t v = int32_t(GetBits(s));
+			if (v < (1 << (s - 1))) v = v - (1 << s) + 1;
+			return v;
+		}
+
+		int DecodeHuffman(const JpegDecoderType::HuffmanTableType& Table)
+		{
+			Fill();
+			uint32_t Entry = Table.Fast[Acc >> (32 - 9)];
+			if (Entry)
+			{
+				int Length = int(Entry >> 8);
+				Acc <<= Length;
+				Count -= Length;
+				return int(Entry & 0xFF);
+			}
+			for (int l = 10; l <= 16; l++)
+			{
+				int32_t Code = int32_t(Acc >> (32 - l));
+				if (Code <= Table.MaxCode[l])
+				{
+					Acc <<= l;
+					Count -= l;
+					return Table.Vals[Code + Table.ValOffset[l]];
+				}
+			}
+			Error = true;
+			return 0;
+		}
+	};
+
+	// 损坏的数据可能产生很大的系数，限制在 16 位以内以免 IDCT 溢出
+	static int32_t ClampCoef(int64_t v)
+	{
+		return int32_t(v < -32768 ? -32768 : v > 32767 ? 32767 : v);
+	}
+
+	static bool DecodeBlock
+	(
+		BitReaderType& br,
+		const JpegDecoderType::HuffmanTableType& DC,
+		const JpegDecoderType::HuffmanTableType& AC,
+		const uint16_t* Quant,
+		int32_t& Pred,
+		int32_t* Coef
+	)
+	{
+		memset(Coef, 0, 64 * sizeof Coef[0]);
+
+		int t = br.DecodeHuffman(DC);
+		if (t > 16) return false;
+		Pred += br.Receive(t);
+		Coef[0] = ClampCoef(int64_t(Pred) * Quant[0]);
+
+		for (int k = 1; k < 64; )
+		{
+			int rs = br.DecodeHuffman(AC);
+			int r = rs >> 4;
+			int s = rs & 15;
+			if (!s)
+			{
+				// EOB 或者 16 个零
+				if (r != 15) break;
+				k += 16;
+				continue;
+			}
+			k += r;
+			if (k > 63) return false;
+			Coef[ZigZag[k]] = ClampCoef(int64_t(br.Receive(s)) * Quant[k]);
+			k++;
+		}
+		return !br.Error;
+	}
+
+	static uint8_t Clamp(int32_t v)
+	{
+		return uint8_t(v < 0 ? 0 : v > 255 ? 255 : v);
+	}
+
+	//-------------------------------------------------------------------
+	// IDCT_8x8
+	//
+	// Integer IDCT (Loeffler, Ligtenberg and Moschytz) with 13-bit
+	// constants and 2 extra bits of precision between the passes.
+	//-------------------------------------------------------------------
+
+	static constexpr int ConstBits = 13;
+	static constexpr int Pass1Bits = 2;
+	static constexpr int32_t FIX_0_298631336 = 2446;
+	static constexpr int32_t FIX_0_390180644 = 3196;
+	static constexpr int32_t FIX_0_541196100 = 4433;
+	static constexpr int32_t FIX_0_765366865 = 6270;
+	static constexpr int32_t FIX_0_899976223 = 7373;
+	static constexpr int32_t FIX_1_175875602 = 9633;
+	static constexpr int32_t FIX_1_501321110 = 12299;
+	static constexpr int32_t FIX_1_847759065 = 15137;
+	static constexpr int32_t FIX_1_961570560 = 16069;
+	static constexpr int32_t FIX_2_053119869 = 16819;
+	static constexpr int32_t FIX_2_562915447 = 20995;
+	static constexpr int32_t FIX_3_072711026 = 25172;
+
+	static void IDCT_8x8(const int32_t* Coef, uint8_t* pDst, size_t DstPitch)
+	{
+		int32_t Work[64];
+
+		// s0..s7 为一列或一行的 8 个输入，结果写入 o0..o7
+		auto IDCT_1D = [](int64_t s0, int64_t s1, int64_t s2, int64_t s3, int64_t s4, int64_t s5, int64_t s6, int64_t s7, int64_t Round, int Shift, int32_t* o, size_t Step)
+		{
+			int64_t z1 = (s2 + s6) * FIX_0_541196100;
+			int64_t tmp2 = z1 - s6 * FIX_1_847759065;
+			int64_t tmp3 = z1 + s2 * FIX_0_765366865;
+			int64_t tmp0 = (s0 + s4) * (1 << ConstBits);
+			int64_t tmp1 = (s0 - s4) * (1 << ConstBits);
+			int64_t tmp10 = tmp0 + tmp3 + Round;
+			int64_t tmp13 = tmp0 - tmp3 + Round;
+			int64_t tmp11 = tmp1 + tmp2 + Round;
+			int64_t tmp12 = tmp1 - tmp2 + Round;
+
+			int64_t t0 = s7, t1 = s5, t2 = s3, t3 = s1;
+			int64_t za = t0 + t3;
+			int64_t zb = t1 + t2;
+			int64_t zc = t0 + t2;
+			int64_t zd = t1 + t3;
+			int64_t z5 = (zc + zd) * FIX_1_175875602;
+			t0 *= FIX_0_298631336;
+			t1 *= FIX_2_053119869;
+			t2 *= FIX_3_072711026;
+			t3 *= FIX_1_501321110;
+			za *= -FIX_0_899976223;
+			zb *= -FIX_2_562915447;
+			zc = zc * -FIX_1_961570560 + z5;
+			zd = zd * -FIX_0_390180644 + z5;
+			t0 += za + zc;
+			t1 += zb + zd;
+			t2 += zb + zc;
+			t3 += za + zd;
+
+			o[0 * Step] = int32_t((tmp10 + t3) >> Shift);
+			o[7 * Step] = int32_t((tmp10 - t3) >> Shift);
+			o[1 * Step] = int32_t((tmp11 + t2) >> Shift);
+			o[6 * Step] = int32_t((tmp11 - t2) >> Shift);
+			o[2 * Step] = int32_t((tmp12 + t1) >> Shift);
+			o[5 * Step] = int32_t((tmp12 - t1) >> Shift);
+			o[3 * Step] = int32_t((tmp13 + t0) >> Shift);
+			o[4 * Step] = int32_t((tmp13 - t0) >> Shift);
+		};
+
+		// 列
+		for (int x = 0; x < 8; x++)
+		{
+			const int32_t* c = Coef + x;
+			if (!(c[8] | c[16] | c[24] | c[32] | c[40] | c[48] | c[56]))
+			{
+				// 只有直流分量的列
+				int32_t dc = c[0] * (1 << Pass1Bits);
+				for (int y = 0; y < 8; y++) Work[y * 8 + x] = dc;
+				continue;
+			}
+			constexpr int Shift = ConstBits - Pass1Bits;
+			IDCT_1D(c[0], c[8], c[16], c[24], c[32], c[40], c[48], c[56], 1 << (Shift - 1), Shift, Work + x, 8);
+		}
+
+		// 行，同时去掉 8 的缩放并加上 128 的偏移
+		for (int y = 0; y < 8; y++)
+		{
+			constexpr int Shift = ConstBits + Pass1Bits + 3;
+			const int32_t* w = Work + y * 8;
+			int32_t Row[8];
+			IDCT_1D(w[0], w[1], w[2], w[3], w[4], w[5], w[6], w[7], (1 << (Shift - 1)) + (128 << Shift), Shift, Row, 1);
+			uint8_t* pRow = pDst + y * DstPitch;
+			for (int x = 0; x < 8; x++) pRow[x] = Clamp(Row[x]);
+		}
+	}
+
+	//-------------------------------------------------------------------
+	// IDCT_Scaled
+	//
+	// Reduced-size IDCT for 1/2 and 1/4 scaling. Only the lowest N x N
+	// coefficients are used, evaluated at the centers of the N x N
+	// output samples, so every output sample is the average of the
+	// 8/N x 8/N pixels it covers.
+	//-------------------------------------------------------------------
+
+	struct ScaledIDCTTableType
+	{
+		int32_t T4[4][4];
+		int32_t T2[2][2];
+
+		ScaledIDCTTableType()
+		{
+			const double Pi = 3.14159265358979323846;
+			auto Get = [Pi](int N, int x, int u)
+			{
+				double C = u ? 1.0 : 1.0 / std::sqrt(2.0);
+				return int32_t(std::lround(C / 2 * std::cos((2 * x + 1) * u * Pi / (2 * N)) * 8192));
+			};
+			for (int x = 0; x < 4; x++) for (int u = 0; u < 4; u++) T4[x][u] = Get(4, x, u);
+			for (int x = 0; x < 2; x++) for (int u = 0; u < 2; u++) T2[x][u] = Get(2, x, u);
+		}
+	};
+
+	static const ScaledIDCTTableType& GetScaledIDCTTable()
+	{
+		static const ScaledIDCTTableType Table;
+		return Table;
+	}
+
+	template<int N>
+	static void IDCT_Scaled(const int32_t* Coef, uint8_t* pDst, size_t DstPitch, const int32_t (*T)[N])
+	{
+		int32_t Work[N][N];
+
+		// 先沿垂直方向，保留 2 位额外精度
+		for (int y = 0; y < N; y++)
+		{
+			for (int u = 0; u < N; u++)
+			{
+				int64_t Sum = 0;
+				for (int v = 0; v < N; v++) Sum += int64_t(T[y][v]) * Coef[v * 8 + u];
+				Work[y][u] = int32_t((Sum + (1 << 10)) >> 11);
+			}
+		}
+		for (int y = 0; y < N; y++)
+		{
+			uint8_t* pRow = pDst + y * DstPitch;
+			for (int x = 0; x < N; x++)
+			{
+				int64_t Sum = 0;
+				for (int u = 0; u < N; u++) Sum += int64_t(T[x][u]) * Work[y][u];
+				pRow[x] = Clamp(int32_t((Sum + (1 << 14)) >> 15) + 128);
+			}
+		}
+	}
+
+	static void IDCT_Block(const int32_t* Coef, uint8_t* pDst, size_t DstPitch, uint32_t BlockSize)
+	{
+		switch (BlockSize)
+		{
+		case 8: return IDCT_8x8(Coef, pDst, DstPitch);
+		case 4: return IDCT_Scaled<4>(Coef, pDst, DstPitch, GetScaledIDCTTable().T4);
+		case 2: return IDCT_Scaled<2>(Coef, pDst, DstPitch, GetScaledIDCTTable().T2);
+		default: *pDst = Clamp(((Coef[0] + 4) >> 3) + 128); return;
+		}
+	}
+
+	JpegDecoderType::JpegDecoderType()
+	{
+		memset(QuantTables, 0, sizeof QuantTables);
+		Reset();
+	}
+
+	void JpegDecoderType::Reset()
+	{
+		auto& Defaults = GetDefaultHuffmanTables();
+		DCTables[0] = Defaults.DC[0];
+		DCTables[1] = Defaults.DC[1];
+		ACTables[0] = Defaults.AC[0];
+		ACTables[1] = Defaults.AC[1];
+		DCTables[2].Defined = DCTables[3].Defined = false;
+		ACTables[2].Defined = ACTables[3].Defined = false;
+
+		Width = Height = 0;
+		NumComponents = 0;
+		RestartInterval = 0;
+		ScanData = ScanEnd = nullptr;
+	}
+
+	uint32_t JpegDecoderType::GetScaledSize(uint32_t Size, uint32_t ScaleDenom)
+	{
+		return (Size + ScaleDenom - 1) / ScaleDenom;
+	}
+
+	uint32_t JpegDecoderType::GetWidth() const
+	{
+		return Width;
+	}
+
+	uint32_t JpegDecoderType::GetHeight() const
+	{
+		return Height;
+	}
+
+	uint32_t JpegDecoderType::GetRestartInterval() const
+	{
+		return RestartInterval;
+	}
+
+	bool JpegDecoderType::GetImageSize(const uint8_t* pData, size_t Size, uint32_t& Width, uint32_t& Height)
+	{
+		if (Size < 4 || pData[0] != 0xFF || pData[1] != 0xD8) return false;
+		const uint8_t* p = pData + 2;
+		const uint8_t* End = pData + Size;
+		while (p + 4 <= End)
+		{
+			if (*p != 0xFF) return false;
+			uint8_t Marker = p[1];
+			if (Marker == 0xFF) { p++; continue; }
+			size_t Length = (size_t(p[2]) << 8) | p[3];
+			if (Marker >= 0xC0 && Marker <= 0xCF && Marker != 0xC4 && Marker != 0xC8 && Marker != 0xCC)
+			{
+				if (Length < 7 || p + 2 + Length > End) return false;
+				Height = (uint32_t(p[5]) << 8) | p[6];
+				Width = (uint32_t(p[7]) << 8) | p[8];
+				return true;
+			}
+			if (Marker == 0xDA || Marker == 0xD9) return false;
+			p += 2 + Length;
+		}
+		return false;
+	}
+
+	void JpegDecoderType::ParseHeaders(const uint8_t* pData, size_t Size)
+	{
+		Reset();
+
+		if (Size < 4 || pData[0] != 0xFF || pData[1] != 0xD8) throw DecodeJpegFailed("Not a JPEG image.");
+		const uint8_t* p = pData + 2;
+		const uint8_t* End = pData + Size;
+		bool HaveFrame = false;
+
+		for (;;)
+		{
+			// 标记前可以有任意个 0xFF 填充
+			while (p < End && *p != 0xFF) p++;
+			while (p < End && *p == 0xFF) p++;
+			if (p >= End) throw DecodeJpegFailed("Unexpected end of JPEG data.");
+
+			uint8_t Marker = *p++;
+			if (Marker == 0xD9) throw DecodeJpegFailed("No scan in the JPEG data.");
+			if ((Marker >= 0xD0 && Marker <= 0xD7) || Marker == 0x01) continue;
+
+			if (End - p < 2) throw DecodeJpegFailed("Unexpected end of JPEG data.");
+			size_t Length = (size_t(p[0]) << 8) | p[1];
+			if (Length < 2 || Length > size_t(End - p)) throw DecodeJpegFailed("Bad JPEG segment length.");
+			const uint8_t* Seg = p + 2;
+			size_t SegLen = Length - 2;
+
+			switch (Marker)
+			{
+			case 0xC0:
+			case 0xC1:
+			{
+				if (SegLen < 6 || Seg[0] != 8) throw DecodeJpegFailed("Only 8-bit JPEG is supported.");
+				Height = (uint32_t(Seg[1]) << 8) | Seg[2];
+				Width = (uint32_t(Seg[3]) << 8) | Seg[4];
+				NumComponents = Seg[5];
+				if (!Width || !Height) throw DecodeJpegFailed("Bad JPEG image size.");
+				if (NumComponents != 1 && NumComponents != 3) throw DecodeJpegFailed("Only grayscale and YCbCr JPEG is supported.");
+				if (SegLen < 6 + NumComponents * 3) throw DecodeJpegFailed("Bad SOF segment.");
+
+				HMax = VMax = 1;
+				for (uint32_t i = 0; i < NumComponents; i++)
+				{
+					auto& c = Components[i];
+					c.Id = Seg[6 + i * 3];
+					c.H = Seg[7 + i * 3] >> 4;
+					c.V = Seg[7 + i * 3] & 15;
+					c.Tq = Seg[8 + i * 3] & 3;
+					if (c.H < 1 || c.H > 4 || c.V < 1 || c.V > 4) throw DecodeJpegFailed("Bad JPEG sampling factors.");
+					if (c.H > HMax) HMax = c.H;
+					if (c.V > VMax) VMax = c.V;
+				}
+
+				// 单一分量的扫描不交错，每个 MCU 只有一个块
+				if (NumComponents == 1)
+				{
+					Components[0].H = Components[0].V = 1;
+					HMax = VMax = 1;
+				}
+				McusX = (Width + HMax * 8 - 1) / (HMax * 8);
+				McusY = (Height + VMax * 8 - 1) / (VMax * 8);
+				HaveFrame = true;
+				break;
+			}
+			case 0xC2: case 0xC3: case 0xC5: case 0xC6: case 0xC7:
+			case 0xC9: case 0xCA: case 0xCB: case 0xCD: case 0xCE: case 0xCF:
+				throw DecodeJpegFailed("Only baseline JPEG is supported.");
+			case 0xC4:
+			{
+				while (SegLen >= 17)
+				{
+					uint32_t Tc = Seg[0] >> 4;
+					uint32_t Th = Seg[0] & 15;
+					if (Tc > 1 || Th > 3) throw DecodeJpegFailed("Bad DHT segment.");
+					size_t NumValues = 0;
+					for (int i = 0; i < 16; i++) NumValues += Seg[1 + i];
+					if (17 + NumValues > SegLen) throw DecodeJpegFailed("Bad DHT segment.");
+					(Tc ? ACTables : DCTables)[Th].Build(Seg + 1, Seg + 17, NumValues);
+					Seg += 17 + NumValues;
+					SegLen -= 17 + NumValues;
+				}
+				break;
+			}
+			case 0xDB:
+			{
+				while (SegLen >= 1)
+				{
+					uint32_t Pq = Seg[0] >> 4;
+					uint32_t Tq = Seg[0] & 15;
+					size_t Need = 1 + 64 * (Pq ? 2 : 1);
+					if (Pq > 1 || Tq > 3 || SegLen < Need) throw DecodeJpegFailed("Bad DQT segment.");
+					for (int k = 0; k < 64; k++)
+					{
+						QuantTables[Tq][k] = Pq ? uint16_t((Seg[1 + k * 2] << 8) | Seg[2 + k * 2]) : Seg[1 + k];
+					}
+					Seg += Need;
+					SegLen -= Need;
+				}
+				break;
+			}
+			case 0xDD:
+				if (SegLen < 2) throw DecodeJpegFailed("Bad DRI segment.");
+				RestartInterval = (uint32_t(Seg[0]) << 8) | Seg[1];
+				break;
+			case 0xDA:
+			{
+				if (!HaveFrame) throw DecodeJpegFailed("SOS before SOF.");
+				if (SegLen < 1 || Seg[0] != NumComponents) throw DecodeJpegFailed("Only single-scan interleaved JPEG is supported.");
+				if (SegLen < 1 + NumComponents * 2) throw DecodeJpegFailed("Bad SOS segment.");
+				for (uint32_t i = 0; i < NumComponents; i++)
+				{
+					uint8_t Id = Seg[1 + i * 2];
+					uint8_t TdTa = Seg[2 + i * 2];
+					uint32_t j = 0;
+					while (j < NumComponents && Components[j].Id != Id) j++;
+					if (j == NumComponents) throw DecodeJpegFailed("Bad component in SOS segment.");
+					Components[j].Td = (TdTa >> 4) & 3;
+					Components[j].Ta = TdTa & 3;
+					if (!DCTables[Components[j].Td].Defined || !ACTables[Components[j].Ta].Defined) throw DecodeJpegFailed("Missing huffman table.");
+				}
+				ScanData = p + Length;
+				ScanEnd = End;
+				return;
+			}
+			default:
+				break;
+			}
+			p += Length;
+		}
+	}
+
+	void JpegDecoderType::FindSegments()
+	{
+		Segments.clear();
+		Segments.push_back(ScanData);
+
+		const uint8_t* p = ScanData;
+		while (p + 1 < ScanEnd)
+		{
+			p = reinterpret_cast<const uint8_t*>(memchr(p, 0xFF, size_t(ScanEnd - p - 1)));
+			if (!p) break;
+
+			uint8_t Next = p[1];
+			if (Next == 0x00 || Next == 0xFF)
+			{
+				p++;
+				continue;
+			}
+			if (Next >= 0xD0 && Next <= 0xD7)
+			{
+				if (RestartInterval) Segments.push_back(p + 2);
+				p += 2;
+				continue;
+			}
+
+			// EOI 或其它标记，扫描数据结束
+			ScanEnd = p;
+			break;
+		}
+	}
+
+	template<typename DstTraits>
+	bool JpegDecoderType::DecodeSegment(size_t Index, uint8_t* pDst, ptrdiff_t DstPitch, uint32_t ScaleDenom) const
+	{
+		const uint32_t S = 8 / ScaleDenom;
+		const uint32_t TotalMcus = McusX * McusY;
+		const uint32_t FirstMcu = RestartInterval ? uint32_t(Index) * RestartInterval : 0;
+		uint32_t LastMcu = RestartInterval ? FirstMcu + RestartInterval : TotalMcus;
+		if (LastMcu > TotalMcus) LastMcu = TotalMcus;
+
+		const uint32_t DstWidth = GetScaledSize(Width, ScaleDenom);
+		const uint32_t DstHeight = GetScaledSize(Height, ScaleDenom);
+		const uint32_t McuWidth = HMax * S;
+		const uint32_t McuHeight = VMax * S;
+		const bool LumaOnly = DstTraits::LumaOnly || NumComponents == 1;
+
+		BitReaderType br(Segments[Index], Index + 1 < Segments.size() ? Segments[Index + 1] : ScanEnd);
+		int32_t Pred[3] = { 0, 0, 0 };
+		int32_t Coef[64];
+
+		// 每个分量在一个 MCU 内的采样，采样因子最大为 4
+		uint8_t Planes[3][32 * 32];
+		size_t PlanePitch[3];
+		for (uint32_t c = 0; c < NumComponents; c++) PlanePitch[c] = size_t(Components[c].H) * S;
+
+		for (uint32_t Mcu = FirstMcu; Mcu < LastMcu; Mcu++)
+		{
+			for (uint32_t c = 0; c < NumComponents; c++)
+			{
+				auto& Comp = Components[c];
+				for (uint32_t by = 0; by < Comp.V; by++)
+				{
+					for (uint32_t bx = 0; bx < Comp.H; bx++)
+					{
+						if (!DecodeBlock(br, DCTables[Comp.Td], ACTables[Comp.Ta], QuantTables[Comp.Tq], Pred[c], Coef)) return false;
+
+						// 只输出亮度时不需要色度的 IDCT，但熵解码不能省
+						if (c && LumaOnly) continue;
+						IDCT_Block(Coef, &Planes[c][by * S * PlanePitch[c] + bx * S], PlanePitch[c], S);
+					}
+				}
+			}
+
+			uint32_t X0 = (Mcu % McusX) * McuWidth;
+			uint32_t Y0 = (Mcu / McusX) * McuHeight;
+			uint32_t w = DstWidth - X0 < McuWidth ? DstWidth - X0 : McuWidth;
+			uint32_t h = DstHeight - Y0 < McuHeight ? DstHeight - Y0 : McuHeight;
+			const auto& C0 = Components[0];
+
+			for (uint32_t y = 0; y < h; y++)
+			{
+				uint8_t* pDstPel = pDst + ptrdiff_t(Y0 + y) * DstPitch + size_t(X0) * DstTraits::BytesPerPixel;
+				const uint8_t* pY = &Planes[0][(y * C0.V / VMax) * PlanePitch[0]];
+				if (LumaOnly)
+				{
+					for (uint32_t x = 0; x < w; x++)
+					{
+						uint8_t l = pY[x * C0.H / HMax];
+						DstTraits::StoreRGB(pDstPel, l, l, l);
+						pDstPel += DstTraits::BytesPerPixel;
+					}
+					continue;
+				}
+
+				const auto& C1 = Components[1];
+				const auto& C2 = Components[2];
+				const uint8_t* pCb = &Planes[1][(y * C1.V / VMax) * PlanePitch[1]];
+				const uint8_t* pCr = &Planes[2][(y * C2.V / VMax) * PlanePitch[2]];
+				for (uint32_t x = 0; x < w; x++)
+				{
+					// JFIF 使用全范围的 YCbCr
+					int32_t l = pY[x * C0.H / HMax];
+					int32_t cb = int32_t(pCb[x * C1.H / HMax]) - 128;
+					int32_t cr = int32_t(pCr[x * C2.H / HMax]) - 128;
+					DstTraits::StoreRGB(pDstPel,
+						Clamp(l + ((91881 * cr + 32768) >> 16)),
+						Clamp(l - ((22554 * cb + 46802 * cr - 32768) >> 16)),
+						Clamp(l + ((116130 * cb + 32768) >> 16)));
+					pDstPel += DstTraits::BytesPerPixel;
+				}
+			}
+		}
+		return true;
+	}
+
+	template<typename DstTraits>
+	bool JpegDecoderType::Decode(const uint8_t* pData, size_t Size, uint8_t* pDst, ptrdiff_t DstPitch, uint32_t DstWidth, uint32_t DstHeight, uint32_t ScaleDenom)
+	{
+		if (ScaleDenom != 1 && ScaleDenom != 2 && ScaleDenom != 4 && ScaleDenom != 8) throw DecodeJpegFailed("The scale must be 1/1, 1/2, 1/4 or 1/8.");
+
+		ParseHeaders(pData, Size);
+		if (DstWidth != GetScaledSize(Width, ScaleDenom) || DstHeight != GetScaledSize(Height, ScaleDenom))
+		{
+			throw DecodeJpegFailed("The JPEG image size " + std::to_string(Width) + "x" + std::to_string(Height) + " doesn't match the output size.");
+		}
+		FindSegments();
+
+		// 各个重启间隔互相独立，可以并行解码
+		int NumSegments = int(Segments.size());
+		bool Succeeded = true;
+#pragma omp parallel for schedule(dynamic) reduction(&&:Succeeded)
+		for (int i = 0; i < NumSegments; i++)
+		{
+			Succeeded = DecodeSegment<DstTraits>(size_t(i), pDst, DstPitch, ScaleDenom) && Succeeded;
+		}
+		return Succeeded;
+	}
+
+	bool JpegDecoderType::Decode(const uint8_t* pData, size_t Size, Image_RGBA8& FrameBuffer, uint32_t ScaleDenom)
+	{
+		return Decode<RGBA8Traits>(pData, Size, reinterpret_cast<uint8_t*>(FrameBuffer.GetBitmapDataPtr()), FrameBuffer.GetPitch(), FrameBuffer.GetWidth(), FrameBuffer.GetHeight(), ScaleDenom);
+	}
+
+	template bool JpegDecoderType::Decode<RGBA8Traits>(const uint8_t*, size_t, uint8_t*, ptrdiff_t, uint32_t, uint32_t, uint32_t);
+	template bool JpegDecoderType::Decode<BGRA8Traits>(const uint8_t*, size_t, uint8_t*, ptrdiff_t, uint32_t, uint32_t, uint32_t);
+	template bool JpegDecoderType::Decode<RGB565Traits>(const uint8_t*, size_t, uint8_t*, ptrdiff_t, uint32_t, uint32_t, uint32_t);
+	template bool JpegDecoderType::Decode<Gray8Traits>(const uint8_t*, size_t, uint8_t*, ptrdiff_t, uint32_t, uint32_t, uint32_t);
+}
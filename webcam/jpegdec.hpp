@@ -0,0 +1,97 @@
+#pragma once
+
+#include "pixfmt.hpp"
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <stdexcept>
+#include <string>
+
+namespace WindowsWebCamTypeLib
+{
+	class DecodeJpegFailed : public std::runtime_error
+	{
+	public:
+		DecodeJpegFailed(const std::string& what) noexcept;
+	};
+
+	//-------------------------------------------------------------------
+	// JpegDecoderType
+	//
+	// Baseline (huffman, 8-bit, sequential) JPEG decoder for MJPG
+	// frames. Only standard C++ is used, so it also runs outside of
+	// Windows. Frames without a DHT segment use the default tables of
+	// the JPEG standard, as is common for MJPG.
+	//
+	// When the frame has a restart interval, the entropy-coded segments
+	// between the restart markers are decoded in parallel. `ScaleDenom`
+	// may be 1, 2, 4 or 8; the reduced sizes are produced directly by a
+	// smaller IDCT instead of decoding at full size and scaling down.
+	//-------------------------------------------------------------------
+
+	class JpegDecoderType
+	{
+	public:
+		struct ComponentType
+		{
+			uint8_t Id = 0;
+			uint8_t H = 1, V = 1;
+			uint8_t Tq = 0;
+			uint8_t Td = 0, Ta = 0;
+		};
+
+		struct HuffmanTableType
+		{
+			bool Defined = false;
+			uint16_t Fast[1 << 9]; // 高 8 位是码长，低 8 位是符号，0 表示需要查慢速表
+			int32_t MaxCode[18];
+			int32_t ValOffset[17];
+			uint8_t Vals[256];
+
+			void Build(const uint8_t* Bits, const uint8_t* Values, size_t NumValues);
+		};
+
+	protected:
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		uint32_t NumComponents = 0;
+		ComponentType Components[3];
+		uint32_t HMax = 1, VMax = 1;
+		uint32_t McusX = 0, McusY = 0;
+		uint32_t RestartInterval = 0;
+		uint16_t QuantTables[4][64];
+		HuffmanTableType DCTables[4];
+		HuffmanTableType ACTables[4];
+
+		const uint8_t* ScanData = nullptr;
+		const uint8_t* ScanEnd = nullptr;
+
+		// 每个熵编码段的起始位置，段与段之间是 RST 标记
+		std::vector<const uint8_t*> Segments;
+
+		void Reset();
+		void ParseHeaders(const uint8_t* pData, size_t Size);
+		void FindSegments();
+
+		template<typename DstTraits>
+		bool DecodeSegment(size_t Index, uint8_t* pDst, ptrdiff_t DstPitch, uint32_t ScaleDenom) const;
+
+	public:
+		JpegDecoderType();
+
+		// 只解析文件头，获取图像尺寸
+		static bool GetImageSize(const uint8_t* pData, size_t Size, uint32_t& Width, uint32_t& Height);
+		static uint32_t GetScaledSize(uint32_t Size, uint32_t ScaleDenom);
+
+		uint32_t GetWidth() const;
+		uint32_t GetHeight() const;
+		uint32_t GetRestartInterval() const;
+
+		// `pDst` 的尺寸必须是 `GetScaledSize()` 得到的尺寸；返回 false 表示数据有损坏，但已解码的部分仍然写入了
+		template<typename DstTraits>
+		bool Decode(const uint8_t* pData, size_t Size, uint8_t* pDst, ptrdiff_t DstPitch, uint32_t DstWidth, uint32_t DstHeight, uint32_t ScaleDenom = 1);
+
+		bool Decode(const uint8_t* pData, size_t Size, Image_RGBA8& FrameBuffer, uint32_t ScaleDenom = 1);
+	};
+}
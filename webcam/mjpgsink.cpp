@@ -0,0 +1,366 @@
+#include "mjpgsink.hpp"
+
+#include <cstring>
+
+namespace WindowsWebCamTypeLib
+{
+	WriteVideoFailed::WriteVideoFailed(const std::string& what) noexcept :
+		std::runtime_error(what)
+	{
+	}
+
+	// 媒体的时间单位，1/90000 秒
+	static constexpr uint32_t MediaTimeScale = 90000;
+	static constexpr uint32_t MovieTimeScale = 1000;
+
+	// 只有一帧时无法由时间戳得到帧长，按 30 帧每秒算
+	static constexpr uint32_t DefaultSampleDuration = MediaTimeScale / 30;
+
+	//-------------------------------------------------------------------
+	// AtomWriterType
+	//
+	// Builds nested QuickTime atoms in memory. Every value is big
+	// endian; the size of an atom is patched in by `End()`.
+	//-------------------------------------------------------------------
+
+	class AtomWriterType
+	{
+	protected:
+		std::vector<uint8_t> Data;
+		std::vector<size_t> Starts;
+
+	public:
+		void U8(uint8_t v)
+		{
+			Data.push_back(v);
+		}
+
+		void U16(uint16_t v)
+		{
+			U8(uint8_t(v >> 8));
+			U8(uint8_t(v));
+		}
+
+		void U32(uint32_t v)
+		{
+			U16(uint16_t(v >> 16));
+			U16(uint16_t(v));
+		}
+
+		void U64(uint64_t v)
+		{
+			U32(uint32_t(v >> 32));
+			U32(uint32_t(v));
+		}
+
+		void FourCC(const char* Type)
+		{
+			Data.insert(Data.end(), Type, Type + 4);
+		}
+
+		void Zeros(size_t Count)
+		{
+			Data.insert(Data.end(), Count, 0);
+		}
+
+		// 长度固定为 `FieldSize` 的 Pascal 字符串，`FieldSize` 为 0 时按实际长度
+		void PascalString(const char* Str, size_t FieldSize = 0)
+		{
+			size_t Length = strlen(Str);
+			if (FieldSize && Length > FieldSize - 1) Length = FieldSize - 1;
+			U8(uint8_t(Length));
+			Data.insert(Data.end(), Str, Str + Length);
+			if (FieldSize) Zeros(FieldSize - 1 - Length);
+		}
+
+		void Matrix()
+		{
+			const uint32_t Identity[9] = { 0x00010000, 0, 0, 0, 0x00010000, 0, 0, 0, 0x40000000 };
+			for (auto v : Identity) U32(v);
+		}
+
+		void Begin(const char* Type)
+		{
+			Starts.push_back(Data.size());
+			U32(0);
+			FourCC(Type);
+		}
+
+		void BeginFull(const char* Type, uint32_t Flags)
+		{
+			Begin(Type);
+			U32(Flags);
+		}
+
+		void End()
+		{
+			size_t Start = Starts.back();
+			Starts.pop_back();
+			uint32_t Size = uint32_t(Data.size() - Start);
+			Data[Start + 0] = uint8_t(Size >> 24);
+			Data[Start + 1] = uint8_t(Size >> 16);
+			Data[Start + 2] = uint8_t(Size >> 8);
+			Data[Start + 3] = uint8_t(Size);
+		}
+
+		std::vector<uint8_t>& GetData()
+		{
+			return Data;
+		}
+	};
+
+	MotionJpegSinkType::MotionJpegSinkType(const std::string& Path, uint32_t Width, uint32_t Height) :
+		Path(Path), Width(Width), Height(Height)
+	{
+		if (!Width || !Height || Width > 0xFFFF || Height > 0xFFFF) throw WriteVideoFailed("Bad video size " + std::to_string(Width) + "x" + std::to_string(Height) + ".");
+
+		File.open(Path, std::ios::binary | std::ios::trunc);
+		if (!File.is_open()) throw WriteVideoFailed("Couldn't create `" + Path + "`.");
+
+		AtomWriterType Header;
+		Header.Begin("ftyp");
+		Header.FourCC("qt  ");
+		Header.U32(0x20050300);
+		Header.FourCC("qt  ");
+		Header.End();
+
+		// `mdat` 使用 64 位长度，关闭时再填入
+		MdatOffset = Header.GetData().size();
+		Header.U32(1);
+		Header.FourCC("mdat");
+		Header.U64(0);
+
+		auto& Data = Header.GetData();
+		File.write(reinterpret_cast<const char*>(Data.data()), Data.size());
+		if (!File) throw WriteVideoFailed("Couldn't write to `" + Path + "`.");
+		WritePos = Data.size();
+	}
+
+	MotionJpegSinkType::~MotionJpegSinkType()
+	{
+		try
+		{
+			Close();
+		}
+		catch (const WriteVideoFailed&)
+		{
+		}
+	}
+
+	void MotionJpegSinkType::WriteFrame(const void* pData, size_t Size, int64_t Timestamp)
+	{
+		if (!File.is_open()) throw WriteVideoFailed("`" + Path + "` is already closed.");
+		if (!Size || Size > 0xFFFFFFFF) throw WriteVideoFailed("Bad MJPG sample size " + std::to_string(Size) + ".");
+
+		File.write(reinterpret_cast<const char*>(pData), Size);
+		if (!File) throw WriteVideoFailed("Couldn't write to `" + Path + "`.");
+
+		Samples.push_back(SampleType{ WritePos, uint32_t(Size), Timestamp });
+		WritePos += Size;
+	}
+
+	std::vector<uint8_t> MotionJpegSinkType::BuildMovieAtom() const
+	{
+		// 由时间戳得到每帧的时长，先换算到媒体时间单位再相减，避免误差累积
+		std::vector<uint32_t> Durations(Samples.size());
+		uint64_t MediaDuration = 0;
+		int64_t Prev = 0;
+		for (size_t i = 1; i < Samples.size(); i++)
+		{
+			int64_t Cur = ((Samples[i].Timestamp - Samples[0].Timestamp) * MediaTimeScale + 5000000) / 10000000;
+			Durations[i - 1] = uint32_t(Cur > Prev ? Cur - Prev : 1);
+			Prev = Cur > Prev ? Cur : Prev + 1;
+		}
+		if (!Samples.empty()) Durations.back() = Samples.size() > 1 ? Durations[Samples.size() - 2] : DefaultSampleDuration;
+		for (auto d : Durations) MediaDuration += d;
+		uint32_t MovieDuration = uint32_t(MediaDuration * MovieTimeScale / MediaTimeScale);
+
+		bool Use64BitOffsets = !Samples.empty() && Samples.back().Offset > 0xFFFFFFFF;
+
+		AtomWriterType w;
+		w.Begin("moov");
+		{
+			w.BeginFull("mvhd", 0);
+			w.U32(0); // 创建时间
+			w.U32(0); // 修改时间
+			w.U32(MovieTimeScale);
+			w.U32(MovieDuration);
+			w.U32(0x00010000); // 播放速度 1.0
+			w.U16(0x0100); // 音量 1.0
+			w.Zeros(10);
+			w.Matrix();
+			w.Zeros(24); // 预览、海报和选择的时间
+			w.U32(2); // 下一个轨道的 ID
+			w.End();
+
+			w.Begin("trak");
+			{
+				w.BeginFull("tkhd", 0x000003); // 启用并用于播放
+				w.U32(0);
+				w.U32(0);
+				w.U32(1); // 轨道 ID
+				w.U32(0);
+				w.U32(MovieDuration);
+				w.Zeros(8);
+				w.U16(0); // 层
+				w.U16(0); // 替换组
+				w.U16(0); // 音量
+				w.U16(0);
+				w.Matrix();
+				w.U32(Width << 16);
+				w.U32(Height << 16);
+				w.End();
+
+				w.Begin("mdia");
+				{
+					w.BeginFull("mdhd", 0);
+					w.U32(0);
+					w.U32(0);
+					w.U32(MediaTimeScale);
+					w.U32(uint32_t(MediaDuration));
+					w.U16(0); // 语言
+					w.U16(0); // 质量
+					w.End();
+
+					w.BeginFull("hdlr", 0);
+					w.FourCC("mhlr");
+					w.FourCC("vide");
+					w.Zeros(12);
+					w.PascalString("VideoHandler");
+					w.End();
+
+					w.Begin("minf");
+					{
+						w.BeginFull("vmhd", 1);
+						w.U16(0x0040); // ditherCopy
+						w.U16(0x8000);
+						w.U16(0x8000);
+						w.U16(0x8000);
+						w.End();
+
+						w.BeginFull("hdlr", 0);
+						w.FourCC("dhlr");
+						w.FourCC("alis");
+						w.Zeros(12);
+						w.PascalString("DataHandler");
+						w.End();
+
+						w.Begin("dinf");
+						w.BeginFull("dref", 0);
+						w.U32(1);
+						w.BeginFull("alis", 1); // 数据就在本文件里
+						w.End();
+						w.End();
+						w.End();
+
+						w.Begin("stbl");
+						{
+							w.BeginFull("stsd", 0);
+							w.U32(1);
+							w.Begin("jpeg");
+							w.Zeros(6);
+							w.U16(1); // 数据引用索引
+							w.U16(0); // 版本
+							w.U16(0); // 修订
+							w.U32(0); // 厂商
+							w.U32(0); // 时间质量
+							w.U32(0x00000200); // 空间质量 codecNormalQuality
+							w.U16(uint16_t(Width));
+							w.U16(uint16_t(Height));
+							w.U32(0x00480000); // 72 dpi
+							w.U32(0x00480000);
+							w.U32(0);
+							w.U16(1); // 每个样本一帧
+							w.PascalString("Photo - JPEG", 32);
+							w.U16(24);
+							w.U16(0xFFFF); // 无颜色表
+							w.End();
+							w.End();
+
+							// 连续相同的时长合并为一项
+							w.BeginFull("stts", 0);
+							std::vector<std::pair<uint32_t, uint32_t>> Runs;
+							for (auto d : Durations)
+							{
+								if (!Runs.empty() && Runs.back().second == d) Runs.back().first++;
+								else Runs.push_back({ 1, d });
+							}
+							w.U32(uint32_t(Runs.size()));
+							for (auto& r : Runs)
+							{
+								w.U32(r.first);
+								w.U32(r.second);
+							}
+							w.End();
+
+							// 每个块只有一个样本
+							w.BeginFull("stsc", 0);
+							w.U32(1);
+							w.U32(1);
+							w.U32(1);
+							w.U32(1);
+							w.End();
+
+							w.BeginFull("stsz", 0);
+							w.U32(0);
+							w.U32(uint32_t(Samples.size()));
+							for (auto& s : Samples) w.U32(s.Size);
+							w.End();
+
+							w.BeginFull(Use64BitOffsets ? "co64" : "stco", 0);
+							w.U32(uint32_t(Samples.size()));
+							for (auto& s : Samples)
+							{
+								if (Use64BitOffsets) w.U64(s.Offset);
+								else w.U32(uint32_t(s.Offset));
+							}
+							w.End();
+
+							// 没有 `stss` 表示所有的帧都是关键帧
+						}
+						w.End();
+					}
+					w.End();
+				}
+				w.End();
+			}
+			w.End();
+		}
+		w.End();
+		return std::move(w.GetData());
+	}
+
+	void MotionJpegSinkType::Close()
+	{
+		if (!File.is_open()) return;
+
+		auto Moov = BuildMovieAtom();
+
+		// 填入 `mdat` 的长度，`moov` 紧跟在后面
+		uint64_t MdatSize = WritePos - MdatOffset;
+		uint8_t SizeBytes[8];
+		for (int i = 0; i < 8; i++) SizeBytes[i] = uint8_t(MdatSize >> (56 - i * 8));
+		File.seekp(std::streamoff(MdatOffset + 8));
+		File.write(reinterpret_cast<const char*>(SizeBytes), sizeof SizeBytes);
+		File.seekp(std::streamoff(WritePos));
+		File.write(reinterpret_cast<const char*>(Moov.data()), Moov.size());
+		bool Failed = !File;
+		File.close();
+		if (Failed) throw WriteVideoFailed("Couldn't finish writing `" + Path + "`.");
+	}
+
+	bool MotionJpegSinkType::IsOpened() const
+	{
+		return File.is_open();
+	}
+
+	size_t MotionJpegSinkType::GetNumFrames() const
+	{
+		return Samples.size();
+	}
+
+	const std::string& MotionJpegSinkType::GetPath() const
+	{
+		return Path;
+	}
+}
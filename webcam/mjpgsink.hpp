@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+namespace WindowsWebCamTypeLib
+{
+	class WriteVideoFailed : public std::runtime_error
+	{
+	public:
+		WriteVideoFailed(const std::string& what) noexcept;
+	};
+
+	//-------------------------------------------------------------------
+	// MotionJpegSinkType
+	//
+	// Writes compressed MJPG samples unchanged into a Motion-JPEG
+	// QuickTime (.mov) file. The sample data goes into a 64-bit `mdat`
+	// atom as it arrives; the sample table (sizes, offsets, durations
+	// from the capture timestamps) is written as the `moov` atom by
+	// `Close()`, so the file is only playable once it is closed.
+	//-------------------------------------------------------------------
+
+	class MotionJpegSinkType
+	{
+	protected:
+		struct SampleType
+		{
+			uint64_t Offset;
+			uint32_t Size;
+			int64_t Timestamp;
+		};
+
+		std::ofstream File;
+		std::string Path;
+		uint32_t Width;
+		uint32_t Height;
+		uint64_t MdatOffset = 0;
+		uint64_t WritePos = 0;
+		std::vector<SampleType> Samples;
+
+		std::vector<uint8_t> BuildMovieAtom() const;
+
+	public:
+		MotionJpegSinkType(const std::string& Path, uint32_t Width, uint32_t Height);
+		MotionJpegSinkType(const MotionJpegSinkType&) = delete;
+		MotionJpegSinkType& operator = (const MotionJpegSinkType&) = delete;
+		~MotionJpegSinkType();
+
+		// `Timestamp` 以 100 纳秒为单位，与 Media Foundation 的时间戳相同
+		void WriteFrame(const void* pData, size_t Size, int64_t Timestamp);
+		void Close();
+
+		bool IsOpened() const;
+		size_t GetNumFrames() const;
+		const std::string& GetPath() const;
+	};
+}
@@ -0,0 +1,899 @@
+#pragma once
+
+#include "pixsimd.hpp"
+
+#include <unibmp/unibmp.hpp>
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cmath>
+
+namespace WindowsWebCamTypeLib
+{
+	using namespace UniformBitmap;
+
+	enum class RawFrameType
+	{
+		Unknown,
+		RGB32,
+		RGB24,
+		YUY2,
+		NV12,
+		UYVY,
+		YVYU,
+		NV21,
+		I420,
+		YV12,
+		Y8,
+		P010,
+		Y16,
+		MJPG
+	};
+
+	constexpr size_t NumRawFrameTypes = size_t(RawFrameType::MJPG) + 1;
+
+	// 视频范围的 8 位 YUV 转 RGB，定点数的 BT.601。不用 unibmp 的 `ConvertYCrCbToRGB()`，这样逐像素的转换与 pixsimd.hpp 的向量化版本结果逐位相同
+	inline Pixel_RGBA8 ConvertYUVToRGBA8(uint8_t Y, uint8_t U, uint8_t V)
+	{
+		int32_t c = int32_t(Y) - 16;
+		int32_t d = int32_t(U) - 128;
+		int32_t e = int32_t(V) - 128;
+		auto Clamp = [](int32_t v) -> uint8_t { return uint8_t(v < 0 ? 0 : v > 255 ? 255 : v); };
+		return Pixel_RGBA8(
+			Clamp((298 * c + 409 * e + 128) >> 8),
+			Clamp((298 * c - 100 * d - 208 * e + 128) >> 8),
+			Clamp((298 * c + 516 * d + 128) >> 8),
+			255);
+	}
+
+	//-------------------------------------------------------------------
+	// Output pixel format traits
+	//
+	// `StoreRGB()` and `StoreYUV()` write one output pixel. Formats with
+	// `LumaOnly` set only need the Y sample of YUV sources, so the
+	// kernels skip reading the chroma samples for them.
+	//
+	// 16-bit formats additionally take 16-bit samples through
+	// `StoreRGB16()`, `StoreYUV16()` and `StoreLuma16()`, which is how
+	// high bit depth sources keep their precision.
+	//
+	// `SimdOutput` selects the row kernels in pixsimd.hpp that YUV and
+	// 16-bit gray sources use for most of each row before falling back
+	// to the per-pixel calls for the rest.
+	//-------------------------------------------------------------------
+
+	struct RGBA8Traits
+	{
+		static constexpr size_t BytesPerPixel = 4;
+		static constexpr uint32_t BitDepth = 8;
+		static constexpr bool LumaOnly = false;
+		static constexpr SimdOutputType SimdOutput = SimdOutputType::RGBA8;
+
+		static void StoreRGB(uint8_t* p, uint8_t R, uint8_t G, uint8_t B)
+		{
+			*reinterpret_cast<Pixel_RGBA8*>(p) = Pixel_RGBA8(R, G, B, 255);
+		}
+
+		static void StoreYUV(uint8_t* p, uint8_t Y, uint8_t U, uint8_t V)
+		{
+			*reinterpret_cast<Pixel_RGBA8*>(p) = ConvertYUVToRGBA8(Y, U, V);
+		}
+	};
+
+	struct BGRA8Traits
+	{
+		static constexpr size_t BytesPerPixel = 4;
+		static constexpr uint32_t BitDepth = 8;
+		static constexpr bool LumaOnly = false;
+		static constexpr SimdOutputType SimdOutput = SimdOutputType::BGRA8;
+
+		static void StoreRGB(uint8_t* p, uint8_t R, uint8_t G, uint8_t B)
+		{
+			p[0] = B;
+			p[1] = G;
+			p[2] = R;
+			p[3] = 255;
+		}
+
+		static void StoreYUV(uint8_t* p, uint8_t Y, uint8_t U, uint8_t V)
+		{
+			auto c = ConvertYUVToRGBA8(Y, U, V);
+			StoreRGB(p, c.R, c.G, c.B);
+		}
+	};
+
+	struct RGB565Traits
+	{
+		static constexpr size_t BytesPerPixel = 2;
+		static constexpr uint32_t BitDepth = 8;
+		static constexpr bool LumaOnly = false;
+
+		static void StoreRGB(uint8_t* p, uint8_t R, uint8_t G, uint8_t B)
+		{
+			uint16_t v = uint16_t(((R & 0xF8) << 8) | ((G & 0xFC) << 3) | (B >> 3));
+			memcpy(p, &v, sizeof v);
+		}
+
+		static void StoreYUV(uint8_t* p, uint8_t Y, uint8_t U, uint8_t V)
+		{
+			auto c = ConvertYUVToRGBA8(Y, U, V);
+			StoreRGB(p, c.R, c.G, c.B);
+		}
+	};
+
+	// 视频范围 (16-235) 的亮度扩展到 0-255，与 `ConvertYUVToRGBA8()` 的亮度一致
+	struct VideoRangeLumaTable
+	{
+		uint8_t Value[256];
+		constexpr VideoRangeLumaTable() : Value()
+		{
+			for (int i = 0; i < 256; i++)
+			{
+				int v = (298 * (i - 16) + 128) >> 8;
+				Value[i] = uint8_t(v < 0 ? 0 : v > 255 ? 255 : v);
+			}
+		}
+	};
+
+	inline constexpr VideoRangeLumaTable VideoRangeLuma;
+
+	struct Gray8Traits
+	{
+		static constexpr size_t BytesPerPixel = 1;
+		static constexpr uint32_t BitDepth = 8;
+		static constexpr bool LumaOnly = true;
+		static constexpr SimdOutputType SimdOutput = SimdOutputType::Gray8;
+
+		static void StoreRGB(uint8_t* p, uint8_t R, uint8_t G, uint8_t B)
+		{
+			// BT.601
+			*p = uint8_t((77 * R + 150 * G + 29 * B + 128) >> 8);
+		}
+
+		static void StoreLuma(uint8_t* p, uint8_t Y)
+		{
+			*p = VideoRangeLuma.Value[Y];
+		}
+	};
+
+	// 16 位的视频范围 YUV 转 RGB，系数与 `ConvertYUVToRGBA8()` 相同
+	inline void ConvertYUVToRGB16(uint16_t Y, uint16_t U, uint16_t V, uint16_t& R, uint16_t& G, uint16_t& B)
+	{
+		int32_t c = int32_t(Y) - (16 << 8);
+		int32_t d = int32_t(U) - 32768;
+		int32_t e = int32_t(V) - 32768;
+		auto Clamp = [](int32_t v) -> uint16_t { return uint16_t(v < 0 ? 0 : v > 65535 ? 65535 : v); };
+		R = Clamp((298 * c + 409 * e + 128) >> 8);
+		G = Clamp((298 * c - 100 * d - 208 * e + 128) >> 8);
+		B = Clamp((298 * c + 516 * d + 128) >> 8);
+	}
+
+	// 每个通道 16 位，R G B A 依次排列
+	struct RGBA16Traits
+	{
+		static constexpr size_t BytesPerPixel = 8;
+		static constexpr uint32_t BitDepth = 16;
+		static constexpr bool LumaOnly = false;
+		static constexpr SimdOutputType SimdOutput = SimdOutputType::RGBA16;
+
+		static void StoreRGB16(uint8_t* p, uint16_t R, uint16_t G, uint16_t B)
+		{
+			const uint16_t v[4] = { R, G, B, 65535 };
+			memcpy(p, v, sizeof v);
+		}
+
+		static void StoreYUV16(uint8_t* p, uint16_t Y, uint16_t U, uint16_t V)
+		{
+			uint16_t R, G, B;
+			ConvertYUVToRGB16(Y, U, V, R, G, B);
+			StoreRGB16(p, R, G, B);
+		}
+
+		// 8 位的源格式扩展到 16 位
+		static void StoreRGB(uint8_t* p, uint8_t R, uint8_t G, uint8_t B)
+		{
+			StoreRGB16(p, uint16_t(R * 257), uint16_t(G * 257), uint16_t(B * 257));
+		}
+
+		static void StoreYUV(uint8_t* p, uint8_t Y, uint8_t U, uint8_t V)
+		{
+			auto c = ConvertYUVToRGBA8(Y, U, V);
+			StoreRGB(p, c.R, c.G, c.B);
+		}
+	};
+
+	// 16 位灰度；YUV 源格式保留原始的亮度值而不扩展视频范围，便于分析测量
+	struct Gray16Traits
+	{
+		static constexpr size_t BytesPerPixel = 2;
+		static constexpr uint32_t BitDepth = 16;
+		static constexpr bool LumaOnly = true;
+		static constexpr SimdOutputType SimdOutput = SimdOutputType::Gray16;
+
+		static void StoreRGB16(uint8_t* p, uint16_t R, uint16_t G, uint16_t B)
+		{
+			// BT.601
+			uint16_t v = uint16_t((77 * uint32_t(R) + 150 * uint32_t(G) + 29 * uint32_t(B) + 128) >> 8);
+			memcpy(p, &v, sizeof v);
+		}
+
+		static void StoreLuma16(uint8_t* p, uint16_t Y)
+		{
+			memcpy(p, &Y, sizeof Y);
+		}
+
+		static void StoreRGB(uint8_t* p, uint8_t R, uint8_t G, uint8_t B)
+		{
+			StoreRGB16(p, uint16_t(R * 257), uint16_t(G * 257), uint16_t(B * 257));
+		}
+
+		static void StoreLuma(uint8_t* p, uint8_t Y)
+		{
+			StoreLuma16(p, uint16_t(Y * 257));
+		}
+	};
+
+	//-------------------------------------------------------------------
+	// Raw frame format traits
+	//
+	// A raw format is described by its plane layout, chroma subsampling
+	// and byte order. `Convert<DstTraits>()` is the kernel for one pair
+	// of source and output formats; everything that describes the
+	// layout is a template parameter, so every pair gets its own
+	// unrolled inner loop.
+	//-------------------------------------------------------------------
+
+	template<size_t BPP, size_t OffsetR, size_t OffsetG, size_t OffsetB>
+	struct PackedRGBTraits
+	{
+		static constexpr bool IsYUV = false;
+		static constexpr bool IsHighDepth = false;
+		static constexpr uint32_t SubsampleX = 1;
+		static constexpr uint32_t SubsampleY = 1;
+		static constexpr uint32_t NumPlanes = 1;
+		static constexpr size_t BytesPerPixel = BPP;
+
+		template<typename DstTraits>
+		static void Convert(uint8_t* pDst, ptrdiff_t DstPitch, const uint8_t* pSrc, int32_t SrcPitch, uint32_t Width, uint32_t Height)
+		{
+			for (uint32_t y = 0; y < Height; y++)
+			{
+				const uint8_t* pSrcPel = pSrc + ptrdiff_t(y) * SrcPitch;
+				uint8_t* pDstPel = pDst + ptrdiff_t(y) * DstPitch;
+				for (uint32_t x = 0; x < Width; x++)
+				{
+					DstTraits::StoreRGB(pDstPel, pSrcPel[OffsetR], pSrcPel[OffsetG], pSrcPel[OffsetB]);
+					pSrcPel += BPP;
+					pDstPel += DstTraits::BytesPerPixel;
+				}
+			}
+		}
+	};
+
+	// 4:2:2 打包格式，每 4 字节存两个像素，参数为各样本在 4 字节中的位置
+	template<size_t OffsetY0, size_t OffsetU, size_t OffsetY1, size_t OffsetV>
+	struct PackedYUV422Traits
+	{
+		static constexpr bool IsYUV = true;
+		static constexpr bool IsHighDepth = false;
+		static constexpr uint32_t SubsampleX = 2;
+		static constexpr uint32_t SubsampleY = 1;
+		static constexpr uint32_t NumPlanes = 1;
+		static constexpr size_t BytesPerPixel = 2;
+		static constexpr size_t OffY0 = OffsetY0;
+		static constexpr size_t OffU = OffsetU;
+		static constexpr size_t OffY1 = OffsetY1;
+		static constexpr size_t OffV = OffsetV;
+
+		template<typename DstTraits>
+		static void Convert(uint8_t* pDst, ptrdiff_t DstPitch, const uint8_t* pSrc, int32_t SrcPitch, uint32_t Width, uint32_t Height)
+		{
+			constexpr size_t DstBPP = DstTraits::BytesPerPixel;
+			for (uint32_t y = 0; y < Height; y++)
+			{
+				const uint8_t* pPair = pSrc + ptrdiff_t(y) * SrcPitch;
+				uint8_t* pDstPel = pDst + ptrdiff_t(y) * DstPitch;
+				uint32_t x = PixSimd::ConvertPackedYUV422Row<SimdOutputOf<DstTraits>, OffsetY0, OffsetU, OffsetY1, OffsetV>(pDstPel, pPair, Width);
+				pPair += size_t(x) * 2;
+				pDstPel += size_t(x) * DstBPP;
+				for (; x < Width; x += 2)
+				{
+					if constexpr (DstTraits::LumaOnly)
+					{
+						DstTraits::StoreLuma(pDstPel, pPair[OffsetY0]);
+						DstTraits::StoreLuma(pDstPel + DstBPP, pPair[OffsetY1]);
+					}
+					else
+					{
+						uint8_t u = pPair[OffsetU];
+						uint8_t v = pPair[OffsetV];
+						DstTraits::StoreYUV(pDstPel, pPair[OffsetY0], u, v);
+						DstTraits::StoreYUV(pDstPel + DstBPP, pPair[OffsetY1], u, v);
+					}
+					pPair += 4;
+					pDstPel += DstBPP * 2;
+				}
+			}
+		}
+	};
+
+	// 4:2:0 格式两个色度平面中当前位置的指针，`Pitch` 为色度行之间的字节数
+	struct ChromaPlanesType
+	{
+		const uint8_t* pCb;
+		const uint8_t* pCr;
+		ptrdiff_t Pitch;
+	};
+
+	// 4:2:0 格式，色度紧跟在亮度平面之后。`Interleaved` 时 Cb Cr 交错存放在与亮度平面同宽的一个平面里（NV12、NV21），
+	// 否则分别存放在宽高各为一半的两个平面里（I420、YV12）；`CrFirst` 表示 Cr 在前。
+	// `SampleBytes` 为 2 时每个采样是小端序的 16 位整数，有效位在高位（P010）
+	template<bool Interleaved, bool CrFirst, size_t SampleBytes = 1>
+	struct YUV420Traits
+	{
+		static constexpr bool IsYUV = true;
+		static constexpr bool IsHighDepth = SampleBytes > 1;
+		static constexpr uint32_t SubsampleX = 2;
+		static constexpr uint32_t SubsampleY = 2;
+		static constexpr uint32_t NumPlanes = Interleaved ? 2 : 3;
+		static constexpr size_t BytesPerPixel = SampleBytes; // 亮度平面
+		static constexpr size_t ChromaStep = (Interleaved ? 2 : 1) * SampleBytes;
+
+		static ChromaPlanesType GetChromaPlanes(const uint8_t* pSrc, int32_t SrcPitch, uint32_t SrcHeight)
+		{
+			const uint8_t* pFirst = pSrc + ptrdiff_t(SrcHeight) * SrcPitch;
+			if constexpr (Interleaved)
+			{
+				return CrFirst ? ChromaPlanesType{ pFirst + SampleBytes, pFirst, SrcPitch } : ChromaPlanesType{ pFirst, pFirst + SampleBytes, SrcPitch };
+			}
+			else
+			{
+				ptrdiff_t Pitch = SrcPitch / 2;
+				const uint8_t* pSecond = pFirst + ptrdiff_t(SrcHeight / 2) * Pitch;
+				return CrFirst ? ChromaPlanesType{ pSecond, pFirst, Pitch } : ChromaPlanesType{ pFirst, pSecond, Pitch };
+			}
+		}
+
+		// 移到亮度坐标 (`X`, `Y`) 所在的色度样本
+		static ChromaPlanesType OffsetChroma(const ChromaPlanesType& Chroma, uint32_t X, uint32_t Y)
+		{
+			ptrdiff_t Offset = ptrdiff_t(Y / 2) * Chroma.Pitch + ptrdiff_t(X / 2) * ChromaStep;
+			return ChromaPlanesType{ Chroma.pCb + Offset, Chroma.pCr + Offset, Chroma.Pitch };
+		}
+
+		// 上下翻转：从 `Height` 行亮度对应的最后一行色度开始倒着读
+		static ChromaPlanesType FlipChroma(const ChromaPlanesType& Chroma, uint32_t Height)
+		{
+			ptrdiff_t Offset = ptrdiff_t(Height / 2 - 1) * Chroma.Pitch;
+			return ChromaPlanesType{ Chroma.pCb + Offset, Chroma.pCr + Offset, -Chroma.Pitch };
+		}
+
+		static uint16_t LoadSample(const uint8_t* p)
+		{
+			if constexpr (SampleBytes == 1) return *p;
+			else
+			{
+				uint16_t v;
+				memcpy(&v, p, sizeof v);
+				return v;
+			}
+		}
+
+		// 8 位的源格式走 8 位的接口，16 位的源格式走 16 位的接口
+		template<typename DstTraits>
+		static void StoreLuma(uint8_t* p, uint16_t Y)
+		{
+			if constexpr (SampleBytes == 1) DstTraits::StoreLuma(p, uint8_t(Y));
+			else DstTraits::StoreLuma16(p, Y);
+		}
+
+		template<typename DstTraits>
+		static void StoreYUV(uint8_t* p, uint16_t Y, uint16_t U, uint16_t V)
+		{
+			if constexpr (SampleBytes == 1) DstTraits::StoreYUV(p, uint8_t(Y), uint8_t(U), uint8_t(V));
+			else DstTraits::StoreYUV16(p, Y, U, V);
+		}
+
+		// 亮度与色度的指针可以分别指定，用于区域转换和上下翻转
+		template<typename DstTraits>
+		static void ConvertPlanes(uint8_t* pDst, ptrdiff_t DstPitch, const uint8_t* lpBitsY, int32_t SrcPitch, const ChromaPlanesType& Chroma, uint32_t Width, uint32_t Height)
+		{
+			constexpr size_t DstBPP = DstTraits::BytesPerPixel;
+			static_assert(SampleBytes == 1 || DstTraits::BitDepth == 16, "High bit depth sources need a 16-bit output format.");
+
+			for (uint32_t y = 0; y < Height; y += 2)
+			{
+				const uint8_t* lpLineY1 = lpBitsY + ptrdiff_t(y + 0) * SrcPitch;
+				const uint8_t* lpLineY2 = lpBitsY + ptrdiff_t(y + 1) * SrcPitch;
+				const uint8_t* lpLineCb = Chroma.pCb + ptrdiff_t(y >> 1) * Chroma.Pitch;
+				const uint8_t* lpLineCr = Chroma.pCr + ptrdiff_t(y >> 1) * Chroma.Pitch;
+				uint8_t* lpDstLine1 = pDst + ptrdiff_t(y + 0) * DstPitch;
+				uint8_t* lpDstLine2 = pDst + ptrdiff_t(y + 1) * DstPitch;
+
+				// 两行亮度共用一行色度，向量化的部分转换的像素数相同
+				constexpr auto Simd = SimdOutputOf<DstTraits>;
+				uint32_t x = PixSimd::ConvertYUV420Row<Simd, Interleaved, CrFirst, SampleBytes>(lpDstLine1, lpLineY1, lpLineCb, lpLineCr, Width);
+				PixSimd::ConvertYUV420Row<Simd, Interleaved, CrFirst, SampleBytes>(lpDstLine2, lpLineY2, lpLineCb, lpLineCr, Width);
+				lpLineY1 += size_t(x) * SampleBytes;
+				lpLineY2 += size_t(x) * SampleBytes;
+				lpLineCb += size_t(x / 2) * ChromaStep;
+				lpLineCr += size_t(x / 2) * ChromaStep;
+				lpDstLine1 += size_t(x) * DstBPP;
+				lpDstLine2 += size_t(x) * DstBPP;
+
+				for (; x < Width; x += 2)
+				{
+					if constexpr (DstTraits::LumaOnly)
+					{
+						StoreLuma<DstTraits>(lpDstLine1, LoadSample(lpLineY1));
+						StoreLuma<DstTraits>(lpDstLine1 + DstBPP, LoadSample(lpLineY1 + SampleBytes));
+						StoreLuma<DstTraits>(lpDstLine2, LoadSample(lpLineY2));
+						StoreLuma<DstTraits>(lpDstLine2 + DstBPP, LoadSample(lpLineY2 + SampleBytes));
+					}
+					else
+					{
+						uint16_t cb = LoadSample(lpLineCb);
+						uint16_t cr = LoadSample(lpLineCr);
+						StoreYUV<DstTraits>(lpDstLine1, LoadSample(lpLineY1), cb, cr);
+						StoreYUV<DstTraits>(lpDstLine1 + DstBPP, LoadSample(lpLineY1 + SampleBytes), cb, cr);
+						StoreYUV<DstTraits>(lpDstLine2, LoadSample(lpLineY2), cb, cr);
+						StoreYUV<DstTraits>(lpDstLine2 + DstBPP, LoadSample(lpLineY2 + SampleBytes), cb, cr);
+					}
+					lpLineY1 += 2 * SampleBytes;
+					lpLineY2 += 2 * SampleBytes;
+					lpLineCb += ChromaStep;
+					lpLineCr += ChromaStep;
+					lpDstLine1 += DstBPP * 2;
+					lpDstLine2 += DstBPP * 2;
+				}
+			}
+		}
+
+		template<typename DstTraits>
+		static void Convert(uint8_t* pDst, ptrdiff_t DstPitch, const uint8_t* pSrc, int32_t SrcPitch, uint32_t Width, uint32_t Height)
+		{
+			ConvertPlanes<DstTraits>(pDst, DstPitch, pSrc, SrcPitch, GetChromaPlanes(pSrc, SrcPitch, Height), Width, Height);
+		}
+
+		// 高位深的帧按查找表映射亮度，色度取高 8 位，得到同样布局的 8 位帧，`DstPitch` 为亮度平面的步长
+		static void ToneMap(uint8_t* pDst, ptrdiff_t DstPitch, const uint8_t* pSrc, int32_t SrcPitch, uint32_t Width, uint32_t Height, const uint8_t* Lut)
+		{
+			static_assert(SampleBytes == 2, "Only high bit depth formats need tone mapping.");
+
+			// 65536 项的查找表没有合适的向量指令，亮度逐个查表
+			for (uint32_t y = 0; y < Height; y++)
+			{
+				const uint16_t* pSrcRow = reinterpret_cast<const uint16_t*>(pSrc + ptrdiff_t(y) * SrcPitch);
+				uint8_t* pDstRow = pDst + ptrdiff_t(y) * DstPitch;
+				for (uint32_t x = 0; x < Width; x++) pDstRow[x] = Lut[pSrcRow[x]];
+			}
+
+			// 色度平面按内存中的顺序整体处理，交错的色度每行的采样数与亮度相同
+			auto Chroma = GetChromaPlanes(pSrc, SrcPitch, Height);
+			const uint8_t* pChroma = Chroma.pCb < Chroma.pCr ? Chroma.pCb : Chroma.pCr;
+			uint8_t* pDstChroma = pDst + ptrdiff_t(Height) * DstPitch;
+			uint32_t Rows = (Height / 2) * (Interleaved ? 1 : 2);
+			uint32_t Samples = Interleaved ? Width : Width / 2;
+			ptrdiff_t DstChromaPitch = Interleaved ? DstPitch : DstPitch / 2;
+			for (uint32_t y = 0; y < Rows; y++)
+			{
+				const uint16_t* pSrcRow = reinterpret_cast<const uint16_t*>(pChroma + ptrdiff_t(y) * Chroma.Pitch);
+				uint8_t* pDstRow = pDstChroma + ptrdiff_t(y) * DstChromaPitch;
+				uint32_t x = PixSimd::ShiftRow16To8(pDstRow, reinterpret_cast<const uint8_t*>(pSrcRow), Samples);
+				for (; x < Samples; x++) pDstRow[x] = uint8_t(pSrcRow[x] >> 8);
+			}
+		}
+	};
+
+	// 单平面的灰度格式，采样值是全范围的亮度。`SampleBytes` 为 2 时是小端序的 16 位整数（Y16）
+	template<size_t SampleBytes>
+	struct GrayTraits
+	{
+		static constexpr bool IsYUV = false;
+		static constexpr bool IsHighDepth = SampleBytes > 1;
+		static constexpr uint32_t SubsampleX = 1;
+		static constexpr uint32_t SubsampleY = 1;
+		static constexpr uint32_t NumPlanes = 1;
+		static constexpr size_t BytesPerPixel = SampleBytes;
+
+		template<typename DstTraits>
+		static void Convert(uint8_t* pDst, ptrdiff_t DstPitch, const uint8_t* pSrc, int32_t SrcPitch, uint32_t Width, uint32_t Height)
+		{
+			constexpr size_t DstBPP = DstTraits::BytesPerPixel;
+			static_assert(SampleBytes == 1 || DstTraits::BitDepth == 16, "High bit depth sources need a 16-bit output format.");
+			for (uint32_t y = 0; y < Height; y++)
+			{
+				const uint8_t* pSrcPel = pSrc + ptrdiff_t(y) * SrcPitch;
+				uint8_t* pDstPel = pDst + ptrdiff_t(y) * DstPitch;
+				uint32_t x = 0;
+				if constexpr (SampleBytes == 2 && SimdOutputOf<DstTraits> == SimdOutputType::Gray16)
+				{
+					// 灰度的权重之和是 256，16 位灰度原样输出
+					memcpy(pDstPel, pSrcPel, size_t(Width) * 2);
+					continue;
+				}
+				else if constexpr (SampleBytes == 2)
+				{
+					x = PixSimd::ConvertGray16Row<SimdOutputOf<DstTraits>>(pDstPel, pSrcPel, Width);
+					pSrcPel += size_t(x) * 2;
+					pDstPel += size_t(x) * DstBPP;
+				}
+				for (; x < Width; x++)
+				{
+					if constexpr (SampleBytes == 1)
+					{
+						DstTraits::StoreRGB(pDstPel, *pSrcPel, *pSrcPel, *pSrcPel);
+					}
+					else
+					{
+						uint16_t v;
+						memcpy(&v, pSrcPel, sizeof v);
+						DstTraits::StoreRGB16(pDstPel, v, v, v);
+					}
+					pSrcPel += SampleBytes;
+					pDstPel += DstBPP;
+				}
+			}
+		}
+
+		static void ToneMap(uint8_t* pDst, ptrdiff_t DstPitch, const uint8_t* pSrc, int32_t SrcPitch, uint32_t Width, uint32_t Height, const uint8_t* Lut)
+		{
+			static_assert(SampleBytes == 2, "Only high bit depth formats need tone mapping.");
+			for (uint32_t y = 0; y < Height; y++)
+			{
+				const uint16_t* pSrcRow = reinterpret_cast<const uint16_t*>(pSrc + ptrdiff_t(y) * SrcPitch);
+				uint8_t* pDstRow = pDst + ptrdiff_t(y) * DstPitch;
+				for (uint32_t x = 0; x < Width; x++) pDstRow[x] = Lut[pSrcRow[x]];
+			}
+		}
+	};
+
+	template<RawFrameType RFT> struct RawFrameTraits;
+	template<> struct RawFrameTraits<RawFrameType::RGB32> : PackedRGBTraits<4, 2, 1, 0> {};
+	template<> struct RawFrameTraits<RawFrameType::RGB24> : PackedRGBTraits<3, 2, 1, 0> {};
+	template<> struct RawFrameTraits<RawFrameType::YUY2> : PackedYUV422Traits<0, 1, 2, 3> {};
+	template<> struct RawFrameTraits<RawFrameType::NV12> : YUV420Traits<true, false> {};
+	template<> struct RawFrameTraits<RawFrameType::UYVY> : PackedYUV422Traits<1, 0, 3, 2> {};
+	template<> struct RawFrameTraits<RawFrameType::YVYU> : PackedYUV422Traits<0, 3, 2, 1> {};
+	template<> struct RawFrameTraits<RawFrameType::NV21> : YUV420Traits<true, true> {};
+	template<> struct RawFrameTraits<RawFrameType::I420> : YUV420Traits<false, false> {};
+	template<> struct RawFrameTraits<RawFrameType::YV12> : YUV420Traits<false, true> {};
+	template<> struct RawFrameTraits<RawFrameType::Y8> : GrayTraits<1> {};
+	template<> struct RawFrameTraits<RawFrameType::P010> : YUV420Traits<true, false, 2> {};
+	template<> struct RawFrameTraits<RawFrameType::Y16> : GrayTraits<2> {};
+
+	//-------------------------------------------------------------------
+	// ConvertFrame
+	//
+	// Convert a whole frame of `RFT` into the output format. The
+	// `RawFrameConverters` table holds one instance per raw format for a
+	// given output format and is indexed by `RawFrameType`. Compressed
+	// formats such as MJPG have no entry and are decoded beforehand.
+	//-------------------------------------------------------------------
+
+	using RawConverterFuncType = void(*)(uint8_t* pDst, ptrdiff_t DstPitch, const uint8_t* pSrc, int32_t SrcPitch, uint32_t Width, uint32_t Height);
+
+	template<RawFrameType RFT, typename DstTraits>
+	void ConvertFrame(uint8_t* pDst, ptrdiff_t DstPitch, const uint8_t* pSrc, int32_t SrcPitch, uint32_t Width, uint32_t Height)
+	{
+		RawFrameTraits<RFT>::template Convert<DstTraits>(pDst, DstPitch, pSrc, SrcPitch, Width, Height);
+	}
+
+	// 高位深的格式只能直接转换到 16 位的输出格式，转换到 8 位时先经过 `ToneMapFrame()`
+	template<RawFrameType RFT, typename DstTraits>
+	inline constexpr bool CanConvertDirectly = !RawFrameTraits<RFT>::IsHighDepth || DstTraits::BitDepth == 16;
+
+	template<RawFrameType RFT, typename DstTraits>
+	constexpr RawConverterFuncType GetRawFrameConverter()
+	{
+		if constexpr (CanConvertDirectly<RFT, DstTraits>) return ConvertFrame<RFT, DstTraits>;
+		else return nullptr;
+	}
+
+	template<typename DstTraits>
+	inline constexpr RawConverterFuncType RawFrameConverters[NumRawFrameTypes] =
+	{
+		nullptr,
+		ConvertFrame<RawFrameType::RGB32, DstTraits>,
+		ConvertFrame<RawFrameType::RGB24, DstTraits>,
+		ConvertFrame<RawFrameType::YUY2, DstTraits>,
+		ConvertFrame<RawFrameType::NV12, DstTraits>,
+		ConvertFrame<RawFrameType::UYVY, DstTraits>,
+		ConvertFrame<RawFrameType::YVYU, DstTraits>,
+		ConvertFrame<RawFrameType::NV21, DstTraits>,
+		ConvertFrame<RawFrameType::I420, DstTraits>,
+		ConvertFrame<RawFrameType::YV12, DstTraits>,
+		ConvertFrame<RawFrameType::Y8, DstTraits>,
+		GetRawFrameConverter<RawFrameType::P010, DstTraits>(),
+		GetRawFrameConverter<RawFrameType::Y16, DstTraits>(),
+		nullptr,
+	};
+
+	//-------------------------------------------------------------------
+	// ConvertFrameRegion / CopyFrameRegion
+	//
+	// Convert or copy the region (`X`, `Y`, `Width`, `Height`) of a
+	// frame, optionally upside down. The region must be aligned to the
+	// chroma subsampling. `CopyFrameRegion()` keeps the raw layout and
+	// packs the planes tightly, one after another.
+	//-------------------------------------------------------------------
+
+	using RawRegionConverterFuncType = void(*)(uint8_t* pDst, ptrdiff_t DstPitch, const uint8_t* pSrc, int32_t SrcPitch, uint32_t SrcHeight, uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height, bool FlipV);
+
+	template<RawFrameType RFT, typename DstTraits>
+	void ConvertFrameRegion(uint8_t* pDst, ptrdiff_t DstPitch, const uint8_t* pSrc, int32_t SrcPitch, uint32_t SrcHeight, uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height, bool FlipV)
+	{
+		using Traits = RawFrameTraits<RFT>;
+		const uint8_t* lpBitsY = pSrc + ptrdiff_t(Y) * SrcPitch + size_t(X) * Traits::BytesPerPixel;
+		if constexpr (Traits::NumPlanes == 1)
+		{
+			if (FlipV)
+			{
+				// 上下翻转只需要从最后一行开始倒着读
+				lpBitsY += ptrdiff_t(Height - 1) * SrcPitch;
+				SrcPitch = -SrcPitch;
+			}
+			Traits::template Convert<DstTraits>(pDst, DstPitch, lpBitsY, SrcPitch, Width, Height);
+		}
+		else
+		{
+			auto Chroma = Traits::OffsetChroma(Traits::GetChromaPlanes(pSrc, SrcPitch, SrcHeight), X, Y);
+			if (FlipV)
+			{
+				lpBitsY += ptrdiff_t(Height - 1) * SrcPitch;
+				Chroma = Traits::FlipChroma(Chroma, Height);
+				SrcPitch = -SrcPitch;
+			}
+			Traits::template ConvertPlanes<DstTraits>(pDst, DstPitch, lpBitsY, SrcPitch, Chroma, Width, Height);
+		}
+	}
+
+	template<RawFrameType RFT, typename DstTraits>
+	constexpr RawRegionConverterFuncType GetRawFrameRegionConverter()
+	{
+		if constexpr (CanConvertDirectly<RFT, DstTraits>) return ConvertFrameRegion<RFT, DstTraits>;
+		else return nullptr;
+	}
+
+	template<RawFrameType RFT>
+	void CopyFrameRegion(uint8_t* pDst, ptrdiff_t DstPitch, const uint8_t* pSrc, int32_t SrcPitch, uint32_t SrcHeight, uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height, bool FlipV)
+	{
+		using Traits = RawFrameTraits<RFT>;
+		auto CopyPlane = [&](const uint8_t* pPlane, ptrdiff_t PlanePitch, uint32_t Rows, size_t RowBytes, ptrdiff_t DstPlanePitch)
+		{
+			for (uint32_t y = 0; y < Rows; y++)
+			{
+				uint32_t sy = FlipV ? Rows - 1 - y : y;
+				memcpy(pDst, pPlane + ptrdiff_t(sy) * PlanePitch, RowBytes);
+				pDst += DstPlanePitch;
+			}
+		};
+
+		CopyPlane(pSrc + ptrdiff_t(Y) * SrcPitch + size_t(X) * Traits::BytesPerPixel, SrcPitch, Height, size_t(Width) * Traits::BytesPerPixel, DstPitch);
+		if constexpr (Traits::NumPlanes > 1)
+		{
+			// 色度平面保持原来的先后顺序
+			auto Chroma = Traits::OffsetChroma(Traits::GetChromaPlanes(pSrc, SrcPitch, SrcHeight), X, Y);
+			const uint8_t* pFirst = Chroma.pCb < Chroma.pCr ? Chroma.pCb : Chroma.pCr;
+			const uint8_t* pSecond = Chroma.pCb < Chroma.pCr ? Chroma.pCr : Chroma.pCb;
+			uint32_t Rows = Height / Traits::SubsampleY;
+			if constexpr (Traits::NumPlanes == 2)
+			{
+				// 交错的色度平面每行的字节数与亮度平面相同
+				CopyPlane(pFirst, Chroma.Pitch, Rows, size_t(Width) * Traits::BytesPerPixel, DstPitch);
+			}
+			else
+			{
+				CopyPlane(pFirst, Chroma.Pitch, Rows, size_t(Width / 2) * Traits::BytesPerPixel, DstPitch / 2);
+				CopyPlane(pSecond, Chroma.Pitch, Rows, size_t(Width / 2) * Traits::BytesPerPixel, DstPitch / 2);
+			}
+		}
+	}
+
+	// 返回紧密排列的帧所需的字节数，`Pitch` 为第一个平面每行的字节数
+	template<RawFrameType RFT>
+	size_t GetRawFrameLayout(uint32_t Width, uint32_t Height, size_t& Pitch)
+	{
+		using Traits = RawFrameTraits<RFT>;
+		Pitch = size_t(Width) * Traits::BytesPerPixel;
+		if constexpr (Traits::NumPlanes == 1) return Pitch * Height;
+		else if constexpr (Traits::NumPlanes == 2) return Pitch * Height + Pitch * (Height / Traits::SubsampleY);
+		else return Pitch * Height + 2 * (Pitch / 2) * (Height / Traits::SubsampleY);
+	}
+
+	template<typename DstTraits>
+	inline constexpr RawRegionConverterFuncType RawFrameRegionConverters[NumRawFrameTypes] =
+	{
+		nullptr,
+		ConvertFrameRegion<RawFrameType::RGB32, DstTraits>,
+		ConvertFrameRegion<RawFrameType::RGB24, DstTraits>,
+		ConvertFrameRegion<RawFrameType::YUY2, DstTraits>,
+		ConvertFrameRegion<RawFrameType::NV12, DstTraits>,
+		ConvertFrameRegion<RawFrameType::UYVY, DstTraits>,
+		ConvertFrameRegion<RawFrameType::YVYU, DstTraits>,
+		ConvertFrameRegion<RawFrameType::NV21, DstTraits>,
+		ConvertFrameRegion<RawFrameType::I420, DstTraits>,
+		ConvertFrameRegion<RawFrameType::YV12, DstTraits>,
+		ConvertFrameRegion<RawFrameType::Y8, DstTraits>,
+		GetRawFrameRegionConverter<RawFrameType::P010, DstTraits>(),
+		GetRawFrameRegionConverter<RawFrameType::Y16, DstTraits>(),
+		nullptr,
+	};
+
+	inline constexpr RawRegionConverterFuncType RawFrameRegionCopiers[NumRawFrameTypes] =
+	{
+		nullptr,
+		CopyFrameRegion<RawFrameType::RGB32>,
+		CopyFrameRegion<RawFrameType::RGB24>,
+		CopyFrameRegion<RawFrameType::YUY2>,
+		CopyFrameRegion<RawFrameType::NV12>,
+		CopyFrameRegion<RawFrameType::UYVY>,
+		CopyFrameRegion<RawFrameType::YVYU>,
+		CopyFrameRegion<RawFrameType::NV21>,
+		CopyFrameRegion<RawFrameType::I420>,
+		CopyFrameRegion<RawFrameType::YV12>,
+		CopyFrameRegion<RawFrameType::Y8>,
+		CopyFrameRegion<RawFrameType::P010>,
+		CopyFrameRegion<RawFrameType::Y16>,
+		nullptr,
+	};
+
+	using RawFrameLayoutFuncType = size_t(*)(uint32_t Width, uint32_t Height, size_t& Pitch);
+
+	inline constexpr RawFrameLayoutFuncType RawFrameLayouts[NumRawFrameTypes] =
+	{
+		nullptr,
+		GetRawFrameLayout<RawFrameType::RGB32>,
+		GetRawFrameLayout<RawFrameType::RGB24>,
+		GetRawFrameLayout<RawFrameType::YUY2>,
+		GetRawFrameLayout<RawFrameType::NV12>,
+		GetRawFrameLayout<RawFrameType::UYVY>,
+		GetRawFrameLayout<RawFrameType::YVYU>,
+		GetRawFrameLayout<RawFrameType::NV21>,
+		GetRawFrameLayout<RawFrameType::I420>,
+		GetRawFrameLayout<RawFrameType::YV12>,
+		GetRawFrameLayout<RawFrameType::Y8>,
+		GetRawFrameLayout<RawFrameType::P010>,
+		GetRawFrameLayout<RawFrameType::Y16>,
+		nullptr,
+	};
+
+	//-------------------------------------------------------------------
+	// ToneMapTableType / ToneMapFrame
+	//
+	// High bit depth samples are MSB aligned to 16 bits. For 8-bit
+	// output they are mapped through a window: samples at or below
+	// `Low` become `OutMin`, samples at or above `High` become `OutMax`
+	// and the ones in between follow a gamma curve. `ToneMapFrame()`
+	// turns P010 into NV12 and Y16 into Y8 with the same layout, so the
+	// 8-bit kernels do the cropping, rotation and scaling afterwards.
+	//-------------------------------------------------------------------
+
+	class ToneMapTableType
+	{
+	protected:
+		uint8_t Value[65536];
+		bool Built = false;
+		uint16_t Low = 0, High = 0;
+		float Gamma = 0;
+		uint8_t OutMin = 0, OutMax = 0;
+
+	public:
+		// 参数没变时不重新生成
+		void Build(uint16_t Low, uint16_t High, float Gamma, uint8_t OutMin, uint8_t OutMax)
+		{
+			if (Built && Low == this->Low && High == this->High && Gamma == this->Gamma && OutMin == this->OutMin && OutMax == this->OutMax) return;
+			this->Low = Low;
+			this->High = High;
+			this->Gamma = Gamma;
+			this->OutMin = OutMin;
+			this->OutMax = OutMax;
+			Built = true;
+
+			float Range = High > Low ? float(High - Low) : 1.0f;
+			float OutRange = float(OutMax - OutMin);
+			bool Linear = Gamma <= 0 || Gamma == 1.0f;
+			for (uint32_t i = 0; i < 65536; i++)
+			{
+				float t = i <= Low ? 0.0f : i >= High ? 1.0f : float(i - Low) / Range;
+				if (!Linear) t = std::pow(t, 1.0f / Gamma);
+				Value[i] = uint8_t(OutMin + t * OutRange + 0.5f);
+			}
+		}
+
+		const uint8_t* GetTable() const
+		{
+			return Value;
+		}
+	};
+
+	using ToneMapFuncType = void(*)(uint8_t* pDst, ptrdiff_t DstPitch, const uint8_t* pSrc, int32_t SrcPitch, uint32_t Width, uint32_t Height, const uint8_t* Lut);
+
+	template<RawFrameType RFT>
+	void ToneMapFrame(uint8_t* pDst, ptrdiff_t DstPitch, const uint8_t* pSrc, int32_t SrcPitch, uint32_t Width, uint32_t Height, const uint8_t* Lut)
+	{
+		RawFrameTraits<RFT>::ToneMap(pDst, DstPitch, pSrc, SrcPitch, Width, Height, Lut);
+	}
+
+	// 只有高位深的格式有色调映射函数
+	inline constexpr ToneMapFuncType RawFrameToneMappers[NumRawFrameTypes] =
+	{
+		nullptr,
+		nullptr,
+		nullptr,
+		nullptr,
+		nullptr,
+		nullptr,
+		nullptr,
+		nullptr,
+		nullptr,
+		nullptr,
+		nullptr,
+		ToneMapFrame<RawFrameType::P010>,
+		ToneMapFrame<RawFrameType::Y16>,
+		nullptr,
+	};
+
+	// 色调映射后的 8 位格式
+	inline constexpr RawFrameType GetToneMappedRawFrameType(RawFrameType RFT)
+	{
+		switch (RFT)
+		{
+		case RawFrameType::P010: return RawFrameType::NV12;
+		case RawFrameType::Y16: return RawFrameType::Y8;
+		default: return RFT;
+		}
+	}
+
+	// 统计 16 位亮度平面的分布，取 `Percent` 和 `100 - Percent` 百分位作为窗口。隔行隔列采样即可
+	inline void MeasureLumaWindow16(const uint8_t* pSrc, int32_t SrcPitch, uint32_t Width, uint32_t Height, float Percent, uint16_t& Low, uint16_t& High)
+	{
+		constexpr uint32_t NumBins = 1024;
+		uint32_t Histogram[NumBins] = {};
+		uint16_t MinValue = 65535, MaxValue = 0;
+		for (uint32_t y = 0; y < Height; y += 2)
+		{
+			const uint16_t* pRow = reinterpret_cast<const uint16_t*>(pSrc + ptrdiff_t(y) * SrcPitch);
+			for (uint32_t x = 0; x < Width; x += 2)
+			{
+				if (pRow[x] < MinValue) MinValue = pRow[x];
+				if (pRow[x] > MaxValue) MaxValue = pRow[x];
+			}
+		}
+		if (MaxValue <= MinValue)
+		{
+			Low = MinValue;
+			High = MaxValue;
+			return;
+		}
+
+		// 在实际的取值范围内分桶，动态范围很小的热成像数据也有足够的精度
+		uint32_t Span = uint32_t(MaxValue - MinValue) + 1;
+		uint32_t Count = 0;
+		for (uint32_t y = 0; y < Height; y += 2)
+		{
+			const uint16_t* pRow = reinterpret_cast<const uint16_t*>(pSrc + ptrdiff_t(y) * SrcPitch);
+			for (uint32_t x = 0; x < Width; x += 2)
+			{
+				Histogram[uint64_t(pRow[x] - MinValue) * NumBins / Span]++;
+				Count++;
+			}
+		}
+
+		uint32_t Clip = uint32_t(Count * Percent / 100.0f);
+		uint32_t LowBin = 0, HighBin = NumBins - 1;
+		for (uint32_t Sum = 0; LowBin < NumBins - 1; LowBin++)
+		{
+			Sum += Histogram[LowBin];
+			if (Sum > Clip) break;
+		}
+		for (uint32_t Sum = 0; HighBin > LowBin; HighBin--)
+		{
+			Sum += Histogram[HighBin];
+			if (Sum > Clip) break;
+		}
+		Low = uint16_t(MinValue + uint64_t(LowBin) * Span / NumBins);
+		High = uint16_t(MinValue + (uint64_t(HighBin) + 1) * Span / NumBins - 1);
+	}
+}
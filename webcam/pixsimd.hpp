@@ -0,0 +1,526 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+// x64 总是有 SSE2；AVX2 只在编译器开启了（/arch:AVX2 或 -mavx2）时使用。定义 `WEBCAM_NO_SIMD` 可以只用逐像素的版本
+#if !defined(WEBCAM_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define WEBCAM_SIMD_SSE2
+#include <emmintrin.h>
+#if defined(__AVX2__)
+#define WEBCAM_SIMD_AVX2
+#include <immintrin.h>
+#endif
+#endif
+
+namespace WindowsWebCamTypeLib
+{
+	// 有向量化行函数的输出格式，由输出格式的 `SimdOutput` 指明
+	enum class SimdOutputType
+	{
+		None,
+		RGBA8,
+		BGRA8,
+		Gray8,
+		RGBA16,
+		Gray16
+	};
+
+	template<typename DstTraits>
+	inline constexpr SimdOutputType SimdOutputOf = []()
+	{
+		if constexpr (requires { DstTraits::SimdOutput; }) return DstTraits::SimdOutput;
+		else return SimdOutputType::None;
+	}();
+
+	//-------------------------------------------------------------------
+	// SIMD row kernels
+	//
+	// Each function converts the leading pixels of one row, 16 at a
+	// time with AVX2 and then 8 at a time with SSE2, and returns how
+	// many it converted; the caller finishes the row with the per-pixel
+	// kernel. A pair of source and output formats without a vector path
+	// returns 0. The arithmetic is the same fixed-point BT.601 as
+	// `ConvertYUVToRGBA8()`, `ConvertYUVToRGB16()` and
+	// `VideoRangeLumaTable`, so the output matches the per-pixel
+	// kernels bit for bit. No function reads or writes past the pixels
+	// it converts.
+	//-------------------------------------------------------------------
+
+	namespace PixSimd
+	{
+		template<SimdOutputType Out>
+		inline constexpr size_t OutputBytes = Out == SimdOutputType::Gray8 ? 1 : Out == SimdOutputType::Gray16 ? 2 : Out == SimdOutputType::RGBA16 ? 8 : 4;
+
+		// 8 位的源格式可以输出 8 位的格式，16 位的源格式可以输出 16 位的格式
+		template<SimdOutputType Out, size_t SampleBytes>
+		inline constexpr bool CanConvert = SampleBytes == 1 ?
+			(Out == SimdOutputType::RGBA8 || Out == SimdOutputType::BGRA8 || Out == SimdOutputType::Gray8) :
+			(Out == SimdOutputType::RGBA16 || Out == SimdOutputType::Gray16);
+
+		// 每 32 位的低 16 位和高 16 位系数，用于 `madd`
+		inline constexpr int32_t Coef(int16_t Lo, int16_t Hi)
+		{
+			return int32_t(uint32_t(uint16_t(Lo)) | (uint32_t(uint16_t(Hi)) << 16));
+		}
+
+		// 16 位的 Y 要减去 16 << 8，再加上舍入的 128；再减去 32768 << 8，饱和到有符号 16 位后翻转符号位即为 0 到 65535 的钳位
+		inline constexpr int32_t Bias16 = 128 - 298 * (16 << 8) - (32768 << 8);
+
+#ifdef WEBCAM_SIMD_SSE2
+		// 每 32 位里低 16 位是在前的色度采样，高 16 位是在后的色度采样。拆开之后每个采样复制给相邻的两个像素
+		template<bool CbFirst>
+		inline void SplitChroma(__m128i Pairs, __m128i& Cb, __m128i& Cr)
+		{
+			__m128i First = _mm_and_si128(Pairs, _mm_set1_epi32(0xFFFF));
+			__m128i Second = _mm_srli_epi32(Pairs, 16);
+			First = _mm_or_si128(First, _mm_slli_epi32(First, 16));
+			Second = _mm_or_si128(Second, _mm_slli_epi32(Second, 16));
+			Cb = CbFirst ? First : Second;
+			Cr = CbFirst ? Second : First;
+		}
+
+		inline __m128i PackRound8(__m128i Lo, __m128i Hi)
+		{
+			const __m128i Round = _mm_set1_epi32(128);
+			return _mm_packs_epi32(_mm_srai_epi32(_mm_add_epi32(Lo, Round), 8), _mm_srai_epi32(_mm_add_epi32(Hi, Round), 8));
+		}
+
+		// `Y` `Cb` `Cr` 各是 8 个 16 位的采样，写入 8 个像素
+		template<bool BGR>
+		inline void StoreRGBA8(uint8_t* pDst, __m128i Y, __m128i Cb, __m128i Cr)
+		{
+			__m128i c = _mm_sub_epi16(Y, _mm_set1_epi16(16));
+			__m128i d = _mm_sub_epi16(Cb, _mm_set1_epi16(128));
+			__m128i e = _mm_sub_epi16(Cr, _mm_set1_epi16(128));
+			__m128i cd0 = _mm_unpacklo_epi16(c, d), cd1 = _mm_unpackhi_epi16(c, d);
+			__m128i ce0 = _mm_unpacklo_epi16(c, e), ce1 = _mm_unpackhi_epi16(c, e);
+
+			const __m128i kR = _mm_set1_epi32(Coef(298, 409));
+			const __m128i kG0 = _mm_set1_epi32(Coef(298, -100));
+			const __m128i kG1 = _mm_set1_epi32(Coef(0, -208));
+			const __m128i kB = _mm_set1_epi32(Coef(298, 516));
+			__m128i R = PackRound8(_mm_madd_epi16(ce0, kR), _mm_madd_epi16(ce1, kR));
+			__m128i G = PackRound8(
+				_mm_add_epi32(_mm_madd_epi16(cd0, kG0), _mm_madd_epi16(ce0, kG1)),
+				_mm_add_epi32(_mm_madd_epi16(cd1, kG0), _mm_madd_epi16(ce1, kG1)));
+			__m128i B = PackRound8(_mm_madd_epi16(cd0, kB), _mm_madd_epi16(cd1, kB));
+
+			// 低 8 字节是钳位后的通道值
+			R = _mm_packus_epi16(R, R);
+			G = _mm_packus_epi16(G, G);
+			B = _mm_packus_epi16(B, B);
+			__m128i XG = _mm_unpacklo_epi8(BGR ? B : R, G);
+			__m128i XA = _mm_unpacklo_epi8(BGR ? R : B, _mm_set1_epi8(-1));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(pDst), _mm_unpacklo_epi16(XG, XA));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + 16), _mm_unpackhi_epi16(XG, XA));
+		}
+
+		// 视频范围的亮度扩展到全范围，与 `VideoRangeLumaTable` 相同
+		inline void StoreGray8(uint8_t* pDst, __m128i Y)
+		{
+			__m128i c = _mm_sub_epi16(Y, _mm_set1_epi16(16));
+			const __m128i k = _mm_set1_epi32(Coef(298, 0));
+			__m128i v = PackRound8(_mm_madd_epi16(_mm_unpacklo_epi16(c, c), k), _mm_madd_epi16(_mm_unpackhi_epi16(c, c), k));
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(pDst), _mm_packus_epi16(v, v));
+		}
+
+		// 16 位无符号数乘 298 的 32 位积
+		inline void MulY16(__m128i Y, __m128i& Lo, __m128i& Hi)
+		{
+			const __m128i k = _mm_set1_epi16(298);
+			__m128i ProdLo = _mm_mullo_epi16(Y, k);
+			__m128i ProdHi = _mm_mulhi_epu16(Y, k);
+			Lo = _mm_unpacklo_epi16(ProdLo, ProdHi);
+			Hi = _mm_unpackhi_epi16(ProdLo, ProdHi);
+		}
+
+		inline __m128i PackClamp16(__m128i Lo, __m128i Hi)
+		{
+			return _mm_xor_si128(_mm_packs_epi32(_mm_srai_epi32(Lo, 8), _mm_srai_epi32(Hi, 8)), _mm_set1_epi16(-32768));
+		}
+
+		inline void StoreRGBA16(uint8_t* pDst, __m128i R, __m128i G, __m128i B)
+		{
+			const __m128i A = _mm_set1_epi16(-1);
+			__m128i RG0 = _mm_unpacklo_epi16(R, G), RG1 = _mm_unpackhi_epi16(R, G);
+			__m128i BA0 = _mm_unpacklo_epi16(B, A), BA1 = _mm_unpackhi_epi16(B, A);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(pDst), _mm_unpacklo_epi32(RG0, BA0));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + 16), _mm_unpackhi_epi32(RG0, BA0));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + 32), _mm_unpacklo_epi32(RG1, BA1));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + 48), _mm_unpackhi_epi32(RG1, BA1));
+		}
+
+		// 16 位的采样，系数与 `ConvertYUVToRGB16()` 相同
+		inline void StoreYUV16ToRGBA16(uint8_t* pDst, __m128i Y, __m128i Cb, __m128i Cr)
+		{
+			__m128i y0, y1;
+			MulY16(Y, y0, y1);
+			const __m128i Bias = _mm_set1_epi32(Bias16);
+			y0 = _mm_add_epi32(y0, Bias);
+			y1 = _mm_add_epi32(y1, Bias);
+
+			// 色度减去 32768 正好是有符号 16 位
+			const __m128i Flip = _mm_set1_epi16(-32768);
+			__m128i d = _mm_xor_si128(Cb, Flip);
+			__m128i e = _mm_xor_si128(Cr, Flip);
+			__m128i de0 = _mm_unpacklo_epi16(d, e), de1 = _mm_unpackhi_epi16(d, e);
+
+			const __m128i kR = _mm_set1_epi32(Coef(0, 409));
+			const __m128i kG = _mm_set1_epi32(Coef(-100, -208));
+			const __m128i kB = _mm_set1_epi32(Coef(516, 0));
+			__m128i R = PackClamp16(_mm_add_epi32(y0, _mm_madd_epi16(de0, kR)), _mm_add_epi32(y1, _mm_madd_epi16(de1, kR)));
+			__m128i G = PackClamp16(_mm_add_epi32(y0, _mm_madd_epi16(de0, kG)), _mm_add_epi32(y1, _mm_madd_epi16(de1, kG)));
+			__m128i B = PackClamp16(_mm_add_epi32(y0, _mm_madd_epi16(de0, kB)), _mm_add_epi32(y1, _mm_madd_epi16(de1, kB)));
+			StoreRGBA16(pDst, R, G, B);
+		}
+
+		template<SimdOutputType Out>
+		inline void StoreYUV(uint8_t* pDst, __m128i Y, __m128i Cb, __m128i Cr)
+		{
+			if constexpr (Out == SimdOutputType::RGBA8) StoreRGBA8<false>(pDst, Y, Cb, Cr);
+			else if constexpr (Out == SimdOutputType::BGRA8) StoreRGBA8<true>(pDst, Y, Cb, Cr);
+			else if constexpr (Out == SimdOutputType::RGBA16) StoreYUV16ToRGBA16(pDst, Y, Cb, Cr);
+		}
+
+		template<SimdOutputType Out>
+		inline void StoreLuma(uint8_t* pDst, __m128i Y)
+		{
+			if constexpr (Out == SimdOutputType::Gray8) StoreGray8(pDst, Y);
+			else if constexpr (Out == SimdOutputType::Gray16) _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst), Y);
+		}
+
+		// 读入 8 个亮度采样，扩展到 16 位
+		template<size_t SampleBytes>
+		inline __m128i LoadLuma(const uint8_t* p)
+		{
+			if constexpr (SampleBytes == 1) return _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)), _mm_setzero_si128());
+			else return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+		}
+
+		// 读入 8 个像素所用的 4 个色度采样，每个复制两份
+		template<size_t SampleBytes>
+		inline __m128i LoadChromaPlane(const uint8_t* p)
+		{
+			if constexpr (SampleBytes == 1)
+			{
+				int32_t v;
+				memcpy(&v, p, sizeof v);
+				__m128i x = _mm_unpacklo_epi8(_mm_cvtsi32_si128(v), _mm_setzero_si128());
+				return _mm_unpacklo_epi16(x, x);
+			}
+			else
+			{
+				__m128i x = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p));
+				return _mm_unpacklo_epi16(x, x);
+			}
+		}
+
+		template<size_t SampleBytes>
+		inline __m128i LoadChromaPairs(const uint8_t* p)
+		{
+			if constexpr (SampleBytes == 1) return _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)), _mm_setzero_si128());
+			else return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+		}
+#endif
+
+#ifdef WEBCAM_SIMD_AVX2
+		template<bool CbFirst>
+		inline void SplitChroma(__m256i Pairs, __m256i& Cb, __m256i& Cr)
+		{
+			__m256i First = _mm256_and_si256(Pairs, _mm256_set1_epi32(0xFFFF));
+			__m256i Second = _mm256_srli_epi32(Pairs, 16);
+			First = _mm256_or_si256(First, _mm256_slli_epi32(First, 16));
+			Second = _mm256_or_si256(Second, _mm256_slli_epi32(Second, 16));
+			Cb = CbFirst ? First : Second;
+			Cr = CbFirst ? Second : First;
+		}
+
+		// `unpacklo`/`unpackhi` 和 `packs` 都在 128 位的两半内各自进行，成对使用时像素的顺序不变
+		inline __m256i PackRound8(__m256i Lo, __m256i Hi)
+		{
+			const __m256i Round = _mm256_set1_epi32(128);
+			return _mm256_packs_epi32(_mm256_srai_epi32(_mm256_add_epi32(Lo, Round), 8), _mm256_srai_epi32(_mm256_add_epi32(Hi, Round), 8));
+		}
+
+		// 写入 16 个像素。交错之后低半边是第 0 到 3、8 到 11 个像素，高半边是第 4 到 7、12 到 15 个像素
+		template<bool BGR>
+		inline void StoreRGBA8(uint8_t* pDst, __m256i Y, __m256i Cb, __m256i Cr)
+		{
+			__m256i c = _mm256_sub_epi16(Y, _mm256_set1_epi16(16));
+			__m256i d = _mm256_sub_epi16(Cb, _mm256_set1_epi16(128));
+			__m256i e = _mm256_sub_epi16(Cr, _mm256_set1_epi16(128));
+			__m256i cd0 = _mm256_unpacklo_epi16(c, d), cd1 = _mm256_unpackhi_epi16(c, d);
+			__m256i ce0 = _mm256_unpacklo_epi16(c, e), ce1 = _mm256_unpackhi_epi16(c, e);
+
+			const __m256i kR = _mm256_set1_epi32(Coef(298, 409));
+			const __m256i kG0 = _mm256_set1_epi32(Coef(298, -100));
+			const __m256i kG1 = _mm256_set1_epi32(Coef(0, -208));
+			const __m256i kB = _mm256_set1_epi32(Coef(298, 516));
+			__m256i R = PackRound8(_mm256_madd_epi16(ce0, kR), _mm256_madd_epi16(ce1, kR));
+			__m256i G = PackRound8(
+				_mm256_add_epi32(_mm256_madd_epi16(cd0, kG0), _mm256_madd_epi16(ce0, kG1)),
+				_mm256_add_epi32(_mm256_madd_epi16(cd1, kG0), _mm256_madd_epi16(ce1, kG1)));
+			__m256i B = PackRound8(_mm256_madd_epi16(cd0, kB), _mm256_madd_epi16(cd1, kB));
+
+			R = _mm256_packus_epi16(R, R);
+			G = _mm256_packus_epi16(G, G);
+			B = _mm256_packus_epi16(B, B);
+			__m256i XG = _mm256_unpacklo_epi8(BGR ? B : R, G);
+			__m256i XA = _mm256_unpacklo_epi8(BGR ? R : B, _mm256_set1_epi8(-1));
+			__m256i Lo = _mm256_unpacklo_epi16(XG, XA);
+			__m256i Hi = _mm256_unpackhi_epi16(XG, XA);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst), _mm256_permute2x128_si256(Lo, Hi, 0x20));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst + 32), _mm256_permute2x128_si256(Lo, Hi, 0x31));
+		}
+
+		inline void StoreGray8(uint8_t* pDst, __m256i Y)
+		{
+			__m256i c = _mm256_sub_epi16(Y, _mm256_set1_epi16(16));
+			const __m256i k = _mm256_set1_epi32(Coef(298, 0));
+			__m256i v = PackRound8(_mm256_madd_epi16(_mm256_unpacklo_epi16(c, c), k), _mm256_madd_epi16(_mm256_unpackhi_epi16(c, c), k));
+			v = _mm256_permute4x64_epi64(_mm256_packus_epi16(v, v), 0x08);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(pDst), _mm256_castsi256_si128(v));
+		}
+
+		inline void MulY16(__m256i Y, __m256i& Lo, __m256i& Hi)
+		{
+			const __m256i k = _mm256_set1_epi16(298);
+			__m256i ProdLo = _mm256_mullo_epi16(Y, k);
+			__m256i ProdHi = _mm256_mulhi_epu16(Y, k);
+			Lo = _mm256_unpacklo_epi16(ProdLo, ProdHi);
+			Hi = _mm256_unpackhi_epi16(ProdLo, ProdHi);
+		}
+
+		inline __m256i PackClamp16(__m256i Lo, __m256i Hi)
+		{
+			return _mm256_xor_si256(_mm256_packs_epi32(_mm256_srai_epi32(Lo, 8), _mm256_srai_epi32(Hi, 8)), _mm256_set1_epi16(-32768));
+		}
+
+		// 交错之后每 256 位是两半各两个像素，第 0 个是像素 0 1 与 8 9，第 1 个是 2 3 与 10 11，依此类推
+		inline void StoreRGBA16(uint8_t* pDst, __m256i R, __m256i G, __m256i B)
+		{
+			const __m256i A = _mm256_set1_epi16(-1);
+			__m256i RG0 = _mm256_unpacklo_epi16(R, G), RG1 = _mm256_unpackhi_epi16(R, G);
+			__m256i BA0 = _mm256_unpacklo_epi16(B, A), BA1 = _mm256_unpackhi_epi16(B, A);
+			__m256i P0 = _mm256_unpacklo_epi32(RG0, BA0);
+			__m256i P1 = _mm256_unpackhi_epi32(RG0, BA0);
+			__m256i P2 = _mm256_unpacklo_epi32(RG1, BA1);
+			__m256i P3 = _mm256_unpackhi_epi32(RG1, BA1);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst), _mm256_permute2x128_si256(P0, P1, 0x20));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst + 32), _mm256_permute2x128_si256(P2, P3, 0x20));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst + 64), _mm256_permute2x128_si256(P0, P1, 0x31));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst + 96), _mm256_permute2x128_si256(P2, P3, 0x31));
+		}
+
+		inline void StoreYUV16ToRGBA16(uint8_t* pDst, __m256i Y, __m256i Cb, __m256i Cr)
+		{
+			__m256i y0, y1;
+			MulY16(Y, y0, y1);
+			const __m256i Bias = _mm256_set1_epi32(Bias16);
+			y0 = _mm256_add_epi32(y0, Bias);
+			y1 = _mm256_add_epi32(y1, Bias);
+
+			const __m256i Flip = _mm256_set1_epi16(-32768);
+			__m256i d = _mm256_xor_si256(Cb, Flip);
+			__m256i e = _mm256_xor_si256(Cr, Flip);
+			__m256i de0 = _mm256_unpacklo_epi16(d, e), de1 = _mm256_unpackhi_epi16(d, e);
+
+			const __m256i kR = _mm256_set1_epi32(Coef(0, 409));
+			const __m256i kG = _mm256_set1_epi32(Coef(-100, -208));
+			const __m256i kB = _mm256_set1_epi32(Coef(516, 0));
+			__m256i R = PackClamp16(_mm256_add_epi32(y0, _mm256_madd_epi16(de0, kR)), _mm256_add_epi32(y1, _mm256_madd_epi16(de1, kR)));
+			__m256i G = PackClamp16(_mm256_add_epi32(y0, _mm256_madd_epi16(de0, kG)), _mm256_add_epi32(y1, _mm256_madd_epi16(de1, kG)));
+			__m256i B = PackClamp16(_mm256_add_epi32(y0, _mm256_madd_epi16(de0, kB)), _mm256_add_epi32(y1, _mm256_madd_epi16(de1, kB)));
+			StoreRGBA16(pDst, R, G, B);
+		}
+
+		template<SimdOutputType Out>
+		inline void StoreYUV(uint8_t* pDst, __m256i Y, __m256i Cb, __m256i Cr)
+		{
+			if constexpr (Out == SimdOutputType::RGBA8) StoreRGBA8<false>(pDst, Y, Cb, Cr);
+			else if constexpr (Out == SimdOutputType::BGRA8) StoreRGBA8<true>(pDst, Y, Cb, Cr);
+			else if constexpr (Out == SimdOutputType::RGBA16) StoreYUV16ToRGBA16(pDst, Y, Cb, Cr);
+		}
+
+		template<SimdOutputType Out>
+		inline void StoreLuma(uint8_t* pDst, __m256i Y)
+		{
+			if constexpr (Out == SimdOutputType::Gray8) StoreGray8(pDst, Y);
+			else if constexpr (Out == SimdOutputType::Gray16) _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst), Y);
+		}
+
+		template<size_t SampleBytes>
+		inline __m256i LoadLuma256(const uint8_t* p)
+		{
+			if constexpr (SampleBytes == 1) return _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+			else return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+		}
+
+		template<size_t SampleBytes>
+		inline __m256i LoadChromaPlane256(const uint8_t* p)
+		{
+			__m256i x;
+			if constexpr (SampleBytes == 1) x = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+			else x = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+			return _mm256_or_si256(x, _mm256_slli_epi32(x, 16));
+		}
+
+		template<size_t SampleBytes>
+		inline __m256i LoadChromaPairs256(const uint8_t* p)
+		{
+			if constexpr (SampleBytes == 1) return _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+			else return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+		}
+#endif
+
+		// 4:2:0 格式的一行。交错的色度从 `pCb` 和 `pCr` 中靠前的一个开始读
+		template<SimdOutputType Out, bool Interleaved, bool CrFirst, size_t SampleBytes>
+		inline uint32_t ConvertYUV420Row([[maybe_unused]] uint8_t* pDst, [[maybe_unused]] const uint8_t* pY, const uint8_t* pCb, const uint8_t* pCr, [[maybe_unused]] uint32_t Width)
+		{
+			uint32_t x = 0;
+			if constexpr (CanConvert<Out, SampleBytes>)
+			{
+				[[maybe_unused]] constexpr bool LumaOnly = Out == SimdOutputType::Gray8 || Out == SimdOutputType::Gray16;
+				[[maybe_unused]] constexpr size_t ChromaStep = (Interleaved ? 2 : 1) * SampleBytes;
+				[[maybe_unused]] const uint8_t* pPairs = CrFirst ? pCr : pCb;
+#ifdef WEBCAM_SIMD_AVX2
+				for (; x + 16 <= Width; x += 16)
+				{
+					__m256i Y = LoadLuma256<SampleBytes>(pY + size_t(x) * SampleBytes);
+					uint8_t* p = pDst + size_t(x) * OutputBytes<Out>;
+					if constexpr (LumaOnly) StoreLuma<Out>(p, Y);
+					else
+					{
+						__m256i Cb, Cr;
+						size_t c = size_t(x / 2) * ChromaStep;
+						if constexpr (Interleaved) SplitChroma<!CrFirst>(LoadChromaPairs256<SampleBytes>(pPairs + c), Cb, Cr);
+						else
+						{
+							Cb = LoadChromaPlane256<SampleBytes>(pCb + c);
+							Cr = LoadChromaPlane256<SampleBytes>(pCr + c);
+						}
+						StoreYUV<Out>(p, Y, Cb, Cr);
+					}
+				}
+#endif
+#ifdef WEBCAM_SIMD_SSE2
+				for (; x + 8 <= Width; x += 8)
+				{
+					__m128i Y = LoadLuma<SampleBytes>(pY + size_t(x) * SampleBytes);
+					uint8_t* p = pDst + size_t(x) * OutputBytes<Out>;
+					if constexpr (LumaOnly) StoreLuma<Out>(p, Y);
+					else
+					{
+						__m128i Cb, Cr;
+						size_t c = size_t(x / 2) * ChromaStep;
+						if constexpr (Interleaved) SplitChroma<!CrFirst>(LoadChromaPairs<SampleBytes>(pPairs + c), Cb, Cr);
+						else
+						{
+							Cb = LoadChromaPlane<SampleBytes>(pCb + c);
+							Cr = LoadChromaPlane<SampleBytes>(pCr + c);
+						}
+						StoreYUV<Out>(p, Y, Cb, Cr);
+					}
+				}
+#endif
+			}
+			return x;
+		}
+
+		// 4:2:2 打包格式的一行，参数与 `PackedYUV422Traits` 相同。亮度在偶数字节或者奇数字节，色度在另外一半
+		template<SimdOutputType Out, size_t OffsetY0, size_t OffsetU, size_t OffsetY1, size_t OffsetV>
+		inline uint32_t ConvertPackedYUV422Row([[maybe_unused]] uint8_t* pDst, [[maybe_unused]] const uint8_t* pSrc, [[maybe_unused]] uint32_t Width)
+		{
+			static_assert(OffsetY0 % 2 == OffsetY1 % 2 && OffsetU % 2 == OffsetV % 2 && OffsetY0 % 2 != OffsetU % 2, "Luma and chroma samples must alternate.");
+			uint32_t x = 0;
+			if constexpr (CanConvert<Out, 1>)
+			{
+				[[maybe_unused]] constexpr bool LumaOdd = OffsetY0 % 2 == 1;
+				[[maybe_unused]] constexpr bool CbFirst = OffsetU < OffsetV;
+#ifdef WEBCAM_SIMD_AVX2
+				for (; x + 16 <= Width; x += 16)
+				{
+					__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc + size_t(x) * 2));
+					__m256i Even = _mm256_and_si256(v, _mm256_set1_epi16(0xFF));
+					__m256i Odd = _mm256_srli_epi16(v, 8);
+					uint8_t* p = pDst + size_t(x) * OutputBytes<Out>;
+					if constexpr (Out == SimdOutputType::Gray8) StoreLuma<Out>(p, LumaOdd ? Odd : Even);
+					else
+					{
+						__m256i Cb, Cr;
+						SplitChroma<CbFirst>(LumaOdd ? Even : Odd, Cb, Cr);
+						StoreYUV<Out>(p, LumaOdd ? Odd : Even, Cb, Cr);
+					}
+				}
+#endif
+#ifdef WEBCAM_SIMD_SSE2
+				for (; x + 8 <= Width; x += 8)
+				{
+					__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + size_t(x) * 2));
+					__m128i Even = _mm_and_si128(v, _mm_set1_epi16(0xFF));
+					__m128i Odd = _mm_srli_epi16(v, 8);
+					uint8_t* p = pDst + size_t(x) * OutputBytes<Out>;
+					if constexpr (Out == SimdOutputType::Gray8) StoreLuma<Out>(p, LumaOdd ? Odd : Even);
+					else
+					{
+						__m128i Cb, Cr;
+						SplitChroma<CbFirst>(LumaOdd ? Even : Odd, Cb, Cr);
+						StoreYUV<Out>(p, LumaOdd ? Odd : Even, Cb, Cr);
+					}
+				}
+#endif
+			}
+			return x;
+		}
+
+		// 16 位灰度的一行。输出 16 位灰度时是原样复制，由调用者处理
+		template<SimdOutputType Out>
+		inline uint32_t ConvertGray16Row([[maybe_unused]] uint8_t* pDst, [[maybe_unused]] const uint8_t* pSrc, [[maybe_unused]] uint32_t Width)
+		{
+			uint32_t x = 0;
+			if constexpr (Out == SimdOutputType::RGBA16)
+			{
+#ifdef WEBCAM_SIMD_AVX2
+				for (; x + 16 <= Width; x += 16)
+				{
+					__m256i Y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc + size_t(x) * 2));
+					StoreRGBA16(pDst + size_t(x) * 8, Y, Y, Y);
+				}
+#endif
+#ifdef WEBCAM_SIMD_SSE2
+				for (; x + 8 <= Width; x += 8)
+				{
+					__m128i Y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + size_t(x) * 2));
+					StoreRGBA16(pDst + size_t(x) * 8, Y, Y, Y);
+				}
+#endif
+			}
+			return x;
+		}
+
+		// 16 位采样取高 8 位，返回处理了的采样数
+		inline uint32_t ShiftRow16To8([[maybe_unused]] uint8_t* pDst, [[maybe_unused]] const uint8_t* pSrc, [[maybe_unused]] uint32_t Count)
+		{
+			uint32_t x = 0;
+#ifdef WEBCAM_SIMD_AVX2
+			for (; x + 32 <= Count; x += 32)
+			{
+				__m256i a = _mm256_srli_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc + size_t(x) * 2)), 8);
+				__m256i b = _mm256_srli_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc + size_t(x) * 2 + 32)), 8);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst + x), _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8));
+			}
+#endif
+#ifdef WEBCAM_SIMD_SSE2
+			for (; x + 16 <= Count; x += 16)
+			{
+				__m128i a = _mm_srli_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + size_t(x) * 2)), 8);
+				__m128i b = _mm_srli_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + size_t(x) * 2 + 16)), 8);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + x), _mm_packus_epi16(a, b));
+			}
+#endif
+			return x;
+		}
+	}
+}
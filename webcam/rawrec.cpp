@@ -0,0 +1,287 @@
+#include "rawrec.hpp"
+
+#include <Windows.h>
+
+#include <cstring>
+
+namespace WindowsWebCamTypeLib
+{
+	RawRecordFailed::RawRecordFailed(const std::string& what) noexcept :
+		std::runtime_error(what)
+	{
+	}
+
+	static constexpr char RawRecordMagic[8] = { 'W', 'C', 'R', 'A', 'W', 'R', 'E', 'C' };
+	static constexpr uint32_t RawRecordVersion = 1;
+	static constexpr uint32_t RawRecordHeaderSize = 4096;
+	static constexpr uint64_t RawRecordFrameAlign = 64;
+
+	// 按 `RawFrameType` 索引，写入文件的是名字而不是枚举值
+	static constexpr const char* RawFrameFormatNames[NumRawFrameTypes] =
+	{
+		"",
+		"RGB32",
+		"RGB24",
+		"YUY2",
+		"NV12",
+		"UYVY",
+		"YVYU",
+		"NV21",
+		"I420",
+		"YV12",
+		"Y8",
+		"P010",
+		"Y16",
+		"MJPG"
+	};
+
+	static RawFrameType GetRawFrameTypeByName(const char* Format)
+	{
+		char Name[sizeof RawRecordIndexType::Format + 1] = { 0 };
+		memcpy(Name, Format, sizeof RawRecordIndexType::Format);
+		for (size_t i = 1; i < NumRawFrameTypes; i++)
+		{
+			if (!strcmp(Name, RawFrameFormatNames[i])) return RawFrameType(i);
+		}
+		return RawFrameType::Unknown;
+	}
+
+	static uint64_t AlignUp(uint64_t Value, uint64_t Align)
+	{
+		return (Value + Align - 1) / Align * Align;
+	}
+
+	RawFrameRecorderType::RawFrameRecorderType(const std::string& Path, uint64_t SegmentSize) :
+		Path(Path)
+	{
+		SYSTEM_INFO si;
+		GetSystemInfo(&si);
+		Granularity = si.dwAllocationGranularity;
+		this->SegmentSize = AlignUp(SegmentSize ? SegmentSize : 1, Granularity);
+
+		File = CreateFileA(Path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (File == INVALID_HANDLE_VALUE)
+		{
+			File = nullptr;
+			throw RawRecordFailed("Couldn't create `" + Path + "`.");
+		}
+
+		// 文件头在 `Close()` 时写入，这里先空出来
+		WritePos = RawRecordHeaderSize;
+		try
+		{
+			MapSegment(0, WritePos);
+		}
+		catch (const RawRecordFailed&)
+		{
+			Release();
+			throw;
+		}
+	}
+
+	RawFrameRecorderType::~RawFrameRecorderType()
+	{
+		try
+		{
+			Close();
+		}
+		catch (const RawRecordFailed&)
+		{
+		}
+		Release();
+	}
+
+	void RawFrameRecorderType::UnmapView()
+	{
+		if (View) UnmapViewOfFile(View);
+		if (Mapping) CloseHandle(Mapping);
+		View = nullptr;
+		Mapping = nullptr;
+	}
+
+	void RawFrameRecorderType::Release()
+	{
+		UnmapView();
+		if (File) CloseHandle(File);
+		File = nullptr;
+	}
+
+	void RawFrameRecorderType::MapSegment(uint64_t Offset, uint64_t MinEnd)
+	{
+		UnmapView();
+
+		// 视图的起点必须按分配粒度对齐，一帧比一段还大时这一段就加长到能放下这一帧
+		ViewOffset = Offset / Granularity * Granularity;
+		ViewSize = AlignUp(MinEnd - ViewOffset, Granularity);
+		if (ViewSize < SegmentSize) ViewSize = SegmentSize;
+
+		// 映射比文件大时文件会被加长
+		uint64_t MapEnd = ViewOffset + ViewSize;
+		Mapping = CreateFileMappingA(File, nullptr, PAGE_READWRITE, DWORD(MapEnd >> 32), DWORD(MapEnd), nullptr);
+		if (!Mapping) throw RawRecordFailed("Couldn't extend `" + Path + "` to " + std::to_string(MapEnd) + " bytes.");
+
+		View = reinterpret_cast<uint8_t*>(MapViewOfFile(Mapping, FILE_MAP_WRITE, DWORD(ViewOffset >> 32), DWORD(ViewOffset), SIZE_T(ViewSize)));
+		if (!View)
+		{
+			CloseHandle(Mapping);
+			Mapping = nullptr;
+			throw RawRecordFailed("Couldn't map `" + Path + "` at " + std::to_string(ViewOffset) + ".");
+		}
+	}
+
+	void RawFrameRecorderType::WriteFrame(const void* pData, size_t Size, int32_t Pitch, uint32_t Width, uint32_t Height, RawFrameType Type, int64_t Timestamp)
+	{
+		if (!File) throw RawRecordFailed("`" + Path + "` is already closed.");
+		if (!Size || Size > 0xFFFFFFFF) throw RawRecordFailed("Bad sample size " + std::to_string(Size) + ".");
+		if (size_t(Type) >= NumRawFrameTypes || Type == RawFrameType::Unknown) throw RawRecordFailed("Unknown raw frame type.");
+
+		uint64_t Offset = AlignUp(WritePos, RawRecordFrameAlign);
+		if (!View || Offset + Size > ViewOffset + ViewSize) MapSegment(Offset, Offset + Size);
+		memcpy(View + (Offset - ViewOffset), pData, Size);
+		WritePos = Offset + Size;
+
+		RawRecordIndexType Entry = { 0 };
+		Entry.Offset = Offset;
+		Entry.Timestamp = Timestamp;
+		Entry.Size = uint32_t(Size);
+		Entry.Pitch = Pitch;
+		Entry.Width = Width;
+		Entry.Height = Height;
+		auto Name = RawFrameFormatNames[size_t(Type)];
+		memcpy(Entry.Format, Name, strlen(Name));
+		Index.push_back(Entry);
+	}
+
+	void RawFrameRecorderType::Close()
+	{
+		if (!File) return;
+		UnmapView();
+
+		RawRecordHeaderType Header = { 0 };
+		memcpy(Header.Magic, RawRecordMagic, sizeof Header.Magic);
+		Header.Version = RawRecordVersion;
+		Header.HeaderSize = RawRecordHeaderSize;
+		Header.NumFrames = Index.size();
+		Header.IndexOffset = AlignUp(WritePos, RawRecordFrameAlign);
+
+		// 索引写在数据后面，并截掉最后一段没用到的部分
+		bool Succeeded = true;
+		DWORD Written = 0;
+		size_t IndexBytes = Index.size() * sizeof(RawRecordIndexType);
+		LARGE_INTEGER Pos;
+		Pos.QuadPart = LONGLONG(Header.IndexOffset);
+		Succeeded = Succeeded && SetFilePointerEx(File, Pos, nullptr, FILE_BEGIN);
+		Succeeded = Succeeded && (!IndexBytes || (WriteFile(File, Index.data(), DWORD(IndexBytes), &Written, nullptr) && Written == IndexBytes));
+		Succeeded = Succeeded && SetEndOfFile(File);
+		Pos.QuadPart = 0;
+		Succeeded = Succeeded && SetFilePointerEx(File, Pos, nullptr, FILE_BEGIN);
+		Succeeded = Succeeded && WriteFile(File, &Header, DWORD(sizeof Header), &Written, nullptr) && Written == sizeof Header;
+
+		Release();
+		if (!Succeeded) throw RawRecordFailed("Couldn't finish writing `" + Path + "`.");
+	}
+
+	bool RawFrameRecorderType::IsOpened() const
+	{
+		return File != nullptr;
+	}
+
+	size_t RawFrameRecorderType::GetNumFrames() const
+	{
+		return Index.size();
+	}
+
+	const std::string& RawFrameRecorderType::GetPath() const
+	{
+		return Path;
+	}
+
+	RawFrameReaderType::RawFrameReaderType(const std::string& Path) :
+		Path(Path)
+	{
+		File = CreateFileA(Path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (File == INVALID_HANDLE_VALUE)
+		{
+			File = nullptr;
+			throw RawRecordFailed("Couldn't open `" + Path + "`.");
+		}
+
+		try
+		{
+			LARGE_INTEGER Size;
+			if (!GetFileSizeEx(File, &Size)) throw RawRecordFailed("Couldn't get the size of `" + Path + "`.");
+			FileSize = uint64_t(Size.QuadPart);
+			if (FileSize < RawRecordHeaderSize) throw RawRecordFailed("`" + Path + "` is not a raw frame record.");
+			if (FileSize > SIZE_T(-1)) throw RawRecordFailed("`" + Path + "` is too large to map.");
+
+			Mapping = CreateFileMappingA(File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (!Mapping) throw RawRecordFailed("Couldn't map `" + Path + "`.");
+			View = reinterpret_cast<const uint8_t*>(MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0));
+			if (!View) throw RawRecordFailed("Couldn't map `" + Path + "`.");
+
+			RawRecordHeaderType Header;
+			memcpy(&Header, View, sizeof Header);
+			if (memcmp(Header.Magic, RawRecordMagic, sizeof Header.Magic)) throw RawRecordFailed("`" + Path + "` is not a raw frame record.");
+			if (Header.Version != RawRecordVersion) throw RawRecordFailed("Unsupported raw frame record version " + std::to_string(Header.Version) + ".");
+			if (Header.IndexOffset > FileSize || Header.NumFrames > (FileSize - Header.IndexOffset) / sizeof(RawRecordIndexType))
+			{
+				throw RawRecordFailed("The frame index of `" + Path + "` is truncated.");
+			}
+
+			Index = reinterpret_cast<const RawRecordIndexType*>(View + Header.IndexOffset);
+			NumFrames = size_t(Header.NumFrames);
+		}
+		catch (const RawRecordFailed&)
+		{
+			Release();
+			throw;
+		}
+	}
+
+	RawFrameReaderType::~RawFrameReaderType()
+	{
+		Release();
+	}
+
+	void RawFrameReaderType::Release()
+	{
+		if (View) UnmapViewOfFile(View);
+		if (Mapping) CloseHandle(Mapping);
+		if (File) CloseHandle(File);
+		View = nullptr;
+		Mapping = nullptr;
+		File = nullptr;
+	}
+
+	size_t RawFrameReaderType::GetNumFrames() const
+	{
+		return NumFrames;
+	}
+
+	RecordedFrame RawFrameReaderType::GetFrame(size_t i) const
+	{
+		if (i >= NumFrames) throw std::out_of_range("Frame " + std::to_string(i) + " is out of range, `" + Path + "` has " + std::to_string(NumFrames) + " frames.");
+
+		auto& Entry = Index[i];
+		if (Entry.Offset > FileSize || Entry.Size > FileSize - Entry.Offset) throw RawRecordFailed("Frame " + std::to_string(i) + " of `" + Path + "` is outside of the file.");
+
+		RecordedFrame Ret;
+		Ret.pData = View + Entry.Offset;
+		Ret.Size = Entry.Size;
+		Ret.Pitch = Entry.Pitch;
+		Ret.Width = Entry.Width;
+		Ret.Height = Entry.Height;
+		Ret.Type = GetRawFrameTypeByName(Entry.Format);
+		Ret.Timestamp = Entry.Timestamp;
+
+		// 步长为负数时图像是倒置存储的，缓冲区开头是最后一行
+		Ret.pScanline0 = Ret.pData;
+		if (Entry.Pitch < 0 && Entry.Height) Ret.pScanline0 += ptrdiff_t(-Entry.Pitch) * (Entry.Height - 1);
+		return Ret;
+	}
+
+	const std::string& RawFrameReaderType::GetPath() const
+	{
+		return Path;
+	}
+}
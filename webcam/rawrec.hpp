@@ -0,0 +1,138 @@
+#pragma once
+
+#include "pixfmt.hpp"
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <stdexcept>
+#include <string>
+
+namespace WindowsWebCamTypeLib
+{
+	class RawRecordFailed : public std::runtime_error
+	{
+	public:
+		RawRecordFailed(const std::string& what) noexcept;
+	};
+
+	//-------------------------------------------------------------------
+	// Raw frame record file
+	//
+	// A 4 KiB header, then the samples exactly as they came out of
+	// `IMFMediaBuffer::Lock()` (each aligned to 64 bytes), then the
+	// frame index. The index has one fixed-size entry per frame, so
+	// the reader finds frame N without scanning. The index and the
+	// final header are written by `Close()`; a file that wasn't closed
+	// has no frames.
+	//-------------------------------------------------------------------
+
+	struct RawRecordHeaderType
+	{
+		char Magic[8]; // "WCRAWREC"
+		uint32_t Version;
+		uint32_t HeaderSize;
+		uint64_t NumFrames;
+		uint64_t IndexOffset;
+	};
+
+	struct RawRecordIndexType
+	{
+		uint64_t Offset;
+		int64_t Timestamp; // 100 纳秒为单位
+		uint32_t Size;
+		int32_t Pitch; // 与 Media Foundation 相同，负数表示倒置存储
+		uint32_t Width;
+		uint32_t Height;
+		char Format[8]; // 格式的名字，如 "NV12"，不受 `RawFrameType` 的顺序影响
+		uint64_t Reserved;
+	};
+
+	static_assert(sizeof(RawRecordIndexType) == 48);
+
+	//-------------------------------------------------------------------
+	// RawFrameRecorderType
+	//
+	// Appends raw samples to a record file through a memory-mapped
+	// view of `SegmentSize` bytes. Writing a frame is a copy into the
+	// view; the file is only extended and remapped when a segment is
+	// full.
+	//-------------------------------------------------------------------
+
+	class RawFrameRecorderType
+	{
+	protected:
+		std::string Path;
+		void* File = nullptr;
+		void* Mapping = nullptr;
+		uint8_t* View = nullptr;
+		uint64_t ViewOffset = 0;
+		uint64_t ViewSize = 0;
+		uint64_t SegmentSize;
+		uint64_t Granularity;
+		uint64_t WritePos = 0;
+		std::vector<RawRecordIndexType> Index;
+
+		void UnmapView();
+		void MapSegment(uint64_t Offset, uint64_t MinEnd);
+		void Release();
+
+	public:
+		RawFrameRecorderType(const std::string& Path, uint64_t SegmentSize = 256ull << 20);
+		RawFrameRecorderType(const RawFrameRecorderType&) = delete;
+		RawFrameRecorderType& operator = (const RawFrameRecorderType&) = delete;
+		~RawFrameRecorderType();
+
+		// `pData` 是缓冲区的开头，`Pitch` 为负数时第一行在缓冲区的末尾
+		void WriteFrame(const void* pData, size_t Size, int32_t Pitch, uint32_t Width, uint32_t Height, RawFrameType Type, int64_t Timestamp);
+		void Close();
+
+		bool IsOpened() const;
+		size_t GetNumFrames() const;
+		const std::string& GetPath() const;
+	};
+
+	struct RecordedFrame
+	{
+		const uint8_t* pData = nullptr;
+		const uint8_t* pScanline0 = nullptr; // 第一行的位置，可以和 `Pitch` 一起直接交给转换函数
+		size_t Size = 0;
+		int32_t Pitch = 0;
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		RawFrameType Type = RawFrameType::Unknown;
+		int64_t Timestamp = 0;
+	};
+
+	//-------------------------------------------------------------------
+	// RawFrameReaderType
+	//
+	// Maps a whole record file read-only. `GetFrame()` is a lookup in
+	// the index and returns pointers into the mapping, valid until the
+	// reader is destroyed.
+	//-------------------------------------------------------------------
+
+	class RawFrameReaderType
+	{
+	protected:
+		std::string Path;
+		void* File = nullptr;
+		void* Mapping = nullptr;
+		const uint8_t* View = nullptr;
+		uint64_t FileSize = 0;
+		const RawRecordIndexType* Index = nullptr;
+		size_t NumFrames = 0;
+
+		void Release();
+
+	public:
+		RawFrameReaderType(const std::string& Path);
+		RawFrameReaderType(const RawFrameReaderType&) = delete;
+		RawFrameReaderType& operator = (const RawFrameReaderType&) = delete;
+		~RawFrameReaderType();
+
+		size_t GetNumFrames() const;
+		RecordedFrame GetFrame(size_t Index) const;
+		const std::string& GetPath() const;
+	};
+}
@@ -0,0 +1,144 @@
+#include "snapshot.hpp"
+
+#include <cstring>
+
+namespace WindowsWebCamTypeLib
+{
+	SnapshotServiceType::SnapshotServiceType(size_t NumWorkers, size_t MaxQueued) :
+		MaxQueued(MaxQueued ? MaxQueued : 1)
+	{
+		if (!NumWorkers)
+		{
+			NumWorkers = std::thread::hardware_concurrency();
+			NumWorkers = NumWorkers > 1 ? NumWorkers - 1 : 1;
+		}
+		for (size_t i = 0; i < NumWorkers; i++)
+		{
+			Workers.push_back(std::thread(&SnapshotServiceType::WorkerProc, this));
+		}
+	}
+
+	SnapshotServiceType::~SnapshotServiceType()
+	{
+		{
+			auto lock = std::scoped_lock(Lock);
+			Quit = true;
+		}
+		JobQueued.notify_all();
+		for (auto& w : Workers) w.join();
+	}
+
+	std::unique_ptr<Image_RGBA8> SnapshotServiceType::AcquireImage(uint32_t Width, uint32_t Height)
+	{
+		while (FreeImages.size())
+		{
+			auto Image = std::move(FreeImages.back());
+			FreeImages.pop_back();
+			if (Image->GetWidth() == Width && Image->GetHeight() == Height) return Image;
+		}
+		return nullptr;
+	}
+
+	bool SnapshotServiceType::Submit(const Image_RGBA8& Frame, const std::string& Path, SnapshotFileType FileType, int Quality, SnapshotDoneCBType OnDone, void* Userdata)
+	{
+		if (Quality < 0 || Quality > 100) throw std::invalid_argument("Bad JPEG quality " + std::to_string(Quality) + ", should be 1 to 100, or 0 for the default.");
+
+		std::unique_ptr<Image_RGBA8> Image;
+		{
+			auto lock = std::scoped_lock(Lock);
+			if (Jobs.size() + NumReserved >= MaxQueued)
+			{
+				NumDropped++;
+				return false;
+			}
+			NumReserved++;
+			if (!Quality) Quality = this->Quality;
+			Image = AcquireImage(Frame.GetWidth(), Frame.GetHeight());
+		}
+
+		// 复制帧的时候不持有锁，编码线程可以同时取走别的任务
+		if (!Image) Image = std::make_unique<Image_RGBA8>(Frame.GetWidth(), Frame.GetHeight(), Pixel_RGBA8(0, 0, 0, 255));
+		memcpy(Image->GetBitmapDataPtr(), Frame.GetBitmapDataPtr(), Frame.GetBitmapSizeInTotal());
+
+		{
+			auto lock = std::scoped_lock(Lock);
+			NumReserved--;
+			Jobs.push_back(JobType{ std::move(Image), Path, FileType, Quality, OnDone, Userdata });
+		}
+		JobQueued.notify_one();
+		return true;
+	}
+
+	void SnapshotServiceType::WorkerProc()
+	{
+		auto lock = std::unique_lock(Lock);
+		for (;;)
+		{
+			JobQueued.wait(lock, [this]() { return Quit || Jobs.size(); });
+			if (Jobs.empty()) return;
+
+			auto Job = std::move(Jobs.front());
+			Jobs.pop_front();
+			NumBusy++;
+			lock.unlock();
+
+			bool Succeeded = false;
+			std::string Error;
+			try
+			{
+				switch (Job.FileType)
+				{
+				case SnapshotFileType::JPG: Succeeded = Job.Image->SaveToJPG(Job.Path, Job.Quality); break;
+				case SnapshotFileType::PNG: Succeeded = Job.Image->SaveToPNG(Job.Path); break;
+				}
+				if (!Succeeded) Error = "Couldn't write `" + Job.Path + "`.";
+			}
+			catch (const std::exception& e)
+			{
+				Error = e.what();
+			}
+			if (Job.OnDone) Job.OnDone(Job.Userdata, Job.Path, Succeeded, Error);
+
+			lock.lock();
+			if (FreeImages.size() < MaxQueued + Workers.size()) FreeImages.push_back(std::move(Job.Image));
+			NumBusy--;
+			if (Jobs.empty() && !NumBusy) JobFinished.notify_all();
+		}
+	}
+
+	void SnapshotServiceType::Flush()
+	{
+		auto lock = std::unique_lock(Lock);
+		JobFinished.wait(lock, [this]() { return Jobs.empty() && !NumReserved && !NumBusy; });
+	}
+
+	void SnapshotServiceType::SetQuality(int Quality)
+	{
+		if (Quality < 1 || Quality > 100) throw std::invalid_argument("Bad JPEG quality " + std::to_string(Quality) + ", should be 1 to 100.");
+		auto lock = std::scoped_lock(Lock);
+		this->Quality = Quality;
+	}
+
+	int SnapshotServiceType::GetQuality() const
+	{
+		auto lock = std::scoped_lock(Lock);
+		return Quality;
+	}
+
+	size_t SnapshotServiceType::GetNumWorkers() const
+	{
+		return Workers.size();
+	}
+
+	size_t SnapshotServiceType::GetNumQueued() const
+	{
+		auto lock = std::scoped_lock(Lock);
+		return Jobs.size() + NumReserved + NumBusy;
+	}
+
+	size_t SnapshotServiceType::GetNumDropped() const
+	{
+		auto lock = std::scoped_lock(Lock);
+		return NumDropped;
+	}
+}
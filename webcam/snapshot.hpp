@@ -0,0 +1,92 @@
+#pragma once
+
+#include <unibmp/unibmp.hpp>
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <stdexcept>
+
+namespace WindowsWebCamTypeLib
+{
+	using namespace UniformBitmap;
+
+	enum class SnapshotFileType
+	{
+		JPG,
+		PNG
+	};
+
+	// 在编码线程上调用，`Succeeded` 为 false 时 `Error` 是失败的原因
+	using SnapshotDoneCBType = void (*)(void* Userdata, const std::string& Path, bool Succeeded, const std::string& Error);
+
+	//-------------------------------------------------------------------
+	// SnapshotServiceType
+	//
+	// Saves frames to JPEG/PNG files on a pool of worker threads.
+	// `Submit()` only copies the frame into a pooled image and queues
+	// it, so it is safe to call from the frame callback: when the queue
+	// is full the snapshot is dropped and `Submit()` returns false
+	// instead of waiting for the encoders.
+	//-------------------------------------------------------------------
+
+	class SnapshotServiceType
+	{
+	protected:
+		struct JobType
+		{
+			std::unique_ptr<Image_RGBA8> Image;
+			std::string Path;
+			SnapshotFileType FileType;
+			int Quality;
+			SnapshotDoneCBType OnDone;
+			void* Userdata;
+		};
+
+		mutable std::mutex Lock;
+		std::condition_variable JobQueued;
+		std::condition_variable JobFinished;
+		std::deque<JobType> Jobs;
+		std::vector<std::thread> Workers;
+
+		// 用完的图像留着给下一帧用，尺寸变了就丢掉
+		std::vector<std::unique_ptr<Image_RGBA8>> FreeImages;
+
+		size_t MaxQueued;
+		size_t NumReserved = 0;
+		size_t NumBusy = 0;
+		size_t NumDropped = 0;
+		int Quality = 95;
+		bool Quit = false;
+
+		void WorkerProc();
+		std::unique_ptr<Image_RGBA8> AcquireImage(uint32_t Width, uint32_t Height);
+
+	public:
+		// `NumWorkers` 为 0 时按 CPU 的核心数减一（至少一个）
+		SnapshotServiceType(size_t NumWorkers = 0, size_t MaxQueued = 8);
+		SnapshotServiceType(const SnapshotServiceType&) = delete;
+		SnapshotServiceType& operator = (const SnapshotServiceType&) = delete;
+
+		// 等待已经提交的快照写完
+		~SnapshotServiceType();
+
+		// `Quality` 为 0 时使用 `SetQuality()` 的设置，其它值必须在 1 到 100 之间，否则抛出 `std::invalid_argument`；PNG 忽略质量
+		bool Submit(const Image_RGBA8& Frame, const std::string& Path, SnapshotFileType FileType, int Quality = 0, SnapshotDoneCBType OnDone = nullptr, void* Userdata = nullptr);
+
+		// 等待队列中的快照全部写完
+		void Flush();
+
+		void SetQuality(int Quality);
+		int GetQuality() const;
+		size_t GetNumWorkers() const;
+		size_t GetNumQueued() const;
+		size_t GetNumDropped() const;
+	};
+}
@@ -1,4 +1,5 @@
 ﻿#include "webcam.hpp"
+#include "snapshot.hpp"
 
 #include <iostream>
 
@@ -7,6 +8,7 @@ using namespace WindowsWebCamTypeLib;
 struct UserStruct
 {
 	int NumFrames = 0;
+	SnapshotServiceType Snapshots;
 };
 
 void OnFrame(void* Userdata, WebCamType& wc, bool FrameUpdated)
@@ -14,7 +16,8 @@ void OnFrame(void* Userdata, WebCamType& wc, bool FrameUpdated)
 	auto& US = *reinterpret_cast<UserStruct*>(Userdata);
 	if (FrameUpdated)
 	{
-		wc.GetFrameBuffer().SaveToJPG(std::string("test_") + std::to_string(++US.NumFrames) + ".jpg", 100);
+		// 只复制帧，编码和写文件在后台进行
+		US.Snapshots.Submit(wc.GetFrameBuffer(), std::string("test_") + std::to_string(++US.NumFrames) + ".jpg", SnapshotFileType::JPG, 100);
 	}
 	if(US.NumFrames < 100) wc.QueryFrame();
 }
@@ -31,6 +34,7 @@ int main()
 	auto WebCam = WebCamType(OnFrame, &MyData, true);
 	WebCam.QueryFrame(); // Start sampling the camera
 	while (MyData.NumFrames < 100) std::cout << "";
+	MyData.Snapshots.Flush();
 	
 
 	return 0;
@@ -0,0 +1,78 @@
+// CameraGroupType 的扩展性测试：合成帧源不限速地给每个假摄像头送帧，转换做固定的计算量，统计不同工作线程数下的总吞吐量。
+// g++ -std=c++20 -O2 -pthread -I../.. camgroup_bench.cpp ../camgroup.cpp -o camgroup_bench && ./camgroup_bench [摄像头数] [转换微秒数]
+
+#include "../camgroup.hpp"
+#include "fakewebcam.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+using namespace WindowsWebCamTypeLib;
+
+static void OnGroupFrame(void*, CameraGroupType&, size_t, WebCamType&, bool)
+{
+}
+
+// 返回每秒转换的帧数
+static double Measure(size_t NumWorkers, size_t NumCameras, double Seconds)
+{
+	CameraGroupType Group(OnGroupFrame, nullptr, NumWorkers);
+	for (size_t i = 0; i < NumCameras; i++) Group.AddCamera(i);
+
+	std::atomic<bool> Quit = false;
+	std::thread Source([&]()
+	{
+		while (!Quit)
+		{
+			bool Delivered = false;
+			for (size_t i = 0; i < NumCameras; i++) Delivered |= FakeWebCam::DeliverFrame(Group.GetCamera(i));
+			if (!Delivered) std::this_thread::yield();
+		}
+	});
+
+	// 先跑一会儿让线程都起来，再开始计数
+	Group.Start();
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	Group.ResetStats();
+	auto Begin = std::chrono::steady_clock::now();
+	std::this_thread::sleep_for(std::chrono::duration<double>(Seconds));
+	auto Stats = Group.GetStats();
+	auto Elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - Begin).count();
+	Group.Stop();
+	Quit = true;
+	Source.join();
+
+	return double(Stats.Total.NumConverted) / Elapsed;
+}
+
+int main(int argc, char** argv)
+{
+	size_t NumCameras = argc > 1 ? size_t(std::atoi(argv[1])) : 8;
+	uint32_t ConvertMicroseconds = argc > 2 ? uint32_t(std::atoi(argv[2])) : 2000;
+
+	// 按单线程的速度换算出每次转换的计算量
+	auto CalibrateBegin = std::chrono::steady_clock::now();
+	FakeWebCam::Work(10000000);
+	double NsPerIteration = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - CalibrateBegin).count() / 10000000;
+	FakeWebCam::ConvertIterations = std::max(uint64_t(ConvertMicroseconds * 1000.0 / NsPerIteration), uint64_t(1));
+
+	size_t MaxWorkers = std::max(size_t(std::thread::hardware_concurrency()), size_t(4));
+	std::vector<size_t> WorkerCounts;
+	for (size_t n = 1; n <= MaxWorkers; n *= 2) WorkerCounts.push_back(n);
+	if (WorkerCounts.back() != MaxWorkers) WorkerCounts.push_back(MaxWorkers);
+
+	std::printf("%zu cameras, %u us per conversion, %u hardware threads\n", NumCameras, ConvertMicroseconds, std::thread::hardware_concurrency());
+	std::printf("%8s %12s %8s\n", "workers", "frames/s", "speedup");
+
+	double Baseline = 0;
+	for (auto n : WorkerCounts)
+	{
+		double Fps = Measure(n, NumCameras, 1.0);
+		if (!Baseline) Baseline = Fps;
+		std::printf("%8zu %12.1f %8.2f\n", n, Fps, Fps / Baseline);
+	}
+	return 0;
+}
@@ -0,0 +1,155 @@
+// WorkStealingPoolType 与 CameraGroupType 的压力测试，使用 fakewebcam.hpp 里的假摄像头，可以在 Linux 上运行：
+// g++ -std=c++20 -O2 -pthread -I../.. camgroup_test.cpp ../camgroup.cpp -o camgroup_test && ./camgroup_test
+
+#include "../camgroup.hpp"
+#include "fakewebcam.hpp"
+#include "check.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using namespace WindowsWebCamTypeLib;
+
+static void CountTask(void* Userdata)
+{
+	reinterpret_cast<std::atomic<size_t>*>(Userdata)->fetch_add(1);
+}
+
+// 多个线程同时提交很短的任务，同时另一个线程不停地 `Wait()`
+static void TestPoolConcurrentSubmitAndWait()
+{
+	constexpr size_t NumSubmitters = 8;
+	constexpr size_t NumTasks = 50000;
+
+	std::atomic<size_t> Executed = 0;
+	std::atomic<bool> Submitting = true;
+	WorkStealingPoolType Pool(4);
+
+	std::thread Waiter([&]()
+	{
+		while (Submitting) Pool.Wait();
+	});
+
+	std::vector<std::thread> Submitters;
+	for (size_t t = 0; t < NumSubmitters; t++)
+	{
+		Submitters.emplace_back([&, t]()
+		{
+			for (size_t i = 0; i < NumTasks; i++) Pool.Submit(CountTask, &Executed, (i & 1) ? t : SIZE_MAX);
+		});
+	}
+	for (auto& t : Submitters) t.join();
+	Pool.Wait();
+	Submitting = false;
+	Waiter.join();
+
+	CHECK(Executed == NumSubmitters * NumTasks);
+	size_t TotalExecuted = 0;
+	for (size_t i = 0; i < Pool.GetNumWorkers(); i++) TotalExecuted += Pool.GetNumExecuted(i);
+	CHECK(TotalExecuted == NumSubmitters * NumTasks);
+}
+
+struct ChainType
+{
+	WorkStealingPoolType* Pool;
+	std::atomic<size_t> Remaining;
+	std::atomic<size_t> Executed = 0;
+};
+
+static void ChainTask(void* Userdata)
+{
+	auto& Chain = *reinterpret_cast<ChainType*>(Userdata);
+	Chain.Executed++;
+	if (Chain.Remaining.fetch_sub(1) > 1) Chain.Pool->Submit(ChainTask, &Chain);
+}
+
+// 任务在工作线程上提交后续任务，`Wait()` 要等到整条链执行完
+static void TestPoolTasksSubmittingTasks()
+{
+	WorkStealingPoolType Pool(3);
+	ChainType Chains[16];
+	for (auto& c : Chains)
+	{
+		c.Pool = &Pool;
+		c.Remaining = 2000;
+		Pool.Submit(ChainTask, &c);
+	}
+	Pool.Wait();
+	for (auto& c : Chains) CHECK(c.Executed == 2000);
+
+	Pool.Submit([](void* Userdata)
+	{
+		try
+		{
+			reinterpret_cast<WorkStealingPoolType*>(Userdata)->Wait();
+		}
+		catch (const std::logic_error&)
+		{
+			return;
+		}
+		std::printf("`Wait()` on a worker thread didn't throw.\n");
+		std::_Exit(1);
+	}, &Pool);
+	Pool.Wait();
+}
+
+static std::atomic<size_t> NumGroupFrames = 0;
+
+static void OnGroupFrame(void*, CameraGroupType&, size_t, WebCamType&, bool FrameUpdated)
+{
+	if (FrameUpdated) NumGroupFrames++;
+}
+
+// 假摄像头以 60 FPS 送帧，停止之后不能再有回调
+static void TestGroupStartStop()
+{
+	constexpr size_t NumCameras = 8;
+	FakeWebCam::ConvertMicroseconds = 500;
+
+	CameraGroupType Group(OnGroupFrame, nullptr, 4);
+	for (size_t i = 0; i < NumCameras; i++) Group.AddCamera(i, i == 0 ? CameraBudget{ 10, 0 } : CameraBudget());
+
+	std::atomic<bool> Quit = false;
+	std::thread Source([&]()
+	{
+		while (!Quit)
+		{
+			for (size_t i = 0; i < NumCameras; i++) FakeWebCam::DeliverFrame(Group.GetCamera(i));
+			std::this_thread::sleep_for(std::chrono::microseconds(16667));
+		}
+	});
+
+	for (int Round = 0; Round < 3; Round++)
+	{
+		Group.Start();
+		std::this_thread::sleep_for(std::chrono::milliseconds(300));
+		Group.Stop();
+		size_t FramesAtStop = NumGroupFrames;
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		CHECK(NumGroupFrames == FramesAtStop);
+	}
+	Quit = true;
+	Source.join();
+
+	auto Stats = Group.GetStats();
+	CHECK(NumGroupFrames > 0);
+	// 停止过程中转换完的帧计入统计，但不再回调
+	CHECK(Stats.Total.NumConverted >= NumGroupFrames);
+	CHECK(Stats.Cameras[0].NumDropped > 0);
+	CHECK(Stats.Cameras[0].NumConverted < Stats.Cameras[1].NumConverted);
+}
+
+int main()
+{
+	std::atomic<bool> Done = false;
+	StartWatchdog(Done, 60, "Timed out, a `Wait()` probably missed its wakeup.");
+
+	TestPoolConcurrentSubmitAndWait();
+	TestPoolTasksSubmittingTasks();
+	TestGroupStartStop();
+
+	Done = true;
+	return ReportResults();
+}
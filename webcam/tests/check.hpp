@@ -0,0 +1,38 @@
+#pragma once
+
+// 测试程序共用的检查宏和看门狗。`CHECK()` 失败时只记录并继续，`main()` 最后返回 `ReportResults()`。
+
+#include <cstdio>
+#include <cstdlib>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+inline int NumFailed = 0;
+
+#define CHECK(cond) do { if (!(cond)) { std::printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); NumFailed++; } } while (0)
+
+// 超过 `Seconds` 秒 `Done` 还没有被置位时打印 `Message` 并直接退出，而不是让卡住的测试一直挂着
+inline void StartWatchdog(std::atomic<bool>& Done, int Seconds, const char* Message = "Timed out.")
+{
+	std::thread([&Done, Seconds, Message]()
+	{
+		for (int i = 0; i < Seconds * 10 && !Done; i++) std::this_thread::sleep_for(std::chrono::milliseconds(100));
+		if (!Done)
+		{
+			std::printf("%s\n", Message);
+			std::_Exit(2);
+		}
+	}).detach();
+}
+
+inline int ReportResults()
+{
+	if (NumFailed)
+	{
+		std::printf("%d checks failed.\n", NumFailed);
+		return 1;
+	}
+	std::printf("All tests passed.\n");
+	return 0;
+}
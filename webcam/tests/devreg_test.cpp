@@ -0,0 +1,198 @@
+// DeviceRegistryType 的测试，用假的 `DeviceEnumeratorType` 代替 Media Foundation，可以在 Linux 上运行：
+// g++ -std=c++20 -O2 -pthread -I../.. devreg_test.cpp ../devreg.cpp -o devreg_test && ./devreg_test
+
+#include "../devreg.hpp"
+#include "check.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+#include <thread>
+#include <condition_variable>
+
+using namespace WindowsWebCamTypeLib;
+
+// 每次枚举得到 `NumDevices` 个设备，名字里带着这是第几次枚举
+class FakeEnumeratorType : public DeviceEnumeratorType
+{
+public:
+	std::atomic<size_t> NumDevices = 2;
+	std::atomic<size_t> NumCalls = 0;
+
+	// 枚举过程中调用，用来模拟枚举期间发生的设备变化
+	void (*OnEnumerate)(void* Userdata) = nullptr;
+	void* Userdata = nullptr;
+
+	DeviceListType Enumerate() override
+	{
+		// 设备数在枚举开始时确定，之后的变化要等下一次枚举才能看到
+		size_t Call = ++NumCalls;
+		size_t Count = NumDevices;
+		if (OnEnumerate) OnEnumerate(Userdata);
+
+		DeviceListType List;
+		for (size_t i = 0; i < Count; i++)
+		{
+			DeviceEntry Entry;
+			Entry.SymbolicLink = "\\\\?\\fake#" + std::to_string(i);
+			Entry.SymbolicLinkW = std::wstring(Entry.SymbolicLink.begin(), Entry.SymbolicLink.end());
+			Entry.FriendlyName = "Fake Camera " + std::to_string(i) + " (enumeration " + std::to_string(Call) + ")";
+			Entry.FriendlyNameW = std::wstring(Entry.FriendlyName.begin(), Entry.FriendlyName.end());
+			List.push_back(Entry);
+		}
+		return List;
+	}
+};
+
+struct RegistryType
+{
+	FakeEnumeratorType* Enumerator;
+	DeviceRegistryType Registry;
+
+	RegistryType() :
+		Enumerator(new FakeEnumeratorType()),
+		Registry(std::unique_ptr<DeviceEnumeratorType>(Enumerator))
+	{
+	}
+};
+
+// 没有变化时一直用缓存的列表
+static void TestCacheHit()
+{
+	RegistryType r;
+	auto First = r.Registry.GetDevices();
+	auto Second = r.Registry.GetDevices();
+	CHECK(First == Second);
+	CHECK(First->size() == 2);
+	CHECK(r.Enumerator->NumCalls == 1);
+	CHECK(r.Registry.GetNumEnumerations() == 1);
+}
+
+// 失效之后重新枚举，之前拿到的快照不受影响
+static void TestInvalidate()
+{
+	RegistryType r;
+	auto Before = r.Registry.GetDevices();
+	auto Generation = r.Registry.GetGeneration();
+
+	r.Enumerator->NumDevices = 3;
+	r.Registry.Invalidate();
+	CHECK(r.Registry.GetGeneration() > Generation);
+	CHECK(r.Enumerator->NumCalls == 1);
+
+	auto After = r.Registry.GetDevices();
+	CHECK(After != Before);
+	CHECK(After->size() == 3);
+	CHECK(Before->size() == 2);
+	CHECK(Before->at(1).FriendlyName == "Fake Camera 1 (enumeration 1)");
+	CHECK(After->at(1).FriendlyName == "Fake Camera 1 (enumeration 2)");
+	CHECK(r.Registry.GetDevices() == After);
+	CHECK(r.Registry.GetNumEnumerations() == 2);
+
+	// 连续多次失效只需要重新枚举一次
+	r.Registry.Invalidate();
+	r.Registry.Invalidate();
+	r.Registry.Invalidate();
+	r.Registry.GetDevices();
+	r.Registry.GetDevices();
+	CHECK(r.Registry.GetNumEnumerations() == 3);
+}
+
+// 枚举期间发生的变化不能被这次枚举的结果掩盖
+static void TestInvalidateDuringEnumeration()
+{
+	RegistryType r;
+	r.Enumerator->Userdata = &r.Registry;
+	r.Enumerator->OnEnumerate = [](void* Userdata)
+	{
+		reinterpret_cast<DeviceRegistryType*>(Userdata)->Invalidate();
+	};
+
+	auto First = r.Registry.GetDevices();
+	r.Enumerator->OnEnumerate = nullptr;
+	auto Second = r.Registry.GetDevices();
+	CHECK(First != Second);
+	CHECK(r.Enumerator->NumCalls == 2);
+	CHECK(r.Registry.GetDevices() == Second);
+	CHECK(r.Registry.GetNumEnumerations() == 2);
+}
+
+struct BlockingEnumerationType
+{
+	DeviceRegistryType* Registry = nullptr;
+	std::mutex Lock;
+	std::condition_variable Changed;
+	bool Entered = false;
+	bool Release = false;
+};
+
+// 另一个线程在枚举进行到一半时使列表失效，同时还有别的线程在等待列表
+static void TestInvalidateFromAnotherThread()
+{
+	RegistryType r;
+	BlockingEnumerationType b;
+	b.Registry = &r.Registry;
+	r.Enumerator->Userdata = &b;
+	r.Enumerator->OnEnumerate = [](void* Userdata)
+	{
+		auto& b = *reinterpret_cast<BlockingEnumerationType*>(Userdata);
+		auto lock = std::unique_lock(b.Lock);
+		if (b.Release) return;
+		b.Entered = true;
+		b.Changed.notify_all();
+		b.Changed.wait(lock, [&b]() { return b.Release; });
+	};
+
+	std::shared_ptr<const DeviceListType> First, Waiter;
+	std::thread Enumerating([&]() { First = r.Registry.GetDevices(); });
+	{
+		auto lock = std::unique_lock(b.Lock);
+		b.Changed.wait(lock, [&b]() { return b.Entered; });
+	}
+
+	// `Invalidate()` 不需要等正在进行的枚举
+	r.Enumerator->NumDevices = 1;
+	r.Registry.Invalidate();
+	std::thread Waiting([&]() { Waiter = r.Registry.GetDevices(); });
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	{
+		auto lock = std::scoped_lock(b.Lock);
+		b.Release = true;
+	}
+	b.Changed.notify_all();
+	Enumerating.join();
+	Waiting.join();
+
+	// 等待的线程拿到的是失效之后重新枚举的列表
+	CHECK(First->size() == 2);
+	CHECK(Waiter->size() == 1);
+	CHECK(r.Enumerator->NumCalls == 2);
+	CHECK(r.Registry.GetDevices() == Waiter);
+}
+
+// 许多线程同时第一次取列表，只枚举一次
+static void TestConcurrentFirstUse()
+{
+	RegistryType r;
+	std::vector<std::thread> Threads;
+	std::vector<std::shared_ptr<const DeviceListType>> Lists(16);
+	for (size_t i = 0; i < Lists.size(); i++) Threads.emplace_back([&, i]() { Lists[i] = r.Registry.GetDevices(); });
+	for (auto& t : Threads) t.join();
+	for (auto& l : Lists) CHECK(l == Lists[0]);
+	CHECK(r.Enumerator->NumCalls == 1);
+}
+
+int main()
+{
+	std::atomic<bool> Done = false;
+	StartWatchdog(Done, 30, "Timed out, `GetDevices()` is probably stuck on the lock.");
+
+	TestCacheHit();
+	TestInvalidate();
+	TestInvalidateDuringEnumeration();
+	TestInvalidateFromAnotherThread();
+	TestConcurrentFirstUse();
+
+	Done = true;
+	return ReportResults();
+}
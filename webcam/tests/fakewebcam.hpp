@@ -0,0 +1,162 @@
+#pragma once
+
+// 不打开真实设备的 `WebCamType`，替代 webcam.cpp 和 imfcb.cpp 链接，用于在没有 Media Foundation 的系统上测试 `CameraGroupType` 和 `FrameSynchronizerType`。
+// 帧由测试里的合成帧源调用 `FakeWebCam::DeliverFrame()` 产生，“转换”只是按 `ConvertMicroseconds` 空转，
+// 或者在 `ConvertIterations` 不为 0 时做固定次数的计算，这样在线程比核心多时耗时才会按比例变长。
+// 每个测试程序只能有一个源文件包含这个头文件。
+
+#include "../webcam.hpp"
+
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <unordered_map>
+
+namespace FakeWebCam
+{
+	using namespace WindowsWebCamTypeLib;
+
+	// 和真实的摄像头一样，`SetFrameDispatcher()` 要等正在进行的调度返回，所以送帧期间一直持有 `DispatchLock`
+	struct StateType
+	{
+		std::mutex DispatchLock;
+		std::mutex Lock;
+		bool Reading = false;
+		bool Pending = false;
+		bool Dispatch = false;
+
+		// `GetFrameBuffer()` 和 `GetFrameTimestamp()` 返回的内容，由测试调用 `SetFrame()` 设置
+		std::unique_ptr<Image_RGBA8> FrameBuffer;
+		FrameTimestamp Timestamp;
+	};
+
+	inline std::mutex StatesLock;
+	inline std::unordered_map<const WebCamType*, std::shared_ptr<StateType>> States;
+	inline std::atomic<uint32_t> ConvertMicroseconds = 0;
+	inline std::atomic<uint64_t> ConvertIterations = 0;
+	inline std::atomic<size_t> NumConverted = 0;
+
+	inline std::shared_ptr<StateType> GetState(const WebCamType* wc)
+	{
+		auto lock = std::scoped_lock(StatesLock);
+		return States.at(wc);
+	}
+
+	// 在送帧之前设置下一帧的内容和时间戳
+	inline void SetFrame(WebCamType& wc, const Image_RGBA8& Frame, int64_t SystemTime)
+	{
+		auto s = GetState(&wc);
+		auto lock = std::scoped_lock(s->Lock);
+		s->FrameBuffer = std::make_unique<Image_RGBA8>(Frame);
+		s->Timestamp.SampleTime = SystemTime;
+		s->Timestamp.SystemTime = SystemTime;
+	}
+
+	inline void Spin(uint32_t Microseconds)
+	{
+		auto End = std::chrono::steady_clock::now() + std::chrono::microseconds(Microseconds);
+		while (std::chrono::steady_clock::now() < End);
+	}
+
+	inline uint64_t Work(uint64_t Iterations)
+	{
+		volatile uint64_t x = 0;
+		for (uint64_t i = 0; i < Iterations; i++) x = x * 6364136223846793005ull + i;
+		return x;
+	}
+
+	inline void Convert(WebCamType& wc)
+	{
+		if (ConvertIterations) Work(ConvertIterations);
+		else Spin(ConvertMicroseconds);
+		NumConverted++;
+		if (wc.OnFrameCB) wc.OnFrameCB(wc.Userdata, wc, true);
+	}
+
+	// 摄像头在等待帧时送出一帧，返回是否送出
+	inline bool DeliverFrame(WebCamType& wc)
+	{
+		auto s = GetState(&wc);
+		auto dispatch_lock = std::scoped_lock(s->DispatchLock);
+		bool Dispatch;
+		{
+			auto lock = std::scoped_lock(s->Lock);
+			if (!s->Reading) return false;
+			s->Reading = false;
+			Dispatch = s->Dispatch;
+			s->Pending = Dispatch;
+		}
+		if (Dispatch) wc.FrameDispatchCB(wc.FrameDispatchUserdata, wc);
+		else Convert(wc);
+		return true;
+	}
+}
+
+namespace WindowsWebCamTypeLib
+{
+	WebCamType::WebCamType(OnFrameCBType OnFrameCB, void* Userdata, bool Verbose) :
+		Verbose(Verbose),
+		Userdata(Userdata),
+		OnFrameCB(OnFrameCB)
+	{
+		auto State = std::make_shared<FakeWebCam::StateType>();
+		State->FrameBuffer = std::make_unique<Image_RGBA8>(1, 1, Pixel_RGBA8(0, 0, 0, 255));
+		auto lock = std::scoped_lock(FakeWebCam::StatesLock);
+		FakeWebCam::States[this] = State;
+	}
+
+	void WebCamType::SetDevice(size_t)
+	{
+	}
+
+	void WebCamType::SetDevice(std::string)
+	{
+	}
+
+	void WebCamType::QueryFrame()
+	{
+		auto s = FakeWebCam::GetState(this);
+		auto lock = std::scoped_lock(s->Lock);
+		s->Reading = true;
+	}
+
+	void WebCamType::SetFrameDispatcher(FrameDispatchCBType DispatchCB, void* Userdata)
+	{
+		auto s = FakeWebCam::GetState(this);
+		auto lock = std::scoped_lock(s->DispatchLock, s->Lock);
+		s->Dispatch = DispatchCB != nullptr;
+		s->Pending = false;
+		FrameDispatchCB = DispatchCB;
+		FrameDispatchUserdata = Userdata;
+	}
+
+	Image_RGBA8& WebCamType::GetFrameBuffer()
+	{
+		return *FakeWebCam::GetState(this)->FrameBuffer;
+	}
+
+	const Image_RGBA8& WebCamType::GetFrameBuffer() const
+	{
+		return *FakeWebCam::GetState(this)->FrameBuffer;
+	}
+
+	FrameTimestamp WebCamType::GetFrameTimestamp() const
+	{
+		auto s = FakeWebCam::GetState(this);
+		auto lock = std::scoped_lock(s->Lock);
+		return s->Timestamp;
+	}
+
+	bool WebCamType::ProcessPendingFrame()
+	{
+		auto s = FakeWebCam::GetState(this);
+		{
+			auto lock = std::scoped_lock(s->Lock);
+			if (!s->Pending) return false;
+			s->Pending = false;
+		}
+		FakeWebCam::Convert(*this);
+		return true;
+	}
+}
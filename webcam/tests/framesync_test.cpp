@@ -0,0 +1,326 @@
+// FrameSynchronizerType 的测试：几路带抖动的帧流，覆盖配对、丢帧、环形缓冲区溢出和时间戳倒退，可以在 Linux 上运行：
+// g++ -std=c++20 -O2 -pthread -I../.. framesync_test.cpp ../framesync.cpp -o framesync_test && ./framesync_test
+
+#include "../framesync.hpp"
+#include "fakewebcam.hpp"
+#include "check.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+using namespace WindowsWebCamTypeLib;
+
+constexpr size_t NumStreams = 3;
+constexpr size_t NumFrames = 3000;
+constexpr size_t RingSize = 4;
+constexpr int64_t Period = 1000;
+constexpr int64_t Tolerance = 400;
+
+// 帧的序号写在第一个像素里，用来检查一组里的帧是不是同一时刻拍的
+static void SetFrameIndex(Image_RGBA8& Image, size_t Index)
+{
+	auto& p = Image.GetBitmapDataPtr()[0];
+	p.R = uint8_t(Index);
+	p.G = uint8_t(Index >> 8);
+}
+
+static size_t GetFrameIndex(const Image_RGBA8& Image)
+{
+	auto& p = Image.GetBitmapDataPtr()[0];
+	return size_t(p.R) | (size_t(p.G) << 8);
+}
+
+struct CollectorType
+{
+	// 回调在锁里依次执行，这些成员不需要原子操作；`InCallback` 用来发现同时执行的回调
+	std::atomic<bool> InCallback = false;
+	size_t NumOverlapped = 0;
+	size_t NumFrameSets = 0;
+	size_t NumOutOfTolerance = 0;
+	size_t NumMixed = 0;
+	int64_t LastTimestamp = INT64_MIN;
+	size_t NumOutOfOrder = 0;
+	std::vector<size_t> TimesMatched = std::vector<size_t>(NumFrames);
+};
+
+static void OnFrameSet(void* Userdata, const FrameSetType& FrameSet)
+{
+	auto& c = *reinterpret_cast<CollectorType*>(Userdata);
+	if (c.InCallback.exchange(true)) c.NumOverlapped++;
+
+	c.NumFrameSets++;
+	if (FrameSet.Timestamp <= c.LastTimestamp) c.NumOutOfOrder++;
+	c.LastTimestamp = FrameSet.Timestamp;
+
+	size_t Index = GetFrameIndex(*FrameSet.Frames[0].Image);
+	int64_t Earliest = FrameSet.Timestamp, Latest = FrameSet.Timestamp;
+	for (auto& f : FrameSet.Frames)
+	{
+		if (f.Timestamp < FrameSet.Timestamp - Tolerance || f.Timestamp > FrameSet.Timestamp + Tolerance) c.NumOutOfTolerance++;
+		if (GetFrameIndex(*f.Image) != Index) c.NumMixed++;
+		Earliest = std::min(Earliest, f.Timestamp);
+		Latest = std::max(Latest, f.Timestamp);
+	}
+	if (FrameSet.Spread != Latest - Earliest) c.NumOutOfTolerance++;
+	if (Index < NumFrames) c.TimesMatched[Index]++;
+
+	c.InCallback = false;
+}
+
+// 每一帧要么配成组，要么被丢弃，要么还在环形缓冲区里
+static void CheckAccounting(const FrameSynchronizerType& Sync)
+{
+	for (size_t i = 0; i < Sync.GetNumStreams(); i++)
+	{
+		auto Stats = Sync.GetStats(i);
+		size_t Accounted = Stats.NumMatched + Stats.NumDropped + Stats.NumOverflowed + Stats.NumLate;
+		CHECK(Accounted <= Stats.NumPushed);
+		CHECK(Stats.NumPushed - Accounted <= RingSize);
+		CHECK(Stats.NumMatched == Sync.GetNumFrameSets());
+	}
+}
+
+// 第 `Stream` 路第 `Index` 帧的时间戳：各路有固定的偏差，再加上均匀分布的抖动
+static int64_t JitteredTimestamp(std::mt19937& Rng, size_t Stream, size_t Index, int64_t Jitter)
+{
+	return int64_t(Index) * Period + int64_t(Stream) * 50 + std::uniform_int_distribution<int64_t>(-Jitter, Jitter)(Rng);
+}
+
+// 各路都不缺帧，抖动在容差之内，每一帧都应该和同一时刻的帧配成组
+static void TestMatch()
+{
+	CollectorType c;
+	FrameSynchronizerType Sync(NumStreams, Tolerance, OnFrameSet, &c, RingSize);
+	std::mt19937 Rng(1);
+	Image_RGBA8 Frame(8, 8, Pixel_RGBA8(0, 0, 0, 255));
+
+	size_t Order[NumStreams] = { 0, 1, 2 };
+	for (size_t i = 0; i < NumFrames; i++)
+	{
+		std::shuffle(Order, Order + NumStreams, Rng);
+		SetFrameIndex(Frame, i);
+		for (auto s : Order) Sync.Push(s, JitteredTimestamp(Rng, s, i, 150), Frame);
+	}
+
+	CHECK(c.NumOutOfTolerance == 0);
+	CHECK(c.NumMixed == 0);
+	CHECK(c.NumOutOfOrder == 0);
+	CHECK(Sync.GetNumFrameSets() >= NumFrames - RingSize);
+	for (size_t i = 0; i < NumFrames - RingSize; i++) CHECK(c.TimesMatched[i] == 1);
+	for (size_t s = 0; s < NumStreams; s++)
+	{
+		auto Stats = Sync.GetStats(s);
+		CHECK(Stats.NumDropped == 0);
+		CHECK(Stats.NumOverflowed == 0);
+		CHECK(Stats.NumLate == 0);
+	}
+	CheckAccounting(Sync);
+}
+
+// 最后一路随机缺帧，其他路同一时刻的帧凑不成组，应当丢弃而不是和相邻的帧配对
+// 连续缺好几帧时其他路等待配对的帧会超过环形缓冲区的容量，那是 `TestOverflow()` 的情况，这里每次只缺一帧
+static void TestDrop()
+{
+	CollectorType c;
+	FrameSynchronizerType Sync(NumStreams, Tolerance, OnFrameSet, &c, RingSize);
+	std::mt19937 Rng(2);
+	Image_RGBA8 Frame(8, 8, Pixel_RGBA8(0, 0, 0, 255));
+
+	std::vector<bool> Missing(NumFrames);
+	size_t NumMissing = 0;
+	for (size_t i = 0; i < NumFrames; i++)
+	{
+		Missing[i] = Rng() % 10 == 0 && !(i && Missing[i - 1]);
+		NumMissing += Missing[i];
+		SetFrameIndex(Frame, i);
+		for (size_t s = 0; s < NumStreams; s++)
+		{
+			if (s == NumStreams - 1 && Missing[i]) continue;
+			Sync.Push(s, JitteredTimestamp(Rng, s, i, 150), Frame);
+		}
+	}
+
+	CHECK(c.NumOutOfTolerance == 0);
+	CHECK(c.NumMixed == 0);
+	for (size_t i = 0; i < NumFrames - RingSize; i++) CHECK(c.TimesMatched[i] == (Missing[i] ? 0 : 1));
+	for (size_t s = 0; s < NumStreams - 1; s++)
+	{
+		auto Stats = Sync.GetStats(s);
+		CHECK(Stats.NumDropped + RingSize >= NumMissing);
+		CHECK(Stats.NumDropped <= NumMissing);
+		CHECK(Stats.NumOverflowed == 0);
+	}
+	CHECK(Sync.GetStats(NumStreams - 1).NumDropped == 0);
+	CheckAccounting(Sync);
+}
+
+// 第一路先送出一串帧，其他路还没有帧可配，多出来的帧从环形缓冲区里挤出去；其他路追上之后丢掉对不上的帧继续配对
+static void TestOverflow()
+{
+	constexpr size_t Burst = 10;
+	CollectorType c;
+	FrameSynchronizerType Sync(NumStreams, Tolerance, OnFrameSet, &c, RingSize);
+	std::mt19937 Rng(3);
+	Image_RGBA8 Frame(8, 8, Pixel_RGBA8(0, 0, 0, 255));
+
+	for (size_t i = 0; i < Burst; i++)
+	{
+		SetFrameIndex(Frame, i);
+		Sync.Push(0, JitteredTimestamp(Rng, 0, i, 150), Frame);
+	}
+	CHECK(Sync.GetStats(0).NumOverflowed == Burst - RingSize);
+	CHECK(Sync.GetNumFrameSets() == 0);
+
+	for (size_t i = 0; i < NumFrames; i++)
+	{
+		SetFrameIndex(Frame, i);
+		for (size_t s = 0; s < NumStreams; s++)
+		{
+			if (s == 0 && i < Burst) continue;
+			Sync.Push(s, JitteredTimestamp(Rng, s, i, 150), Frame);
+		}
+	}
+
+	CHECK(c.NumOutOfTolerance == 0);
+	CHECK(c.NumMixed == 0);
+	for (size_t i = 0; i < NumFrames - RingSize; i++) CHECK(c.TimesMatched[i] == (i < Burst - RingSize ? 0 : 1));
+	CHECK(Sync.GetStats(0).NumOverflowed == Burst - RingSize);
+	CHECK(Sync.GetStats(0).NumDropped == 0);
+	for (size_t s = 1; s < NumStreams; s++)
+	{
+		CHECK(Sync.GetStats(s).NumOverflowed == 0);
+		CHECK(Sync.GetStats(s).NumDropped == Burst - RingSize);
+	}
+	CheckAccounting(Sync);
+}
+
+// 第二路的抖动比帧间隔的一半还大，时间戳会倒退，倒退的帧应当计入 `NumLate` 并丢弃
+static void TestLate()
+{
+	CollectorType c;
+	FrameSynchronizerType Sync(NumStreams, Tolerance, OnFrameSet, &c, RingSize);
+	std::mt19937 Rng(4);
+	Image_RGBA8 Frame(8, 8, Pixel_RGBA8(0, 0, 0, 255));
+
+	size_t ExpectedLate = 0;
+	int64_t LastAccepted = INT64_MIN;
+	for (size_t i = 0; i < NumFrames; i++)
+	{
+		SetFrameIndex(Frame, i);
+		for (size_t s = 0; s < NumStreams; s++)
+		{
+			int64_t Timestamp = JitteredTimestamp(Rng, s, i, s == 1 ? 700 : 150);
+			if (s == 1)
+			{
+				if (Timestamp <= LastAccepted) ExpectedLate++;
+				else LastAccepted = Timestamp;
+			}
+			Sync.Push(s, Timestamp, Frame);
+		}
+	}
+
+	// 抖动大的那一路可能把相邻的帧配进组里，这里只检查时间戳
+	CHECK(ExpectedLate > 0);
+	CHECK(Sync.GetStats(1).NumLate == ExpectedLate);
+	CHECK(Sync.GetStats(0).NumLate == 0);
+	CHECK(Sync.GetStats(2).NumLate == 0);
+	CHECK(c.NumOutOfTolerance == 0);
+	CHECK(c.NumOutOfOrder == 0);
+	CHECK(Sync.GetNumFrameSets() > 0);
+	CheckAccounting(Sync);
+}
+
+// 每一路一个线程同时送帧，回调不能同时执行，配成的组仍然要对得上
+static void TestConcurrentStreams()
+{
+	CollectorType c;
+	FrameSynchronizerType Sync(NumStreams, Tolerance, OnFrameSet, &c, RingSize);
+
+	std::vector<std::thread> Threads;
+	for (size_t s = 0; s < NumStreams; s++)
+	{
+		Threads.emplace_back([&, s]()
+		{
+			std::mt19937 Rng(uint32_t(100 + s));
+			Image_RGBA8 Frame(64, 48, Pixel_RGBA8(0, 0, 0, 255));
+			for (size_t i = 0; i < NumFrames; i++)
+			{
+				if (s == NumStreams - 1 && Rng() % 20 == 0) continue;
+				SetFrameIndex(Frame, i);
+				Sync.Push(s, JitteredTimestamp(Rng, s, i, 150), Frame);
+				if (i % 64 == 0) std::this_thread::yield();
+			}
+		});
+	}
+	for (auto& t : Threads) t.join();
+
+	CHECK(c.NumOverlapped == 0);
+	CHECK(c.NumOutOfTolerance == 0);
+	CHECK(c.NumMixed == 0);
+	CHECK(c.NumOutOfOrder == 0);
+	CHECK(c.NumFrameSets == Sync.GetNumFrameSets());
+	CHECK(Sync.GetNumFrameSets() > 0);
+	for (auto n : c.TimesMatched) CHECK(n <= 1);
+	for (size_t s = 0; s < NumStreams; s++) CHECK(Sync.GetStats(s).NumLate == 0);
+	CheckAccounting(Sync);
+}
+
+struct CameraSyncType
+{
+	FrameSynchronizerType* Sync;
+	size_t Stream;
+};
+
+static void OnCameraFrame(void* Userdata, WebCamType& wc, bool FrameUpdated)
+{
+	auto& cs = *reinterpret_cast<CameraSyncType*>(Userdata);
+	if (FrameUpdated) cs.Sync->Push(cs.Stream, wc);
+}
+
+// 从假摄像头的帧回调里送帧，时间戳取自 `GetFrameTimestamp().SystemTime`
+static void TestPushFromCamera()
+{
+	CollectorType c;
+	FrameSynchronizerType Sync(2, Tolerance, OnFrameSet, &c, RingSize);
+	CameraSyncType Links[2] = { { &Sync, 0 }, { &Sync, 1 } };
+	WebCamType Cameras[2] = { WebCamType(OnCameraFrame, &Links[0], false), WebCamType(OnCameraFrame, &Links[1], false) };
+	std::mt19937 Rng(5);
+	Image_RGBA8 Frame(16, 16, Pixel_RGBA8(0, 0, 0, 255));
+
+	constexpr size_t NumCameraFrames = 100;
+	for (size_t i = 0; i < NumCameraFrames; i++)
+	{
+		SetFrameIndex(Frame, i);
+		for (size_t s = 0; s < 2; s++)
+		{
+			FakeWebCam::SetFrame(Cameras[s], Frame, JitteredTimestamp(Rng, s, i, 150));
+			Cameras[s].QueryFrame();
+			CHECK(FakeWebCam::DeliverFrame(Cameras[s]));
+		}
+	}
+
+	CHECK(c.NumMixed == 0);
+	CHECK(c.NumOutOfTolerance == 0);
+	CHECK(Sync.GetNumFrameSets() >= NumCameraFrames - RingSize);
+	CheckAccounting(Sync);
+}
+
+int main()
+{
+	std::atomic<bool> Done = false;
+	StartWatchdog(Done, 60, "Timed out, a `Push()` probably deadlocked with the frame set callback.");
+
+	TestMatch();
+	TestDrop();
+	TestOverflow();
+	TestLate();
+	TestConcurrentStreams();
+	TestPushFromCamera();
+
+	Done = true;
+	return ReportResults();
+}
@@ -0,0 +1,62 @@
+# 生成 jpegdec_test.cpp 使用的 JPEG 样本和参考输出：python3 gen_fixtures.py
+# 样本由 libjpeg（通过 Pillow）编码，画面模仿摄像头拍到的场景：渐变的背景、色块、细线和传感器噪声，
+# 和真实的摄像头一样，细节和噪声都在亮度上，色度是平滑的。
+# 参考输出也由 libjpeg 解码：.ppm 是 RGB，.pgm 是亮度（不经过色度上采样，可以逐像素对比），
+# _s2、_s4、_s8.pgm 是 libjpeg 按 1/2、1/4、1/8 缩小解码的亮度。
+# 尺寸故意不是 MCU 的整数倍，以覆盖右边和下边不完整的 MCU。
+
+import io
+import random
+from PIL import Image, ImageDraw, ImageFilter
+
+Width, Height = 90, 58
+
+def MakeScene():
+	rng = random.Random(20240611)
+	im = Image.new("RGB", (Width, Height))
+	px = im.load()
+	for y in range(Height):
+		for x in range(Width):
+			px[x, y] = (40 + x * 2, 60 + y * 2, 180 - x - y)
+	d = ImageDraw.Draw(im)
+	d.rectangle((8, 6, 34, 30), fill=(220, 40, 30))
+	d.ellipse((40, 10, 78, 48), fill=(30, 200, 60))
+	d.rectangle((60, 34, 86, 54), fill=(250, 240, 40))
+	for i in range(0, Width, 6):
+		d.line((i, Height - 8, i + 3, Height - 1), fill=(255, 255, 255))
+	d.line((0, 0, Width - 1, Height - 1), fill=(0, 0, 0))
+	for y in range(Height):
+		for x in range(Width):
+			r, g, b = px[x, y]
+			n = rng.randint(-6, 6)
+			px[x, y] = tuple(max(0, min(255, c + n)) for c in (r, g, b))
+	y, cb, cr = im.convert("YCbCr").split()
+	Blur = ImageFilter.GaussianBlur(6)
+	return Image.merge("YCbCr", (y, cb.filter(Blur), cr.filter(Blur))).convert("RGB")
+
+def Save(Name, im, **Options):
+	b = io.BytesIO()
+	im.save(b, "JPEG", quality=85, **Options)
+	Data = b.getvalue()
+	with open(Name + ".jpg", "wb") as f:
+		f.write(Data)
+
+	Decoded = Image.open(io.BytesIO(Data))
+	Decoded.load()
+	if Decoded.mode != "L":
+		Decoded.convert("RGB").save(Name + ".ppm")
+
+	for Denom in (1, 2, 4, 8):
+		Luma = Image.open(io.BytesIO(Data))
+		# Pillow 按原尺寸整除请求的尺寸选择缩放比例，libjpeg 输出向上取整的尺寸
+		Luma.draft(Luma.mode if Luma.mode == "L" else "YCbCr", (Width // Denom, Height // Denom))
+		Luma = Luma.getchannel(0)
+		assert Luma.size == ((Width + Denom - 1) // Denom, (Height + Denom - 1) // Denom)
+		Luma.save(Name + (".pgm" if Denom == 1 else "_s%d.pgm" % Denom))
+
+Scene = MakeScene()
+Save("yuv420", Scene, subsampling=2)
+Save("yuv422", Scene, subsampling=1)
+Save("yuv444", Scene, subsampling=0)
+Save("gray", Scene.convert("L"))
+Save("yuv420_rst", Scene, subsampling=2, restart_marker_rows=1)
@@ -0,0 +1,382 @@
+// JpegDecoderType 的测试：4:2:0、4:2:2、4:4:4 和灰度的样本与 libjpeg 的解码结果对比，再把样本截断、损坏之后解码。
+// 样本和参考输出由 jpegdec/gen_fixtures.py 生成，在 tests 目录下运行：
+// g++ -std=c++20 -O2 -fopenmp -I../.. jpegdec_test.cpp ../jpegdec.cpp -o jpegdec_test && ./jpegdec_test [样本目录]
+
+#include "../jpegdec.hpp"
+#include "check.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+
+using namespace WindowsWebCamTypeLib;
+
+static std::string FixtureDir = "jpegdec/";
+
+static std::vector<uint8_t> ReadFile(const std::string& Name)
+{
+	std::ifstream f(FixtureDir + Name, std::ios::binary);
+	if (!f)
+	{
+		std::printf("Can't open `%s%s`, run the test in the tests directory or pass the fixture directory.\n", FixtureDir.c_str(), Name.c_str());
+		std::exit(2);
+	}
+	return std::vector<uint8_t>(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+}
+
+// 参考输出，`Channels` 为 3 是 RGB（.ppm），为 1 是亮度（.pgm）
+struct ReferenceType
+{
+	uint32_t Width = 0;
+	uint32_t Height = 0;
+	uint32_t Channels = 0;
+	std::vector<uint8_t> Data;
+
+	uint8_t At(uint32_t x, uint32_t y, uint32_t c) const
+	{
+		return Data[(size_t(y) * Width + x) * Channels + c];
+	}
+};
+
+// 只支持 Pillow 写出的二进制 PNM：魔数、宽、高、最大值各占一行
+static ReferenceType ReadPNM(const std::string& Name)
+{
+	auto File = ReadFile(Name);
+	ReferenceType Ref;
+	size_t Pos = 0;
+	auto NextToken = [&]()
+	{
+		while (Pos < File.size() && isspace(File[Pos])) Pos++;
+		size_t Begin = Pos;
+		while (Pos < File.size() && !isspace(File[Pos])) Pos++;
+		return std::string(File.begin() + Begin, File.begin() + Pos);
+	};
+	auto Magic = NextToken();
+	Ref.Channels = Magic == "P6" ? 3 : 1;
+	Ref.Width = uint32_t(std::stoul(NextToken()));
+	Ref.Height = uint32_t(std::stoul(NextToken()));
+	NextToken();
+	Pos++;
+	Ref.Data.assign(File.begin() + Pos, File.end());
+	if (Ref.Data.size() != size_t(Ref.Width) * Ref.Height * Ref.Channels)
+	{
+		std::printf("`%s` is not a binary PNM file.\n", Name.c_str());
+		std::exit(2);
+	}
+	return Ref;
+}
+
+// 解码到每行后面带着保护字节的缓冲区，检查解码器没有写出界
+struct OutputType
+{
+	static constexpr size_t Guard = 32;
+	static constexpr uint8_t GuardByte = 0xCD;
+
+	uint32_t Width, Height;
+	size_t BytesPerPixel;
+	ptrdiff_t Pitch;
+	std::vector<uint8_t> Data;
+
+	OutputType(uint32_t Width, uint32_t Height, size_t BytesPerPixel) :
+		Width(Width),
+		Height(Height),
+		BytesPerPixel(BytesPerPixel),
+		Pitch(ptrdiff_t(Width * BytesPerPixel + Guard)),
+		Data(size_t(Pitch) * Height, GuardByte)
+	{
+	}
+
+	const uint8_t* Pixel(uint32_t x, uint32_t y) const
+	{
+		return &Data[size_t(y) * size_t(Pitch) + x * BytesPerPixel];
+	}
+
+	bool GuardIntact() const
+	{
+		for (uint32_t y = 0; y < Height; y++)
+		{
+			for (size_t i = Width * BytesPerPixel; i < size_t(Pitch); i++) if (Data[size_t(y) * size_t(Pitch) + i] != GuardByte) return false;
+		}
+		return true;
+	}
+};
+
+template<typename DstTraits>
+static bool DecodeTo(const std::vector<uint8_t>& Jpeg, OutputType& Out, uint32_t ScaleDenom = 1)
+{
+	JpegDecoderType Decoder;
+	return Decoder.Decode<DstTraits>(Jpeg.data(), Jpeg.size(), Out.Data.data(), Out.Pitch, Out.Width, Out.Height, ScaleDenom);
+}
+
+struct DiffType
+{
+	int Max = 0;
+	double Mean = 0;
+};
+
+// 对比 `[Y0, Y1)` 行的前 `Ref.Channels` 个通道
+static DiffType Compare(const OutputType& Out, const ReferenceType& Ref, uint32_t Y0, uint32_t Y1)
+{
+	DiffType Diff;
+	size_t Count = 0;
+	for (uint32_t y = Y0; y < Y1; y++)
+	{
+		for (uint32_t x = 0; x < Ref.Width; x++)
+		{
+			for (uint32_t c = 0; c < Ref.Channels; c++)
+			{
+				int d = std::abs(int(Out.Pixel(x, y)[c]) - int(Ref.At(x, y, c)));
+				Diff.Max = std::max(Diff.Max, d);
+				Diff.Mean += d;
+				Count++;
+			}
+		}
+	}
+	if (Count) Diff.Mean /= double(Count);
+	return Diff;
+}
+
+static DiffType Compare(const OutputType& Out, const ReferenceType& Ref)
+{
+	return Compare(Out, Ref, 0, Ref.Height);
+}
+
+// 亮度不经过上采样，只有 IDCT 的舍入误差；RGB 还有色度上采样的差别（libjpeg 插值，这里取最近的采样），
+// 在饱和的色彩边缘处可以差到几十，所以 4:2:0、4:2:2 主要看平均误差
+struct ToleranceType
+{
+	int LumaMax;
+	double LumaMean;
+	int RGBMax;
+	double RGBMean;
+};
+
+static void TestFixture(const std::string& Name, const ToleranceType& Tol)
+{
+	auto Jpeg = ReadFile(Name + ".jpg");
+	auto Luma = ReadPNM(Name + ".pgm");
+
+	uint32_t Width, Height;
+	CHECK(JpegDecoderType::GetImageSize(Jpeg.data(), Jpeg.size(), Width, Height));
+	CHECK(Width == Luma.Width && Height == Luma.Height);
+
+	OutputType Gray(Luma.Width, Luma.Height, 1);
+	CHECK(DecodeTo<Gray8Traits>(Jpeg, Gray));
+	CHECK(Gray.GuardIntact());
+	auto LumaDiff = Compare(Gray, Luma);
+	std::printf("%-12s luma max %d mean %.3f", Name.c_str(), LumaDiff.Max, LumaDiff.Mean);
+	CHECK(LumaDiff.Max <= Tol.LumaMax);
+	CHECK(LumaDiff.Mean <= Tol.LumaMean);
+
+	if (Name == "gray")
+	{
+		std::printf("\n");
+		return;
+	}
+
+	auto Ref = ReadPNM(Name + ".ppm");
+	OutputType RGBA(Ref.Width, Ref.Height, 4);
+	CHECK(DecodeTo<RGBA8Traits>(Jpeg, RGBA));
+	CHECK(RGBA.GuardIntact());
+	auto RGBDiff = Compare(RGBA, Ref);
+	std::printf(", RGB max %d mean %.3f\n", RGBDiff.Max, RGBDiff.Mean);
+	CHECK(RGBDiff.Max <= Tol.RGBMax);
+	CHECK(RGBDiff.Mean <= Tol.RGBMean);
+
+	// BGRA 只是通道顺序不同
+	OutputType BGRA(Ref.Width, Ref.Height, 4);
+	CHECK(DecodeTo<BGRA8Traits>(Jpeg, BGRA));
+	bool Swapped = true;
+	for (uint32_t y = 0; y < Ref.Height; y++)
+	{
+		for (uint32_t x = 0; x < Ref.Width; x++)
+		{
+			auto p = RGBA.Pixel(x, y), q = BGRA.Pixel(x, y);
+			Swapped &= p[0] == q[2] && p[1] == q[1] && p[2] == q[0] && p[3] == q[3];
+		}
+	}
+	CHECK(Swapped);
+}
+
+// 缩小解码与 libjpeg 的缩小解码对比，两者都是直接用更小的 IDCT
+static void TestScaled(const std::string& Name)
+{
+	auto Jpeg = ReadFile(Name + ".jpg");
+	for (uint32_t Denom : { 2u, 4u, 8u })
+	{
+		auto Luma = ReadPNM(Name + "_s" + std::to_string(Denom) + ".pgm");
+		uint32_t Width, Height;
+		JpegDecoderType::GetImageSize(Jpeg.data(), Jpeg.size(), Width, Height);
+		CHECK(JpegDecoderType::GetScaledSize(Width, Denom) == Luma.Width);
+		CHECK(JpegDecoderType::GetScaledSize(Height, Denom) == Luma.Height);
+
+		OutputType Gray(Luma.Width, Luma.Height, 1);
+		CHECK(DecodeTo<Gray8Traits>(Jpeg, Gray, Denom));
+		CHECK(Gray.GuardIntact());
+		auto Diff = Compare(Gray, Luma);
+		std::printf("%-12s 1/%u luma max %d mean %.3f\n", Name.c_str(), Denom, Diff.Max, Diff.Mean);
+
+		// 1/8 只用直流系数，结果应当一致；libjpeg 6.2 的 1/2、1/4 IDCT 对高频系数的近似不同，噪声多的地方有差别，只检查平均误差
+		if (Denom == 8) CHECK(Diff.Max <= 1);
+		CHECK(Diff.Mean <= 4.0);
+	}
+}
+
+// 去掉 DHT 段之后应当使用标准的默认表，libjpeg 写出的正好就是标准表
+static void TestDefaultHuffmanTables(const std::string& Name)
+{
+	auto Jpeg = ReadFile(Name + ".jpg");
+	std::vector<uint8_t> Stripped;
+	size_t p = 2;
+	Stripped.insert(Stripped.end(), Jpeg.begin(), Jpeg.begin() + 2);
+	while (p + 4 <= Jpeg.size() && Jpeg[p] == 0xFF && Jpeg[p + 1] != 0xDA)
+	{
+		size_t Length = size_t(Jpeg[p + 2]) << 8 | Jpeg[p + 3];
+		if (Jpeg[p + 1] != 0xC4) Stripped.insert(Stripped.end(), Jpeg.begin() + p, Jpeg.begin() + p + 2 + Length);
+		p += 2 + Length;
+	}
+	Stripped.insert(Stripped.end(), Jpeg.begin() + p, Jpeg.end());
+	CHECK(Stripped.size() < Jpeg.size());
+
+	auto Ref = ReadPNM(Name + ".pgm");
+	OutputType A(Ref.Width, Ref.Height, 4), B(Ref.Width, Ref.Height, 4);
+	CHECK(DecodeTo<RGBA8Traits>(Jpeg, A));
+	CHECK(DecodeTo<RGBA8Traits>(Stripped, B));
+	CHECK(A.Data == B.Data);
+}
+
+// 扫描数据里各个 RST 标记之后的位置
+static std::vector<size_t> FindRestartMarkers(const std::vector<uint8_t>& Jpeg)
+{
+	std::vector<size_t> Markers;
+	for (size_t i = 0; i + 1 < Jpeg.size(); i++)
+	{
+		if (Jpeg[i] == 0xFF && Jpeg[i + 1] >= 0xD0 && Jpeg[i + 1] <= 0xD7) Markers.push_back(i + 2);
+	}
+	return Markers;
+}
+
+static size_t FindScanData(const std::vector<uint8_t>& Jpeg)
+{
+	size_t p = 2;
+	while (p + 4 <= Jpeg.size())
+	{
+		size_t Length = size_t(Jpeg[p + 2]) << 8 | Jpeg[p + 3];
+		if (Jpeg[p + 1] == 0xDA) return p + 2 + Length;
+		p += 2 + Length;
+	}
+	return Jpeg.size();
+}
+
+// 每个重启间隔是一行 MCU（16 行像素），截断之后完整的间隔照常解码，头部不完整时抛出异常
+static void TestTruncated()
+{
+	constexpr uint32_t McuHeight = 16;
+	auto Jpeg = ReadFile("yuv420_rst.jpg");
+	auto Luma = ReadPNM("yuv420_rst.pgm");
+	auto Markers = FindRestartMarkers(Jpeg);
+	size_t ScanData = FindScanData(Jpeg);
+	CHECK(Markers.size() == 3);
+
+	for (size_t Size = 0; Size < Jpeg.size(); Size++)
+	{
+		std::vector<uint8_t> Truncated(Jpeg.begin(), Jpeg.begin() + Size);
+		OutputType Gray(Luma.Width, Luma.Height, 1);
+		bool Threw = false;
+		try
+		{
+			DecodeTo<Gray8Traits>(Truncated, Gray);
+		}
+		catch (const DecodeJpegFailed&)
+		{
+			Threw = true;
+		}
+		CHECK(Threw == (Size < ScanData));
+		CHECK(Gray.GuardIntact());
+		if (Threw) continue;
+
+		size_t Complete = 0;
+		while (Complete < Markers.size() && Markers[Complete] <= Size) Complete++;
+		uint32_t Rows = std::min(uint32_t(Complete) * McuHeight, Luma.Height);
+		auto Diff = Compare(Gray, Luma, 0, Rows);
+		CHECK(Diff.Max <= 2);
+	}
+}
+
+// 损坏一个重启间隔的数据不影响其他间隔；随机损坏的数据要么解码失败，要么解码出结果，但不能写出界
+static void TestCorrupted()
+{
+	constexpr uint32_t McuHeight = 16;
+	auto Jpeg = ReadFile("yuv420_rst.jpg");
+	auto Luma = ReadPNM("yuv420_rst.pgm");
+	auto Markers = FindRestartMarkers(Jpeg);
+	size_t ScanData = FindScanData(Jpeg);
+	std::mt19937 Rng(31);
+
+	// 损坏第二个间隔的中间部分，不产生新的标记
+	for (int Round = 0; Round < 50; Round++)
+	{
+		auto Corrupted = Jpeg;
+		size_t Begin = Markers[0] + 4, End = Markers[1] - 6;
+		for (size_t i = Begin; i < End; i++) Corrupted[i] = uint8_t(Rng() % 0xFF);
+
+		OutputType Gray(Luma.Width, Luma.Height, 1);
+		DecodeTo<Gray8Traits>(Corrupted, Gray);
+		CHECK(Gray.GuardIntact());
+		CHECK(Compare(Gray, Luma, 0, McuHeight).Max <= 2);
+		CHECK(Compare(Gray, Luma, McuHeight * 2, Luma.Height).Max <= 2);
+	}
+
+	// 随机改写任意位置的字节，包括文件头
+	for (auto Name : { "yuv420", "yuv422", "yuv444", "gray", "yuv420_rst" })
+	{
+		auto Original = ReadFile(std::string(Name) + ".jpg");
+		for (int Round = 0; Round < 300; Round++)
+		{
+			auto Corrupted = Original;
+			int NumBytes = 1 + int(Rng() % 8);
+			for (int i = 0; i < NumBytes; i++)
+			{
+				size_t Pos = Round & 1 ? Rng() % Corrupted.size() : ScanData + Rng() % (Corrupted.size() - ScanData);
+				Corrupted[Pos] = uint8_t(Rng());
+			}
+
+			OutputType RGBA(Luma.Width, Luma.Height, 4);
+			try
+			{
+				DecodeTo<RGBA8Traits>(Corrupted, RGBA);
+			}
+			catch (const DecodeJpegFailed&)
+			{
+			}
+			CHECK(RGBA.GuardIntact());
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	if (argc > 1)
+	{
+		FixtureDir = argv[1];
+		if (FixtureDir.size() && FixtureDir.back() != '/' && FixtureDir.back() != '\\') FixtureDir += '/';
+	}
+
+	TestFixture("yuv420", { 1, 0.05, 40, 2.0 });
+	TestFixture("yuv422", { 1, 0.05, 48, 1.6 });
+	TestFixture("yuv444", { 1, 0.05, 2, 0.5 });
+	TestFixture("gray", { 1, 0.05, 0, 0 });
+	TestFixture("yuv420_rst", { 1, 0.05, 40, 2.0 });
+	for (auto Name : { "yuv420", "yuv422", "yuv444", "gray" }) TestScaled(Name);
+	TestDefaultHuffmanTables("yuv420");
+	TestTruncated();
+	TestCorrupted();
+
+	return ReportResults();
+}
@@ -0,0 +1,131 @@
+// 对比 pixsimd.hpp 的向量化行函数与逐像素的转换，分别用 SSE2 和 AVX2 编译运行：
+// g++ -std=c++20 -O2 -I../.. pixfmt_test.cpp -o pixfmt_test && ./pixfmt_test
+// g++ -std=c++20 -O2 -mavx2 -I../.. pixfmt_test.cpp -o pixfmt_test_avx2 && ./pixfmt_test_avx2
+
+#include "../pixfmt.hpp"
+#include "check.hpp"
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace WindowsWebCamTypeLib;
+
+// 同样的输出格式，只用逐像素的转换
+template<typename DstTraits>
+struct ScalarOf : DstTraits
+{
+	static constexpr SimdOutputType SimdOutput = SimdOutputType::None;
+};
+
+static std::mt19937 Rng(12345);
+
+template<RawFrameType RFT, typename DstTraits>
+static void TestRegion(uint32_t SrcWidth, uint32_t SrcHeight, uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height, bool FlipV)
+{
+	size_t SrcPitch;
+	std::vector<uint8_t> Src(RawFrameLayouts[size_t(RFT)](SrcWidth, SrcHeight, SrcPitch));
+	for (auto& b : Src) b = uint8_t(Rng());
+
+	// 每行后面留出一段不该被写到的字节
+	constexpr size_t Guard = 40;
+	ptrdiff_t DstPitch = ptrdiff_t(size_t(Width) * DstTraits::BytesPerPixel + Guard);
+	std::vector<uint8_t> Expected(size_t(DstPitch) * Height, 0xCD);
+	std::vector<uint8_t> Actual(size_t(DstPitch) * Height, 0xCD);
+	ConvertFrameRegion<RFT, ScalarOf<DstTraits>>(Expected.data(), DstPitch, Src.data(), int32_t(SrcPitch), SrcHeight, X, Y, Width, Height, FlipV);
+	ConvertFrameRegion<RFT, DstTraits>(Actual.data(), DstPitch, Src.data(), int32_t(SrcPitch), SrcHeight, X, Y, Width, Height, FlipV);
+
+	if (Expected != Actual)
+	{
+		size_t i = 0;
+		while (Expected[i] == Actual[i]) i++;
+		std::printf("Format %d, output %d, %ux%u region (%u, %u) of %ux%u%s differs at row %zu byte %zu: %d != %d\n",
+			int(RFT), int(DstTraits::SimdOutput), Width, Height, X, Y, SrcWidth, SrcHeight, FlipV ? " flipped" : "",
+			i / size_t(DstPitch), i % size_t(DstPitch), Actual[i], Expected[i]);
+		NumFailed++;
+	}
+}
+
+template<RawFrameType RFT, typename DstTraits>
+static void TestFormat()
+{
+	// 覆盖只有向量化部分、只有逐像素部分和两者都有的宽度
+	for (uint32_t Width = 2; Width <= 74; Width += 2)
+	{
+		TestRegion<RFT, DstTraits>(Width, 4, 0, 0, Width, 4, false);
+		TestRegion<RFT, DstTraits>(Width + 6, 8, 2, 2, Width, 4, true);
+	}
+	TestRegion<RFT, DstTraits>(640, 480, 0, 0, 640, 480, false);
+	TestRegion<RFT, DstTraits>(642, 482, 4, 2, 600, 478, true);
+}
+
+template<RawFrameType RFT>
+static void Test8BitSource()
+{
+	TestFormat<RFT, RGBA8Traits>();
+	TestFormat<RFT, BGRA8Traits>();
+	TestFormat<RFT, Gray8Traits>();
+}
+
+template<RawFrameType RFT>
+static void Test16BitSource()
+{
+	TestFormat<RFT, RGBA16Traits>();
+	TestFormat<RFT, Gray16Traits>();
+}
+
+// 色调映射的色度部分是向量化的，亮度部分查表
+static void TestToneMapP010()
+{
+	for (uint32_t Width = 2; Width <= 74; Width += 2)
+	{
+		uint32_t Height = 4;
+		size_t SrcPitch, DstPitch;
+		std::vector<uint8_t> Src(RawFrameLayouts[size_t(RawFrameType::P010)](Width, Height, SrcPitch));
+		for (auto& b : Src) b = uint8_t(Rng());
+		std::vector<uint8_t> Dst(RawFrameLayouts[size_t(RawFrameType::NV12)](Width, Height, DstPitch));
+
+		ToneMapTableType Table;
+		Table.Build(4096, 60000, 2.2f, 16, 235);
+		RawFrameToneMappers[size_t(RawFrameType::P010)](Dst.data(), DstPitch, Src.data(), int32_t(SrcPitch), Width, Height, Table.GetTable());
+
+		bool Match = true;
+		for (size_t i = 0; i < size_t(Width) * Height; i++)
+		{
+			uint16_t v;
+			memcpy(&v, &Src[i * 2], sizeof v);
+			Match &= Dst[i] == Table.GetTable()[v];
+		}
+		for (size_t i = 0; i < size_t(Width) * Height / 2; i++)
+		{
+			uint16_t v;
+			memcpy(&v, &Src[size_t(Width) * Height * 2 + i * 2], sizeof v);
+			Match &= Dst[size_t(Width) * Height + i] == uint8_t(v >> 8);
+		}
+		CHECK(Match);
+	}
+}
+
+int main()
+{
+#if defined(WEBCAM_SIMD_AVX2)
+	std::printf("Testing the AVX2 and SSE2 kernels.\n");
+#elif defined(WEBCAM_SIMD_SSE2)
+	std::printf("Testing the SSE2 kernels.\n");
+#else
+	std::printf("SIMD is disabled, only the per-pixel kernels are tested.\n");
+#endif
+
+	Test8BitSource<RawFrameType::YUY2>();
+	Test8BitSource<RawFrameType::UYVY>();
+	Test8BitSource<RawFrameType::YVYU>();
+	Test8BitSource<RawFrameType::NV12>();
+	Test8BitSource<RawFrameType::NV21>();
+	Test8BitSource<RawFrameType::I420>();
+	Test8BitSource<RawFrameType::YV12>();
+	Test16BitSource<RawFrameType::P010>();
+	Test16BitSource<RawFrameType::Y16>();
+	TestToneMapP010();
+
+	return ReportResults();
+}
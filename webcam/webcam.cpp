@@ -1,9 +1,6 @@
 #include "webcam.hpp"
 #include "imfcb.hpp"
 
-#include <locale>
-#include <codecvt>
-
 namespace WindowsWebCamTypeLib
 {
 	void OnFrameInternal(void* Userdata, WebCamTypeInternal& wci, bool FrameUpdated)
@@ -12,6 +9,12 @@ namespace WindowsWebCamTypeLib
 		wc.OnFrameCB(wc.Userdata, wc, FrameUpdated);
 	}
 
+	void FrameDispatchInternal(void* Userdata, WebCamTypeInternal& wci)
+	{
+		auto& wc = *reinterpret_cast<WebCamType*>(Userdata);
+		wc.FrameDispatchCB(wc.FrameDispatchUserdata, wc);
+	}
+
 	WebCamType::WebCamType(OnFrameCBType OnFrameCB, void* Userdata, bool Verbose) :
 		Internal(std::make_shared<WebCamTypeInternal>(OnFrameInternal, this, Verbose)),
 		Verbose(Verbose),
@@ -23,19 +26,19 @@ namespace WindowsWebCamTypeLib
 
 	void WebCamType::SetDevice(size_t Index)
 	{
-		auto enumerated = EnumeratedDevices();
-		if (Index >= enumerated.Count) throw SetDeviceFailed(std::string("Device index `") + std::to_string(Index) + "` is out of bound.");
-		reinterpret_cast<WebCamTypeInternal*>(Internal.get())->SetDevice(enumerated.Devices[Index]);
+		auto Devices = GetCachedDevices();
+		if (Index >= Devices->size()) throw SetDeviceFailed(std::string("Device index `") + std::to_string(Index) + "` is out of bound.");
+		reinterpret_cast<WebCamTypeInternal*>(Internal.get())->SetDevice(reinterpret_cast<IMFActivate*>((*Devices)[Index].Handle.get()));
 	}
 
 	void WebCamType::SetDevice(std::string DevPath)
 	{
-		auto enumerated = EnumeratedDevices();
-		for (size_t i = 0; i < enumerated.Count; i++)
+		auto Devices = GetCachedDevices();
+		for (auto& d : *Devices)
 		{
-			if (GetDevicePath(enumerated.Devices[i]) == DevPath)
+			if (d.SymbolicLink == DevPath)
 			{
-				reinterpret_cast<WebCamTypeInternal*>(Internal.get())->SetDevice(enumerated.Devices[i]);
+				reinterpret_cast<WebCamTypeInternal*>(Internal.get())->SetDevice(reinterpret_cast<IMFActivate*>(d.Handle.get()));
 				return;
 			}
 		}
@@ -44,29 +47,25 @@ namespace WindowsWebCamTypeLib
 
 	std::vector<std::string> WebCamType::EnumerateDevices()
 	{
-		auto enumerated = EnumerateDevicesW();
+		auto Devices = GetCachedDevices();
 		auto ret = std::vector<std::string>();
-
-		ret.resize(enumerated.size());
-		for (size_t i = 0; i < enumerated.size(); i++)
-		{
-			ret[i] = std::wstring_convert<std::codecvt_utf8<wchar_t>>().to_bytes(enumerated[i]);
-		}
-
+		for (auto& d : *Devices) ret.push_back(d.SymbolicLink);
 		return ret;
 	}
 
 	std::vector<std::wstring> WebCamType::EnumerateDevicesW()
 	{
-		auto enumerated = EnumeratedDevices();
+		auto Devices = GetCachedDevices();
 		auto ret = std::vector<std::wstring>();
-		ret.resize(enumerated.Count);
-
-		for (size_t i = 0; i < enumerated.Count; i++)
-		{
-			ret[i] = GetDevicePathW(enumerated.Devices[i]);
-		}
+		for (auto& d : *Devices) ret.push_back(d.SymbolicLinkW);
+		return ret;
+	}
 
+	std::vector<std::string> WebCamType::EnumerateDeviceNames()
+	{
+		auto Devices = GetCachedDevices();
+		auto ret = std::vector<std::string>();
+		for (auto& d : *Devices) ret.push_back(d.FriendlyName);
 		return ret;
 	}
 
@@ -80,6 +79,96 @@ namespace WindowsWebCamTypeLib
 		return *reinterpret_cast<WebCamTypeInternal*>(Internal.get())->FrameBuffer;
 	}
 
+	void WebCamType::SetFrameBufferSize(uint32_t Width, uint32_t Height, ScaleFilterType Filter)
+	{
+		reinterpret_cast<WebCamTypeInternal*>(Internal.get())->SetFrameBufferSize(Width, Height, Filter);
+	}
+
+	void WebCamType::SetRegionOfInterest(uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height)
+	{
+		reinterpret_cast<WebCamTypeInternal*>(Internal.get())->SetRegionOfInterest(FrameRegion{ X, Y, Width, Height });
+	}
+
+	FrameRegion WebCamType::GetRegionOfInterest() const
+	{
+		return reinterpret_cast<WebCamTypeInternal*>(Internal.get())->GetRegionOfInterest();
+	}
+
+	void WebCamType::SetOrientation(OrientationType Orientation)
+	{
+		reinterpret_cast<WebCamTypeInternal*>(Internal.get())->SetOrientation(Orientation);
+	}
+
+	OrientationType WebCamType::GetOrientation() const
+	{
+		return reinterpret_cast<WebCamTypeInternal*>(Internal.get())->GetOrientation();
+	}
+
+	void WebCamType::SetOutputFormat(OutputFormatType Format)
+	{
+		reinterpret_cast<WebCamTypeInternal*>(Internal.get())->SetOutputFormat(Format);
+	}
+
+	OutputFormatType WebCamType::GetOutputFormat() const
+	{
+		return reinterpret_cast<WebCamTypeInternal*>(Internal.get())->GetOutputFormat();
+	}
+
+	const OutputFrame& WebCamType::GetOutputFrame() const
+	{
+		return reinterpret_cast<WebCamTypeInternal*>(Internal.get())->OutputBuffer;
+	}
+
+	void WebCamType::StartRecording(const std::string& Path)
+	{
+		reinterpret_cast<WebCamTypeInternal*>(Internal.get())->StartRecording(Path);
+	}
+
+	void WebCamType::StopRecording()
+	{
+		reinterpret_cast<WebCamTypeInternal*>(Internal.get())->StopRecording();
+	}
+
+	bool WebCamType::IsRecording() const
+	{
+		return reinterpret_cast<WebCamTypeInternal*>(Internal.get())->IsRecording();
+	}
+
+	void WebCamType::StartRawRecording(const std::string& Path)
+	{
+		reinterpret_cast<WebCamTypeInternal*>(Internal.get())->StartRawRecording(Path);
+	}
+
+	void WebCamType::StopRawRecording()
+	{
+		reinterpret_cast<WebCamTypeInternal*>(Internal.get())->StopRawRecording();
+	}
+
+	bool WebCamType::IsRawRecording() const
+	{
+		return reinterpret_cast<WebCamTypeInternal*>(Internal.get())->IsRawRecording();
+	}
+
+	void WebCamType::SetPreviewEnabled(bool Enabled)
+	{
+		reinterpret_cast<WebCamTypeInternal*>(Internal.get())->SetPreviewEnabled(Enabled);
+	}
+
+	bool WebCamType::GetPreviewEnabled() const
+	{
+		return reinterpret_cast<WebCamTypeInternal*>(Internal.get())->GetPreviewEnabled();
+	}
+
+	void WebCamType::SetToneMapping(const ToneMapping& Params)
+	{
+		reinterpret_cast<WebCamTypeInternal*>(Internal.get())->SetToneMapping(Params);
+	}
+
+	ToneMapping WebCamType::GetToneMapping() const
+	{
+		return reinterpret_cast<WebCamTypeInternal*>(Internal.get())->GetToneMapping();
+	}
+
 	void WebCamType::QueryFrame()
 	{
 		reinterpret_cast<WebCamTypeInternal*>(Internal.get())->QueryFrame();
@@ -95,6 +184,47 @@ namespace WindowsWebCamTypeLib
 		reinterpret_cast<WebCamTypeInternal*>(Internal.get())->SetIsFrameUpdated(IsUpdated);
 	}
 
+	std::vector<MediaTypeInfo> WebCamType::GetMediaTypes()
+	{
+		return reinterpret_cast<WebCamTypeInternal*>(Internal.get())->GetMediaTypes();
+	}
+
+	bool WebCamType::SelectMediaType(const MediaTypeRequest& Request)
+	{
+		return reinterpret_cast<WebCamTypeInternal*>(Internal.get())->SelectMediaType(Request);
+	}
+
+	bool WebCamType::SetMediaType(uint32_t Index)
+	{
+		return reinterpret_cast<WebCamTypeInternal*>(Internal.get())->SetMediaType(Index);
+	}
+
+	void WebCamType::SetFormatCost(const std::string& Format, float Cost)
+	{
+		reinterpret_cast<WebCamTypeInternal*>(Internal.get())->SetFormatCost(Format, Cost);
+	}
+
+	void WebCamType::SetFrameDispatcher(FrameDispatchCBType DispatchCB, void* Userdata)
+	{
+		auto wci = reinterpret_cast<WebCamTypeInternal*>(Internal.get());
+
+		// 先停止调度，采集线程上不会有正在使用旧设置的调用
+		wci->SetFrameDispatcher(nullptr, nullptr);
+		FrameDispatchCB = DispatchCB;
+		FrameDispatchUserdata = Userdata;
+		if (DispatchCB) wci->SetFrameDispatcher(FrameDispatchInternal, this);
+	}
+
+	bool WebCamType::ProcessPendingFrame()
+	{
+		return reinterpret_cast<WebCamTypeInternal*>(Internal.get())->ProcessPendingSample();
+	}
+
+	FrameTimestamp WebCamType::GetFrameTimestamp() const
+	{
+		return reinterpret_cast<WebCamTypeInternal*>(Internal.get())->GetFrameTimestamp();
+	}
+
 	std::string WebCamType::GetCurRawFrameType() const
 	{
 		return reinterpret_cast<WebCamTypeInternal*>(Internal.get())->GetCurRawFrameTypeStr();
@@ -115,4 +245,40 @@ namespace WindowsWebCamTypeLib
 	{
 		return reinterpret_cast<WebCamTypeInternal*>(Internal.get())->SetRawFrameType(RawFrameType::NV12);
 	}
+	bool WebCamType::SetCurRawFrameTypeUYVY()
+	{
+		return reinterpret_cast<WebCamTypeInternal*>(Internal.get())->SetRawFrameType(RawFrameType::UYVY);
+	}
+	bool WebCamType::SetCurRawFrameTypeYVYU()
+	{
+		return reinterpret_cast<WebCamTypeInternal*>(Internal.get())->SetRawFrameType(RawFrameType::YVYU);
+	}
+	bool WebCamType::SetCurRawFrameTypeNV21()
+	{
+		return reinterpret_cast<WebCamTypeInternal*>(Internal.get())->SetRawFrameType(RawFrameType::NV21);
+	}
+	bool WebCamType::SetCurRawFrameTypeI420()
+	{
+		return reinterpret_cast<WebCamTypeInternal*>(Internal.get())->SetRawFrameType(RawFrameType::I420);
+	}
+	bool WebCamType::SetCurRawFrameTypeYV12()
+	{
+		return reinterpret_cast<WebCamTypeInternal*>(Internal.get())->SetRawFrameType(RawFrameType::YV12);
+	}
+	bool WebCamType::SetCurRawFrameTypeY8()
+	{
+		return reinterpret_cast<WebCamTypeInternal*>(Internal.get())->SetRawFrameType(RawFrameType::Y8);
+	}
+	bool WebCamType::SetCurRawFrameTypeP010()
+	{
+		return reinterpret_cast<WebCamTypeInternal*>(Internal.get())->SetRawFrameType(RawFrameType::P010);
+	}
+	bool WebCamType::SetCurRawFrameTypeY16()
+	{
+		return reinterpret_cast<WebCamTypeInternal*>(Internal.get())->SetRawFrameType(RawFrameType::Y16);
+	}
+	bool WebCamType::SetCurRawFrameTypeMJPG()
+	{
+		return reinterpret_cast<WebCamTypeInternal*>(Internal.get())->SetRawFrameType(RawFrameType::MJPG);
+	}
 }
@@ -11,8 +11,106 @@ namespace WindowsWebCamTypeLib
 {
 	using namespace UniformBitmap;
 
+	enum class ScaleFilterType
+	{
+		Box,
+		Bilinear
+	};
+
+	// 输出图像相对于传感器图像的方向，旋转均为顺时针
+	enum class OrientationType
+	{
+		Normal,
+		FlipH,
+		FlipV,
+		Rotate90,
+		Rotate180,
+		Rotate270
+	};
+
+	struct FrameRegion
+	{
+		uint32_t X = 0;
+		uint32_t Y = 0;
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+	};
+
+	// 帧缓冲区的像素格式，`Passthrough` 直接输出摄像头的原始格式（平面格式的各平面依次紧密排列，MJPG 输出压缩的帧且 `Pitch` 为 0）
+	// `RGBA16` 和 `Gray16` 每个通道 16 位，高位深的格式（P010、Y16）不经过色调映射，保留全部精度；`Gray16` 保留原始的亮度值
+	enum class OutputFormatType
+	{
+		RGBA8,
+		BGRA8,
+		RGB565,
+		Gray8,
+		RGBA16,
+		Gray16,
+		Passthrough
+	};
+
+	// 高位深的帧转换成 8 位时的窗口，数值按高位对齐到 16 位（P010 的 10 位采样左移 6 位）。
+	// `Low` 及以下为黑，`High` 及以上为白，中间按 `Gamma` 映射（大于 1 时提亮暗部）；
+	// `AutoWindow` 时按每一帧亮度的分布自动选择窗口，两端各舍去 `AutoClipPercent` 的像素
+	struct ToneMapping
+	{
+		uint16_t Low = 0;
+		uint16_t High = 65535;
+		float Gamma = 1.0f;
+		bool AutoWindow = false;
+		float AutoClipPercent = 0.5f;
+	};
+
+	// 设备的一种原生媒体类型。`Format` 与 `GetCurRawFrameType()` 的返回值相同，`Supported` 为 false 时无法转换；
+	// 帧率是分数，驱动给出可调的范围时 `MinFps*`、`MaxFps*` 与 `Fps*` 不同；`Pitch` 为 0 表示驱动没有给出步长
+	struct MediaTypeInfo
+	{
+		uint32_t Index = 0;
+		std::string Format;
+		bool Supported = false;
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		int32_t Pitch = 0;
+		uint32_t FpsNum = 0, FpsDen = 1;
+		uint32_t MinFpsNum = 0, MinFpsDen = 1;
+		uint32_t MaxFpsNum = 0, MaxFpsDen = 1;
+		float ConversionCost = 0;
+	};
+
+	// 选择媒体类型的条件。宽高为 0 时取最大的分辨率，`Fps` 为 0 时取最高的帧率；
+	// 各项得分按权重相乘，`CostWeight` 越大越偏向转换开销小的格式
+	struct MediaTypeRequest
+	{
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		float Fps = 0;
+		float ResolutionWeight = 1.0f;
+		float FpsWeight = 1.0f;
+		float CostWeight = 0.5f;
+	};
+
+	// 帧的时间戳，100 纳秒为单位。`SampleTime` 是媒体源给出的时间，每个摄像头各自从 0 开始；
+	// `SystemTime` 是采集时的系统时间（与 `MFGetSystemTime()` 相同），驱动没有给出时（`FromDevice` 为 false）是收到帧的时间
+	struct FrameTimestamp
+	{
+		int64_t SampleTime = 0;
+		int64_t SystemTime = 0;
+		bool FromDevice = false;
+	};
+
+	// 非 `RGBA8` 格式的输出帧
+	struct OutputFrame
+	{
+		OutputFormatType Format = OutputFormatType::RGBA8;
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		size_t Pitch = 0;
+		std::vector<uint8_t> Data;
+	};
+
 	class WebCamType;
 	using OnFrameCBType = void (*)(void* Userdata, WebCamType& wc, bool FrameUpdated);
+	using FrameDispatchCBType = void (*)(void* Userdata, WebCamType& wc);
 
 	class WebCamType
 	{
@@ -28,8 +126,54 @@ namespace WindowsWebCamTypeLib
 		static std::vector<std::string> EnumerateDevices();
 		static std::vector<std::wstring> EnumerateDevicesW();
 
+		// 设备的名字，与 `EnumerateDevices()` 的顺序相同
+		static std::vector<std::string> EnumerateDeviceNames();
+
 		Image_RGBA8& GetFrameBuffer();
 		const Image_RGBA8& GetFrameBuffer() const;
+		void SetFrameBufferSize(uint32_t Width, uint32_t Height, ScaleFilterType Filter = ScaleFilterType::Box);
+		void SetRegionOfInterest(uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height);
+		FrameRegion GetRegionOfInterest() const;
+		void SetOrientation(OrientationType Orientation);
+		OrientationType GetOrientation() const;
+		void SetOutputFormat(OutputFormatType Format);
+		OutputFormatType GetOutputFormat() const;
+		const OutputFrame& GetOutputFrame() const;
+
+		// 把 MJPG 帧原样录制到 QuickTime (.mov) 文件，需要先选择 MJPG 格式
+		void StartRecording(const std::string& Path);
+		void StopRecording();
+		bool IsRecording() const;
+
+		// 把摄像头输出的原始帧（包括步长、格式和时间戳）录制到文件，用 `RawFrameReaderType`（rawrec.hpp）读取
+		void StartRawRecording(const std::string& Path);
+		void StopRawRecording();
+		bool IsRawRecording() const;
+
+		// 关闭预览后不再解码和转换帧，只录制时可以省去解码的开销
+		void SetPreviewEnabled(bool Enabled);
+		bool GetPreviewEnabled() const;
+
+		void SetToneMapping(const ToneMapping& Params);
+		ToneMapping GetToneMapping() const;
+
+		// 列出当前设备所有的原生媒体类型，结果会缓存到更换设备为止。返回加锁时复制的副本，别的线程更换设备不会使它失效
+		std::vector<MediaTypeInfo> GetMediaTypes();
+
+		// 给每种媒体类型按分辨率、帧率和转换开销打分，从高到低尝试，成功时返回 true
+		bool SelectMediaType(const MediaTypeRequest& Request);
+		bool SetMediaType(uint32_t Index);
+
+		// 用实测的数据替换某种格式的转换开销（相对值，RGB32 为 1）
+		void SetFormatCost(const std::string& Format, float Cost);
+
+		// 设置后收到的帧不在采集线程上转换，只调用 `DispatchCB` 通知有新的帧，由调用者在任意线程上调用 `ProcessPendingFrame()` 转换，
+		// 之后照常调用 `OnFrameCB`；转换之前又收到新的帧时旧的帧被丢弃。`DispatchCB` 为 nullptr 时恢复在采集线程上转换
+		void SetFrameDispatcher(FrameDispatchCBType DispatchCB, void* Userdata);
+		bool ProcessPendingFrame();
+
+		// 帧缓冲区（或输出帧）中当前这一帧的时间戳，在 `OnFrameCB` 里读取
+		FrameTimestamp GetFrameTimestamp() const;
 
 		void QueryFrame();
 		bool IsFrameUpdated() const;
@@ -39,9 +183,20 @@ namespace WindowsWebCamTypeLib
 		bool SetCurRawFrameTypeRGB24();
 		bool SetCurRawFrameTypeYUY2();
 		bool SetCurRawFrameTypeNV12();
+		bool SetCurRawFrameTypeUYVY();
+		bool SetCurRawFrameTypeYVYU();
+		bool SetCurRawFrameTypeNV21();
+		bool SetCurRawFrameTypeI420();
+		bool SetCurRawFrameTypeYV12();
+		bool SetCurRawFrameTypeY8();
+		bool SetCurRawFrameTypeP010();
+		bool SetCurRawFrameTypeY16();
+		bool SetCurRawFrameTypeMJPG();
 
 		bool Verbose = false;
 		void* Userdata = nullptr;
 		OnFrameCBType OnFrameCB = nullptr;
+		void* FrameDispatchUserdata = nullptr;
+		FrameDispatchCBType FrameDispatchCB = nullptr;
 	};
 }
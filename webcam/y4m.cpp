@@ -0,0 +1,609 @@
+#include "y4m.hpp"
+
+#include <cstring>
+#include <cctype>
+
+namespace WindowsWebCamTypeLib
+{
+	Y4MStreamFailed::Y4MStreamFailed(const std::string& what) noexcept :
+		std::runtime_error(what)
+	{
+	}
+
+	static constexpr const char* Y4MSignature = "YUV4MPEG2";
+	static constexpr const char* Y4MFrameSignature = "FRAME";
+	static constexpr size_t Y4MMaxLineLength = 4096;
+
+	// 由 `C` 参数得到平面的布局，不认识时返回 false
+	struct Y4MChromaLayout
+	{
+		uint32_t ShiftX = 1;
+		uint32_t ShiftY = 1;
+		uint32_t NumPlanes = 3;
+		uint32_t BitDepth = 8;
+		size_t SampleBytes = 1;
+	};
+
+	static bool ParseChroma(const std::string& Tag, Y4MChromaLayout& Layout)
+	{
+		std::string Depth;
+		if (!Tag.compare(0, 4, "mono"))
+		{
+			Layout.ShiftX = Layout.ShiftY = 0;
+			Layout.NumPlanes = 1;
+			Depth = Tag.substr(4);
+		}
+		else
+		{
+			auto Base = Tag.substr(0, 3);
+			if (Base == "420") Layout.ShiftX = 1, Layout.ShiftY = 1;
+			else if (Base == "422") Layout.ShiftX = 1, Layout.ShiftY = 0;
+			else if (Base == "444") Layout.ShiftX = 0, Layout.ShiftY = 0;
+			else return false;
+			Layout.NumPlanes = 3;
+
+			// 8 位的 4:2:0 用后缀表示色度的位置，高位深用 `p` 加位数表示
+			auto Suffix = Tag.substr(3);
+			if (Suffix.size() && Suffix[0] == 'p' && Suffix.size() > 1 && isdigit(uint8_t(Suffix[1]))) Depth = Suffix.substr(1);
+			else if (!(Suffix == "" || Suffix == "jpeg" || Suffix == "mpeg2" || Suffix == "paldv")) return false;
+		}
+
+		Layout.BitDepth = 8;
+		if (Depth.size())
+		{
+			for (auto c : Depth) if (!isdigit(uint8_t(c))) return false;
+			Layout.BitDepth = uint32_t(std::stoul(Depth));
+			if (Layout.BitDepth < 8 || Layout.BitDepth > 16) return false;
+		}
+		Layout.SampleBytes = Layout.BitDepth > 8 ? 2 : 1;
+		return true;
+	}
+
+	static size_t GetY4MFrameSize(const Y4MChromaLayout& Layout, uint32_t Width, uint32_t Height)
+	{
+		size_t Size = size_t(Width) * Height;
+		if (Layout.NumPlanes == 3)
+		{
+			size_t ChromaWidth = (size_t(Width) + (1u << Layout.ShiftX) - 1) >> Layout.ShiftX;
+			size_t ChromaHeight = (size_t(Height) + (1u << Layout.ShiftY) - 1) >> Layout.ShiftY;
+			Size += 2 * ChromaWidth * ChromaHeight;
+		}
+		return Size * Layout.SampleBytes;
+	}
+
+	static void StoreSample16(uint8_t*& pDst, uint16_t v)
+	{
+		pDst[0] = uint8_t(v);
+		pDst[1] = uint8_t(v >> 8);
+		pDst += 2;
+	}
+
+	// 把 RGB 转换为 4:4:4 的 YUV（BT.601，视频范围），三个字节依次是 Y U V
+	struct YUV444Traits
+	{
+		static constexpr bool LumaOnly = false;
+		static constexpr size_t BytesPerPixel = 3;
+
+		static void StoreRGB(uint8_t* p, uint8_t R, uint8_t G, uint8_t B)
+		{
+			p[0] = uint8_t(((66 * R + 129 * G + 25 * B + 128) >> 8) + 16);
+			p[1] = uint8_t(((-38 * R - 74 * G + 112 * B + 128) >> 8) + 128);
+			p[2] = uint8_t(((112 * R - 94 * G - 18 * B + 128) >> 8) + 128);
+		}
+	};
+
+	//-------------------------------------------------------------------
+	// Plane writers
+	//
+	// One per raw frame type, generated from the same traits as the
+	// converters. Each writes the Y, Cb and Cr planes of one frame
+	// back to back, in the layout of its `C` tag.
+	//-------------------------------------------------------------------
+
+	template<RawFrameType RFT>
+	static void WriteY4MPlanes(uint8_t* pDst, const uint8_t* pSrc, int32_t SrcPitch, uint32_t Width, uint32_t Height)
+	{
+		using Traits = RawFrameTraits<RFT>;
+		if constexpr (RFT == RawFrameType::RGB32 || RFT == RawFrameType::RGB24)
+		{
+			thread_local std::vector<uint8_t> Row;
+			Row.resize(size_t(Width) * YUV444Traits::BytesPerPixel);
+			size_t PlaneSize = size_t(Width) * Height;
+			for (uint32_t y = 0; y < Height; y++)
+			{
+				Traits::template Convert<YUV444Traits>(Row.data(), 0, pSrc + ptrdiff_t(y) * SrcPitch, SrcPitch, Width, 1);
+				uint8_t* pY = pDst + size_t(y) * Width;
+				for (uint32_t x = 0; x < Width; x++)
+				{
+					pY[x] = Row[x * 3 + 0];
+					pY[x + PlaneSize] = Row[x * 3 + 1];
+					pY[x + PlaneSize * 2] = Row[x * 3 + 2];
+				}
+			}
+		}
+		else if constexpr (Traits::NumPlanes > 1)
+		{
+			// 4:2:0，交错的色度拆成两个平面；P010 的有效位移到低位
+			auto Chroma = Traits::GetChromaPlanes(pSrc, SrcPitch, Height);
+			for (uint32_t y = 0; y < Height; y++)
+			{
+				const uint8_t* pRow = pSrc + ptrdiff_t(y) * SrcPitch;
+				if constexpr (Traits::BytesPerPixel == 1)
+				{
+					memcpy(pDst, pRow, Width);
+					pDst += Width;
+				}
+				else
+				{
+					for (uint32_t x = 0; x < Width; x++) StoreSample16(pDst, Traits::LoadSample(pRow + x * 2) >> 6);
+				}
+			}
+			for (const uint8_t* pPlane : { Chroma.pCb, Chroma.pCr })
+			{
+				for (uint32_t y = 0; y < Height / 2; y++)
+				{
+					const uint8_t* pRow = pPlane + ptrdiff_t(y) * Chroma.Pitch;
+					for (uint32_t x = 0; x < Width / 2; x++)
+					{
+						if constexpr (Traits::BytesPerPixel == 1) *pDst++ = pRow[x * Traits::ChromaStep];
+						else StoreSample16(pDst, Traits::LoadSample(pRow + x * Traits::ChromaStep) >> 6);
+					}
+				}
+			}
+		}
+		else if constexpr (Traits::IsYUV)
+		{
+			// 打包的 4:2:2
+			uint8_t* pY = pDst;
+			uint8_t* pU = pY + size_t(Width) * Height;
+			uint8_t* pV = pU + size_t(Width / 2) * Height;
+			for (uint32_t y = 0; y < Height; y++)
+			{
+				const uint8_t* pPair = pSrc + ptrdiff_t(y) * SrcPitch;
+				for (uint32_t x = 0; x < Width; x += 2)
+				{
+					*pY++ = pPair[Traits::OffY0];
+					*pY++ = pPair[Traits::OffY1];
+					*pU++ = pPair[Traits::OffU];
+					*pV++ = pPair[Traits::OffV];
+					pPair += 4;
+				}
+			}
+		}
+		else
+		{
+			// 灰度，Y16 按原样写入
+			for (uint32_t y = 0; y < Height; y++)
+			{
+				memcpy(pDst, pSrc + ptrdiff_t(y) * SrcPitch, size_t(Width) * Traits::BytesPerPixel);
+				pDst += size_t(Width) * Traits::BytesPerPixel;
+			}
+		}
+	}
+
+	// 按 `RawFrameType` 索引
+	struct Y4MOutputFormat
+	{
+		const char* Chroma;
+		Y4MWriterType::PlaneWriterFuncType Writer;
+	};
+
+	static constexpr Y4MOutputFormat Y4MOutputFormats[NumRawFrameTypes] =
+	{
+		{ nullptr, nullptr },
+		{ "444", WriteY4MPlanes<RawFrameType::RGB32> },
+		{ "444", WriteY4MPlanes<RawFrameType::RGB24> },
+		{ "422", WriteY4MPlanes<RawFrameType::YUY2> },
+		{ "420mpeg2", WriteY4MPlanes<RawFrameType::NV12> },
+		{ "422", WriteY4MPlanes<RawFrameType::UYVY> },
+		{ "422", WriteY4MPlanes<RawFrameType::YVYU> },
+		{ "420mpeg2", WriteY4MPlanes<RawFrameType::NV21> },
+		{ "420mpeg2", WriteY4MPlanes<RawFrameType::I420> },
+		{ "420mpeg2", WriteY4MPlanes<RawFrameType::YV12> },
+		{ "mono", WriteY4MPlanes<RawFrameType::Y8> },
+		{ "420p10", WriteY4MPlanes<RawFrameType::P010> },
+		{ "mono16", WriteY4MPlanes<RawFrameType::Y16> },
+		{ nullptr, nullptr },
+	};
+
+	Y4MWriterType::Y4MWriterType(const std::string& Path, RawFrameType SrcType, uint32_t Width, uint32_t Height, uint32_t FpsNum, uint32_t FpsDen, size_t BatchSize) :
+		Name(Path), SrcType(SrcType), Width(Width), Height(Height), BatchSize(BatchSize)
+	{
+		File = fopen(Path.c_str(), "wb");
+		if (!File) throw Y4MStreamFailed("Couldn't create `" + Path + "`.");
+		OwnsFile = true;
+		try
+		{
+			Init(FpsNum, FpsDen);
+		}
+		catch (const Y4MStreamFailed&)
+		{
+			fclose(File);
+			File = nullptr;
+			throw;
+		}
+	}
+
+	Y4MWriterType::Y4MWriterType(FILE* Stream, RawFrameType SrcType, uint32_t Width, uint32_t Height, uint32_t FpsNum, uint32_t FpsDen, size_t BatchSize) :
+		Name("the Y4M stream"), File(Stream), SrcType(SrcType), Width(Width), Height(Height), BatchSize(BatchSize)
+	{
+		if (!File) throw Y4MStreamFailed("No stream to write Y4M frames to.");
+		try
+		{
+			Init(FpsNum, FpsDen);
+		}
+		catch (const Y4MStreamFailed&)
+		{
+			File = nullptr;
+			throw;
+		}
+	}
+
+	Y4MWriterType::~Y4MWriterType()
+	{
+		try
+		{
+			Close();
+		}
+		catch (const Y4MStreamFailed&)
+		{
+		}
+	}
+
+	void Y4MWriterType::Init(uint32_t FpsNum, uint32_t FpsDen)
+	{
+		if (size_t(SrcType) >= NumRawFrameTypes || !Y4MOutputFormats[size_t(SrcType)].Writer)
+		{
+			throw Y4MStreamFailed("Y4M can't store this raw frame type.");
+		}
+		if (!Width || !Height) throw Y4MStreamFailed("Bad video size " + std::to_string(Width) + "x" + std::to_string(Height) + ".");
+		if (!FpsNum || !FpsDen) throw Y4MStreamFailed("Bad frame rate " + std::to_string(FpsNum) + ":" + std::to_string(FpsDen) + ".");
+
+		auto& Format = Y4MOutputFormats[size_t(SrcType)];
+		Y4MChromaLayout Layout;
+		ParseChroma(Format.Chroma, Layout);
+		if ((Width & ((1u << Layout.ShiftX) - 1)) || (Height & ((1u << Layout.ShiftY) - 1)))
+		{
+			throw Y4MStreamFailed("The size of subsampled frames must be even, got " + std::to_string(Width) + "x" + std::to_string(Height) + ".");
+		}
+		PlaneWriter = Format.Writer;
+		FrameSize = GetY4MFrameSize(Layout, Width, Height);
+
+		std::string Header = std::string(Y4MSignature) +
+			" W" + std::to_string(Width) +
+			" H" + std::to_string(Height) +
+			" F" + std::to_string(FpsNum) + ":" + std::to_string(FpsDen) +
+			" Ip A1:1 C" + Format.Chroma;
+
+		// 灰度格式是全范围的
+		if (Layout.NumPlanes == 1) Header += " XCOLORRANGE=FULL";
+		Header += "\n";
+
+		Batch.reserve(BatchSize > FrameSize + 16 ? BatchSize : FrameSize + 16);
+		Batch.insert(Batch.end(), Header.begin(), Header.end());
+	}
+
+	void Y4MWriterType::WriteFrame(const void* pScanline0, int32_t Pitch)
+	{
+		if (!File) throw Y4MStreamFailed("`" + Name + "` is already closed.");
+
+		static constexpr char FrameHeader[] = "FRAME\n";
+		size_t Start = Batch.size();
+		Batch.resize(Start + sizeof FrameHeader - 1 + FrameSize);
+		memcpy(&Batch[Start], FrameHeader, sizeof FrameHeader - 1);
+		PlaneWriter(&Batch[Start + sizeof FrameHeader - 1], reinterpret_cast<const uint8_t*>(pScanline0), Pitch, Width, Height);
+		NumFrames++;
+
+		if (Batch.size() >= BatchSize) Flush();
+	}
+
+	void Y4MWriterType::Flush()
+	{
+		if (!File) return;
+		if (Batch.size())
+		{
+			size_t Size = Batch.size();
+			size_t Written = fwrite(Batch.data(), 1, Size, File);
+			Batch.clear();
+			if (Written != Size) throw Y4MStreamFailed("Couldn't write to `" + Name + "`.");
+		}
+		if (fflush(File)) throw Y4MStreamFailed("Couldn't write to `" + Name + "`.");
+	}
+
+	void Y4MWriterType::Close()
+	{
+		if (!File) return;
+		bool Failed = false;
+		try
+		{
+			Flush();
+		}
+		catch (const Y4MStreamFailed&)
+		{
+			Failed = true;
+		}
+		if (OwnsFile) Failed = fclose(File) || Failed;
+		File = nullptr;
+		if (Failed) throw Y4MStreamFailed("Couldn't finish writing `" + Name + "`.");
+	}
+
+	bool Y4MWriterType::IsOpened() const
+	{
+		return File != nullptr;
+	}
+
+	size_t Y4MWriterType::GetNumFrames() const
+	{
+		return NumFrames;
+	}
+
+	static bool ReadLine(FILE* File, std::string& Line)
+	{
+		Line.clear();
+		for (;;)
+		{
+			int c = fgetc(File);
+			if (c == EOF) return Line.size() != 0;
+			if (c == '\n') return true;
+			if (Line.size() >= Y4MMaxLineLength) return false;
+			Line.push_back(char(c));
+		}
+	}
+
+	Y4MReaderType::Y4MReaderType(const std::string& Path) :
+		Name(Path)
+	{
+		File = fopen(Path.c_str(), "rb");
+		if (!File) throw Y4MStreamFailed("Couldn't open `" + Path + "`.");
+		OwnsFile = true;
+		try
+		{
+			Init();
+		}
+		catch (const Y4MStreamFailed&)
+		{
+			fclose(File);
+			File = nullptr;
+			throw;
+		}
+	}
+
+	Y4MReaderType::Y4MReaderType(FILE* Stream) :
+		Name("the Y4M stream"), File(Stream)
+	{
+		if (!File) throw Y4MStreamFailed("No stream to read Y4M frames from.");
+		Init();
+	}
+
+	Y4MReaderType::~Y4MReaderType()
+	{
+		if (File && OwnsFile) fclose(File);
+	}
+
+	void Y4MReaderType::Init()
+	{
+		std::string Header;
+		if (!ReadLine(File, Header)) throw Y4MStreamFailed("`" + Name + "` doesn't have a Y4M header.");
+		ParseHeader(Header);
+		DataStart = ftell(File);
+	}
+
+	void Y4MReaderType::ParseHeader(const std::string& Header)
+	{
+		size_t SigLength = strlen(Y4MSignature);
+		if (Header.compare(0, SigLength, Y4MSignature)) throw Y4MStreamFailed("`" + Name + "` is not a Y4M stream.");
+
+		Chroma = "420jpeg";
+		size_t Pos = SigLength;
+		while (Pos < Header.size())
+		{
+			size_t End = Header.find(' ', Pos);
+			if (End == std::string::npos) End = Header.size();
+			auto Token = Header.substr(Pos, End - Pos);
+			Pos = End + 1;
+			if (Token.empty()) continue;
+
+			auto Value = Token.substr(1);
+			try
+			{
+				switch (Token[0])
+				{
+				case 'W': Width = uint32_t(std::stoul(Value)); break;
+				case 'H': Height = uint32_t(std::stoul(Value)); break;
+				case 'C': Chroma = Value; break;
+				case 'F':
+				{
+					size_t Colon = Value.find(':');
+					if (Colon == std::string::npos) throw Y4MStreamFailed("Bad Y4M frame rate `" + Value + "`.");
+					FpsNum = uint32_t(std::stoul(Value.substr(0, Colon)));
+					FpsDen = uint32_t(std::stoul(Value.substr(Colon + 1)));
+					break;
+				}
+				default:
+					// 交错方式、像素宽高比和 `X` 开头的扩展参数用不到
+					break;
+				}
+			}
+			catch (const std::logic_error&)
+			{
+				throw Y4MStreamFailed("Bad Y4M header parameter `" + Token + "`.");
+			}
+		}
+
+		if (!Width || !Height) throw Y4MStreamFailed("`" + Name + "` doesn't give the frame size.");
+		if (!FpsNum || !FpsDen) FpsNum = 30, FpsDen = 1;
+
+		Y4MChromaLayout Layout;
+		if (!ParseChroma(Chroma, Layout)) throw Y4MStreamFailed("Unsupported Y4M chroma format `" + Chroma + "`.");
+		ChromaShiftX = Layout.ShiftX;
+		ChromaShiftY = Layout.ShiftY;
+		NumPlanes = Layout.NumPlanes;
+		SampleBytes = Layout.SampleBytes;
+		BitDepth = Layout.BitDepth;
+		Planes.resize(GetY4MFrameSize(Layout, Width, Height));
+	}
+
+	bool Y4MReaderType::ReadFrame()
+	{
+		std::string Line;
+		if (!ReadLine(File, Line)) return false;
+		if (Line.compare(0, strlen(Y4MFrameSignature), Y4MFrameSignature)) throw Y4MStreamFailed("Bad Y4M frame header in `" + Name + "`.");
+		if (fread(Planes.data(), 1, Planes.size(), File) != Planes.size()) return false;
+
+		NumRead++;
+		PackFrame();
+		return true;
+	}
+
+	void Y4MReaderType::PackFrame()
+	{
+		// 宽高为奇数时色度平面的尺寸与原始格式对不上
+		bool Even = !(Width & 1) && !(Height & 1);
+		size_t LumaSize = size_t(Width) * Height;
+		FrameType = RawFrameType::Unknown;
+		FrameData = nullptr;
+		FramePitch = 0;
+
+		if (NumPlanes == 1)
+		{
+			// 灰度，16 位以下的高位深移到高位
+			FrameType = SampleBytes == 1 ? RawFrameType::Y8 : RawFrameType::Y16;
+			FramePitch = size_t(Width) * SampleBytes;
+			if (SampleBytes == 1 || BitDepth == 16)
+			{
+				FrameData = Planes.data();
+				return;
+			}
+			Frame.resize(Planes.size());
+			auto pSrc = Planes.data();
+			auto pDst = Frame.data();
+			for (size_t i = 0; i < LumaSize; i++, pSrc += 2)
+			{
+				StoreSample16(pDst, uint16_t((pSrc[0] | (pSrc[1] << 8)) << (16 - BitDepth)));
+			}
+			FrameData = Frame.data();
+		}
+		else if (ChromaShiftX == 1 && ChromaShiftY == 1 && Even)
+		{
+			if (SampleBytes == 1)
+			{
+				// Y4M 的 4:2:0 平面与 I420 的内存布局相同
+				FrameType = RawFrameType::I420;
+				FramePitch = Width;
+				FrameData = Planes.data();
+				return;
+			}
+
+			// 高位深的 4:2:0 转为 P010，色度交错存放，有效位在高位
+			FrameType = RawFrameType::P010;
+			FramePitch = size_t(Width) * 2;
+			Frame.resize(LumaSize * 3);
+			uint32_t Shift = 16 - BitDepth;
+			auto Load = [](const uint8_t* p) { return uint16_t(p[0] | (p[1] << 8)); };
+			auto pSrc = Planes.data();
+			auto pDst = Frame.data();
+			for (size_t i = 0; i < LumaSize; i++, pSrc += 2) StoreSample16(pDst, uint16_t(Load(pSrc) << Shift));
+			size_t ChromaSize = LumaSize / 4;
+			const uint8_t* pCb = Planes.data() + LumaSize * 2;
+			const uint8_t* pCr = pCb + ChromaSize * 2;
+			for (size_t i = 0; i < ChromaSize; i++)
+			{
+				StoreSample16(pDst, uint16_t(Load(pCb + i * 2) << Shift));
+				StoreSample16(pDst, uint16_t(Load(pCr + i * 2) << Shift));
+			}
+			FrameData = Frame.data();
+		}
+		else if (ChromaShiftX == 1 && ChromaShiftY == 0 && SampleBytes == 1 && !(Width & 1))
+		{
+			// 8 位的 4:2:2 转为 YUY2
+			FrameType = RawFrameType::YUY2;
+			FramePitch = size_t(Width) * 2;
+			Frame.resize(LumaSize * 2);
+			const uint8_t* pY = Planes.data();
+			const uint8_t* pU = pY + LumaSize;
+			const uint8_t* pV = pU + LumaSize / 2;
+			auto pDst = Frame.data();
+			for (size_t i = 0; i < LumaSize / 2; i++)
+			{
+				*pDst++ = *pY++;
+				*pDst++ = *pU++;
+				*pDst++ = *pY++;
+				*pDst++ = *pV++;
+			}
+			FrameData = Frame.data();
+		}
+	}
+
+	void Y4MReaderType::Rewind()
+	{
+		if (DataStart < 0 || fseek(File, DataStart, SEEK_SET)) throw Y4MStreamFailed("`" + Name + "` can't be rewound.");
+		NumRead = 0;
+		FrameType = RawFrameType::Unknown;
+		FrameData = nullptr;
+	}
+
+	uint32_t Y4MReaderType::GetWidth() const
+	{
+		return Width;
+	}
+
+	uint32_t Y4MReaderType::GetHeight() const
+	{
+		return Height;
+	}
+
+	uint32_t Y4MReaderType::GetFpsNum() const
+	{
+		return FpsNum;
+	}
+
+	uint32_t Y4MReaderType::GetFpsDen() const
+	{
+		return FpsDen;
+	}
+
+	const std::string& Y4MReaderType::GetChroma() const
+	{
+		return Chroma;
+	}
+
+	RawFrameType Y4MReaderType::GetRawFrameType() const
+	{
+		return FrameType;
+	}
+
+	const uint8_t* Y4MReaderType::GetFrameData() const
+	{
+		return FrameData;
+	}
+
+	int32_t Y4MReaderType::GetFramePitch() const
+	{
+		return int32_t(FramePitch);
+	}
+
+	size_t Y4MReaderType::GetFrameIndex() const
+	{
+		return NumRead ? NumRead - 1 : 0;
+	}
+
+	int64_t Y4MReaderType::GetTimestamp() const
+	{
+		return int64_t(GetFrameIndex()) * 10000000 * FpsDen / FpsNum;
+	}
+
+	const uint8_t* Y4MReaderType::GetPlane(uint32_t Index, size_t& Pitch) const
+	{
+		if (Index >= NumPlanes) throw std::out_of_range("`" + Name + "` only has " + std::to_string(NumPlanes) + " planes.");
+		size_t LumaSize = size_t(Width) * Height * SampleBytes;
+		size_t ChromaWidth = (size_t(Width) + (1u << ChromaShiftX) - 1) >> ChromaShiftX;
+		size_t ChromaHeight = (size_t(Height) + (1u << ChromaShiftY) - 1) >> ChromaShiftY;
+		if (!Index)
+		{
+			Pitch = size_t(Width) * SampleBytes;
+			return Planes.data();
+		}
+		Pitch = ChromaWidth * SampleBytes;
+		return Planes.data() + LumaSize + (Index - 1) * ChromaWidth * ChromaHeight * SampleBytes;
+	}
+}
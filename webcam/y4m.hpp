@@ -0,0 +1,147 @@
+#pragma once
+
+#include "pixfmt.hpp"
+
+#include <cstdio>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <stdexcept>
+#include <string>
+
+namespace WindowsWebCamTypeLib
+{
+	class Y4MStreamFailed : public std::runtime_error
+	{
+	public:
+		Y4MStreamFailed(const std::string& what) noexcept;
+	};
+
+	//-------------------------------------------------------------------
+	// Y4MWriterType
+	//
+	// Writes raw frames as a YUV4MPEG2 stream, keeping their chroma
+	// layout: 4:2:0 formats become `C420mpeg2` (`C420p10` for P010),
+	// the packed 4:2:2 formats `C422`, Y8/Y16 `Cmono`/`Cmono16`, and
+	// RGB32/RGB24 are converted to `C444`. Frames are collected in a
+	// batch buffer and written with one `fwrite()` per batch.
+	//
+	// The frames take the same `pScanline0` and `Pitch` as the
+	// converters, e.g. a passthrough `OutputFrame` or a
+	// `RecordedFrame` from `RawFrameReaderType`. A `FILE*` from
+	// `_popen()` can be given to feed an encoder directly.
+	//-------------------------------------------------------------------
+
+	class Y4MWriterType
+	{
+	public:
+		using PlaneWriterFuncType = void(*)(uint8_t* pDst, const uint8_t* pSrc, int32_t SrcPitch, uint32_t Width, uint32_t Height);
+
+	protected:
+		std::string Name;
+		FILE* File = nullptr;
+		bool OwnsFile = false;
+		RawFrameType SrcType;
+		uint32_t Width;
+		uint32_t Height;
+		size_t FrameSize = 0;
+		size_t BatchSize;
+		PlaneWriterFuncType PlaneWriter = nullptr;
+		std::vector<uint8_t> Batch;
+		size_t NumFrames = 0;
+
+		void Init(uint32_t FpsNum, uint32_t FpsDen);
+
+	public:
+		Y4MWriterType(const std::string& Path, RawFrameType SrcType, uint32_t Width, uint32_t Height, uint32_t FpsNum = 30, uint32_t FpsDen = 1, size_t BatchSize = 16u << 20);
+
+		// 写入已经打开的流（如管道），需要以二进制方式打开，关闭时不会关闭这个流
+		Y4MWriterType(FILE* Stream, RawFrameType SrcType, uint32_t Width, uint32_t Height, uint32_t FpsNum = 30, uint32_t FpsDen = 1, size_t BatchSize = 16u << 20);
+
+		Y4MWriterType(const Y4MWriterType&) = delete;
+		Y4MWriterType& operator = (const Y4MWriterType&) = delete;
+		~Y4MWriterType();
+
+		void WriteFrame(const void* pScanline0, int32_t Pitch);
+		void Flush();
+		void Close();
+
+		bool IsOpened() const;
+		size_t GetNumFrames() const;
+	};
+
+	//-------------------------------------------------------------------
+	// Y4MReaderType
+	//
+	// Reads a YUV4MPEG2 stream one frame at a time. Frames with a
+	// layout the converters know are returned as a raw frame: 8-bit
+	// 4:2:0 as I420, 10-bit 4:2:0 as P010, 4:2:2 as YUY2 and mono as
+	// Y8/Y16, so a Y4M file can stand in for a camera. 4:4:4 frames
+	// are only available as planes.
+	//-------------------------------------------------------------------
+
+	class Y4MReaderType
+	{
+	protected:
+		std::string Name;
+		FILE* File = nullptr;
+		bool OwnsFile = false;
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		uint32_t FpsNum = 30;
+		uint32_t FpsDen = 1;
+		std::string Chroma;
+		uint32_t ChromaShiftX = 1;
+		uint32_t ChromaShiftY = 1;
+		uint32_t NumPlanes = 3;
+		size_t SampleBytes = 1;
+		uint32_t BitDepth = 8;
+		long DataStart = 0;
+
+		// 读到的平面，格式不能直接用时转换到 `Frame` 里
+		std::vector<uint8_t> Planes;
+		std::vector<uint8_t> Frame;
+		RawFrameType FrameType = RawFrameType::Unknown;
+		const uint8_t* FrameData = nullptr;
+		size_t FramePitch = 0;
+		size_t NumRead = 0;
+
+		void Init();
+		void ParseHeader(const std::string& Header);
+		void PackFrame();
+
+	public:
+		Y4MReaderType(const std::string& Path);
+
+		// 从已经打开的流读取，关闭时不会关闭这个流
+		Y4MReaderType(FILE* Stream);
+
+		Y4MReaderType(const Y4MReaderType&) = delete;
+		Y4MReaderType& operator = (const Y4MReaderType&) = delete;
+		~Y4MReaderType();
+
+		// 读取下一帧，流结束时返回 false
+		bool ReadFrame();
+
+		// 回到第一帧，只能用于文件
+		void Rewind();
+
+		uint32_t GetWidth() const;
+		uint32_t GetHeight() const;
+		uint32_t GetFpsNum() const;
+		uint32_t GetFpsDen() const;
+		const std::string& GetChroma() const;
+
+		// 当前帧的原始格式，`Unknown` 时只能用 `GetPlane()`
+		RawFrameType GetRawFrameType() const;
+		const uint8_t* GetFrameData() const;
+		int32_t GetFramePitch() const;
+
+		// 当前帧的序号（从 0 开始）和按帧率算出的时间戳（100 纳秒为单位）
+		size_t GetFrameIndex() const;
+		int64_t GetTimestamp() const;
+
+		// 第 `Index` 个平面（Y、Cb、Cr），`Pitch` 为每行的字节数
+		const uint8_t* GetPlane(uint32_t Index, size_t& Pitch) const;
+	};
+}